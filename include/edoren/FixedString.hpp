@@ -0,0 +1,453 @@
+#pragma once
+
+#include <edoren/StringView.hpp>
+#include <edoren/UTF.hpp>
+#include <edoren/util/Config.hpp>
+
+#include <algorithm>
+#include <compare>
+#include <string>
+#include <type_traits>
+
+#ifdef EDOTOOLS_FMT_SUPPORT
+    #include <fmt/format.h>
+#endif
+#ifdef EDOTOOLS_NLOHMANN_JSON_SUPPORT
+    #include <nlohmann/json.hpp>
+#endif
+
+namespace edoren {
+
+/**
+ * @brief Enum to specify how a FixedString handles data that does not fit in its capacity
+ */
+enum class FixedStringOverflow {
+    TRUNCATE,  ///< Discard the code points that does not fit
+    THROW,     ///< Throw a std::length_error
+};
+
+/**
+ * @brief UTF-8 string with a fixed capacity stored inline
+ *
+ * FixedString never allocates memory, all the data lives inside the object
+ * itself, so it's suitable for short strings built on hot paths like
+ * timestamps, log prefixes or numeric conversions.
+ *
+ * When some data does not fit in the capacity the behavior depends on the
+ * `Overflow` policy. Truncation always happens on a code point boundary so
+ * the string remains valid UTF-8.
+ *
+ * @code
+ * FixedString<16> s = "hello";
+ * s += ' ';
+ * s += U'\U0001F600';
+ * StringView view = s;  // no copy involved
+ * @endcode
+ *
+ * @tparam Capacity The maximum size in bytes of the string, without the null terminator
+ * @tparam Overflow The policy to apply when the capacity is exceeded. See @ref FixedStringOverflow.
+ */
+template <size_t Capacity, FixedStringOverflow Overflow = FixedStringOverflow::TRUNCATE>
+class FixedString {
+    static_assert(Capacity > 0, "Capacity must be at least 1");
+
+public:
+    ////////////////////////////////////////////////////////////
+    // Types
+    ////////////////////////////////////////////////////////////
+    using size_type = size_t;                                                      ///< Size type
+    using const_iterator = utf::Iterator<utf::UTF_8, const char*>;                 ///< Read-only iterator type
+    using iterator = const_iterator;                                               ///< Iterator type
+    using const_reverse_iterator = utf::ReverseIterator<utf::UTF_8, const char*>;  ///< Read-only reverse iterator type
+    using reverse_iterator = const_reverse_iterator;                               ///< Reverse iterator type
+
+    ////////////////////////////////////////////////////////////
+    // Static member data
+    ////////////////////////////////////////////////////////////
+    static inline const size_type sInvalidPos = size_type(-1);  ///< Represents an invalid position in the string
+
+    /**
+     * @brief Default constructor
+     *
+     * This constructor creates an empty string.
+     */
+    constexpr FixedString() = default;
+
+    /**
+     * @brief Construct from a null-terminated (value 0) UTF-8 string
+     *
+     * @param utf8String UTF-8 string to assign
+     */
+    constexpr FixedString(const char* utf8String);
+
+    /**
+     * @brief Construct from a null-terminated (value 0) UTF-8 string
+     *
+     * @param utf8String UTF-8 string to assign
+     */
+    constexpr FixedString(const char8_t* utf8String);
+
+    /**
+     * @brief Construct from single UTF-32 character
+     *
+     * @param utf32Char UTF-32 character to convert
+     */
+    constexpr FixedString(char32_t utf32Char);
+
+    /**
+     * @brief Construct from an StringView
+     *
+     * @param stringView String view to assign
+     */
+    constexpr FixedString(const StringView& stringView);
+
+    /**
+     * @brief Copy constructor
+     *
+     * @param other Instance to copy
+     */
+    constexpr FixedString(const FixedString& other) = default;
+
+    /**
+     * @brief Copy assignment operator
+     *
+     * @param other Instance to copy
+     *
+     * @return Reference to self
+     */
+    constexpr FixedString& operator=(const FixedString& other) = default;
+
+    /**
+     * @brief Create a new FixedString from an arithmetic value
+     *
+     * Unlike String::FromValue this method does not use any stream,
+     * so no memory is allocated.
+     *
+     * @param value The value to be converted to a FixedString
+     *
+     * @return A FixedString containing the converted value
+     */
+    template <typename T>
+    static FixedString FromValue(T value);
+
+    /**
+     * @brief Implicit conversion operator to StringView
+     *
+     * @return A view to the string data
+     */
+    constexpr operator StringView() const;
+
+    /**
+     * @brief Overload of += operator to append an UTF-8 string
+     *
+     * @param right String to append
+     *
+     * @return Reference to self
+     */
+    constexpr FixedString& operator+=(const StringView& right);
+
+    /**
+     * @brief Overload of += operator to append an UTF-8 null
+     *        terminated string
+     *
+     * @param right String to append
+     *
+     * @return Reference to self
+     */
+    constexpr FixedString& operator+=(const char* right);
+
+    /**
+     * @brief Overload of += operator to append a single ASCII
+     *        character
+     *
+     * @throws std::runtime_error if `right` is not an ASCII character,
+     *         since a single byte outside of it is not valid UTF-8
+     *
+     * @param right ASCII character to append
+     *
+     * @return Reference to self
+     */
+    constexpr FixedString& operator+=(char right);
+
+    /**
+     * @brief Overload of += operator to append a UTF-32 character
+     *
+     * @param right Utf-32 character to append
+     *
+     * @return Reference to self
+     */
+    constexpr FixedString& operator+=(char32_t right);
+
+    /**
+     * @brief Overload of += operator to append a UTF-8 CodeUnit
+     *
+     * @param right CodeUnit to append
+     *
+     * @return Reference to self
+     */
+    constexpr FixedString& operator+=(const utf::CodeUnit<utf::UTF_8>& right);
+
+    /**
+     * @brief Overload of [] operator to access a character by its position
+     *
+     * This function provides read-only access to characters.
+     * Note: the behavior is undefined if `index` is out of range.
+     *
+     * @param index Index of the character to get
+     *
+     * @return Character at position `index`
+     */
+    constexpr utf::CodeUnit<utf::UTF_8> operator[](size_type index) const;
+
+    /**
+     * @brief Clear the string
+     *
+     * This function removes all the characters from the string.
+     *
+     * @see isEmpty, erase
+     */
+    constexpr void clear();
+
+    /**
+     * @brief Get the size of the string
+     *
+     * @return Number of UTF-8 codepoints in the string
+     *
+     * @see isEmpty, GetCapacity
+     */
+    constexpr size_type getSize() const;
+
+    /**
+     * @brief Get the maximum number of bytes the string can hold
+     *
+     * @return The string capacity in bytes
+     *
+     * @see getDataSize
+     */
+    static constexpr size_type GetCapacity();
+
+    /**
+     * @brief Check whether the string is empty or not
+     *
+     * @return True if the string is empty (i.e. contains no character)
+     *
+     * @see clear, getSize
+     */
+    constexpr bool isEmpty() const;
+
+    /**
+     * @brief Erase one or more characters from the string
+     *
+     * This function removes a sequence of `count` characters
+     * starting from `position`.
+     *
+     * @param position Position of the first character to erase
+     * @param count    Number of characters to erase
+     */
+    constexpr void erase(size_type position, size_type count = 1);
+
+    /**
+     * @brief Insert one or more characters into the string
+     *
+     * This function inserts the characters of `str`
+     * into the string, starting from `position`.
+     *
+     * @param position Position of insertion
+     * @param str      Characters to insert
+     */
+    constexpr void insert(size_type position, const StringView& str);
+
+    /**
+     * @brief Replace a SubString with another string
+     *
+     * This function replaces the SubString that starts at index `position`
+     * and spans `length` characters with the string `replaceWith`.
+     *
+     * @param position    Index of the first character to be replaced
+     * @param length      Number of characters to replace
+     * @param replaceWith String that replaces the given SubString.
+     */
+    constexpr void replace(size_type position, size_type length, const StringView& replaceWith);
+
+    /**
+     * @copydoc StringView::find
+     */
+    constexpr size_type find(const StringView& str, size_type start = 0) const;
+
+    /**
+     * @copydoc StringView::findFirstOf
+     */
+    constexpr size_type findFirstOf(const StringView& str, size_type pos = 0) const;
+
+    /**
+     * @copydoc StringView::findLastOf
+     */
+    constexpr size_type findLastOf(const StringView& str, size_type pos = sInvalidPos) const;
+
+    /**
+     * @copydoc StringView::startsWith
+     */
+    constexpr bool startsWith(const StringView& other) const;
+
+    /**
+     * @copydoc StringView::endsWith
+     */
+    constexpr bool endsWith(const StringView& other) const;
+
+    /**
+     * @brief Return a part of the string
+     *
+     * This function returns the SubString that starts at index `position`
+     * and spans `length` characters.
+     *
+     * @param position Index of the first character
+     * @param length   Number of characters to include in the SubString
+     *
+     * @return FixedString object containing a SubString of this object
+     */
+    constexpr FixedString subString(size_type position, size_type length = sInvalidPos) const;
+
+    /**
+     * @brief Get a pointer to the C-style array of characters
+     *
+     * This functions provides a read-only access to a
+     * null-terminated C-style representation of the string.
+     *
+     * @return Read-only pointer to the array of characters
+     *
+     * @see getDataSize
+     */
+    constexpr const char* getData() const;
+
+    /**
+     * @brief Get the size in bytes of the string
+     *
+     * @return Number of bytes the data has
+     *
+     * @see getData
+     */
+    constexpr size_type getDataSize() const;
+
+    /**
+     * @copydoc String::cbegin
+     */
+    constexpr const_iterator begin() const;
+
+    /**
+     * @copydoc String::cbegin
+     */
+    constexpr const_iterator cbegin() const;
+
+    /**
+     * @copydoc String::cend
+     */
+    constexpr const_iterator end() const;
+
+    /**
+     * @copydoc String::cend
+     */
+    constexpr const_iterator cend() const;
+
+    /**
+     * @copydoc String::crbegin
+     */
+    constexpr const_reverse_iterator crbegin() const;
+
+    /**
+     * @copydoc String::crend
+     */
+    constexpr const_reverse_iterator crend() const;
+
+    /**
+     * @brief Get a view to the string data
+     *
+     * @return A StringView of the whole string
+     */
+    constexpr StringView getView() const;
+
+    /**
+     * @brief Overload of == operator to compare a FixedString with a StringView
+     *
+     * @param left  Left operand (a FixedString)
+     * @param right Right operand (a StringView)
+     *
+     * @return True if both strings are equal
+     */
+    friend constexpr bool operator==(const FixedString& left, const StringView& right) {
+        return left.m_size == right.getDataSize() &&
+               std::equal(left.m_data, left.m_data + left.m_size, right.getData());
+    }
+
+    /**
+     * @copydoc operator==(const FixedString&, const StringView&)
+     */
+    friend constexpr bool operator==(const FixedString& left, const char* right) {
+        return left == StringView(right);
+    }
+
+    /**
+     * @copydoc operator==(const FixedString&, const StringView&)
+     */
+    friend bool operator==(const FixedString& left, const char8_t* right) {
+        return left == StringView(right);
+    }
+
+    /**
+     * @copydoc operator==(const FixedString&, const StringView&)
+     */
+    friend bool operator==(const FixedString& left, const String& right) {
+        return left == StringView(right);
+    }
+
+    /**
+     * @brief Overload of <=> operator to compare a FixedString with a StringView
+     *
+     * @param left  Left operand (a FixedString)
+     * @param right Right operand (a StringView)
+     *
+     * @return The ordering between both strings
+     */
+    friend std::strong_ordering operator<=>(const FixedString& left, const StringView& right) {
+        return left.getView() <=> right;
+    }
+
+private:
+    constexpr size_type getByteOffset(size_type position) const;
+
+    template <typename CharT>
+    constexpr void replaceBytes(size_type offset, size_type count, const CharT* data, size_type size);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    char m_data[Capacity + 1] = {};  ///< Inline null-terminated UTF-8 data
+    size_type m_size = {0};          ///< The size in bytes of the data
+};
+
+}  // namespace edoren
+
+#ifdef EDOTOOLS_FMT_SUPPORT
+// See https://fmt.dev/latest/api.html#formatting-user-defined-types
+
+template <size_t Capacity, edoren::FixedStringOverflow Overflow>
+struct fmt::formatter<edoren::FixedString<Capacity, Overflow>> : fmt::formatter<std::string_view> {
+    auto format(const edoren::FixedString<Capacity, Overflow>& value, format_context& ctx) const
+        -> format_context::iterator;
+};
+
+#endif  // EDOTOOLS_FMT_SUPPORT
+
+#ifdef EDOTOOLS_NLOHMANN_JSON_SUPPORT
+
+namespace nlohmann {
+
+template <size_t Capacity, edoren::FixedStringOverflow Overflow>
+struct adl_serializer<edoren::FixedString<Capacity, Overflow>> {
+    static void to_json(json& j, const edoren::FixedString<Capacity, Overflow>& s);
+};
+
+}  // namespace nlohmann
+
+#endif  // EDOTOOLS_NLOHMANN_JSON_SUPPORT
+
+#include "FixedString.inl"
@@ -0,0 +1,338 @@
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace edoren {
+
+////////////////////////////////////////////////////////////////////////////////
+// Internal FixedString functions
+////////////////////////////////////////////////////////////////////////////////
+namespace internal {
+
+/**
+ * @brief Get the biggest size lower or equal than `maxSize` that ends on a code point boundary
+ */
+template <typename CharT>
+constexpr size_t TruncateUtf8(const CharT* data, size_t size, size_t maxSize) {
+    if (size <= maxSize) {
+        return size;
+    }
+    size_t newSize = maxSize;
+    // Move back while the first discarded byte is a continuation byte (0b10xxxxxx)
+    while (newSize > 0 && (static_cast<uint8_t>(data[newSize]) & 0xC0) == 0x80) {
+        newSize--;
+    }
+    return newSize;
+}
+
+}  // namespace internal
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr FixedString<Capacity, Overflow>::FixedString(const char* utf8String)
+      : FixedString(StringView(utf8String)) {}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr FixedString<Capacity, Overflow>::FixedString(const char8_t* utf8String) {
+    if (utf8String && utf8String[0] != 0) {
+        size_type length = std::char_traits<char8_t>::length(utf8String);
+        if (utf::IsValid<utf::UTF_8>(utf8String, utf8String + length)) {
+            replaceBytes(0, 0, utf8String, length);
+        } else {
+            EDOTOOLS_THROW(std::runtime_error("invalid utf8 convertion."));
+        }
+    }
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr FixedString<Capacity, Overflow>::FixedString(char32_t utf32Char) {
+    *this += utf32Char;
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr FixedString<Capacity, Overflow>::FixedString(const StringView& stringView) {
+    replaceBytes(0, 0, stringView.getData(), stringView.getDataSize());
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+template <typename T>
+FixedString<Capacity, Overflow> FixedString<Capacity, Overflow>::FromValue(T value) {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>, "The value must be a number");
+    // Big enough for the shortest representation of any arithmetic type
+    char buffer[128] = {};
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    FixedString string;
+    string.replaceBytes(0, 0, buffer, result.ptr - buffer);
+    return string;
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr FixedString<Capacity, Overflow>::operator StringView() const {
+    return getView();
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr FixedString<Capacity, Overflow>& FixedString<Capacity, Overflow>::operator+=(const StringView& right) {
+    replaceBytes(m_size, 0, right.getData(), right.getDataSize());
+    return *this;
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr FixedString<Capacity, Overflow>& FixedString<Capacity, Overflow>::operator+=(const char* right) {
+    return *this += StringView(right);
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr FixedString<Capacity, Overflow>& FixedString<Capacity, Overflow>::operator+=(char right) {
+    if (right < 0) {
+        EDOTOOLS_THROW(std::runtime_error("invalid utf8 convertion."));
+    }
+    replaceBytes(m_size, 0, &right, 1);
+    return *this;
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr FixedString<Capacity, Overflow>& FixedString<Capacity, Overflow>::operator+=(char32_t right) {
+    return *this += utf::CodeUnit<utf::UTF_8>(right);
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr FixedString<Capacity, Overflow>& FixedString<Capacity, Overflow>::operator+=(
+    const utf::CodeUnit<utf::UTF_8>& right) {
+    replaceBytes(m_size, 0, right.begin(), right.getSize());
+    return *this;
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr utf::CodeUnit<utf::UTF_8> FixedString<Capacity, Overflow>::operator[](size_type index) const {
+    return getView()[index];
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr void FixedString<Capacity, Overflow>::clear() {
+    m_size = 0;
+    m_data[0] = 0;
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::size_type FixedString<Capacity, Overflow>::getSize() const {
+    return getView().getSize();
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::size_type FixedString<Capacity, Overflow>::GetCapacity() {
+    return Capacity;
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr bool FixedString<Capacity, Overflow>::isEmpty() const {
+    return m_size == 0;
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr void FixedString<Capacity, Overflow>::erase(size_type position, size_type count) {
+    replace(position, count, StringView());
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr void FixedString<Capacity, Overflow>::insert(size_type position, const StringView& str) {
+    size_type utf8StrSize = getSize();
+    if (position >= utf8StrSize) {
+        EDOTOOLS_THROW(std::out_of_range("the specified position is out of the string range"));
+    }
+
+    // Insert the data in the correct position
+    replaceBytes(getByteOffset(position), 0, str.getData(), str.getDataSize());
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr void FixedString<Capacity, Overflow>::replace(size_type position,
+                                                        size_type length,
+                                                        const StringView& replaceWith) {
+    size_type utf8StrSize = getSize();
+    if ((position + length) > utf8StrSize) {
+        EDOTOOLS_THROW(std::out_of_range("the specified position is out of the string range"));
+    }
+
+    // Iterate to the start and end codepoint
+    auto startIt = cbegin() + position;
+    auto endIt = startIt + length;
+
+    size_type replacePos = startIt.getPtr() - m_data;
+    size_type replaceCount = endIt.getPtr() - startIt.getPtr();
+    replaceBytes(replacePos, replaceCount, replaceWith.getData(), replaceWith.getDataSize());
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::size_type FixedString<Capacity, Overflow>::find(
+    const StringView& str,
+    size_type start) const {
+    return getView().find(str, start);
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::size_type FixedString<Capacity, Overflow>::findFirstOf(
+    const StringView& str,
+    size_type pos) const {
+    return getView().findFirstOf(str, pos);
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::size_type FixedString<Capacity, Overflow>::findLastOf(
+    const StringView& str,
+    size_type pos) const {
+    return getView().findLastOf(str, pos);
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr bool FixedString<Capacity, Overflow>::startsWith(const StringView& other) const {
+    return getView().startsWith(other);
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr bool FixedString<Capacity, Overflow>::endsWith(const StringView& other) const {
+    return getView().endsWith(other);
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr FixedString<Capacity, Overflow> FixedString<Capacity, Overflow>::subString(size_type position,
+                                                                                     size_type length) const {
+    return FixedString(getView().subString(position, length));
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr const char* FixedString<Capacity, Overflow>::getData() const {
+    return m_data;
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::size_type FixedString<Capacity, Overflow>::getDataSize() const {
+    return m_size;
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::const_iterator FixedString<Capacity, Overflow>::begin() const {
+    return cbegin();
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::const_iterator FixedString<Capacity, Overflow>::cbegin() const {
+    return const_iterator(std::make_pair(getData(), getData() + m_size), getData());
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::const_iterator FixedString<Capacity, Overflow>::end() const {
+    return cend();
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::const_iterator FixedString<Capacity, Overflow>::cend() const {
+    return const_iterator(std::make_pair(getData(), getData() + m_size), getData() + m_size);
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::const_reverse_iterator FixedString<Capacity, Overflow>::crbegin()
+    const {
+    return getView().crbegin();
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::const_reverse_iterator FixedString<Capacity, Overflow>::crend()
+    const {
+    return getView().crend();
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr StringView FixedString<Capacity, Overflow>::getView() const {
+    return StringView(m_data, m_size, utf::AssumeValid);
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+constexpr typename FixedString<Capacity, Overflow>::size_type FixedString<Capacity, Overflow>::getByteOffset(
+    size_type position) const {
+    return (cbegin() + position).getPtr() - m_data;
+}
+
+template <size_t Capacity, FixedStringOverflow Overflow>
+template <typename CharT>
+constexpr void FixedString<Capacity, Overflow>::replaceBytes(size_type offset,
+                                                             size_type count,
+                                                             const CharT* data,
+                                                             size_type size) {
+    size_type available = Capacity - (m_size - count);
+    if (size > available) {
+        if constexpr (Overflow == FixedStringOverflow::THROW) {
+            EDOTOOLS_THROW(std::length_error("the data exceeds the FixedString capacity"));
+        }
+        size = internal::TruncateUtf8(data, size, available);
+    }
+
+    // Clamp the ranges to the capacity again, so the compiler can prove that the copies are in bounds
+    offset = std::min(offset, Capacity);
+    count = std::min(count, Capacity - offset);
+    size = std::min(size, Capacity - offset);
+    const size_type tailSize = std::min(m_size - std::min(m_size, offset + count), Capacity - (offset + size));
+
+    if (std::is_constant_evaluated()) {
+        // Move the remaining data to its new position
+        char* tailBegin = m_data + offset + count;
+        char* tailEnd = tailBegin + tailSize;
+        if (size > count) {
+            std::copy_backward(tailBegin, tailEnd, tailEnd + (size - count));
+        } else if (size < count) {
+            std::copy(tailBegin, tailEnd, tailBegin - (count - size));
+        }
+        std::transform(data, data + size, m_data + offset, [](CharT ch) { return static_cast<char>(ch); });
+    } else {
+        // Data from this same string may be moved below, so keep a copy of it. The buffer is left
+        // uninitialized since only the copied bytes are read
+        char copy[Capacity];
+        if constexpr (std::is_same_v<CharT, char>) {
+            if (std::greater_equal<const char*>()(data, m_data) && std::less<const char*>()(data, m_data + Capacity)) {
+                std::memcpy(copy, data, size);
+                data = copy;
+            }
+        }
+        std::memmove(m_data + offset + size, m_data + offset + count, tailSize);
+        if constexpr (sizeof(CharT) == 1) {
+            std::memcpy(m_data + offset, data, size);
+        } else {
+            std::transform(data, data + size, m_data + offset, [](CharT ch) { return static_cast<char>(ch); });
+        }
+    }
+    m_size = m_size - count + size;
+    m_data[m_size] = 0;
+}
+
+}  // namespace edoren
+
+#ifdef EDOTOOLS_FMT_SUPPORT
+
+template <size_t Capacity, edoren::FixedStringOverflow Overflow>
+auto fmt::formatter<edoren::FixedString<Capacity, Overflow>>::format(
+    const edoren::FixedString<Capacity, Overflow>& value,
+    format_context& ctx) const -> format_context::iterator {
+    return fmt::formatter<std::string_view>::format(std::string_view(value.getData(), value.getDataSize()), ctx);
+}
+
+#endif  // EDOTOOLS_FMT_SUPPORT
+
+#ifdef EDOTOOLS_NLOHMANN_JSON_SUPPORT
+
+namespace nlohmann {
+
+template <size_t Capacity, edoren::FixedStringOverflow Overflow>
+void adl_serializer<edoren::FixedString<Capacity, Overflow>>::to_json(
+    json& j,
+    const edoren::FixedString<Capacity, Overflow>& s) {
+    j = std::string(s.getData(), s.getDataSize());
+}
+
+}  // namespace nlohmann
+
+#endif  // EDOTOOLS_NLOHMANN_JSON_SUPPORT
@@ -37,9 +37,14 @@ class Function;
  */
 template <typename Ret, typename... Args, size_t MaxSize>
 class Function<Ret(Args...), MaxSize> {
-    static_assert(sizeof(MaxSize) > 0, "MaxSize must be at least 1");
+    static_assert(MaxSize > 0, "MaxSize must be at least 1");
 
 public:
+    /**
+     * @brief Size in bytes of the internal buffer that stores the callable
+     */
+    static constexpr size_t sInlineCapacity = MaxSize;
+
     /**
      * @brief Default constructor
      */
@@ -108,7 +113,7 @@ public:
      *
      * @param other The other function to swap with this
      */
-    void swap(Function& other);
+    void swap(Function& other) noexcept;
 
     /**
      * @brief Checks instance does not point to any function
@@ -132,15 +137,24 @@ public:
 private:
     enum class Operation {
         COPY,
+        MOVE,  ///< Move the function to dest, destroying the one in src
         DESTROY,
     };
 
+    // Callables that can be copied and destroyed as raw bytes, they are stored without manager
+    template <typename FunctionType>
+    static constexpr bool sIsTrivial = std::is_trivially_copy_constructible_v<FunctionType> &&
+                                       std::is_trivially_move_constructible_v<FunctionType> &&
+                                       std::is_trivially_destructible_v<FunctionType>;
+
     template <typename FunctionType>
     static Ret CallFunction(const void* data, Args&&... args);
 
     template <typename FunctionType>
     static void ManageFunction(void* dest, const void* src, Operation op);
 
+    void moveFrom(Function& other) noexcept;
+
     using Invoker = Ret (*)(const void*, Args&&...);
     using Manager = void (*)(void*, const void*, Operation);
 #if PLATFORM_IS(PLATFORM_ANDROID | PLATFORM_IOS)
@@ -150,10 +164,23 @@ private:
 #endif
 
     Storage m_data;     ///< Stores a copy of the Functor
-    Invoker m_invoker;  ///< Pointer to the caller function for m_data
-    Manager m_manager;  ///< Pointer to the function that manages the m_data
+    Invoker m_invoker;  ///< Pointer to the caller function for m_data, null if the function is empty
+    Manager m_manager;  ///< Pointer to the function that manages the m_data, null for trivial callables
 };
 
+/**
+ * @brief Function whose whole object, including the internal pointers, uses `TotalSize` bytes
+ *
+ * Useful to fit Function objects stored in arrays into cache lines, for example
+ * `CompactFunction<void(), 64>` takes exactly one 64 byte cache line. `TotalSize`
+ * should be a multiple of the storage alignment, otherwise padding is added.
+ *
+ * @tparam Func The function type
+ * @tparam TotalSize The size in bytes of each Function object
+ */
+template <typename Func, size_t TotalSize = 64>
+using CompactFunction = Function<Func, TotalSize - 2 * sizeof(void*)>;
+
 }  // namespace edoren
 
 #include "Function.inl"
@@ -2,7 +2,9 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
 
+#include <new>
 #include <utility>
 
 namespace edoren {
@@ -21,22 +23,21 @@ template <typename Ret, typename... Args, size_t MaxSize>
 Function<Ret(Args...), MaxSize>::Function(const Function& other) : m_data(),
                                                                    m_invoker(nullptr),
                                                                    m_manager(nullptr) {
-    if (other.m_manager) {
+    if (other.m_manager != nullptr) {
         other.m_manager(&m_data, &other.m_data, Operation::COPY);
-        m_invoker = other.m_invoker;
-        m_manager = other.m_manager;
+    } else {
+        // Trivial callables are copied as raw bytes
+        std::memcpy(&m_data, &other.m_data, sizeof(Storage));
     }
+    m_invoker = other.m_invoker;
+    m_manager = other.m_manager;
 }
 
 template <typename Ret, typename... Args, size_t MaxSize>
-Function<Ret(Args...), MaxSize>::Function(Function&& other) noexcept
-      : m_data(),
-        m_invoker(std::move(other.m_invoker)),
-        m_manager(std::move(other.m_manager)) {
-    other.m_manager(&m_data, &other.m_data, Operation::COPY);
-    other.m_manager(&other.m_data, nullptr, Operation::DESTROY);
-    other.m_invoker = nullptr;
-    other.m_manager = nullptr;
+Function<Ret(Args...), MaxSize>::Function(Function&& other) noexcept : m_data(),
+                                                                       m_invoker(nullptr),
+                                                                       m_manager(nullptr) {
+    moveFrom(other);
 }
 
 template <typename Ret, typename... Args, size_t MaxSize>
@@ -49,7 +50,9 @@ Function<Ret(Args...), MaxSize>::Function(T&& fun) : m_data(),
     static_assert(type::alignment_of<lambda_type>() <= type::alignment_of<Storage>(), "Align is off");
     new (&m_data) lambda_type(std::forward<T>(fun));
     m_invoker = &CallFunction<lambda_type>;
-    m_manager = &ManageFunction<lambda_type>;
+    if constexpr (!sIsTrivial<lambda_type>) {
+        m_manager = &ManageFunction<lambda_type>;
+    }
 }
 
 template <typename Ret, typename... Args, size_t MaxSize>
@@ -67,14 +70,10 @@ Function<Ret(Args...), MaxSize>& Function<Ret(Args...), MaxSize>::operator=(cons
 
 template <typename Ret, typename... Args, size_t MaxSize>
 Function<Ret(Args...), MaxSize>& Function<Ret(Args...), MaxSize>::operator=(Function&& other) noexcept {
-    if (other.m_manager != nullptr) {
-        other.m_manager(&m_data, &other.m_data, Operation::COPY);
-        other.m_manager(&other.m_data, nullptr, Operation::DESTROY);
+    if (this != &other) {
+        *this = nullptr;
+        moveFrom(other);
     }
-    m_invoker = std::move(other.m_invoker);
-    m_manager = std::move(other.m_manager);
-    other.m_invoker = nullptr;
-    other.m_manager = nullptr;
     return *this;
 }
 
@@ -83,8 +82,8 @@ Function<Ret(Args...), MaxSize>& Function<Ret(Args...), MaxSize>::operator=(std:
     if (m_manager != nullptr) {
         m_manager(&m_data, nullptr, Operation::DESTROY);
         m_manager = nullptr;
-        m_invoker = nullptr;
     }
+    m_invoker = nullptr;
     return *this;
 }
 
@@ -103,15 +102,19 @@ Function<Ret(Args...), MaxSize>& Function<Ret(Args...), MaxSize>::operator=(std:
 }
 
 template <typename Ret, typename... Args, size_t MaxSize>
-void Function<Ret(Args...), MaxSize>::swap(Function& other) {
-    std::swap(m_data, other.m_data);
-    std::swap(m_manager, other.m_manager);
-    std::swap(m_invoker, other.m_invoker);
+void Function<Ret(Args...), MaxSize>::swap(Function& other) noexcept {
+    // The storage can't be swapped byte by byte, the callables may not be trivially relocatable
+    if (this == &other) {
+        return;
+    }
+    Function temp(std::move(other));
+    other.moveFrom(*this);
+    moveFrom(temp);
 }
 
 template <typename Ret, typename... Args, size_t MaxSize>
 Function<Ret(Args...), MaxSize>::operator bool() const noexcept {
-    return m_manager != nullptr;
+    return m_invoker != nullptr;
 }
 
 template <typename Ret, typename... Args, size_t MaxSize>
@@ -147,10 +150,32 @@ void Function<Ret(Args...), MaxSize>::ManageFunction(void* dest, const void* src
             new (dest_cast) FunctionType(*srcCast);
             break;
         }
+        case Operation::MOVE: {
+            // Only requested by the move operations, where the source is never const
+            auto* srcCast = static_cast<FunctionType*>(const_cast<void*>(src));
+            new (dest_cast) FunctionType(std::move(*srcCast));
+            srcCast->~FunctionType();
+            break;
+        }
         case Operation::DESTROY:
             dest_cast->~FunctionType();
             break;
     }
 }
 
+template <typename Ret, typename... Args, size_t MaxSize>
+void Function<Ret(Args...), MaxSize>::moveFrom(Function& other) noexcept {
+    // Expects this instance to be empty, leaves the other one empty
+    if (other.m_manager != nullptr) {
+        other.m_manager(&m_data, &other.m_data, Operation::MOVE);
+    } else {
+        // Trivial callables are relocated as raw bytes
+        std::memcpy(&m_data, &other.m_data, sizeof(Storage));
+    }
+    m_invoker = other.m_invoker;
+    m_manager = other.m_manager;
+    other.m_invoker = nullptr;
+    other.m_manager = nullptr;
+}
+
 }  // namespace edoren
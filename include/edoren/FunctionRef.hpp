@@ -0,0 +1,96 @@
+#pragma once
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace edoren {
+
+/**
+ * @brief Class to hold a non-owning reference to a function
+ *
+ * @tparam Func The function type
+ *
+ * @see FunctionRef<Ret(Args...)> for concrete implementation
+ */
+template <typename Func>
+class FunctionRef;
+
+/**
+ * @brief Class to hold a non-owning reference to a function
+ *
+ * FunctionRef only stores a pointer to the callable and a pointer to the
+ * function that calls it, so it's cheap to pass by value and calling it
+ * costs a single indirect call. It's meant for callbacks that are not
+ * stored after the call that receives them returns.
+ *
+ * @code
+ * void WalkFiles(FunctionRef<void(StringView)> visitor);
+ *
+ * WalkFiles([&count](StringView path) { count++; });
+ * @endcode
+ *
+ * @warning The referenced callable must outlive the FunctionRef. Do not
+ *          create a FunctionRef from a temporary lambda that is stored.
+ *
+ * @tparam Ret The return type of the function
+ * @tparam Args The parameters that the function receives
+ */
+template <typename Ret, typename... Args>
+class FunctionRef<Ret(Args...)> {
+public:
+    /**
+     * @brief Construct from a function pointer
+     *
+     * @param function The function to reference, it must not be null
+     */
+    FunctionRef(Ret (*function)(Args...)) noexcept;
+
+    /**
+     * @brief Construct from any callable object
+     *
+     * @param callable The lambda function or callable object to reference
+     */
+    template <typename T,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, FunctionRef> &&
+                                          !std::is_function_v<std::remove_reference_t<T>> &&
+                                          std::is_invocable_r_v<Ret, T&, Args...>>>
+    FunctionRef(T&& callable) noexcept;
+
+    /**
+     * @brief Copy constructor
+     */
+    FunctionRef(const FunctionRef& other) noexcept = default;
+
+    /**
+     * @brief Copy operator
+     */
+    FunctionRef& operator=(const FunctionRef& other) noexcept = default;
+
+    /**
+     * @brief Function-call operator
+     *
+     * @param args Arguments to call the referenced function
+     */
+    Ret operator()(Args... args) const;
+
+private:
+    union Target {
+        void* object;
+        Ret (*function)(Args...);
+    };
+
+    template <typename T>
+    static Ret CallObject(Target target, Args&&... args);
+
+    static Ret CallFunction(Target target, Args&&... args);
+
+    using Invoker = Ret (*)(Target, Args&&...);
+
+    Target m_target;    ///< The referenced callable
+    Invoker m_invoker;  ///< Pointer to the caller function for m_target
+};
+
+}  // namespace edoren
+
+#include "FunctionRef.inl"
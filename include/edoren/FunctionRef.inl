@@ -0,0 +1,40 @@
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace edoren {
+
+template <typename Ret, typename... Args>
+FunctionRef<Ret(Args...)>::FunctionRef(Ret (*function)(Args...)) noexcept : m_target(),
+                                                                              m_invoker(&CallFunction) {
+    m_target.function = function;
+}
+
+template <typename Ret, typename... Args>
+template <typename T, typename>
+FunctionRef<Ret(Args...)>::FunctionRef(T&& callable) noexcept : m_target(),
+                                                                 m_invoker(&CallObject<std::remove_reference_t<T>>) {
+    m_target.object = const_cast<void*>(static_cast<const void*>(std::addressof(callable)));
+}
+
+template <typename Ret, typename... Args>
+Ret FunctionRef<Ret(Args...)>::operator()(Args... args) const {
+    return m_invoker(m_target, std::forward<Args>(args)...);
+}
+
+template <typename Ret, typename... Args>
+template <typename T>
+Ret FunctionRef<Ret(Args...)>::CallObject(Target target, Args&&... args) {
+    if constexpr (std::is_void_v<Ret>) {
+        std::invoke(*static_cast<T*>(target.object), std::forward<Args>(args)...);
+    } else {
+        return std::invoke(*static_cast<T*>(target.object), std::forward<Args>(args)...);
+    }
+}
+
+template <typename Ret, typename... Args>
+Ret FunctionRef<Ret(Args...)>::CallFunction(Target target, Args&&... args) {
+    return target.function(std::forward<Args>(args)...);
+}
+
+}  // namespace edoren
@@ -26,11 +26,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <compare>
 #include <edoren/StringView.hpp>
+#include <edoren/Unicode.hpp>
 #include <edoren/UTF.hpp>
 #include <edoren/util/Config.hpp>
 #include <edoren/util/Platform.hpp>
+#include <iterator>
 #include <sstream>
 #include <string>
 
@@ -43,6 +46,14 @@
 
 namespace edoren {
 
+/**
+ * @brief Enum to specify how a conversion handles code points that the target encoding can not represent
+ */
+enum class EncodingErrorPolicy {
+    REPLACE,  ///< Replace the code point with `?`
+    THROW,    ///< Throw a std::range_error
+};
+
 /**
  * @brief Utility string class that automatically handles
  *       conversions between types and encodings
@@ -272,6 +283,37 @@ public:
         return string;
     }
 
+    /**
+     * @brief Create a new String from a UTF-8 encoded string without
+     *        validating it
+     *
+     * @note No UTF-8 validation is performed, use it only with data
+     *       that is already known to be valid UTF-8
+     *
+     * @param begin Pointer to the beginning of the UTF-8 sequence
+     * @param end   Pointer to the end of the UTF-8 sequence
+     *
+     * @return A String containing the source string
+     *
+     * @see FromUtf8
+     */
+    static String FromUtf8Unchecked(const char* begin, const char* end);
+
+    /**
+     * @brief Create a new String from a UTF-8 encoded string without
+     *        validating it
+     *
+     * @note No UTF-8 validation is performed, use it only with data
+     *       that is already known to be valid UTF-8
+     *
+     * @param utf8String UTF-8 string to move
+     *
+     * @return A String containing the source string
+     *
+     * @see FromUtf8
+     */
+    static String FromUtf8Unchecked(std::basic_string<char>&& utf8String);
+
     /**
      * @brief Create a new String from a UTF-16 encoded string
      *
@@ -385,6 +427,65 @@ public:
         return string;
     }
 
+    /**
+     * @brief Create a new String from a Latin-1 (ISO-8859-1) encoded string
+     *
+     * Strings that only contain ASCII characters are copied directly,
+     * the rest are converted copying the runs of ASCII characters 8
+     * bytes at a time.
+     *
+     * @param begin Pointer to the beginning of the Latin-1 sequence
+     * @param end   Pointer to the end of the Latin-1 sequence
+     *
+     * @return A String containing the source string
+     *
+     * @see FromWindows1252, toLatin1
+     */
+    static String FromLatin1(const char* begin, const char* end);
+
+    /**
+     * @brief Create a new String from a Latin-1 (ISO-8859-1) encoded string
+     *
+     * If the string only contains ASCII characters its buffer is moved
+     * into the String without any copy.
+     *
+     * @param latin1String Latin-1 string to convert
+     *
+     * @return A String containing the source string
+     *
+     * @see FromWindows1252, toLatin1
+     */
+    static String FromLatin1(std::basic_string<char>&& latin1String);
+
+    /**
+     * @brief Create a new String from a Windows-1252 encoded string
+     *
+     * The bytes that are not assigned in Windows-1252 are mapped to the
+     * C1 control characters with the same value.
+     *
+     * @param begin Pointer to the beginning of the Windows-1252 sequence
+     * @param end   Pointer to the end of the Windows-1252 sequence
+     *
+     * @return A String containing the source string
+     *
+     * @see FromLatin1, toWindows1252
+     */
+    static String FromWindows1252(const char* begin, const char* end);
+
+    /**
+     * @brief Create a new String from a Windows-1252 encoded string
+     *
+     * If the string only contains ASCII characters its buffer is moved
+     * into the String without any copy.
+     *
+     * @param windows1252String Windows-1252 string to convert
+     *
+     * @return A String containing the source string
+     *
+     * @see FromLatin1, toWindows1252
+     */
+    static String FromWindows1252(std::basic_string<char>&& windows1252String);
+
     /**
      * @brief Explicit conversion operator to std::basic_string<char>
      *        (UTF-8 string)
@@ -476,6 +577,68 @@ public:
      */
     std::basic_string<wchar_t> toWide() const;
 
+    /**
+     * @brief Convert the UTF-8 string to a UTF-16 string reusing an
+     *        existing buffer
+     *
+     * The content of `output` is replaced, but its capacity is kept so
+     * repeated conversions do not need to allocate memory.
+     *
+     * @param output The string where the converted data is stored
+     *
+     * @see toUtf16
+     */
+    void toUtf16Into(std::basic_string<char16_t>& output) const;
+
+    /**
+     * @brief Convert the UTF-8 string to a UTF-32 string reusing an
+     *        existing buffer
+     *
+     * @copydetails toUtf16Into
+     *
+     * @see toUtf32
+     */
+    void toUtf32Into(std::basic_string<char32_t>& output) const;
+
+    /**
+     * @brief Convert the UTF-8 string to a wide string reusing an
+     *        existing buffer
+     *
+     * @copydetails toUtf16Into
+     *
+     * @see toWide
+     */
+    void toWideInto(std::basic_string<wchar_t>& output) const;
+
+    /**
+     * @brief Convert the UTF-8 string to a Latin-1 (ISO-8859-1) string
+     *
+     * @param policy What to do with the code points above U+00FF. See @ref EncodingErrorPolicy.
+     *
+     * @return Converted Latin-1 string
+     *
+     * @throws std::range_error If `policy` is EncodingErrorPolicy::THROW and
+     *         some code point can not be represented
+     *
+     * @see FromLatin1, toWindows1252
+     */
+    std::basic_string<char> toLatin1(EncodingErrorPolicy policy = EncodingErrorPolicy::REPLACE) const;
+
+    /**
+     * @brief Convert the UTF-8 string to a Windows-1252 string
+     *
+     * @param policy What to do with the code points that Windows-1252 can not
+     *               represent. See @ref EncodingErrorPolicy.
+     *
+     * @return Converted Windows-1252 string
+     *
+     * @throws std::range_error If `policy` is EncodingErrorPolicy::THROW and
+     *         some code point can not be represented
+     *
+     * @see FromWindows1252, toLatin1
+     */
+    std::basic_string<char> toWindows1252(EncodingErrorPolicy policy = EncodingErrorPolicy::REPLACE) const;
+
     /**
      * @brief Overload of assignment operator
      *
@@ -686,6 +849,66 @@ public:
      */
     bool endsWith(const StringView& other) const;
 
+    /**
+     * @copydoc StringView::equalsIgnoreCase
+     */
+    bool equalsIgnoreCase(const StringView& other) const;
+
+    /**
+     * @copydoc StringView::compareIgnoreCase
+     */
+    std::strong_ordering compareIgnoreCase(const StringView& other) const;
+
+    /**
+     * @copydoc StringView::findIgnoreCase
+     */
+    size_type findIgnoreCase(const StringView& str, size_type start = 0) const;
+
+    /**
+     * @copydoc StringView::countGraphemes
+     */
+    size_type countGraphemes() const;
+
+    /**
+     * @brief Return the first grapheme clusters of the string
+     *
+     * The string is never cut in the middle of a grapheme cluster.
+     *
+     * @param count Maximum number of grapheme clusters to keep
+     *
+     * @return String with the first `count` grapheme clusters
+     *
+     * @see countGraphemes
+     */
+    String truncateGraphemes(size_type count) const;
+
+    /**
+     * @brief Remove the leading and trailing white space
+     *
+     * @return String without leading and trailing white space
+     *
+     * @see StringView::trim
+     */
+    String trim() const;
+
+    /**
+     * @brief Remove the leading white space
+     *
+     * @return String without leading white space
+     *
+     * @see StringView::trimStart
+     */
+    String trimStart() const;
+
+    /**
+     * @brief Remove the trailing white space
+     *
+     * @return String without trailing white space
+     *
+     * @see StringView::trimEnd
+     */
+    String trimEnd() const;
+
     /**
      * @brief Replace a SubString with another string
      *
@@ -740,6 +963,208 @@ public:
      */
     String subString(size_type position, size_type length = sInvalidPos) const;
 
+    ////////////////////////////////////////////////////////////
+    // Byte offset API
+    ////////////////////////////////////////////////////////////
+
+    /**
+     * @copydoc StringView::findBytes
+     */
+    size_type findBytes(const StringView& str, size_type offset = 0) const;
+
+    /**
+     * @brief Return a part of the string using byte offsets
+     *
+     * @param offset Byte offset of the first character
+     * @param count  Number of bytes to include in the SubString. @ref sInvalidPos
+     *               can be used to include all the bytes until the end of the string.
+     *
+     * @return String object containing a SubString of this object
+     *
+     * @throws std::out_of_range if `offset` is past the end of the string
+     * @throws std::invalid_argument if the range does not start and end at a
+     *         code point boundary
+     */
+    String subStringBytes(size_type offset, size_type count = sInvalidPos) const;
+
+    /**
+     * @brief Erase one or more bytes from the string
+     *
+     * This function removes a sequence of `count` bytes starting
+     * from the byte offset `offset`.
+     *
+     * @param offset Byte offset of the first character to erase
+     * @param count  Number of bytes to erase. @ref sInvalidPos can be
+     *               used to erase all the bytes until the end of the string.
+     *
+     * @throws std::out_of_range if `offset` is past the end of the string
+     * @throws std::invalid_argument if the range does not start and end at a
+     *         code point boundary
+     */
+    void eraseBytes(size_type offset, size_type count = sInvalidPos);
+
+    /**
+     * @brief Insert one or more characters into the string at a byte offset
+     *
+     * @param offset Byte offset of insertion, it can be equal to
+     *               @ref getDataSize to append at the end
+     * @param str    Characters to insert
+     *
+     * @throws std::out_of_range if `offset` is past the end of the string
+     * @throws std::invalid_argument if `offset` is not at a code point boundary
+     */
+    void insertBytes(size_type offset, const StringView& str);
+
+    /**
+     * @brief Replace a range of bytes with another string
+     *
+     * @param offset      Byte offset of the first character to be replaced
+     * @param count       Number of bytes to replace. @ref sInvalidPos can be
+     *                    used to replace all the bytes until the end of the string.
+     * @param replaceWith String that replaces the given range
+     *
+     * @throws std::out_of_range if `offset` is past the end of the string
+     * @throws std::invalid_argument if the range does not start and end at a
+     *         code point boundary
+     */
+    void replaceBytes(size_type offset, size_type count, const StringView& replaceWith);
+
+    /**
+     * @copydoc StringView::isCodePointBoundary
+     */
+    bool isCodePointBoundary(size_type offset) const;
+
+    /**
+     * @copydoc StringView::toByteOffset
+     */
+    size_type toByteOffset(size_type position) const;
+
+    /**
+     * @copydoc StringView::toCodePointIndex
+     */
+    size_type toCodePointIndex(size_type offset) const;
+
+    ////////////////////////////////////////////////////////////
+    // Case conversion
+    ////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Convert the string to lowercase
+     *
+     * The full Unicode case mapping is applied, so the size of the
+     * result may differ from the original string. Language and context
+     * sensitive rules (e.g. Turkish dotless i or Greek final sigma) are
+     * not applied.
+     *
+     * When called on an rvalue the conversion reuses its buffer and it's
+     * done in place as long as the size of the data does not change.
+     *
+     * @return The lowercase string
+     *
+     * @see toUpper, caseFold
+     */
+    String toLower() const&;
+
+    /**
+     * @copydoc toLower
+     */
+    String toLower() &&;
+
+    /**
+     * @brief Convert the string to uppercase
+     *
+     * The same rules described in @ref toLower apply, e.g. `ß` is
+     * converted to `SS`.
+     *
+     * @return The uppercase string
+     *
+     * @see toLower, caseFold
+     */
+    String toUpper() const&;
+
+    /**
+     * @copydoc toUpper
+     */
+    String toUpper() &&;
+
+    /**
+     * @brief Apply the full Unicode case folding to the string
+     *
+     * Case folding is meant for caseless matching, two strings that only
+     * differ in case produce the same result (e.g. `Straße` and `STRASSE`
+     * are both folded to `strasse`). The same rules described in
+     * @ref toLower apply.
+     *
+     * @return The case folded string
+     *
+     * @see toLower, toUpper
+     */
+    String caseFold() const&;
+
+    /**
+     * @copydoc caseFold
+     */
+    String caseFold() &&;
+
+    ////////////////////////////////////////////////////////////
+    // Normalization
+    ////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Normalize the string to the given Unicode normalization form
+     *
+     * Strings that render the same but differ in their composition, like
+     * `é` (U+00E9) and `e` followed by U+0301, become equal once normalized
+     * to the same form.
+     *
+     * The string is checked first with the normalization quick check, if it's
+     * already normalized it is returned unchanged. When called on an rvalue
+     * no copy is made in that case.
+     *
+     * @param form The normalization form. See @ref unicode::NormalizationForm.
+     *
+     * @return The normalized string
+     *
+     * @see isNormalized
+     */
+    String normalize(unicode::NormalizationForm form = unicode::NormalizationForm::NFC) const&;
+
+    /**
+     * @copydoc normalize
+     */
+    String normalize(unicode::NormalizationForm form = unicode::NormalizationForm::NFC) &&;
+
+    /**
+     * @brief Check if the string is normalized
+     *
+     * @param form The normalization form. See @ref unicode::NormalizationForm.
+     *
+     * @return `true` if the string is normalized, `false` otherwise
+     *
+     * @see normalize
+     */
+    bool isNormalized(unicode::NormalizationForm form = unicode::NormalizationForm::NFC) const;
+
+    /**
+     * @brief Get the collation sort key of the string
+     *
+     * Comparing the keys of two strings gives their order according to
+     * the Unicode Collation Algorithm, which is the expected order for
+     * user-facing sorting, unlike the code point order of operator<=>.
+     *
+     * @code
+     * Vector<String> names = {"zoe", "Émile", "adam"};
+     * names.sortByKey([](const String& name) { return name.getSortKey(); });
+     * @endcode
+     *
+     * @param strength The differences to take into account. See @ref unicode::CollationStrength.
+     *
+     * @return The sort key, a string of bytes that is not valid UTF-8
+     *
+     * @see unicode::GetSortKey
+     */
+    std::string getSortKey(unicode::CollationStrength strength = unicode::CollationStrength::TERTIARY) const;
+
     /**
      * @brief Get a pointer to the C-style array of characters
      *
@@ -855,6 +1280,11 @@ public:
      */
     const_reverse_iterator crend() const;
 
+#ifdef EDOTOOLS_FMT_SUPPORT
+    template <typename... Args>
+    friend String& formatTo(String& output, fmt::format_string<Args...> format, Args&&... args);
+#endif  // EDOTOOLS_FMT_SUPPORT
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -1053,6 +1483,41 @@ EDOTOOLS_API String operator+(char left, const String& right);
  */
 EDOTOOLS_API std::ostream& operator<<(std::ostream& os, const String& str);
 
+namespace internal {
+
+template <size_t N>
+struct StringLiteral {
+    constexpr StringLiteral(const char (&str)[N]) {
+        std::copy_n(str, N, data);
+    }
+
+    constexpr size_t size() const {
+        return N - 1;
+    }
+
+    char data[N];
+};
+
+}  // namespace internal
+
+/**
+ * @relates String
+ * @brief User-defined literal to create a String from an UTF-8 string literal
+ *
+ * The UTF-8 validation is performed at compile time, an invalid literal
+ * is reported as a compilation error and the String is created without
+ * validating the data again.
+ *
+ * @tparam Str The string literal
+ *
+ * @return A String containing the string literal
+ */
+template <internal::StringLiteral Str>
+String operator""_s() {
+    static_assert(utf::IsValid<utf::UTF_8>(Str.data, Str.data + Str.size()), "invalid utf8 string literal");
+    return String::FromUtf8Unchecked(Str.data, Str.data + Str.size());
+}
+
 #ifdef EDOTOOLS_FMT_SUPPORT
 
 template <typename Char>
@@ -1062,7 +1527,12 @@ struct StringFormatProxy {
     template <typename... Args>
     String operator()(Args&&... args) const {
         auto s = fmt::vformat(str, fmt::make_format_args(args...));
-        return String(std::move(s));
+        if constexpr (std::is_same_v<Char, char>) {
+            // The output is built from the UTF-8 format string and the arguments, there is no need to validate it again
+            return String::FromUtf8Unchecked(std::move(s));
+        } else {
+            return String(std::move(s));
+        }
     }
 };
 
@@ -1070,6 +1540,33 @@ EDOTOOLS_API StringFormatProxy<char> operator""_format(const char* str, size_t /
 
 EDOTOOLS_API StringFormatProxy<wchar_t> operator""_format(const wchar_t* str, size_t /*unused*/);
 
+/**
+ * @relates String
+ * @brief Format the arguments and append the result to a String
+ *
+ * The output is written in place to the String buffer, so its
+ * capacity is reused and the data is not validated again.
+ *
+ * @code
+ * String line;
+ * for (const auto& entry : entries) {
+ *     line.clear();
+ *     formatTo(line, "{}: {}", entry.name, entry.value);
+ * }
+ * @endcode
+ *
+ * @param output The String where the formatted data is appended
+ * @param format The format string
+ * @param args   The arguments to format
+ *
+ * @return Reference to `output`
+ */
+template <typename... Args>
+String& formatTo(String& output, fmt::format_string<Args...> format, Args&&... args) {
+    fmt::format_to(std::back_inserter(output.m_string), format, std::forward<Args>(args)...);
+    return output;
+}
+
 }  // namespace edoren
 
 // See https://fmt.dev/latest/api.html#formatting-user-defined-types
@@ -3,6 +3,9 @@
 #include <edoren/UTF.hpp>
 #include <edoren/util/Config.hpp>
 
+#include <compare>
+#include <functional>
+
 #ifdef EDOTOOLS_FMT_SUPPORT
     #include <fmt/format.h>
 #endif
@@ -48,14 +51,29 @@ public:
     constexpr StringView(const char* utf8String);
 
     /**
-     * @brief Construct a string view from a null-terminated (value 0) UTF-8 string
+     * @brief Construct a string view from a UTF-8 string with a given size
+     *
+     * The data is validated, pass utf::AssumeValid to view data that is
+     * already known to be valid UTF-8.
      *
-     * @note No UTF-8 validation is performed
+     * @throws std::runtime_error if the data is not valid UTF-8
      *
      * @param utf8String UTF-8 string to view
+     * @param size       Size in bytes of the UTF-8 string
      */
     constexpr StringView(const char* utf8String, size_type size);
 
+    /**
+     * @brief Construct a string view from a UTF-8 string with a given size
+     *
+     * @note No UTF-8 validation is performed, use it only with data
+     *       that is already known to be valid UTF-8
+     *
+     * @param utf8String UTF-8 string to view
+     * @param size       Size in bytes of the UTF-8 string
+     */
+    constexpr StringView(const char* utf8String, size_type size, utf::AssumeValidTag /*unused*/);
+
     /**
      * @brief Construct a string view from a null-terminated (value 0) UTF-8 string
      *
@@ -213,6 +231,104 @@ public:
      */
     constexpr bool endsWith(const StringView& other) const;
 
+    /**
+     * @brief Check if the string is equal to another one ignoring the case
+     *
+     * Both strings are compared using the full Unicode case folding,
+     * which is computed on the fly without allocating memory.
+     *
+     * @param other String to compare with
+     *
+     * @return `true` if both strings are equal ignoring the case, `false` otherwise
+     *
+     * @see compareIgnoreCase
+     */
+    bool equalsIgnoreCase(const StringView& other) const;
+
+    /**
+     * @brief Compare the string with another one ignoring the case
+     *
+     * The strings are ordered by the code points of their case folded
+     * representation.
+     *
+     * @param other String to compare with
+     *
+     * @return The ordering between both strings
+     *
+     * @see equalsIgnoreCase
+     */
+    std::strong_ordering compareIgnoreCase(const StringView& other) const;
+
+    /**
+     * @brief Find a sequence of one or more characters in
+     *        the string ignoring the case
+     *
+     * @param str   Characters to find
+     * @param start Where to begin searching
+     *
+     * @return Position of `str` in the string, or @ref sInvalidPos
+     *         if not found
+     *
+     * @see find
+     */
+    size_type findIgnoreCase(const StringView& str, size_type start = 0) const;
+
+    /**
+     * @brief Get the number of extended grapheme clusters in the string
+     *
+     * A grapheme cluster is what the user perceives as a single character,
+     * e.g. `e` followed by U+0301 or a flag emoji are a single cluster.
+     *
+     * @return Number of grapheme clusters
+     *
+     * @see getSize, truncateGraphemes, unicode::GraphemeIterator
+     */
+    size_type countGraphemes() const;
+
+    /**
+     * @brief Return the first grapheme clusters of the string
+     *
+     * The string is never cut in the middle of a grapheme cluster.
+     *
+     * @param count Maximum number of grapheme clusters to keep
+     *
+     * @return View to the first `count` grapheme clusters, or the whole
+     *         string if it has less clusters
+     *
+     * @see countGraphemes
+     */
+    StringView truncateGraphemes(size_type count) const;
+
+    /**
+     * @brief Remove the leading and trailing white space
+     *
+     * All the code points with the Unicode White_Space property are
+     * removed, not only the ASCII ones.
+     *
+     * @return View to the string without leading and trailing white space
+     *
+     * @see trimStart, trimEnd, unicode::IsSpace
+     */
+    StringView trim() const;
+
+    /**
+     * @brief Remove the leading white space
+     *
+     * @return View to the string without leading white space
+     *
+     * @see trim
+     */
+    StringView trimStart() const;
+
+    /**
+     * @brief Remove the trailing white space
+     *
+     * @return View to the string without trailing white space
+     *
+     * @see trim
+     */
+    StringView trimEnd() const;
+
     /**
      * @brief Return a part of the string
      *
@@ -229,6 +345,75 @@ public:
      */
     constexpr StringView subString(size_type position, size_type length = sInvalidPos) const;
 
+    ////////////////////////////////////////////////////////////
+    // Byte offset API
+    ////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Find a sequence of one or more characters in
+     *        the string using byte offsets
+     *
+     * Unlike @ref find this function does not need to walk the code points,
+     * since UTF-8 is self-synchronizing a match is always located at a
+     * code point boundary.
+     *
+     * @param str    Characters to find
+     * @param offset Byte offset where to begin searching
+     *
+     * @return Byte offset of `str` in the string, or @ref sInvalidPos
+     *         if not found
+     *
+     * @see toCodePointIndex
+     */
+    constexpr size_type findBytes(const StringView& str, size_type offset = 0) const;
+
+    /**
+     * @brief Return a part of the string using byte offsets
+     *
+     * @param offset Byte offset of the first character
+     * @param count  Number of bytes to include in the SubString. @ref sInvalidPos
+     *               can be used to include all the bytes until the end of the string.
+     *
+     * @return StringView object containing a SubString of this object
+     *
+     * @throws std::out_of_range if `offset` is past the end of the string
+     * @throws std::invalid_argument if the range does not start and end at a
+     *         code point boundary
+     */
+    constexpr StringView subStringBytes(size_type offset, size_type count = sInvalidPos) const;
+
+    /**
+     * @brief Check if a byte offset is located at a code point boundary
+     *
+     * @param offset The byte offset to check
+     *
+     * @return `true` if `offset` points to the beginning of a code point or
+     *         to the end of the string, `false` otherwise
+     */
+    constexpr bool isCodePointBoundary(size_type offset) const;
+
+    /**
+     * @brief Convert a code point index to a byte offset
+     *
+     * @param position Index of the code point
+     *
+     * @return The byte offset of the code point, or @ref sInvalidPos
+     *         if `position` is past the end of the string
+     */
+    constexpr size_type toByteOffset(size_type position) const;
+
+    /**
+     * @brief Convert a byte offset to a code point index
+     *
+     * Only the bytes in the range [`0`, `offset`) are inspected.
+     *
+     * @param offset Byte offset of a code point
+     *
+     * @return The index of the code point, or @ref sInvalidPos
+     *         if `offset` is past the end of the string
+     */
+    constexpr size_type toCodePointIndex(size_type offset) const;
+
     /**
      * @brief Get a pointer to the C-style array of characters
      *
@@ -252,6 +437,29 @@ public:
      */
     constexpr size_type getDataSize() const;
 
+    /**
+     * @brief Get the hash of the string
+     *
+     * The hash is computed using FNV-1a over the UTF-8 bytes, so it can be
+     * evaluated at compile time and used as a `case` label to dispatch
+     * over string keys. Different strings can have the same hash, so each
+     * `case` must still compare the string before using it.
+     *
+     * @code
+     * switch (key.getHash()) {
+     *     case "width"_sv.getHash():
+     *         if (key == "width") { ... }
+     *         break;
+     *     case "height"_sv.getHash():
+     *         if (key == "height") { ... }
+     *         break;
+     * }
+     * @endcode
+     *
+     * @return The hash of the string data
+     */
+    constexpr size_type getHash() const;
+
     /**
      * @brief Return an iterator to the beginning of the string
      *
@@ -385,6 +593,17 @@ bool operator==(const StringView& left, const char* right);
  */
 bool operator==(const char* left, const StringView& right);
 
+/**
+ * @relates String
+ * @brief Overload of == operator to compare two strings
+ *
+ * @param left  Left operand (a StringView)
+ * @param right Right operand (a const char8_t*)
+ *
+ * @return True if both strings are equal
+ */
+bool operator==(const StringView& left, const char8_t* right);
+
 /**
  * @relates String
  * @brief Overload of <=> operator to compare two StringView
@@ -408,8 +627,71 @@ EDOTOOLS_API std::strong_ordering operator<=>(const StringView& left, const Stri
  */
 EDOTOOLS_API std::ostream& operator<<(std::ostream& os, const StringView& str);
 
+/**
+ * @brief Case insensitive hash functor for strings
+ *
+ * Strings that are equal ignoring the case produce the same hash, it can
+ * be used along with @ref IgnoreCaseEqual as the hash and key equal types
+ * of unordered containers.
+ *
+ * @code
+ * std::unordered_map<String, int, IgnoreCaseHash, IgnoreCaseEqual> headers;
+ * @endcode
+ */
+struct EDOTOOLS_API IgnoreCaseHash {
+    using is_transparent = void;  ///< Allow heterogeneous lookup
+
+    /**
+     * @brief Compute the hash of the case folded string
+     *
+     * @param str The string to hash
+     *
+     * @return The hash of the string
+     */
+    size_t operator()(const StringView& str) const;
+};
+
+/**
+ * @brief Case insensitive equality functor for strings
+ *
+ * @see IgnoreCaseHash
+ */
+struct EDOTOOLS_API IgnoreCaseEqual {
+    using is_transparent = void;  ///< Allow heterogeneous lookup
+
+    /**
+     * @brief Check if two strings are equal ignoring the case
+     *
+     * @param left  Left operand
+     * @param right Right operand
+     *
+     * @return `true` if both strings are equal ignoring the case
+     */
+    bool operator()(const StringView& left, const StringView& right) const;
+};
+
+/**
+ * @relates StringView
+ * @brief User-defined literal to create a StringView from an UTF-8 string literal
+ *
+ * The UTF-8 validation and the size computation are performed at compile
+ * time, an invalid literal is reported as a compilation error and the
+ * resulting view has no runtime cost.
+ *
+ * @param str  The string literal
+ * @param size The size in bytes of the string literal
+ *
+ * @return A StringView to the string literal
+ */
+consteval StringView operator""_sv(const char* str, size_t size);
+
 }  // namespace edoren
 
+template <>
+struct std::hash<edoren::StringView> {
+    constexpr size_t operator()(const edoren::StringView& s) const noexcept;
+};
+
 #ifdef EDOTOOLS_FMT_SUPPORT
 // See https://fmt.dev/latest/api.html#formatting-user-defined-types
 
@@ -4,7 +4,9 @@
 #include <compare>
 #include <functional>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 #include <cstring>
@@ -25,7 +27,20 @@ constexpr StringView::StringView(const char* utf8String) {
     }
 }
 
-constexpr StringView::StringView(const char* utf8String, size_type size) : m_data(utf8String), m_size(size) {}
+constexpr StringView::StringView(const char* utf8String, size_type size) {
+    if (utf8String && size > 0) {
+        if (utf::IsValid<utf::UTF_8>(utf8String, utf8String + size)) {
+            m_data = utf8String;
+            m_size = size;
+        } else {
+            EDOTOOLS_THROW(std::runtime_error("invalid utf8 convertion."));
+        }
+    }
+}
+
+constexpr StringView::StringView(const char* utf8String, size_type size, utf::AssumeValidTag /*unused*/)
+      : m_data(utf8String),
+        m_size(size) {}
 
 constexpr StringView& StringView::operator=(const StringView& right) = default;
 
@@ -130,7 +145,52 @@ constexpr StringView StringView::subString(size_type position, size_type length)
     auto endIt = startIt + length;
 
     // Create a new string view with given range
-    return StringView(startIt.getPtr(), endIt.getPtr() - startIt.getPtr());
+    return StringView(startIt.getPtr(), endIt.getPtr() - startIt.getPtr(), utf::AssumeValid);
+}
+
+constexpr StringView::size_type StringView::findBytes(const StringView& str, size_type offset) const {
+    auto pos = std::string_view(m_data, m_size).find(std::string_view(str.m_data, str.m_size), offset);
+    return (pos == std::string_view::npos) ? sInvalidPos : pos;
+}
+
+constexpr StringView StringView::subStringBytes(size_type offset, size_type count) const {
+    if (offset > m_size) {
+        EDOTOOLS_THROW(std::out_of_range("the specified position is out of the string range"));
+    }
+    count = std::min(count, m_size - offset);
+    if (!isCodePointBoundary(offset) || !isCodePointBoundary(offset + count)) {
+        EDOTOOLS_THROW(std::invalid_argument("the specified offset is not at a code point boundary"));
+    }
+    return StringView(m_data + offset, count, utf::AssumeValid);
+}
+
+constexpr bool StringView::isCodePointBoundary(size_type offset) const {
+    if (offset >= m_size) {
+        return offset == m_size;
+    }
+    return (static_cast<unsigned char>(m_data[offset]) & 0xC0) != 0x80;
+}
+
+constexpr StringView::size_type StringView::toByteOffset(size_type position) const {
+    size_type offset = 0;
+    for (size_type i = 0; i < position; ++i) {
+        if (offset >= m_size) {
+            return sInvalidPos;
+        }
+        // The data is already valid, only the lead byte is needed to skip the code point
+        offset += utf::internal::GetUnitSize<utf::UTF_8>(m_data + offset);
+    }
+    return offset;
+}
+
+constexpr StringView::size_type StringView::toCodePointIndex(size_type offset) const {
+    if (offset > m_size) {
+        return sInvalidPos;
+    }
+    // Every byte that is not a continuation byte (10xxxxxx) starts a new code point
+    return std::count_if(m_data, m_data + offset, [](char c) {
+        return (static_cast<unsigned char>(c) & 0xC0) != 0x80;
+    });
 }
 
 constexpr const char* StringView::getData() const {
@@ -141,6 +201,17 @@ constexpr typename StringView::size_type StringView::getDataSize() const {
     return m_size;
 }
 
+constexpr typename StringView::size_type StringView::getHash() const {
+    // FNV-1a, see http://www.isthe.com/chongo/tech/comp/fnv/
+    size_type hash = (sizeof(size_type) == 8) ? size_type(0xcbf29ce484222325ULL) : size_type(0x811c9dc5UL);
+    size_type prime = (sizeof(size_type) == 8) ? size_type(0x100000001b3ULL) : size_type(0x01000193UL);
+    for (size_type i = 0; i < m_size; ++i) {
+        hash ^= static_cast<unsigned char>(m_data[i]);
+        hash *= prime;
+    }
+    return hash;
+}
+
 constexpr StringView::const_iterator StringView::begin() {
     return StringView::iterator(std::make_pair(m_data, m_data + m_size), m_data);
 }
@@ -182,7 +253,8 @@ constexpr StringView::const_reverse_iterator StringView::crend() const {
 }
 
 inline bool operator==(const StringView& left, const StringView& right) {
-    return std::equal(left.getData(), left.getData() + left.getDataSize(), right.getData());
+    return left.getDataSize() == right.getDataSize() &&
+           std::equal(left.getData(), left.getData() + left.getDataSize(), right.getData());
 }
 
 inline std::strong_ordering operator<=>(const StringView& left, const StringView& right) {
@@ -221,12 +293,25 @@ inline bool operator==(const char* left, const StringView& right) {
     return StringView(left) == right;
 }
 
+inline bool operator==(const StringView& left, const char8_t* right) {
+    return left == StringView(right);
+}
+
 inline std::ostream& operator<<(std::ostream& os, const StringView& str) {
     return os.write(str.getData(), str.getSize());
 }
 
+consteval StringView operator""_sv(const char* str, size_t size) {
+    // Throwing here is not a constant expression, so invalid literals fail to compile
+    return StringView(str, size);
+}
+
 }  // namespace edoren
 
+constexpr size_t std::hash<edoren::StringView>::operator()(const edoren::StringView& s) const noexcept {
+    return s.getHash();
+}
+
 #ifdef EDOTOOLS_FMT_SUPPORT
 
 constexpr auto fmt::formatter<edoren::StringView>::parse(fmt::format_parse_context& ctx) -> decltype(ctx.begin()) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <bit>
 #include <compare>
 #include <iterator>
 #include <string>
@@ -16,16 +17,33 @@ namespace utf {
  * @brief Enum to request certain UTF operations
  */
 enum Encoding {
-    UTF_8,   ///< Base for UTF-8 support.
-    UTF_16,  ///< Base for UTF-16 support.
-    UTF_32,  ///< Base for UTF-32 support.
+    UTF_8,         ///< Base for UTF-8 support.
+    UTF_16,        ///< Base for UTF-16 support.
+    UTF_32,        ///< Base for UTF-32 support.
+    LATIN_1,       ///< Base for ISO-8859-1 support, each byte is the code point with the same value.
+    WINDOWS_1252,  ///< Base for Windows-1252 support, like LATIN_1 but with printable characters in 0x80-0x9F.
 };
 
+/**
+ * @brief Tag type to request skipping the UTF validation of data that is already known to be valid
+ */
+struct AssumeValidTag {
+    explicit AssumeValidTag() = default;
+};
+
+/**
+ * @brief Tag to request skipping the UTF validation of data that is already known to be valid
+ *
+ * @warning Passing invalid data along with this tag results in undefined behavior
+ */
+inline constexpr AssumeValidTag AssumeValid{};
+
 /**
  * @brief Returns the size in bytes of each code unit internal data
  *
  * @param encoding The encoding to get the size from
- * @return This must return 1 for UTF-8, 2 for UTF-16 and 4 for UTF-32.
+ * @return This must return 1 for UTF-8, 2 for UTF-16, 4 for UTF-32 and 1 for
+ *         the single byte encodings.
  */
 constexpr size_t GetEncodingSize(Encoding encoding);
 
@@ -39,7 +57,7 @@ class CodeUnit {
 public:
     using size_type = size_t;  ///< The size type
     using value_type =
-        std::conditional_t<(Base == UTF_8),
+        std::conditional_t<(GetEncodingSize(Base) == 1),
                            uint8_t,
                            std::conditional_t<(Base == UTF_16), uint16_t, uint32_t>>;  ///< Type of the internal data
                                                                                        ///< for the code unit
@@ -56,6 +74,9 @@ public:
     /**
      * @brief Creates a new code unit from an Unicode code point
      *
+     * For the single byte encodings the code points that can not be
+     * represented are replaced by `?`.
+     *
      * @param codePoint The Unicode code point to convert
      */
     explicit constexpr CodeUnit(char32_t codePoint);
@@ -704,9 +725,11 @@ private:
 };
 
 /**
- * @brief Convert between UTF-8, UTF-16 and UTF-32
+ * @brief Convert between UTF-8, UTF-16, UTF-32 and the single byte encodings
  *
- * This method will append to the `result` string the requested Base for the conversion
+ * This method will append to the `result` string the requested Base for the conversion.
+ * Converting to a single byte encoding replaces the code points that can not be
+ * represented by `?`.
  *
  * @tparam BaseFrom The encoding to convert from. See @ref Encoding.
  * @tparam BaseTo The encoding to convert to. See @ref Encoding.
@@ -802,6 +825,37 @@ constexpr size_t GetSize(Iter begin, Iter end);
 template <Encoding Base, typename Iter>
 constexpr bool IsValid(Iter begin, Iter end);
 
+/**
+ * @brief Validate an UTF-16 string stored with a specific byte order
+ *
+ * Useful to validate buffers received from external sources that use a byte
+ * order different from the native one, without swapping them first.
+ *
+ * @tparam Iter The type of the iterator has the string
+ * @param begin The iterator to the start of the UTF-16 string
+ * @param end The iterator to the end of the UTF-16 string
+ * @param byteOrder The byte order of each 16 bit unit
+ * @return true If is valid, false otherwise
+ */
+template <typename Iter>
+constexpr bool IsValidUtf16(Iter begin, Iter end, std::endian byteOrder);
+
+/**
+ * @brief Count the surrogate pairs of an UTF-16 string
+ *
+ * The number of code points of the string is the number of 16 bit units
+ * minus the number of surrogate pairs. If the string is invalid only the
+ * pairs found before the first encoding error are counted.
+ *
+ * @tparam Iter The type of the iterator has the string
+ * @param begin The iterator to the start of the UTF-16 string
+ * @param end The iterator to the end of the UTF-16 string
+ * @param byteOrder The byte order of each 16 bit unit
+ * @return The number of surrogate pairs
+ */
+template <typename Iter>
+constexpr size_t CountSurrogatePairs(Iter begin, Iter end, std::endian byteOrder = std::endian::native);
+
 // template <size_t I, typename T>
 // auto& get(edoren::utf::CodeUnit<8, T>& cp) noexcept;
 
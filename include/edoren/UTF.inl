@@ -1,7 +1,12 @@
 #pragma once
 
+#include <bit>
 #include <compare>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <string>
+#include <type_traits>
 
 #include <edoren/util/Config.hpp>
 
@@ -12,6 +17,26 @@ namespace edoren::utf {
 ////////////////////////////////////////////////////////////////////////////////
 namespace internal {
 
+// Code points of the Windows-1252 bytes in the range 0x80-0x9F, the unassigned ones map
+// to the C1 control with the same value like the WHATWG Encoding Standard does
+inline constexpr char16_t sWindows1252HighCodePoints[32] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160,
+    0x2039, 0x0152, 0x008D, 0x017D, 0x008F, 0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022,
+    0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178,
+};
+
+constexpr uint8_t EncodeWindows1252(char32_t codePoint) {
+    if (codePoint < 0x80 || (codePoint >= 0xA0 && codePoint <= 0xFF)) {
+        return static_cast<uint8_t>(codePoint);
+    }
+    for (uint8_t i = 0; i < 32; i++) {
+        if (sWindows1252HighCodePoints[i] == codePoint) {
+            return 0x80 + i;
+        }
+    }
+    return '?';
+}
+
 template <Encoding Base, typename Iter>
 constexpr size_t GetUnitSize(Iter begin) {
     if constexpr (Base == UTF_8) {
@@ -33,7 +58,7 @@ constexpr size_t GetUnitSize(Iter begin) {
             return 2;
         }
         return 1;
-    } else if constexpr (Base == UTF_32) {
+    } else if constexpr (Base == UTF_32 || Base == LATIN_1 || Base == WINDOWS_1252) {
         return 1;
     }
 }
@@ -301,7 +326,9 @@ constexpr Iter Prior16(Iter end, Iter begin) {
     if ((*it >= 0x0000 && *it <= 0xD7FF) || (*it >= 0xE000 && *it <= 0xFFFF)) {
         return it;
     }
-    if (((*it & 0xFC00) == 0xDC00) || ((*(it - 1) & 0xFC00) == 0xD800)) {
+    // A trailing 0b110111xxxxxxxxxx unit needs a leading 0b110110yyyyyyyyyy unit before it,
+    // which must be inside the range
+    if ((*it & 0xFC00) == 0xDC00 && it != begin && (*(it - 1) & 0xFC00) == 0xD800) {
         return it - 1;
     }
 
@@ -321,6 +348,73 @@ constexpr Iter Prior32(Iter end, Iter begin) {
     return end - 1;
 }
 
+// Swap the bytes of each one of the four 16 bit lanes of the word
+constexpr uint64_t SwapUtf16Lanes(uint64_t word) {
+    return ((word >> 8) & 0x00FF00FF00FF00FFULL) | ((word & 0x00FF00FF00FF00FFULL) << 8);
+}
+
+// Check if any of the four 16 bit lanes of the word is in the 0xD800 to 0xDFFF range
+constexpr bool HasSurrogateUtf16Lane(uint64_t word) {
+    // Lanes holding a surrogate become zero, then use the classic "has zero lane" test
+    uint64_t lanes = (word & 0xF800F800F800F800ULL) ^ 0xD800D800D800D800ULL;
+    return ((lanes - 0x0001000100010001ULL) & ~lanes & 0x8000800080008000ULL) != 0;
+}
+
+// Validate an UTF-16 string stored with the provided byte order, returns the position of
+// the first invalid unit (or `end`) and adds the number of surrogate pairs found to
+// `surrogatePairs`. Contiguous ranges skip 4 units at a time while no surrogate is found.
+template <typename Iter>
+constexpr Iter ScanUtf16(Iter begin, Iter end, std::endian byteOrder, size_t& surrogatePairs) {
+    static_assert(std::is_integral<type::iterator_underlying_type_t<Iter>>::value,
+                  "Iterator internal type should be an integer");
+    static_assert(sizeof(type::iterator_underlying_type_t<Iter>) == sizeof(char16_t),
+                  "Iterator internal type has an invalid size");
+
+    const bool swapBytes = byteOrder != std::endian::native;
+    auto load = [swapBytes](Iter it) -> uint16_t {
+        uint16_t unit = static_cast<uint16_t>(*it);
+        return swapBytes ? static_cast<uint16_t>((unit >> 8) | (unit << 8)) : unit;
+    };
+
+    Iter it = begin;
+    while (it < end) {
+        if constexpr (std::contiguous_iterator<Iter>) {
+            if (!std::is_constant_evaluated()) {
+                const auto* data = std::to_address(it);
+                size_t remaining = static_cast<size_t>(end - it);
+                size_t skipped = 0;
+                while (remaining - skipped >= 4) {
+                    uint64_t word;
+                    std::memcpy(&word, data + skipped, sizeof(word));
+                    if (HasSurrogateUtf16Lane(swapBytes ? SwapUtf16Lanes(word) : word)) {
+                        break;
+                    }
+                    skipped += 4;
+                }
+                it += skipped;
+                if (it == end) {
+                    break;
+                }
+            }
+        }
+
+        uint16_t unit = load(it);
+        if ((unit & 0xF800) != 0xD800) {
+            ++it;
+            continue;
+        }
+
+        // Only accept a leading surrogate followed by a trailing one
+        if ((unit & 0xFC00) != 0xD800 || (end - it) < 2 || (load(it + 1) & 0xFC00) != 0xDC00) {
+            return it;
+        }
+        ++surrogatePairs;
+        it += 2;
+    }
+
+    return end;
+}
+
 template <Encoding Base, typename T>
 constexpr std::pair<T, T> GetRangeTemp(const std::pair<T, T>& maxRange, const T& begin) {
     // Post end iterator
@@ -375,6 +469,10 @@ constexpr CodeUnit<Base>::CodeUnit(char32_t codePoint) : m_unit() {
         }
     } else if constexpr (Base == UTF_32) {
         m_unit[0] = codePoint;
+    } else if constexpr (Base == LATIN_1) {
+        m_unit[0] = (codePoint <= 0xFF) ? static_cast<uint8_t>(codePoint) : '?';
+    } else if constexpr (Base == WINDOWS_1252) {
+        m_unit[0] = internal::EncodeWindows1252(codePoint);
     }
 }
 
@@ -796,6 +894,9 @@ constexpr size_t GetEncodingSize(Encoding encoding) {
             return 2;
         case Encoding::UTF_32:
             return 4;
+        case Encoding::LATIN_1:
+        case Encoding::WINDOWS_1252:
+            return 1;
         default:
             return 1;  // Should not be reached
     }
@@ -840,6 +941,11 @@ constexpr char32_t GetCodePoint(Iter begin, Iter end) {
         return internal::GetCodePoint16(begin, end);
     } else if constexpr (Base == UTF_32) {
         return internal::GetCodePoint32(begin, end);
+    } else if constexpr (Base == LATIN_1) {
+        return static_cast<uint8_t>(*begin);
+    } else if constexpr (Base == WINDOWS_1252) {
+        uint8_t byte = static_cast<uint8_t>(*begin);
+        return (byte >= 0x80 && byte <= 0x9F) ? internal::sWindows1252HighCodePoints[byte - 0x80] : byte;
     }
 }
 
@@ -855,6 +961,8 @@ constexpr Iter Next(Iter begin, Iter end) {
         return internal::Next16(begin, end);
     } else if constexpr (Base == UTF_32) {
         return internal::Next32(begin, end);
+    } else if constexpr (Base == LATIN_1 || Base == WINDOWS_1252) {
+        return begin + 1;  // All the byte values are valid
     }
 }
 
@@ -870,6 +978,8 @@ constexpr Iter Prior(Iter end, Iter begin) {
         return internal::Prior16(end, begin);
     } else if constexpr (Base == UTF_32) {
         return internal::Prior32(end, begin);
+    } else if constexpr (Base == LATIN_1 || Base == WINDOWS_1252) {
+        return end - 1;
     }
 }
 
@@ -892,6 +1002,14 @@ constexpr Iter ForEach(Iter begin, Iter end, Func fn) {
 
 template <Encoding Base, typename Iter>
 constexpr size_t GetSize(Iter begin, Iter end) {
+    if constexpr (Base == UTF_16) {
+        size_t surrogatePairs = 0;
+        if (internal::ScanUtf16(begin, end, std::endian::native, surrogatePairs) != end) {
+            return size_t(-1);
+        }
+        return static_cast<size_t>(end - begin) - surrogatePairs;
+    }
+
     size_t size = 0;
     auto it = ForEach<Base>(begin, end, [&size](auto /*unused*/) { size++; });
     if (it != end) {
@@ -902,9 +1020,25 @@ constexpr size_t GetSize(Iter begin, Iter end) {
 
 template <Encoding Base, typename Iter>
 constexpr bool IsValid(Iter begin, Iter end) {
+    if constexpr (Base == UTF_16) {
+        return IsValidUtf16(begin, end, std::endian::native);
+    }
     return ForEach<Base>(begin, end, [](auto /*unused*/) {}) == end;
 }
 
+template <typename Iter>
+constexpr bool IsValidUtf16(Iter begin, Iter end, std::endian byteOrder) {
+    size_t surrogatePairs = 0;
+    return internal::ScanUtf16(begin, end, byteOrder, surrogatePairs) == end;
+}
+
+template <typename Iter>
+constexpr size_t CountSurrogatePairs(Iter begin, Iter end, std::endian byteOrder) {
+    size_t surrogatePairs = 0;
+    internal::ScanUtf16(begin, end, byteOrder, surrogatePairs);
+    return surrogatePairs;
+}
+
 }  // namespace edoren::utf
 
 // namespace std {
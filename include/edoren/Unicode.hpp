@@ -0,0 +1,487 @@
+#pragma once
+
+#include <edoren/StringView.hpp>
+#include <edoren/util/Config.hpp>
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+#include <string>
+
+namespace edoren {
+
+namespace unicode {
+
+/**
+ * @brief Enum to specify a case conversion
+ */
+enum class CaseMapping {
+    LOWER,  ///< Convert to lowercase
+    UPPER,  ///< Convert to uppercase
+    FOLD,   ///< Apply case folding, used for caseless matching
+};
+
+/**
+ * @brief Maximum number of code points a full case mapping can produce
+ */
+inline constexpr size_t sMaxCaseMappingSize = 3;
+
+/**
+ * @brief Get the simple lowercase mapping of a code point
+ *
+ * @param codePoint The Unicode code point
+ * @return The lowercase code point, or `codePoint` if it has no mapping
+ */
+EDOTOOLS_API char32_t ToLower(char32_t codePoint);
+
+/**
+ * @brief Get the simple uppercase mapping of a code point
+ *
+ * @param codePoint The Unicode code point
+ * @return The uppercase code point, or `codePoint` if it has no mapping
+ */
+EDOTOOLS_API char32_t ToUpper(char32_t codePoint);
+
+/**
+ * @brief Get the simple case folding of a code point
+ *
+ * @param codePoint The Unicode code point
+ * @return The case folded code point, or `codePoint` if it has no mapping
+ */
+EDOTOOLS_API char32_t FoldCase(char32_t codePoint);
+
+/**
+ * @brief Get the full case mapping of a code point
+ *
+ * Unlike the simple mappings a full mapping can expand to more than one
+ * code point, e.g. the uppercase of `ß` is `SS`. Only the unconditional
+ * mappings are applied, language and context sensitive rules are ignored.
+ *
+ * @param codePoint The Unicode code point
+ * @param mapping   The mapping to apply. See @ref CaseMapping.
+ * @param output    Array where the resulting code points are stored
+ * @return The number of code points written to `output`
+ */
+EDOTOOLS_API size_t MapCase(char32_t codePoint, CaseMapping mapping, char32_t (&output)[sMaxCaseMappingSize]);
+
+/**
+ * @brief Enum to specify a Unicode normalization form
+ */
+enum class NormalizationForm {
+    NFC,   ///< Canonical decomposition followed by canonical composition
+    NFD,   ///< Canonical decomposition
+    NFKC,  ///< Compatibility decomposition followed by canonical composition
+    NFKD,  ///< Compatibility decomposition
+};
+
+/**
+ * @brief Result of the normalization quick check
+ */
+enum class QuickCheckResult {
+    YES,    ///< The string is normalized
+    NO,     ///< The string is not normalized
+    MAYBE,  ///< The string needs to be normalized to know if it's normalized
+};
+
+/**
+ * @brief Get the canonical combining class of a code point
+ *
+ * @param codePoint The Unicode code point
+ * @return The canonical combining class, 0 for starters
+ */
+EDOTOOLS_API uint8_t GetCombiningClass(char32_t codePoint);
+
+/**
+ * @brief Check if a string is normalized using the quick check property
+ *
+ * This function does a single pass over the string and never allocates
+ * memory. Runs of ASCII characters, which are always normalized, are
+ * skipped 8 bytes at a time.
+ *
+ * @param str  The UTF-8 string to check
+ * @param form The normalization form. See @ref NormalizationForm.
+ * @return The result of the check. See @ref QuickCheckResult.
+ */
+EDOTOOLS_API QuickCheckResult QuickCheck(const StringView& str, NormalizationForm form);
+
+/**
+ * @brief Check if a string is normalized
+ *
+ * The @ref QuickCheck is used first, the string is only normalized
+ * when it can not give a definitive answer.
+ *
+ * @param str  The UTF-8 string to check
+ * @param form The normalization form. See @ref NormalizationForm.
+ * @return `true` if the string is normalized, `false` otherwise
+ */
+EDOTOOLS_API bool IsNormalized(const StringView& str, NormalizationForm form);
+
+/**
+ * @brief Normalize an UTF-8 string
+ *
+ * @param str    The UTF-8 string to normalize
+ * @param form   The normalization form. See @ref NormalizationForm.
+ * @param output The string where the normalized UTF-8 data is stored, its
+ *               content is replaced but its capacity is kept
+ */
+EDOTOOLS_API void Normalize(const StringView& str, NormalizationForm form, std::string& output);
+
+/**
+ * @brief Find the end of the extended grapheme cluster that starts at `begin`
+ *
+ * The boundaries are computed following the rules of the Unicode
+ * Standard Annex #29, the cost is linear on the size of the cluster.
+ *
+ * @param begin The beginning of the cluster, it must point to a valid UTF-8 sequence
+ * @param end   The end of the UTF-8 string
+ * @return Pointer to the beginning of the next cluster, or `end` if there is no more clusters
+ */
+EDOTOOLS_API const char* FindGraphemeBoundary(const char* begin, const char* end);
+
+/**
+ * @brief Iterator over the extended grapheme clusters of an UTF-8 string
+ *
+ * Each element is a StringView with all the code points of a cluster,
+ * that is what the user perceives as a single character. Iterating
+ * does not allocate memory.
+ *
+ * @code
+ * for (StringView cluster : unicode::Graphemes(u8"e\u0301\U0001F1EA\U0001F1F8")) {
+ *     // "é", "🇪🇸"
+ * }
+ * @endcode
+ *
+ * @see Graphemes
+ */
+class GraphemeIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;  ///< Iterator category
+    using value_type = StringView;                        ///< Type of the elements
+    using difference_type = std::ptrdiff_t;               ///< Difference type
+    using pointer = const StringView*;                    ///< Pointer type
+    using reference = StringView;                         ///< Reference type
+
+    /**
+     * @brief Default constructor
+     *
+     * Creates an iterator over an empty string.
+     */
+    GraphemeIterator() = default;
+
+    /**
+     * @brief Create an iterator pointing to the first cluster of a string
+     *
+     * @param str The UTF-8 string to iterate
+     */
+    explicit GraphemeIterator(const StringView& str)
+          : m_current(str.getData()),
+            m_next(str.getData()),
+            m_end(str.getData() + str.getDataSize()) {
+        m_next = FindGraphemeBoundary(m_current, m_end);
+    }
+
+    /**
+     * @brief Get the current grapheme cluster
+     *
+     * @return A view to the code points of the cluster
+     */
+    StringView operator*() const {
+        return StringView(m_current, m_next - m_current, utf::AssumeValid);
+    }
+
+    /**
+     * @brief Advance to the next grapheme cluster
+     *
+     * @return Reference to self
+     */
+    GraphemeIterator& operator++() {
+        m_current = m_next;
+        m_next = FindGraphemeBoundary(m_current, m_end);
+        return *this;
+    }
+
+    /**
+     * @brief Advance to the next grapheme cluster
+     *
+     * @return Copy of the iterator before advancing
+     */
+    GraphemeIterator operator++(int) {
+        GraphemeIterator copy(*this);
+        ++(*this);
+        return copy;
+    }
+
+    /**
+     * @brief Get a pointer to the beginning of the current cluster
+     *
+     * @return Pointer to the UTF-8 data
+     */
+    const char* getPtr() const {
+        return m_current;
+    }
+
+    /**
+     * @brief Check equality
+     *
+     * @param right Another iterator to compare with
+     * @return `true` if both point to the same cluster
+     */
+    bool operator==(const GraphemeIterator& right) const {
+        return m_current == right.m_current;
+    }
+
+    /**
+     * @brief Check if the iterator reached the end of the string
+     *
+     * @return `true` if there is no more clusters
+     */
+    bool operator==(std::default_sentinel_t /*unused*/) const {
+        return m_current == m_end;
+    }
+
+private:
+    const char* m_current = nullptr;  ///< Beginning of the current cluster
+    const char* m_next = nullptr;     ///< Beginning of the next cluster
+    const char* m_end = nullptr;      ///< End of the string
+};
+
+/**
+ * @brief Get a range with the extended grapheme clusters of a string
+ *
+ * @param str The UTF-8 string
+ * @return A range of StringView, one for each grapheme cluster. See @ref GraphemeIterator.
+ */
+inline std::ranges::subrange<GraphemeIterator, std::default_sentinel_t> Graphemes(const StringView& str) {
+    return {GraphemeIterator(str), std::default_sentinel};
+}
+
+/**
+ * @brief Enum to specify which differences are taken into account by the collation
+ */
+enum class CollationStrength {
+    PRIMARY,    ///< Only the base letters, e.g. "a" == "A" == "á"
+    SECONDARY,  ///< Base letters and accents, e.g. "a" == "A" != "á"
+    TERTIARY,   ///< Base letters, accents, case and variants, e.g. "a" != "A" != "á"
+};
+
+/**
+ * @brief Generate the collation sort key of a string
+ *
+ * The key follows the Unicode Collation Algorithm with the root
+ * collation order (DUCET) and non-ignorable variable weighting, so it's
+ * locale independent. Comparing two keys byte by byte, e.g. with
+ * `std::memcmp` or the `std::string` operators, gives the same result as
+ * collating the strings, so sorting many strings only needs to generate
+ * each key once.
+ *
+ * @code
+ * std::string apple, banana;
+ * unicode::GetSortKey("apple", apple);
+ * unicode::GetSortKey("Banana", banana);
+ * assert(apple < banana);  // Code point order would place "Banana" first
+ * @endcode
+ *
+ * @param str      The UTF-8 string
+ * @param output   The string where the key is stored, its content is replaced but its capacity is kept
+ * @param strength The differences to take into account. See @ref CollationStrength.
+ */
+EDOTOOLS_API void GetSortKey(const StringView& str, std::string& output,
+                             CollationStrength strength = CollationStrength::TERTIARY);
+
+/**
+ * @brief Compare two strings using the Unicode Collation Algorithm
+ *
+ * This function generates the sort key of both strings on each call, use
+ * @ref GetSortKey to compare the same string multiple times.
+ *
+ * @param left     The first UTF-8 string
+ * @param right    The second UTF-8 string
+ * @param strength The differences to take into account. See @ref CollationStrength.
+ * @return The collation order between both strings
+ */
+EDOTOOLS_API std::strong_ordering Collate(const StringView& left, const StringView& right,
+                                          CollationStrength strength = CollationStrength::TERTIARY);
+
+/**
+ * @brief General category of a code point
+ */
+enum class GeneralCategory : uint8_t {
+    UPPERCASE_LETTER,       ///< Lu
+    LOWERCASE_LETTER,       ///< Ll
+    TITLECASE_LETTER,       ///< Lt
+    MODIFIER_LETTER,        ///< Lm
+    OTHER_LETTER,           ///< Lo
+    NONSPACING_MARK,        ///< Mn
+    SPACING_MARK,           ///< Mc
+    ENCLOSING_MARK,         ///< Me
+    DECIMAL_NUMBER,         ///< Nd
+    LETTER_NUMBER,          ///< Nl
+    OTHER_NUMBER,           ///< No
+    CONNECTOR_PUNCTUATION,  ///< Pc
+    DASH_PUNCTUATION,       ///< Pd
+    OPEN_PUNCTUATION,       ///< Ps
+    CLOSE_PUNCTUATION,      ///< Pe
+    INITIAL_PUNCTUATION,    ///< Pi
+    FINAL_PUNCTUATION,      ///< Pf
+    OTHER_PUNCTUATION,      ///< Po
+    MATH_SYMBOL,            ///< Sm
+    CURRENCY_SYMBOL,        ///< Sc
+    MODIFIER_SYMBOL,        ///< Sk
+    OTHER_SYMBOL,           ///< So
+    SPACE_SEPARATOR,        ///< Zs
+    LINE_SEPARATOR,         ///< Zl
+    PARAGRAPH_SEPARATOR,    ///< Zp
+    CONTROL,                ///< Cc
+    FORMAT,                 ///< Cf
+    SURROGATE,              ///< Cs
+    PRIVATE_USE,            ///< Co
+    UNASSIGNED,             ///< Cn
+};
+
+/**
+ * @brief East Asian Width property of a code point
+ */
+enum class EastAsianWidth : uint8_t {
+    NEUTRAL,    ///< Not used in East Asian typography
+    AMBIGUOUS,  ///< Wide or narrow depending on the context
+    HALFWIDTH,  ///< Narrow compatibility variant of a wide character
+    WIDE,       ///< Always wide
+    FULLWIDTH,  ///< Wide compatibility variant of a narrow character
+    NARROW,     ///< Always narrow
+};
+
+/**
+ * @brief Classes of characters used by the bulk classification functions
+ */
+enum class CharacterClass {
+    SPACE,         ///< Code points with the White_Space property. See @ref IsSpace.
+    ALPHA,         ///< Code points with the Alphabetic property. See @ref IsAlpha.
+    DIGIT,         ///< Decimal digits. See @ref IsDigit.
+    ALPHANUMERIC,  ///< Alphabetic code points and decimal digits. See @ref IsAlphanumeric.
+    PUNCTUATION,   ///< Punctuation code points. See @ref IsPunctuation.
+};
+
+/**
+ * @brief Get the general category of a code point
+ *
+ * The lookup uses a three-stage table of about 22 KiB generated from the
+ * Unicode Character Database, so it can be evaluated at compile time.
+ *
+ * @param codePoint The Unicode code point
+ * @return The general category, @ref GeneralCategory::UNASSIGNED for invalid code points
+ */
+constexpr GeneralCategory GetGeneralCategory(char32_t codePoint);
+
+/**
+ * @brief Get the East Asian Width property of a code point
+ *
+ * @param codePoint The Unicode code point
+ * @return The East Asian Width. See @ref EastAsianWidth.
+ */
+constexpr EastAsianWidth GetEastAsianWidth(char32_t codePoint);
+
+/**
+ * @brief Check if a code point is a white space
+ *
+ * @param codePoint The Unicode code point
+ * @return `true` if the code point has the White_Space property
+ */
+constexpr bool IsSpace(char32_t codePoint);
+
+/**
+ * @brief Check if a code point is alphabetic
+ *
+ * @param codePoint The Unicode code point
+ * @return `true` if the code point has the Alphabetic property
+ */
+constexpr bool IsAlpha(char32_t codePoint);
+
+/**
+ * @brief Check if a code point is a decimal digit
+ *
+ * @param codePoint The Unicode code point
+ * @return `true` if the general category of the code point is Nd
+ */
+constexpr bool IsDigit(char32_t codePoint);
+
+/**
+ * @brief Check if a code point is alphabetic or a decimal digit
+ *
+ * @param codePoint The Unicode code point
+ * @return `true` if @ref IsAlpha or @ref IsDigit are true
+ */
+constexpr bool IsAlphanumeric(char32_t codePoint);
+
+/**
+ * @brief Check if a code point is a punctuation character
+ *
+ * @param codePoint The Unicode code point
+ * @return `true` if the general category of the code point is one of Pc, Pd, Ps, Pe, Pi, Pf or Po
+ */
+constexpr bool IsPunctuation(char32_t codePoint);
+
+/**
+ * @brief Check if a code point belongs to a class of characters
+ *
+ * @param codePoint The Unicode code point
+ * @param cls       The class of characters. See @ref CharacterClass.
+ * @return `true` if the code point belongs to the class
+ */
+constexpr bool IsInClass(char32_t codePoint, CharacterClass cls);
+
+/**
+ * @brief Find the first code point of a string that belongs to a class
+ *
+ * Runs of ASCII characters are classified 8 bytes at a time.
+ *
+ * @param str    The UTF-8 string to search
+ * @param cls    The class of characters. See @ref CharacterClass.
+ * @param offset The byte offset where the search starts, it must be on a code point boundary
+ * @return The byte offset of the code point, or StringView::sInvalidPos if there is none
+ */
+EDOTOOLS_API size_t FindFirstOfClass(const StringView& str, CharacterClass cls, size_t offset = 0);
+
+/**
+ * @brief Find the first code point of a string that does not belong to a class
+ *
+ * Runs of ASCII characters are classified 8 bytes at a time.
+ *
+ * @param str    The UTF-8 string to search
+ * @param cls    The class of characters. See @ref CharacterClass.
+ * @param offset The byte offset where the search starts, it must be on a code point boundary
+ * @return The byte offset of the code point, or StringView::sInvalidPos if there is none
+ */
+EDOTOOLS_API size_t FindFirstNotOfClass(const StringView& str, CharacterClass cls, size_t offset = 0);
+
+/**
+ * @brief Check if all the code points of a string belong to a class
+ *
+ * @param str The UTF-8 string to check
+ * @param cls The class of characters. See @ref CharacterClass.
+ * @return `true` if all the code points belong to the class, or the string is empty
+ */
+EDOTOOLS_API bool IsAllOfClass(const StringView& str, CharacterClass cls);
+
+namespace internal {
+
+struct PropertyRecord {
+    GeneralCategory category;
+    EastAsianWidth eastAsianWidth;
+    uint8_t flags;
+};
+
+inline constexpr uint8_t sWhiteSpaceFlag = 0x01;
+inline constexpr uint8_t sAlphabeticFlag = 0x02;
+
+// Same as unicode::Normalize but without the QuickCheck, for the callers that already did it
+EDOTOOLS_API void NormalizeUnchecked(const StringView& str, NormalizationForm form, std::string& output);
+
+}  // namespace internal
+
+}  // namespace unicode
+
+}  // namespace edoren
+
+#include "Unicode.inl"
@@ -0,0 +1,82 @@
+#include "unicode/PropertyTables.inl"
+
+namespace edoren {
+
+namespace unicode {
+
+namespace internal {
+
+constexpr const PropertyRecord& GetPropertyRecord(char32_t codePoint) {
+    constexpr uint32_t stage2Bits = sPropertyStage1Shift - sPropertyStage2Shift;
+    if (codePoint > 0x10FFFF) {
+        codePoint = 0x10FFFF;  // Noncharacter, it has the same properties as an unassigned code point
+    }
+    uint32_t block = sPropertyStage1[codePoint >> sPropertyStage1Shift];
+    block = sPropertyStage2[(block << stage2Bits) + ((codePoint >> sPropertyStage2Shift) & ((1U << stage2Bits) - 1))];
+    return sPropertyRecords[sPropertyStage3[(block << sPropertyStage2Shift) +
+                                            (codePoint & ((1U << sPropertyStage2Shift) - 1))]];
+}
+
+}  // namespace internal
+
+constexpr GeneralCategory GetGeneralCategory(char32_t codePoint) {
+    return internal::GetPropertyRecord(codePoint).category;
+}
+
+constexpr EastAsianWidth GetEastAsianWidth(char32_t codePoint) {
+    return internal::GetPropertyRecord(codePoint).eastAsianWidth;
+}
+
+constexpr bool IsSpace(char32_t codePoint) {
+    if (codePoint < 0x80) {
+        return codePoint == U' ' || (codePoint >= U'\t' && codePoint <= U'\r');
+    }
+    return (internal::GetPropertyRecord(codePoint).flags & internal::sWhiteSpaceFlag) != 0;
+}
+
+constexpr bool IsAlpha(char32_t codePoint) {
+    if (codePoint < 0x80) {
+        return (codePoint | 0x20) >= U'a' && (codePoint | 0x20) <= U'z';
+    }
+    return (internal::GetPropertyRecord(codePoint).flags & internal::sAlphabeticFlag) != 0;
+}
+
+constexpr bool IsDigit(char32_t codePoint) {
+    if (codePoint < 0x80) {
+        return codePoint >= U'0' && codePoint <= U'9';
+    }
+    return GetGeneralCategory(codePoint) == GeneralCategory::DECIMAL_NUMBER;
+}
+
+constexpr bool IsAlphanumeric(char32_t codePoint) {
+    if (codePoint < 0x80) {
+        return IsAlpha(codePoint) || IsDigit(codePoint);
+    }
+    const internal::PropertyRecord& record = internal::GetPropertyRecord(codePoint);
+    return (record.flags & internal::sAlphabeticFlag) != 0 || record.category == GeneralCategory::DECIMAL_NUMBER;
+}
+
+constexpr bool IsPunctuation(char32_t codePoint) {
+    GeneralCategory category = GetGeneralCategory(codePoint);
+    return category >= GeneralCategory::CONNECTOR_PUNCTUATION && category <= GeneralCategory::OTHER_PUNCTUATION;
+}
+
+constexpr bool IsInClass(char32_t codePoint, CharacterClass cls) {
+    switch (cls) {
+        case CharacterClass::SPACE:
+            return IsSpace(codePoint);
+        case CharacterClass::ALPHA:
+            return IsAlpha(codePoint);
+        case CharacterClass::DIGIT:
+            return IsDigit(codePoint);
+        case CharacterClass::ALPHANUMERIC:
+            return IsAlphanumeric(codePoint);
+        case CharacterClass::PUNCTUATION:
+            return IsPunctuation(codePoint);
+    }
+    return false;
+}
+
+}  // namespace unicode
+
+}  // namespace edoren
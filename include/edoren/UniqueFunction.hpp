@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstddef>
+
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+#include <edoren/Function.hpp>
+#include <edoren/util/Config.hpp>
+#include <edoren/util/MemoryResource.hpp>
+#include <edoren/util/Platform.hpp>
+
+namespace edoren {
+
+/**
+ * @brief Class to hold a move-only function reference
+ *
+ * @tparam Func The function type
+ * @tparam MaxSize The size of the internal buffer used to store the function
+ *
+ * @see UniqueFunction<Ret(Args...), MaxSize> for concrete implementation
+ */
+template <typename Func, size_t MaxSize = LAMBDA_FUNCTION_SIZE(LAMBDA_DEFAULT_SIZE)>
+class UniqueFunction;
+
+/**
+ * @brief Class to hold a move-only function reference
+ *
+ * Unlike Function this class accepts callables that can only be moved, like
+ * lambdas capturing a std::promise or a std::unique_ptr. Callables that fit in
+ * the `MaxSize` internal buffer are stored inline, the bigger ones are stored in
+ * memory obtained from a shared pool (see internal::GetPooledResource).
+ *
+ * @code
+ * std::promise<int> promise;
+ * UniqueFunction<void()> fn([promise = std::move(promise)]() mutable { promise.set_value(1); });
+ * @endcode
+ *
+ * @tparam Ret The return type of the function
+ * @tparam Args The parameters that the function receives
+ * @tparam MaxSize The size of the internal buffer used to store the function
+ */
+template <typename Ret, typename... Args, size_t MaxSize>
+class UniqueFunction<Ret(Args...), MaxSize> {
+    static_assert(MaxSize >= sizeof(void*), "MaxSize must be able to hold at least a pointer");
+
+public:
+    /**
+     * @brief Default constructor
+     */
+    UniqueFunction() noexcept;
+
+    /**
+     * @brief Null constructor, this yields an empty function
+     */
+    UniqueFunction(std::nullptr_t) noexcept;
+
+    /**
+     * @brief Copy constructor (deleted)
+     */
+    UniqueFunction(const UniqueFunction& other) = delete;
+
+    /**
+     * @brief Move constructor
+     */
+    UniqueFunction(UniqueFunction&& other) noexcept;
+
+    /**
+     * @brief Construct a new UniqueFunction object
+     *
+     * @note This constructor should be called only when T is a lambda or a function
+     *
+     * @param fun The lambda function or function to assign to
+     */
+    template <typename T,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, UniqueFunction<Ret(Args...), MaxSize>>>>
+    UniqueFunction(T&& fun);
+
+    /**
+     * @brief Destructor
+     */
+    ~UniqueFunction();
+
+    /**
+     * @brief Copy operator (deleted)
+     */
+    UniqueFunction& operator=(const UniqueFunction& other) = delete;
+
+    /**
+     * @brief Move operator
+     */
+    UniqueFunction& operator=(UniqueFunction&& other) noexcept;
+
+    /**
+     * @brief Null assignment operator
+     */
+    UniqueFunction& operator=(std::nullptr_t) noexcept;
+
+    /**
+     * @brief Redirect assigment operator based on available constructors
+     */
+    template <typename T,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, UniqueFunction<Ret(Args...), MaxSize>>>>
+    UniqueFunction& operator=(T&& other);
+
+    /**
+     * @brief Swap two functions with the same return and arguments
+     *
+     * @param other The other function to swap with this
+     */
+    void swap(UniqueFunction& other) noexcept;
+
+    /**
+     * @brief Checks instance does not point to any function
+     */
+    explicit operator bool() const noexcept;
+
+    /**
+     * @brief Function-call operator
+     *
+     * @param args Arguments to call the internal function
+     */
+    Ret operator()(Args... args);
+
+private:
+    enum class Operation {
+        MOVE,
+        DESTROY,
+    };
+
+#if PLATFORM_IS(PLATFORM_ANDROID | PLATFORM_IOS)
+    static constexpr size_t sStorageAlignment = 16;
+#else
+    static constexpr size_t sStorageAlignment = alignof(std::max_align_t);
+#endif
+
+    // Only callables that can be relocated without throwing are stored inline, so moving
+    // an UniqueFunction never throws
+    template <typename FunctionType>
+    static constexpr bool sIsStoredInline = sizeof(FunctionType) <= MaxSize &&
+                                            alignof(FunctionType) <= sStorageAlignment &&
+                                            std::is_nothrow_move_constructible_v<FunctionType>;
+
+    template <typename FunctionType>
+    static FunctionType* GetCallable(void* data) noexcept;
+
+    template <typename FunctionType>
+    static Ret CallFunction(void* data, Args&&... args);
+
+    template <typename FunctionType>
+    static void ManageFunction(void* dest, void* src, Operation op) noexcept;
+
+    void moveFrom(UniqueFunction& other) noexcept;
+
+    using Invoker = Ret (*)(void*, Args&&...);
+    using Manager = void (*)(void*, void*, Operation) noexcept;
+
+    alignas(sStorageAlignment) std::byte m_data[MaxSize];  ///< Stores the Functor or a pointer to it
+    Invoker m_invoker;                                      ///< Pointer to the caller function for m_data
+    Manager m_manager;                                      ///< Pointer to the function that manages the m_data
+};
+
+}  // namespace edoren
+
+#include "UniqueFunction.inl"
@@ -0,0 +1,161 @@
+#include <cstdlib>
+
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace edoren {
+
+template <typename Ret, typename... Args, size_t MaxSize>
+UniqueFunction<Ret(Args...), MaxSize>::UniqueFunction() noexcept : m_data(),
+                                                                   m_invoker(nullptr),
+                                                                   m_manager(nullptr) {}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+UniqueFunction<Ret(Args...), MaxSize>::UniqueFunction(std::nullptr_t) noexcept : m_data(),
+                                                                                 m_invoker(nullptr),
+                                                                                 m_manager(nullptr) {}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+UniqueFunction<Ret(Args...), MaxSize>::UniqueFunction(UniqueFunction&& other) noexcept : m_data(),
+                                                                                         m_invoker(nullptr),
+                                                                                         m_manager(nullptr) {
+    moveFrom(other);
+}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+template <typename T, typename>
+UniqueFunction<Ret(Args...), MaxSize>::UniqueFunction(T&& fun) : m_data(),
+                                                                 m_invoker(nullptr),
+                                                                 m_manager(nullptr) {
+    using lambda_type = std::decay_t<T>;
+    if constexpr (sIsStoredInline<lambda_type>) {
+        new (&m_data) lambda_type(std::forward<T>(fun));
+    } else {
+        std::pmr::memory_resource* resource = internal::GetPooledResource();
+        auto deallocate = [resource](void* memory) {
+            resource->deallocate(memory, sizeof(lambda_type), alignof(lambda_type));
+        };
+        // Release the memory if the constructor of the callable throws
+        std::unique_ptr<void, decltype(deallocate)> memory(
+            resource->allocate(sizeof(lambda_type), alignof(lambda_type)), deallocate);
+        new (memory.get()) lambda_type(std::forward<T>(fun));
+        new (&m_data) lambda_type*(static_cast<lambda_type*>(memory.release()));
+    }
+    m_invoker = &CallFunction<lambda_type>;
+    m_manager = &ManageFunction<lambda_type>;
+}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+UniqueFunction<Ret(Args...), MaxSize>::~UniqueFunction() {
+    if (m_manager != nullptr) {
+        m_manager(&m_data, nullptr, Operation::DESTROY);
+    }
+}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+UniqueFunction<Ret(Args...), MaxSize>& UniqueFunction<Ret(Args...), MaxSize>::operator=(
+    UniqueFunction&& other) noexcept {
+    if (this != &other) {
+        *this = nullptr;
+        moveFrom(other);
+    }
+    return *this;
+}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+UniqueFunction<Ret(Args...), MaxSize>& UniqueFunction<Ret(Args...), MaxSize>::operator=(std::nullptr_t) noexcept {
+    if (m_manager != nullptr) {
+        m_manager(&m_data, nullptr, Operation::DESTROY);
+        m_manager = nullptr;
+        m_invoker = nullptr;
+    }
+    return *this;
+}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+template <typename T, typename>
+UniqueFunction<Ret(Args...), MaxSize>& UniqueFunction<Ret(Args...), MaxSize>::operator=(T&& other) {
+    UniqueFunction(std::forward<T>(other)).swap(*this);
+    return *this;
+}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+void UniqueFunction<Ret(Args...), MaxSize>::swap(UniqueFunction& other) noexcept {
+    if (this == &other) {
+        return;
+    }
+    UniqueFunction temp(std::move(other));
+    other.moveFrom(*this);
+    moveFrom(temp);
+}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+UniqueFunction<Ret(Args...), MaxSize>::operator bool() const noexcept {
+    return m_manager != nullptr;
+}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+Ret UniqueFunction<Ret(Args...), MaxSize>::operator()(Args... args) {
+    if (m_invoker == nullptr) {
+        abort();
+    }
+    return m_invoker(&m_data, std::forward<Args>(args)...);
+}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+template <typename FunctionType>
+FunctionType* UniqueFunction<Ret(Args...), MaxSize>::GetCallable(void* data) noexcept {
+    if constexpr (sIsStoredInline<FunctionType>) {
+        return std::launder(static_cast<FunctionType*>(data));
+    } else {
+        return *std::launder(static_cast<FunctionType**>(data));
+    }
+}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+template <typename FunctionType>
+Ret UniqueFunction<Ret(Args...), MaxSize>::CallFunction(void* data, Args&&... args) {
+    return (*GetCallable<FunctionType>(data))(std::forward<Args>(args)...);
+}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+template <typename FunctionType>
+void UniqueFunction<Ret(Args...), MaxSize>::ManageFunction(void* dest, void* src, Operation op) noexcept {
+    switch (op) {
+        case Operation::MOVE: {
+            // Heap stored callables only need to transfer the pointer
+            FunctionType* srcCallable = GetCallable<FunctionType>(src);
+            if constexpr (sIsStoredInline<FunctionType>) {
+                new (dest) FunctionType(std::move(*srcCallable));
+                srcCallable->~FunctionType();
+            } else {
+                new (dest) FunctionType*(srcCallable);
+            }
+            break;
+        }
+        case Operation::DESTROY: {
+            FunctionType* callable = GetCallable<FunctionType>(dest);
+            callable->~FunctionType();
+            if constexpr (!sIsStoredInline<FunctionType>) {
+                internal::GetPooledResource()->deallocate(callable, sizeof(FunctionType),
+                                                                  alignof(FunctionType));
+            }
+            break;
+        }
+    }
+}
+
+template <typename Ret, typename... Args, size_t MaxSize>
+void UniqueFunction<Ret(Args...), MaxSize>::moveFrom(UniqueFunction& other) noexcept {
+    // Expects this instance to be empty, leaves the other one empty
+    if (other.m_manager != nullptr) {
+        other.m_manager(&m_data, &other.m_data, Operation::MOVE);
+    }
+    m_invoker = other.m_invoker;
+    m_manager = other.m_manager;
+    other.m_invoker = nullptr;
+    other.m_manager = nullptr;
+}
+
+}  // namespace edoren
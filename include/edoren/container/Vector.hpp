@@ -1,6 +1,7 @@
 #pragma once
 
 #include <edoren/util/Config.hpp>
+#include <cstddef>
 #include <optional>
 #include <vector>
 
@@ -13,6 +14,28 @@
 
 namespace edoren {
 
+// Only needed by the parallel algorithms, which are instantiated with a complete ThreadPool, so
+// including Vector does not bring the threading headers
+template <typename TaskType>
+class ThreadPool;
+
+/**
+ * @brief Size in bytes of the chunks used by the parallel algorithms of Vector
+ *
+ * Small enough to fit in the L1 cache along with the output of the chunk.
+ */
+constexpr size_t PARALLEL_CHUNK_BYTES = 16 * 1024;
+
+/**
+ * @brief Get the number of elements of type T that fit in a chunk of PARALLEL_CHUNK_BYTES
+ *
+ * @return The number of elements, at least 1
+ */
+template <typename T>
+constexpr size_t GetParallelChunkSize() {
+    return sizeof(T) >= PARALLEL_CHUNK_BYTES ? 1 : PARALLEL_CHUNK_BYTES / sizeof(T);
+}
+
 template <typename T>
 class Vector : public std::pmr::vector<T> {
 public:
@@ -55,6 +78,43 @@ public:
     template <typename Func>
     auto forEachIndexed(Func predicate) const;
 
+    // Parallel versions of the algorithms above, the chunks are executed by the pool and the
+    // calling thread (see ParallelFor). The functions are called concurrently and the results
+    // are the same as the serial versions, the result types must be default constructible.
+    // They are available where ThreadPool.hpp is included.
+
+    template <typename TaskType, typename Func>
+    auto parallelMap(ThreadPool<TaskType>& pool, Func transform) const -> Vector<std::invoke_result_t<Func, const T&>>;
+
+    template <typename TaskType, typename Func>
+    auto parallelFilter(ThreadPool<TaskType>& pool, Func predicate) const -> Vector<T>;
+
+    template <typename TaskType, typename Func>
+    void parallelForEach(ThreadPool<TaskType>& pool, Func function);
+
+    template <typename TaskType, typename Func>
+    void parallelForEach(ThreadPool<TaskType>& pool, Func function) const;
+
+    // The combine function receives the accumulated value and an element, it must be
+    // associative since each chunk is reduced on its own
+    template <typename TaskType, typename Func>
+    auto parallelReduce(ThreadPool<TaskType>& pool, T initial, Func combine) const -> T;
+
+    // Returns the first matching element like find, the chunks after a match are skipped
+    template <typename TaskType, typename Func>
+    auto parallelFind(ThreadPool<TaskType>& pool, Func predicate) -> T*;
+
+    template <typename TaskType, typename Func>
+    auto parallelFind(ThreadPool<TaskType>& pool, Func predicate) const -> const T*;
+
+    void sort();
+
+    template <typename Func>
+    void sort(Func compare);
+
+    template <typename Func>
+    void sortByKey(Func keySelector);
+
     auto first() -> T&;
 
     auto first() const -> const T&;
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <optional>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace edoren {
 
@@ -106,6 +111,165 @@ auto Vector<T>::forEachIndexed(Func predicate) const {
     }
 }
 
+template <typename T>
+template <typename TaskType, typename Func>
+auto Vector<T>::parallelMap(ThreadPool<TaskType>& pool, Func transform) const
+    -> Vector<std::invoke_result_t<Func, const T&>> {
+    using ResultType = std::invoke_result_t<Func, const T&>;
+    Vector<ResultType> new_vec(this->size());
+    // A Vector<bool> result needs a multiple of 64 elements, so the chunks never share a word
+    size_t chunkSize = GetParallelChunkSize<T>();
+    if constexpr (std::is_same_v<ResultType, bool>) {
+        chunkSize = (chunkSize + 63) & ~size_t(63);
+    }
+    ParallelFor(pool, this->size(), chunkSize, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            new_vec[i] = transform(this->operator[](i));
+        }
+    });
+    return new_vec;
+}
+
+template <typename T>
+template <typename TaskType, typename Func>
+auto Vector<T>::parallelFilter(ThreadPool<TaskType>& pool, Func predicate) const -> Vector<T> {
+    static_assert(std::is_convertible_v<std::invoke_result_t<Func, const T&>, bool>,
+                  "The predicate return type should be bool");
+    const size_t chunkSize = GetParallelChunkSize<T>();
+    const size_t chunkCount = (this->size() + chunkSize - 1) / chunkSize;
+    std::vector<uint8_t> keep(this->size());
+    std::vector<size_t> offsets(chunkCount + 1, 0);
+
+    // Evaluate the predicate once per element and count the kept elements of each chunk
+    ParallelFor(pool, this->size(), chunkSize, [&](size_t begin, size_t end) {
+        size_t kept = 0;
+        for (size_t i = begin; i < end; i++) {
+            keep[i] = predicate(this->operator[](i)) ? 1 : 0;
+            kept += keep[i];
+        }
+        offsets[begin / chunkSize + 1] = kept;
+    });
+
+    // The prefix sum of the counts is the position of the first element of each chunk
+    for (size_t chunk = 0; chunk < chunkCount; chunk++) {
+        offsets[chunk + 1] += offsets[chunk];
+    }
+
+    Vector<T> new_vec(offsets[chunkCount]);
+    if constexpr (std::is_same_v<T, bool>) {
+        // The chunks of a Vector<bool> may start in the middle of a word, so it's written serially
+        size_t position = 0;
+        for (size_t i = 0; i < this->size(); i++) {
+            if (keep[i] != 0) {
+                new_vec[position++] = this->operator[](i);
+            }
+        }
+    } else {
+        ParallelFor(pool, this->size(), chunkSize, [&](size_t begin, size_t end) {
+            size_t position = offsets[begin / chunkSize];
+            for (size_t i = begin; i < end; i++) {
+                if (keep[i] != 0) {
+                    new_vec[position++] = this->operator[](i);
+                }
+            }
+        });
+    }
+    return new_vec;
+}
+
+template <typename T>
+template <typename TaskType, typename Func>
+void Vector<T>::parallelForEach(ThreadPool<TaskType>& pool, Func function) {
+    ParallelFor(pool, this->size(), GetParallelChunkSize<T>(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            function(this->operator[](i));
+        }
+    });
+}
+
+template <typename T>
+template <typename TaskType, typename Func>
+void Vector<T>::parallelForEach(ThreadPool<TaskType>& pool, Func function) const {
+    ParallelFor(pool, this->size(), GetParallelChunkSize<T>(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            function(this->operator[](i));
+        }
+    });
+}
+
+template <typename T>
+template <typename TaskType, typename Func>
+auto Vector<T>::parallelReduce(ThreadPool<TaskType>& pool, T initial, Func combine) const -> T {
+    const size_t chunkSize = GetParallelChunkSize<T>();
+    const size_t chunkCount = (this->size() + chunkSize - 1) / chunkSize;
+    std::vector<std::optional<T>> partials(chunkCount);
+
+    ParallelFor(pool, this->size(), chunkSize, [&](size_t begin, size_t end) {
+        T accumulated = this->operator[](begin);
+        for (size_t i = begin + 1; i < end; i++) {
+            accumulated = combine(std::move(accumulated), this->operator[](i));
+        }
+        partials[begin / chunkSize].emplace(std::move(accumulated));
+    });
+
+    // Combined in order, so the result does not depend on which thread finished first
+    for (std::optional<T>& partial : partials) {
+        initial = combine(std::move(initial), *partial);
+    }
+    return initial;
+}
+
+template <typename T>
+template <typename TaskType, typename Func>
+auto Vector<T>::parallelFind(ThreadPool<TaskType>& pool, Func predicate) -> T* {
+    static_assert(std::is_convertible_v<std::invoke_result_t<Func, const T&>, bool>,
+                  "The predicate return type should be bool");
+    const size_t size = this->size();
+    const size_t index = ParallelFindFirst(pool, size, GetParallelChunkSize<T>(), [&](size_t i) -> bool {
+        return predicate(this->operator[](i));
+    });
+    return index < size ? &this->operator[](index) : nullptr;
+}
+
+template <typename T>
+template <typename TaskType, typename Func>
+auto Vector<T>::parallelFind(ThreadPool<TaskType>& pool, Func predicate) const -> const T* {
+    return const_cast<Vector&>(*this).parallelFind(pool, predicate);
+}
+
+template <typename T>
+void Vector<T>::sort() {
+    std::sort(this->begin(), this->end());
+}
+
+template <typename T>
+template <typename Func>
+void Vector<T>::sort(Func compare) {
+    std::sort(this->begin(), this->end(), compare);
+}
+
+template <typename T>
+template <typename Func>
+void Vector<T>::sortByKey(Func keySelector) {
+    using Key = std::decay_t<std::invoke_result_t<Func, const T&>>;
+    // Each key is computed only once, which pays off when they are expensive to
+    // generate (e.g. collation keys) but cheap to compare. The index is used to
+    // make the sort stable and to move the elements to their final position.
+    std::vector<std::pair<Key, size_t>> keys;
+    keys.reserve(this->size());
+    for (size_t i = 0; i < this->size(); i++) {
+        keys.emplace_back(keySelector(std::as_const(this->operator[](i))), i);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    Vector<T> sorted(this->get_allocator());
+    sorted.reserve(this->size());
+    for (auto& key : keys) {
+        sorted.push_back(std::move(this->operator[](key.second)));
+    }
+    *this = std::move(sorted);
+}
+
 template <typename T>
 auto Vector<T>::first() -> T& {
     if (this->size() > 0) {
@@ -7,6 +7,8 @@
 #include <edoren/util/Platform.hpp>
 #include <edoren/util/Singleton.hpp>
 
+#include <iterator>
+
 // On Windows undefine this anoying macro defined by windows.h
 #if PLATFORM_IS(PLATFORM_WINDOWS)
     #undef ERROR
@@ -47,9 +49,10 @@ inline void LogVerbose(StringView tag, StringView message) {
 
 template <typename... Args>
 inline void LogVerbose(StringView tag, StringView message, Args&&... args) {
-    auto internalStringView = fmt::string_view(message.getData(), message.getSize());
-    auto formated = fmt::vformat(internalStringView, fmt::make_format_args(args...));
-    LogVerbose(tag, StringView(formated.data()));
+    auto internalStringView = fmt::string_view(message.getData(), message.getDataSize());
+    fmt::memory_buffer formatted;
+    fmt::vformat_to(std::back_inserter(formatted), internalStringView, fmt::make_format_args(args...));
+    LogVerbose(tag, StringView(formatted.data(), formatted.size(), utf::AssumeValid));
 }
 
 inline void LogDebug(StringView tag, StringView message) {
@@ -58,9 +61,10 @@ inline void LogDebug(StringView tag, StringView message) {
 
 template <typename... Args>
 inline void LogDebug(StringView tag, StringView message, Args&&... args) {
-    auto internalStringView = fmt::string_view(message.getData(), message.getSize());
-    auto formated = fmt::vformat(internalStringView, fmt::make_format_args(args...));
-    LogDebug(tag, StringView(formated.data()));
+    auto internalStringView = fmt::string_view(message.getData(), message.getDataSize());
+    fmt::memory_buffer formatted;
+    fmt::vformat_to(std::back_inserter(formatted), internalStringView, fmt::make_format_args(args...));
+    LogDebug(tag, StringView(formatted.data(), formatted.size(), utf::AssumeValid));
 }
 
 inline void LogInfo(StringView tag, StringView message) {
@@ -69,9 +73,10 @@ inline void LogInfo(StringView tag, StringView message) {
 
 template <typename... Args>
 inline void LogInfo(StringView tag, StringView message, Args&&... args) {
-    auto internalStringView = fmt::string_view(message.getData(), message.getSize());
-    auto formated = fmt::vformat(internalStringView, fmt::make_format_args(args...));
-    LogInfo(tag, StringView(formated.data()));
+    auto internalStringView = fmt::string_view(message.getData(), message.getDataSize());
+    fmt::memory_buffer formatted;
+    fmt::vformat_to(std::back_inserter(formatted), internalStringView, fmt::make_format_args(args...));
+    LogInfo(tag, StringView(formatted.data(), formatted.size(), utf::AssumeValid));
 }
 
 inline void LogWarning(StringView tag, StringView message) {
@@ -80,9 +85,10 @@ inline void LogWarning(StringView tag, StringView message) {
 
 template <typename... Args>
 inline void LogWarning(StringView tag, StringView message, Args&&... args) {
-    auto internalStringView = fmt::string_view(message.getData(), message.getSize());
-    auto formated = fmt::vformat(internalStringView, fmt::make_format_args(args...));
-    LogWarning(tag, StringView(formated.data()));
+    auto internalStringView = fmt::string_view(message.getData(), message.getDataSize());
+    fmt::memory_buffer formatted;
+    fmt::vformat_to(std::back_inserter(formatted), internalStringView, fmt::make_format_args(args...));
+    LogWarning(tag, StringView(formatted.data(), formatted.size(), utf::AssumeValid));
 }
 
 inline void LogError(StringView tag, StringView message) {
@@ -91,9 +97,10 @@ inline void LogError(StringView tag, StringView message) {
 
 template <typename... Args>
 inline void LogError(StringView tag, StringView message, Args&&... args) {
-    auto internalStringView = fmt::string_view(message.getData(), message.getSize());
-    auto formated = fmt::vformat(internalStringView, fmt::make_format_args(args...));
-    LogError(tag, StringView(formated.data()));
+    auto internalStringView = fmt::string_view(message.getData(), message.getDataSize());
+    fmt::memory_buffer formatted;
+    fmt::vformat_to(std::back_inserter(formatted), internalStringView, fmt::make_format_args(args...));
+    LogError(tag, StringView(formatted.data(), formatted.size(), utf::AssumeValid));
 }
 
 inline void LogFatal(StringView tag, StringView message) {
@@ -102,9 +109,10 @@ inline void LogFatal(StringView tag, StringView message) {
 
 template <typename... Args>
 inline void LogFatal(StringView tag, StringView message, Args&&... args) {
-    auto internalStringView = fmt::string_view(message.getData(), message.getSize());
-    auto formated = fmt::vformat(internalStringView, fmt::make_format_args(args...));
-    LogFatal(tag, StringView(formated.data()));
+    auto internalStringView = fmt::string_view(message.getData(), message.getDataSize());
+    fmt::memory_buffer formatted;
+    fmt::vformat_to(std::back_inserter(formatted), internalStringView, fmt::make_format_args(args...));
+    LogFatal(tag, StringView(formatted.data(), formatted.size(), utf::AssumeValid));
 }
 
 }  // namespace edoren
@@ -8,6 +8,18 @@ namespace edoren {
 
 namespace filesystem {
 
+/**
+ * @brief Enum with the text encodings that can be detected when loading a text file
+ */
+enum class TextEncoding {
+    UTF_8,         ///< UTF-8, with or without BOM
+    UTF_16LE,      ///< UTF-16 little endian
+    UTF_16BE,      ///< UTF-16 big endian
+    UTF_32LE,      ///< UTF-32 little endian
+    UTF_32BE,      ///< UTF-32 big endian
+    WINDOWS_1252,  ///< Windows-1252, used when the data is not valid in any UTF encoding
+};
+
 /**
  * @brief Checks if a file exist
  *
@@ -43,6 +55,41 @@ EDOTOOLS_API bool LoadFileData(StringView filename, String& dest);
  */
 EDOTOOLS_API bool LoadFileData(StringView filename, Vector<uint8_t>& dest);
 
+/**
+ * @brief Detect the encoding of a block of text
+ *
+ * A BOM (byte order mark) takes precedence. Without it only the first 16 KiB
+ * are inspected: UTF-16 and UTF-32 are detected from the zero bytes that ASCII
+ * and Latin text contains when stored with those encodings, valid UTF-8 is
+ * reported as such and anything else is considered Windows-1252.
+ *
+ * @param data The start of the text data
+ * @param size The size in bytes of the text data
+ * @param bomSize Optional output to store the size of the BOM found, or 0 if none
+ * @return The detected encoding
+ */
+EDOTOOLS_API TextEncoding DetectTextEncoding(const uint8_t* data, size_t size, size_t* bomSize = nullptr);
+
+/**
+ * @brief Load a text file to the memory detecting its encoding
+ *
+ * The encoding is detected with @ref DetectTextEncoding using the start of the
+ * file, then the file is transcoded to UTF-8 in a single streaming pass directly
+ * into `dest`. The files that do not report their size, like the ones in /proc
+ * or pipes, are read until the end.
+ *
+ * @throw std::runtime_error If the data is not valid in the detected encoding,
+ *        e.g. a file that looked like UTF-8 contains invalid sequences after the
+ *        inspected block
+ *
+ * @param filename The file to load the data from
+ * @param dest A string to store de file text
+ * @param encoding Optional output to store the encoding of the file
+ * @return true if the file could be loaded, false if it does not exist, it
+ *         can't be opened or read (e.g. it's a directory)
+ */
+EDOTOOLS_API bool LoadTextFileData(StringView filename, String& dest, TextEncoding* encoding = nullptr);
+
 /**
  * @brief Get the OS specific path separator
  *
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+#include <edoren/util/Config.hpp>
+#include <edoren/util/NonCopyable.hpp>
+
+namespace edoren {
+
+/**
+ * @brief Lock-free bounded multi-producer multi-consumer queue
+ *
+ * Ring buffer where every slot has a sequence number that tells if it's
+ * ready to be written or read, so producers and consumers only compete
+ * with a CAS on the enqueue or dequeue position. Each slot is aligned to
+ * a cache line to avoid false sharing between neighbouring elements.
+ *
+ * Based on the bounded MPMC queue by Dmitry Vyukov.
+ *
+ * @tparam T Type of the elements, it must be nothrow move constructible
+ */
+template <typename T>
+class BoundedMPMCQueue : NonCopyable {
+    static_assert(std::is_nothrow_move_constructible_v<T>, "BoundedMPMCQueue elements must be nothrow movable");
+
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param capacity Maximum number of elements, it's rounded up to a power of two
+     */
+    explicit BoundedMPMCQueue(size_t capacity = 1024);
+
+    /**
+     * @brief Destructor
+     *
+     * Destroys the elements that were not dequeued.
+     */
+    ~BoundedMPMCQueue();
+
+    /**
+     * @brief Add an element at the end of the queue
+     *
+     * @param item The element to add, it's only moved if there is space for it
+     * @return true if the element was added, false if the queue is full
+     */
+    bool tryPush(T&& item);
+
+    /**
+     * @brief Remove the element at the front of the queue
+     *
+     * @param item Variable where the element is moved
+     * @return true if an element was removed, false if the queue is empty
+     */
+    bool tryPop(T& item);
+
+    /**
+     * @brief Get the approximate number of elements in the queue
+     *
+     * The result is only a hint since other threads may modify the queue
+     * at the same time.
+     *
+     * @return The number of elements
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief Get the maximum number of elements
+     *
+     * @return The capacity of the queue
+     */
+    size_t getCapacity() const;
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<size_t> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    T* getItem(Slot& slot);
+
+    size_t m_mask;
+    std::unique_ptr<Slot[]> m_slots;
+    alignas(64) std::atomic<size_t> m_enqueue_pos;  ///< Next position to write, shared by the producers
+    alignas(64) std::atomic<size_t> m_dequeue_pos;  ///< Next position to read, shared by the consumers
+};
+
+}  // namespace edoren
+
+#include "BoundedMPMCQueue.inl"
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <bit>
+#include <new>
+#include <utility>
+
+namespace edoren {
+
+template <typename T>
+BoundedMPMCQueue<T>::BoundedMPMCQueue(size_t capacity)
+      : m_mask(std::bit_ceil(capacity < 2 ? 2 : capacity) - 1),
+        m_slots(std::make_unique<Slot[]>(m_mask + 1)),
+        m_enqueue_pos(0),
+        m_dequeue_pos(0) {
+    for (size_t i = 0; i <= m_mask; i++) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+BoundedMPMCQueue<T>::~BoundedMPMCQueue() {
+    const size_t enqueuePos = m_enqueue_pos.load(std::memory_order_relaxed);
+    for (size_t pos = m_dequeue_pos.load(std::memory_order_relaxed); pos != enqueuePos; pos++) {
+        getItem(m_slots[pos & m_mask])->~T();
+    }
+}
+
+template <typename T>
+bool BoundedMPMCQueue<T>::tryPush(T&& item) {
+    size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+    while (true) {
+        Slot& slot = m_slots[pos & m_mask];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+        if (diff == 0) {
+            // The slot is free for this position, try to claim it
+            if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                new (slot.storage) T(std::move(item));
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // The slot still holds the element of the previous lap
+            return false;
+        } else {
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+bool BoundedMPMCQueue<T>::tryPop(T& item) {
+    size_t pos = m_dequeue_pos.load(std::memory_order_relaxed);
+    while (true) {
+        Slot& slot = m_slots[pos & m_mask];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+        if (diff == 0) {
+            // The slot has the element for this position, try to claim it
+            if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                T* stored = getItem(slot);
+                item = std::move(*stored);
+                stored->~T();
+                slot.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // The slot was not written yet
+            return false;
+        } else {
+            pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template <typename T>
+size_t BoundedMPMCQueue<T>::getSize() const {
+    size_t dequeuePos = m_dequeue_pos.load(std::memory_order_relaxed);
+    size_t enqueuePos = m_enqueue_pos.load(std::memory_order_relaxed);
+    return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+}
+
+template <typename T>
+size_t BoundedMPMCQueue<T>::getCapacity() const {
+    return m_mask + 1;
+}
+
+template <typename T>
+T* BoundedMPMCQueue<T>::getItem(Slot& slot) {
+    return std::launder(reinterpret_cast<T*>(slot.storage));
+}
+
+}  // namespace edoren
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+
+#include <edoren/StringView.hpp>
+#include <edoren/container/Vector.hpp>
+#include <edoren/util/Config.hpp>
+
+namespace edoren {
+
+/**
+ * @brief NUMA node of the system and its CPUs
+ */
+struct NumaNode {
+    uint32_t id;            ///< Id of the node in the system
+    Vector<uint32_t> cpus;  ///< CPUs of the node that the process is allowed to use
+};
+
+/**
+ * @brief Maximum number of CPUs supported, the same as the size of a Linux cpu_set_t
+ */
+constexpr uint32_t MAX_CPU_COUNT = 1024;
+
+/**
+ * @brief Parse a list of CPUs in the format used by Linux (e.g. "0-3,8,10-11")
+ *
+ * @param text The list of CPUs
+ * @return The CPUs in ascending order, empty if the text is not valid or has a CPU
+ *         greater than or equal to MAX_CPU_COUNT
+ */
+EDOTOOLS_API Vector<uint32_t> ParseCpuList(StringView text);
+
+/**
+ * @brief Get the NUMA nodes of the system
+ *
+ * On Linux the nodes are read from /sys/devices/system/node, only the CPUs
+ * allowed by the affinity mask of the process are included and the nodes
+ * without any of them are skipped. On the other platforms, or if the
+ * information is not available, it returns a single node with all the CPUs.
+ *
+ * @return The nodes ordered by id, it always has at least one node with one CPU
+ */
+EDOTOOLS_API Vector<NumaNode> GetNumaNodes();
+
+/**
+ * @brief Pin the calling thread to a CPU
+ *
+ * @param cpu The CPU where the thread must run
+ * @return true if the affinity was changed, false if it failed or is not supported in the platform
+ */
+EDOTOOLS_API bool SetCurrentThreadAffinity(uint32_t cpu);
+
+/**
+ * @brief Get the CPU where the calling thread is running
+ *
+ * @return The CPU, or -1 if it's not supported in the platform
+ */
+EDOTOOLS_API int32_t GetCurrentCpu();
+
+}  // namespace edoren
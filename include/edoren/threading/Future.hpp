@@ -0,0 +1,295 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+#include <edoren/UniqueFunction.hpp>
+#include <edoren/container/Vector.hpp>
+#include <edoren/util/Config.hpp>
+#include <edoren/util/MemoryResource.hpp>
+#include <edoren/util/NonCopyable.hpp>
+
+namespace edoren {
+
+template <typename T>
+class Future;
+
+template <typename T>
+class Promise;
+
+namespace internal {
+
+/**
+ * @brief State shared between a Promise and its Future
+ *
+ * It's reference counted and allocated from GetPooledResource, so
+ * creating a promise does not go through the general purpose allocator.
+ */
+template <typename T>
+class FutureState : NonCopyable {
+public:
+    static FutureState* Create();
+
+    void addReference();
+
+    void removeReference();
+
+    bool isReady() const;
+
+    void wait() const;
+
+    bool hasException() const;
+
+    const std::exception_ptr& getException() const;
+
+    template <typename... Args>
+    void setValue(Args&&... args);
+
+    void setException(std::exception_ptr exception);
+
+    T takeValue();
+
+    void setContinuation(UniqueFunction<void()>&& continuation);
+
+private:
+    enum Status : uint32_t { PENDING, HAS_CONTINUATION, READY };
+
+    struct Empty {};
+    using ValueType = std::conditional_t<std::is_void_v<T>, Empty, T>;
+
+    FutureState();
+
+    ~FutureState();
+
+    void markReady();
+
+    std::atomic<uint32_t> m_references;
+    std::atomic<uint32_t> m_status;
+    bool m_has_value;
+    union {
+        ValueType m_value;
+    };
+    std::exception_ptr m_exception;
+    UniqueFunction<void()> m_continuation;  ///< Runs in the thread that makes the state ready
+};
+
+struct FutureAccess;
+
+}  // namespace internal
+
+/**
+ * @brief Object that receives the result of an asynchronous operation
+ *
+ * Unlike std::future, the shared state is allocated from a pool and the
+ * result can be consumed without blocking with @ref then, whose continuation
+ * runs inline in the thread that provides the result.
+ *
+ * @code
+ * Future<int> future = pool.submit([]() { return 21; });
+ * Future<int> doubled = future.then([](int value) { return value * 2; });
+ * int result = doubled.get();
+ * @endcode
+ *
+ * @tparam T Type of the result, it can be void
+ */
+template <typename T>
+class Future {
+public:
+    using ValueType = T;
+
+    /**
+     * @brief Default constructor, the future is not valid
+     */
+    Future() noexcept;
+
+    /**
+     * @brief Copy constructor (deleted)
+     */
+    Future(const Future& other) = delete;
+
+    /**
+     * @brief Move constructor
+     */
+    Future(Future&& other) noexcept;
+
+    /**
+     * @brief Destructor
+     */
+    ~Future();
+
+    /**
+     * @brief Copy operator (deleted)
+     */
+    Future& operator=(const Future& other) = delete;
+
+    /**
+     * @brief Move operator
+     */
+    Future& operator=(Future&& other) noexcept;
+
+    /**
+     * @brief Check if the future refers to a shared state
+     *
+     * @return false if the future was default constructed, moved or consumed
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Check if the result is available
+     *
+     * @return true if the result or an exception is available
+     */
+    bool isReady() const;
+
+    /**
+     * @brief Block until the result is available
+     */
+    void wait() const;
+
+    /**
+     * @brief Wait for the result and retrieve it
+     *
+     * The future is not valid after calling this function. If the operation
+     * failed the exception is rethrown.
+     *
+     * @return The result of the operation
+     */
+    T get();
+
+    /**
+     * @brief Attach a continuation that receives the result
+     *
+     * The continuation runs inline in the thread that provides the result, or
+     * in the current thread if the result is already available, so it should
+     * be short. If the operation failed the continuation is not called and the
+     * returned future receives the exception. This future is not valid after
+     * calling this function.
+     *
+     * @param continuation A callable that receives the result (or nothing if T is void)
+     * @return A future for the result of the continuation
+     */
+    template <typename Func>
+    auto then(Func&& continuation);
+
+private:
+    friend class Promise<T>;
+    friend struct internal::FutureAccess;
+
+    explicit Future(internal::FutureState<T>* state) noexcept;
+
+    internal::FutureState<T>* m_state;
+};
+
+/**
+ * @brief Object that provides the result of an asynchronous operation to a Future
+ *
+ * If a promise is destroyed without providing a result, its future receives
+ * a std::future_error with the std::future_errc::broken_promise code.
+ *
+ * @tparam T Type of the result, it can be void
+ */
+template <typename T>
+class Promise {
+public:
+    /**
+     * @brief Constructor, allocates a new shared state
+     */
+    Promise();
+
+    /**
+     * @brief Copy constructor (deleted)
+     */
+    Promise(const Promise& other) = delete;
+
+    /**
+     * @brief Move constructor
+     */
+    Promise(Promise&& other) noexcept;
+
+    /**
+     * @brief Destructor
+     */
+    ~Promise();
+
+    /**
+     * @brief Copy operator (deleted)
+     */
+    Promise& operator=(const Promise& other) = delete;
+
+    /**
+     * @brief Move operator
+     */
+    Promise& operator=(Promise&& other) noexcept;
+
+    /**
+     * @brief Get the future associated with the promise
+     *
+     * @note Must be called only once
+     *
+     * @return The future that receives the result
+     */
+    Future<T> getFuture();
+
+    /**
+     * @brief Provide the result of the operation
+     *
+     * @param args Arguments to construct the result, nothing if T is void
+     */
+    template <typename... Args>
+    void setValue(Args&&... args);
+
+    /**
+     * @brief Provide the exception that made the operation fail
+     *
+     * @param exception The exception
+     */
+    void setException(std::exception_ptr exception);
+
+private:
+    internal::FutureState<T>* m_state;
+    bool m_future_retrieved;
+};
+
+/**
+ * @brief Result of whenAny, the index of the first future that became ready and its result
+ */
+template <typename T>
+struct WhenAnyResult {
+    size_t index;  ///< Index of the future in the input vector
+    T value;       ///< Result of the future
+};
+
+/**
+ * @brief Create a future that becomes ready when all the futures are ready
+ *
+ * No thread blocks waiting for the futures, the last one to finish provides
+ * the combined result. If any of the operations fails the combined future
+ * receives the first exception.
+ *
+ * @param futures The futures to wait for, they are consumed
+ * @return A future with the results in the same order as the input, or a Future<void> if T is void
+ */
+template <typename T>
+auto WhenAll(Vector<Future<T>>&& futures) -> Future<std::conditional_t<std::is_void_v<T>, void, Vector<T>>>;
+
+/**
+ * @brief Create a future that becomes ready when the first of the futures is ready
+ *
+ * If the first operation to finish fails, the combined future receives its
+ * exception. If the vector is empty the combined future receives a broken
+ * promise error.
+ *
+ * @param futures The futures to wait for, they are consumed
+ * @return A future with the index and the result of the first future, or only the index if T is void
+ */
+template <typename T>
+auto WhenAny(Vector<Future<T>>&& futures) -> Future<std::conditional_t<std::is_void_v<T>, size_t, WhenAnyResult<T>>>;
+
+}  // namespace edoren
+
+#include "Future.inl"
@@ -0,0 +1,366 @@
+#pragma once
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <new>
+#include <optional>
+
+namespace edoren {
+
+namespace internal {
+
+template <typename Func, typename T>
+struct ContinuationResult {
+    using Type = std::invoke_result_t<Func&, T&&>;
+};
+
+template <typename Func>
+struct ContinuationResult<Func, void> {
+    using Type = std::invoke_result_t<Func&>;
+};
+
+// Call the function and store its result or its exception in the promise
+template <typename T, typename Func, typename... Args>
+void FulfillPromise(Promise<T>& promise, Func& func, Args&&... args) {
+    EDOTOOLS_TRY {
+        if constexpr (std::is_void_v<T>) {
+            std::invoke(func, std::forward<Args>(args)...);
+            promise.setValue();
+        } else {
+            promise.setValue(std::invoke(func, std::forward<Args>(args)...));
+        }
+    }
+    EDOTOOLS_CATCH(...) {
+        promise.setException(std::current_exception());
+    }
+}
+
+struct FutureAccess {
+    // Call the callback with the state of the future once it's ready
+    template <typename T, typename Func>
+    static void OnReady(Future<T>&& future, Func&& callback) {
+        FutureState<T>* state = future.m_state;
+        state->setContinuation([source = std::move(future), callback = std::forward<Func>(callback)]() mutable {
+            callback(*source.m_state);
+        });
+    }
+};
+
+template <typename T>
+FutureState<T>* FutureState<T>::Create() {
+    void* memory = GetPooledResource()->allocate(sizeof(FutureState), alignof(FutureState));
+    return new (memory) FutureState();
+}
+
+template <typename T>
+FutureState<T>::FutureState() : m_references(1),
+                                m_status(PENDING),
+                                m_has_value(false) {}
+
+template <typename T>
+FutureState<T>::~FutureState() {
+    if (m_has_value) {
+        m_value.~ValueType();
+    }
+}
+
+template <typename T>
+void FutureState<T>::addReference() {
+    m_references.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename T>
+void FutureState<T>::removeReference() {
+    if (m_references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        this->~FutureState();
+        GetPooledResource()->deallocate(this, sizeof(FutureState), alignof(FutureState));
+    }
+}
+
+template <typename T>
+bool FutureState<T>::isReady() const {
+    return m_status.load(std::memory_order_acquire) == READY;
+}
+
+template <typename T>
+void FutureState<T>::wait() const {
+    uint32_t status = m_status.load(std::memory_order_acquire);
+    while (status != READY) {
+        m_status.wait(status, std::memory_order_acquire);
+        status = m_status.load(std::memory_order_acquire);
+    }
+}
+
+template <typename T>
+bool FutureState<T>::hasException() const {
+    return m_exception != nullptr;
+}
+
+template <typename T>
+const std::exception_ptr& FutureState<T>::getException() const {
+    return m_exception;
+}
+
+template <typename T>
+template <typename... Args>
+void FutureState<T>::setValue(Args&&... args) {
+    EDOTOOLS_ASSERT(!isReady(), "The result was already provided");
+    new (&m_value) ValueType(std::forward<Args>(args)...);
+    m_has_value = true;
+    markReady();
+}
+
+template <typename T>
+void FutureState<T>::setException(std::exception_ptr exception) {
+    EDOTOOLS_ASSERT(!isReady(), "The result was already provided");
+    m_exception = std::move(exception);
+    markReady();
+}
+
+template <typename T>
+T FutureState<T>::takeValue() {
+    if constexpr (!std::is_void_v<T>) {
+        return std::move(m_value);
+    }
+}
+
+template <typename T>
+void FutureState<T>::setContinuation(UniqueFunction<void()>&& continuation) {
+    m_continuation = std::move(continuation);
+    uint32_t expected = PENDING;
+    if (!m_status.compare_exchange_strong(expected, HAS_CONTINUATION, std::memory_order_acq_rel)) {
+        // The result is already available, run the continuation in this thread
+        UniqueFunction<void()> ready = std::move(m_continuation);
+        ready();
+    }
+}
+
+template <typename T>
+void FutureState<T>::markReady() {
+    const uint32_t previous = m_status.exchange(READY, std::memory_order_acq_rel);
+    m_status.notify_all();
+    if (previous == HAS_CONTINUATION) {
+        // Moved out so the references held by the continuation are released after running it
+        UniqueFunction<void()> continuation = std::move(m_continuation);
+        continuation();
+    }
+}
+
+}  // namespace internal
+
+template <typename T>
+Future<T>::Future() noexcept : m_state(nullptr) {}
+
+template <typename T>
+Future<T>::Future(internal::FutureState<T>* state) noexcept : m_state(state) {}
+
+template <typename T>
+Future<T>::Future(Future&& other) noexcept : m_state(std::exchange(other.m_state, nullptr)) {}
+
+template <typename T>
+Future<T>::~Future() {
+    if (m_state != nullptr) {
+        m_state->removeReference();
+    }
+}
+
+template <typename T>
+Future<T>& Future<T>::operator=(Future&& other) noexcept {
+    if (this != &other) {
+        if (m_state != nullptr) {
+            m_state->removeReference();
+        }
+        m_state = std::exchange(other.m_state, nullptr);
+    }
+    return *this;
+}
+
+template <typename T>
+bool Future<T>::isValid() const {
+    return m_state != nullptr;
+}
+
+template <typename T>
+bool Future<T>::isReady() const {
+    return m_state != nullptr && m_state->isReady();
+}
+
+template <typename T>
+void Future<T>::wait() const {
+    EDOTOOLS_ASSERT(isValid(), "The future has no state");
+    m_state->wait();
+}
+
+template <typename T>
+T Future<T>::get() {
+    EDOTOOLS_ASSERT(isValid(), "The future has no state");
+    Future consumed(std::move(*this));
+    internal::FutureState<T>* state = consumed.m_state;
+    state->wait();
+    if (state->hasException()) {
+        std::rethrow_exception(state->getException());
+    }
+    return state->takeValue();
+}
+
+template <typename T>
+template <typename Func>
+auto Future<T>::then(Func&& continuation) {
+    EDOTOOLS_ASSERT(isValid(), "The future has no state");
+    using FuncType = std::decay_t<Func>;
+    using ResultType = typename internal::ContinuationResult<FuncType, T>::Type;
+
+    Promise<ResultType> promise;
+    Future<ResultType> result = promise.getFuture();
+    internal::FutureState<T>* state = m_state;
+    state->setContinuation([source = std::move(*this), promise = std::move(promise),
+                            continuation = FuncType(std::forward<Func>(continuation))]() mutable {
+        internal::FutureState<T>* state = source.m_state;
+        if (state->hasException()) {
+            promise.setException(state->getException());
+        } else if constexpr (std::is_void_v<T>) {
+            internal::FulfillPromise(promise, continuation);
+        } else {
+            internal::FulfillPromise(promise, continuation, state->takeValue());
+        }
+    });
+    return result;
+}
+
+template <typename T>
+Promise<T>::Promise() : m_state(internal::FutureState<T>::Create()),
+                        m_future_retrieved(false) {}
+
+template <typename T>
+Promise<T>::Promise(Promise&& other) noexcept : m_state(std::exchange(other.m_state, nullptr)),
+                                                m_future_retrieved(other.m_future_retrieved) {}
+
+template <typename T>
+Promise<T>::~Promise() {
+    if (m_state != nullptr) {
+        if (!m_state->isReady()) {
+            m_state->setException(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+        }
+        m_state->removeReference();
+    }
+}
+
+template <typename T>
+Promise<T>& Promise<T>::operator=(Promise&& other) noexcept {
+    if (this != &other) {
+        // Releases the current state, breaking the promise if it was not fulfilled
+        Promise previous(std::move(*this));
+        m_state = std::exchange(other.m_state, nullptr);
+        m_future_retrieved = other.m_future_retrieved;
+    }
+    return *this;
+}
+
+template <typename T>
+Future<T> Promise<T>::getFuture() {
+    EDOTOOLS_ASSERT(m_state != nullptr && !m_future_retrieved, "The future was already retrieved");
+    m_future_retrieved = true;
+    m_state->addReference();
+    return Future<T>(m_state);
+}
+
+template <typename T>
+template <typename... Args>
+void Promise<T>::setValue(Args&&... args) {
+    m_state->setValue(std::forward<Args>(args)...);
+}
+
+template <typename T>
+void Promise<T>::setException(std::exception_ptr exception) {
+    m_state->setException(std::move(exception));
+}
+
+template <typename T>
+auto WhenAll(Vector<Future<T>>&& futures) -> Future<std::conditional_t<std::is_void_v<T>, void, Vector<T>>> {
+    using ResultType = std::conditional_t<std::is_void_v<T>, void, Vector<T>>;
+    using StoredType = std::conditional_t<std::is_void_v<T>, bool, std::optional<T>>;
+
+    struct Context {
+        Promise<ResultType> promise;
+        Vector<StoredType> results;
+        std::atomic<size_t> remaining;
+        std::atomic<bool> failed;
+        std::exception_ptr exception;
+    };
+
+    // A single allocation for all the futures, the results are stored in place
+    auto context = std::allocate_shared<Context>(
+        std::pmr::polymorphic_allocator<Context>(internal::GetPooledResource()));
+    Future<ResultType> result = context->promise.getFuture();
+    const size_t count = futures.size();
+    if (count == 0) {
+        context->promise.setValue();
+        return result;
+    }
+
+    context->results.resize(count);
+    context->remaining = count;
+    context->failed = false;
+    for (size_t i = 0; i < count; i++) {
+        internal::FutureAccess::OnReady(std::move(futures[i]), [context, i](internal::FutureState<T>& state) {
+            if (state.hasException()) {
+                if (!context->failed.exchange(true, std::memory_order_relaxed)) {
+                    context->exception = state.getException();
+                }
+            } else if constexpr (!std::is_void_v<T>) {
+                context->results[i].emplace(state.takeValue());
+            }
+            if (context->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+            if (context->failed.load(std::memory_order_relaxed)) {
+                context->promise.setException(context->exception);
+            } else if constexpr (std::is_void_v<T>) {
+                context->promise.setValue();
+            } else {
+                Vector<T> values;
+                values.reserve(context->results.size());
+                for (StoredType& value : context->results) {
+                    values.push_back(std::move(*value));
+                }
+                context->promise.setValue(std::move(values));
+            }
+        });
+    }
+    futures.clear();
+    return result;
+}
+
+template <typename T>
+auto WhenAny(Vector<Future<T>>&& futures) -> Future<std::conditional_t<std::is_void_v<T>, size_t, WhenAnyResult<T>>> {
+    using ResultType = std::conditional_t<std::is_void_v<T>, size_t, WhenAnyResult<T>>;
+
+    struct Context {
+        Promise<ResultType> promise;
+        std::atomic<bool> done;
+    };
+
+    auto context = std::allocate_shared<Context>(
+        std::pmr::polymorphic_allocator<Context>(internal::GetPooledResource()));
+    Future<ResultType> result = context->promise.getFuture();
+    context->done = false;
+    for (size_t i = 0; i < futures.size(); i++) {
+        internal::FutureAccess::OnReady(std::move(futures[i]), [context, i](internal::FutureState<T>& state) {
+            if (context->done.exchange(true, std::memory_order_relaxed)) {
+                return;
+            }
+            if (state.hasException()) {
+                context->promise.setException(state.getException());
+            } else if constexpr (std::is_void_v<T>) {
+                context->promise.setValue(i);
+            } else {
+                context->promise.setValue(WhenAnyResult<T>{i, state.takeValue()});
+            }
+        });
+    }
+    futures.clear();
+    return result;
+}
+
+}  // namespace edoren
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+
+#include <edoren/FunctionRef.hpp>
+#include <edoren/util/Config.hpp>
+
+namespace edoren {
+
+template <typename TaskType>
+class ThreadPool;
+
+/**
+ * @brief Call a function over the range [0, count) split in chunks executed in parallel
+ *
+ * The chunks are claimed in order by the workers of the pool and by the
+ * calling thread, which also processes chunks while it waits. So no thread
+ * blocks on work that has not started, and it's safe to call it from a task
+ * running in the same pool. If the body throws, the first exception is
+ * rethrown in the calling thread after all the chunks finish.
+ *
+ * @code
+ * ParallelFor(pool, values.getSize(), 1024, [&](size_t begin, size_t end) {
+ *     for (size_t i = begin; i < end; i++) {
+ *         values[i] *= 2;
+ *     }
+ * });
+ * @endcode
+ *
+ * @param pool The pool that executes the chunks
+ * @param count Number of elements of the range
+ * @param chunkSize Maximum number of elements of each chunk
+ * @param body Function that receives the range [begin, end) of a chunk
+ */
+template <typename TaskType>
+void ParallelFor(ThreadPool<TaskType>& pool,
+                 size_t count,
+                 size_t chunkSize,
+                 FunctionRef<void(size_t begin, size_t end)> body);
+
+/**
+ * @brief Find the lowest index of the range [0, count) that matches a predicate, in parallel
+ *
+ * The chunks are processed like in ParallelFor, and the ones after a known
+ * match stop early.
+ *
+ * @param pool The pool that executes the chunks
+ * @param count Number of elements of the range
+ * @param chunkSize Maximum number of elements of each chunk
+ * @param predicate Function that receives an index and returns true if it matches
+ * @return The lowest matching index, or count if there is no match
+ */
+template <typename TaskType>
+size_t ParallelFindFirst(ThreadPool<TaskType>& pool,
+                         size_t count,
+                         size_t chunkSize,
+                         FunctionRef<bool(size_t index)> predicate);
+
+}  // namespace edoren
+
+#include "ParallelFor.inl"
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <vector>
+
+namespace edoren {
+
+namespace internal {
+
+struct ParallelForState {
+    ParallelForState(size_t count, size_t chunkSize, FunctionRef<void(size_t, size_t)> body)
+          : nextChunk(0),
+            finishedChunks(0),
+            failed(false),
+            count(count),
+            chunkSize(chunkSize),
+            chunkCount((count + chunkSize - 1) / chunkSize),
+            body(body) {}
+
+    // Claim and run chunks until there are no more left
+    void runChunks() {
+        while (true) {
+            const size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk >= chunkCount) {
+                return;
+            }
+            const size_t begin = chunk * chunkSize;
+            EDOTOOLS_TRY {
+                body(begin, std::min(count, begin + chunkSize));
+            }
+            EDOTOOLS_CATCH(...) {
+                if (!failed.exchange(true, std::memory_order_relaxed)) {
+                    exception = std::current_exception();
+                }
+            }
+            if (finishedChunks.fetch_add(1, std::memory_order_acq_rel) + 1 == chunkCount) {
+                finishedChunks.notify_all();
+            }
+        }
+    }
+
+    void wait() {
+        size_t finished = finishedChunks.load(std::memory_order_acquire);
+        while (finished != chunkCount) {
+            finishedChunks.wait(finished, std::memory_order_acquire);
+            finished = finishedChunks.load(std::memory_order_acquire);
+        }
+    }
+
+    std::atomic<size_t> nextChunk;
+    std::atomic<size_t> finishedChunks;
+    std::atomic<bool> failed;
+    std::exception_ptr exception;
+    const size_t count;
+    const size_t chunkSize;
+    const size_t chunkCount;
+    // Only called for claimed chunks, which the calling thread waits for, so it outlives the calls
+    FunctionRef<void(size_t, size_t)> body;
+};
+
+}  // namespace internal
+
+template <typename TaskType>
+void ParallelFor(ThreadPool<TaskType>& pool,
+                 size_t count,
+                 size_t chunkSize,
+                 FunctionRef<void(size_t begin, size_t end)> body) {
+    if (count == 0) {
+        return;
+    }
+    chunkSize = std::max<size_t>(chunkSize, 1);
+    if (count <= chunkSize || pool.getWorkerCount() == 0) {
+        body(0, count);
+        return;
+    }
+
+    // Shared with the helper tasks, which may start after this function returns
+    auto state = std::make_shared<internal::ParallelForState>(count, chunkSize, body);
+    const size_t helperCount = std::min(pool.getWorkerCount(), state->chunkCount - 1);
+    std::vector<TaskType> helpers;
+    helpers.reserve(helperCount);
+    for (size_t i = 0; i < helperCount; i++) {
+        helpers.emplace_back([state]() { state->runChunks(); });
+    }
+    pool.executeBatch(helpers);
+
+    state->runChunks();
+    state->wait();
+    if (state->failed.load(std::memory_order_relaxed)) {
+        std::rethrow_exception(state->exception);
+    }
+}
+
+template <typename TaskType>
+size_t ParallelFindFirst(ThreadPool<TaskType>& pool,
+                         size_t count,
+                         size_t chunkSize,
+                         FunctionRef<bool(size_t index)> predicate) {
+    std::atomic<size_t> found = count;
+    ParallelFor(pool, count, chunkSize, [&](size_t begin, size_t end) {
+        // Stop as soon as a match with a lower index is known
+        for (size_t i = begin; i < end && i < found.load(std::memory_order_relaxed); i++) {
+            if (predicate(i)) {
+                size_t current = found.load(std::memory_order_relaxed);
+                while (i < current && !found.compare_exchange_weak(current, i, std::memory_order_relaxed)) {
+                }
+                return;
+            }
+        }
+    });
+    return found.load(std::memory_order_relaxed);
+}
+
+}  // namespace edoren
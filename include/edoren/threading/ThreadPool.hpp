@@ -1,39 +1,303 @@
 #pragma once
 
 #include <edoren/util/Config.hpp>
-#include <edoren/Function.hpp>
+#include <edoren/UniqueFunction.hpp>
 #include <edoren/container/Vector.hpp>
+#include <edoren/threading/BoundedMPMCQueue.hpp>
+#include <edoren/threading/CpuTopology.hpp>
+#include <edoren/threading/Future.hpp>
+#include <edoren/threading/ParallelFor.hpp>
+#include <edoren/threading/WorkStealingDeque.hpp>
 
+#include <array>
 #include <atomic>
-#include <condition_variable>
+#include <chrono>
+#include <cstdint>
 #include <deque>
+#include <limits>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <set>
+#include <span>
 #include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace edoren {
 
-template <typename TaskType = Function<void()>>
+/**
+ * @brief Enum to specify how a ThreadPool distributes the tasks between its workers
+ */
+enum class SchedulingMode {
+    SHARED_QUEUE,   ///< All the tasks go through a single FIFO queue
+    WORK_STEALING,  ///< Each worker has its own deque, idle workers steal from the others
+};
+
+/**
+ * @brief Enum to specify the queue that stores the tasks executed from outside the workers
+ */
+enum class QueueBackend {
+    MUTEX,      ///< Unbounded queue protected by a mutex
+    LOCK_FREE,  ///< Bounded lock-free queue, when it is full the tasks go to the mutex protected one until it drains
+};
+
+/**
+ * @brief Enum to specify where the worker threads of a ThreadPool run
+ */
+enum class WorkerAffinity {
+    NONE,          ///< The workers can run in any CPU
+    PIN_TO_CORES,  ///< Each worker is pinned to a CPU and the workers are grouped by NUMA node
+};
+
+/**
+ * @brief Enum to specify the priority class of a task
+ */
+enum class TaskPriority {
+    HIGH,    ///< Latency critical tasks, they run before any other
+    NORMAL,  ///< Default priority
+    LOW,     ///< Background tasks, they run when there is nothing else to do
+};
+
+/**
+ * @brief Pool of threads that execute tasks
+ *
+ * In @ref SchedulingMode::WORK_STEALING mode the tasks executed from outside
+ * the pool go to a global injection queue, while the tasks executed from one
+ * of the workers are pushed to the worker's own deque without taking any lock.
+ * Each worker runs its local tasks in LIFO order to reuse the data that is
+ * still in the cache, and when it runs out of work it takes tasks from the
+ * global queue or steals the oldest tasks of a random worker.
+ *
+ * The workers take a share of the global queue in each dequeue, so they do
+ * not go back to the shared queue for every task. The extra tasks are kept
+ * in the worker's deque, where the idle workers can steal them in both
+ * scheduling modes.
+ *
+ * With @ref WorkerAffinity::PIN_TO_CORES the workers are spread across the
+ * NUMA nodes (see GetNumaNodes) in proportion to the CPUs of each node, and
+ * pinned to one of the CPUs of their node.
+ * Each node has its own queue: the tasks executed from a worker or from a
+ * thread running in the node go to that queue, and the workers look for
+ * tasks in their own node, stealing from the workers of the same node
+ * first, before taking them from the other nodes.
+ *
+ * Tasks can be executed with a @ref TaskPriority and a deadline. They are kept
+ * in a separate queue per priority class, ordered by earliest deadline first
+ * (tasks without deadline go after, in FIFO order). To avoid starvation, the
+ * oldest task of a class is promoted one class for each aging interval it
+ * waits, and it runs before the newer tasks of its new class. Tasks executed
+ * without priority skip all of this and take the same path as before, but
+ * they age too: when a worker has preferred the prioritized tasks over them
+ * for an aging interval, one of them runs before the next prioritized task.
+ *
+ * @tparam TaskType The type of the tasks, it must be callable without arguments
+ */
+template <typename TaskType = UniqueFunction<void()>>
 class ThreadPool {
 public:
     enum class Status { RUNNING, STOPPING, STOPPED };
 
     using Task = TaskType;
 
-    ThreadPool(size_t num_threads);
+    /**
+     * @brief Constructor
+     *
+     * @param num_threads Number of worker threads to create
+     * @param mode How the tasks are distributed between the workers. See @ref SchedulingMode.
+     * @param backend The queue used for the tasks executed from outside the workers. See @ref QueueBackend.
+     * @param queue_capacity Capacity of the lock-free queue, only used with @ref QueueBackend::LOCK_FREE
+     * @param affinity Where the workers run. See @ref WorkerAffinity.
+     */
+    ThreadPool(size_t num_threads,
+               SchedulingMode mode = SchedulingMode::SHARED_QUEUE,
+               QueueBackend backend = QueueBackend::MUTEX,
+               size_t queue_capacity = 1024,
+               WorkerAffinity affinity = WorkerAffinity::NONE);
 
+    /**
+     * @brief Destructor
+     *
+     * Stops the workers after their current task, the pending tasks are discarded.
+     */
     ~ThreadPool();
 
+    /**
+     * @brief Execute a task in one of the workers
+     *
+     * @param f The task to execute
+     */
     void execute(Task&& f);
 
+    /**
+     * @brief Execute a task with a priority in one of the workers
+     *
+     * @param f The task to execute
+     * @param priority The priority class of the task. See @ref TaskPriority.
+     */
+    void execute(Task&& f, TaskPriority priority);
+
+    /**
+     * @brief Execute a task with a priority and a deadline in one of the workers
+     *
+     * Inside each priority class the task with the earliest deadline runs first.
+     *
+     * @param f The task to execute
+     * @param priority The priority class of the task. See @ref TaskPriority.
+     * @param deadline The time before which the task should run
+     */
+    void execute(Task&& f, TaskPriority priority, std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * @brief Execute several tasks in the workers
+     *
+     * All the tasks are queued at once and the sleeping workers are woken up
+     * a single time, which is cheaper than calling execute for each task.
+     *
+     * @param tasks The tasks to execute, they are moved from
+     */
+    void executeBatch(std::span<Task> tasks);
+
+    /**
+     * @brief Execute a callable in one of the workers and get its result
+     *
+     * The callable is wrapped in a task that fulfills a Promise, so the Task
+     * type must accept move-only callables (like the default UniqueFunction).
+     * If the pool is stopped the task is discarded and the future receives a
+     * broken promise error.
+     *
+     * @param f The callable to execute, it's called without arguments
+     * @return A future that receives the result or the exception of the callable
+     */
+    template <typename Func>
+    auto submit(Func&& f) -> Future<std::invoke_result_t<std::decay_t<Func>&>>;
+
+    /**
+     * @brief Set the time after which a waiting prioritized task is promoted to the next class
+     *
+     * @param interval The aging interval, zero disables the aging. The default is 100 ms.
+     */
+    void setAgingInterval(std::chrono::steady_clock::duration interval);
+
+    /**
+     * @brief Get the number of worker threads
+     *
+     * @return The number of workers
+     */
+    size_t getWorkerCount() const;
+
+    /**
+     * @brief Wait until all the pending tasks are executed and stop the workers
+     */
     void joinAndStop();
 
 private:
+    // Storage of a task in the deque of a worker, the slots are reused so pushing a task does not allocate
+    struct TaskSlot {
+        Task task;
+        TaskSlot* next;  ///< Next slot in the free list
+    };
+
+    struct Worker {
+        Worker(ThreadPool* pool, uint64_t seed, size_t node, int32_t cpu);
+
+        ThreadPool* pool;                    ///< The pool that owns the worker
+        WorkStealingDeque<TaskSlot*> tasks;  ///< Tasks executed from this worker and taken from the global queue
+        uint64_t randomState;                ///< State used to choose the victims to steal from
+        size_t node;                         ///< Index of the queue of the worker's NUMA node
+        int32_t cpu;                         ///< CPU where the worker is pinned, -1 if it's not pinned
+        std::chrono::steady_clock::rep normalWaitStart;  ///< Since when the local tasks wait for prioritized ones
+        Vector<std::unique_ptr<TaskSlot[]>> slotChunks;    ///< Storage of all the slots of the worker
+        TaskSlot* freeSlots;                               ///< Free slots, only used by the owner
+        alignas(64) std::atomic<TaskSlot*> stolenSlots;  ///< Free slots given back by the thieves
+    };
+
+    // Queue for the tasks executed from outside the workers, there is one per NUMA node
+    struct alignas(64) TaskQueue {
+        std::deque<Task> tasks;
+        std::atomic<size_t> size;                          ///< Size of tasks, to check it without locking
+        std::unique_ptr<BoundedMPMCQueue<Task>> lockFree;  ///< Only used with QueueBackend::LOCK_FREE
+        std::mutex mutex;
+        size_t workerCount;                                ///< Number of workers of the node
+    };
+
+    struct PrioritizedTask {
+        std::chrono::steady_clock::time_point deadline;     ///< Time point max if the task has no deadline
+        std::chrono::steady_clock::time_point enqueueTime;  ///< Used for the aging
+        Task task;
+    };
+
+    // Tasks of a priority class, indexed both by age and by deadline
+    struct PriorityClass {
+        using DeadlineKey = std::pair<std::chrono::steady_clock::time_point, uint64_t>;
+
+        std::map<uint64_t, PrioritizedTask> tasks;  ///< By sequence, the first one is the oldest
+        std::set<DeadlineKey> deadlines;            ///< Earliest deadline first, the FIFO order breaks the ties
+        std::atomic<size_t> count{0};               ///< Size of tasks, to check it without locking
+        std::atomic<std::chrono::steady_clock::rep> oldestEnqueueTime{0};  ///< Enqueue time of the oldest task
+    };
+
+    static constexpr size_t sMaxBatchSize = 16;
+    static constexpr size_t sSlotChunkSize = 64;
+    static constexpr size_t sPriorityCount = 3;
+    static constexpr size_t sWakeAll = std::numeric_limits<size_t>::max();
+    static constexpr size_t sNoQueue = std::numeric_limits<size_t>::max();
+    static constexpr std::chrono::steady_clock::rep sNotWaiting = std::numeric_limits<std::chrono::steady_clock::rep>::max();
+
+    void run(Worker& worker);
+
+    bool findTask(Worker& worker, Task& task);
+
+    bool isAccepting(bool fromWorker) const;
+
+    void executePrioritized(Task&& f, TaskPriority priority, std::chrono::steady_clock::time_point deadline);
+
+    bool takePrioritizedTask(Task& task, TaskPriority maxPriority);
+
+    bool hasEligiblePrioritizedTask(TaskPriority maxPriority) const;
+
+    static void UpdatePriorityClassState(PriorityClass& priorityClass);
+
+    bool hasLocalTasks(Worker& worker) const;
+
+    bool isLocalTaskStarving(Worker& worker);
+
+    size_t selectQueue(Worker* current);
+
+    bool takeGlobalTasks(Worker& worker, Task& task, bool remote);
+
+    bool takeQueueTasks(TaskQueue& queue, Worker& worker, Task& task);
+
+    bool steal(Worker& worker, Task& task, bool remote);
+
+    static TaskSlot* AcquireSlot(Worker& worker);
+
+    static void ReleaseSlot(Worker& owner, TaskSlot* slot, bool fromOwner);
+
+    bool hasPendingTasks() const;
+
+    void wakeWorkers(size_t count);
+
+    static inline thread_local Worker* sCurrentWorker = nullptr;  ///< Worker running in the current thread
+
+    SchedulingMode m_mode;
     std::atomic<Status> m_status;
-    std::deque<Task> m_work_queue;
+
+    Vector<std::unique_ptr<TaskQueue>> m_queues;  ///< One queue per NUMA node, a single one without affinity
+    Vector<size_t> m_cpu_queues;                  ///< Index of the queue for each CPU, only with affinity
+    std::atomic<size_t> m_next_queue;             ///< Used to distribute the tasks of unknown CPUs
+
+    std::array<PriorityClass, sPriorityCount> m_prioritized_tasks;
+    std::atomic<size_t> m_prioritized_count;                       ///< Tasks in m_prioritized_tasks
+    uint64_t m_prioritized_sequence;                               ///< Sequence of the next task
+    std::atomic<std::chrono::steady_clock::rep> m_aging_interval;  ///< Aging interval in ticks
+    std::mutex m_prioritized_mutex;
+
+    Vector<std::unique_ptr<Worker>> m_worker_data;
     Vector<std::thread> m_workers;
-    std::condition_variable m_signaler;
-    std::mutex m_queue_mutex;
+    std::atomic<uint32_t> m_wake_epoch;        ///< Incremented to wake the sleeping workers
+    std::atomic<uint32_t> m_sleeping_workers;  ///< Number of workers waiting for tasks
 };
 
 }  // namespace edoren
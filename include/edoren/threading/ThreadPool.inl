@@ -1,65 +1,566 @@
 #pragma once
 
+#include <algorithm>
 #include <mutex>
 #include <thread>
+#include <utility>
 
 namespace edoren {
 
 template <typename TaskType>
-ThreadPool<TaskType>::ThreadPool(size_t num_threads) : m_status(Status::RUNNING) {
-    auto job = [this]() -> void {
-        while (true) {
-            std::unique_lock<std::mutex> lk(m_queue_mutex);
-            if (m_status == Status::STOPPED) {
-                break;
-            }
-            if (m_work_queue.empty()) {
-                m_signaler.wait(lk);
-            }
-            if (m_status == Status::STOPPED) {
-                break;
+ThreadPool<TaskType>::Worker::Worker(ThreadPool* pool, uint64_t seed, size_t node, int32_t cpu)
+      : pool(pool),
+        tasks(),
+        randomState(seed),
+        node(node),
+        cpu(cpu),
+        normalWaitStart(sNotWaiting),
+        freeSlots(nullptr),
+        stolenSlots(nullptr) {}
+
+template <typename TaskType>
+ThreadPool<TaskType>::ThreadPool(size_t num_threads,
+                                 SchedulingMode mode,
+                                 QueueBackend backend,
+                                 size_t queue_capacity,
+                                 WorkerAffinity affinity)
+      : m_mode(mode),
+        m_status(Status::RUNNING),
+        m_next_queue(0),
+        m_prioritized_count(0),
+        m_prioritized_sequence(0),
+        m_aging_interval(std::chrono::steady_clock::duration(std::chrono::milliseconds(100)).count()),
+        m_wake_epoch(0),
+        m_sleeping_workers(0) {
+    Vector<NumaNode> nodes;
+    if (affinity == WorkerAffinity::PIN_TO_CORES) {
+        nodes = GetNumaNodes();
+        // Do not create queues for the nodes without workers
+        nodes.resize(std::min(nodes.size(), std::max<size_t>(num_threads, 1)));
+    }
+
+    const size_t queueCount = std::max<size_t>(nodes.size(), 1);
+    m_queues.reserve(queueCount);
+    for (size_t i = 0; i < queueCount; i++) {
+        auto queue = std::make_unique<TaskQueue>();
+        queue->size = 0;
+        queue->workerCount = 0;
+        if (backend == QueueBackend::LOCK_FREE) {
+            queue->lockFree = std::make_unique<BoundedMPMCQueue<Task>>(queue_capacity);
+        }
+        m_queues.push_back(std::move(queue));
+    }
+    for (size_t node = 0; node < nodes.size(); node++) {
+        for (uint32_t cpu : nodes[node].cpus) {
+            if (cpu >= m_cpu_queues.size()) {
+                m_cpu_queues.resize(cpu + 1, sNoQueue);
             }
-            if (!m_work_queue.empty()) {
-                Task task = std::move(m_work_queue.front());
-                m_work_queue.pop_front();
-                if (m_status == Status::STOPPING && m_work_queue.empty()) {
-                    m_status = Status::STOPPED;
+            m_cpu_queues[cpu] = node;
+        }
+    }
+
+    m_worker_data.reserve(num_threads);
+    for (decltype(num_threads) i = 0; i < num_threads; i++) {
+        // The workers are distributed between the nodes in proportion to their CPUs, each worker goes to
+        // the node with fewest workers per CPU, and between the CPUs inside each node
+        size_t node = 0;
+        int32_t cpu = -1;
+        if (!nodes.empty()) {
+            for (size_t other = 1; other < nodes.size(); other++) {
+                if (m_queues[other]->workerCount * nodes[node].cpus.size() <
+                    m_queues[node]->workerCount * nodes[other].cpus.size()) {
+                    node = other;
                 }
-                lk.unlock();
-                task();
             }
+            const Vector<uint32_t>& cpus = nodes[node].cpus;
+            cpu = static_cast<int32_t>(cpus[m_queues[node]->workerCount % cpus.size()]);
         }
-    };
+        m_queues[node]->workerCount++;
+        // Different non-zero seeds for the xorshift generator of each worker
+        m_worker_data.emplace_back(std::make_unique<Worker>(this, (i + 1) * 0x9E3779B97F4A7C15ull, node, cpu));
+    }
     m_workers.reserve(num_threads);
-    for (decltype(num_threads) i = 0; i < num_threads; i++) {
-        m_workers.emplace_back(job);
+    for (auto& worker : m_worker_data) {
+        m_workers.emplace_back([this, worker = worker.get()]() { run(*worker); });
     }
 }
 
 template <typename TaskType>
 ThreadPool<TaskType>::~ThreadPool() {
     m_status = Status::STOPPED;
-    m_signaler.notify_all();
+    wakeWorkers(sWakeAll);
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    // The tasks that were not executed are destroyed with the slots of the workers
 }
 
 template <typename TaskType>
 void ThreadPool<TaskType>::execute(Task&& f) {
-    if (m_status == Status::RUNNING) {
-        std::lock_guard<std::mutex> lk(m_queue_mutex);
-        m_work_queue.push_back(std::move(f));
-        m_signaler.notify_one();
+    executeBatch(std::span<Task>(&f, 1));
+}
+
+template <typename TaskType>
+void ThreadPool<TaskType>::execute(Task&& f, TaskPriority priority) {
+    if (priority == TaskPriority::NORMAL) {
+        execute(std::move(f));
+    } else {
+        executePrioritized(std::move(f), priority, std::chrono::steady_clock::time_point::max());
     }
 }
 
+template <typename TaskType>
+void ThreadPool<TaskType>::execute(Task&& f, TaskPriority priority, std::chrono::steady_clock::time_point deadline) {
+    executePrioritized(std::move(f), priority, deadline);
+}
+
+template <typename TaskType>
+void ThreadPool<TaskType>::executeBatch(std::span<Task> tasks) {
+    Worker* current = sCurrentWorker;
+    const bool fromWorker = current != nullptr && current->pool == this;
+    if (tasks.empty() || !isAccepting(fromWorker)) {
+        return;
+    }
+    if (fromWorker && m_mode == SchedulingMode::WORK_STEALING) {
+        for (Task& task : tasks) {
+            TaskSlot* slot = AcquireSlot(*current);
+            slot->task = std::move(task);
+            current->tasks.push(slot);
+        }
+    } else {
+        TaskQueue& queue = *m_queues[selectQueue(fromWorker ? current : nullptr)];
+        size_t i = 0;
+        // While older tasks wait in the overflow queue the new ones go after them, otherwise the
+        // workers could keep taking the newer tasks from the ring and never reach the overflow
+        if (queue.lockFree && queue.size.load(std::memory_order_relaxed) == 0) {
+            while (i < tasks.size() && queue.lockFree->tryPush(std::move(tasks[i]))) {
+                i++;
+            }
+        }
+        if (i < tasks.size()) {
+            std::lock_guard<std::mutex> lk(queue.mutex);
+            for (; i < tasks.size(); i++) {
+                queue.tasks.push_back(std::move(tasks[i]));
+            }
+            queue.size.store(queue.tasks.size(), std::memory_order_relaxed);
+        }
+    }
+    wakeWorkers(tasks.size());
+}
+
+template <typename TaskType>
+template <typename Func>
+auto ThreadPool<TaskType>::submit(Func&& f) -> Future<std::invoke_result_t<std::decay_t<Func>&>> {
+    using ResultType = std::invoke_result_t<std::decay_t<Func>&>;
+    Promise<ResultType> promise;
+    Future<ResultType> future = promise.getFuture();
+    execute(Task([promise = std::move(promise), f = std::decay_t<Func>(std::forward<Func>(f))]() mutable {
+        internal::FulfillPromise(promise, f);
+    }));
+    return future;
+}
+
+template <typename TaskType>
+void ThreadPool<TaskType>::setAgingInterval(std::chrono::steady_clock::duration interval) {
+    m_aging_interval.store(interval.count(), std::memory_order_relaxed);
+}
+
+template <typename TaskType>
+size_t ThreadPool<TaskType>::getWorkerCount() const {
+    return m_workers.size();
+}
+
 template <typename TaskType>
 void ThreadPool<TaskType>::joinAndStop() {
-    {
-        std::lock_guard<std::mutex> lk(m_queue_mutex);
-        m_status = m_work_queue.empty() ? Status::STOPPED : Status::STOPPING;
-        m_signaler.notify_all();
+    if (m_status == Status::RUNNING) {
+        m_status = Status::STOPPING;
     }
+    wakeWorkers(sWakeAll);
     for (auto& worker : m_workers) {
-        worker.join();
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    m_status = Status::STOPPED;
+}
+
+template <typename TaskType>
+void ThreadPool<TaskType>::run(Worker& worker) {
+    sCurrentWorker = &worker;
+    if (worker.cpu >= 0) {
+        SetCurrentThreadAffinity(static_cast<uint32_t>(worker.cpu));
+    }
+    Task task;
+    while (m_status != Status::STOPPED) {
+        const uint32_t epoch = m_wake_epoch.load(std::memory_order_acquire);
+        if (findTask(worker, task)) {
+            task();
+            task = Task();
+            continue;
+        }
+        if (m_status != Status::RUNNING) {
+            // Stopping and there is no work left
+            break;
+        }
+        // Announce that the worker is going to sleep and check again for tasks, the producers check
+        // the number of sleeping workers after publishing a task, so one of both sides sees the other
+        m_sleeping_workers.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!hasPendingTasks() && m_status == Status::RUNNING) {
+            m_wake_epoch.wait(epoch, std::memory_order_acquire);
+        }
+        m_sleeping_workers.fetch_sub(1, std::memory_order_relaxed);
+    }
+    sCurrentWorker = nullptr;
+}
+
+template <typename TaskType>
+bool ThreadPool<TaskType>::findTask(Worker& worker, Task& task) {
+    // High priority tasks, normal ones with a deadline and the ones promoted by the aging. They go
+    // before the local tasks so they do not wait behind the bulk tasks already taken by each worker
+    if (m_prioritized_count.load(std::memory_order_relaxed) > 0 && !isLocalTaskStarving(worker) &&
+        takePrioritizedTask(task, TaskPriority::NORMAL)) {
+        return true;
+    }
+    worker.normalWaitStart = sNotWaiting;
+
+    // Newest local task first, its data is probably still in the cache
+    if (std::optional<TaskSlot*> local = worker.tasks.pop()) {
+        task = std::move((*local)->task);
+        ReleaseSlot(worker, *local, true);
+        return true;
+    }
+
+    // The node of the worker first, then the other nodes. The deques are also used in SHARED_QUEUE
+    // mode for the extra tasks taken from the global queue, so they are always stolen from
+    return takeGlobalTasks(worker, task, false) || steal(worker, task, false) || takeGlobalTasks(worker, task, true) ||
+           steal(worker, task, true) || takePrioritizedTask(task, TaskPriority::LOW);
+}
+
+template <typename TaskType>
+bool ThreadPool<TaskType>::isAccepting(bool fromWorker) const {
+    // The workers can still create subtasks while the pool is stopping, they run before it stops
+    const Status status = m_status;
+    return status == Status::RUNNING || (status == Status::STOPPING && fromWorker);
+}
+
+template <typename TaskType>
+void ThreadPool<TaskType>::executePrioritized(Task&& f,
+                                              TaskPriority priority,
+                                              std::chrono::steady_clock::time_point deadline) {
+    Worker* current = sCurrentWorker;
+    if (!isAccepting(current != nullptr && current->pool == this)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lk(m_prioritized_mutex);
+        PriorityClass& priorityClass = m_prioritized_tasks[static_cast<size_t>(priority)];
+        const uint64_t sequence = m_prioritized_sequence++;
+        priorityClass.tasks.emplace(sequence,
+                                    PrioritizedTask{deadline, std::chrono::steady_clock::now(), std::move(f)});
+        priorityClass.deadlines.emplace(deadline, sequence);
+        UpdatePriorityClassState(priorityClass);
+        m_prioritized_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    wakeWorkers(1);
+}
+
+template <typename TaskType>
+bool ThreadPool<TaskType>::takePrioritizedTask(Task& task, TaskPriority maxPriority) {
+    // Single load in the common case where no prioritized task was executed
+    if (m_prioritized_count.load(std::memory_order_relaxed) == 0 || !hasEligiblePrioritizedTask(maxPriority)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lk(m_prioritized_mutex);
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::steady_clock::rep agingInterval = m_aging_interval.load(std::memory_order_relaxed);
+    PriorityClass* best = nullptr;
+    size_t bestPriority = static_cast<size_t>(maxPriority) + 1;
+    uint64_t bestSequence = 0;
+    bool bestAged = false;
+    for (size_t priority = 0; priority < sPriorityCount; priority++) {
+        PriorityClass& priorityClass = m_prioritized_tasks[priority];
+        if (priorityClass.tasks.empty()) {
+            continue;
+        }
+        // Promote the oldest task one class for each aging interval it has been waiting
+        const auto& [oldestSequence, oldest] = *priorityClass.tasks.begin();
+        size_t effectivePriority = priority;
+        if (agingInterval > 0) {
+            const auto age = now - oldest.enqueueTime;
+            effectivePriority -= std::min(priority, static_cast<size_t>(age.count() / agingInterval));
+        }
+        // On the same effective priority the class with the oldest task wins, so a promoted task is
+        // not overtaken forever by the new tasks of its new class
+        if (effectivePriority < bestPriority ||
+            (best != nullptr && effectivePriority == bestPriority && oldestSequence < bestSequence)) {
+            best = &priorityClass;
+            bestPriority = effectivePriority;
+            bestSequence = oldestSequence;
+            bestAged = effectivePriority < priority;
+        }
+    }
+    if (best == nullptr) {
+        return false;
+    }
+
+    // The class won because of the oldest task, so that one runs instead of the earliest deadline
+    auto it = best->tasks.begin();
+    if (bestAged) {
+        best->deadlines.erase({it->second.deadline, it->first});
+    } else {
+        it = best->tasks.find(best->deadlines.begin()->second);
+        best->deadlines.erase(best->deadlines.begin());
+    }
+    task = std::move(it->second.task);
+    best->tasks.erase(it);
+    UpdatePriorityClassState(*best);
+    m_prioritized_count.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+template <typename TaskType>
+bool ThreadPool<TaskType>::hasEligiblePrioritizedTask(TaskPriority maxPriority) const {
+    // Checked without the lock, so the workers only take it when a task can be chosen. The clock is
+    // only read when a class above maxPriority has tasks that could have been promoted
+    const size_t maxIndex = static_cast<size_t>(maxPriority);
+    const std::chrono::steady_clock::rep agingInterval = m_aging_interval.load(std::memory_order_relaxed);
+    std::chrono::steady_clock::rep now = 0;
+    for (size_t priority = 0; priority < sPriorityCount; priority++) {
+        const PriorityClass& priorityClass = m_prioritized_tasks[priority];
+        if (priorityClass.count.load(std::memory_order_relaxed) == 0) {
+            continue;
+        }
+        if (priority <= maxIndex) {
+            return true;
+        }
+        if (agingInterval <= 0) {
+            return false;
+        }
+        if (now == 0) {
+            now = std::chrono::steady_clock::now().time_since_epoch().count();
+        }
+        const auto age = now - priorityClass.oldestEnqueueTime.load(std::memory_order_relaxed);
+        if (age >= 0 && static_cast<size_t>(age / agingInterval) >= priority - maxIndex) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename TaskType>
+void ThreadPool<TaskType>::UpdatePriorityClassState(PriorityClass& priorityClass) {
+    // Called with m_prioritized_mutex locked, after each change of the class
+    priorityClass.count.store(priorityClass.tasks.size(), std::memory_order_relaxed);
+    if (!priorityClass.tasks.empty()) {
+        priorityClass.oldestEnqueueTime.store(
+            priorityClass.tasks.begin()->second.enqueueTime.time_since_epoch().count(), std::memory_order_relaxed);
+    }
+}
+
+template <typename TaskType>
+bool ThreadPool<TaskType>::hasLocalTasks(Worker& worker) const {
+    const TaskQueue& queue = *m_queues[worker.node];
+    return !worker.tasks.isEmpty() || queue.size.load(std::memory_order_relaxed) > 0 ||
+           (queue.lockFree && queue.lockFree->getSize() > 0);
+}
+
+template <typename TaskType>
+bool ThreadPool<TaskType>::isLocalTaskStarving(Worker& worker) {
+    // The tasks without priority do not keep their enqueue time, so the worker measures how long it
+    // has been choosing prioritized tasks while there were other tasks waiting for it
+    if (!hasLocalTasks(worker)) {
+        worker.normalWaitStart = sNotWaiting;
+        return false;
+    }
+    const std::chrono::steady_clock::rep now = std::chrono::steady_clock::now().time_since_epoch().count();
+    if (worker.normalWaitStart == sNotWaiting) {
+        worker.normalWaitStart = now;
+        return false;
+    }
+    // Promoted to the high priority class after waiting an aging interval, and older than the new tasks
+    const std::chrono::steady_clock::rep agingInterval = m_aging_interval.load(std::memory_order_relaxed);
+    return agingInterval > 0 && now - worker.normalWaitStart >= agingInterval;
+}
+
+template <typename TaskType>
+size_t ThreadPool<TaskType>::selectQueue(Worker* current) {
+    if (m_queues.size() == 1) {
+        return 0;
+    }
+    if (current != nullptr) {
+        return current->node;
+    }
+    // Use the queue of the node where the calling thread is running
+    const int32_t cpu = GetCurrentCpu();
+    if (cpu >= 0 && static_cast<size_t>(cpu) < m_cpu_queues.size() && m_cpu_queues[cpu] != sNoQueue) {
+        return m_cpu_queues[cpu];
+    }
+    return m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+}
+
+template <typename TaskType>
+bool ThreadPool<TaskType>::takeGlobalTasks(Worker& worker, Task& task, bool remote) {
+    if (!remote) {
+        return takeQueueTasks(*m_queues[worker.node], worker, task);
+    }
+    for (size_t i = 1; i < m_queues.size(); i++) {
+        if (takeQueueTasks(*m_queues[(worker.node + i) % m_queues.size()], worker, task)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename TaskType>
+bool ThreadPool<TaskType>::takeQueueTasks(TaskQueue& queue, Worker& worker, Task& task) {
+    const size_t lockFreeSize = queue.lockFree ? queue.lockFree->getSize() : 0;
+    const size_t queued = lockFreeSize + queue.size.load(std::memory_order_relaxed);
+    if (queued == 0) {
+        return false;
+    }
+
+    // Take a fair share of the queued tasks, leaving the rest for the other workers of the node
+    const size_t maxExtra = std::min(queued / std::max<size_t>(queue.workerCount, 1), sMaxBatchSize - 1);
+    std::array<Task, sMaxBatchSize - 1> extras;
+    size_t extraCount = 0;
+    bool found = false;
+    if (queue.lockFree) {
+        found = queue.lockFree->tryPop(task);
+        while (found && extraCount < maxExtra && queue.lockFree->tryPop(extras[extraCount])) {
+            extraCount++;
+        }
+    }
+
+    if ((!found || extraCount < maxExtra) && queue.size.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lk(queue.mutex);
+        if (!found && !queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            found = true;
+        }
+        for (; found && extraCount < maxExtra && !queue.tasks.empty(); extraCount++) {
+            extras[extraCount] = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        queue.size.store(queue.tasks.size(), std::memory_order_relaxed);
+    }
+
+    if (extraCount > 0) {
+        // The extra tasks go to the deque of the worker so the idle workers can steal them. They are
+        // pushed in reverse because the owner pops the newest first, so it runs them in FIFO order
+        for (size_t i = extraCount; i > 0; i--) {
+            TaskSlot* slot = AcquireSlot(worker);
+            slot->task = std::move(extras[i - 1]);
+            worker.tasks.push(slot);
+        }
+        wakeWorkers(extraCount);
+    }
+    return found;
+}
+
+template <typename TaskType>
+bool ThreadPool<TaskType>::steal(Worker& worker, Task& task, bool remote) {
+    const size_t count = m_worker_data.size();
+    if (count < 2 || (remote && m_queues.size() == 1)) {
+        return false;
+    }
+
+    // Start from a random victim so the thieves do not all fight for the same deque
+    uint64_t random = worker.randomState;
+    random ^= random << 13;
+    random ^= random >> 7;
+    random ^= random << 17;
+    worker.randomState = random;
+
+    const size_t start = static_cast<size_t>(random % count);
+    for (size_t i = 0; i < count; i++) {
+        Worker& victim = *m_worker_data[(start + i) % count];
+        // The workers of the same node share the caches, so they are tried first
+        if (&victim == &worker || (victim.node != worker.node) != remote) {
+            continue;
+        }
+        if (std::optional<TaskSlot*> stolen = victim.tasks.steal()) {
+            task = std::move((*stolen)->task);
+            ReleaseSlot(victim, *stolen, false);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename TaskType>
+typename ThreadPool<TaskType>::TaskSlot* ThreadPool<TaskType>::AcquireSlot(Worker& worker) {
+    if (worker.freeSlots == nullptr) {
+        // Take back all the slots released by the thieves at once, only the owner removes from that list
+        worker.freeSlots = worker.stolenSlots.exchange(nullptr, std::memory_order_acquire);
+    }
+    if (worker.freeSlots == nullptr) {
+        auto chunk = std::make_unique<TaskSlot[]>(sSlotChunkSize);
+        for (size_t i = 0; i < sSlotChunkSize; i++) {
+            chunk[i].next = i + 1 < sSlotChunkSize ? &chunk[i + 1] : nullptr;
+        }
+        worker.freeSlots = chunk.get();
+        worker.slotChunks.push_back(std::move(chunk));
+    }
+    TaskSlot* slot = worker.freeSlots;
+    worker.freeSlots = slot->next;
+    return slot;
+}
+
+template <typename TaskType>
+void ThreadPool<TaskType>::ReleaseSlot(Worker& owner, TaskSlot* slot, bool fromOwner) {
+    // The task was moved out, but reset it anyway in case the Task type copies on move
+    slot->task = Task();
+    if (fromOwner) {
+        slot->next = owner.freeSlots;
+        owner.freeSlots = slot;
+        return;
+    }
+    // Several thieves can push at the same time, the owner takes the whole list so there is no ABA
+    TaskSlot* head = owner.stolenSlots.load(std::memory_order_relaxed);
+    do {
+        slot->next = head;
+    } while (!owner.stolenSlots.compare_exchange_weak(head, slot, std::memory_order_release,
+                                                      std::memory_order_relaxed));
+}
+
+template <typename TaskType>
+bool ThreadPool<TaskType>::hasPendingTasks() const {
+    if (m_prioritized_count.load(std::memory_order_relaxed) > 0) {
+        return true;
+    }
+    for (const auto& queue : m_queues) {
+        if (queue->size.load(std::memory_order_relaxed) > 0 || (queue->lockFree && queue->lockFree->getSize() > 0)) {
+            return true;
+        }
+    }
+    for (const auto& worker : m_worker_data) {
+        if (!worker->tasks.isEmpty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename TaskType>
+void ThreadPool<TaskType>::wakeWorkers(size_t count) {
+    // Pairs with the fence of the workers going to sleep, see ThreadPool::run
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const uint32_t sleeping = m_sleeping_workers.load(std::memory_order_relaxed);
+    if (count != sWakeAll && sleeping == 0) {
+        return;
+    }
+    m_wake_epoch.fetch_add(1, std::memory_order_release);
+    if (count >= sleeping) {
+        m_wake_epoch.notify_all();
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            m_wake_epoch.notify_one();
+        }
     }
 }
 
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include <edoren/util/Config.hpp>
+#include <edoren/util/NonCopyable.hpp>
+
+namespace edoren {
+
+/**
+ * @brief Lock-free work-stealing deque (Chase-Lev)
+ *
+ * A single owner thread pushes and pops elements from the bottom of the
+ * deque (LIFO), while any other thread can steal elements from the top
+ * (FIFO). The storage grows when needed, the old buffers are kept alive
+ * until the deque is destroyed because a thief may still be reading them.
+ *
+ * Based on "Correct and Efficient Work-Stealing for Weak Memory Models"
+ * (Lê, Pop, Cohen, Zappa Nardelli, 2013).
+ *
+ * @tparam T Type of the elements, it must be trivially copyable (e.g. a pointer)
+ */
+template <typename T>
+class WorkStealingDeque : NonCopyable {
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque elements must be trivially copyable");
+
+public:
+    /**
+     * @brief Constructor
+     *
+     * @param capacity Initial capacity, it's rounded up to a power of two
+     */
+    explicit WorkStealingDeque(size_t capacity = 256);
+
+    /**
+     * @brief Push an element to the bottom of the deque
+     *
+     * @note Must only be called by the owner thread
+     *
+     * @param item The element to push
+     */
+    void push(T item);
+
+    /**
+     * @brief Pop the element at the bottom of the deque
+     *
+     * @note Must only be called by the owner thread
+     *
+     * @return The last pushed element, or an empty optional if the deque is empty
+     */
+    std::optional<T> pop();
+
+    /**
+     * @brief Steal the element at the top of the deque
+     *
+     * It can be called from any thread.
+     *
+     * @return The oldest element, or an empty optional if the deque is empty or
+     *         another thread took the element first
+     */
+    std::optional<T> steal();
+
+    /**
+     * @brief Check if the deque looks empty
+     *
+     * The result is only a hint since other threads may modify the deque
+     * at the same time.
+     *
+     * @return true if the deque has no elements
+     */
+    bool isEmpty() const;
+
+private:
+    struct Buffer {
+        explicit Buffer(int64_t capacity);
+
+        T get(int64_t index) const;
+
+        void put(int64_t index, T item);
+
+        int64_t capacity;
+        int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> data;
+    };
+
+    Buffer* grow(Buffer* buffer, int64_t bottom, int64_t top);
+
+    alignas(64) std::atomic<int64_t> m_top;          ///< Index of the oldest element, modified by the thieves
+    alignas(64) std::atomic<int64_t> m_bottom;       ///< Index after the newest element, modified by the owner
+    std::atomic<Buffer*> m_buffer;                   ///< The active buffer
+    std::vector<std::unique_ptr<Buffer>> m_buffers;  ///< All the buffers allocated, only used by the owner
+};
+
+}  // namespace edoren
+
+#include "WorkStealingDeque.inl"
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <bit>
+#include <utility>
+
+namespace edoren {
+
+template <typename T>
+WorkStealingDeque<T>::Buffer::Buffer(int64_t capacity)
+      : capacity(capacity),
+        mask(capacity - 1),
+        data(std::make_unique<std::atomic<T>[]>(static_cast<size_t>(capacity))) {}
+
+template <typename T>
+T WorkStealingDeque<T>::Buffer::get(int64_t index) const {
+    return data[index & mask].load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void WorkStealingDeque<T>::Buffer::put(int64_t index, T item) {
+    data[index & mask].store(item, std::memory_order_relaxed);
+}
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(size_t capacity) : m_top(0), m_bottom(0), m_buffer(nullptr) {
+    m_buffers.push_back(std::make_unique<Buffer>(static_cast<int64_t>(std::bit_ceil(capacity < 2 ? 2 : capacity))));
+    m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+}
+
+template <typename T>
+void WorkStealingDeque<T>::push(T item) {
+    int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+    int64_t top = m_top.load(std::memory_order_acquire);
+    Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+    if (bottom - top > buffer->capacity - 1) {
+        buffer = grow(buffer, bottom, top);
+    }
+    buffer->put(bottom, item);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+template <typename T>
+std::optional<T> WorkStealingDeque<T>::pop() {
+    int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = m_top.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+        // The deque was empty
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+    std::optional<T> item = buffer->get(bottom);
+    if (top == bottom) {
+        // Last element, compete with the thieves for it
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            item.reset();
+        }
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return item;
+}
+
+template <typename T>
+std::optional<T> WorkStealingDeque<T>::steal() {
+    int64_t top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom) {
+        return std::nullopt;
+    }
+
+    Buffer* buffer = m_buffer.load(std::memory_order_acquire);
+    T item = buffer->get(top);
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        // Lost the race against the owner or another thief
+        return std::nullopt;
+    }
+    return item;
+}
+
+template <typename T>
+bool WorkStealingDeque<T>::isEmpty() const {
+    int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+    int64_t top = m_top.load(std::memory_order_relaxed);
+    return top >= bottom;
+}
+
+template <typename T>
+typename WorkStealingDeque<T>::Buffer* WorkStealingDeque<T>::grow(Buffer* buffer, int64_t bottom, int64_t top) {
+    auto newBuffer = std::make_unique<Buffer>(buffer->capacity * 2);
+    for (int64_t i = top; i < bottom; i++) {
+        newBuffer->put(i, buffer->get(i));
+    }
+    Buffer* result = newBuffer.get();
+    m_buffers.push_back(std::move(newBuffer));
+    m_buffer.store(result, std::memory_order_release);
+    return result;
+}
+
+}  // namespace edoren
@@ -0,0 +1,1267 @@
+// Generated by tools/GenerateUnicodeTables.pl from the Unicode 14.0.0 database, do not edit.
+
+namespace edoren::unicode::internal {
+
+inline constexpr uint32_t sPropertyStage1Shift = 9;
+inline constexpr uint32_t sPropertyStage2Shift = 4;
+
+inline constexpr uint8_t sPropertyStage1[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    28, 26, 29, 30, 31, 32, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 33, 34, 34, 34, 34,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    56, 57, 58, 59, 59, 59, 59, 60, 56, 56, 61, 59, 59, 59, 59, 59,
+    59, 59, 56, 62, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 56, 63, 59, 64, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 65, 26, 26, 66, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 67, 68, 69, 59, 59, 59, 59, 70, 59,
+    59, 59, 59, 59, 59, 59, 59, 71, 72, 73, 74, 75, 76, 77, 59, 78,
+    79, 80, 59, 81, 82, 59, 83, 84, 85, 86, 87, 88, 89, 90, 59, 59,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 91, 26, 26, 26, 26, 26, 26, 26, 92, 93, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 94, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 95, 96, 96, 96, 96, 96, 96, 26, 97, 96, 98,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 99, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 98,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    100, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 101,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 101,
+};
+
+inline constexpr uint16_t sPropertyStage2[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 1, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 17, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    28, 28, 28, 30, 31, 32, 32, 33, 33, 34, 33, 35, 36, 37, 38, 39,
+    40, 40, 40, 40, 41, 40, 40, 42, 43, 44, 45, 46, 47, 48, 28, 49,
+    50, 51, 51, 52, 52, 32, 28, 28, 53, 28, 28, 28, 54, 28, 28, 28,
+    28, 28, 28, 55, 56, 57, 33, 33, 58, 59, 60, 61, 62, 63, 64, 65,
+    66, 67, 63, 63, 68, 69, 70, 71, 63, 63, 63, 63, 63, 72, 73, 74,
+    75, 76, 63, 77, 78, 63, 63, 63, 63, 63, 79, 80, 81, 63, 82, 83,
+    63, 84, 85, 86, 63, 87, 88, 63, 89, 90, 63, 63, 91, 92, 93, 77,
+    94, 63, 63, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 101, 102, 109, 110, 111, 112, 113, 114, 115, 102, 116, 117, 118, 106, 119,
+    120, 101, 102, 121, 122, 123, 106, 124, 125, 126, 127, 128, 129, 130, 112, 131,
+    132, 133, 102, 134, 135, 136, 106, 137, 138, 133, 102, 139, 140, 141, 106, 142,
+    143, 133, 63, 144, 145, 146, 106, 147, 148, 149, 63, 150, 151, 152, 112, 153,
+    154, 63, 63, 155, 156, 157, 158, 158, 159, 63, 160, 161, 162, 163, 158, 158,
+    164, 165, 166, 167, 168, 63, 169, 170, 171, 172, 77, 173, 174, 175, 158, 158,
+    63, 63, 176, 177, 178, 179, 180, 181, 182, 183, 56, 56, 184, 33, 33, 185,
+    186, 186, 186, 186, 186, 186, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 187, 188, 63, 63, 187, 63, 63, 189, 190, 191, 63, 63,
+    63, 190, 63, 63, 63, 192, 193, 194, 63, 195, 56, 56, 56, 56, 56, 196,
+    197, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 198, 63, 199, 200, 63, 63, 63, 63, 201, 202,
+    63, 203, 63, 204, 63, 205, 206, 207, 63, 63, 63, 208, 209, 210, 211, 212,
+    213, 211, 63, 63, 214, 63, 63, 215, 216, 63, 217, 63, 63, 63, 63, 218,
+    63, 219, 220, 221, 222, 63, 223, 224, 63, 63, 225, 63, 226, 227, 228, 228,
+    63, 229, 63, 63, 63, 230, 231, 232, 211, 211, 233, 234, 235, 158, 158, 158,
+    236, 63, 63, 237, 238, 178, 239, 240, 241, 63, 242, 81, 63, 63, 243, 244,
+    63, 63, 245, 246, 247, 81, 63, 248, 249, 56, 56, 250, 251, 252, 253, 254,
+    33, 33, 255, 35, 35, 35, 256, 257, 33, 258, 35, 35, 60, 60, 259, 260,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 261, 28, 28, 28, 28, 28, 28,
+    262, 263, 262, 262, 263, 264, 262, 265, 266, 266, 266, 267, 268, 269, 270, 271,
+    272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+    288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 311, 311, 311, 311,
+    316, 317, 318, 228, 228, 228, 228, 319, 228, 320, 311, 321, 228, 322, 323, 324,
+    228, 228, 325, 158, 326, 158, 327, 327, 327, 328, 329, 330, 331, 331, 332, 327,
+    329, 329, 329, 329, 333, 329, 329, 334, 329, 335, 336, 337, 338, 339, 340, 341,
+    342, 343, 228, 228, 344, 345, 346, 347, 228, 348, 349, 350, 351, 352, 353, 354,
+    355, 228, 356, 357, 358, 359, 360, 361, 362, 363, 228, 364, 365, 311, 366, 311,
+    228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+    311, 311, 311, 311, 311, 311, 311, 311, 367, 368, 311, 311, 311, 369, 311, 370,
+    311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311, 311,
+    228, 371, 228, 311, 372, 373, 228, 374, 228, 375, 228, 228, 228, 228, 228, 228,
+    56, 56, 56, 33, 33, 33, 376, 377, 28, 28, 28, 28, 28, 28, 378, 379,
+    33, 33, 380, 63, 63, 63, 381, 382, 63, 383, 384, 384, 384, 384, 77, 77,
+    385, 386, 387, 388, 389, 390, 158, 158, 391, 392, 391, 391, 391, 391, 391, 393,
+    391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 394, 158, 395,
+    396, 397, 398, 399, 400, 186, 186, 186, 186, 401, 402, 186, 186, 186, 186, 403,
+    404, 186, 186, 400, 186, 186, 186, 186, 405, 406, 186, 186, 391, 391, 393, 186,
+    391, 407, 408, 391, 409, 410, 391, 391, 408, 391, 391, 410, 391, 391, 391, 391,
+    391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 228, 228, 228, 228,
+    186, 411, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 412, 391, 391, 391, 413, 63, 63, 248,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    414, 63, 415, 158, 28, 28, 416, 417, 28, 418, 63, 63, 63, 63, 419, 420,
+    39, 421, 422, 423, 28, 28, 28, 424, 425, 426, 427, 428, 429, 430, 158, 431,
+    432, 63, 433, 434, 63, 63, 63, 435, 436, 63, 63, 437, 438, 211, 60, 439,
+    81, 63, 440, 63, 441, 442, 186, 412, 94, 63, 63, 443, 444, 445, 446, 447,
+    63, 63, 448, 449, 450, 451, 63, 452, 63, 63, 63, 453, 454, 455, 456, 457,
+    458, 459, 384, 33, 33, 460, 461, 33, 33, 33, 33, 33, 63, 63, 462, 211,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 463, 63, 464, 63, 63, 225,
+    465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465,
+    465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465, 465,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 467, 186, 186, 186, 186, 186, 186, 468, 469, 469,
+    470, 471, 472, 473, 474, 63, 63, 63, 63, 63, 63, 475, 476, 477, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 478, 228, 63, 63, 63, 63, 479, 63, 63, 480, 158, 158, 481,
+    40, 482, 60, 483, 484, 485, 486, 487, 63, 63, 63, 63, 63, 63, 63, 488,
+    489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 497, 499, 500, 501, 502, 503,
+    504, 63, 191, 505, 223, 223, 158, 158, 63, 63, 63, 63, 63, 63, 63, 88,
+    506, 362, 362, 507, 508, 508, 508, 509, 510, 511, 512, 158, 158, 228, 228, 513,
+    158, 158, 158, 158, 158, 158, 158, 158, 63, 169, 63, 63, 63, 118, 514, 515,
+    63, 63, 516, 63, 517, 63, 63, 518, 63, 519, 63, 63, 520, 521, 158, 158,
+    56, 56, 522, 33, 33, 63, 63, 63, 63, 223, 211, 56, 56, 523, 33, 524,
+    63, 63, 525, 63, 63, 63, 526, 527, 527, 528, 529, 530, 158, 158, 158, 158,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 383, 63, 218, 525, 158, 531, 35, 35, 532, 158, 158, 158, 158,
+    533, 63, 63, 534, 63, 535, 63, 536, 63, 219, 537, 158, 158, 158, 63, 538,
+    63, 539, 63, 540, 158, 158, 158, 158, 63, 63, 63, 541, 362, 542, 362, 362,
+    543, 544, 63, 545, 546, 547, 63, 548, 63, 549, 158, 158, 550, 63, 551, 552,
+    63, 63, 63, 553, 63, 554, 63, 555, 63, 556, 557, 158, 158, 158, 158, 158,
+    63, 63, 63, 63, 215, 158, 158, 158, 56, 56, 56, 558, 33, 33, 33, 559,
+    63, 63, 560, 211, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 362, 561, 63, 63, 562, 563, 158, 158, 158, 158,
+    63, 549, 564, 63, 565, 566, 158, 63, 567, 158, 158, 63, 568, 158, 63, 383,
+    569, 63, 63, 570, 571, 542, 572, 573, 574, 63, 63, 575, 576, 63, 215, 211,
+    577, 63, 578, 579, 580, 63, 63, 581, 241, 63, 63, 582, 583, 584, 585, 586,
+    63, 115, 587, 588, 158, 158, 158, 158, 589, 590, 591, 63, 63, 592, 593, 211,
+    594, 101, 102, 595, 596, 597, 598, 599, 158, 158, 158, 158, 158, 158, 158, 158,
+    63, 63, 63, 600, 601, 602, 563, 158, 63, 63, 63, 603, 604, 211, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 63, 63, 605, 606, 607, 608, 158, 158,
+    63, 63, 63, 609, 610, 211, 611, 158, 63, 63, 612, 613, 211, 158, 158, 158,
+    63, 614, 615, 616, 383, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    63, 63, 587, 617, 158, 158, 158, 158, 158, 158, 56, 56, 33, 33, 166, 618,
+    619, 620, 63, 621, 622, 211, 158, 158, 158, 158, 623, 63, 63, 624, 625, 158,
+    626, 63, 63, 627, 628, 629, 63, 63, 630, 631, 632, 63, 63, 63, 63, 215,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    102, 63, 605, 633, 634, 166, 194, 635, 63, 636, 637, 638, 158, 158, 158, 158,
+    639, 63, 63, 640, 641, 211, 642, 63, 643, 644, 211, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 63, 645,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 118, 362, 646, 647, 648,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 226, 158, 158, 158, 158, 158, 158,
+    508, 508, 508, 508, 508, 508, 649, 650, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 651, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 63, 63, 63, 63, 63, 63, 652,
+    63, 63, 219, 653, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    63, 63, 63, 63, 383, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    63, 63, 63, 215, 63, 219, 445, 63, 63, 63, 63, 219, 211, 63, 223, 654,
+    63, 63, 63, 655, 656, 657, 658, 659, 63, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 56, 56, 33, 33, 362, 660, 158, 158, 158, 158, 158, 158,
+    63, 63, 63, 63, 661, 662, 663, 663, 664, 665, 158, 158, 158, 158, 666, 667,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 668,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 669, 158, 158,
+    670, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 671,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 672, 158, 158, 672, 673, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 674,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    63, 63, 63, 63, 63, 63, 88, 169, 215, 675, 676, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    60, 60, 677, 60, 678, 228, 228, 228, 228, 228, 228, 228, 679, 158, 158, 158,
+    228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 680,
+    228, 228, 681, 228, 228, 228, 682, 683, 684, 228, 685, 228, 228, 228, 326, 158,
+    228, 228, 228, 228, 686, 158, 158, 158, 158, 158, 158, 158, 158, 158, 362, 687,
+    228, 228, 228, 228, 228, 325, 362, 546, 158, 158, 158, 158, 158, 158, 158, 158,
+    56, 688, 33, 689, 690, 691, 262, 56, 692, 693, 694, 695, 696, 56, 688, 33,
+    697, 698, 33, 699, 700, 701, 702, 56, 703, 33, 56, 688, 33, 689, 690, 33,
+    262, 56, 692, 702, 56, 703, 33, 56, 688, 33, 704, 56, 705, 706, 707, 708,
+    33, 709, 56, 710, 711, 712, 713, 33, 714, 56, 715, 33, 716, 717, 717, 717,
+    228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+    228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+    60, 60, 60, 718, 60, 60, 719, 720, 721, 722, 59, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    723, 724, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    725, 726, 727, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    63, 63, 169, 728, 729, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 63, 730, 158, 63, 63, 731, 732,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 733, 219,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 734, 678, 158, 158,
+    56, 56, 692, 33, 735, 445, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    158, 158, 158, 158, 158, 158, 158, 585, 362, 362, 736, 737, 158, 158, 158, 158,
+    585, 362, 738, 739, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    740, 63, 741, 742, 743, 744, 745, 746, 747, 225, 748, 225, 158, 158, 158, 749,
+    158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    750, 228, 751, 228, 228, 228, 228, 228, 228, 679, 752, 753, 754, 753, 228, 680,
+    755, 329, 756, 331, 757, 331, 758, 331, 759, 760, 761, 158, 158, 158, 762, 228,
+    763, 391, 391, 395, 764, 765, 394, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+    391, 391, 766, 767, 391, 391, 391, 768, 391, 345, 391, 391, 769, 345, 391, 770,
+    391, 391, 391, 771, 772, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 773,
+    391, 391, 391, 774, 775, 391, 776, 777, 228, 778, 750, 228, 228, 228, 228, 779,
+    391, 391, 391, 391, 391, 228, 228, 228, 391, 391, 391, 391, 780, 781, 782, 783,
+    228, 228, 228, 228, 228, 228, 228, 679, 228, 228, 228, 228, 228, 784, 395, 785,
+    751, 228, 228, 228, 786, 195, 228, 228, 786, 228, 787, 788, 158, 158, 158, 158,
+    789, 391, 391, 790, 767, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391, 391,
+    228, 228, 228, 228, 228, 679, 787, 791, 413, 391, 792, 793, 394, 794, 795, 413,
+    228, 228, 228, 228, 228, 228, 228, 228, 228, 796, 228, 228, 326, 158, 158, 211,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 469, 469,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 797, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 467, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 798, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 799, 469,
+    469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469,
+    469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469,
+    186, 467, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469,
+    469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469,
+    469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469,
+    469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 800,
+    186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+    186, 186, 186, 186, 801, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469,
+    802, 158, 803, 803, 803, 803, 803, 803, 158, 158, 158, 158, 158, 158, 158, 158,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 158,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+    466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 804,
+};
+
+inline constexpr uint8_t sPropertyStage3[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 3, 3, 3, 4, 3, 3, 3, 5, 6, 3, 7, 3, 8, 3, 3,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 7, 7, 7, 3,
+    3, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5, 3, 6, 11, 12,
+    11, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 5, 7, 6, 7, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    14, 15, 4, 4, 16, 4, 17, 15, 18, 19, 20, 21, 7, 22, 23, 11,
+    23, 24, 25, 25, 18, 26, 15, 15, 18, 25, 20, 27, 25, 25, 25, 15,
+    28, 28, 28, 28, 28, 28, 29, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    29, 28, 28, 28, 28, 28, 28, 24, 29, 28, 28, 28, 28, 28, 29, 30,
+    30, 30, 26, 26, 26, 26, 30, 26, 30, 30, 30, 26, 30, 30, 26, 26,
+    30, 26, 30, 30, 26, 26, 26, 24, 30, 30, 30, 26, 30, 26, 30, 26,
+    28, 30, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26,
+    28, 30, 28, 30, 28, 26, 28, 26, 28, 26, 28, 30, 28, 26, 28, 26,
+    28, 26, 28, 26, 28, 26, 29, 30, 28, 26, 28, 30, 28, 26, 28, 26,
+    28, 30, 29, 30, 28, 26, 28, 26, 30, 28, 26, 28, 26, 28, 26, 29,
+    30, 29, 30, 28, 30, 28, 26, 28, 30, 30, 29, 30, 28, 30, 28, 26,
+    28, 26, 29, 30, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26,
+    28, 26, 28, 26, 28, 26, 28, 26, 28, 28, 26, 28, 26, 28, 26, 26,
+    26, 28, 28, 26, 28, 26, 28, 28, 26, 28, 28, 28, 26, 26, 28, 28,
+    28, 28, 26, 28, 28, 26, 28, 28, 28, 26, 26, 26, 28, 28, 26, 28,
+    28, 26, 28, 26, 28, 26, 28, 28, 26, 28, 26, 26, 28, 26, 28, 28,
+    26, 28, 28, 28, 26, 28, 26, 28, 28, 26, 26, 31, 28, 26, 26, 26,
+    31, 31, 31, 31, 28, 32, 26, 28, 32, 26, 28, 32, 26, 28, 30, 28,
+    30, 28, 30, 28, 30, 28, 30, 28, 30, 28, 30, 28, 30, 26, 28, 26,
+    28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26,
+    26, 28, 32, 26, 28, 26, 28, 28, 28, 26, 28, 26, 28, 26, 28, 26,
+    28, 26, 28, 26, 26, 26, 26, 26, 26, 26, 28, 28, 26, 28, 28, 26,
+    26, 28, 26, 28, 28, 28, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26,
+    26, 30, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 31, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 34, 34, 18, 34, 33, 35, 33, 35, 35, 35, 33, 35, 33, 33,
+    35, 33, 34, 34, 34, 34, 34, 34, 18, 18, 18, 18, 34, 18, 34, 18,
+    33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 33, 34, 33, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 37, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    28, 26, 28, 26, 33, 34, 28, 26, 38, 38, 33, 26, 26, 26, 39, 28,
+    38, 38, 38, 38, 34, 34, 28, 39, 28, 28, 28, 38, 28, 38, 28, 28,
+    26, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    29, 29, 38, 29, 29, 29, 29, 29, 29, 29, 28, 28, 26, 26, 26, 26,
+    26, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 26, 30, 30, 30, 30, 30, 30, 30, 26, 26, 26, 26, 26, 28,
+    26, 26, 28, 28, 28, 26, 26, 26, 28, 26, 28, 26, 28, 26, 28, 26,
+    26, 26, 26, 26, 28, 26, 40, 28, 26, 28, 28, 26, 26, 28, 28, 28,
+    28, 29, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+    28, 26, 19, 41, 41, 41, 41, 41, 42, 42, 28, 26, 28, 26, 28, 26,
+    28, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 26,
+    38, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 38, 38, 33, 39, 39, 39, 39, 39, 39,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 39, 43, 38, 38, 19, 19, 44,
+    38, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 43, 45,
+    39, 45, 45, 39, 45, 45, 39, 45, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 31,
+    31, 31, 31, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    46, 46, 46, 46, 46, 46, 40, 40, 40, 39, 39, 44, 39, 39, 19, 19,
+    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 39, 46, 39, 39, 39,
+    33, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 45, 45, 45, 45, 45,
+    45, 45, 45, 45, 45, 45, 45, 45, 41, 45, 45, 45, 45, 45, 45, 45,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 39, 39, 39, 39, 31, 31,
+    45, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 39, 31, 45, 45, 45, 45, 45, 45, 45, 46, 19, 41,
+    41, 45, 45, 45, 45, 33, 33, 45, 45, 19, 41, 41, 41, 45, 31, 31,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 31, 31, 31, 19, 19, 31,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 38, 46,
+    31, 45, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 38, 38, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    45, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 33, 33, 19, 39, 39, 39, 33, 38, 38, 41, 44, 44,
+    31, 31, 31, 31, 31, 31, 45, 45, 41, 41, 33, 45, 45, 45, 45, 45,
+    45, 45, 45, 45, 33, 45, 45, 45, 33, 45, 45, 45, 45, 41, 38, 38,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 41, 41, 41, 38, 38, 39, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 34, 31, 31, 31, 31, 31, 31, 38,
+    46, 46, 38, 38, 38, 38, 38, 38, 41, 41, 41, 41, 41, 41, 41, 41,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 33, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    41, 41, 46, 45, 45, 45, 45, 45, 45, 45, 41, 41, 41, 41, 41, 41,
+    45, 45, 45, 48, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 45, 48, 41, 31, 48, 48,
+    48, 45, 45, 45, 45, 45, 45, 45, 45, 48, 48, 48, 48, 41, 48, 48,
+    31, 41, 41, 41, 41, 45, 45, 45, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 45, 45, 39, 39, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    39, 33, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 45, 48, 48, 38, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 31,
+    31, 38, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 31, 31, 31, 31, 31, 31,
+    31, 38, 31, 38, 38, 38, 31, 31, 31, 31, 38, 38, 41, 31, 48, 48,
+    48, 45, 45, 45, 45, 38, 38, 48, 48, 38, 38, 48, 48, 41, 31, 38,
+    38, 38, 38, 38, 38, 38, 38, 48, 38, 38, 38, 38, 31, 31, 38, 31,
+    31, 31, 45, 45, 38, 38, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    31, 31, 44, 44, 49, 49, 49, 49, 49, 49, 19, 44, 31, 39, 41, 38,
+    38, 45, 45, 48, 38, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 31,
+    31, 38, 31, 31, 38, 31, 31, 38, 31, 31, 38, 38, 41, 38, 48, 48,
+    48, 45, 45, 38, 38, 38, 38, 45, 45, 38, 38, 45, 45, 41, 38, 38,
+    38, 45, 38, 38, 38, 38, 38, 38, 38, 31, 31, 31, 31, 38, 31, 38,
+    38, 38, 38, 38, 38, 38, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    45, 45, 31, 31, 31, 45, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 45, 45, 48, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 31,
+    31, 31, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 38, 31, 31, 38, 31, 31, 31, 31, 31, 38, 38, 41, 31, 48, 48,
+    48, 45, 45, 45, 45, 45, 38, 45, 45, 48, 38, 48, 48, 41, 38, 38,
+    31, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    39, 44, 38, 38, 38, 38, 38, 38, 38, 31, 45, 45, 45, 41, 41, 41,
+    38, 45, 48, 48, 38, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 31,
+    31, 38, 31, 31, 38, 31, 31, 31, 31, 31, 38, 38, 41, 31, 48, 45,
+    48, 45, 45, 45, 45, 38, 38, 48, 48, 38, 38, 48, 48, 41, 38, 38,
+    38, 38, 38, 38, 38, 41, 45, 48, 38, 38, 38, 38, 31, 31, 38, 31,
+    19, 31, 49, 49, 49, 49, 49, 49, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 45, 31, 38, 31, 31, 31, 31, 31, 31, 38, 38, 38, 31, 31,
+    31, 38, 31, 31, 31, 31, 38, 38, 38, 31, 31, 38, 31, 38, 31, 31,
+    38, 38, 38, 31, 31, 38, 38, 38, 31, 31, 31, 38, 38, 38, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 48, 48,
+    45, 48, 48, 38, 38, 38, 48, 48, 48, 38, 48, 48, 48, 41, 38, 38,
+    31, 38, 38, 38, 38, 38, 38, 48, 38, 38, 38, 38, 38, 38, 38, 38,
+    49, 49, 49, 19, 19, 19, 19, 19, 19, 44, 19, 38, 38, 38, 38, 38,
+    45, 48, 48, 48, 41, 31, 31, 31, 31, 31, 31, 31, 31, 38, 31, 31,
+    31, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 41, 31, 45, 45,
+    45, 48, 48, 48, 48, 38, 45, 45, 45, 38, 45, 45, 45, 41, 38, 38,
+    38, 38, 38, 38, 38, 45, 45, 38, 31, 31, 31, 38, 38, 31, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 39, 49, 49, 49, 49, 49, 49, 49, 19,
+    31, 45, 48, 48, 39, 31, 31, 31, 31, 31, 31, 31, 31, 38, 31, 31,
+    31, 31, 31, 31, 38, 31, 31, 31, 31, 31, 38, 38, 41, 31, 48, 45,
+    48, 48, 48, 48, 48, 38, 45, 48, 48, 38, 48, 48, 45, 41, 38, 38,
+    38, 38, 38, 38, 38, 48, 48, 38, 38, 38, 38, 38, 38, 31, 31, 38,
+    38, 31, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    45, 45, 48, 48, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 41, 41, 31, 48, 48,
+    48, 45, 45, 45, 45, 38, 48, 48, 48, 38, 48, 48, 48, 41, 31, 19,
+    38, 38, 38, 38, 31, 31, 31, 48, 49, 49, 49, 49, 49, 49, 49, 31,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 19, 31, 31, 31, 31, 31, 31,
+    38, 45, 48, 48, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 31, 31, 31, 31, 31, 31,
+    31, 31, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 31, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 41, 38, 38, 38, 38, 48,
+    48, 48, 45, 45, 45, 38, 45, 38, 48, 48, 48, 48, 48, 48, 48, 48,
+    38, 38, 48, 48, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 45, 31, 31, 45, 45, 45, 45, 45, 45, 45, 38, 38, 38, 38, 44,
+    31, 31, 31, 31, 31, 31, 33, 41, 41, 41, 41, 41, 41, 45, 41, 39,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 39, 39, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 31, 31, 38, 31, 38, 31, 31, 31, 31, 31, 38, 31, 31, 31, 31,
+    31, 31, 31, 31, 38, 31, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 45, 31, 31, 45, 45, 45, 45, 45, 45, 41, 45, 45, 31, 38, 38,
+    31, 31, 31, 31, 31, 38, 33, 38, 41, 41, 41, 41, 41, 45, 38, 38,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 38, 38, 31, 31, 31, 31,
+    31, 19, 19, 19, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 19, 39, 19, 19, 19, 41, 41, 19, 19, 19, 19, 19, 19,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 19, 41, 19, 41, 19, 41, 50, 51, 50, 51, 52, 52,
+    31, 31, 31, 31, 31, 31, 31, 31, 38, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38,
+    38, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 48,
+    45, 45, 41, 41, 41, 39, 41, 41, 31, 31, 31, 31, 31, 45, 45, 45,
+    45, 45, 45, 45, 45, 45, 45, 45, 38, 45, 45, 45, 45, 45, 45, 45,
+    45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 38, 19, 19,
+    19, 19, 19, 19, 19, 19, 41, 19, 19, 19, 19, 19, 19, 38, 19, 19,
+    39, 39, 39, 39, 39, 19, 19, 19, 19, 39, 39, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 48, 48, 45, 45, 45,
+    45, 48, 45, 45, 45, 45, 45, 41, 48, 41, 41, 48, 48, 45, 45, 31,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 39, 39, 39, 39, 39, 39,
+    31, 31, 31, 31, 31, 31, 48, 48, 45, 45, 31, 31, 31, 31, 45, 45,
+    45, 31, 48, 48, 48, 31, 31, 48, 48, 48, 48, 48, 48, 48, 31, 31,
+    31, 45, 45, 45, 45, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 45, 48, 48, 45, 45, 48, 48, 48, 48, 48, 48, 45, 31, 48,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 48, 48, 48, 45, 19, 19,
+    28, 28, 28, 28, 28, 28, 38, 28, 38, 38, 38, 38, 38, 28, 38, 38,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 39, 33, 26, 26, 26,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 31, 31, 31, 31, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 38, 31, 38, 31, 31, 31, 31, 38, 38,
+    31, 38, 31, 31, 31, 31, 38, 38, 31, 31, 31, 31, 31, 31, 31, 38,
+    31, 38, 31, 31, 31, 31, 38, 38, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 38, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 41, 41, 41,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 38, 38, 38,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 38, 38, 38, 38, 38, 38,
+    28, 28, 28, 28, 28, 28, 38, 38, 26, 26, 26, 26, 26, 26, 38, 38,
+    43, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 19, 39, 31,
+    14, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 50, 51, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 39, 39, 39, 54, 54,
+    54, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 45, 45, 41, 52, 38, 38, 38, 38, 38, 38, 38, 38, 38, 31,
+    31, 31, 45, 45, 52, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 45, 45, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 31, 31,
+    31, 38, 45, 45, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 41, 41, 48, 45, 45, 45, 45, 45, 45, 45, 48, 48,
+    48, 48, 48, 48, 48, 48, 45, 48, 48, 41, 41, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 39, 39, 39, 33, 39, 39, 39, 44, 31, 41, 38, 38,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 38, 38, 38, 38, 38, 38,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 38, 38, 38, 38, 38, 38,
+    39, 39, 39, 39, 39, 39, 43, 39, 39, 39, 39, 41, 41, 41, 46, 41,
+    31, 31, 31, 33, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 45, 45, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 45, 31, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38,
+    45, 45, 45, 48, 48, 48, 48, 45, 45, 48, 48, 48, 38, 38, 38, 38,
+    48, 48, 45, 48, 48, 48, 48, 48, 48, 41, 41, 41, 38, 38, 38, 38,
+    19, 38, 38, 38, 39, 39, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38,
+    31, 31, 31, 31, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 38, 38,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 49, 38, 38, 38, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    31, 31, 31, 31, 31, 31, 31, 45, 45, 48, 48, 45, 38, 38, 39, 39,
+    31, 31, 31, 31, 31, 48, 45, 48, 45, 45, 45, 45, 45, 45, 45, 38,
+    41, 48, 45, 48, 48, 45, 45, 45, 45, 45, 45, 45, 45, 48, 48, 48,
+    48, 48, 48, 45, 45, 41, 41, 41, 41, 41, 41, 41, 41, 38, 38, 41,
+    39, 39, 39, 39, 39, 39, 39, 33, 39, 39, 39, 39, 39, 39, 38, 38,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 45,
+    45, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 45, 45, 45, 38,
+    45, 45, 45, 45, 48, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 41, 48, 45, 45, 45, 45, 45, 48, 45, 48, 48, 48,
+    48, 48, 45, 48, 52, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38,
+    39, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 19, 19, 19, 19, 19, 19, 19, 19, 19, 39, 39, 38,
+    45, 45, 48, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 48, 45, 45, 45, 45, 48, 48, 45, 45, 52, 41, 45, 45, 31, 31,
+    31, 31, 31, 31, 31, 31, 41, 48, 45, 45, 48, 48, 48, 45, 48, 45,
+    45, 45, 52, 52, 38, 38, 38, 38, 38, 38, 38, 38, 39, 39, 39, 39,
+    31, 31, 31, 31, 48, 48, 48, 48, 48, 48, 48, 48, 45, 45, 45, 45,
+    45, 45, 45, 45, 48, 48, 45, 41, 38, 38, 38, 39, 39, 39, 39, 39,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 38, 38, 38, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 33, 33, 33, 33, 33, 33, 39, 39,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 38, 38, 38, 38, 38, 38, 38,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 38, 38, 28, 28, 28,
+    39, 39, 39, 39, 39, 39, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38,
+    41, 41, 41, 39, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 52, 41, 41, 41, 41, 41, 41, 41, 31, 31, 31, 31, 41, 31, 31,
+    31, 31, 31, 31, 41, 31, 31, 52, 41, 41, 31, 38, 38, 38, 38, 38,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 33, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 33, 33, 33, 33, 33,
+    41, 41, 41, 41, 41, 41, 41, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    45, 45, 45, 45, 45, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    28, 26, 28, 26, 28, 26, 26, 26, 26, 26, 26, 26, 26, 26, 28, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28,
+    26, 26, 26, 26, 26, 26, 38, 38, 28, 28, 28, 28, 28, 28, 38, 38,
+    26, 26, 26, 26, 26, 26, 26, 26, 38, 28, 38, 28, 38, 28, 38, 28,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 38, 38,
+    26, 26, 26, 26, 26, 26, 26, 26, 32, 32, 32, 32, 32, 32, 32, 32,
+    26, 26, 26, 26, 26, 38, 26, 26, 28, 28, 28, 28, 32, 34, 26, 34,
+    34, 34, 26, 26, 26, 38, 26, 26, 28, 28, 28, 28, 32, 34, 34, 34,
+    26, 26, 26, 26, 38, 38, 26, 26, 28, 28, 28, 28, 38, 34, 34, 34,
+    26, 26, 26, 26, 26, 26, 26, 26, 28, 28, 28, 28, 28, 34, 34, 34,
+    38, 38, 26, 26, 26, 38, 26, 26, 28, 28, 28, 28, 32, 34, 34, 38,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 46, 46, 46, 46, 46,
+    55, 43, 43, 55, 55, 55, 15, 39, 56, 57, 50, 21, 56, 57, 50, 21,
+    15, 15, 15, 39, 15, 15, 15, 15, 58, 59, 46, 46, 46, 46, 46, 14,
+    15, 39, 15, 15, 39, 15, 39, 39, 39, 21, 27, 15, 39, 39, 15, 60,
+    60, 39, 39, 39, 40, 50, 51, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 40, 39, 60, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 14,
+    46, 46, 46, 46, 46, 38, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    49, 33, 38, 38, 25, 49, 49, 49, 49, 49, 40, 40, 40, 50, 51, 35,
+    49, 25, 25, 25, 25, 49, 49, 49, 49, 49, 40, 40, 40, 50, 51, 38,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 38, 38, 38,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 61, 44, 44, 16, 44, 44, 44,
+    44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44, 44,
+    44, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 42, 42, 42,
+    42, 41, 42, 42, 42, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    19, 19, 28, 23, 19, 23, 19, 28, 19, 23, 26, 28, 28, 28, 26, 26,
+    28, 28, 28, 30, 19, 28, 23, 19, 40, 28, 28, 28, 28, 28, 19, 19,
+    19, 23, 23, 19, 28, 19, 29, 19, 28, 19, 28, 29, 28, 28, 19, 26,
+    28, 28, 28, 28, 26, 31, 31, 31, 31, 26, 19, 19, 26, 26, 28, 28,
+    40, 40, 40, 40, 40, 28, 26, 26, 26, 26, 19, 40, 19, 19, 26, 19,
+    49, 49, 49, 25, 25, 49, 49, 49, 49, 49, 49, 25, 25, 25, 25, 49,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 54, 54, 54, 54,
+    62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 28, 26, 54, 54, 54, 54, 25, 19, 19, 38, 38, 38, 38,
+    24, 24, 24, 24, 24, 23, 23, 23, 23, 23, 40, 40, 19, 19, 19, 19,
+    40, 19, 19, 40, 19, 19, 40, 19, 19, 19, 19, 19, 19, 19, 40, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 23, 23, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 40, 40,
+    19, 19, 24, 19, 24, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 23, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    24, 40, 24, 24, 40, 40, 40, 24, 24, 40, 40, 24, 40, 40, 40, 24,
+    40, 24, 40, 40, 40, 24, 40, 40, 40, 40, 24, 40, 40, 24, 24, 24,
+    24, 40, 40, 24, 40, 24, 40, 24, 24, 24, 24, 24, 24, 40, 24, 40,
+    40, 40, 40, 40, 24, 24, 24, 24, 40, 40, 40, 40, 24, 24, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 24, 40, 40, 40, 24, 40, 40, 40,
+    40, 40, 24, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    24, 24, 40, 40, 24, 24, 24, 24, 40, 40, 24, 24, 40, 40, 24, 24,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 24, 24, 40, 40, 24, 24, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 24, 40, 40, 40, 24, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 24, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 24,
+    19, 19, 19, 19, 19, 19, 19, 19, 50, 51, 50, 51, 19, 19, 19, 19,
+    19, 19, 23, 19, 19, 19, 19, 19, 19, 19, 63, 63, 19, 19, 19, 19,
+    40, 40, 19, 19, 19, 19, 19, 19, 19, 64, 65, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 40, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 40, 40, 40, 40,
+    40, 40, 19, 19, 19, 19, 19, 19, 19, 63, 63, 63, 63, 19, 19, 19,
+    63, 19, 19, 63, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 38, 38, 38, 38, 38,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 66,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 49, 25, 25, 25, 25, 25,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 19, 19, 19, 19,
+    23, 23, 23, 23, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 23, 23, 23, 23, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    23, 23, 19, 23, 23, 23, 23, 23, 23, 23, 19, 19, 19, 19, 19, 19,
+    19, 19, 23, 23, 19, 19, 23, 24, 19, 19, 19, 19, 23, 23, 19, 19,
+    23, 24, 19, 19, 19, 19, 23, 23, 23, 19, 19, 23, 19, 19, 23, 23,
+    23, 23, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 23, 23, 23, 23, 19, 19, 19, 19, 19, 19, 19, 19, 19, 23,
+    19, 19, 19, 19, 19, 19, 19, 19, 40, 40, 40, 40, 40, 67, 67, 40,
+    19, 19, 19, 19, 19, 23, 23, 19, 19, 23, 19, 19, 19, 19, 23, 23,
+    19, 19, 19, 19, 63, 63, 19, 19, 19, 19, 19, 19, 23, 19, 23, 19,
+    23, 19, 23, 19, 19, 19, 19, 19, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    23, 23, 19, 23, 23, 23, 19, 23, 23, 23, 23, 19, 23, 23, 19, 24,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 63,
+    19, 19, 19, 63, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 23, 23,
+    19, 63, 19, 19, 19, 19, 19, 19, 19, 19, 63, 63, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 63, 63, 23,
+    19, 19, 19, 19, 63, 63, 23, 23, 23, 23, 23, 23, 23, 23, 63, 23,
+    23, 23, 23, 23, 63, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+    23, 23, 19, 23, 19, 19, 19, 19, 23, 23, 63, 23, 23, 23, 23, 23,
+    23, 23, 63, 63, 23, 63, 23, 23, 23, 23, 63, 23, 23, 63, 23, 23,
+    19, 19, 19, 19, 19, 63, 19, 19, 19, 19, 63, 63, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 63, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 23, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 63, 19, 63, 19,
+    19, 19, 19, 63, 63, 63, 19, 63, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 50, 51, 50, 51, 50, 51, 50, 51,
+    50, 51, 50, 51, 50, 51, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 19, 63, 63, 63, 19, 19, 19, 19, 19, 19, 19, 19,
+    63, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 63,
+    40, 40, 40, 40, 40, 50, 51, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 5, 6, 5, 6, 5, 6, 5, 6, 50, 51,
+    40, 40, 40, 50, 51, 5, 6, 50, 51, 50, 51, 50, 51, 50, 51, 50,
+    51, 50, 51, 50, 51, 50, 51, 50, 51, 40, 40, 40, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 50, 51, 50, 51, 40, 40, 40, 40,
+    40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 50, 51, 40, 40,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 63, 63, 19, 19, 19,
+    40, 40, 40, 40, 40, 19, 19, 40, 40, 40, 40, 40, 40, 19, 19, 19,
+    63, 19, 19, 19, 19, 63, 23, 23, 23, 23, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 38, 38, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 38, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    28, 26, 28, 28, 28, 26, 26, 28, 26, 28, 26, 28, 26, 28, 28, 28,
+    28, 26, 28, 26, 26, 28, 26, 26, 26, 26, 26, 26, 33, 33, 28, 28,
+    28, 26, 28, 26, 26, 19, 19, 19, 19, 19, 19, 28, 26, 28, 26, 41,
+    41, 41, 28, 26, 38, 38, 38, 38, 38, 39, 39, 39, 39, 49, 39, 39,
+    26, 26, 26, 26, 26, 26, 38, 26, 38, 38, 38, 38, 38, 26, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 38, 38, 38, 33,
+    39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 41,
+    31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 38, 31, 31, 31, 31, 31, 31, 31, 38,
+    39, 39, 21, 27, 21, 27, 39, 39, 39, 21, 27, 39, 21, 27, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 43, 39, 39, 43, 39, 21, 27, 39, 39,
+    21, 27, 50, 51, 50, 51, 50, 51, 50, 51, 39, 39, 39, 39, 39, 33,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 43, 43, 39, 39, 39, 39,
+    43, 39, 50, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    19, 19, 39, 39, 39, 50, 51, 50, 51, 50, 51, 50, 51, 43, 38, 38,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 38, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    63, 63, 63, 63, 63, 63, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 38, 38, 38, 38,
+    68, 69, 69, 69, 63, 70, 53, 71, 64, 65, 64, 65, 64, 65, 64, 65,
+    64, 65, 63, 63, 64, 65, 64, 65, 64, 65, 64, 65, 72, 64, 65, 65,
+    63, 71, 71, 71, 71, 71, 71, 71, 71, 71, 73, 73, 73, 73, 74, 74,
+    72, 70, 70, 70, 70, 70, 63, 63, 71, 71, 71, 70, 53, 69, 63, 19,
+    38, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 38, 38, 73, 73, 75, 75, 70, 70, 53,
+    72, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 69, 70, 70, 70, 53,
+    38, 38, 38, 38, 38, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 38,
+    63, 63, 76, 76, 76, 76, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 38,
+    76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 25, 25, 25, 25, 25, 25, 25, 25,
+    63, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76, 76,
+    53, 53, 53, 53, 53, 70, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 38, 38, 38,
+    63, 63, 63, 63, 63, 63, 63, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 33, 39, 39, 39,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 31, 31, 38, 38, 38, 38,
+    28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 31, 41,
+    42, 42, 42, 39, 45, 45, 45, 45, 45, 45, 45, 45, 41, 41, 39, 33,
+    28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 33, 33, 45, 45,
+    31, 31, 31, 31, 31, 31, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    41, 41, 39, 39, 39, 39, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38,
+    34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    34, 34, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26,
+    26, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26,
+    33, 26, 26, 26, 26, 26, 26, 26, 26, 28, 26, 28, 26, 28, 28, 26,
+    28, 26, 28, 26, 28, 26, 28, 26, 33, 34, 34, 28, 26, 28, 26, 31,
+    28, 26, 28, 26, 26, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26,
+    28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 28, 28, 28, 28, 26,
+    28, 28, 28, 28, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26, 28, 26,
+    28, 26, 28, 26, 28, 28, 28, 28, 26, 28, 26, 38, 38, 38, 38, 38,
+    28, 26, 38, 26, 38, 26, 28, 26, 28, 26, 38, 38, 38, 38, 38, 38,
+    38, 38, 33, 33, 33, 28, 26, 31, 33, 33, 26, 31, 31, 31, 31, 31,
+    31, 31, 45, 31, 31, 31, 41, 31, 31, 31, 31, 45, 31, 31, 31, 31,
+    31, 31, 31, 48, 48, 45, 45, 48, 19, 19, 19, 19, 41, 38, 38, 38,
+    49, 49, 49, 49, 49, 49, 19, 19, 44, 19, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 39, 39, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38,
+    48, 48, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 41, 45, 38, 38, 38, 38, 38, 38, 38, 38, 39, 39,
+    41, 41, 31, 31, 31, 31, 31, 31, 39, 39, 39, 31, 39, 31, 31, 45,
+    31, 31, 31, 31, 31, 31, 45, 45, 45, 45, 45, 41, 41, 41, 39, 39,
+    31, 31, 31, 31, 31, 31, 31, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    45, 45, 48, 52, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 39,
+    31, 31, 31, 41, 48, 48, 45, 45, 45, 45, 48, 48, 45, 45, 48, 48,
+    52, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 38, 33,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 38, 38, 38, 38, 39, 39,
+    31, 31, 31, 31, 31, 45, 33, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 31, 31, 31, 31, 31, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 45, 45, 45, 45, 45, 45, 48,
+    48, 45, 45, 48, 48, 45, 45, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 45, 31, 31, 31, 31, 31, 31, 31, 31, 45, 48, 38, 38,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 38, 38, 39, 39, 39, 39,
+    33, 31, 31, 31, 31, 31, 31, 19, 19, 19, 31, 48, 45, 48, 31, 31,
+    45, 31, 45, 45, 45, 31, 31, 45, 45, 31, 31, 31, 31, 31, 45, 41,
+    31, 41, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 31, 31, 33, 39, 39,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 48, 45, 45, 48, 48,
+    39, 39, 31, 33, 33, 48, 41, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 31, 31, 31, 31, 31, 31, 38, 38, 31, 31, 31, 31, 31, 31, 38,
+    38, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 34, 33, 33, 33, 33,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 33, 34, 34, 38, 38, 38, 38,
+    31, 31, 31, 48, 48, 45, 48, 48, 45, 48, 48, 39, 52, 41, 38, 38,
+    53, 53, 53, 53, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 31, 31, 31, 31, 31,
+    77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77, 77,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 79, 79,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    26, 26, 26, 26, 26, 26, 26, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 26, 26, 26, 26, 26, 38, 38, 38, 38, 38, 31, 45, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 40, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 38, 31, 31, 31, 31, 31, 38, 31, 38,
+    31, 31, 38, 31, 31, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 51, 50,
+    38, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 38, 38, 38, 19,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 44, 19, 19, 19,
+    69, 69, 69, 69, 69, 69, 69, 64, 65, 69, 38, 38, 38, 38, 38, 38,
+    69, 72, 72, 80, 80, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64,
+    65, 64, 65, 64, 65, 69, 69, 64, 65, 69, 69, 69, 69, 80, 80, 80,
+    69, 69, 69, 38, 69, 69, 69, 69, 72, 64, 65, 64, 65, 64, 65, 69,
+    69, 69, 67, 72, 67, 67, 67, 38, 69, 81, 69, 69, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 46,
+    38, 82, 82, 82, 83, 82, 82, 82, 84, 85, 82, 86, 82, 87, 82, 82,
+    88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 82, 82, 86, 86, 86, 82,
+    82, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+    89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 84, 82, 85, 90, 91,
+    90, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+    92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 84, 86, 85, 86, 84,
+    85, 93, 94, 95, 93, 93, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    97, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 97, 97,
+    96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 38,
+    38, 38, 96, 96, 96, 96, 96, 96, 38, 38, 96, 96, 96, 96, 96, 96,
+    38, 38, 96, 96, 96, 96, 96, 96, 38, 38, 96, 96, 96, 38, 38, 38,
+    83, 83, 86, 90, 98, 83, 83, 38, 99, 100, 100, 100, 100, 99, 99, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 46, 46, 46, 19, 23, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 31, 31, 38, 31,
+    39, 39, 39, 38, 38, 38, 38, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 38, 38, 38, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 49, 49, 49, 49, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 49, 49, 19, 19, 19, 38,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 38, 38, 38,
+    19, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 41, 38, 38,
+    41, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 38, 38, 38, 38,
+    49, 49, 49, 49, 38, 38, 38, 38, 38, 38, 38, 38, 38, 31, 31, 31,
+    31, 54, 31, 31, 31, 31, 31, 31, 31, 31, 54, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 45, 45, 45, 45, 45, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 39,
+    31, 31, 31, 31, 38, 38, 38, 38, 31, 31, 31, 31, 31, 31, 31, 31,
+    39, 54, 54, 54, 54, 54, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    28, 28, 28, 28, 28, 28, 28, 28, 26, 26, 26, 26, 26, 26, 26, 26,
+    28, 28, 28, 28, 38, 38, 38, 38, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 39,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 38, 28, 28, 28, 28,
+    28, 28, 28, 38, 28, 28, 38, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 38, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 38, 26, 26, 26, 26, 26, 26, 26, 38, 26, 26, 38, 38, 38,
+    33, 33, 33, 33, 33, 33, 38, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 38, 33, 33, 33, 33, 33, 33, 33, 33, 33, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 38, 38, 31, 38, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 38, 31, 31, 38, 38, 38, 31, 38, 38, 31,
+    31, 31, 31, 31, 31, 31, 38, 39, 49, 49, 49, 49, 49, 49, 49, 49,
+    31, 31, 31, 31, 31, 31, 31, 19, 19, 49, 49, 49, 49, 49, 49, 49,
+    38, 38, 38, 38, 38, 38, 38, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    31, 31, 31, 38, 31, 31, 38, 38, 38, 38, 38, 49, 49, 49, 49, 49,
+    31, 31, 31, 31, 31, 31, 49, 49, 49, 49, 49, 49, 38, 38, 38, 39,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 38, 39,
+    31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 49, 49, 31, 31,
+    38, 38, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    31, 45, 45, 45, 38, 45, 45, 38, 38, 38, 38, 38, 45, 45, 45, 45,
+    31, 31, 31, 31, 38, 31, 31, 31, 38, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 38, 38, 41, 41, 41, 38, 38, 38, 38, 41,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 38, 38, 38, 38, 38, 38, 38,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 49, 49, 39,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 49, 49, 49,
+    31, 31, 31, 31, 31, 31, 31, 31, 19, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 41, 41, 38, 38, 38, 38, 49, 49, 49, 49, 49,
+    39, 39, 39, 39, 39, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 38, 38, 38, 39, 39, 39, 39, 39, 39, 39,
+    31, 31, 31, 31, 31, 31, 38, 38, 49, 49, 49, 49, 49, 49, 49, 49,
+    31, 31, 31, 38, 38, 38, 38, 38, 49, 49, 49, 49, 49, 49, 49, 49,
+    31, 31, 38, 38, 38, 38, 38, 38, 38, 39, 39, 39, 39, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 49, 49, 49, 49, 49, 49, 49,
+    28, 28, 28, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    26, 26, 26, 38, 38, 38, 38, 38, 38, 38, 49, 49, 49, 49, 49, 49,
+    31, 31, 31, 31, 45, 45, 45, 45, 38, 38, 38, 38, 38, 38, 38, 38,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 45, 45, 43, 38, 38,
+    31, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    49, 49, 49, 49, 49, 49, 49, 31, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41,
+    41, 49, 49, 49, 49, 39, 39, 39, 39, 39, 38, 38, 38, 38, 38, 38,
+    31, 31, 41, 41, 41, 41, 39, 39, 39, 39, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 49, 49, 49, 49, 49, 49, 49, 38, 38, 38, 38,
+    48, 45, 48, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 45, 45, 45, 45, 45, 45, 45, 45,
+    45, 45, 45, 45, 45, 45, 41, 39, 39, 39, 39, 39, 39, 39, 38, 38,
+    49, 49, 49, 49, 49, 49, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    41, 31, 31, 45, 45, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38, 41,
+    41, 41, 48, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    48, 48, 48, 45, 45, 45, 45, 48, 48, 41, 41, 39, 39, 46, 39, 39,
+    39, 39, 45, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 46, 38, 38,
+    45, 45, 45, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 45, 45, 45, 45, 45, 48, 45, 45, 45,
+    45, 45, 45, 41, 41, 38, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    39, 39, 39, 39, 31, 48, 48, 31, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 41, 39, 39, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 48, 48, 48, 45, 45, 45, 45, 45, 45, 45, 45, 45, 48,
+    52, 31, 31, 31, 31, 39, 39, 39, 39, 41, 41, 41, 41, 39, 48, 45,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 31, 39, 31, 39, 39, 39,
+    38, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 48, 48, 48, 45,
+    45, 45, 48, 48, 45, 52, 41, 45, 39, 39, 39, 39, 39, 39, 45, 38,
+    31, 31, 31, 31, 31, 31, 31, 38, 31, 38, 31, 31, 31, 31, 38, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 39, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 45,
+    48, 48, 48, 45, 45, 45, 45, 45, 45, 41, 41, 38, 38, 38, 38, 38,
+    45, 45, 48, 48, 38, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 31,
+    31, 38, 31, 31, 38, 31, 31, 31, 31, 31, 38, 41, 41, 31, 48, 48,
+    45, 48, 48, 48, 48, 38, 38, 48, 48, 38, 38, 48, 48, 52, 38, 38,
+    31, 38, 38, 38, 38, 38, 38, 48, 38, 38, 38, 38, 38, 31, 31, 31,
+    31, 31, 48, 48, 38, 38, 41, 41, 41, 41, 41, 41, 41, 38, 38, 38,
+    41, 41, 41, 41, 41, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 48, 48, 48, 45, 45, 45, 45, 45, 45, 45, 45,
+    48, 48, 41, 45, 45, 48, 41, 31, 31, 31, 31, 39, 39, 39, 39, 39,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 39, 39, 38, 39, 41, 31,
+    48, 48, 48, 45, 45, 45, 45, 45, 45, 48, 45, 48, 48, 48, 48, 45,
+    45, 48, 41, 41, 31, 31, 39, 31, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 48,
+    48, 48, 45, 45, 45, 45, 38, 38, 48, 48, 48, 48, 45, 45, 48, 41,
+    41, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 31, 31, 31, 31, 45, 45, 38, 38,
+    48, 48, 48, 45, 45, 45, 45, 45, 45, 45, 45, 48, 48, 45, 48, 41,
+    45, 39, 39, 39, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 45, 48, 45, 48, 48,
+    45, 45, 45, 45, 45, 45, 52, 41, 31, 39, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 45, 45, 45,
+    48, 48, 45, 45, 45, 45, 48, 45, 45, 45, 45, 41, 38, 38, 38, 38,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 49, 49, 39, 39, 39, 19,
+    45, 45, 45, 45, 45, 45, 45, 45, 48, 41, 41, 39, 38, 38, 38, 38,
+    49, 49, 49, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 31,
+    31, 31, 31, 31, 31, 31, 31, 38, 38, 31, 38, 38, 31, 31, 31, 31,
+    31, 31, 31, 31, 38, 31, 31, 38, 31, 31, 31, 31, 31, 31, 31, 31,
+    48, 48, 48, 48, 48, 48, 38, 48, 48, 38, 38, 45, 45, 52, 41, 31,
+    48, 31, 48, 41, 39, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 31, 31, 31, 31, 31, 31,
+    31, 48, 48, 48, 45, 45, 45, 45, 38, 38, 45, 45, 48, 48, 48, 48,
+    41, 31, 39, 31, 48, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 31, 31, 31, 31, 31,
+    31, 31, 31, 41, 41, 45, 45, 45, 45, 48, 31, 45, 45, 45, 45, 39,
+    39, 39, 39, 39, 39, 39, 39, 41, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 45, 45, 45, 45, 45, 45, 48, 48, 45, 45, 45, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 45, 45, 45, 45, 45, 45,
+    45, 45, 45, 45, 45, 45, 45, 48, 41, 41, 39, 39, 39, 31, 39, 39,
+    39, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    45, 45, 45, 45, 45, 45, 45, 38, 45, 45, 45, 45, 45, 45, 48, 41,
+    31, 39, 39, 39, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    39, 39, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    38, 38, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
+    45, 45, 45, 45, 45, 45, 45, 45, 38, 48, 45, 45, 45, 45, 45, 45,
+    45, 48, 45, 45, 48, 45, 45, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 38, 31, 31, 38, 31, 31, 31, 31, 31,
+    31, 45, 45, 45, 45, 45, 45, 38, 38, 38, 45, 38, 45, 45, 38, 45,
+    45, 45, 41, 45, 41, 41, 31, 45, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 38, 31, 31, 38, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 48, 48, 48, 48, 48, 38,
+    45, 45, 38, 48, 48, 45, 48, 41, 31, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 45, 45, 48, 48, 39, 39, 38, 38, 38, 38, 38, 38, 38,
+    49, 49, 49, 49, 49, 19, 19, 19, 19, 19, 19, 19, 19, 44, 44, 44,
+    44, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 39,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 38,
+    39, 39, 39, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    31, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 38, 38, 38, 38, 38, 38, 38,
+    41, 41, 41, 41, 41, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    41, 41, 41, 41, 41, 41, 41, 39, 39, 39, 39, 39, 19, 19, 19, 19,
+    33, 33, 33, 33, 39, 19, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 38, 49, 49, 49, 49, 49,
+    49, 49, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 38, 31, 31, 31,
+    49, 49, 49, 49, 49, 49, 49, 39, 39, 39, 39, 38, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 38, 38, 45,
+    31, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 38, 38, 38, 38, 38, 38, 38, 45,
+    45, 45, 45, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    70, 70, 69, 70, 73, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    101, 101, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    53, 53, 53, 53, 53, 53, 53, 53, 38, 38, 38, 38, 38, 38, 38, 38,
+    53, 53, 53, 53, 53, 53, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 38, 38, 38, 38, 38, 38, 38,
+    70, 70, 70, 70, 38, 70, 70, 70, 70, 70, 70, 70, 38, 70, 70, 38,
+    53, 53, 53, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 53, 53, 53, 53, 38, 38, 38, 38, 38, 38, 38, 38,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 38, 38, 38, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 38, 19, 41, 45, 39,
+    46, 46, 46, 46, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 38, 38,
+    41, 41, 41, 41, 41, 41, 41, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    19, 19, 19, 19, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    19, 19, 19, 19, 19, 19, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    19, 19, 19, 19, 19, 19, 19, 38, 38, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 52, 52, 41, 41, 41, 19, 19, 19, 52, 52, 52,
+    52, 52, 52, 46, 46, 46, 46, 46, 46, 46, 46, 41, 41, 41, 41, 41,
+    41, 41, 41, 19, 19, 41, 41, 41, 41, 41, 41, 41, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 41, 41, 41, 41, 19, 19,
+    19, 19, 41, 41, 41, 19, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    49, 49, 49, 49, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 26, 26,
+    26, 26, 26, 26, 26, 38, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    28, 28, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 28, 38, 28, 28,
+    38, 38, 28, 38, 38, 28, 28, 38, 38, 28, 28, 28, 28, 38, 28, 28,
+    28, 28, 28, 28, 28, 28, 26, 26, 26, 26, 38, 26, 38, 26, 26, 26,
+    26, 26, 26, 26, 38, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 28, 28, 38, 28, 28, 28, 28, 38, 38, 28, 28, 28,
+    28, 28, 28, 28, 28, 38, 28, 28, 28, 28, 28, 28, 28, 38, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 28, 28, 38, 28, 28, 28, 28, 38,
+    28, 28, 28, 28, 28, 38, 28, 38, 38, 38, 28, 28, 28, 28, 28, 28,
+    28, 38, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 38, 38, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 40, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 40, 26, 26, 26, 26,
+    26, 26, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 40, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 40, 26, 26, 26, 26, 26, 26, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 40, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 40,
+    26, 26, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 40,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 40, 26, 26, 26, 26, 26, 26,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 40, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 40, 26, 26, 26, 26, 26, 26, 28, 26, 38, 38, 47, 47,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+    41, 41, 41, 41, 41, 41, 41, 19, 19, 19, 19, 41, 41, 41, 41, 41,
+    41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 41, 19, 19, 19,
+    19, 19, 19, 19, 19, 41, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 41, 19, 19, 39, 39, 39, 39, 39, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 41, 41, 41, 41, 41,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 31, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 38,
+    45, 45, 45, 45, 45, 45, 45, 38, 45, 45, 45, 45, 45, 45, 45, 45,
+    45, 45, 45, 45, 45, 45, 45, 45, 45, 38, 38, 45, 45, 45, 45, 45,
+    45, 45, 38, 45, 45, 38, 45, 45, 45, 45, 45, 38, 38, 38, 38, 38,
+    41, 41, 41, 41, 41, 41, 41, 33, 33, 33, 33, 33, 33, 33, 38, 38,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 38, 38, 38, 38, 31, 19,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 41, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 41, 41, 41, 41,
+    47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 38, 38, 38, 38, 38, 44,
+    31, 31, 31, 31, 31, 31, 31, 38, 31, 31, 31, 31, 38, 31, 31, 38,
+    31, 31, 31, 31, 31, 38, 38, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+    26, 26, 26, 26, 41, 41, 41, 45, 41, 41, 41, 33, 38, 38, 38, 38,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 19, 49, 49, 49,
+    44, 49, 49, 49, 49, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 19, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 38, 38,
+    31, 31, 31, 31, 38, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 31,
+    38, 31, 31, 38, 31, 38, 38, 31, 38, 31, 31, 31, 31, 31, 31, 31,
+    31, 31, 31, 38, 31, 31, 31, 31, 38, 31, 38, 31, 38, 38, 38, 38,
+    38, 38, 31, 38, 38, 38, 38, 31, 38, 31, 38, 31, 38, 31, 31, 31,
+    38, 31, 31, 38, 31, 38, 38, 31, 38, 31, 38, 31, 38, 31, 38, 31,
+    38, 31, 31, 38, 31, 38, 38, 31, 31, 31, 31, 38, 31, 31, 31, 31,
+    31, 31, 31, 38, 31, 31, 31, 31, 38, 31, 31, 31, 31, 38, 31, 38,
+    31, 31, 31, 31, 31, 31, 31, 31, 31, 31, 38, 31, 31, 31, 31, 31,
+    38, 31, 31, 31, 38, 31, 31, 31, 31, 31, 38, 31, 31, 31, 31, 31,
+    40, 40, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    19, 19, 19, 19, 63, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 38, 38, 38, 38,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 38,
+    38, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    38, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 63,
+    25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 49, 49, 19, 19, 19,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 19, 19,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 23, 23, 23, 23, 23, 23,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 19, 19, 19, 19, 19, 19,
+    66, 66, 66, 66, 66, 66, 66, 66, 66, 66, 23, 23, 23, 23, 63, 23,
+    23, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 23, 23, 23, 23, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 19, 38, 38,
+    38, 38, 38, 38, 38, 38, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    63, 63, 63, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 38, 38, 38, 38, 38, 38, 38,
+    63, 63, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    63, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 19, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 19, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 19, 19, 19, 19, 63,
+    63, 19, 19, 19, 63, 19, 19, 19, 63, 63, 63, 75, 75, 75, 75, 75,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 19,
+    63, 19, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 19, 19, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 63, 63, 63, 63, 19,
+    63, 63, 63, 63, 63, 63, 63, 63, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 63, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 63, 63, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 63, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 19, 19, 19, 19, 19, 19, 63, 19, 19, 19,
+    63, 63, 63, 19, 19, 63, 63, 63, 38, 38, 38, 38, 38, 63, 63, 63,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 63, 63, 38, 38, 38,
+    19, 19, 19, 19, 63, 63, 63, 63, 63, 63, 63, 63, 63, 38, 38, 38,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 38, 38, 38, 38, 38, 38, 38,
+    63, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    19, 19, 19, 19, 19, 19, 19, 19, 38, 38, 38, 38, 38, 38, 38, 38,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 38, 38,
+    19, 19, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 19, 63, 63, 63, 63,
+    63, 63, 63, 63, 63, 38, 38, 38, 63, 63, 63, 63, 63, 38, 38, 38,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 38, 38, 38,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 38, 38, 38, 38, 38,
+    63, 63, 63, 63, 63, 63, 63, 63, 63, 63, 38, 38, 38, 38, 38, 38,
+    63, 63, 63, 63, 63, 63, 63, 63, 38, 38, 38, 38, 38, 38, 38, 38,
+    19, 19, 19, 38, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 79, 79, 79, 79, 79, 79, 79,
+    53, 53, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    53, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 38, 38,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 79, 79, 79, 79, 79,
+    38, 46, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 38, 38,
+};
+
+inline constexpr PropertyRecord sPropertyRecords[] = {
+    {GeneralCategory::CONTROL, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::CONTROL, EastAsianWidth::NEUTRAL, 0x01},
+    {GeneralCategory::SPACE_SEPARATOR, EastAsianWidth::NARROW, 0x01},
+    {GeneralCategory::OTHER_PUNCTUATION, EastAsianWidth::NARROW, 0x00},
+    {GeneralCategory::CURRENCY_SYMBOL, EastAsianWidth::NARROW, 0x00},
+    {GeneralCategory::OPEN_PUNCTUATION, EastAsianWidth::NARROW, 0x00},
+    {GeneralCategory::CLOSE_PUNCTUATION, EastAsianWidth::NARROW, 0x00},
+    {GeneralCategory::MATH_SYMBOL, EastAsianWidth::NARROW, 0x00},
+    {GeneralCategory::DASH_PUNCTUATION, EastAsianWidth::NARROW, 0x00},
+    {GeneralCategory::DECIMAL_NUMBER, EastAsianWidth::NARROW, 0x00},
+    {GeneralCategory::UPPERCASE_LETTER, EastAsianWidth::NARROW, 0x02},
+    {GeneralCategory::MODIFIER_SYMBOL, EastAsianWidth::NARROW, 0x00},
+    {GeneralCategory::CONNECTOR_PUNCTUATION, EastAsianWidth::NARROW, 0x00},
+    {GeneralCategory::LOWERCASE_LETTER, EastAsianWidth::NARROW, 0x02},
+    {GeneralCategory::SPACE_SEPARATOR, EastAsianWidth::NEUTRAL, 0x01},
+    {GeneralCategory::OTHER_PUNCTUATION, EastAsianWidth::AMBIGUOUS, 0x00},
+    {GeneralCategory::CURRENCY_SYMBOL, EastAsianWidth::AMBIGUOUS, 0x00},
+    {GeneralCategory::OTHER_SYMBOL, EastAsianWidth::NARROW, 0x00},
+    {GeneralCategory::MODIFIER_SYMBOL, EastAsianWidth::AMBIGUOUS, 0x00},
+    {GeneralCategory::OTHER_SYMBOL, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::OTHER_LETTER, EastAsianWidth::AMBIGUOUS, 0x02},
+    {GeneralCategory::INITIAL_PUNCTUATION, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::FORMAT, EastAsianWidth::AMBIGUOUS, 0x00},
+    {GeneralCategory::OTHER_SYMBOL, EastAsianWidth::AMBIGUOUS, 0x00},
+    {GeneralCategory::MATH_SYMBOL, EastAsianWidth::AMBIGUOUS, 0x00},
+    {GeneralCategory::OTHER_NUMBER, EastAsianWidth::AMBIGUOUS, 0x00},
+    {GeneralCategory::LOWERCASE_LETTER, EastAsianWidth::NEUTRAL, 0x02},
+    {GeneralCategory::FINAL_PUNCTUATION, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::UPPERCASE_LETTER, EastAsianWidth::NEUTRAL, 0x02},
+    {GeneralCategory::UPPERCASE_LETTER, EastAsianWidth::AMBIGUOUS, 0x02},
+    {GeneralCategory::LOWERCASE_LETTER, EastAsianWidth::AMBIGUOUS, 0x02},
+    {GeneralCategory::OTHER_LETTER, EastAsianWidth::NEUTRAL, 0x02},
+    {GeneralCategory::TITLECASE_LETTER, EastAsianWidth::NEUTRAL, 0x02},
+    {GeneralCategory::MODIFIER_LETTER, EastAsianWidth::NEUTRAL, 0x02},
+    {GeneralCategory::MODIFIER_SYMBOL, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::MODIFIER_LETTER, EastAsianWidth::AMBIGUOUS, 0x02},
+    {GeneralCategory::NONSPACING_MARK, EastAsianWidth::AMBIGUOUS, 0x00},
+    {GeneralCategory::NONSPACING_MARK, EastAsianWidth::AMBIGUOUS, 0x02},
+    {GeneralCategory::UNASSIGNED, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::OTHER_PUNCTUATION, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::MATH_SYMBOL, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::NONSPACING_MARK, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::ENCLOSING_MARK, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::DASH_PUNCTUATION, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::CURRENCY_SYMBOL, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::NONSPACING_MARK, EastAsianWidth::NEUTRAL, 0x02},
+    {GeneralCategory::FORMAT, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::DECIMAL_NUMBER, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::SPACING_MARK, EastAsianWidth::NEUTRAL, 0x02},
+    {GeneralCategory::OTHER_NUMBER, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::OPEN_PUNCTUATION, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::CLOSE_PUNCTUATION, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::SPACING_MARK, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::OTHER_LETTER, EastAsianWidth::WIDE, 0x02},
+    {GeneralCategory::LETTER_NUMBER, EastAsianWidth::NEUTRAL, 0x02},
+    {GeneralCategory::DASH_PUNCTUATION, EastAsianWidth::AMBIGUOUS, 0x00},
+    {GeneralCategory::INITIAL_PUNCTUATION, EastAsianWidth::AMBIGUOUS, 0x00},
+    {GeneralCategory::FINAL_PUNCTUATION, EastAsianWidth::AMBIGUOUS, 0x00},
+    {GeneralCategory::LINE_SEPARATOR, EastAsianWidth::NEUTRAL, 0x01},
+    {GeneralCategory::PARAGRAPH_SEPARATOR, EastAsianWidth::NEUTRAL, 0x01},
+    {GeneralCategory::CONNECTOR_PUNCTUATION, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::CURRENCY_SYMBOL, EastAsianWidth::HALFWIDTH, 0x00},
+    {GeneralCategory::LETTER_NUMBER, EastAsianWidth::AMBIGUOUS, 0x02},
+    {GeneralCategory::OTHER_SYMBOL, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::OPEN_PUNCTUATION, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::CLOSE_PUNCTUATION, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::OTHER_SYMBOL, EastAsianWidth::AMBIGUOUS, 0x02},
+    {GeneralCategory::MATH_SYMBOL, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::SPACE_SEPARATOR, EastAsianWidth::FULLWIDTH, 0x01},
+    {GeneralCategory::OTHER_PUNCTUATION, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::MODIFIER_LETTER, EastAsianWidth::WIDE, 0x02},
+    {GeneralCategory::LETTER_NUMBER, EastAsianWidth::WIDE, 0x02},
+    {GeneralCategory::DASH_PUNCTUATION, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::NONSPACING_MARK, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::SPACING_MARK, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::MODIFIER_SYMBOL, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::OTHER_NUMBER, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::SURROGATE, EastAsianWidth::NEUTRAL, 0x00},
+    {GeneralCategory::PRIVATE_USE, EastAsianWidth::AMBIGUOUS, 0x00},
+    {GeneralCategory::UNASSIGNED, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::CONNECTOR_PUNCTUATION, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::CURRENCY_SYMBOL, EastAsianWidth::WIDE, 0x00},
+    {GeneralCategory::OTHER_PUNCTUATION, EastAsianWidth::FULLWIDTH, 0x00},
+    {GeneralCategory::CURRENCY_SYMBOL, EastAsianWidth::FULLWIDTH, 0x00},
+    {GeneralCategory::OPEN_PUNCTUATION, EastAsianWidth::FULLWIDTH, 0x00},
+    {GeneralCategory::CLOSE_PUNCTUATION, EastAsianWidth::FULLWIDTH, 0x00},
+    {GeneralCategory::MATH_SYMBOL, EastAsianWidth::FULLWIDTH, 0x00},
+    {GeneralCategory::DASH_PUNCTUATION, EastAsianWidth::FULLWIDTH, 0x00},
+    {GeneralCategory::DECIMAL_NUMBER, EastAsianWidth::FULLWIDTH, 0x00},
+    {GeneralCategory::UPPERCASE_LETTER, EastAsianWidth::FULLWIDTH, 0x02},
+    {GeneralCategory::MODIFIER_SYMBOL, EastAsianWidth::FULLWIDTH, 0x00},
+    {GeneralCategory::CONNECTOR_PUNCTUATION, EastAsianWidth::FULLWIDTH, 0x00},
+    {GeneralCategory::LOWERCASE_LETTER, EastAsianWidth::FULLWIDTH, 0x02},
+    {GeneralCategory::OTHER_PUNCTUATION, EastAsianWidth::HALFWIDTH, 0x00},
+    {GeneralCategory::OPEN_PUNCTUATION, EastAsianWidth::HALFWIDTH, 0x00},
+    {GeneralCategory::CLOSE_PUNCTUATION, EastAsianWidth::HALFWIDTH, 0x00},
+    {GeneralCategory::OTHER_LETTER, EastAsianWidth::HALFWIDTH, 0x02},
+    {GeneralCategory::MODIFIER_LETTER, EastAsianWidth::HALFWIDTH, 0x02},
+    {GeneralCategory::OTHER_SYMBOL, EastAsianWidth::FULLWIDTH, 0x00},
+    {GeneralCategory::OTHER_SYMBOL, EastAsianWidth::HALFWIDTH, 0x00},
+    {GeneralCategory::MATH_SYMBOL, EastAsianWidth::HALFWIDTH, 0x00},
+    {GeneralCategory::SPACING_MARK, EastAsianWidth::WIDE, 0x02},
+};
+
+}  // namespace edoren::unicode::internal
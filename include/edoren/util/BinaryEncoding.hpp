@@ -0,0 +1,85 @@
+#pragma once
+
+#include <edoren/String.hpp>
+#include <edoren/StringView.hpp>
+#include <edoren/container/Vector.hpp>
+#include <edoren/util/Config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace edoren {
+
+/**
+ * @brief Enum to specify the alphabet used by the base64 encoding
+ */
+enum class Base64Alphabet {
+    STANDARD,  ///< RFC 4648 alphabet using '+' and '/', the output is padded with '='
+    URL_SAFE,  ///< RFC 4648 URL and filename safe alphabet using '-' and '_', the output is not padded
+};
+
+/**
+ * @brief Encode binary data to base64
+ *
+ * The output is ASCII by construction, so the String is created without
+ * any UTF-8 validation.
+ *
+ * @param data Pointer to the data to encode
+ * @param size Size in bytes of the data
+ * @param alphabet The alphabet to use. See @ref Base64Alphabet.
+ * @return A String with the base64 representation of the data
+ */
+EDOTOOLS_API String EncodeBase64(const uint8_t* data, size_t size, Base64Alphabet alphabet = Base64Alphabet::STANDARD);
+
+/**
+ * @copydoc EncodeBase64(const uint8_t*, size_t, Base64Alphabet)
+ */
+EDOTOOLS_API String EncodeBase64(const Vector<uint8_t>& data, Base64Alphabet alphabet = Base64Alphabet::STANDARD);
+
+/**
+ * @brief Decode base64 text to binary data
+ *
+ * The padding characters are optional for both alphabets. Any character
+ * outside the alphabet, including whitespaces, makes the decoding fail, as
+ * well as non-zero bits after the last byte, so each data has a single
+ * valid encoding.
+ *
+ * @param text The base64 text to decode
+ * @param dest A vector to store the decoded bytes, it's cleared if the text is invalid
+ * @param alphabet The alphabet to use. See @ref Base64Alphabet.
+ * @return true if the text could be decoded, false otherwise
+ */
+EDOTOOLS_API bool DecodeBase64(StringView text,
+                               Vector<uint8_t>& dest,
+                               Base64Alphabet alphabet = Base64Alphabet::STANDARD);
+
+/**
+ * @brief Encode binary data to hexadecimal
+ *
+ * The output is ASCII by construction, so the String is created without
+ * any UTF-8 validation.
+ *
+ * @param data Pointer to the data to encode
+ * @param size Size in bytes of the data
+ * @param upperCase Use the uppercase digits 'A' to 'F' instead of the lowercase ones
+ * @return A String with two hexadecimal digits per byte
+ */
+EDOTOOLS_API String EncodeHex(const uint8_t* data, size_t size, bool upperCase = false);
+
+/**
+ * @copydoc EncodeHex(const uint8_t*, size_t, bool)
+ */
+EDOTOOLS_API String EncodeHex(const Vector<uint8_t>& data, bool upperCase = false);
+
+/**
+ * @brief Decode hexadecimal text to binary data
+ *
+ * Both uppercase and lowercase digits are accepted.
+ *
+ * @param text The hexadecimal text to decode
+ * @param dest A vector to store the decoded bytes, it's cleared if the text is invalid
+ * @return true if the text could be decoded, false otherwise
+ */
+EDOTOOLS_API bool DecodeHex(StringView text, Vector<uint8_t>& dest);
+
+}  // namespace edoren
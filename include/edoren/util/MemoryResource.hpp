@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory_resource>
+
+#include <edoren/util/Config.hpp>
+
+namespace edoren {
+
+namespace internal {
+
+/**
+ * @brief Get the memory resource shared by the small internal allocations of
+ *        the library, like the callables that do not fit in the buffer of a
+ *        UniqueFunction or the shared states of the futures
+ *
+ * The resource is a synchronized pool, so the memory allocated in one thread
+ * can be released in another one, as it happens with the tasks of a ThreadPool.
+ * It's never destroyed, so the objects stored in static variables can still
+ * release their memory after it would have been destroyed otherwise.
+ *
+ * @return The pooled memory resource
+ */
+EDOTOOLS_API std::pmr::memory_resource* GetPooledResource();
+
+}  // namespace internal
+
+}  // namespace edoren
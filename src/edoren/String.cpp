@@ -26,13 +26,135 @@
 
 #include <edoren/String.hpp>
 
+#include <edoren/Unicode.hpp>
 #include <edoren/util/Platform.hpp>
 #include <edoren/UTF.hpp>
 
+#include "unicode/Ascii.hpp"
+
 #include <algorithm>
+#include <stdexcept>
 
 namespace edoren {
 
+namespace {
+
+// Applies the full case mapping to a valid UTF-8 string. The data is modified in place
+// as long as the mapped code points have the same size than the original ones.
+void ApplyCaseMapping(std::string& str, unicode::CaseMapping mapping) {
+    using namespace unicode::internal;
+    const bool toUpper = (mapping == unicode::CaseMapping::UPPER);
+    char* data = str.data();
+    size_t size = str.size();
+    size_t pos = 0;
+
+    std::string output;
+    bool inPlace = true;
+
+    while (pos < size) {
+        size_t runEnd = FindAsciiRunEnd(data, pos, size);
+        if (inPlace) {
+            MapAsciiCase(data + pos, runEnd - pos, toUpper);
+        } else {
+            size_t outputPos = output.size();
+            output.append(data + pos, runEnd - pos);
+            MapAsciiCase(output.data() + outputPos, runEnd - pos, toUpper);
+        }
+        pos = runEnd;
+        if (pos == size) {
+            break;
+        }
+
+        size_t unitSize = utf::internal::GetUnitSize<utf::UTF_8>(data + pos);
+        char32_t codePoint = utf::GetCodePoint<utf::UTF_8>(data + pos, data + pos + unitSize);
+
+        char32_t mapped[unicode::sMaxCaseMappingSize];
+        size_t count = unicode::MapCase(codePoint, mapping, mapped);
+
+        char buffer[unicode::sMaxCaseMappingSize * 4];
+        size_t bufferSize = 0;
+        for (size_t i = 0; i < count; ++i) {
+            utf::CodeUnit<utf::UTF_8> unit(mapped[i]);
+            std::copy(unit.begin(), unit.end(), buffer + bufferSize);
+            bufferSize += unit.getSize();
+        }
+
+        if (inPlace && bufferSize != unitSize) {
+            // The size changes, continue writing the result to a new buffer
+            inPlace = false;
+            output.reserve(size + size / 8);
+            output.assign(data, pos);
+        }
+
+        if (inPlace) {
+            std::copy_n(buffer, bufferSize, data + pos);
+        } else {
+            output.append(buffer, bufferSize);
+        }
+        pos += unitSize;
+    }
+
+    if (!inPlace) {
+        str = std::move(output);
+    }
+}
+
+// Converts a single byte encoding to UTF-8, the runs of ASCII characters are copied 8 bytes at a time
+template <utf::Encoding Base>
+void SingleByteToUtf8(const char* data, size_t size, std::string& output) {
+    using namespace unicode::internal;
+
+    // Compute the final size first so the output is allocated only once
+    size_t outputSize = size;
+    for (size_t pos = FindAsciiRunEnd(data, 0, size); pos < size; pos = FindAsciiRunEnd(data, pos + 1, size)) {
+        outputSize += (utf::GetCodePoint<Base>(data + pos, data + pos + 1) < 0x800) ? 1 : 2;
+    }
+
+    output.resize(outputSize);
+    char* out = output.data();
+    size_t pos = 0;
+    while (pos < size) {
+        size_t asciiEnd = FindAsciiRunEnd(data, pos, size);
+        out = std::copy(data + pos, data + asciiEnd, out);
+        if (asciiEnd == size) {
+            break;
+        }
+        utf::CodeUnit<utf::UTF_8> unit(utf::GetCodePoint<Base>(data + asciiEnd, data + asciiEnd + 1));
+        out = std::copy(unit.begin(), unit.end(), out);
+        pos = asciiEnd + 1;
+    }
+}
+
+// Converts a valid UTF-8 string to a single byte encoding
+template <utf::Encoding Base>
+std::string Utf8ToSingleByte(const std::string& str, EncodingErrorPolicy policy) {
+    using namespace unicode::internal;
+    const char* data = str.data();
+    const size_t size = str.size();
+
+    std::string output;
+    output.reserve(size);
+    size_t pos = 0;
+    while (pos < size) {
+        size_t asciiEnd = FindAsciiRunEnd(data, pos, size);
+        output.append(data + pos, asciiEnd - pos);
+        if (asciiEnd == size) {
+            break;
+        }
+        size_t unitSize = utf::internal::GetUnitSize<utf::UTF_8>(data + asciiEnd);
+        char32_t codePoint = utf::GetCodePoint<utf::UTF_8>(data + asciiEnd, data + asciiEnd + unitSize);
+        utf::CodeUnit<Base> unit(codePoint);
+        if (policy == EncodingErrorPolicy::THROW && unit.getCodePoint() != codePoint) {
+            EDOTOOLS_THROW(std::range_error("the string contains code points that can not be represented"));
+        }
+        output.push_back(static_cast<char>(*unit.begin()));
+        pos = asciiEnd + unitSize;
+    }
+    return output;
+}
+
+}  // namespace
+
 const String::size_type String::sInvalidPos = std::basic_string<char>::npos;
 
 String::String() = default;
@@ -161,7 +283,47 @@ String String::FromUtf8(const char* begin, const char* end) {
 }
 
 String String::FromUtf8(iterator begin, iterator end) {
-    return FromUtf8(begin.getPtr(), end.getPtr());
+    // The iterators always point to an already validated string
+    return FromUtf8Unchecked(begin.getPtr(), end.getPtr());
+}
+
+String String::FromUtf8Unchecked(const char* begin, const char* end) {
+    String string;
+    string.m_string.assign(begin, end);
+    return string;
+}
+
+String String::FromUtf8Unchecked(std::basic_string<char>&& utf8String) {
+    String string;
+    string.m_string = std::move(utf8String);
+    return string;
+}
+
+String String::FromLatin1(const char* begin, const char* end) {
+    String string;
+    SingleByteToUtf8<utf::LATIN_1>(begin, end - begin, string.m_string);
+    return string;
+}
+
+String String::FromLatin1(std::basic_string<char>&& latin1String) {
+    if (unicode::internal::FindAsciiRunEnd(latin1String.data(), 0, latin1String.size()) == latin1String.size()) {
+        return FromUtf8Unchecked(std::move(latin1String));
+    }
+    return FromLatin1(latin1String.data(), latin1String.data() + latin1String.size());
+}
+
+String String::FromWindows1252(const char* begin, const char* end) {
+    String string;
+    SingleByteToUtf8<utf::WINDOWS_1252>(begin, end - begin, string.m_string);
+    return string;
+}
+
+String String::FromWindows1252(std::basic_string<char>&& windows1252String) {
+    if (unicode::internal::FindAsciiRunEnd(windows1252String.data(), 0, windows1252String.size()) ==
+        windows1252String.size()) {
+        return FromUtf8Unchecked(std::move(windows1252String));
+    }
+    return FromWindows1252(windows1252String.data(), windows1252String.data() + windows1252String.size());
 }
 
 String String::FromUtf16(const char16_t* begin, const char16_t* end) {
@@ -206,24 +368,47 @@ const std::basic_string<char>& String::toUtf8() const {
 
 std::basic_string<char16_t> String::toUtf16() const {
     std::basic_string<char16_t> output;
-    utf::UtfToUtf<utf::UTF_8, utf::UTF_16>(m_string.cbegin(), m_string.cend(), &output);
+    toUtf16Into(output);
     return output;
 }
 
 std::basic_string<char32_t> String::toUtf32() const {
     std::basic_string<char32_t> output;
-    utf::UtfToUtf<utf::UTF_8, utf::UTF_32>(m_string.cbegin(), m_string.cend(), &output);
+    toUtf32Into(output);
     return output;
 }
 
 std::basic_string<wchar_t> String::toWide() const {
     std::basic_string<wchar_t> output;
+    toWideInto(output);
+    return output;
+}
+
+void String::toUtf16Into(std::basic_string<char16_t>& output) const {
+    output.clear();
+    utf::UtfToUtf<utf::UTF_8, utf::UTF_16>(m_string.cbegin(), m_string.cend(), &output);
+}
+
+void String::toUtf32Into(std::basic_string<char32_t>& output) const {
+    output.clear();
+    utf::UtfToUtf<utf::UTF_8, utf::UTF_32>(m_string.cbegin(), m_string.cend(), &output);
+}
+
+void String::toWideInto(std::basic_string<wchar_t>& output) const {
+    output.clear();
 #if PLATFORM_IS(PLATFORM_WINDOWS)
     utf::UtfToUtf<utf::UTF_8, utf::UTF_16>(m_string.cbegin(), m_string.cend(), &output);
 #else
     utf::UtfToUtf<utf::UTF_8, utf::UTF_32>(m_string.cbegin(), m_string.cend(), &output);
 #endif
-    return output;
+}
+
+std::basic_string<char> String::toLatin1(EncodingErrorPolicy policy) const {
+    return Utf8ToSingleByte<utf::LATIN_1>(m_string, policy);
+}
+
+std::basic_string<char> String::toWindows1252(EncodingErrorPolicy policy) const {
+    return Utf8ToSingleByte<utf::WINDOWS_1252>(m_string, policy);
 }
 
 String& String::operator=(const String& right) = default;
@@ -376,6 +561,42 @@ bool String::endsWith(const StringView& other) const {
     return StringView(*this).endsWith(other);
 }
 
+bool String::equalsIgnoreCase(const StringView& other) const {
+    return StringView(*this).equalsIgnoreCase(other);
+}
+
+std::strong_ordering String::compareIgnoreCase(const StringView& other) const {
+    return StringView(*this).compareIgnoreCase(other);
+}
+
+String::size_type String::findIgnoreCase(const StringView& str, size_type start) const {
+    return StringView(*this).findIgnoreCase(str, start);
+}
+
+String::size_type String::countGraphemes() const {
+    return StringView(*this).countGraphemes();
+}
+
+String String::truncateGraphemes(size_type count) const {
+    StringView view = StringView(*this).truncateGraphemes(count);
+    return String::FromUtf8Unchecked(view.getData(), view.getData() + view.getDataSize());
+}
+
+String String::trim() const {
+    StringView view = StringView(*this).trim();
+    return String::FromUtf8Unchecked(view.getData(), view.getData() + view.getDataSize());
+}
+
+String String::trimStart() const {
+    StringView view = StringView(*this).trimStart();
+    return String::FromUtf8Unchecked(view.getData(), view.getData() + view.getDataSize());
+}
+
+String String::trimEnd() const {
+    StringView view = StringView(*this).trimEnd();
+    return String::FromUtf8Unchecked(view.getData(), view.getData() + view.getDataSize());
+}
+
 void String::replace(size_type position, size_type length, const StringView& replaceWith) {
     size_type utf8StrSize = getSize();
     if ((position + length) > utf8StrSize) {
@@ -440,7 +661,103 @@ String String::subString(size_type position, size_type length) const {
     auto endIt = startIt + length;
 
     // Create a new string with given range
-    return String::FromUtf8(startIt.getPtr(), endIt.getPtr());
+    return String::FromUtf8Unchecked(startIt.getPtr(), endIt.getPtr());
+}
+
+String::size_type String::findBytes(const StringView& str, size_type offset) const {
+    return StringView(*this).findBytes(str, offset);
+}
+
+String String::subStringBytes(size_type offset, size_type count) const {
+    StringView view = StringView(*this).subStringBytes(offset, count);
+    return String::FromUtf8Unchecked(view.getData(), view.getData() + view.getDataSize());
+}
+
+void String::eraseBytes(size_type offset, size_type count) {
+    StringView view = StringView(*this).subStringBytes(offset, count);
+    m_string.erase(offset, view.getDataSize());
+}
+
+void String::insertBytes(size_type offset, const StringView& str) {
+    if (offset > m_string.size()) {
+        EDOTOOLS_THROW(std::out_of_range("the specified position is out of the string range"));
+    }
+    if (!isCodePointBoundary(offset)) {
+        EDOTOOLS_THROW(std::invalid_argument("the specified offset is not at a code point boundary"));
+    }
+    m_string.insert(offset, str.getData(), str.getDataSize());
+}
+
+void String::replaceBytes(size_type offset, size_type count, const StringView& replaceWith) {
+    StringView view = StringView(*this).subStringBytes(offset, count);
+    m_string.replace(offset, view.getDataSize(), replaceWith.getData(), replaceWith.getDataSize());
+}
+
+bool String::isCodePointBoundary(size_type offset) const {
+    return StringView(*this).isCodePointBoundary(offset);
+}
+
+String::size_type String::toByteOffset(size_type position) const {
+    return StringView(*this).toByteOffset(position);
+}
+
+String::size_type String::toCodePointIndex(size_type offset) const {
+    return StringView(*this).toCodePointIndex(offset);
+}
+
+String String::toLower() const& {
+    return String(*this).toLower();
+}
+
+String String::toLower() && {
+    ApplyCaseMapping(m_string, unicode::CaseMapping::LOWER);
+    return std::move(*this);
+}
+
+String String::toUpper() const& {
+    return String(*this).toUpper();
+}
+
+String String::toUpper() && {
+    ApplyCaseMapping(m_string, unicode::CaseMapping::UPPER);
+    return std::move(*this);
+}
+
+String String::caseFold() const& {
+    return String(*this).caseFold();
+}
+
+String String::caseFold() && {
+    ApplyCaseMapping(m_string, unicode::CaseMapping::FOLD);
+    return std::move(*this);
+}
+
+String String::normalize(unicode::NormalizationForm form) const& {
+    if (unicode::QuickCheck(*this, form) == unicode::QuickCheckResult::YES) {
+        return *this;
+    }
+    String result;
+    unicode::internal::NormalizeUnchecked(*this, form, result.m_string);
+    return result;
+}
+
+String String::normalize(unicode::NormalizationForm form) && {
+    if (unicode::QuickCheck(*this, form) == unicode::QuickCheckResult::YES) {
+        return std::move(*this);
+    }
+    String result;
+    unicode::internal::NormalizeUnchecked(*this, form, result.m_string);
+    return result;
+}
+
+bool String::isNormalized(unicode::NormalizationForm form) const {
+    return unicode::IsNormalized(*this, form);
+}
+
+std::string String::getSortKey(unicode::CollationStrength strength) const {
+    std::string key;
+    unicode::GetSortKey(*this, key, strength);
+    return key;
 }
 
 const char* String::getData() const {
@@ -1,9 +1,81 @@
 #include <edoren/StringView.hpp>
 
 #include <edoren/String.hpp>
+#include <edoren/Unicode.hpp>
+
+#include "unicode/Ascii.hpp"
 
 namespace edoren {
 
+namespace {
+
+using namespace unicode::internal;
+
+// Produces the case folded code points of a valid UTF-8 string without allocating memory
+class CaseFoldCursor {
+public:
+    CaseFoldCursor(const StringView& str) : m_ptr(str.getData()), m_end(str.getData() + str.getDataSize()) {}
+
+    bool next(char32_t& codePoint) {
+        if (m_index == m_size) {
+            if (m_ptr == m_end) {
+                return false;
+            }
+            if ((static_cast<unsigned char>(*m_ptr) & 0x80) == 0) {
+                codePoint = static_cast<unsigned char>(ToLowerAscii(*m_ptr++));
+                return true;
+            }
+            size_t unitSize = utf::internal::GetUnitSize<utf::UTF_8>(m_ptr);
+            char32_t source = utf::GetCodePoint<utf::UTF_8>(m_ptr, m_ptr + unitSize);
+            m_ptr += unitSize;
+            m_size = unicode::MapCase(source, unicode::CaseMapping::FOLD, m_buffer);
+            m_index = 0;
+        }
+        codePoint = m_buffer[m_index++];
+        return true;
+    }
+
+    // Returns true if all the folded code points of the last source code point were consumed
+    bool isAtBoundary() const {
+        return m_index == m_size;
+    }
+
+    const char* getPtr() const {
+        return m_ptr;
+    }
+
+    size_t getRemaining() const {
+        return m_end - m_ptr;
+    }
+
+    void skip(size_t bytes) {
+        m_ptr += bytes;
+    }
+
+private:
+    const char* m_ptr;
+    const char* m_end;
+    char32_t m_buffer[unicode::sMaxCaseMappingSize] = {};
+    size_t m_size = 0;
+    size_t m_index = 0;
+};
+
+// Skips the ASCII words that are equal in both strings once folded
+void SkipEqualAsciiWords(CaseFoldCursor& left, CaseFoldCursor& right) {
+    while (left.isAtBoundary() && right.isAtBoundary() && left.getRemaining() >= sizeof(uint64_t) &&
+           right.getRemaining() >= sizeof(uint64_t)) {
+        uint64_t leftWord = LoadWord(left.getPtr());
+        uint64_t rightWord = LoadWord(right.getPtr());
+        if (!IsAsciiWord(leftWord | rightWord) || ToLowerAsciiWord(leftWord) != ToLowerAsciiWord(rightWord)) {
+            return;
+        }
+        left.skip(sizeof(uint64_t));
+        right.skip(sizeof(uint64_t));
+    }
+}
+
+}  // namespace
+
 StringView::StringView(const char8_t* utf8String) : StringView(reinterpret_cast<const char*>(utf8String)) {}
 
 StringView::StringView(const String& string) : m_data(string.getData()), m_size(string.getDataSize()) {}
@@ -18,6 +90,136 @@ StringView& StringView::operator=(const char8_t* right) {
     return operator=(reinterpret_cast<const char*>(right));
 }
 
+bool StringView::equalsIgnoreCase(const StringView& other) const {
+    return compareIgnoreCase(other) == 0;
+}
+
+std::strong_ordering StringView::compareIgnoreCase(const StringView& other) const {
+    CaseFoldCursor left(*this);
+    CaseFoldCursor right(other);
+    while (true) {
+        SkipEqualAsciiWords(left, right);
+        char32_t leftCodePoint;
+        char32_t rightCodePoint;
+        bool hasLeft = left.next(leftCodePoint);
+        bool hasRight = right.next(rightCodePoint);
+        if (!hasLeft || !hasRight) {
+            return hasLeft <=> hasRight;
+        }
+        if (leftCodePoint != rightCodePoint) {
+            return leftCodePoint <=> rightCodePoint;
+        }
+    }
+}
+
+StringView::size_type StringView::findIgnoreCase(const StringView& str, size_type start) const {
+    size_type offset = toByteOffset(start);
+    if (offset == sInvalidPos || offset == m_size) {
+        return sInvalidPos;
+    }
+
+    for (size_type position = start; offset < m_size; ++position) {
+        CaseFoldCursor haystack(StringView(m_data + offset, m_size - offset, utf::AssumeValid));
+        CaseFoldCursor needle(str);
+        while (true) {
+            SkipEqualAsciiWords(haystack, needle);
+            char32_t needleCodePoint;
+            char32_t haystackCodePoint;
+            if (!needle.next(needleCodePoint)) {
+                // The match must not end in the middle of a folded code point
+                if (haystack.isAtBoundary()) {
+                    return position;
+                }
+                break;
+            }
+            if (!haystack.next(haystackCodePoint) || haystackCodePoint != needleCodePoint) {
+                break;
+            }
+        }
+        offset += utf::internal::GetUnitSize<utf::UTF_8>(m_data + offset);
+    }
+    return sInvalidPos;
+}
+
+StringView::size_type StringView::countGraphemes() const {
+    size_type count = 0;
+    const char* end = m_data + m_size;
+    for (const char* it = m_data; it != end; it = unicode::FindGraphemeBoundary(it, end)) {
+        ++count;
+    }
+    return count;
+}
+
+StringView StringView::truncateGraphemes(size_type count) const {
+    const char* end = m_data + m_size;
+    const char* it = m_data;
+    for (size_type i = 0; i < count && it != end; ++i) {
+        it = unicode::FindGraphemeBoundary(it, end);
+    }
+    return StringView(m_data, it - m_data, utf::AssumeValid);
+}
+
+StringView StringView::trim() const {
+    return trimStart().trimEnd();
+}
+
+StringView StringView::trimStart() const {
+    size_type offset = unicode::FindFirstNotOfClass(*this, unicode::CharacterClass::SPACE);
+    if (offset == sInvalidPos) {
+        return StringView();
+    }
+    return StringView(m_data + offset, m_size - offset, utf::AssumeValid);
+}
+
+StringView StringView::trimEnd() const {
+    size_type size = m_size;
+    while (size > 0) {
+        size_type start = size - 1;
+        while (start > 0 && (static_cast<unsigned char>(m_data[start]) & 0xC0) == 0x80) {
+            --start;
+        }
+        if (!unicode::IsSpace(utf::GetCodePoint<utf::UTF_8>(m_data + start, m_data + size))) {
+            break;
+        }
+        size = start;
+    }
+    return StringView(m_data, size, utf::AssumeValid);
+}
+
+size_t IgnoreCaseHash::operator()(const StringView& str) const {
+    // FNV-1a over the case folded code points
+    size_t hash = (sizeof(size_t) == 8) ? size_t(0xcbf29ce484222325ULL) : size_t(0x811c9dc5UL);
+    const size_t prime = (sizeof(size_t) == 8) ? size_t(0x100000001b3ULL) : size_t(0x01000193UL);
+
+    CaseFoldCursor cursor(str);
+    while (true) {
+        while (cursor.isAtBoundary() && cursor.getRemaining() >= sizeof(uint64_t)) {
+            uint64_t word = LoadWord(cursor.getPtr());
+            if (!IsAsciiWord(word)) {
+                break;
+            }
+            word = ToLowerAsciiWord(word);
+            char bytes[sizeof(uint64_t)];
+            std::memcpy(bytes, &word, sizeof(uint64_t));
+            for (char byte : bytes) {
+                hash ^= static_cast<unsigned char>(byte);
+                hash *= prime;
+            }
+            cursor.skip(sizeof(uint64_t));
+        }
+        char32_t codePoint;
+        if (!cursor.next(codePoint)) {
+            return hash;
+        }
+        hash ^= codePoint;
+        hash *= prime;
+    }
+}
+
+bool IgnoreCaseEqual::operator()(const StringView& left, const StringView& right) const {
+    return left.equalsIgnoreCase(right);
+}
+
 }  // namespace edoren
 
 #ifdef EDOTOOLS_NLOHMANN_JSON_SUPPORT
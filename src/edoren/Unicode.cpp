@@ -0,0 +1,749 @@
+#include <edoren/Unicode.hpp>
+
+#include <edoren/UTF.hpp>
+
+#include "unicode/Ascii.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string_view>
+
+namespace edoren::unicode {
+
+namespace internal {
+
+struct CaseRecord {
+    int32_t lowerDelta;
+    int32_t upperDelta;
+    int32_t foldDelta;
+    uint8_t lowerSequence;
+    uint8_t upperSequence;
+    uint8_t foldSequence;
+};
+
+struct CaseSequence {
+    uint8_t size;
+    char32_t data[sMaxCaseMappingSize];
+};
+
+struct NormalizationRecord {
+    uint8_t combiningClass;
+    uint8_t quickCheck;
+};
+
+struct DecompositionRecord {
+    uint16_t canonical;
+    uint16_t compatibility;
+};
+
+struct CompositionRecord {
+    char32_t first;
+    char32_t second;
+    char32_t composite;
+};
+
+struct CollationContraction {
+    char32_t sequence[3];
+    uint32_t elements;
+};
+
+struct CollationImplicitRange {
+    char32_t first;
+    char32_t last;
+    char32_t origin;
+    uint16_t base;
+};
+
+}  // namespace internal
+
+}  // namespace edoren::unicode
+
+#include "unicode/CaseTables.inl"
+#include "unicode/NormalizationTables.inl"
+#include "unicode/GraphemeTables.inl"
+#include "unicode/CollationTables.inl"
+
+namespace edoren::unicode {
+
+namespace {
+
+template <typename Stage1, typename Stage2>
+uint32_t GetStageValue(char32_t codePoint, const Stage1& stage1, const Stage2& stage2, uint32_t shift) {
+    uint32_t block = stage1[codePoint >> shift];
+    uint32_t offset = codePoint & ((1 << shift) - 1);
+    return stage2[(block << shift) + offset];
+}
+
+const internal::CaseRecord& GetCaseRecord(char32_t codePoint) {
+    using namespace internal;
+    if (codePoint > sCaseMaxCodePoint) {
+        return sCaseRecords[0];
+    }
+    return sCaseRecords[GetStageValue(codePoint, sCaseStage1, sCaseStage2, sCaseBlockShift)];
+}
+
+const internal::NormalizationRecord& GetNormalizationRecord(char32_t codePoint) {
+    using namespace internal;
+    if (codePoint > sNormalizationMaxCodePoint) {
+        return sNormalizationRecords[0];
+    }
+    return sNormalizationRecords[GetStageValue(
+        codePoint, sNormalizationStage1, sNormalizationStage2, sNormalizationBlockShift)];
+}
+
+QuickCheckResult GetQuickCheck(const internal::NormalizationRecord& record, NormalizationForm form) {
+    uint8_t value = 0;
+    switch (form) {
+        case NormalizationForm::NFD:
+            value = record.quickCheck & 0x01;
+            break;
+        case NormalizationForm::NFKD:
+            value = (record.quickCheck >> 1) & 0x01;
+            break;
+        case NormalizationForm::NFC:
+            value = (record.quickCheck >> 2) & 0x03;
+            break;
+        case NormalizationForm::NFKC:
+            value = (record.quickCheck >> 4) & 0x03;
+            break;
+    }
+    return (value == 0) ? QuickCheckResult::YES : (value == 1) ? QuickCheckResult::NO : QuickCheckResult::MAYBE;
+}
+
+// Hangul syllables are decomposed and composed algorithmically,
+// see section 3.12 of the Unicode Standard
+constexpr char32_t sHangulSBase = 0xAC00;
+constexpr char32_t sHangulLBase = 0x1100;
+constexpr char32_t sHangulVBase = 0x1161;
+constexpr char32_t sHangulTBase = 0x11A7;
+constexpr char32_t sHangulLCount = 19;
+constexpr char32_t sHangulVCount = 21;
+constexpr char32_t sHangulTCount = 28;
+constexpr char32_t sHangulNCount = sHangulVCount * sHangulTCount;
+constexpr char32_t sHangulSCount = sHangulLCount * sHangulNCount;
+
+void Decompose(const StringView& str, bool compatibility, std::u32string& output) {
+    const char* data = str.getData();
+    size_t size = str.getDataSize();
+    size_t pos = 0;
+
+    while (pos < size) {
+        size_t unitSize = utf::internal::GetUnitSize<utf::UTF_8>(data + pos);
+        char32_t codePoint = utf::GetCodePoint<utf::UTF_8>(data + pos, data + pos + unitSize);
+        pos += unitSize;
+
+        if (codePoint >= sHangulSBase && codePoint < sHangulSBase + sHangulSCount) {
+            char32_t index = codePoint - sHangulSBase;
+            output += sHangulLBase + index / sHangulNCount;
+            output += sHangulVBase + (index % sHangulNCount) / sHangulTCount;
+            if (index % sHangulTCount != 0) {
+                output += sHangulTBase + index % sHangulTCount;
+            }
+            continue;
+        }
+
+        uint16_t offset = 0;
+        if (codePoint <= internal::sNormalizationMaxCodePoint) {
+            const auto& record = internal::sDecompositionRecords[GetStageValue(codePoint,
+                                                                               internal::sDecompositionStage1,
+                                                                               internal::sDecompositionStage2,
+                                                                               internal::sNormalizationBlockShift)];
+            offset = compatibility ? record.compatibility : record.canonical;
+        }
+        if (offset == 0) {
+            output += codePoint;
+        } else {
+            const char32_t* sequence = &internal::sDecompositionData[offset];
+            output.append(sequence + 1, sequence + 1 + sequence[0]);
+        }
+    }
+
+    // Canonical ordering, sort each sequence of non starters by its combining class
+    for (size_t i = 1; i < output.size(); ++i) {
+        uint8_t combiningClass = GetCombiningClass(output[i]);
+        if (combiningClass == 0) {
+            continue;
+        }
+        size_t j = i;
+        while (j > 0) {
+            uint8_t previousClass = GetCombiningClass(output[j - 1]);
+            if (previousClass == 0 || previousClass <= combiningClass) {
+                break;
+            }
+            std::swap(output[j - 1], output[j]);
+            --j;
+        }
+    }
+}
+
+char32_t ComposePair(char32_t first, char32_t second) {
+    // <L, V> and <LV, T> Hangul compositions
+    if (first >= sHangulLBase && first < sHangulLBase + sHangulLCount && second >= sHangulVBase &&
+        second < sHangulVBase + sHangulVCount) {
+        return sHangulSBase + ((first - sHangulLBase) * sHangulVCount + (second - sHangulVBase)) * sHangulTCount;
+    }
+    if (first >= sHangulSBase && first < sHangulSBase + sHangulSCount && (first - sHangulSBase) % sHangulTCount == 0 &&
+        second > sHangulTBase && second < sHangulTBase + sHangulTCount) {
+        return first + (second - sHangulTBase);
+    }
+
+    const auto* begin = std::begin(internal::sCompositionRecords);
+    const auto* end = std::end(internal::sCompositionRecords);
+    const auto* it = std::lower_bound(begin, end, std::make_pair(first, second), [](const auto& record, const auto& key) {
+        return std::make_pair(record.first, record.second) < key;
+    });
+    if (it != end && it->first == first && it->second == second) {
+        return it->composite;
+    }
+    return 0;
+}
+
+void Compose(std::u32string& str) {
+    if (str.empty()) {
+        return;
+    }
+
+    size_t starterPos = 0;
+    char32_t starter = str[0];
+    uint16_t lastClass = GetCombiningClass(starter);
+    if (lastClass != 0) {
+        lastClass = 256;  // Avoid composing with a non starter at the beginning
+    }
+
+    size_t writePos = 1;
+    for (size_t i = 1; i < str.size(); ++i) {
+        char32_t codePoint = str[i];
+        uint16_t combiningClass = GetCombiningClass(codePoint);
+        char32_t composite = ComposePair(starter, codePoint);
+        if (composite != 0 && (lastClass < combiningClass || lastClass == 0)) {
+            str[starterPos] = composite;
+            starter = composite;
+            continue;
+        }
+        if (combiningClass == 0) {
+            starterPos = writePos;
+            starter = codePoint;
+        }
+        lastClass = combiningClass;
+        str[writePos++] = codePoint;
+    }
+    str.resize(writePos);
+}
+
+enum GraphemeBreak : uint8_t {
+    GRAPHEME_OTHER,
+    GRAPHEME_CR,
+    GRAPHEME_LF,
+    GRAPHEME_CONTROL,
+    GRAPHEME_EXTEND,
+    GRAPHEME_ZWJ,
+    GRAPHEME_REGIONAL_INDICATOR,
+    GRAPHEME_PREPEND,
+    GRAPHEME_SPACING_MARK,
+    GRAPHEME_L,
+    GRAPHEME_V,
+    GRAPHEME_T,
+    GRAPHEME_LV,
+    GRAPHEME_LVT,
+};
+
+constexpr uint8_t sGraphemePictographicBit = 0x10;
+
+uint8_t GetGraphemeProperty(char32_t codePoint) {
+    using namespace internal;
+    if (codePoint > sGraphemeMaxCodePoint) {
+        return GRAPHEME_OTHER;
+    }
+    return static_cast<uint8_t>(GetStageValue(codePoint, sGraphemeStage1, sGraphemeStage2, sGraphemeBlockShift));
+}
+
+// Collation element values are packed as (primary << 16) | (secondary << 5) | tertiary, the
+// entries of the tables reference them as (offset << 6) | (size << 1) | startsContraction
+constexpr uint32_t sCollationContractionBit = 0x01;
+
+uint32_t GetCollationValue(char32_t codePoint) {
+    using namespace internal;
+    if (codePoint > sCollationMaxCodePoint) {
+        return 0;
+    }
+    return GetStageValue(codePoint, sCollationStage1, sCollationStage2, sCollationBlockShift);
+}
+
+char32_t DecodeUtf8(const char*& it) {
+    if ((static_cast<unsigned char>(*it) & 0x80) == 0) {
+        return static_cast<unsigned char>(*it++);
+    }
+    size_t unitSize = utf::internal::GetUnitSize<utf::UTF_8>(it);
+    char32_t codePoint = utf::GetCodePoint<utf::UTF_8>(it, it + unitSize);
+    it += unitSize;
+    return codePoint;
+}
+
+// Produces the collation elements of a valid UTF-8 string in NFD without allocating memory
+class CollationElementCursor {
+public:
+    CollationElementCursor(const StringView& str) : m_ptr(str.getData()), m_end(str.getData() + str.getDataSize()) {}
+
+    bool next(uint32_t& element) {
+        while (m_remaining == 0) {
+            if (m_pendingIndex == m_pendingSize && m_ptr == m_end) {
+                return false;
+            }
+            char32_t codePoint = nextCodePoint();
+            uint32_t value = GetCollationValue(codePoint);
+            if ((value & sCollationContractionBit) != 0) {
+                value = matchContraction(codePoint, value);
+            }
+            if ((value >> 1) == 0) {
+                setImplicitElements(codePoint);
+            } else {
+                m_elements = internal::sCollationElements + (value >> 6);
+                m_remaining = (value >> 1) & 0x1F;
+            }
+        }
+        element = *m_elements++;
+        --m_remaining;
+        return true;
+    }
+
+private:
+    static constexpr size_t sMaxLookahead = 32;
+    static constexpr size_t sMaxContractionSize = 3;
+
+    char32_t nextCodePoint() {
+        if (m_pendingIndex != m_pendingSize) {
+            return m_pending[m_pendingIndex++];
+        }
+        return DecodeUtf8(m_ptr);
+    }
+
+    const internal::CollationContraction* findContraction(const char32_t* sequence, size_t size) const {
+        using namespace internal;
+        auto range = std::equal_range(std::begin(sCollationContractions), std::end(sCollationContractions),
+                                      sequence[0], ContractionFirstLess());
+        for (auto contraction = range.first; contraction != range.second; ++contraction) {
+            if (contraction->sequence[1] == sequence[1] &&
+                contraction->sequence[2] == (size == sMaxContractionSize ? sequence[2] : 0)) {
+                return contraction;
+            }
+        }
+        return nullptr;
+    }
+
+    // Finds the longest contraction that starts with `codePoint` following the steps S2.1 of UTS #10.
+    // The code points that are not part of the match are stored to be processed later.
+    uint32_t matchContraction(char32_t codePoint, uint32_t value) {
+        // The two following code points can be part of a contiguous match, after them only the
+        // non-starters can be part of a discontiguous match
+        char32_t ahead[sMaxLookahead];
+        uint8_t aheadClasses[sMaxLookahead];
+        size_t aheadSize = 0;
+        while (aheadSize < sMaxLookahead && (m_pendingIndex != m_pendingSize || m_ptr != m_end)) {
+            ahead[aheadSize] = nextCodePoint();
+            aheadClasses[aheadSize] = GetCombiningClass(ahead[aheadSize]);
+            if (aheadClasses[aheadSize++] == 0 && aheadSize > 2) {
+                break;
+            }
+        }
+
+        char32_t sequence[sMaxContractionSize] = {codePoint};
+        size_t sequenceSize = 1;
+        bool consumed[sMaxLookahead] = {};
+        size_t index = 0;
+
+        // Contiguous match
+        for (size_t size = std::min<size_t>(aheadSize, sMaxContractionSize - 1); size > 0; --size) {
+            std::copy(ahead, ahead + size, sequence + 1);
+            if (const internal::CollationContraction* contraction = findContraction(sequence, size + 1)) {
+                value = contraction->elements;
+                sequenceSize = size + 1;
+                std::fill(consumed, consumed + size, true);
+                index = size;
+                break;
+            }
+        }
+
+        // Discontiguous match of the unblocked non-starters
+        uint8_t maxSkippedClass = 0;
+        for (; index < aheadSize && aheadClasses[index] != 0 && sequenceSize < sMaxContractionSize; ++index) {
+            if (aheadClasses[index] > maxSkippedClass) {
+                sequence[sequenceSize] = ahead[index];
+                if (const internal::CollationContraction* contraction = findContraction(sequence, sequenceSize + 1)) {
+                    value = contraction->elements;
+                    ++sequenceSize;
+                    consumed[index] = true;
+                    continue;
+                }
+            }
+            maxSkippedClass = std::max(maxSkippedClass, aheadClasses[index]);
+        }
+
+        // Keep the code points that were not consumed, in order, before the ones still pending
+        char32_t remaining[sMaxLookahead * 2];
+        size_t remainingSize = 0;
+        for (size_t i = 0; i < aheadSize; ++i) {
+            if (!consumed[i]) {
+                remaining[remainingSize++] = ahead[i];
+            }
+        }
+        for (size_t i = m_pendingIndex; i < m_pendingSize; ++i) {
+            remaining[remainingSize++] = m_pending[i];
+        }
+        std::copy(remaining, remaining + remainingSize, m_pending);
+        m_pendingIndex = 0;
+        m_pendingSize = remainingSize;
+        return value;
+    }
+
+    // Derives the weights of the code points that are not in the table, see UTS #10 section 10.1
+    void setImplicitElements(char32_t codePoint) {
+        using namespace internal;
+        char32_t origin = 0;
+        uint32_t base = 0xFBC0;  // Unassigned code points
+        auto range = std::upper_bound(std::begin(sCollationImplicitRanges), std::end(sCollationImplicitRanges),
+                                      codePoint,
+                                      [](char32_t cp, const CollationImplicitRange& r) { return cp < r.first; });
+        if (range != std::begin(sCollationImplicitRanges) && codePoint <= (range - 1)->last) {
+            origin = (range - 1)->origin;
+            base = (range - 1)->base;
+        }
+        uint32_t offset = codePoint - origin;
+        m_implicit[0] = ((base + (offset >> 15)) << 16) | (0x20 << 5) | 0x02;
+        m_implicit[1] = ((offset & 0x7FFF) | 0x8000) << 16;
+        m_elements = m_implicit;
+        m_remaining = 2;
+    }
+
+    struct ContractionFirstLess {
+        bool operator()(const internal::CollationContraction& left, char32_t right) const {
+            return left.sequence[0] < right;
+        }
+        bool operator()(char32_t left, const internal::CollationContraction& right) const {
+            return left < right.sequence[0];
+        }
+    };
+
+    const char* m_ptr;
+    const char* m_end;
+    const uint32_t* m_elements = nullptr;
+    size_t m_remaining = 0;
+    uint32_t m_implicit[2] = {};
+    char32_t m_pending[sMaxLookahead * 2] = {};  // Code points read ahead by a contraction that were not consumed
+    size_t m_pendingIndex = 0;
+    size_t m_pendingSize = 0;
+};
+
+uint32_t GetCollationWeight(uint32_t element, size_t level) {
+    switch (level) {
+        case 0:
+            return element >> 16;
+        case 1:
+            return (element >> 5) & 0x1FF;
+        default:
+            return element & 0x1F;
+    }
+}
+
+// Sets the high bit of the bytes that belong to the class in a word that only contains ASCII
+uint64_t ClassifyAsciiWord(uint64_t word, CharacterClass cls) {
+    using namespace internal;
+    switch (cls) {
+        case CharacterClass::SPACE:
+            return AsciiRangeMask(word, '\t', '\r') | AsciiRangeMask(word, ' ', ' ');
+        case CharacterClass::ALPHA:
+            // Setting the bit 0x20 converts the uppercase letters to lowercase without creating new letters
+            return AsciiRangeMask(word | (sAsciiOnes * 0x20), 'a', 'z');
+        case CharacterClass::DIGIT:
+            return AsciiRangeMask(word, '0', '9');
+        case CharacterClass::ALPHANUMERIC:
+            return AsciiRangeMask(word | (sAsciiOnes * 0x20), 'a', 'z') | AsciiRangeMask(word, '0', '9');
+        case CharacterClass::PUNCTUATION:
+            return AsciiRangeMask(word, '!', '#') | AsciiRangeMask(word, '%', '*') | AsciiRangeMask(word, ',', '/') |
+                   AsciiRangeMask(word, ':', ';') | AsciiRangeMask(word, '?', '@') | AsciiRangeMask(word, '[', ']') |
+                   AsciiRangeMask(word, '_', '_') | AsciiRangeMask(word, '{', '{') | AsciiRangeMask(word, '}', '}');
+    }
+    return 0;
+}
+
+// Returns the byte offset of the first code point whose membership to the class is `Belongs`
+template <bool Belongs>
+size_t FindClass(const StringView& str, CharacterClass cls, size_t offset) {
+    using namespace internal;
+    const char* data = str.getData();
+    const size_t size = str.getDataSize();
+    size_t pos = offset;
+    while (pos < size) {
+        if (pos + sizeof(uint64_t) <= size) {
+            uint64_t word = LoadWord(data + pos);
+            if (IsAsciiWord(word)) {
+                uint64_t mask = ClassifyAsciiWord(word, cls);
+                if constexpr (!Belongs) {
+                    mask = ~mask & sAsciiHighBits;
+                }
+                if (mask != 0) {
+                    return pos + FirstMaskedByte(mask);
+                }
+                pos += sizeof(uint64_t);
+                continue;
+            }
+        }
+        size_t unitSize = utf::internal::GetUnitSize<utf::UTF_8>(data + pos);
+        char32_t codePoint = utf::GetCodePoint<utf::UTF_8>(data + pos, data + pos + unitSize);
+        if (IsInClass(codePoint, cls) == Belongs) {
+            return pos;
+        }
+        pos += unitSize;
+    }
+    return StringView::sInvalidPos;
+}
+
+}  // namespace
+
+char32_t ToLower(char32_t codePoint) {
+    return codePoint + GetCaseRecord(codePoint).lowerDelta;
+}
+
+char32_t ToUpper(char32_t codePoint) {
+    return codePoint + GetCaseRecord(codePoint).upperDelta;
+}
+
+char32_t FoldCase(char32_t codePoint) {
+    return codePoint + GetCaseRecord(codePoint).foldDelta;
+}
+
+size_t MapCase(char32_t codePoint, CaseMapping mapping, char32_t (&output)[sMaxCaseMappingSize]) {
+    const internal::CaseRecord& record = GetCaseRecord(codePoint);
+
+    int32_t delta = 0;
+    uint8_t sequence = 0;
+    switch (mapping) {
+        case CaseMapping::LOWER:
+            delta = record.lowerDelta;
+            sequence = record.lowerSequence;
+            break;
+        case CaseMapping::UPPER:
+            delta = record.upperDelta;
+            sequence = record.upperSequence;
+            break;
+        case CaseMapping::FOLD:
+            delta = record.foldDelta;
+            sequence = record.foldSequence;
+            break;
+    }
+
+    if (sequence != 0) {
+        const internal::CaseSequence& data = internal::sCaseSequences[sequence];
+        for (size_t i = 0; i < data.size; ++i) {
+            output[i] = data.data[i];
+        }
+        return data.size;
+    }
+
+    output[0] = codePoint + delta;
+    return 1;
+}
+
+uint8_t GetCombiningClass(char32_t codePoint) {
+    return GetNormalizationRecord(codePoint).combiningClass;
+}
+
+QuickCheckResult QuickCheck(const StringView& str, NormalizationForm form) {
+    const char* data = str.getData();
+    size_t size = str.getDataSize();
+    size_t pos = 0;
+
+    QuickCheckResult result = QuickCheckResult::YES;
+    uint8_t lastClass = 0;
+    while (pos < size) {
+        // ASCII characters are always starters and normalized in all the forms
+        size_t asciiEnd = internal::FindAsciiRunEnd(data, pos, size);
+        if (asciiEnd != pos) {
+            lastClass = 0;
+            pos = asciiEnd;
+            continue;
+        }
+
+        size_t unitSize = utf::internal::GetUnitSize<utf::UTF_8>(data + pos);
+        char32_t codePoint = utf::GetCodePoint<utf::UTF_8>(data + pos, data + pos + unitSize);
+        pos += unitSize;
+
+        const internal::NormalizationRecord& record = GetNormalizationRecord(codePoint);
+        if (record.combiningClass != 0 && lastClass > record.combiningClass) {
+            return QuickCheckResult::NO;
+        }
+        QuickCheckResult check = GetQuickCheck(record, form);
+        if (check == QuickCheckResult::NO) {
+            return QuickCheckResult::NO;
+        }
+        if (check == QuickCheckResult::MAYBE) {
+            result = QuickCheckResult::MAYBE;
+        }
+        lastClass = record.combiningClass;
+    }
+    return result;
+}
+
+bool IsNormalized(const StringView& str, NormalizationForm form) {
+    QuickCheckResult result = QuickCheck(str, form);
+    if (result != QuickCheckResult::MAYBE) {
+        return result == QuickCheckResult::YES;
+    }
+    std::string normalized;
+    internal::NormalizeUnchecked(str, form, normalized);
+    return std::string_view(normalized) == std::string_view(str.getData(), str.getDataSize());
+}
+
+void Normalize(const StringView& str, NormalizationForm form, std::string& output) {
+    if (QuickCheck(str, form) == QuickCheckResult::YES) {
+        output.assign(str.getData(), str.getDataSize());
+        return;
+    }
+    internal::NormalizeUnchecked(str, form, output);
+}
+
+void internal::NormalizeUnchecked(const StringView& str, NormalizationForm form, std::string& output) {
+    output.clear();
+    bool compatibility = (form == NormalizationForm::NFKC || form == NormalizationForm::NFKD);
+    bool composition = (form == NormalizationForm::NFC || form == NormalizationForm::NFKC);
+
+    std::u32string buffer;
+    buffer.reserve(str.getDataSize());
+    Decompose(str, compatibility, buffer);
+    if (composition) {
+        Compose(buffer);
+    }
+
+    output.reserve(str.getDataSize());
+    utf::UtfToUtf<utf::UTF_32, utf::UTF_8>(buffer.cbegin(), buffer.cend(), &output);
+}
+
+const char* FindGraphemeBoundary(const char* begin, const char* end) {
+    if (begin >= end) {
+        return end;
+    }
+
+    auto decode = [](const char*& it) {
+        size_t unitSize = utf::internal::GetUnitSize<utf::UTF_8>(it);
+        char32_t codePoint = utf::GetCodePoint<utf::UTF_8>(it, it + unitSize);
+        it += unitSize;
+        return codePoint;
+    };
+
+    const char* it = begin;
+    char32_t previousCodePoint = decode(it);
+    uint8_t previous = GetGraphemeProperty(previousCodePoint);
+    // State for the rules GB11 and GB12/GB13
+    bool pictographicSequence = (previous & sGraphemePictographicBit) != 0;
+    size_t regionalIndicators = ((previous & 0x0F) == GRAPHEME_REGIONAL_INDICATOR) ? 1 : 0;
+
+    while (it < end) {
+        // There is always a boundary between two ASCII characters, except for CR LF
+        if (previousCodePoint < 0x80 && previousCodePoint != '\r' && static_cast<unsigned char>(*it) < 0x80) {
+            return it;
+        }
+
+        const char* next = it;
+        char32_t codePoint = decode(next);
+        uint8_t current = GetGraphemeProperty(codePoint);
+        uint8_t previousBreak = previous & 0x0F;
+        uint8_t currentBreak = current & 0x0F;
+        bool isPictographic = (current & sGraphemePictographicBit) != 0;
+
+        bool boundary = true;
+        if (previousBreak == GRAPHEME_CR && currentBreak == GRAPHEME_LF) {
+            boundary = false;  // GB3
+        } else if (previousBreak == GRAPHEME_CR || previousBreak == GRAPHEME_LF || previousBreak == GRAPHEME_CONTROL) {
+            boundary = true;  // GB4
+        } else if (currentBreak == GRAPHEME_CR || currentBreak == GRAPHEME_LF || currentBreak == GRAPHEME_CONTROL) {
+            boundary = true;  // GB5
+        } else if (previousBreak == GRAPHEME_L && (currentBreak == GRAPHEME_L || currentBreak == GRAPHEME_V ||
+                                                   currentBreak == GRAPHEME_LV || currentBreak == GRAPHEME_LVT)) {
+            boundary = false;  // GB6
+        } else if ((previousBreak == GRAPHEME_LV || previousBreak == GRAPHEME_V) &&
+                   (currentBreak == GRAPHEME_V || currentBreak == GRAPHEME_T)) {
+            boundary = false;  // GB7
+        } else if ((previousBreak == GRAPHEME_LVT || previousBreak == GRAPHEME_T) && currentBreak == GRAPHEME_T) {
+            boundary = false;  // GB8
+        } else if (currentBreak == GRAPHEME_EXTEND || currentBreak == GRAPHEME_ZWJ ||
+                   currentBreak == GRAPHEME_SPACING_MARK || previousBreak == GRAPHEME_PREPEND) {
+            boundary = false;  // GB9, GB9a and GB9b
+        } else if (previousBreak == GRAPHEME_ZWJ && pictographicSequence && isPictographic) {
+            boundary = false;  // GB11
+        } else if (previousBreak == GRAPHEME_REGIONAL_INDICATOR && currentBreak == GRAPHEME_REGIONAL_INDICATOR &&
+                   regionalIndicators % 2 == 1) {
+            boundary = false;  // GB12 and GB13
+        }
+
+        if (boundary) {
+            return it;
+        }
+
+        // GB11 only applies to the sequence: ExtPict Extend* ZWJ x ExtPict
+        if (isPictographic) {
+            pictographicSequence = true;
+        } else if (currentBreak == GRAPHEME_EXTEND || currentBreak == GRAPHEME_ZWJ) {
+            pictographicSequence = pictographicSequence && previousBreak != GRAPHEME_ZWJ;
+        } else {
+            pictographicSequence = false;
+        }
+        regionalIndicators = (currentBreak == GRAPHEME_REGIONAL_INDICATOR) ? regionalIndicators + 1 : 0;
+
+        previousCodePoint = codePoint;
+        previous = current;
+        it = next;
+    }
+    return end;
+}
+
+size_t FindFirstOfClass(const StringView& str, CharacterClass cls, size_t offset) {
+    return FindClass<true>(str, cls, offset);
+}
+
+size_t FindFirstNotOfClass(const StringView& str, CharacterClass cls, size_t offset) {
+    return FindClass<false>(str, cls, offset);
+}
+
+bool IsAllOfClass(const StringView& str, CharacterClass cls) {
+    return FindClass<false>(str, cls, 0) == StringView::sInvalidPos;
+}
+
+void GetSortKey(const StringView& str, std::string& output, CollationStrength strength) {
+    output.clear();
+
+    // The collation elements are defined over the canonical decomposition
+    std::string normalized;
+    StringView source = str;
+    if (QuickCheck(str, NormalizationForm::NFD) != QuickCheckResult::YES) {
+        internal::NormalizeUnchecked(str, NormalizationForm::NFD, normalized);
+        source = StringView(normalized.data(), normalized.size(), utf::AssumeValid);
+    }
+
+    // Each level stores its non-zero weights as 16-bit big endian values, separated by a zero weight,
+    // so the keys can be compared byte by byte
+    const size_t levels = static_cast<size_t>(strength) + 1;
+    output.reserve(source.getDataSize() * 2 * levels + 2 * (levels - 1));
+    for (size_t level = 0; level < levels; ++level) {
+        if (level > 0) {
+            output.append(2, '\0');
+        }
+        CollationElementCursor cursor(source);
+        uint32_t element;
+        while (cursor.next(element)) {
+            uint32_t weight = GetCollationWeight(element, level);
+            if (weight != 0) {
+                output.push_back(static_cast<char>(weight >> 8));
+                output.push_back(static_cast<char>(weight & 0xFF));
+            }
+        }
+    }
+}
+
+std::strong_ordering Collate(const StringView& left, const StringView& right, CollationStrength strength) {
+    std::string leftKey;
+    std::string rightKey;
+    GetSortKey(left, leftKey, strength);
+    GetSortKey(right, rightKey, strength);
+    return leftKey.compare(rightKey) <=> 0;
+}
+
+}  // namespace edoren::unicode
@@ -1,7 +1,9 @@
 #include <edoren/logging/LogManager.hpp>
 
+#include <edoren/FixedString.hpp>
 #include <edoren/String.hpp>
 
+#include <ctime>
 #include <utility>
 
 #if PLATFORM_IS(PLATFORM_ANDROID)
@@ -14,22 +16,30 @@ namespace {
 
 const char* sLogPriorityNames[] = {nullptr, "VERBOSE", "DEBUG", "INFO", "WARN", "ERROR", "FATAL"};
 
-String DefaultLogCallback(LogPriority priority, StringView tag, StringView message) {
+// Append a value in the range [0, 99] with two digits, enough for the hours, minutes and seconds
+void AppendTwoDigits(FixedString<8>& str, int value) {
+    str += static_cast<char>('0' + value / 10);
+    str += static_cast<char>('0' + value % 10);
+}
+
+void DefaultLogCallback(LogPriority priority, StringView tag, StringView message, String& output) {
     const char* priorityName = sLogPriorityNames[static_cast<int>(priority)];
 
     // Get the current system hour
     std::time_t t = std::time(nullptr);
     std::tm* tm = std::localtime(&t);
+    FixedString<8> time;
+    AppendTwoDigits(time, tm->tm_hour);
+    time += ':';
+    AppendTwoDigits(time, tm->tm_min);
+    time += ':';
+    AppendTwoDigits(time, tm->tm_sec);
 
     // Format the log message
-    fmt::string_view tagView(tag.getData(), tag.getSize());
-    fmt::string_view messageView(message.getData(), message.getSize());
-    return "[{:02d}:{:02d}:{:02d}] [{}/{}] : {}"_format(tm->tm_hour,
-                                                        tm->tm_min,
-                                                        tm->tm_sec,
-                                                        tagView,
-                                                        priorityName,
-                                                        messageView);
+    fmt::string_view timeView(time.getData(), time.getDataSize());
+    fmt::string_view tagView(tag.getData(), tag.getDataSize());
+    fmt::string_view messageView(message.getData(), message.getDataSize());
+    formatTo(output, "[{}] [{}/{}] : {}", timeView, tagView, priorityName, messageView);
 }
 
 }  // namespace
@@ -77,13 +87,25 @@ void LogManager::logMessage(LogPriority priority, StringView tag, StringView mes
     }
 #endif
 
-    String logMessage = DefaultLogCallback(priority, tag, message);
+    // The message is formatted into a buffer of the thread that keeps its capacity, so once it has grown
+    // logging does not allocate. A handler that logs again gets its own buffer
+    thread_local String sLogLine;
+    thread_local bool sLogLineInUse = false;
+    String nestedLogLine;
+    String& logMessage = sLogLineInUse ? nestedLogLine : sLogLine;
+    const bool ownsLogLine = !sLogLineInUse;
+    sLogLineInUse = true;
+    logMessage.clear();
+    DefaultLogCallback(priority, tag, message, logMessage);
 
     for (auto& handler : m_handlers) {
         if (handler->isEnabled()) {
             handler->logMessage(priority, tag, logMessage);
         }
     }
+    if (ownsLogLine) {
+        sLogLineInUse = false;
+    }
 
     if (priority == LogPriority::FATAL) {
         std::exit(1);  // TMP
@@ -2,9 +2,12 @@
 
 #include <cstring>
 
+#include <algorithm>
+#include <array>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <stdexcept>
 #include <utility>
 
 #if PLATFORM_IS(PLATFORM_WINDOWS)
@@ -59,7 +62,15 @@ String FindFile(StringView filename) {
     return String();
 }
 
-bool LoadFileData(StringView filename, Vector<uint8_t>& dest) {
+namespace {
+
+// Size of the blocks used to detect the encoding and transcode the text files
+constexpr size_t sTextBlockSize = 16 * 1024;
+
+// Returned by WideTextDecoder::decode when an encoding error is found
+constexpr size_t sInvalidBlock = size_t(-1);
+
+String FindFileInSearchPaths(StringView filename) {
     String filenameCpy = filename;
     filenameCpy.replace('\\', GetOsSeparator());
     filenameCpy.replace('/', GetOsSeparator());
@@ -73,6 +84,12 @@ bool LoadFileData(StringView filename, Vector<uint8_t>& dest) {
         }
     }
 
+    return foundFilePath;
+}
+
+template <typename Container>
+bool ReadFileData(StringView filename, Container& dest) {
+    String foundFilePath = FindFileInSearchPaths(filename);
     if (foundFilePath.isEmpty()) {
         return false;
     }
@@ -94,19 +111,287 @@ bool LoadFileData(StringView filename, Vector<uint8_t>& dest) {
     dest.clear();
     dest.resize(fileSize);
 
-    file.read(reinterpret_cast<char*>(dest.getData()), fileSize);
+    file.read(reinterpret_cast<char*>(dest.data()), fileSize);
 
     return file.gcount() == fileSize;
 }
 
+void AppendUtf8(std::string& dest, char32_t codePoint) {
+    if (codePoint < 0x80) {
+        dest.push_back(static_cast<char>(codePoint));
+        return;
+    }
+    utf::CodeUnit<utf::UTF_8> unit(codePoint);
+    dest.append(reinterpret_cast<const char*>(unit.begin()), unit.getSize());
+}
+
+// Decodes UTF-16 and UTF-32 data in any byte order, keeping the state between blocks
+class WideTextDecoder {
+public:
+    explicit WideTextDecoder(TextEncoding encoding)
+          : m_unitSize(encoding == TextEncoding::UTF_16LE || encoding == TextEncoding::UTF_16BE ? 2 : 4),
+            m_bigEndian(encoding == TextEncoding::UTF_16BE || encoding == TextEncoding::UTF_32BE) {}
+
+    // Decode all the complete units of the block, returns the number of bytes consumed
+    // or sInvalidBlock if an encoding error was found
+    template <typename Func>
+    size_t decode(const uint8_t* data, size_t size, Func&& fn) {
+        size_t pos = 0;
+        for (; pos + m_unitSize <= size; pos += m_unitSize) {
+            char32_t unit = readUnit(data + pos);
+            if (m_unitSize == 4) {
+                if (unit > 0x10FFFF || (unit >= 0xD800 && unit <= 0xDFFF)) {
+                    return sInvalidBlock;
+                }
+                fn(unit);
+            } else if (m_leadingSurrogate != 0) {
+                if ((unit & 0xFC00) != 0xDC00) {
+                    return sInvalidBlock;
+                }
+                fn(0x10000 + ((m_leadingSurrogate - 0xD800) << 10) + (unit - 0xDC00));
+                m_leadingSurrogate = 0;
+            } else if ((unit & 0xFC00) == 0xD800) {
+                m_leadingSurrogate = unit;
+            } else if ((unit & 0xFC00) == 0xDC00) {
+                return sInvalidBlock;
+            } else {
+                fn(unit);
+            }
+        }
+        return pos;
+    }
+
+    bool isComplete() const {
+        return m_leadingSurrogate == 0;
+    }
+
+private:
+    char32_t readUnit(const uint8_t* data) const {
+        char32_t unit = 0;
+        for (size_t i = 0; i < m_unitSize; i++) {
+            size_t shift = m_bigEndian ? (m_unitSize - 1 - i) * 8 : i * 8;
+            unit |= char32_t(data[i]) << shift;
+        }
+        return unit;
+    }
+
+    size_t m_unitSize;
+    bool m_bigEndian;
+    char32_t m_leadingSurrogate = 0;
+};
+
+TextEncoding SniffTextEncoding(const uint8_t* data, size_t size, bool partial, size_t& bomSize) {
+    bomSize = 0;
+    if (size >= 3 && data[0] == 0xEF && data[1] == 0xBB && data[2] == 0xBF) {
+        bomSize = 3;
+        return TextEncoding::UTF_8;
+    }
+    if (size >= 4 && data[0] == 0xFF && data[1] == 0xFE && data[2] == 0x00 && data[3] == 0x00) {
+        bomSize = 4;
+        return TextEncoding::UTF_32LE;
+    }
+    if (size >= 4 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0xFE && data[3] == 0xFF) {
+        bomSize = 4;
+        return TextEncoding::UTF_32BE;
+    }
+    if (size >= 2 && data[0] == 0xFF && data[1] == 0xFE) {
+        bomSize = 2;
+        return TextEncoding::UTF_16LE;
+    }
+    if (size >= 2 && data[0] == 0xFE && data[1] == 0xFF) {
+        bomSize = 2;
+        return TextEncoding::UTF_16BE;
+    }
+
+    if (size > sTextBlockSize) {
+        size = sTextBlockSize;
+        partial = true;
+    }
+
+    // Text in UTF-16 and UTF-32 has zero bytes in the high part of ASCII and Latin characters. Most of those
+    // positions must be zero, since a few stray zero bytes are also valid in UTF-8 and almost any data is valid UTF-16
+    size_t zeros[4] = {0, 0, 0, 0};
+    size_t zeroUnits = 0;
+    for (size_t i = 0; i < size; i++) {
+        zeros[i & 3] += data[i] == 0x00;
+    }
+    for (size_t i = 0; i + 1 < size; i += 2) {
+        zeroUnits += data[i] == 0x00 && data[i + 1] == 0x00;
+    }
+    const size_t units16 = size / 2;
+    const size_t units32 = size / 4;
+    auto isValidWide = [data, size, partial](TextEncoding encoding) {
+        WideTextDecoder decoder(encoding);
+        size_t consumed = decoder.decode(data, size, [](char32_t /*unused*/) {});
+        return consumed != sInvalidBlock && (partial || (consumed == size && decoder.isComplete()));
+    };
+    // UTF-32 text read as UTF-16 has a null character every two units, so prefer UTF-16 when both decode
+    if (zeroUnits * 4 < units16) {
+        if (2 * (zeros[1] + zeros[3]) > units16 && zeros[1] + zeros[3] > zeros[0] + zeros[2] &&
+            isValidWide(TextEncoding::UTF_16LE)) {
+            return TextEncoding::UTF_16LE;
+        }
+        if (2 * (zeros[0] + zeros[2]) > units16 && zeros[0] + zeros[2] > zeros[1] + zeros[3] &&
+            isValidWide(TextEncoding::UTF_16BE)) {
+            return TextEncoding::UTF_16BE;
+        }
+    }
+    if (2 * zeros[2] > units32 && zeros[3] >= zeros[2] && isValidWide(TextEncoding::UTF_32LE)) {
+        return TextEncoding::UTF_32LE;
+    }
+    if (2 * zeros[1] > units32 && zeros[0] >= zeros[1] && isValidWide(TextEncoding::UTF_32BE)) {
+        return TextEncoding::UTF_32BE;
+    }
+
+    // A partial block can end in the middle of an UTF-8 sequence
+    const uint8_t* end = data + size;
+    const uint8_t* it = utf::ForEach<utf::UTF_8>(data, end, [](auto /*unused*/) {});
+    if (it == end || (partial && (end - it) < 4 && (*it & 0xC0) == 0xC0)) {
+        return TextEncoding::UTF_8;
+    }
+    return TextEncoding::WINDOWS_1252;
+}
+
+}  // namespace
+
+bool LoadFileData(StringView filename, Vector<uint8_t>& dest) {
+    return ReadFileData(filename, dest);
+}
+
 bool LoadFileData(StringView filename, String& dest) {
-    Vector<uint8_t> out;
-    bool success = LoadFileData(filename, out);
-    if (success) {
-        auto* begin = reinterpret_cast<char*>(out.getData());
-        dest = String::FromUtf8(begin, begin + out.getSize());
+    // Read the file directly to the final buffer, so it's validated only once and never copied
+    std::basic_string<char> out;
+    if (!ReadFileData(filename, out)) {
+        return false;
+    }
+    if (!utf::IsValid<utf::UTF_8>(out.cbegin(), out.cend())) {
+        EDOTOOLS_THROW(std::runtime_error("invalid utf8 convertion."));
+    }
+    dest = String::FromUtf8Unchecked(std::move(out));
+    return true;
+}
+
+TextEncoding DetectTextEncoding(const uint8_t* data, size_t size, size_t* bomSize) {
+    size_t foundBomSize = 0;
+    TextEncoding encoding = SniffTextEncoding(data, size, false, foundBomSize);
+    if (bomSize != nullptr) {
+        *bomSize = foundBomSize;
+    }
+    return encoding;
+}
+
+bool LoadTextFileData(StringView filename, String& dest, TextEncoding* encoding) {
+    String foundFilePath = FindFileInSearchPaths(filename);
+    if (foundFilePath.isEmpty()) {
+        return false;
+    }
+
+    std::ifstream file(foundFilePath.toUtf8(), std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    // Some special files (like the ones in /proc or pipes) do not report their size, they are read until the end.
+    // The failed seek leaves them at the start, and pipes can not be rewound at all
+    file.seekg(0, std::ios::end);
+    const std::streamoff endPosition = file.tellg();
+    const bool knownSize = endPosition >= 0;
+    size_t fileSize = knownSize ? static_cast<size_t>(endPosition) : 0;
+    file.clear();
+    if (knownSize) {
+        file.seekg(0, std::ios::beg);
+    }
+    if (!file) {
+        return false;
+    }
+
+    // Detect the encoding using the first block
+    std::array<uint8_t, sTextBlockSize> block;
+    const size_t firstBlockSize = knownSize ? std::min(fileSize, block.size()) : block.size();
+    file.read(reinterpret_cast<char*>(block.data()), firstBlockSize);
+    size_t blockSize = file.gcount();
+    if (knownSize && blockSize != firstBlockSize) {
+        // The size is not real, e.g. the path is a directory
+        return false;
+    }
+    size_t bomSize = 0;
+    const bool moreData = knownSize ? blockSize < fileSize : blockSize == block.size();
+    const TextEncoding detected = SniffTextEncoding(block.data(), blockSize, moreData, bomSize);
+
+    std::basic_string<char> out;
+    if (detected == TextEncoding::UTF_8) {
+        if (knownSize) {
+            // Read the rest of the file directly to the final buffer after the first block
+            out.resize(fileSize - bomSize);
+            std::memcpy(out.data(), block.data() + bomSize, blockSize - bomSize);
+            file.read(out.data() + (blockSize - bomSize), fileSize - blockSize);
+            if (blockSize + file.gcount() != fileSize) {
+                return false;
+            }
+        } else {
+            out.assign(reinterpret_cast<const char*>(block.data()) + bomSize, blockSize - bomSize);
+            while (file) {
+                const size_t previousSize = out.size();
+                out.resize(previousSize + sTextBlockSize);
+                file.read(out.data() + previousSize, sTextBlockSize);
+                out.resize(previousSize + file.gcount());
+            }
+            if (file.bad()) {
+                return false;
+            }
+        }
+        // Only the first block was inspected, reinterpreting the text already loaded would corrupt it
+        if (!utf::IsValid<utf::UTF_8>(out.cbegin(), out.cend())) {
+            EDOTOOLS_THROW(std::runtime_error("invalid utf8 convertion."));
+        }
+        dest = String::FromUtf8Unchecked(std::move(out));
+        if (encoding != nullptr) {
+            *encoding = detected;
+        }
+        return true;
+    }
+
+    // Transcode block by block, carrying the incomplete units to the next block
+    WideTextDecoder decoder(detected);
+    const char* errorMessage = detected == TextEncoding::UTF_16LE || detected == TextEncoding::UTF_16BE
+                                   ? "invalid utf16 convertion."
+                                   : "invalid utf32 convertion.";
+    auto append = [&out](char32_t codePoint) { AppendUtf8(out, codePoint); };
+    if (knownSize) {
+        out.reserve(fileSize - bomSize);
+    }
+    size_t offset = bomSize;
+    while (offset < blockSize) {
+        size_t leftover = 0;
+        if (detected == TextEncoding::WINDOWS_1252) {
+            for (size_t i = offset; i < blockSize; i++) {
+                AppendUtf8(out, utf::GetCodePoint<utf::WINDOWS_1252>(&block[i], &block[i] + 1));
+            }
+        } else {
+            size_t consumed = decoder.decode(block.data() + offset, blockSize - offset, append);
+            if (consumed == sInvalidBlock) {
+                EDOTOOLS_THROW(std::runtime_error(errorMessage));
+            }
+            leftover = blockSize - offset - consumed;
+            std::memmove(block.data(), block.data() + offset + consumed, leftover);
+        }
+        file.read(reinterpret_cast<char*>(block.data() + leftover), block.size() - leftover);
+        size_t readSize = file.gcount();
+        if (readSize == 0 && leftover != 0) {
+            EDOTOOLS_THROW(std::runtime_error(errorMessage));
+        }
+        blockSize = leftover + readSize;
+        offset = 0;
+    }
+    if (!decoder.isComplete()) {
+        EDOTOOLS_THROW(std::runtime_error(errorMessage));
+    }
+
+    dest = String::FromUtf8Unchecked(std::move(out));
+    if (encoding != nullptr) {
+        *encoding = detected;
     }
-    return success;
+    return true;
 }
 
 char GetOsSeparator() {
@@ -269,8 +554,8 @@ String NormalizePath(const String& path) {
     String ret;
     if (isAbsolute) {
 #if PLATFORM_IS(PLATFORM_WINDOWS)
-        auto it = internal.cbegin();
-        ret += String::FromUtf8(it, it + 2) + '\\';
+        ret.insertBytes(0, StringView(internal.data(), 2, utf::AssumeValid));
+        ret += '\\';
 #else
         ret += '/';
 #endif
@@ -282,7 +567,10 @@ String NormalizePath(const String& path) {
             if (i) {
                 ret += GetOsSeparator();
             }
-            ret += String::FromUtf8(pathComps[i].first, pathComps[i].second);
+            // Components are split on ASCII separators of a valid string, so they are valid as well. They are
+            // appended in place, without creating a temporary String for each one
+            const auto& [begin, end] = pathComps[i];
+            ret.insertBytes(ret.getDataSize(), StringView(begin, end - begin, utf::AssumeValid));
         }
     }
 
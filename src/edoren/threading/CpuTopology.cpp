@@ -0,0 +1,186 @@
+#include <edoren/threading/CpuTopology.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#include <edoren/util/Platform.hpp>
+
+#if PLATFORM_IS(PLATFORM_LINUX | PLATFORM_ANDROID)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace edoren {
+
+namespace {
+
+#if PLATFORM_IS(PLATFORM_LINUX | PLATFORM_ANDROID)
+static_assert(MAX_CPU_COUNT <= CPU_SETSIZE, "The CPUs must fit in a cpu_set_t");
+
+constexpr const char* sNodeDirectory = "/sys/devices/system/node";
+
+bool ReadSmallFile(const std::filesystem::path& path, std::string& content) {
+    // The files of sysfs report a fixed size, so read them until the end
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+bool IsCpuAllowed(const cpu_set_t& allowed, uint32_t cpu) {
+    return cpu < MAX_CPU_COUNT && CPU_ISSET(cpu, &allowed);
+}
+#endif
+
+// Single node with all the CPUs, for the systems without NUMA information
+Vector<NumaNode> GetDefaultNodes() {
+    Vector<NumaNode> nodes(1);
+    nodes[0].id = 0;
+    const uint32_t cpuCount = std::max(std::thread::hardware_concurrency(), 1u);
+    for (uint32_t cpu = 0; cpu < cpuCount; cpu++) {
+        nodes[0].cpus.push_back(cpu);
+    }
+    return nodes;
+}
+
+}  // namespace
+
+Vector<uint32_t> ParseCpuList(StringView text) {
+    const char* it = text.getData();
+    const char* end = it + text.getDataSize();
+    Vector<uint32_t> cpus;
+
+    // Stops before the value reaches MAX_CPU_COUNT, so it can't overflow or expand huge ranges
+    auto parseNumber = [&it, end](uint32_t& value) {
+        const char* start = it;
+        value = 0;
+        while (it != end && *it >= '0' && *it <= '9') {
+            value = value * 10 + static_cast<uint32_t>(*it - '0');
+            if (value >= MAX_CPU_COUNT) {
+                return false;
+            }
+            it++;
+        }
+        return it != start;
+    };
+
+    while (it != end && *it != '\n') {
+        uint32_t first = 0;
+        uint32_t last = 0;
+        if (!parseNumber(first)) {
+            return {};
+        }
+        last = first;
+        if (it != end && *it == '-') {
+            it++;
+            if (!parseNumber(last) || last < first) {
+                return {};
+            }
+        }
+        for (uint32_t cpu = first; cpu <= last; cpu++) {
+            cpus.push_back(cpu);
+        }
+        if (it != end && *it == ',') {
+            it++;
+        } else if (it != end && *it != '\n') {
+            return {};
+        }
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+Vector<NumaNode> GetNumaNodes() {
+#if PLATFORM_IS(PLATFORM_LINUX | PLATFORM_ANDROID)
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+        return GetDefaultNodes();
+    }
+
+    Vector<NumaNode> nodes;
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(sNodeDirectory, error)) {
+        const std::string name = entry.path().filename().string();
+        if (name.size() <= 4 || name.compare(0, 4, "node") != 0 ||
+            name.find_first_not_of("0123456789", 4) != std::string::npos) {
+            continue;
+        }
+        std::string content;
+        if (!ReadSmallFile(entry.path() / "cpulist", content)) {
+            continue;
+        }
+        NumaNode node;
+        node.id = static_cast<uint32_t>(std::stoul(name.substr(4)));
+        // The list is parsed byte by byte and rejected if it's not ASCII, so there is no need to validate it
+        for (uint32_t cpu : ParseCpuList(StringView(content.data(), content.size(), utf::AssumeValid))) {
+            if (IsCpuAllowed(allowed, cpu)) {
+                node.cpus.push_back(cpu);
+            }
+        }
+        if (!node.cpus.empty()) {
+            nodes.push_back(std::move(node));
+        }
+    }
+
+    if (nodes.empty()) {
+        // No NUMA information, use the CPUs of the affinity mask
+        nodes.resize(1);
+        nodes[0].id = 0;
+        for (uint32_t cpu = 0; cpu < MAX_CPU_COUNT; cpu++) {
+            if (IsCpuAllowed(allowed, cpu)) {
+                nodes[0].cpus.push_back(cpu);
+            }
+        }
+        if (nodes[0].cpus.empty()) {
+            return GetDefaultNodes();
+        }
+    }
+    std::sort(nodes.begin(), nodes.end(), [](const NumaNode& a, const NumaNode& b) { return a.id < b.id; });
+    return nodes;
+#else
+    return GetDefaultNodes();
+#endif
+}
+
+bool SetCurrentThreadAffinity(uint32_t cpu) {
+#if PLATFORM_IS(PLATFORM_LINUX)
+    if (cpu >= MAX_CPU_COUNT) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#elif PLATFORM_IS(PLATFORM_ANDROID)
+    if (cpu >= MAX_CPU_COUNT) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+int32_t GetCurrentCpu() {
+#if PLATFORM_IS(PLATFORM_LINUX | PLATFORM_ANDROID)
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+}  // namespace edoren
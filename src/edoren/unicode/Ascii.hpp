@@ -0,0 +1,83 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace edoren::unicode::internal {
+
+// Helpers to process ASCII data 8 bytes at a time using plain 64 bit arithmetic
+
+inline constexpr uint64_t sAsciiHighBits = 0x8080808080808080ULL;
+inline constexpr uint64_t sAsciiOnes = 0x0101010101010101ULL;
+
+inline uint64_t LoadWord(const char* data) {
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(uint64_t));
+    return word;
+}
+
+inline bool IsAsciiWord(uint64_t word) {
+    return (word & sAsciiHighBits) == 0;
+}
+
+// Sets the high bit of the bytes in the range [first, last] of a word that only contains ASCII
+inline uint64_t AsciiRangeMask(uint64_t word, char first, char last) {
+    // The high bit of each byte is set if the byte is >= first, and if it is > last.
+    // No byte can overflow to the next one since all of them are lower than 0x80.
+    uint64_t geFirst = word + sAsciiOnes * (0x80 - first);
+    uint64_t gtLast = word + sAsciiOnes * (0x7F - last);
+    return (geFirst ^ gtLast) & sAsciiHighBits;
+}
+
+// Returns the index in memory order of the first byte with the high bit set in a mask
+inline size_t FirstMaskedByte(uint64_t mask) {
+    if constexpr (std::endian::native == std::endian::little) {
+        return static_cast<size_t>(std::countr_zero(mask)) / 8;
+    } else {
+        return static_cast<size_t>(std::countl_zero(mask)) / 8;
+    }
+}
+
+// Flips the case of the letters in the range [first, last] of a word that only contains ASCII
+inline uint64_t FlipAsciiWordCase(uint64_t word, char first, char last) {
+    return word ^ (AsciiRangeMask(word, first, last) >> 2);  // 0x80 >> 2 == 0x20, the bit that changes the case
+}
+
+inline uint64_t ToLowerAsciiWord(uint64_t word) {
+    return FlipAsciiWordCase(word, 'A', 'Z');
+}
+
+inline char ToLowerAscii(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c ^ 0x20) : c;
+}
+
+// Returns the position of the first non ASCII byte starting from `pos`
+inline size_t FindAsciiRunEnd(const char* data, size_t pos, size_t size) {
+    while (pos + sizeof(uint64_t) <= size && IsAsciiWord(LoadWord(data + pos))) {
+        pos += sizeof(uint64_t);
+    }
+    while (pos < size && (static_cast<unsigned char>(data[pos]) & 0x80) == 0) {
+        ++pos;
+    }
+    return pos;
+}
+
+// Converts the case of a run of ASCII characters in place
+inline void MapAsciiCase(char* data, size_t size, bool toUpper) {
+    const char first = toUpper ? 'a' : 'A';
+    const char last = toUpper ? 'z' : 'Z';
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word = FlipAsciiWordCase(LoadWord(data + i), first, last);
+        std::memcpy(data + i, &word, sizeof(uint64_t));
+    }
+    for (; i < size; ++i) {
+        if (data[i] >= first && data[i] <= last) {
+            data[i] ^= 0x20;
+        }
+    }
+}
+
+}  // namespace edoren::unicode::internal
@@ -0,0 +1,10702 @@
+// Generated by tools/GenerateUnicodeTables.pl from the Unicode 14.0.0 database, do not edit.
+
+namespace edoren::unicode::internal {
+
+// Derived from the Default Unicode Collation Element Table 13.0.0
+inline constexpr char32_t sCollationMaxCodePoint = 0xE01EF;
+inline constexpr uint32_t sCollationBlockShift = 7;
+
+inline constexpr uint16_t sCollationStage1[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+    48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 97, 98, 99, 100, 101, 102, 103, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 105, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+    122, 123, 124, 125, 126, 127, 128, 129, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 130,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,
+    145, 146, 147, 148, 104, 149, 150, 151, 152, 153, 154, 104, 155, 156, 157, 104,
+    158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 104, 169, 170, 171, 172,
+    173, 174, 175, 176, 177, 178, 179, 104, 180, 181, 104, 182, 183, 184, 185, 104,
+    186, 187, 188, 189, 190, 191, 104, 104, 192, 193, 194, 195, 104, 196, 104, 197,
+    198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    209, 210, 211, 212, 213, 214, 215, 216, 217, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 218, 219, 220, 221, 222, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    223, 224, 225, 226, 227, 228, 229, 230, 104, 104, 104, 104, 231, 232, 233, 234,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    235, 236, 237, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 238, 239, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    240, 241, 242, 243, 244, 245, 246, 104, 247, 248, 249, 250, 251, 252, 253, 254,
+    255, 256, 257, 258, 259, 260, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    261, 104, 262, 104, 104, 263, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    264, 265, 266, 104, 104, 104, 104, 104, 267, 268, 269, 104, 270, 271, 104, 104,
+    272, 273, 274, 275, 276, 104, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286,
+    287, 288, 289, 290, 291, 292, 293, 294, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    295, 296, 297, 298, 299, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104, 104,
+    300, 104, 301, 302,
+};
+
+inline constexpr uint32_t sCollationStage2[] = {
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 66, 130, 194, 258, 322, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    386, 450, 514, 578, 642, 706, 770, 834,
+    898, 962, 1026, 1090, 1154, 1218, 1282, 1346,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 2050, 2114, 2178, 2242, 2306, 2370,
+    2434, 2498, 2562, 2626, 2690, 2754, 2818, 2882,
+    2946, 3010, 3074, 3138, 3203, 3266, 3330, 3394,
+    3458, 3522, 3586, 3650, 3714, 3778, 3842, 3906,
+    3970, 4034, 4098, 4162, 4226, 4290, 4354, 4418,
+    4482, 4546, 4610, 4674, 4738, 4802, 4866, 4930,
+    4994, 5058, 5122, 5186, 5251, 5314, 5378, 5442,
+    5506, 5570, 5634, 5698, 5762, 5826, 5890, 5954,
+    6018, 6082, 6146, 6210, 6274, 6338, 6402, 2,
+    2, 2, 2, 2, 2, 6466, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    6530, 6594, 6658, 6722, 6786, 6850, 6914, 6978,
+    7042, 7106, 7170, 7234, 7298, 2, 7362, 7426,
+    7490, 7554, 7618, 7682, 7746, 7810, 7874, 7938,
+    8002, 8066, 8130, 8194, 8262, 8454, 8646, 8834,
+    8900, 9028, 9156, 9284, 9412, 9540, 9670, 9860,
+    9988, 10116, 10244, 10372, 10500, 10628, 10756, 10884,
+    11012, 11140, 11268, 11396, 11524, 11652, 11780, 11906,
+    11972, 12100, 12228, 12356, 12484, 12612, 12738, 12806,
+    12996, 13124, 13252, 13380, 13508, 13636, 13766, 13956,
+    14084, 14212, 14340, 14468, 14596, 14724, 14852, 14980,
+    15108, 15236, 15364, 15492, 15620, 15748, 15876, 16002,
+    16068, 16196, 16324, 16452, 16580, 16708, 16834, 16900,
+    17028, 17156, 17284, 17412, 17540, 17668, 17796, 17924,
+    18052, 18180, 18308, 18436, 18564, 18692, 18820, 18948,
+    19076, 19204, 19332, 19460, 19588, 19716, 19844, 19972,
+    20100, 20228, 20356, 20484, 20612, 20740, 20868, 20996,
+    21124, 21252, 21380, 21508, 21636, 21764, 21892, 22020,
+    22148, 22276, 22404, 22532, 22660, 22788, 22916, 23044,
+    23172, 23298, 23364, 23492, 23620, 23748, 23876, 24004,
+    24130, 24196, 24324, 24452, 24580, 24708, 24836, 24964,
+    25092, 25220, 25348, 25476, 25604, 25732, 25860, 25988,
+    26116, 26244, 26370, 26434, 26500, 26628, 26756, 26884,
+    27012, 27140, 27270, 27462, 27652, 27780, 27908, 28036,
+    28164, 28292, 28420, 28548, 28676, 28804, 28932, 29060,
+    29188, 29316, 29444, 29572, 29700, 29828, 29954, 30018,
+    30084, 30212, 30340, 30468, 30596, 30724, 30852, 30980,
+    31108, 31236, 31364, 31492, 31620, 31748, 31876, 32004,
+    32132, 32260, 32388, 32516, 32644, 32772, 32900, 33028,
+    33154, 33218, 33282, 33346, 33410, 33474, 33538, 33602,
+    33666, 33730, 33794, 33858, 33922, 33988, 34114, 34178,
+    34242, 34306, 34370, 34434, 34498, 34562, 34626, 34690,
+    34754, 34818, 34882, 34946, 35010, 35074, 35138, 35202,
+    35268, 35396, 35522, 35586, 35650, 35714, 35778, 35842,
+    35906, 35970, 36034, 36098, 36162, 36226, 36290, 36356,
+    36484, 36610, 36674, 36738, 36802, 36866, 36930, 36994,
+    37058, 37122, 37186, 37250, 37314, 37378, 37444, 37570,
+    37634, 37698, 37762, 37826, 37894, 38086, 38278, 38468,
+    38596, 38724, 38852, 38980, 39108, 39236, 39364, 39492,
+    39620, 39748, 39876, 40004, 40132, 40262, 40454, 40646,
+    40838, 41030, 41222, 41414, 41606, 41794, 41862, 42054,
+    42246, 42438, 42632, 42888, 43138, 43202, 43268, 43396,
+    43524, 43652, 43780, 43908, 44038, 44230, 44420, 44548,
+    44676, 44804, 44932, 45060, 45188, 45316, 45442, 45506,
+    45572, 45700, 45830, 46022, 46216, 46472, 46726, 46918,
+    47108, 47236, 47364, 47492, 47620, 47748, 47876, 48004,
+    48132, 48260, 48388, 48516, 48644, 48772, 48900, 49028,
+    49156, 49284, 49412, 49540, 49668, 49796, 49924, 50052,
+    50180, 50308, 50436, 50564, 50690, 50754, 50820, 50948,
+    51074, 51138, 51202, 51266, 51330, 51394, 51460, 51588,
+    51716, 51844, 51974, 52166, 52358, 52550, 52740, 52868,
+    52998, 53190, 53380, 53508, 53634, 53698, 53762, 53826,
+    53892, 54020, 54146, 54210, 54274, 54338, 54402, 54466,
+    54530, 54594, 54658, 54722, 54786, 54850, 54914, 54978,
+    55042, 55106, 55170, 55234, 55298, 55362, 55426, 55490,
+    55554, 55618, 55682, 55746, 55810, 55874, 55938, 56002,
+    56066, 56130, 56194, 56258, 56322, 56386, 56450, 56514,
+    56578, 56642, 56706, 56770, 56834, 56898, 56962, 57026,
+    57090, 57154, 57218, 57282, 57346, 57410, 57474, 57538,
+    57602, 57666, 57730, 57794, 57858, 57922, 57986, 58050,
+    58114, 58178, 58242, 58306, 58370, 58434, 58498, 58562,
+    58626, 58690, 58754, 58818, 58882, 58946, 59010, 59074,
+    59138, 59202, 59266, 59330, 59394, 59458, 59522, 59586,
+    59650, 59714, 59778, 59842, 59906, 59970, 60034, 60098,
+    60162, 60226, 60290, 60354, 60418, 60482, 60546, 60610,
+    60674, 60738, 60802, 45060, 60868, 60996, 37444, 61124,
+    61252, 61380, 61508, 61636, 61762, 61826, 61890, 61954,
+    62018, 62082, 62146, 62210, 62274, 62338, 62402, 62466,
+    62530, 62594, 62658, 62722, 62786, 62850, 62914, 62978,
+    63042, 63106, 63170, 63234, 63298, 63362, 63426, 63490,
+    63554, 63618, 63682, 63746, 63810, 63874, 63938, 64002,
+    64066, 64130, 64194, 64258, 64322, 64386, 64450, 64514,
+    64578, 64642, 64706, 64770, 64834, 64898, 64962, 65026,
+    65090, 65154, 65218, 65282, 65346, 65410, 65474, 65538,
+    65602, 65666, 65730, 65794, 65858, 65922, 65986, 66050,
+    66114, 66178, 66242, 66306, 66370, 66434, 66498, 66562,
+    66626, 66690, 66754, 66818, 66882, 66946, 67010, 67074,
+    67138, 67202, 67266, 67330, 67394, 67458, 67522, 67586,
+    67650, 67714, 67778, 67842, 67906, 67970, 67970, 68034,
+    68098, 68162, 67970, 68226, 68290, 67970, 68354, 68354,
+    68354, 68354, 67970, 68418, 68354, 68354, 68354, 68354,
+    68354, 68482, 68546, 68610, 68674, 68738, 68802, 68866,
+    68930, 68354, 68354, 68354, 68354, 68994, 69058, 68354,
+    69122, 69186, 69250, 68354, 69314, 69378, 69442, 69442,
+    69506, 69570, 68354, 68354, 68354, 67970, 67970, 67970,
+    67138, 67202, 69634, 68226, 69700, 69826, 67970, 68354,
+    68354, 68354, 67970, 67970, 67970, 68354, 68354, 2,
+    67970, 67970, 67970, 68354, 68354, 68354, 68354, 67970,
+    69890, 68354, 68354, 67970, 68354, 67970, 67970, 68354,
+    69954, 70018, 68354, 70082, 70146, 70210, 70274, 70338,
+    70402, 70466, 70530, 70594, 70658, 70722, 70786, 70850,
+    70914, 70978, 71042, 71106, 62594, 71170, 71234, 71298,
+    0, 0, 71362, 71426, 71490, 71554, 2114, 71618,
+    0, 0, 0, 0, 7746, 71684, 71812, 7938,
+    71940, 72068, 72196, 0, 72324, 0, 72452, 72580,
+    72710, 72898, 72962, 73026, 73090, 73154, 73218, 73282,
+    73346, 73410, 73474, 73538, 73602, 73666, 73730, 73794,
+    73858, 73922, 0, 73986, 74050, 74114, 74178, 74242,
+    74306, 74370, 74436, 74564, 74692, 74820, 74948, 75076,
+    75206, 75394, 75458, 75522, 75586, 75650, 75714, 75778,
+    75842, 75906, 75970, 76034, 76098, 76162, 76226, 76290,
+    76354, 76418, 76482, 76546, 76610, 76674, 76738, 76802,
+    76866, 76930, 76996, 77124, 77252, 77380, 77508, 77638,
+    77826, 77890, 77954, 78020, 78148, 78274, 78338, 78406,
+    78594, 78658, 78722, 78786, 78850, 78914, 78978, 79042,
+    79106, 79170, 79234, 79298, 79362, 79426, 79490, 79554,
+    79618, 79682, 79746, 79810, 79874, 79938, 80002, 80066,
+    80130, 80194, 80258, 80322, 80386, 80450, 80514, 80578,
+    80642, 80706, 80770, 80834, 80898, 80962, 81026, 81090,
+    81156, 81284, 81410, 81476, 81602, 81666, 81730, 81796,
+    81922, 81986, 82050, 82114, 82180, 82308, 82436, 82562,
+    82626, 82690, 82754, 82818, 82882, 82946, 83010, 83074,
+    83139, 83202, 83266, 83330, 83394, 83458, 83522, 83586,
+    83650, 83714, 83778, 83842, 83906, 83970, 84034, 84098,
+    84162, 84226, 84290, 84354, 84418, 84482, 84546, 84610,
+    84674, 84738, 84802, 84866, 84930, 84994, 85058, 85122,
+    85187, 85250, 85314, 85378, 85442, 85506, 85570, 85634,
+    85698, 85762, 85826, 85890, 85954, 86018, 86082, 86146,
+    86210, 86274, 86338, 86402, 86466, 86530, 86594, 86658,
+    86724, 86852, 86978, 87044, 87170, 87234, 87298, 87364,
+    87490, 87554, 87618, 87682, 87748, 87876, 88004, 88130,
+    88194, 88258, 88322, 88386, 88450, 88514, 88578, 88642,
+    88706, 88770, 88834, 88898, 88962, 89026, 89090, 89154,
+    89218, 89282, 89346, 89410, 89474, 89538, 89604, 89732,
+    89858, 89922, 89986, 90050, 90114, 90178, 90242, 90306,
+    90370, 90434, 90498, 90562, 67970, 68290, 68226, 67970,
+    2, 2, 90626, 90690, 90754, 90818, 90882, 90946,
+    91012, 91140, 91266, 91330, 91394, 91458, 91522, 91586,
+    91650, 91714, 91778, 91842, 91906, 91970, 92034, 92098,
+    92162, 92226, 92290, 92354, 92418, 92482, 92546, 92610,
+    92674, 92738, 92802, 92866, 92930, 92994, 93058, 93122,
+    93186, 93250, 93314, 93378, 93442, 93506, 93570, 93634,
+    93698, 93762, 93826, 93890, 93954, 94018, 94082, 94146,
+    94210, 94276, 94404, 94530, 94594, 94658, 94722, 94786,
+    94850, 94914, 94978, 95042, 95106, 95170, 95234, 95298,
+    95364, 95492, 95620, 95748, 95874, 95938, 96004, 96132,
+    96258, 96322, 96388, 96516, 96644, 96772, 96900, 97028,
+    97154, 97218, 97284, 97412, 97540, 97668, 97796, 97924,
+    98050, 98114, 98180, 98308, 98436, 98564, 98692, 98820,
+    98948, 99076, 99204, 99332, 99460, 99588, 99714, 99778,
+    99844, 99972, 100098, 100162, 100226, 100290, 100354, 100418,
+    100482, 100546, 100610, 100674, 100738, 100802, 100866, 100930,
+    100994, 101058, 101122, 101186, 101250, 101314, 101378, 101442,
+    101506, 101570, 101634, 101698, 101762, 101826, 101890, 101954,
+    102018, 102082, 102146, 102210, 102274, 102338, 102402, 102466,
+    102530, 102594, 102658, 102722, 102786, 102850, 102914, 102978,
+    103042, 103106, 103170, 103234, 103298, 103362, 103426, 103490,
+    0, 103554, 103618, 103682, 103746, 103810, 103874, 103938,
+    104002, 104066, 104130, 104194, 104258, 104322, 104386, 104450,
+    104514, 104578, 104642, 104706, 104770, 104834, 104898, 104962,
+    105026, 105090, 105154, 105218, 105282, 105346, 105410, 105474,
+    105538, 105602, 105666, 105730, 105794, 105858, 105922, 0,
+    0, 105986, 106050, 106114, 106178, 106242, 106306, 106370,
+    106434, 106498, 106562, 106626, 106690, 106754, 106818, 106882,
+    106946, 107010, 107074, 107138, 107202, 107266, 107330, 107394,
+    107458, 107522, 107586, 107650, 107714, 107778, 107842, 107906,
+    107970, 108034, 108098, 108162, 108226, 108290, 108354, 108418,
+    108482, 108546, 108610, 108674, 108738, 108802, 108866, 108932,
+    109058, 109122, 109186, 0, 0, 109250, 109314, 109378,
+    0, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    109442, 109506, 109570, 109634, 109698, 109762, 109826, 109890,
+    109954, 110018, 110018, 110082, 110146, 2, 110210, 110274,
+    110338, 110402, 110466, 110530, 2, 2, 110594, 109954,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    110658, 110722, 110786, 110850, 110914, 110978, 111042, 111106,
+    111170, 111234, 111298, 111362, 111426, 111490, 111554, 111618,
+    111682, 111746, 111810, 111874, 111938, 112002, 112066, 112130,
+    112194, 112258, 112322, 0, 0, 0, 0, 112392,
+    112644, 112772, 112900, 113026, 113090, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 113154, 113218,
+    113282, 113346, 113410, 113474, 113538, 113602, 113666, 113730,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 113794, 2, 0, 113858, 113922,
+    113986, 114050, 114114, 114178, 114242, 114306, 114370, 114435,
+    114498, 114562, 114626, 114690, 114754, 114818, 114882, 114946,
+    115010, 115074, 115138, 115202, 115266, 115330, 115394, 115458,
+    115522, 115586, 115650, 115714, 115778, 115842, 115906, 115970,
+    2, 116034, 116098, 116162, 116226, 116290, 116354, 116418,
+    116483, 116546, 116611, 116674, 116738, 116802, 116866, 116930,
+    116994, 117058, 117122, 117186, 117250, 117314, 117378, 117442,
+    117506, 117570, 117634, 117698, 117762, 117826, 117890, 117954,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 118018, 118082, 118146, 118210, 118274, 118338,
+    118402, 118466, 118530, 118594, 118658, 118724, 118852, 118980,
+    119108, 119234, 119298, 119362, 119426, 119490, 119554, 119618,
+    119682, 119746, 119810, 119874, 119938, 120002, 120066, 120130,
+    120194, 120258, 120322, 120386, 120450, 120514, 120578, 120642,
+    120706, 120770, 120834, 120898, 120962, 121026, 121090, 121154,
+    121218, 121282, 121346, 121410, 121474, 121538, 121602, 121666,
+    121730, 121794, 121858, 121922, 121986, 122050, 122114, 122178,
+    122242, 122306, 122370, 122434, 122498, 122562, 122626, 122690,
+    122754, 122818, 122882, 122946, 123010, 123074, 123138, 123202,
+    123266, 123330, 123394, 123458, 123522, 123586, 123650, 123714,
+    123780, 123906, 123972, 124098, 124162, 124226, 124290, 124354,
+    124418, 124482, 124546, 124610, 124674, 124738, 124802, 124866,
+    124930, 124994, 125058, 125124, 125250, 125314, 2, 2,
+    2, 2, 2, 2, 2, 2, 125378, 2,
+    2, 2, 2, 2, 2, 125442, 125506, 2,
+    2, 125570, 2, 2, 2, 2, 125634, 125698,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 125762, 125826, 125890, 125956, 126084, 126210,
+    126274, 126338, 126402, 126466, 126530, 126594, 126658, 126722,
+    126786, 126850, 126914, 126978, 127042, 127106, 0, 2,
+    127170, 127234, 127298, 127362, 127428, 127554, 127618, 127682,
+    127746, 127810, 127874, 127938, 128004, 128130, 128194, 128258,
+    128322, 128386, 128450, 128514, 128578, 128642, 128706, 128772,
+    128898, 128962, 129026, 129090, 129154, 129220, 129348, 129476,
+    129602, 129666, 129730, 129794, 129858, 129922, 129986, 130050,
+    130114, 130178, 130242, 130306, 130370, 130434, 130498, 130562,
+    2, 67970, 68354, 2, 2, 67970, 68354, 2,
+    2, 2, 2, 0, 0, 130626, 130690, 130754,
+    130818, 130882, 130946, 131010, 131074, 131138, 131202, 131266,
+    131330, 131394, 131458, 131522, 131586, 131650, 131714, 131778,
+    131842, 131906, 131970, 132034, 132098, 132162, 132226, 132290,
+    132354, 132418, 132482, 132546, 132610, 132674, 132738, 132802,
+    132866, 132930, 132994, 133058, 133122, 133186, 133250, 133314,
+    133378, 133442, 133506, 133570, 133634, 133698, 133762, 133826,
+    133890, 133954, 134018, 134082, 134146, 134210, 134274, 134338,
+    134402, 134466, 134530, 134594, 134658, 134722, 134786, 134850,
+    134914, 134978, 135042, 135106, 135170, 135234, 135298, 135362,
+    135426, 135490, 135554, 135618, 135682, 135746, 135810, 135874,
+    135938, 136002, 136066, 136130, 136194, 136258, 136322, 136386,
+    136450, 136514, 136578, 136642, 136706, 136770, 136834, 136898,
+    136962, 137026, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 137090, 137154, 137218, 137282, 137346, 137410,
+    137474, 137538, 137602, 137666, 137730, 137794, 137858, 137922,
+    137986, 138050, 138114, 138178, 138242, 138306, 138370, 138434,
+    138498, 138562, 138626, 138690, 138754, 138818, 138882, 138946,
+    139012, 139140, 139268, 139394, 139458, 139522, 139586, 139650,
+    139714, 139778, 139842, 139906, 139970, 140034, 140098, 140162,
+    140226, 140290, 2, 0, 0, 68354, 140354, 140418,
+    140482, 140546, 140610, 140674, 140738, 140802, 140866, 140930,
+    140994, 141058, 141122, 141186, 141250, 141314, 141378, 141442,
+    141506, 141570, 141634, 141698, 141762, 141826, 141890, 141954,
+    142018, 142082, 142146, 142210, 142274, 142274, 142338, 142338,
+    142338, 142402, 142402, 142402, 142466, 142466, 142530, 142530,
+    142594, 142594, 142594, 142658, 142722, 142786, 0, 0,
+    142850, 142914, 142978, 143042, 143106, 143170, 143234, 143298,
+    143362, 143426, 143490, 143554, 143618, 143682, 143746, 0,
+    143810, 143874, 143938, 144002, 144066, 144130, 144194, 144258,
+    144322, 144386, 144450, 144514, 144578, 144642, 144706, 144770,
+    144834, 144898, 144962, 145026, 145090, 145154, 145218, 145282,
+    145346, 68354, 68354, 68354, 0, 0, 145410, 0,
+    145474, 145538, 145602, 145666, 145730, 145794, 145858, 145922,
+    145986, 146050, 146114, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    146178, 146242, 146306, 146370, 146434, 146498, 146562, 146626,
+    146690, 146754, 146818, 146882, 146946, 147010, 147074, 147138,
+    147202, 147266, 147330, 147394, 147458, 0, 147522, 147586,
+    147650, 147714, 147778, 147842, 147906, 147970, 148034, 148098,
+    148162, 148226, 148290, 148354, 148418, 148482, 148546, 148610,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 148674, 148738, 148802, 148866, 148930,
+    148994, 149058, 2, 2, 2, 2, 2, 2,
+    149122, 149186, 149250, 2, 149314, 149378, 149442, 149506,
+    149570, 149634, 149698, 149762, 149826, 149890, 149954, 150018,
+    150082, 150082, 150146, 150210, 150274, 150338, 150402, 150466,
+    150530, 150594, 150658, 150722, 150786, 150850, 150914, 150978,
+    151042, 151106, 151170, 151234, 151298, 151362, 151426, 151490,
+    151554, 151618, 151682, 151746, 151810, 151874, 151938, 152002,
+    152066, 152130, 152194, 152258, 152322, 152386, 152450, 152514,
+    152578, 152644, 152770, 152834, 152898, 152962, 153026, 153090,
+    153154, 153220, 153346, 153410, 153476, 153602, 153666, 153730,
+    153794, 153858, 153922, 153986, 154050, 154114, 154178, 154242,
+    154306, 154370, 154434, 154498, 154562, 154626, 154690, 154754,
+    154818, 154882, 154946, 155010, 155074, 155138, 155202, 155266,
+    155330, 2, 2, 67138, 67202, 155394, 155458, 155522,
+    155588, 155716, 155844, 155972, 156100, 156228, 156356, 156484,
+    156610, 156674, 156738, 156802, 156866, 156930, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    156994, 157058, 157122, 157186, 157250, 157314, 157378, 157442,
+    157506, 157570, 157634, 157698, 157762, 157826, 157890, 157954,
+    158018, 150082, 150146, 150210, 0, 158082, 158146, 158210,
+    158274, 158338, 158402, 158466, 158530, 0, 0, 158594,
+    158658, 0, 0, 158722, 158786, 158850, 158914, 158978,
+    159042, 159106, 159170, 159234, 159298, 159362, 159426, 159490,
+    159554, 159618, 159682, 159746, 159810, 159874, 159938, 160002,
+    160066, 0, 160130, 160194, 160258, 160322, 160386, 160450,
+    160514, 0, 160578, 0, 0, 0, 160642, 160706,
+    160770, 160834, 0, 0, 154050, 160898, 160962, 161026,
+    161090, 161154, 161218, 161282, 161346, 0, 0, 161411,
+    161474, 0, 0, 161538, 161602, 161666, 161732, 0,
+    0, 0, 0, 0, 0, 0, 0, 161858,
+    0, 0, 0, 0, 161924, 162052, 0, 162180,
+    162306, 162370, 162434, 162498, 0, 0, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    162562, 162626, 162690, 162754, 162818, 162882, 162946, 163010,
+    163074, 163138, 163202, 163266, 163330, 163394, 163458, 0,
+    0, 150082, 150146, 150210, 0, 163522, 163586, 163650,
+    163714, 163778, 163842, 0, 0, 0, 0, 163906,
+    163970, 0, 0, 164034, 164098, 164162, 164226, 164290,
+    164354, 164418, 164482, 164546, 164610, 164674, 164738, 164802,
+    164866, 164930, 164994, 165058, 165122, 165186, 165250, 165314,
+    165378, 0, 165442, 165506, 165570, 165634, 165698, 165762,
+    165826, 0, 165890, 165956, 0, 166082, 166148, 0,
+    166274, 166338, 0, 0, 154050, 0, 166402, 166466,
+    166530, 166594, 166658, 0, 0, 0, 0, 166722,
+    166786, 0, 0, 166850, 166914, 166978, 0, 0,
+    0, 167042, 0, 0, 0, 0, 0, 0,
+    0, 167108, 167236, 167364, 167490, 0, 167556, 0,
+    0, 0, 0, 0, 0, 0, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    167682, 167746, 167810, 167874, 167938, 168002, 168066, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 150082, 150146, 150210, 0, 168130, 168194, 168258,
+    168322, 168386, 168450, 168514, 168578, 168642, 0, 168706,
+    168770, 168834, 0, 168898, 168962, 169026, 169090, 169154,
+    169218, 169282, 169346, 169410, 169474, 169538, 169602, 169666,
+    169730, 169794, 169858, 169922, 169986, 170050, 170114, 170178,
+    170242, 0, 170306, 170370, 170434, 170498, 170562, 170626,
+    170690, 0, 170754, 170818, 0, 170882, 170946, 171010,
+    171074, 171138, 0, 0, 154050, 171202, 171266, 171330,
+    171394, 171458, 171522, 171586, 171650, 171714, 0, 171778,
+    171842, 171906, 0, 171970, 172034, 172098, 0, 0,
+    172162, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    172226, 172290, 172354, 172418, 0, 0, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    172482, 172546, 0, 0, 0, 0, 0, 0,
+    0, 172610, 117122, 117058, 117186, 154050, 154050, 154050,
+    0, 150082, 150146, 150210, 0, 172674, 172738, 172802,
+    172866, 172930, 172994, 173058, 173122, 0, 0, 173186,
+    173250, 0, 0, 173314, 173378, 173442, 173506, 173570,
+    173634, 173698, 173762, 173826, 173890, 173954, 174018, 174082,
+    174146, 174210, 174274, 174338, 174402, 174466, 174530, 174594,
+    174658, 0, 174722, 174786, 174850, 174914, 174978, 175042,
+    175106, 0, 175170, 175234, 0, 175298, 175362, 175426,
+    175490, 175554, 0, 0, 154050, 175618, 175682, 175746,
+    175810, 175874, 175938, 176002, 176066, 0, 0, 176131,
+    176194, 0, 0, 176258, 176322, 176386, 0, 0,
+    0, 0, 0, 0, 0, 67970, 176450, 176514,
+    0, 0, 0, 0, 176580, 176708, 0, 176834,
+    176898, 176962, 177026, 177090, 0, 0, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    177154, 177218, 177282, 177346, 177410, 177474, 177538, 177602,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 150146, 177666, 0, 177730, 177794, 177858,
+    177922, 177986, 178050, 0, 0, 0, 178114, 178178,
+    178242, 0, 178307, 178370, 178434, 178498, 0, 0,
+    0, 178562, 178626, 0, 178690, 0, 178754, 178818,
+    0, 0, 0, 178882, 178946, 0, 0, 0,
+    179010, 179074, 179138, 0, 0, 0, 179202, 179266,
+    179330, 179394, 179458, 179522, 179586, 179650, 179714, 179778,
+    179842, 179906, 0, 0, 0, 0, 179970, 180034,
+    180098, 180162, 180226, 0, 0, 0, 180291, 180355,
+    180418, 0, 180482, 180546, 180610, 180674, 0, 0,
+    180738, 0, 0, 0, 0, 0, 0, 180802,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    180866, 180930, 180994, 181058, 181122, 181186, 181250, 181314,
+    181378, 181442, 181506, 0, 0, 0, 0, 0,
+    150082, 150082, 150146, 150210, 150146, 181570, 181634, 181698,
+    181762, 181826, 181890, 181954, 182018, 0, 182082, 182146,
+    182210, 0, 182274, 182338, 182402, 182466, 182530, 182594,
+    182658, 182722, 182786, 182850, 182914, 182978, 183042, 183106,
+    183170, 183234, 183298, 183362, 183426, 183490, 183554, 183618,
+    183682, 0, 183746, 183810, 183874, 183938, 184002, 184066,
+    184130, 184194, 184258, 184322, 184386, 184450, 184514, 184578,
+    184642, 184706, 0, 0, 0, 184770, 184834, 184898,
+    184962, 185026, 185090, 185154, 185218, 0, 185283, 185346,
+    185410, 0, 185474, 185538, 185602, 185666, 0, 0,
+    0, 0, 0, 0, 0, 185730, 185794, 0,
+    185858, 185922, 185986, 0, 0, 0, 0, 0,
+    186050, 186114, 186178, 186242, 0, 0, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    0, 0, 0, 0, 0, 0, 0, 186306,
+    1410, 1474, 1538, 1602, 1474, 1538, 1602, 186370,
+    186434, 150082, 150146, 150210, 186498, 186562, 186626, 186690,
+    186754, 186818, 186882, 186946, 187010, 0, 187074, 187138,
+    187202, 0, 187266, 187330, 187394, 187458, 187522, 187586,
+    187650, 187714, 187778, 187842, 187906, 187970, 188034, 188098,
+    188162, 188226, 188290, 188354, 188418, 188482, 188546, 188610,
+    188674, 0, 188738, 188802, 188866, 188930, 188994, 189058,
+    189122, 189186, 189250, 189314, 0, 189378, 189442, 189506,
+    189570, 189634, 0, 0, 154050, 189698, 189762, 189827,
+    189890, 189954, 190018, 190082, 190146, 0, 190211, 190274,
+    190338, 0, 190403, 190466, 190530, 190594, 0, 0,
+    0, 0, 0, 0, 0, 190658, 190722, 0,
+    0, 0, 0, 0, 0, 0, 190786, 0,
+    190850, 190914, 190978, 191042, 0, 0, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    0, 191106, 191170, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    150146, 150082, 150146, 150210, 191234, 191298, 191362, 191426,
+    191490, 191554, 191618, 191682, 191746, 0, 191810, 191874,
+    191938, 0, 192002, 192066, 192130, 192194, 192258, 192322,
+    192386, 192450, 192514, 192578, 192642, 192706, 192770, 192834,
+    192898, 192962, 193026, 193090, 193154, 193218, 193282, 193346,
+    193410, 193474, 193538, 193602, 193666, 193730, 193794, 193858,
+    193922, 193986, 194050, 194114, 194178, 194242, 194306, 194370,
+    194434, 194498, 194562, 194626, 194626, 194690, 194754, 194818,
+    194882, 194946, 195010, 195074, 195138, 0, 195203, 195267,
+    195330, 0, 195394, 195458, 195522, 195586, 195652, 195778,
+    0, 0, 0, 0, 195844, 195972, 196100, 196226,
+    196290, 196354, 196418, 196482, 196546, 196610, 196674, 196738,
+    196802, 196866, 196930, 196994, 0, 0, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    197058, 197122, 197186, 197250, 197314, 197378, 197442, 197506,
+    197570, 197634, 197700, 197828, 195652, 197956, 198084, 198212,
+    0, 150082, 150146, 150210, 0, 198338, 198402, 198466,
+    198530, 198594, 198658, 198722, 198786, 198850, 198914, 198978,
+    199042, 199106, 199170, 199234, 199298, 199362, 199426, 0,
+    0, 0, 199490, 199554, 199618, 199682, 199746, 199810,
+    199874, 199938, 200002, 200066, 200130, 200194, 200258, 200322,
+    200386, 200450, 200514, 200578, 200642, 200706, 200770, 200834,
+    200898, 200962, 0, 201026, 201090, 201154, 201218, 201282,
+    201346, 201410, 201474, 201538, 0, 201602, 0, 0,
+    201666, 201730, 201794, 201858, 201922, 201986, 202050, 0,
+    0, 0, 202114, 0, 0, 0, 0, 202178,
+    202242, 202306, 202370, 202434, 202498, 0, 202562, 0,
+    202626, 202691, 202754, 202818, 202883, 202946, 203010, 203074,
+    0, 0, 0, 0, 0, 0, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    0, 0, 203138, 203202, 203266, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 203330, 203394, 203458, 203522, 203586, 203650, 203714,
+    203778, 203842, 203906, 203970, 204034, 204098, 204162, 204226,
+    204290, 204354, 204418, 204482, 204546, 204610, 204674, 204738,
+    204802, 204866, 204930, 204994, 205058, 205122, 205186, 205250,
+    205314, 205378, 205442, 205506, 205570, 205634, 205698, 205762,
+    205826, 205890, 205954, 206018, 206082, 206146, 206210, 206274,
+    206338, 206402, 206466, 206530, 206594, 206658, 206722, 206786,
+    206850, 206914, 206978, 0, 0, 0, 0, 207042,
+    207107, 207171, 207235, 207299, 207363, 207426, 207490, 207554,
+    207618, 207682, 207746, 207810, 207874, 207939, 208002, 208066,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 208130, 208194, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 208258, 208322, 0, 208386, 0, 208450, 208514,
+    208578, 208642, 208706, 0, 208770, 208834, 208898, 208962,
+    209026, 209090, 209154, 209218, 209282, 209346, 209410, 209474,
+    209538, 209602, 209666, 209730, 209794, 209858, 209922, 209986,
+    210050, 210114, 210178, 210242, 0, 210306, 0, 210370,
+    210434, 210498, 210562, 210626, 210690, 210754, 210818, 210882,
+    210946, 211010, 211074, 211138, 211202, 211266, 211330, 211394,
+    211458, 211522, 211586, 211650, 211714, 211778, 0, 0,
+    211843, 211907, 211971, 212035, 212099, 0, 212162, 0,
+    212226, 212290, 212354, 212418, 212482, 212547, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 212612, 212740, 212866, 212930,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    212998, 213186, 213250, 213314, 213378, 213442, 213506, 213570,
+    213634, 213698, 213762, 213826, 213890, 213954, 214018, 214082,
+    214146, 214210, 214274, 214338, 214402, 214466, 214530, 214594,
+    2, 2, 214658, 214722, 214786, 214850, 214914, 214978,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 215042, 215106, 215170, 215234, 215298, 215362,
+    215426, 215490, 215554, 215618, 215682, 2, 215746, 2,
+    215810, 215874, 215938, 216002, 216066, 216130, 2, 2,
+    216194, 216258, 216322, 216388, 216514, 216578, 216642, 216706,
+    0, 216770, 216834, 216898, 216962, 217028, 217154, 217218,
+    217282, 217346, 217412, 217538, 217602, 217666, 217730, 217796,
+    217922, 217986, 218050, 218114, 218180, 218306, 218370, 218434,
+    218498, 218562, 218626, 218690, 218754, 218818, 218882, 218946,
+    219010, 219076, 219204, 219330, 219394, 0, 0, 0,
+    0, 219459, 219522, 219586, 219650, 219714, 219778, 219842,
+    219906, 219970, 220034, 220098, 220162, 220226, 150146, 150210,
+    220290, 220354, 2, 2, 220418, 220482, 2, 2,
+    220546, 220610, 220674, 220738, 220802, 220866, 220930, 220994,
+    221058, 221122, 221186, 221252, 221378, 221442, 221506, 221570,
+    0, 221634, 221698, 221762, 221826, 221892, 222018, 222082,
+    222146, 222210, 222276, 222402, 222466, 222530, 222594, 222660,
+    222786, 222850, 222914, 222978, 223044, 223170, 223234, 223298,
+    223362, 223426, 223491, 223555, 223618, 223682, 223746, 223810,
+    223874, 223940, 224068, 224196, 224324, 0, 224450, 224514,
+    224578, 224642, 224706, 224770, 224834, 224898, 2, 224962,
+    225026, 225090, 225154, 225218, 225282, 0, 225346, 225410,
+    225474, 225538, 225602, 225666, 225730, 225794, 225858, 225922,
+    225986, 226050, 226114, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    226178, 226242, 226306, 226370, 226434, 226498, 226562, 226626,
+    226690, 226754, 226818, 226882, 226946, 227010, 227074, 227138,
+    227202, 227266, 227330, 227394, 227458, 227522, 227586, 227650,
+    227714, 227778, 227842, 227906, 227970, 228034, 228098, 228162,
+    228226, 228290, 228354, 228418, 228482, 228547, 228610, 228674,
+    228738, 228802, 228866, 228930, 228994, 229058, 229122, 229186,
+    229250, 229314, 229378, 229442, 229506, 229570, 150146, 229634,
+    150210, 229698, 229762, 229826, 229890, 229954, 230018, 230086,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 230274, 230338, 230402, 230466, 230530, 230594,
+    230658, 230722, 230786, 230850, 230914, 230978, 231042, 231106,
+    231170, 231234, 231298, 231362, 231426, 231490, 231554, 231618,
+    231682, 231746, 231810, 231874, 231938, 232002, 232066, 232130,
+    232194, 232258, 232322, 232386, 232450, 232514, 232578, 232642,
+    232706, 232770, 232834, 232898, 232962, 233026, 233090, 233154,
+    233218, 233282, 233346, 233410, 233474, 233538, 233602, 233666,
+    233730, 233794, 233858, 233922, 233986, 234050, 234114, 234178,
+    234242, 234306, 234370, 234434, 234498, 234562, 234626, 234690,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 234754, 234818, 234882, 234946, 235010, 235074,
+    235138, 235202, 235266, 235330, 235394, 235458, 235522, 235586,
+    235650, 235714, 235778, 235842, 235906, 235970, 236034, 236098,
+    236162, 236226, 236290, 236354, 236418, 236482, 236546, 236610,
+    236674, 236738, 236802, 236866, 236930, 236994, 237058, 237122,
+    237186, 237250, 237314, 237378, 237442, 237506, 0, 237570,
+    0, 0, 0, 0, 0, 237634, 0, 0,
+    237698, 237762, 237826, 237890, 237954, 238018, 238082, 238146,
+    238210, 238274, 238338, 238402, 238466, 238530, 238594, 238658,
+    238722, 238786, 238850, 238914, 238978, 239042, 239106, 239170,
+    239234, 239298, 239362, 239426, 239490, 239554, 239618, 239682,
+    239746, 239810, 239874, 239938, 240002, 240066, 240130, 240194,
+    240258, 240322, 240386, 240450, 240514, 240578, 240642, 240706,
+    240770, 240834, 240898, 240962, 241026, 241090, 241154, 241218,
+    241282, 241346, 241410, 241474, 241538, 241602, 241666, 241730,
+    241794, 241858, 241922, 241986, 242050, 242114, 242178, 242242,
+    242306, 242370, 242434, 242498, 242562, 242626, 242690, 242754,
+    242818, 242882, 242946, 243010, 243074, 243138, 243202, 243266,
+    243330, 243394, 243458, 243522, 243586, 243650, 243714, 243778,
+    243842, 243906, 243970, 244034, 244098, 244162, 244226, 244290,
+    244354, 244418, 244482, 244546, 244610, 244674, 244738, 244802,
+    244866, 244930, 244994, 245058, 245122, 245186, 245250, 245314,
+    245378, 245442, 245506, 245570, 245634, 245698, 245762, 245826,
+    245890, 245954, 246018, 246082, 246146, 246210, 246274, 246338,
+    246402, 246466, 246530, 246594, 246658, 246722, 246786, 246850,
+    246914, 246978, 247042, 247106, 247170, 247234, 247298, 247362,
+    247426, 247490, 247554, 247618, 247682, 247746, 247810, 247874,
+    247938, 248002, 248066, 248130, 248194, 248258, 248322, 248386,
+    248450, 248514, 248578, 248642, 248706, 248770, 248834, 248898,
+    248962, 249026, 249090, 249154, 249218, 249282, 249346, 249410,
+    249474, 249538, 249602, 249666, 249730, 249794, 249858, 249922,
+    249986, 250050, 250114, 250178, 250242, 250306, 250370, 250434,
+    250498, 250562, 250626, 250690, 250754, 250818, 250882, 250946,
+    251010, 251074, 251138, 251202, 251266, 251330, 251394, 251458,
+    251522, 251586, 251650, 251714, 251778, 251842, 251906, 251970,
+    252034, 252098, 252162, 252226, 252290, 252354, 252418, 252482,
+    252546, 252610, 252674, 252738, 252802, 252866, 252930, 252994,
+    253058, 253122, 253186, 253250, 253314, 253378, 253442, 253506,
+    253570, 253634, 253698, 253762, 253826, 253890, 253954, 254018,
+    254082, 254146, 254210, 254274, 254338, 254402, 254466, 254530,
+    254594, 254658, 254722, 254786, 254850, 254914, 254978, 255042,
+    255106, 255170, 255234, 255298, 255362, 255426, 255490, 255554,
+    255618, 255682, 255746, 255810, 255874, 255938, 256002, 256066,
+    256130, 256194, 256258, 256322, 256386, 256450, 256514, 256578,
+    256642, 256706, 256770, 256834, 256898, 256962, 257026, 257090,
+    257154, 257218, 257282, 257346, 257410, 257474, 257538, 257602,
+    257666, 257730, 257794, 257858, 257922, 257986, 258050, 258114,
+    258178, 258242, 258306, 258370, 258434, 258498, 258562, 258626,
+    258690, 258754, 258818, 258882, 258946, 259010, 259074, 259138,
+    259202, 259266, 259330, 259394, 259458, 259522, 259586, 259650,
+    259714, 259778, 259842, 259906, 259970, 260034, 260098, 260162,
+    260226, 260290, 260354, 260418, 260482, 260546, 260610, 260674,
+    260738, 260802, 260866, 260930, 260994, 261058, 261122, 261186,
+    261250, 261314, 261378, 261442, 261506, 261570, 261634, 261698,
+    261762, 0, 261826, 261890, 261954, 262018, 0, 0,
+    262082, 262146, 262210, 262274, 262338, 262402, 262466, 0,
+    262530, 0, 262594, 262658, 262722, 262786, 0, 0,
+    262850, 262914, 262978, 263042, 263106, 263170, 263234, 263298,
+    263362, 263426, 263490, 263554, 263618, 263682, 263746, 263810,
+    263874, 263938, 264002, 264066, 264130, 264194, 264258, 264322,
+    264386, 264450, 264514, 264578, 264642, 264706, 264770, 264834,
+    264898, 264962, 265026, 265090, 265154, 265218, 265282, 265346,
+    265410, 0, 265474, 265538, 265602, 265666, 0, 0,
+    265730, 265794, 265858, 265922, 265986, 266050, 266114, 266178,
+    266242, 266306, 266370, 266434, 266498, 266562, 266626, 266690,
+    266754, 266818, 266882, 266946, 267010, 267074, 267138, 267202,
+    267266, 267330, 267394, 267458, 267522, 267586, 267650, 267714,
+    267778, 0, 267842, 267906, 267970, 268034, 0, 0,
+    268098, 268162, 268226, 268290, 268354, 268418, 268482, 0,
+    268546, 0, 268610, 268674, 268738, 268802, 0, 0,
+    268866, 268930, 268994, 269058, 269122, 269186, 269250, 269314,
+    269378, 269442, 269506, 269570, 269634, 269698, 269762, 0,
+    269826, 269890, 269954, 270018, 270082, 270146, 270210, 270274,
+    270338, 270402, 270466, 270530, 270594, 270658, 270722, 270786,
+    270850, 270914, 270978, 271042, 271106, 271170, 271234, 271298,
+    271362, 271426, 271490, 271554, 271618, 271682, 271746, 271810,
+    271874, 271938, 272002, 272066, 272130, 272194, 272258, 272322,
+    272386, 272450, 272514, 272578, 272642, 272706, 272770, 272834,
+    272898, 272962, 273026, 273090, 273154, 273218, 273282, 273346,
+    273410, 0, 273474, 273538, 273602, 273666, 0, 0,
+    273730, 273794, 273858, 273922, 273986, 274050, 274114, 274178,
+    274242, 274306, 274370, 274434, 274498, 274562, 274626, 274690,
+    274754, 274818, 274882, 274946, 275010, 275074, 275138, 275202,
+    275266, 275330, 275394, 275458, 275522, 275586, 275650, 275714,
+    275778, 275842, 275906, 275970, 276034, 276098, 276162, 276226,
+    276290, 276354, 276418, 276482, 276546, 276610, 276674, 276738,
+    276802, 276866, 276930, 276994, 277058, 277122, 277186, 277250,
+    277314, 277378, 277442, 277506, 277570, 277634, 277698, 277762,
+    277826, 277890, 277954, 0, 0, 278018, 278082, 278146,
+    278210, 278274, 278338, 278402, 278466, 278530, 278594, 278658,
+    278722, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 278786, 278850, 278914, 278978, 279042, 279106,
+    279170, 279234, 279298, 279362, 279426, 0, 0, 0,
+    279490, 279554, 279618, 279682, 279746, 279810, 279874, 279938,
+    280002, 280066, 280130, 280194, 280258, 280322, 280386, 280450,
+    280514, 280578, 280642, 280706, 280770, 280834, 280898, 280962,
+    281026, 281090, 0, 0, 0, 0, 0, 0,
+    281154, 281218, 281282, 281346, 281410, 281474, 281538, 281602,
+    281666, 281730, 281794, 281858, 281922, 281986, 282050, 282114,
+    282178, 282242, 282306, 282370, 282434, 282498, 282562, 282626,
+    282690, 282754, 282818, 282882, 282946, 283010, 283074, 283138,
+    283202, 283266, 283330, 283394, 283458, 283522, 283586, 283650,
+    283714, 283778, 283842, 283906, 283970, 284034, 284098, 284162,
+    284226, 284290, 284354, 284418, 284482, 284546, 284610, 284674,
+    284738, 284802, 284866, 284930, 284994, 285058, 285122, 285186,
+    285250, 285314, 285378, 285442, 285506, 285570, 285634, 285698,
+    285762, 285826, 285890, 285954, 286018, 286082, 286146, 286210,
+    286274, 286338, 286402, 286466, 286530, 286594, 0, 0,
+    286658, 286722, 286786, 286850, 286914, 286978, 0, 0,
+    287042, 287106, 287170, 287234, 287298, 287362, 287426, 287490,
+    287554, 287618, 287682, 287746, 287810, 287874, 287938, 288002,
+    288066, 288130, 288194, 288258, 288322, 288386, 288450, 288514,
+    288578, 288642, 288706, 288770, 288834, 288898, 288962, 289026,
+    289090, 289154, 289218, 289282, 289346, 289410, 289474, 289538,
+    289602, 289666, 289730, 289794, 289858, 289922, 289986, 290050,
+    290114, 290178, 290242, 290306, 290370, 290434, 290498, 290562,
+    290626, 290690, 290754, 290818, 290882, 290946, 291010, 291074,
+    291138, 291202, 291266, 291330, 291394, 291458, 291522, 291586,
+    291650, 291714, 291778, 291842, 291906, 291970, 292034, 292098,
+    292162, 292226, 292290, 292354, 292418, 292482, 292546, 292610,
+    292674, 292738, 292802, 292866, 292930, 292994, 293058, 293122,
+    293186, 293250, 293314, 293378, 293442, 293506, 293570, 293634,
+    293698, 293762, 293826, 293890, 293954, 294018, 294082, 294146,
+    294210, 294274, 294338, 294402, 294466, 294530, 294594, 294658,
+    294722, 294786, 294850, 294914, 294978, 295042, 295106, 295170,
+    295234, 295298, 295362, 295426, 295490, 295554, 295618, 295682,
+    295746, 295810, 295874, 295938, 296002, 296066, 296130, 296194,
+    296258, 296322, 296386, 296450, 296514, 296578, 296642, 296706,
+    296770, 296834, 296898, 296962, 297026, 297090, 297154, 297218,
+    297282, 297346, 297410, 297474, 297538, 297602, 297666, 297730,
+    297794, 297858, 297922, 297986, 298050, 298114, 298178, 298242,
+    298306, 298370, 298434, 298498, 298562, 298626, 298690, 298754,
+    298818, 298882, 298946, 299010, 299074, 299138, 299202, 299266,
+    299330, 299394, 299458, 299522, 299586, 299650, 299714, 299778,
+    299842, 299906, 299970, 300034, 300098, 300162, 300226, 300290,
+    300354, 300418, 300482, 300546, 300610, 300674, 300738, 300802,
+    300866, 300930, 300994, 301058, 301122, 301186, 301250, 301314,
+    301378, 301442, 301506, 301570, 301634, 301698, 301762, 301826,
+    301890, 301954, 302018, 302082, 302146, 302210, 302274, 302338,
+    302402, 302466, 302530, 302594, 302658, 302722, 302786, 302850,
+    302914, 302978, 303042, 303106, 303170, 303234, 303298, 303362,
+    303426, 303490, 303554, 303618, 303682, 303746, 303810, 303874,
+    303938, 304002, 304066, 304130, 304194, 304258, 304322, 304386,
+    304450, 304514, 304578, 304642, 304706, 304770, 304834, 304898,
+    304962, 305026, 305090, 305154, 305218, 305282, 305346, 305410,
+    305474, 305538, 305602, 305666, 305730, 305794, 305858, 305922,
+    305986, 306050, 306114, 306178, 306242, 306306, 306370, 306434,
+    306498, 306562, 306626, 306690, 306754, 306818, 306882, 306946,
+    307010, 307074, 307138, 307202, 307266, 307330, 307394, 307458,
+    307522, 307586, 307650, 307714, 307778, 307842, 307906, 307970,
+    308034, 308098, 308162, 308226, 308290, 308354, 308418, 308482,
+    308546, 308610, 308674, 308738, 308802, 308866, 308930, 308994,
+    309058, 309122, 309186, 309250, 309314, 309378, 309442, 309506,
+    309570, 309634, 309698, 309762, 309826, 309890, 309954, 310018,
+    310082, 310146, 310210, 310274, 310338, 310402, 310466, 310530,
+    310594, 310658, 310722, 310786, 310850, 310914, 310978, 311042,
+    311106, 311170, 311234, 311298, 311362, 311426, 311490, 311554,
+    311618, 311682, 311746, 311810, 311874, 311938, 312002, 312066,
+    312130, 312194, 312258, 312322, 312386, 312450, 312514, 312578,
+    312642, 312706, 312770, 312834, 312898, 312962, 313026, 313090,
+    313154, 313218, 313282, 313346, 313410, 313474, 313538, 313602,
+    313666, 313730, 313794, 313858, 313922, 313986, 314050, 314114,
+    314178, 314242, 314306, 314370, 314434, 314498, 314562, 314626,
+    314690, 314754, 314818, 314882, 314946, 315010, 315074, 315138,
+    315202, 315266, 315330, 315394, 315458, 315522, 315586, 315650,
+    315714, 315778, 315842, 315906, 315970, 316034, 316098, 316162,
+    316226, 316290, 316354, 316418, 316482, 316546, 316610, 316674,
+    316738, 316802, 316866, 316930, 316994, 317058, 317122, 317186,
+    317250, 317314, 317378, 317442, 317506, 317570, 317634, 317698,
+    317762, 317826, 317890, 317954, 318018, 318082, 318146, 318210,
+    318274, 318338, 318402, 318466, 318530, 318594, 318658, 318722,
+    318786, 318850, 318914, 318978, 319042, 319106, 319170, 319234,
+    319298, 319362, 319426, 319490, 319554, 319618, 319682, 319746,
+    319810, 319874, 319938, 320002, 320066, 320130, 320194, 320258,
+    320322, 320386, 320450, 320514, 320578, 320642, 320706, 320770,
+    320834, 320898, 320962, 321026, 321090, 321154, 321218, 321282,
+    321346, 321410, 321474, 321538, 321602, 321666, 321730, 321794,
+    321858, 321922, 321986, 322050, 322114, 322178, 322242, 322306,
+    322370, 322434, 322498, 322562, 322626, 322690, 322754, 322818,
+    322882, 322946, 323010, 323074, 323138, 323202, 323266, 323330,
+    323394, 323458, 323522, 323586, 323650, 323714, 323778, 323842,
+    323906, 323970, 324034, 324098, 324162, 324226, 324290, 324354,
+    324418, 324482, 324546, 324610, 324674, 324738, 324802, 324866,
+    324930, 324994, 325058, 325122, 325186, 325250, 325314, 325378,
+    325442, 325506, 325570, 325634, 325698, 325762, 325826, 325890,
+    325954, 326018, 326082, 326146, 326210, 326274, 326338, 326402,
+    326466, 326530, 326594, 326658, 326722, 326786, 326850, 326914,
+    326978, 327042, 327106, 327170, 327234, 327298, 327362, 327426,
+    327490, 327554, 327618, 327682, 327746, 327810, 327874, 327938,
+    328002, 328066, 328130, 328194, 328258, 328322, 328386, 328450,
+    328514, 328578, 328642, 328706, 328770, 328834, 328898, 328962,
+    329026, 329090, 329154, 329218, 329282, 329346, 329410, 329474,
+    329538, 329602, 329666, 329730, 329794, 0, 0, 0,
+    329858, 329924, 330050, 330114, 330180, 330308, 330434, 330500,
+    330626, 330692, 330818, 330882, 330948, 331076, 331204, 331330,
+    331394, 331458, 331522, 331588, 331716, 331844, 331972, 332098,
+    332162, 332226, 332290, 332356, 332484, 332612, 332738, 332804,
+    332932, 333058, 333124, 333250, 333316, 333442, 333508, 333634,
+    333698, 333762, 333826, 333892, 334020, 334148, 334276, 334402,
+    334468, 334596, 334722, 334788, 334916, 335044, 335170, 335234,
+    335300, 335428, 335554, 335620, 335746, 335812, 335938, 336002,
+    336066, 336130, 336194, 336258, 336322, 336386, 336450, 336516,
+    336644, 336772, 336900, 337026, 337090, 337154, 337220, 337352,
+    337604, 337730, 337794, 337858, 337922, 337986, 338050, 338114,
+    338178, 0, 0, 0, 0, 0, 0, 0,
+    338242, 338306, 338370, 338434, 338498, 338562, 338626, 338690,
+    338754, 338818, 338882, 338946, 339010, 0, 339074, 339138,
+    339202, 339266, 339330, 339394, 339458, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    339522, 339586, 339650, 339714, 339778, 339842, 339906, 339970,
+    340034, 340098, 340162, 340226, 340290, 340354, 340418, 340482,
+    340546, 340610, 340674, 340738, 340802, 340866, 340930, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    340994, 341058, 341122, 341186, 341250, 341314, 341378, 341442,
+    341506, 341570, 341634, 341698, 341762, 341826, 341890, 341954,
+    342018, 342082, 342146, 342210, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    342274, 342338, 342402, 342466, 342530, 342594, 342658, 342722,
+    342786, 342850, 342914, 342978, 343042, 0, 343106, 343170,
+    343234, 0, 343298, 343362, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    343426, 343490, 343554, 343618, 343682, 343746, 343810, 343874,
+    343938, 344002, 344066, 344130, 344194, 344258, 344322, 344386,
+    344450, 344514, 344578, 344642, 344706, 344770, 344834, 344898,
+    344962, 345026, 345090, 345154, 345218, 345282, 345346, 345410,
+    345474, 345538, 345602, 345666, 345730, 345794, 345858, 345922,
+    345986, 346050, 346114, 346178, 346242, 346306, 346370, 346434,
+    346498, 346562, 346626, 346690, 2, 2, 346754, 346818,
+    346882, 346946, 347010, 347074, 347138, 347202, 347266, 347330,
+    347394, 347458, 347522, 347586, 347650, 347714, 150146, 150210,
+    347778, 347842, 347906, 67970, 67970, 67970, 67970, 67970,
+    67970, 67970, 347970, 2, 348034, 348098, 348162, 348226,
+    348290, 348354, 348418, 348482, 348546, 67970, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    348610, 348674, 348738, 348802, 348866, 348930, 348994, 349058,
+    349122, 349186, 2, 2, 2, 2, 2, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    349250, 349314, 349378, 349442, 349506, 349570, 349634, 349698,
+    349762, 349826, 349890, 349954, 350018, 350082, 350146, 350210,
+    350274, 350338, 350402, 350466, 350530, 350594, 350658, 350722,
+    350786, 350850, 350914, 350978, 351042, 351106, 351170, 351234,
+    351298, 351362, 351426, 351490, 351554, 351618, 351682, 351746,
+    351810, 351874, 351938, 352002, 352066, 352130, 352194, 352258,
+    352322, 352386, 352450, 352514, 352578, 352642, 352706, 352770,
+    352834, 352898, 352962, 353026, 353090, 353154, 353218, 353282,
+    353346, 353410, 353474, 353538, 353602, 353666, 353730, 353794,
+    353858, 353922, 353986, 354050, 354114, 354178, 354242, 354306,
+    354370, 354434, 354498, 354562, 354626, 354690, 354754, 354818,
+    354882, 0, 0, 0, 0, 0, 0, 0,
+    354946, 355010, 355074, 355138, 355202, 355266, 355330, 355394,
+    355458, 355522, 355586, 355650, 355714, 355778, 355842, 355906,
+    355970, 356034, 356098, 356162, 356226, 356290, 356354, 356418,
+    356482, 356546, 356610, 356674, 356738, 356802, 356866, 356930,
+    356994, 357058, 357122, 357186, 357250, 357314, 357378, 357442,
+    357506, 357570, 357634, 0, 0, 0, 0, 0,
+    357698, 357762, 357826, 357890, 357954, 358018, 358082, 358146,
+    358210, 358274, 358338, 358402, 358466, 358530, 358594, 358658,
+    358722, 358786, 358850, 358914, 358978, 359042, 359106, 359170,
+    359234, 359298, 359362, 359426, 359490, 359554, 359618, 359682,
+    359746, 359810, 359874, 359938, 360002, 360066, 360130, 360194,
+    360258, 360322, 360386, 360450, 360514, 360578, 360642, 360706,
+    360770, 360834, 360898, 360962, 361026, 361090, 361154, 361218,
+    361282, 361346, 361410, 361474, 361538, 361602, 361666, 361730,
+    361794, 361858, 361922, 361986, 362050, 362114, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    362178, 362242, 362306, 362370, 362434, 362498, 362562, 362626,
+    362690, 362754, 362818, 362882, 362946, 363010, 363074, 363138,
+    363202, 363266, 363330, 363394, 363458, 363522, 363586, 363650,
+    363714, 363778, 363842, 363906, 363970, 364036, 364164, 0,
+    364290, 364354, 364418, 364482, 364546, 364610, 364674, 364738,
+    364802, 364866, 364930, 364994, 0, 0, 0, 0,
+    365058, 365122, 365186, 365250, 365314, 365378, 365442, 365506,
+    365570, 365634, 365698, 365762, 0, 0, 0, 0,
+    365826, 0, 0, 0, 365890, 365954, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    366018, 366082, 366146, 366210, 366274, 366338, 366402, 366466,
+    366530, 366594, 366658, 366722, 366786, 366850, 366914, 366978,
+    367042, 367106, 367170, 367234, 367298, 367362, 367426, 367490,
+    367554, 367618, 367682, 367746, 367810, 367874, 0, 0,
+    367938, 368002, 368066, 368130, 368194, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    368258, 368322, 368386, 368450, 368514, 368578, 368642, 368706,
+    368770, 368834, 368898, 368962, 369026, 369090, 369154, 369218,
+    369282, 369346, 369410, 369474, 369538, 369602, 369666, 369730,
+    369794, 369858, 369922, 369986, 370050, 370114, 370178, 370242,
+    370306, 370370, 370434, 370498, 370562, 370626, 370690, 370754,
+    370818, 370882, 370946, 371010, 0, 0, 0, 0,
+    371074, 371138, 371202, 371266, 371330, 371395, 371459, 371523,
+    371586, 371650, 371715, 371778, 371842, 371906, 371970, 372034,
+    372098, 372162, 372226, 372290, 372354, 372418, 372482, 372546,
+    372610, 372674, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1474, 0, 0, 0, 372740, 372870,
+    373058, 373122, 373186, 373250, 373314, 373378, 373442, 373506,
+    373570, 373634, 373698, 373762, 373826, 373890, 373954, 374018,
+    374082, 374146, 374210, 374274, 374338, 374402, 374466, 374530,
+    374594, 374658, 374722, 374786, 374850, 374914, 374978, 375042,
+    375106, 375170, 375234, 375298, 375362, 375426, 375490, 375554,
+    375618, 375682, 375746, 375810, 375874, 375938, 376002, 376066,
+    376130, 376194, 376258, 376322, 376386, 376450, 376514, 376578,
+    376642, 376706, 376770, 376834, 0, 0, 376898, 376962,
+    377026, 377090, 377154, 377218, 377282, 377346, 377410, 377474,
+    377538, 377602, 377666, 377730, 377794, 377858, 377922, 377986,
+    378050, 378114, 378178, 378242, 378306, 378370, 378434, 378498,
+    378562, 378626, 378690, 378754, 378818, 378882, 378946, 379010,
+    379074, 379138, 379202, 379266, 379330, 379394, 379458, 379522,
+    379586, 379650, 379714, 379778, 379842, 379906, 379970, 380034,
+    380098, 380162, 380226, 380290, 380358, 380546, 380610, 380674,
+    380738, 380738, 380802, 380802, 380866, 380930, 380994, 0,
+    381058, 381122, 381186, 381250, 381314, 381378, 381442, 381506,
+    381570, 381634, 381698, 381762, 381826, 381890, 381954, 382018,
+    382082, 382146, 382210, 382274, 150146, 382338, 382402, 382466,
+    382530, 382594, 382658, 382722, 382786, 0, 0, 2,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    382850, 382914, 382978, 383042, 383106, 383170, 383234, 383298,
+    383362, 383426, 383490, 383554, 383618, 383682, 0, 0,
+    67970, 67970, 67970, 67970, 67970, 68354, 68354, 68354,
+    68354, 68354, 68354, 67970, 67970, 68354, 383746, 383810,
+    383874, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    150082, 150082, 150146, 383938, 150210, 384003, 384066, 384131,
+    384194, 384259, 384322, 384387, 384450, 384515, 384578, 384642,
+    384706, 384771, 384834, 384898, 384962, 385026, 385090, 385154,
+    385218, 385282, 385346, 385410, 385474, 385538, 385602, 385666,
+    385730, 385794, 385858, 385922, 385986, 386050, 386114, 386178,
+    386242, 386306, 386370, 386434, 386498, 386562, 386626, 386690,
+    386754, 386818, 386882, 386946, 154050, 387010, 387074, 387138,
+    387202, 387266, 387331, 387394, 387459, 387522, 387587, 387651,
+    387714, 387778, 387843, 387906, 387970, 388034, 388098, 388162,
+    388226, 388290, 388354, 388418, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 388482, 388546, 388610, 388674, 388738, 388802,
+    388866, 388930, 388994, 389058, 389122, 389186, 389250, 389314,
+    389378, 389442, 389506, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 389570, 389634, 389698, 389762,
+    389826, 389890, 389954, 390018, 390082, 0, 0, 0,
+    150146, 390146, 150210, 390210, 390274, 390338, 390402, 390466,
+    390530, 390594, 390658, 390722, 390786, 390850, 390914, 390978,
+    391042, 391106, 391170, 391234, 391298, 391362, 391426, 391490,
+    391554, 391618, 391682, 391746, 391810, 391874, 391938, 392002,
+    392066, 392130, 392194, 392258, 392322, 392386, 392450, 392514,
+    392578, 392642, 392706, 392770, 392834, 392898, 392962, 393026,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 393090, 393154, 393218, 393282, 393346, 393410,
+    393474, 393538, 393602, 393666, 393666, 393730, 393794, 393858,
+    393922, 393986, 394050, 394114, 394178, 394178, 394242, 394306,
+    394370, 394434, 394498, 394562, 394626, 394690, 394754, 394818,
+    394882, 394946, 394946, 395010, 395074, 395138, 395202, 395266,
+    395330, 395394, 395458, 395522, 395586, 395650, 154050, 395714,
+    395778, 395842, 395906, 395970, 396034, 396098, 396162, 396226,
+    396290, 396354, 396418, 396482, 0, 0, 0, 0,
+    0, 0, 0, 0, 396546, 396610, 396674, 396738,
+    396802, 396866, 396930, 396994, 397058, 397122, 397186, 397250,
+    397314, 397378, 397442, 397506, 397570, 397634, 397698, 397762,
+    397826, 397890, 397954, 398018, 398082, 398146, 398210, 398274,
+    398338, 398402, 398466, 398530, 398594, 398658, 398722, 398786,
+    398850, 398914, 398978, 399042, 399106, 399170, 399234, 399298,
+    399362, 399426, 399490, 399554, 399618, 399682, 399746, 399810,
+    399874, 399938, 400002, 400066, 400130, 400194, 400258, 154050,
+    0, 0, 0, 400322, 400386, 400450, 400514, 400578,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 400642, 400706, 400770,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 400834, 400898, 400962, 401026, 401090, 401154,
+    401218, 401282, 401346, 401410, 401474, 401538, 401602, 401666,
+    401730, 401794, 401858, 401922, 401986, 402050, 402114, 402178,
+    402242, 402306, 402370, 402434, 402498, 402562, 402626, 402690,
+    402754, 402818, 402882, 402946, 403010, 403074, 403138, 403202,
+    403266, 403330, 403394, 403458, 403522, 403522, 403586, 403650,
+    403714, 0, 0, 0, 0, 0, 0, 0,
+    403778, 403842, 403906, 403970, 404034, 404098, 404162, 404226,
+    404290, 404354, 404418, 404482, 404546, 404610, 404674, 404738,
+    404802, 404866, 404930, 404994, 405058, 405122, 405186, 405250,
+    405314, 405378, 405442, 405506, 405570, 405634, 405698, 405762,
+    405826, 405890, 405954, 406018, 406082, 406146, 406210, 406274,
+    406338, 406402, 406466, 0, 0, 406530, 406594, 406658,
+    406722, 406786, 406850, 406914, 406978, 407042, 407106, 407170,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 407234, 407298, 407298, 407298, 150146, 407298, 407298,
+    407298, 407298, 150210, 150210, 2, 407362, 407426, 2,
+    2, 2, 407298, 0, 0, 0, 0, 0,
+    407490, 407554, 407618, 407682, 407746, 407810, 407874, 407938,
+    408002, 408066, 408130, 408194, 408258, 408322, 408386, 408450,
+    408514, 408578, 408642, 408706, 408770, 408834, 408898, 408962,
+    409026, 409090, 409154, 409218, 409282, 409346, 409410, 409474,
+    409538, 409602, 409666, 409730, 409794, 409858, 409922, 409986,
+    410050, 410114, 410178, 410242, 410306, 410374, 410562, 410626,
+    410690, 410754, 410818, 410882, 410946, 411010, 411074, 411138,
+    411202, 411266, 411330, 411394, 411458, 411522, 411586, 411650,
+    411714, 411778, 411842, 7170, 411906, 411970, 412034, 412098,
+    412162, 412226, 412290, 412354, 412418, 412482, 412546, 412610,
+    412674, 412738, 8130, 412802, 412866, 412930, 412994, 413058,
+    413122, 413186, 413250, 413314, 413378, 413442, 413506, 413570,
+    413634, 413698, 413762, 413826, 413890, 413954, 414018, 414082,
+    414146, 414210, 414274, 414338, 414402, 414466, 414530, 414594,
+    414658, 414722, 414786, 414850, 414914, 414978, 415042, 415106,
+    415170, 415236, 415366, 415554, 415618, 415682, 415746, 415810,
+    415874, 415938, 416002, 416066, 416130, 416194, 416258, 416322,
+    416386, 416450, 416514, 416578, 416642, 416706, 416770, 416834,
+    416898, 416962, 417026, 417090, 417154, 417218, 417282, 417346,
+    417410, 417474, 417538, 417602, 417666, 417730, 417796, 417922,
+    417986, 418050, 418114, 418178, 418242, 418306, 418370, 418434,
+    418498, 418562, 418626, 418690, 418754, 418818, 418882, 418946,
+    419010, 419074, 419138, 419202, 419266, 419330, 419394, 419458,
+    419522, 419586, 419650, 419714, 419778, 419842, 419906, 419970,
+    67970, 67970, 68354, 67970, 67970, 67970, 67970, 67970,
+    67970, 67970, 70658, 67970, 67970, 67970, 67970, 68354,
+    68354, 67970, 420034, 420100, 13766, 420228, 420356, 420484,
+    420612, 15108, 420738, 420802, 420866, 420930, 420994, 421058,
+    421122, 421186, 421250, 421314, 421378, 33028, 421442, 421506,
+    421570, 421634, 421698, 421762, 421826, 421892, 422018, 422082,
+    422148, 383810, 422276, 422404, 422532, 67970, 67970, 67970,
+    67970, 68354, 0, 67970, 68354, 68354, 67970, 68354,
+    422660, 422788, 422916, 423044, 423172, 423300, 423428, 423556,
+    423686, 423878, 424068, 424196, 424324, 424452, 424580, 424708,
+    424836, 424964, 425092, 425220, 425350, 425542, 425734, 425926,
+    426116, 426244, 426372, 426500, 426630, 426822, 427012, 427140,
+    427268, 427396, 427524, 427652, 427780, 427908, 428036, 428164,
+    428292, 428420, 428548, 428676, 428804, 428932, 429062, 429254,
+    429444, 429572, 429700, 429828, 429956, 430084, 430212, 430340,
+    430470, 430662, 430852, 430980, 431108, 431236, 431364, 431492,
+    431620, 431748, 431876, 432004, 432132, 432260, 432388, 432516,
+    432644, 432772, 432900, 433028, 433158, 433350, 433542, 433734,
+    433926, 434118, 434310, 434502, 434692, 434820, 434948, 435076,
+    435204, 435332, 435460, 435588, 435718, 435910, 436100, 436228,
+    436356, 436484, 436612, 436740, 436870, 437062, 437254, 437446,
+    437638, 437830, 438020, 438148, 438276, 438404, 438532, 438660,
+    438788, 438916, 439044, 439172, 439300, 439428, 439556, 439684,
+    439814, 440006, 440198, 440390, 440580, 440708, 440836, 440964,
+    441092, 441220, 441348, 441476, 441604, 441732, 441860, 441988,
+    442116, 442244, 442372, 442500, 442628, 442756, 442884, 443012,
+    443140, 443268, 443396, 443524, 443652, 443780, 443908, 444036,
+    444164, 444292, 444420, 444550, 444738, 444802, 444870, 445058,
+    445124, 445252, 445380, 445508, 445638, 445830, 446022, 446214,
+    446406, 446598, 446790, 446982, 447174, 447366, 447558, 447750,
+    447942, 448134, 448326, 448518, 448710, 448902, 449094, 449286,
+    449476, 449604, 449732, 449860, 449988, 450116, 450246, 450438,
+    450630, 450822, 451014, 451206, 451398, 451590, 451782, 451974,
+    452164, 452292, 452420, 452548, 452676, 452804, 452932, 453060,
+    453190, 453382, 453574, 453766, 453958, 454150, 454342, 454534,
+    454726, 454918, 455110, 455302, 455494, 455686, 455878, 456070,
+    456262, 456454, 456646, 456838, 457028, 457156, 457284, 457412,
+    457542, 457734, 457926, 458118, 458310, 458502, 458694, 458886,
+    459078, 459270, 459460, 459588, 459716, 459844, 459972, 460100,
+    460228, 460356, 460484, 460612, 460738, 460802, 460866, 460930,
+    460996, 461124, 461254, 461446, 461638, 461830, 462022, 462214,
+    462404, 462532, 462662, 462854, 463046, 463238, 463430, 463622,
+    463812, 463940, 464070, 464262, 464454, 464646, 0, 0,
+    464836, 464964, 465094, 465286, 465478, 465670, 0, 0,
+    465860, 465988, 466118, 466310, 466502, 466694, 466886, 467078,
+    467268, 467396, 467526, 467718, 467910, 468102, 468294, 468486,
+    468676, 468804, 468934, 469126, 469318, 469510, 469702, 469894,
+    470084, 470212, 470342, 470534, 470726, 470918, 471110, 471302,
+    471492, 471620, 471750, 471942, 472134, 472326, 0, 0,
+    472516, 472644, 472774, 472966, 473158, 473350, 0, 0,
+    473540, 473668, 473798, 473990, 474182, 474374, 474566, 474758,
+    0, 474948, 0, 475078, 0, 475270, 0, 475462,
+    475652, 475780, 475910, 476102, 476294, 476486, 476678, 476870,
+    477060, 477188, 477318, 477510, 477702, 477894, 478086, 478278,
+    478468, 74692, 478596, 74820, 478724, 74948, 478852, 75076,
+    478980, 77252, 479108, 77380, 479236, 77508, 0, 0,
+    479366, 479558, 479752, 480008, 480264, 480520, 480776, 481032,
+    481286, 481478, 481672, 481928, 482184, 482440, 482696, 482952,
+    483206, 483398, 483592, 483848, 484104, 484360, 484616, 484872,
+    485126, 485318, 485512, 485768, 486024, 486280, 486536, 486792,
+    487046, 487238, 487432, 487688, 487944, 488200, 488456, 488712,
+    488966, 489158, 489352, 489608, 489864, 490120, 490376, 490632,
+    490884, 491012, 491142, 491332, 491462, 0, 491652, 491782,
+    491972, 492100, 492228, 71812, 492356, 492482, 75906, 492482,
+    492546, 492612, 492742, 492932, 493062, 0, 493252, 493382,
+    493572, 71940, 493700, 72068, 493828, 493956, 494084, 494212,
+    494340, 494468, 494598, 72710, 0, 0, 494788, 494918,
+    495108, 495236, 495364, 72196, 0, 495492, 495620, 495748,
+    495876, 496004, 496134, 75206, 496324, 496452, 496580, 496710,
+    496900, 497028, 497156, 72452, 497284, 497412, 71684, 4482,
+    0, 0, 497542, 497732, 497862, 0, 498052, 498182,
+    498372, 72324, 498500, 72580, 498628, 7746, 498754, 0,
+    328002, 328002, 328002, 328002, 328002, 328002, 328002, 6530,
+    328002, 328002, 328002, 2, 2, 2, 2, 2,
+    498818, 498882, 498946, 499010, 499074, 499138, 499202, 499266,
+    499330, 499394, 499458, 499522, 499586, 499650, 499714, 499778,
+    499842, 499906, 499970, 500034, 500098, 500164, 500294, 500482,
+    500546, 500610, 2, 2, 2, 2, 2, 6530,
+    500674, 500738, 500802, 500868, 500998, 501186, 501252, 501382,
+    501570, 501634, 501698, 501762, 501828, 501954, 502018, 502082,
+    502146, 502210, 502274, 502338, 502402, 502466, 502530, 502596,
+    502724, 502852, 502978, 503042, 503106, 503170, 503234, 503298,
+    503362, 503426, 503490, 503554, 503618, 503682, 503746, 503816,
+    504066, 504130, 504194, 504258, 504322, 504386, 504450, 328002,
+    2, 2, 2, 2, 2, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    504514, 504578, 0, 0, 504642, 504706, 504770, 504834,
+    504898, 504962, 505026, 505090, 505154, 505218, 505282, 505346,
+    505410, 505474, 505538, 505602, 505666, 505730, 505794, 505858,
+    505922, 505986, 506050, 506114, 506178, 506242, 506306, 0,
+    506370, 506434, 506498, 506562, 506626, 506690, 506754, 506818,
+    506882, 506946, 507010, 507074, 507138, 0, 0, 0,
+    507202, 507266, 507330, 507394, 507458, 507522, 507586, 507650,
+    507716, 507842, 507906, 507970, 508034, 508098, 508162, 508226,
+    508290, 508354, 508418, 508482, 508546, 508610, 508674, 508738,
+    508802, 508866, 508930, 508994, 509058, 509122, 509186, 509250,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    509314, 509378, 509442, 509442, 509506, 509570, 509634, 509698,
+    69442, 69442, 69442, 509762, 509826, 383746, 383746, 383746,
+    383746, 509890, 383746, 383746, 383746, 69442, 509954, 510018,
+    510082, 510146, 69442, 69442, 68354, 68354, 68354, 68354,
+    67970, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    510214, 510406, 510594, 510660, 510786, 510854, 511046, 511234,
+    511298, 511364, 511490, 511554, 511554, 511554, 511618, 22020,
+    511682, 511682, 511746, 511810, 511874, 511938, 512004, 512130,
+    512194, 512258, 512322, 512386, 512386, 512386, 512450, 512514,
+    512580, 512710, 512900, 513026, 513090, 513154, 74370, 513218,
+    513090, 513282, 3138, 9540, 513346, 510594, 513410, 513474,
+    513538, 513602, 513666, 513730, 513794, 513858, 513922, 513986,
+    514050, 514114, 514178, 514246, 514434, 514498, 514562, 514626,
+    514690, 514754, 514818, 514882, 514946, 515010, 515074, 513474,
+    514114, 515138, 515202, 515266, 515330, 515398, 515586, 515650,
+    515718, 515910, 516104, 516358, 516550, 516742, 516934, 517126,
+    517318, 517510, 517702, 517894, 518086, 518278, 518470, 518660,
+    518786, 518852, 518982, 519172, 519298, 519364, 519494, 519688,
+    519940, 520066, 520132, 520262, 520450, 520514, 520578, 520642,
+    70210, 520708, 520838, 521028, 70786, 521156, 521286, 521480,
+    521732, 70850, 521860, 521990, 420930, 70402, 70466, 70594,
+    522178, 522242, 522306, 522370, 522434, 1794, 522498, 522562,
+    522626, 522694, 522882, 522946, 0, 0, 0, 0,
+    523010, 523074, 523138, 523202, 523266, 523330, 523394, 523458,
+    523522, 523586, 523652, 523780, 523906, 523970, 524034, 524098,
+    524162, 524226, 524290, 524354, 524418, 524482, 524546, 524610,
+    524674, 524738, 524802, 524866, 524930, 524994, 525060, 525186,
+    525250, 525314, 525378, 525442, 525506, 525570, 525634, 525698,
+    525762, 525826, 525890, 525954, 526018, 526082, 526146, 526210,
+    526274, 526338, 526402, 526466, 526530, 526594, 526658, 526722,
+    526786, 526850, 526914, 526978, 527042, 527108, 527236, 527364,
+    527490, 527554, 527618, 527682, 527746, 527810, 527874, 527938,
+    528002, 528066, 528130, 528194, 528258, 528322, 528386, 528450,
+    528514, 528578, 528642, 528706, 528770, 528834, 528898, 528962,
+    529026, 529090, 529154, 529218, 529282, 529346, 529410, 529474,
+    529538, 529602, 529666, 529730, 529794, 529858, 529922, 529986,
+    530050, 530114, 530178, 530242, 530306, 530370, 530434, 530498,
+    530562, 530626, 530690, 530754, 530820, 530946, 531010, 531074,
+    531138, 531204, 531330, 531394, 531460, 531586, 531650, 531714,
+    531778, 531842, 531906, 531970, 532034, 532098, 532162, 532226,
+    532290, 532354, 532418, 532482, 532546, 532610, 532674, 532738,
+    532802, 532866, 532930, 532994, 533060, 533186, 533252, 533378,
+    533442, 533506, 533570, 533634, 533700, 533830, 534018, 534084,
+    534214, 534402, 534466, 534530, 534594, 534658, 534722, 534786,
+    534850, 534914, 534978, 535042, 535106, 535170, 535234, 535298,
+    535362, 535428, 535554, 535618, 535684, 535810, 535874, 535940,
+    536066, 536132, 536258, 536322, 536386, 536450, 536514, 536578,
+    536642, 536706, 536770, 536834, 536898, 536962, 537026, 537090,
+    537154, 537218, 537282, 537346, 537410, 537474, 537538, 537602,
+    537668, 537794, 537860, 537986, 538050, 538114, 538178, 538242,
+    538306, 538370, 538434, 538498, 538562, 538628, 538756, 538884,
+    539012, 539140, 539266, 539330, 539396, 539524, 539650, 539714,
+    539780, 539908, 540034, 540098, 540162, 540226, 540290, 540354,
+    540420, 540548, 540674, 540738, 540804, 540932, 541058, 541122,
+    541188, 541316, 541442, 541506, 541570, 541634, 541698, 541762,
+    541826, 541890, 541954, 542018, 542082, 542146, 542210, 542274,
+    542338, 542402, 542466, 542530, 542594, 542658, 542722, 542786,
+    542850, 542914, 542978, 543042, 543106, 543170, 543234, 543298,
+    543362, 543426, 543490, 543554, 543620, 543748, 543876, 544004,
+    544130, 544194, 544258, 544322, 544386, 544450, 544514, 544578,
+    544642, 544706, 544770, 544834, 544898, 544962, 545026, 545090,
+    545154, 545218, 545282, 545346, 545410, 545474, 545538, 545602,
+    545666, 545730, 545794, 545858, 545922, 545986, 546050, 546114,
+    546178, 546242, 546306, 546370, 546434, 546498, 546562, 546626,
+    546690, 546754, 546818, 546882, 546946, 547010, 547074, 547138,
+    547204, 547332, 547460, 547588, 547714, 547778, 547842, 547906,
+    547970, 548034, 548100, 548228, 548356, 548484, 548610, 548674,
+    548738, 548802, 548866, 548930, 548994, 549058, 549122, 549186,
+    549250, 549314, 549378, 549442, 549506, 549570, 549634, 549698,
+    549762, 549826, 549890, 549954, 550018, 550082, 550146, 550210,
+    550274, 550338, 550402, 550466, 550530, 550594, 550658, 550722,
+    550786, 550850, 550914, 550978, 551042, 551106, 551170, 551234,
+    551298, 551362, 551426, 551490, 551554, 551618, 551682, 551746,
+    551810, 551874, 551938, 552002, 552066, 552130, 552194, 552258,
+    552322, 552386, 552450, 552514, 552578, 552642, 552706, 552770,
+    552834, 552898, 552962, 553026, 553090, 553154, 553218, 553282,
+    553346, 553410, 553474, 553538, 553602, 553666, 553730, 553794,
+    553858, 553922, 553986, 554050, 554114, 554178, 554242, 554306,
+    554370, 554434, 554498, 554562, 554626, 554690, 554754, 554818,
+    554882, 554946, 555010, 555074, 555138, 555202, 555266, 555330,
+    555394, 555458, 555522, 555586, 555650, 555714, 555778, 555842,
+    555906, 555970, 556034, 556098, 556162, 556226, 556290, 556354,
+    556418, 556482, 556546, 556610, 556674, 556738, 556802, 556866,
+    556930, 556994, 557058, 557122, 557186, 557250, 557314, 557378,
+    557442, 557506, 557570, 557634, 557698, 557762, 557826, 557890,
+    557954, 558018, 558082, 558146, 558210, 558274, 558338, 558402,
+    558466, 558530, 558594, 558658, 558722, 558786, 558850, 558914,
+    558978, 559042, 559106, 559170, 559234, 559298, 559362, 559426,
+    559490, 559554, 559618, 559682, 559746, 559810, 559874, 559938,
+    560002, 560066, 560130, 560194, 560258, 560322, 560386, 560450,
+    560514, 560578, 560642, 560706, 560770, 560834, 560898, 560962,
+    561026, 561090, 561154, 561218, 561282, 561346, 561410, 561474,
+    561538, 561602, 561666, 561730, 561794, 561858, 561922, 561986,
+    562050, 562114, 562178, 562242, 562306, 562370, 562434, 562498,
+    562562, 562626, 562690, 562754, 562818, 562882, 562946, 563010,
+    563074, 563138, 563202, 563266, 563330, 563394, 563458, 563522,
+    563586, 563650, 563714, 563778, 563842, 563906, 563970, 564034,
+    564098, 564162, 564226, 564290, 564354, 564418, 564482, 564546,
+    564610, 564674, 564738, 564802, 564866, 564930, 564994, 565058,
+    565122, 565186, 565250, 565314, 565378, 565442, 565506, 565570,
+    565634, 565698, 565762, 565826, 565890, 565954, 566018, 566082,
+    566146, 566210, 566274, 566338, 566402, 566466, 566530, 566594,
+    566658, 566722, 566786, 566850, 566914, 566978, 567042, 567106,
+    567170, 567234, 567298, 567362, 567426, 567490, 567554, 567618,
+    567682, 567746, 567810, 567874, 567938, 568002, 568066, 568130,
+    568194, 568258, 568322, 568386, 568450, 568514, 568578, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    568642, 568706, 568770, 568834, 568898, 568962, 569026, 569090,
+    569154, 569218, 569282, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    569346, 569410, 569474, 569538, 569602, 569666, 569730, 569794,
+    569858, 569924, 570052, 570180, 570308, 570436, 570564, 570692,
+    570820, 570948, 571076, 571204, 571334, 571526, 571718, 571910,
+    572102, 572294, 572486, 572678, 572870, 573064, 573320, 573576,
+    573832, 574088, 574344, 574600, 574856, 575112, 575368, 575624,
+    575876, 576004, 576132, 576260, 576388, 576516, 576644, 576772,
+    576900, 577030, 577222, 577414, 577606, 577798, 577990, 578182,
+    578374, 578566, 578758, 578950, 579142, 579334, 579526, 579718,
+    579910, 580102, 580294, 580486, 580678, 580870, 581062, 581254,
+    581446, 581638, 581830, 582022, 582214, 582406, 582598, 582790,
+    582982, 583174, 583366, 583558, 583750, 583942, 584130, 584194,
+    584258, 584322, 584386, 584450, 584514, 584578, 584642, 584706,
+    584770, 584834, 584898, 584962, 585026, 585090, 585154, 585218,
+    585282, 585346, 585410, 585474, 585538, 585602, 585666, 585730,
+    585794, 585858, 585922, 585986, 586050, 586114, 586178, 586242,
+    586306, 586370, 586434, 586498, 586562, 586626, 586690, 586754,
+    586818, 586882, 586946, 587010, 587074, 587138, 587202, 587266,
+    587330, 587394, 587458, 570052, 570180, 570308, 570436, 570564,
+    570692, 570820, 570948, 571076, 571204, 569346, 569410, 569474,
+    569538, 569602, 569666, 569730, 569794, 569858, 569924, 587458,
+    587522, 587586, 587650, 587714, 587778, 587842, 587906, 587970,
+    588034, 588098, 588162, 588226, 588290, 588354, 588418, 588482,
+    588546, 588610, 588674, 588738, 588802, 588866, 588930, 588994,
+    589058, 589122, 589186, 589250, 589314, 589378, 589442, 589506,
+    589570, 589634, 589698, 589762, 589826, 589890, 589954, 590018,
+    590082, 590146, 590210, 590274, 590338, 590402, 590466, 590530,
+    590594, 590658, 590722, 590786, 590850, 590914, 590978, 591042,
+    591106, 591170, 591234, 591298, 591362, 591426, 591490, 591554,
+    591618, 591682, 591746, 591810, 591874, 591938, 592002, 592066,
+    592130, 592194, 592258, 592322, 592386, 592450, 592514, 592578,
+    592642, 592706, 592770, 592834, 592898, 592962, 593026, 593090,
+    593154, 593218, 593282, 593346, 593410, 593474, 593538, 593602,
+    593666, 593730, 593794, 593858, 593922, 593986, 594050, 594114,
+    594178, 594242, 594306, 594370, 594434, 594498, 594562, 594626,
+    594690, 594754, 594818, 594882, 594946, 595010, 595074, 595138,
+    595202, 595266, 595330, 595394, 595458, 595522, 595586, 595650,
+    595714, 595778, 595842, 595906, 595970, 596034, 596098, 596162,
+    596226, 596290, 596354, 596418, 596482, 596546, 596610, 596674,
+    596738, 596802, 596866, 596930, 596994, 597058, 597122, 597186,
+    597250, 597314, 597378, 597442, 597506, 597570, 597634, 597698,
+    597762, 597826, 597890, 597954, 598018, 598082, 598146, 598210,
+    598274, 598338, 598402, 598466, 598530, 598594, 598658, 598722,
+    598786, 598850, 598914, 598978, 599042, 599106, 599170, 599234,
+    599298, 599362, 599426, 599490, 599554, 599618, 599682, 599746,
+    599810, 599874, 599938, 600002, 600066, 600130, 600194, 600258,
+    600322, 600386, 600450, 600514, 600578, 600642, 600706, 600770,
+    600834, 600898, 600962, 601026, 601090, 601154, 601218, 601282,
+    601346, 601410, 601474, 601538, 601602, 601666, 601730, 601794,
+    601858, 601922, 601986, 602050, 602114, 602178, 602242, 602306,
+    602370, 602434, 602498, 602562, 602626, 602690, 602754, 602818,
+    602882, 602946, 603010, 603074, 603138, 603202, 603266, 603330,
+    603394, 603458, 603522, 603586, 603650, 603714, 603778, 603842,
+    603906, 603970, 604034, 604098, 604162, 604226, 604290, 604354,
+    604418, 604482, 604546, 604610, 604674, 604738, 604802, 604866,
+    604930, 604994, 605058, 605122, 605186, 605250, 605314, 605378,
+    605442, 605506, 605570, 605634, 605698, 605762, 605826, 605890,
+    605954, 606018, 606082, 606146, 606210, 606274, 606338, 606402,
+    606466, 606530, 606594, 606658, 606722, 606786, 606850, 606914,
+    606978, 607042, 607106, 607170, 607234, 607298, 607362, 607426,
+    607490, 607554, 607618, 607682, 607746, 607810, 607874, 607938,
+    608002, 608066, 608130, 608194, 608258, 608322, 608386, 608450,
+    608514, 608578, 608642, 608706, 608770, 608834, 608898, 608962,
+    609026, 609090, 609154, 609218, 609282, 609346, 609410, 609474,
+    609538, 609602, 609666, 609730, 609794, 609858, 609922, 609986,
+    610050, 610114, 610178, 610242, 610306, 610370, 610434, 610498,
+    610562, 610626, 610690, 610754, 610818, 610882, 610946, 611010,
+    611074, 611138, 611202, 611266, 611330, 611394, 611458, 611522,
+    611586, 611650, 611714, 611778, 611842, 611906, 611970, 612034,
+    612098, 612162, 612226, 612290, 612354, 612418, 612482, 612546,
+    612610, 612674, 612738, 612802, 612866, 612930, 612994, 613058,
+    613122, 613186, 613250, 613314, 613378, 613442, 613506, 613570,
+    613634, 613698, 613762, 613826, 613890, 613954, 614018, 614082,
+    614146, 614210, 614274, 614338, 614402, 614466, 614530, 614594,
+    614658, 614722, 614786, 614850, 614914, 614978, 615042, 615106,
+    615170, 615234, 615298, 615362, 615426, 615490, 615554, 615618,
+    615682, 615746, 615810, 615874, 615938, 616002, 616066, 616130,
+    616194, 616258, 616322, 616386, 616450, 616514, 616578, 616642,
+    616706, 616770, 616834, 616898, 616962, 617026, 617090, 617154,
+    617218, 617282, 617346, 617410, 617474, 617538, 617602, 617666,
+    617730, 617794, 617858, 617922, 617986, 618050, 618114, 618178,
+    618242, 618306, 618370, 618434, 618498, 618562, 618626, 618690,
+    618754, 618818, 618882, 618946, 619010, 619074, 619138, 619202,
+    619266, 619330, 619394, 619458, 619522, 619586, 619650, 619714,
+    619778, 619842, 619906, 619970, 620034, 620098, 620162, 620226,
+    620290, 620354, 620418, 620482, 620546, 620610, 620674, 620738,
+    620802, 620866, 620930, 620994, 621058, 621122, 621186, 621250,
+    621314, 621378, 621442, 621506, 621570, 621634, 621698, 621762,
+    621826, 621890, 621954, 622018, 622082, 622146, 622210, 622274,
+    622338, 622402, 622466, 622530, 622594, 622658, 622722, 622786,
+    622850, 622914, 622978, 623042, 623106, 623170, 623234, 623298,
+    623362, 623426, 623490, 623554, 623618, 623682, 623746, 623810,
+    623874, 623938, 624002, 624066, 624130, 624194, 624258, 624322,
+    624386, 624450, 624514, 624578, 624642, 624706, 624770, 624834,
+    624898, 624962, 625026, 625090, 625154, 625218, 625282, 625346,
+    625410, 625474, 625538, 625602, 625666, 625730, 625794, 625858,
+    625922, 625986, 626050, 626114, 626178, 626242, 626306, 626370,
+    626434, 626498, 626562, 626626, 626690, 626754, 626818, 626882,
+    626946, 627010, 627074, 627138, 627202, 627266, 627330, 627394,
+    627458, 627522, 627586, 627650, 627714, 627778, 569346, 569410,
+    569474, 569538, 569602, 569666, 569730, 569794, 569858, 569924,
+    569346, 569410, 569474, 569538, 569602, 569666, 569730, 569794,
+    569858, 569924, 569346, 569410, 569474, 569538, 569602, 569666,
+    569730, 569794, 569858, 569924, 627842, 627906, 627970, 628034,
+    628098, 628162, 628226, 628290, 628354, 628418, 628482, 628546,
+    628610, 628674, 628738, 628802, 628866, 628930, 628994, 629058,
+    629122, 629186, 629250, 629314, 629378, 629442, 629506, 629570,
+    629634, 629698, 629762, 629826, 629890, 629954, 630018, 630082,
+    630146, 630210, 630274, 630338, 630402, 630466, 630530, 630594,
+    630658, 630722, 630786, 630850, 630914, 630978, 631042, 631106,
+    631170, 631234, 631298, 631362, 631426, 631490, 631554, 631618,
+    631682, 631746, 631810, 631874, 631938, 632002, 632066, 632130,
+    632194, 632258, 632322, 632386, 632450, 632514, 632578, 632642,
+    632706, 632770, 632834, 632898, 632962, 633026, 633090, 633154,
+    633218, 633282, 633346, 633410, 633474, 633538, 633602, 633666,
+    633730, 633794, 633858, 633922, 633986, 634050, 634114, 634178,
+    634242, 634306, 634370, 634434, 634498, 634562, 634626, 634690,
+    634754, 634818, 634882, 634946, 635010, 635074, 635138, 635202,
+    635266, 635330, 635394, 635458, 635522, 635586, 635650, 635714,
+    635778, 635842, 635906, 635970, 636034, 636098, 636162, 636226,
+    636290, 636354, 636418, 636482, 636546, 636610, 636674, 636738,
+    636802, 636866, 636930, 636994, 637058, 637122, 637186, 637250,
+    637314, 637378, 637442, 637506, 637570, 637634, 637698, 637762,
+    637826, 637890, 637954, 638018, 638082, 638146, 638210, 638274,
+    638338, 638402, 638466, 638530, 638594, 638658, 638722, 638786,
+    638850, 638914, 638978, 639042, 639106, 639170, 639234, 639298,
+    639362, 639426, 639490, 639554, 639618, 639682, 639746, 639810,
+    639874, 639938, 640002, 640066, 640130, 640194, 640258, 640322,
+    640386, 640450, 640514, 640578, 640642, 640706, 640770, 640834,
+    640898, 640962, 641026, 641090, 641154, 641218, 641282, 641346,
+    641410, 641474, 641538, 641602, 641666, 641730, 641794, 641858,
+    641922, 641986, 642050, 642114, 642178, 642242, 642306, 642370,
+    642434, 642498, 642562, 642626, 642690, 642754, 642818, 642882,
+    642946, 643010, 643074, 643138, 643202, 643266, 643330, 643394,
+    643458, 643522, 643586, 643650, 643714, 643778, 643842, 643906,
+    643970, 644034, 644098, 644162, 644226, 644290, 644354, 644418,
+    644482, 644546, 644610, 644674, 644738, 644802, 644866, 644930,
+    644994, 645058, 645122, 645186, 645250, 645314, 645378, 645442,
+    645506, 645570, 645634, 645698, 645762, 645826, 645890, 645954,
+    646018, 646082, 646146, 646210, 646274, 646338, 646402, 646466,
+    646530, 646594, 646658, 646722, 646786, 646850, 646914, 646978,
+    647042, 647106, 647170, 647234, 647298, 647362, 647426, 647490,
+    647554, 647618, 647682, 647746, 647810, 647874, 647938, 648002,
+    648066, 648130, 648194, 648258, 648322, 648386, 648450, 648514,
+    648578, 648642, 648706, 648770, 648834, 648898, 648962, 649026,
+    649090, 649154, 649218, 649282, 649346, 649410, 649474, 649538,
+    649602, 649666, 649730, 649794, 649858, 649922, 649986, 650050,
+    650114, 650178, 650242, 650306, 650370, 650434, 650498, 650562,
+    650626, 650690, 650754, 650818, 650882, 650946, 651010, 651074,
+    651138, 651202, 651266, 651330, 651394, 651458, 651522, 651586,
+    651650, 651714, 651778, 651842, 651906, 651970, 652034, 652098,
+    652162, 652226, 652290, 652354, 652418, 652482, 652546, 652610,
+    652674, 652738, 652802, 652866, 652930, 652994, 653058, 653122,
+    653186, 653250, 653314, 653378, 653442, 653506, 653570, 653634,
+    653698, 653762, 653826, 653890, 653954, 654018, 654082, 654146,
+    654210, 654274, 654338, 654402, 654466, 654530, 654594, 654658,
+    654722, 654786, 654850, 654914, 654978, 655042, 655106, 655170,
+    655234, 655298, 655362, 655426, 655490, 655554, 655618, 655682,
+    655746, 655810, 655874, 655938, 656002, 656066, 656130, 656194,
+    656258, 656322, 656386, 656450, 656514, 656578, 656642, 656706,
+    656770, 656834, 656898, 656962, 657026, 657090, 657154, 657218,
+    657282, 657346, 657410, 657474, 657538, 657602, 657666, 657730,
+    657794, 657858, 657922, 657986, 658050, 658114, 658178, 658242,
+    658306, 658370, 658434, 658498, 658562, 658626, 658690, 658754,
+    658818, 658882, 658946, 659010, 659074, 659138, 659202, 659266,
+    659330, 659394, 659458, 659522, 659586, 659650, 659714, 659778,
+    659842, 659906, 659970, 660034, 660098, 660162, 660226, 660290,
+    660354, 660418, 660482, 660546, 660610, 660674, 660738, 660802,
+    660866, 660930, 660994, 661058, 661122, 661186, 661250, 661314,
+    661378, 661442, 661506, 661570, 661634, 661698, 661762, 661826,
+    661890, 661954, 662018, 662082, 662146, 662210, 662274, 662338,
+    662402, 662466, 662530, 662594, 662658, 662722, 662786, 662850,
+    662914, 662978, 663042, 663106, 663170, 663234, 663298, 663362,
+    663426, 663490, 663554, 663618, 663682, 663746, 663810, 663874,
+    663938, 664002, 664066, 664130, 664194, 664258, 664322, 664386,
+    664450, 664514, 664578, 664642, 664706, 664770, 664834, 664898,
+    664962, 665026, 665090, 665154, 665218, 665282, 665346, 665410,
+    665474, 665538, 665602, 665666, 665730, 665794, 665858, 665922,
+    665986, 666050, 666114, 666178, 666242, 666306, 666370, 666434,
+    666498, 666562, 666626, 666690, 666754, 666818, 666882, 666946,
+    667010, 667074, 667138, 667202, 667266, 667330, 667394, 667458,
+    667522, 667586, 667650, 667714, 667778, 667842, 667906, 667970,
+    668034, 668098, 668162, 668226, 668296, 668546, 668610, 668674,
+    668738, 668802, 668866, 668930, 668994, 669058, 669122, 669186,
+    669250, 669314, 669378, 669442, 669506, 669570, 669634, 669698,
+    669762, 669826, 669890, 669954, 670018, 670082, 670146, 670210,
+    670274, 670338, 670402, 670466, 670530, 670594, 670658, 670722,
+    670786, 670850, 670914, 670978, 671042, 671106, 671170, 671234,
+    671298, 671362, 671426, 671490, 671554, 671618, 671682, 671746,
+    671810, 671874, 671938, 672002, 672066, 672130, 672194, 672258,
+    672322, 672386, 672450, 672514, 672578, 672642, 672706, 672770,
+    672834, 672898, 672962, 673026, 673090, 673154, 673218, 673282,
+    673346, 673410, 673474, 673538, 673602, 673666, 673730, 673794,
+    673858, 673922, 673986, 674050, 674114, 674178, 674242, 674306,
+    674370, 674434, 674498, 674562, 674626, 674690, 674754, 674818,
+    674882, 674946, 675010, 675074, 675142, 675332, 675462, 675650,
+    675714, 675778, 675842, 675906, 675970, 676034, 676098, 676162,
+    676226, 676290, 676354, 676418, 676482, 676546, 676610, 676674,
+    676738, 676802, 676866, 676930, 676994, 677058, 677122, 677186,
+    677250, 677314, 677378, 677442, 677506, 677570, 677634, 677698,
+    677762, 677826, 677890, 677954, 678018, 678082, 678146, 678210,
+    678274, 678338, 678402, 678466, 678530, 678594, 678658, 678722,
+    678786, 678850, 678914, 678978, 679042, 679106, 679170, 679234,
+    679298, 679362, 679426, 679490, 679554, 679618, 679682, 679746,
+    679810, 679874, 679938, 680002, 680066, 680130, 680194, 680258,
+    680322, 680386, 680450, 680514, 680578, 680642, 680706, 680770,
+    680834, 680898, 680962, 681026, 681090, 681154, 681218, 681282,
+    681346, 681410, 681474, 681538, 681602, 681666, 681730, 681794,
+    681858, 681922, 681986, 682050, 682116, 682242, 682306, 682370,
+    682434, 682498, 682562, 682626, 682690, 682754, 682818, 682882,
+    682946, 683010, 683074, 683138, 683202, 683266, 683330, 683394,
+    683458, 683522, 683586, 683650, 683714, 683778, 683842, 683906,
+    683970, 684034, 684098, 684162, 684226, 684290, 684354, 684418,
+    684482, 684546, 684610, 684674, 684738, 684802, 684866, 684930,
+    684994, 685058, 685122, 685186, 685250, 685314, 685378, 685442,
+    685506, 685570, 685634, 685698, 685762, 685826, 685890, 685954,
+    686018, 686082, 686146, 686210, 686274, 686338, 686402, 686466,
+    686530, 686594, 686658, 686722, 686786, 686850, 686914, 686978,
+    687042, 687106, 687170, 687234, 687298, 687362, 687426, 687490,
+    687554, 687618, 687682, 687746, 687810, 687874, 687938, 688002,
+    688066, 688130, 688194, 688258, 688322, 688386, 688450, 688514,
+    688578, 688642, 688706, 688770, 688834, 688898, 688962, 689026,
+    689090, 689154, 689218, 689282, 689346, 689410, 689474, 689538,
+    689602, 689666, 689730, 689794, 689858, 689922, 689986, 690050,
+    690114, 690178, 690242, 690306, 690370, 690434, 690498, 690562,
+    690626, 690690, 690754, 690818, 690882, 690946, 691010, 691074,
+    691138, 691202, 691266, 691330, 691394, 691458, 691522, 691586,
+    691650, 691714, 691778, 691842, 0, 0, 691906, 691970,
+    692034, 692098, 692162, 692226, 692290, 692354, 692418, 692482,
+    692546, 692610, 692674, 692738, 692802, 692866, 692930, 692994,
+    693058, 693122, 693186, 693250, 693314, 693378, 693442, 693506,
+    693570, 693634, 693698, 693762, 693826, 693890, 0, 693954,
+    694018, 694082, 694146, 694210, 694274, 694338, 694402, 694466,
+    694530, 694594, 694658, 694722, 694786, 694850, 694914, 694978,
+    695042, 695106, 695170, 695234, 695298, 695362, 695426, 695490,
+    695554, 695618, 695682, 695746, 695810, 695874, 695938, 696002,
+    696066, 696130, 696194, 696258, 696322, 696386, 696450, 696514,
+    696578, 696642, 696706, 696770, 696834, 696898, 696962, 697026,
+    697090, 697154, 697218, 697282, 697346, 697410, 697474, 697538,
+    697602, 697666, 697730, 697794, 697858, 697922, 697986, 698050,
+    698114, 698178, 698242, 698306, 698370, 698434, 698498, 698562,
+    698626, 698690, 698754, 698818, 698882, 698946, 699010, 699074,
+    699138, 699202, 699266, 699330, 699394, 699458, 699522, 699586,
+    699650, 699714, 699778, 699842, 699906, 699970, 700034, 700098,
+    700162, 700226, 700290, 700354, 700418, 700482, 700546, 700610,
+    700674, 700738, 700802, 700866, 700930, 700994, 701058, 701122,
+    701186, 701250, 701314, 701378, 701442, 701506, 701570, 701634,
+    701698, 701762, 701826, 701890, 701954, 702018, 702082, 702146,
+    702210, 702274, 702338, 702402, 702466, 702530, 702594, 702658,
+    702722, 702786, 702850, 702914, 702978, 703042, 703106, 703170,
+    703234, 703298, 703362, 703426, 703490, 703554, 703618, 0,
+    703682, 703746, 703810, 703874, 703938, 704002, 704066, 704130,
+    704194, 704258, 704322, 704386, 704450, 704514, 704578, 704642,
+    704706, 704770, 704834, 704898, 704962, 705026, 705090, 705154,
+    705218, 705282, 705346, 705410, 705474, 705538, 705602, 705666,
+    705730, 705794, 705858, 705922, 705986, 706050, 706114, 706178,
+    706242, 706306, 706370, 706434, 706498, 706562, 706626, 0,
+    706690, 706754, 706818, 706882, 706946, 707010, 707074, 707138,
+    707202, 707266, 707330, 707394, 707458, 707522, 707586, 707650,
+    707714, 707778, 707842, 707906, 707970, 708034, 708098, 708162,
+    708226, 708290, 708354, 708418, 708482, 708546, 708610, 708674,
+    708738, 708802, 708866, 708930, 708994, 709058, 709122, 709186,
+    709250, 709314, 709378, 709442, 709506, 709570, 709634, 709698,
+    709762, 709826, 709890, 709954, 710018, 710082, 710146, 710210,
+    710274, 710338, 710402, 710466, 710530, 710594, 710658, 710722,
+    710786, 710850, 710914, 710978, 711042, 711106, 711170, 711234,
+    711298, 711362, 711426, 711490, 711554, 711618, 711682, 711746,
+    711810, 711874, 711938, 712002, 712066, 712130, 712194, 712258,
+    712322, 712386, 712450, 712514, 712578, 712642, 712706, 712770,
+    712834, 712898, 712962, 713026, 713090, 713154, 713218, 713282,
+    713346, 713410, 713474, 713538, 713602, 713666, 713730, 713794,
+    713858, 713922, 713986, 714050, 714114, 714178, 714242, 714306,
+    714370, 714434, 714498, 714562, 714626, 714690, 714754, 714818,
+    714882, 714946, 715010, 715074, 715142, 715330, 715394, 715458,
+    715522, 715586, 715650, 715714, 715778, 715842, 715906, 67970,
+    68290, 68226, 715970, 716034, 0, 0, 0, 0,
+    0, 716098, 716162, 716226, 716290, 716354, 716418, 716482,
+    716546, 716610, 716674, 716738, 716802, 716866, 716930, 716994,
+    717058, 717122, 717186, 717250, 717314, 717378, 717442, 717506,
+    717570, 717634, 717698, 717762, 717826, 717890, 717954, 718018,
+    718082, 718146, 718210, 718274, 718338, 718402, 718466, 718530,
+    718594, 718658, 718722, 718786, 718850, 718914, 0, 718978,
+    0, 0, 0, 0, 0, 719042, 0, 0,
+    719106, 719170, 719234, 719298, 719362, 719426, 719490, 719554,
+    719618, 719682, 719746, 719810, 719874, 719938, 720002, 720066,
+    720130, 720194, 720258, 720322, 720386, 720450, 720514, 720578,
+    720642, 720706, 720770, 720834, 720898, 720962, 721026, 721090,
+    721154, 721218, 721282, 721346, 721410, 721474, 721538, 721602,
+    721666, 721730, 721794, 721858, 721922, 721986, 722050, 722114,
+    722178, 722242, 722306, 722370, 722434, 722498, 722562, 722626,
+    0, 0, 0, 0, 0, 0, 0, 722690,
+    722754, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2,
+    722818, 722882, 722946, 723010, 723074, 723138, 723202, 723266,
+    723330, 723394, 723458, 723522, 723586, 723650, 723714, 723778,
+    723842, 723906, 723970, 724034, 724098, 724162, 724226, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    724290, 724354, 724418, 724482, 724546, 724610, 724674, 0,
+    724738, 724802, 724866, 724930, 724994, 725058, 725122, 0,
+    725186, 725250, 725314, 725378, 725442, 725506, 725570, 0,
+    725634, 725698, 725762, 725826, 725890, 725954, 726018, 0,
+    726082, 726146, 726210, 726274, 726338, 726402, 726466, 0,
+    726530, 726594, 726658, 726722, 726786, 726850, 726914, 0,
+    726978, 727042, 727106, 727170, 727234, 727298, 727362, 0,
+    727426, 727490, 727554, 727618, 727682, 727746, 727810, 0,
+    727874, 403266, 727938, 403330, 728002, 728066, 728130, 728194,
+    728258, 728322, 403394, 728386, 728450, 403458, 403522, 728514,
+    728578, 728642, 728706, 728770, 728834, 728900, 729026, 729090,
+    729154, 403714, 403650, 729218, 729282, 729346, 729410, 729474,
+    729538, 729602, 729666, 729730, 729794, 729858, 729922, 729986,
+    730050, 730114, 730178, 730242, 730306, 730370, 730434, 730498,
+    730562, 730626, 730690, 730754, 730818, 730882, 730946, 731010,
+    731074, 731138, 731202, 731266, 731330, 731394, 731458, 731522,
+    731586, 731650, 731714, 731778, 731842, 731906, 731970, 732034,
+    732098, 732162, 732226, 732290, 732354, 732418, 732482, 732546,
+    732610, 732674, 732738, 732802, 732866, 732930, 732994, 733058,
+    733122, 733186, 733250, 733314, 733378, 733442, 733506, 733570,
+    733634, 733698, 733762, 733826, 733890, 733954, 734018, 734082,
+    734146, 734210, 734274, 734338, 734402, 734466, 734530, 734594,
+    734658, 734722, 734786, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    734854, 735046, 735236, 735364, 735494, 735684, 735814, 736006,
+    736198, 736388, 736518, 736710, 736902, 737094, 737286, 737476,
+    737604, 737734, 737924, 738052, 738180, 738310, 738500, 738630,
+    738820, 738948, 0, 739076, 739206, 739398, 739590, 739780,
+    739908, 740036, 740164, 740292, 740420, 740550, 740740, 740870,
+    741060, 741190, 741382, 741574, 741766, 741956, 742086, 742276,
+    742404, 742532, 742660, 742790, 742982, 743174, 743366, 743558,
+    743748, 743876, 744004, 744134, 744326, 744518, 744708, 744838,
+    745030, 745220, 745348, 745476, 745604, 745732, 745860, 745990,
+    746180, 746308, 746438, 746628, 746756, 746886, 747078, 747270,
+    747460, 747588, 747716, 747844, 747972, 748102, 748292, 748422,
+    748612, 748740, 748868, 748996, 749124, 749252, 749382, 749572,
+    749700, 749830, 750020, 750150, 750342, 750532, 750660, 750790,
+    750980, 751108, 751236, 751366, 751556, 751686, 751876, 752006,
+    752196, 752326, 752518, 752708, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    752836, 752964, 753092, 753220, 753348, 753476, 753604, 753732,
+    753860, 753988, 754116, 754244, 754372, 754500, 754628, 754756,
+    754884, 755012, 755140, 755268, 755396, 755524, 755652, 755780,
+    755908, 756036, 756164, 756292, 756420, 756548, 756676, 756804,
+    756932, 757060, 757188, 757316, 757444, 757572, 757700, 757828,
+    757956, 758084, 737604, 758212, 758340, 758468, 758596, 758724,
+    758852, 758980, 759108, 738052, 759236, 759364, 759492, 759620,
+    759748, 759876, 760004, 760132, 760260, 760388, 760516, 760644,
+    760772, 760900, 761028, 761156, 761284, 761412, 761540, 761668,
+    761796, 761924, 762052, 762180, 762308, 762436, 762564, 762692,
+    762820, 762948, 763076, 763204, 763332, 763460, 763588, 763716,
+    763844, 763972, 764100, 764228, 764356, 764484, 764612, 764740,
+    764868, 764996, 765124, 765252, 765380, 765508, 765636, 765764,
+    765892, 766020, 766148, 766276, 766404, 766532, 766660, 766788,
+    766916, 767044, 767172, 767300, 767428, 767556, 767684, 767812,
+    767940, 768068, 768196, 768324, 768452, 768580, 768708, 768836,
+    768964, 769092, 769220, 769348, 769476, 769604, 769732, 769860,
+    769988, 770116, 770244, 770372, 770500, 770628, 770756, 770884,
+    771012, 771140, 771268, 745860, 771396, 771524, 771652, 771780,
+    771908, 772036, 772164, 772292, 772420, 772548, 772676, 772804,
+    772932, 773060, 773188, 773316, 773444, 773572, 773700, 747588,
+    773828, 773956, 774084, 774212, 774340, 774468, 774596, 774724,
+    774852, 774980, 775108, 775236, 775364, 775492, 775620, 749252,
+    775748, 775876, 776004, 776132, 776260, 776388, 776516, 776644,
+    776772, 776900, 777028, 777156, 777284, 777412, 777540, 777668,
+    777796, 777924, 778052, 778180, 778308, 778436, 778564, 778692,
+    778820, 778948, 779076, 779204, 779332, 779460, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    779586, 779650, 779714, 779778, 779842, 779906, 779970, 780034,
+    780098, 780162, 780226, 780290, 0, 0, 0, 0,
+    780354, 780418, 780482, 780546, 780610, 780674, 780740, 1410,
+    552386, 552450, 780866, 780930, 780994, 781058, 781122, 781186,
+    781250, 781314, 781378, 781442, 781506, 781570, 781634, 781698,
+    781762, 781826, 781890, 781954, 782018, 782082, 782146, 782210,
+    782274, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 782338, 782402, 782466, 782530, 782594, 782658,
+    782722, 782786, 782852, 782978, 783044, 783170, 783234, 783298,
+    755780, 783364, 783492, 783618, 783684, 783810, 783874, 783938,
+    0, 784002, 784066, 784130, 784194, 784258, 784322, 784386,
+    784450, 784514, 784578, 784642, 784708, 784834, 784900, 785026,
+    785092, 785218, 785284, 785410, 785476, 785602, 785668, 785794,
+    785860, 785986, 786052, 786178, 786244, 786370, 786436, 786562,
+    786628, 786754, 786820, 786946, 787010, 787076, 787202, 787268,
+    787394, 787460, 787586, 787650, 787714, 787778, 787842, 787906,
+    787972, 788100, 788226, 788292, 788420, 788546, 788612, 788740,
+    788866, 788932, 789060, 789186, 789252, 789380, 789506, 789570,
+    789634, 789698, 789762, 789826, 789890, 789954, 790018, 790082,
+    790146, 790210, 790274, 790338, 790402, 790466, 790530, 790594,
+    790658, 790722, 790786, 790850, 790916, 791042, 791106, 0,
+    0, 791170, 791234, 791298, 791362, 791426, 791492, 791620,
+    791746, 791810, 791874, 791938, 792002, 792066, 792130, 792194,
+    792258, 792322, 792386, 792450, 792516, 792642, 792708, 792834,
+    792900, 793026, 793092, 793218, 793284, 793410, 793476, 793602,
+    793668, 793794, 793860, 793986, 794052, 794178, 794244, 794370,
+    794436, 794562, 794628, 794754, 794818, 794884, 795010, 795076,
+    795202, 795268, 795394, 795458, 795522, 795586, 795650, 795714,
+    795780, 795908, 796034, 796100, 796228, 796354, 796420, 796548,
+    796674, 796740, 796868, 796994, 797060, 797188, 797314, 797378,
+    797442, 797506, 797570, 797634, 797698, 797762, 797826, 797890,
+    797954, 798018, 798082, 798146, 798210, 798274, 798338, 798402,
+    798466, 798530, 798594, 798658, 798724, 798850, 798914, 798980,
+    799108, 799236, 799364, 799490, 799554, 799618, 799684, 799812,
+    0, 0, 0, 0, 0, 799938, 800002, 800066,
+    800130, 800194, 800258, 800322, 800386, 800450, 800514, 800578,
+    800642, 800706, 800770, 800834, 800898, 800962, 801026, 801090,
+    801154, 801218, 801282, 801346, 801410, 801474, 801538, 801602,
+    801666, 801730, 801794, 801858, 801922, 801986, 802050, 802114,
+    802178, 802242, 802306, 802370, 802434, 802498, 802562, 802626,
+    0, 802690, 802754, 802818, 802882, 802946, 803010, 803074,
+    803138, 803202, 803266, 803330, 803394, 803458, 803522, 803586,
+    803650, 803714, 803778, 803842, 803906, 803970, 804034, 804098,
+    804162, 804226, 804290, 804354, 804418, 804482, 804546, 804610,
+    804674, 804738, 804802, 804866, 804930, 804994, 805058, 805122,
+    805186, 805250, 805314, 805378, 805442, 805506, 805570, 805634,
+    805698, 805762, 805826, 805890, 805954, 806018, 806082, 806146,
+    806210, 806274, 806338, 806402, 806466, 806530, 806594, 806658,
+    806722, 806786, 806850, 806914, 806978, 807042, 807106, 807170,
+    807234, 807298, 807362, 807426, 807490, 807554, 807618, 807682,
+    807746, 807810, 807874, 807938, 808002, 808066, 808130, 808194,
+    808258, 808322, 808386, 808450, 808514, 808578, 808642, 0,
+    808706, 808770, 808836, 808964, 809092, 809220, 809348, 809476,
+    809604, 809732, 809860, 809988, 810116, 810244, 810372, 810500,
+    810628, 810756, 810884, 811012, 811138, 811204, 811330, 811396,
+    811524, 811652, 811780, 811908, 812034, 812098, 812164, 812292,
+    812418, 812482, 812546, 812612, 812738, 812802, 812866, 812930,
+    812994, 813058, 813122, 813186, 813250, 813314, 813378, 813442,
+    813506, 813570, 813634, 813698, 813762, 813826, 813890, 813954,
+    814018, 814082, 814146, 814210, 814274, 814338, 814402, 814466,
+    814530, 814594, 814658, 814722, 814786, 814850, 814914, 814978,
+    815042, 815106, 815170, 815234, 815298, 815362, 815426, 815490,
+    815554, 815618, 815682, 815746, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    815810, 815874, 815938, 816002, 816066, 816130, 816194, 816258,
+    816322, 816386, 816450, 816514, 816578, 816642, 816706, 816770,
+    816838, 817030, 817222, 817414, 817606, 817798, 817990, 818182,
+    818374, 818566, 818758, 818950, 819142, 819334, 819528, 819784,
+    820040, 820296, 820552, 820808, 821064, 821320, 821576, 821832,
+    822088, 822344, 822600, 822856, 823112, 823374, 823820, 0,
+    824200, 824456, 824712, 824968, 825224, 825480, 825736, 825992,
+    826248, 826504, 826760, 827016, 827272, 827528, 827784, 828040,
+    828296, 828552, 828808, 829064, 829320, 829576, 829832, 830088,
+    830344, 830600, 830856, 831112, 831368, 831624, 831880, 832136,
+    832392, 832648, 832904, 833160, 833412, 833540, 833668, 833796,
+    569924, 571204, 833924, 834052, 834180, 834308, 834436, 834564,
+    834694, 834884, 835012, 835140, 835268, 835396, 835524, 835652,
+    835780, 835908, 833924, 836036, 836164, 836292, 836420, 836548,
+    836674, 836738, 836802, 836866, 836930, 836994, 837058, 837122,
+    837186, 837250, 837314, 837378, 837442, 837506, 837572, 837700,
+    837828, 837956, 838084, 838212, 838340, 838468, 838596, 838724,
+    838852, 838980, 839108, 839236, 839370, 839688, 839940, 840066,
+    840132, 840260, 840388, 840516, 840644, 840772, 840900, 841028,
+    841156, 841284, 841412, 841540, 841668, 841796, 841924, 842052,
+    842180, 842308, 842436, 842564, 842692, 842820, 842948, 843076,
+    843204, 843332, 843460, 843588, 843716, 843844, 843972, 844100,
+    844228, 844356, 844484, 844612, 844740, 844868, 844996, 845124,
+    845252, 845380, 845508, 845636, 845764, 845892, 846020, 846148,
+    846276, 846404, 846532, 846660, 846788, 834052, 846916, 847044,
+    847172, 847300, 847428, 847556, 847684, 847812, 847940, 834180,
+    848070, 848262, 848454, 848646, 848838, 849030, 849222, 849414,
+    849606, 849800, 850056, 850312, 850564, 850694, 850884, 851014,
+    851202, 851266, 851330, 851394, 851458, 851522, 851586, 851650,
+    851714, 851778, 851842, 851906, 851970, 852034, 852098, 852162,
+    852226, 852290, 852354, 852418, 852482, 852546, 852610, 852674,
+    852738, 852802, 852866, 852930, 852994, 853058, 853122, 853186,
+    853250, 853314, 853378, 853442, 853506, 853570, 853634, 853698,
+    853762, 853826, 853890, 853954, 854018, 854082, 854146, 854216,
+    854474, 854792, 855050, 855366, 855562, 855878, 856070, 856268,
+    856648, 856902, 857094, 857286, 857480, 857736, 857992, 858248,
+    858504, 858760, 859016, 859276, 859652, 859788, 860172, 860554,
+    860872, 861132, 861516, 861896, 862150, 862342, 862536, 862792,
+    863050, 863370, 863686, 863878, 864072, 864326, 864518, 864708,
+    864836, 864966, 865158, 865356, 865736, 865994, 866316, 866696,
+    866950, 867142, 867340, 867720, 867980, 868358, 868554, 868870,
+    869064, 869318, 869512, 869770, 870088, 870346, 870664, 870916,
+    871050, 871366, 871558, 871752, 872006, 872198, 872390, 872586,
+    872904, 873156, 873292, 873670, 873866, 874184, 874440, 874694,
+    874886, 875080, 875332, 875464, 875722, 876036, 876172, 876550,
+    876742, 876934, 877126, 877318, 877510, 877702, 877894, 878086,
+    878278, 878470, 878664, 878920, 879176, 879432, 879688, 879944,
+    880200, 880456, 880712, 880968, 881224, 881480, 881736, 881992,
+    882248, 882502, 882692, 882820, 882950, 883140, 883268, 883396,
+    883526, 883718, 883908, 884040, 884296, 884552, 884808, 885072,
+    885572, 885700, 885828, 885956, 886084, 886212, 886340, 886468,
+    886598, 886792, 887044, 887172, 887300, 887428, 887556, 887684,
+    887812, 887942, 888134, 888326, 888518, 888708, 888836, 888964,
+    889092, 889220, 889348, 889476, 889604, 889732, 889860, 889990,
+    890182, 890372, 890502, 890694, 890886, 891076, 891206, 891398,
+    891592, 891844, 891974, 892166, 892358, 892550, 892746, 893068,
+    893444, 893572, 893700, 893828, 893956, 894084, 894212, 894340,
+    894468, 894596, 894724, 894852, 894980, 895108, 895236, 895364,
+    895492, 895620, 895752, 896004, 896132, 896260, 896392, 896646,
+    896836, 896964, 897092, 897220, 897348, 897476, 897604, 897732,
+    897860, 897988, 898118, 898308, 898436, 898566, 898758, 898948,
+    899080, 899334, 899524, 899652, 899780, 899908, 900038, 900230,
+    900422, 900614, 900806, 900998, 901190, 901382, 901574, 901766,
+    901958, 902152, 902408, 902664, 902920, 903176, 903432, 903688,
+    903944, 904200, 904456, 904712, 904968, 905224, 905480, 905736,
+    905992, 906248, 906504, 906760, 907016, 907272, 907528, 907782,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    907970, 908034, 908098, 908162, 908226, 908290, 908354, 908418,
+    908482, 908546, 908610, 908674, 908738, 908802, 908866, 908930,
+    908994, 909058, 909122, 909186, 909250, 909314, 909378, 909442,
+    909506, 909570, 909634, 909698, 909762, 909826, 909890, 909954,
+    910018, 910082, 910146, 910210, 910274, 910338, 910402, 910466,
+    910530, 910594, 910658, 910722, 910786, 910850, 910914, 910978,
+    911042, 911106, 911170, 911234, 911298, 911362, 911426, 911490,
+    911554, 911618, 911682, 911746, 911810, 911874, 911938, 912002,
+    912066, 912130, 912194, 912258, 912322, 912386, 912450, 912514,
+    912578, 912642, 912706, 912770, 912834, 912898, 912962, 913026,
+    913090, 913154, 913218, 913282, 913346, 913410, 913474, 913538,
+    913602, 913666, 913730, 913794, 913858, 913922, 913986, 914050,
+    914114, 914178, 914242, 914306, 914370, 914434, 914498, 914562,
+    914626, 914690, 914754, 914818, 914882, 914946, 915010, 915074,
+    915138, 915202, 915266, 915330, 915394, 915458, 915522, 915586,
+    915650, 915714, 915778, 915842, 915906, 915970, 916034, 916098,
+    916162, 916226, 916290, 916354, 916418, 916482, 916546, 916610,
+    916674, 916738, 916802, 916866, 916930, 916994, 917058, 917122,
+    917186, 917250, 917314, 917378, 917442, 917506, 917570, 917634,
+    917698, 917762, 917826, 917890, 917954, 918018, 918082, 918146,
+    918210, 918274, 918338, 918402, 918466, 918530, 918594, 918658,
+    918722, 918786, 918850, 918914, 918978, 919042, 919106, 919170,
+    919234, 919298, 919362, 919426, 919490, 919554, 919618, 919682,
+    919746, 919810, 919874, 919938, 920002, 920066, 920130, 920194,
+    920258, 920322, 920386, 920450, 920514, 920578, 920642, 920706,
+    920770, 920834, 920898, 920962, 921026, 921090, 921154, 921218,
+    921282, 921346, 921410, 921474, 921538, 921602, 921666, 921730,
+    921794, 921858, 921922, 921986, 922050, 922114, 922178, 922242,
+    922306, 922370, 922434, 922498, 922562, 922626, 922690, 922754,
+    922818, 922882, 922946, 923010, 923074, 923138, 923202, 923266,
+    923330, 923394, 923458, 923522, 923586, 923650, 923714, 923778,
+    923842, 923906, 923970, 924034, 924098, 924162, 924226, 924290,
+    924354, 924418, 924482, 924546, 924610, 924674, 924738, 924802,
+    924866, 924930, 924994, 925058, 925122, 925186, 925250, 925314,
+    925378, 925442, 925506, 925570, 925634, 925698, 925762, 925826,
+    925890, 925954, 926018, 926082, 926146, 926210, 926274, 926338,
+    926402, 926466, 926530, 926594, 926658, 926722, 926786, 926850,
+    926914, 926978, 927042, 927106, 927170, 927234, 927298, 927362,
+    927426, 927490, 927554, 927618, 927682, 927746, 927810, 927874,
+    927938, 928002, 928066, 928130, 928194, 928258, 928322, 928386,
+    928450, 928514, 928578, 928642, 928706, 928770, 928834, 928898,
+    928962, 929026, 929090, 929154, 929218, 929282, 929346, 929410,
+    929474, 929538, 929602, 929666, 929730, 929794, 929858, 929922,
+    929986, 930050, 930114, 930178, 930242, 930306, 930370, 930434,
+    930498, 930562, 930626, 930690, 930754, 930818, 930882, 930946,
+    931010, 931074, 931138, 931202, 931266, 931330, 931394, 931458,
+    931522, 931586, 931650, 931714, 931778, 931842, 931906, 931970,
+    932034, 932098, 932162, 932226, 932290, 932354, 932418, 932482,
+    932546, 932610, 932674, 932738, 932802, 932866, 932930, 932994,
+    933058, 933122, 933186, 933250, 933314, 933378, 933442, 933506,
+    933570, 933634, 933698, 933762, 933826, 933890, 933954, 934018,
+    934082, 934146, 934210, 934274, 934338, 934402, 934466, 934530,
+    934594, 934658, 934722, 934786, 934850, 934914, 934978, 935042,
+    935106, 935170, 935234, 935298, 935362, 935426, 935490, 935554,
+    935618, 935682, 935746, 935810, 935874, 935938, 936002, 936066,
+    936130, 936194, 936258, 936322, 936386, 936450, 936514, 936578,
+    936642, 936706, 936770, 936834, 936898, 936962, 937026, 937090,
+    937154, 937218, 937282, 937346, 937410, 937474, 937538, 937602,
+    937666, 937730, 937794, 937858, 937922, 937986, 938050, 938114,
+    938178, 938242, 938306, 938370, 938434, 938498, 938562, 938626,
+    938690, 938754, 938818, 938882, 938946, 939010, 939074, 939138,
+    939202, 939266, 939330, 939394, 939458, 939522, 939586, 939650,
+    939714, 939778, 939842, 939906, 939970, 940034, 940098, 940162,
+    940226, 940290, 940354, 940418, 940482, 940546, 940610, 940674,
+    940738, 940802, 940866, 940930, 940994, 941058, 941122, 941186,
+    941250, 941314, 941378, 941442, 941506, 941570, 941634, 941698,
+    941762, 941826, 941890, 941954, 942018, 942082, 942146, 942210,
+    942274, 942338, 942402, 942466, 942530, 942594, 942658, 942722,
+    942786, 942850, 942914, 942978, 943042, 943106, 943170, 943234,
+    943298, 943362, 943426, 943490, 943554, 943618, 943682, 943746,
+    943810, 943874, 943938, 944002, 944066, 944130, 944194, 944258,
+    944322, 944386, 944450, 944514, 944578, 944642, 944706, 944770,
+    944834, 944898, 944962, 945026, 945090, 945154, 945218, 945282,
+    945346, 945410, 945474, 945538, 945602, 945666, 945730, 945794,
+    945858, 945922, 945986, 946050, 946114, 946178, 946242, 946306,
+    946370, 946434, 946498, 946562, 946626, 946690, 946754, 946818,
+    946882, 946946, 947010, 947074, 947138, 947202, 947266, 947330,
+    947394, 947458, 947522, 947586, 947650, 947714, 947778, 947842,
+    947906, 947970, 948034, 948098, 948162, 948226, 948290, 948354,
+    948418, 948482, 948546, 948610, 948674, 948738, 948802, 948866,
+    948930, 948994, 949058, 949122, 949186, 949250, 949314, 949378,
+    949442, 949506, 949570, 949634, 949698, 949762, 949826, 949890,
+    949954, 950018, 950082, 950146, 950210, 950274, 950338, 950402,
+    950466, 950530, 950594, 950658, 950722, 950786, 950850, 950914,
+    950978, 951042, 951106, 951170, 951234, 951298, 951362, 951426,
+    951490, 951554, 951618, 951682, 951746, 951810, 951874, 951938,
+    952002, 952066, 952130, 952194, 952258, 952322, 952386, 952450,
+    952514, 952578, 952642, 952706, 952770, 952834, 952898, 952962,
+    953026, 953090, 953154, 953218, 953282, 953346, 953410, 953474,
+    953538, 953602, 953666, 953730, 953794, 953858, 953922, 953986,
+    954050, 954114, 954178, 954242, 954306, 954370, 954434, 954498,
+    954562, 954626, 954690, 954754, 954818, 954882, 954946, 955010,
+    955074, 955138, 955202, 955266, 955330, 955394, 955458, 955522,
+    955586, 955650, 955714, 955778, 955842, 955906, 955970, 956034,
+    956098, 956162, 956226, 956290, 956354, 956418, 956482, 956546,
+    956610, 956674, 956738, 956802, 956866, 956930, 956994, 957058,
+    957122, 957186, 957250, 957314, 957378, 957442, 957506, 957570,
+    957634, 957698, 957762, 957826, 957890, 957954, 958018, 958082,
+    958146, 958210, 958274, 958338, 958402, 958466, 958530, 958594,
+    958658, 958722, 958786, 958850, 958914, 958978, 959042, 959106,
+    959170, 959234, 959298, 959362, 959426, 959490, 959554, 959618,
+    959682, 959746, 959810, 959874, 959938, 960002, 960066, 960130,
+    960194, 960258, 960322, 960386, 960450, 960514, 960578, 960642,
+    960706, 960770, 960834, 960898, 960962, 961026, 961090, 961154,
+    961218, 961282, 961346, 961410, 961474, 961538, 961602, 961666,
+    961730, 961794, 961858, 961922, 961986, 962050, 962114, 962178,
+    962242, 962306, 962370, 962434, 962498, 962562, 962626, 962690,
+    962754, 962818, 962882, 962946, 963010, 963074, 963138, 963202,
+    963266, 963330, 963394, 963458, 963522, 963586, 963650, 963714,
+    963778, 963842, 963906, 963970, 964034, 964098, 964162, 964226,
+    964290, 964354, 964418, 964482, 964546, 964610, 964674, 964738,
+    964802, 964866, 964930, 964994, 965058, 965122, 965186, 965250,
+    965314, 965378, 965442, 965506, 965570, 965634, 965698, 965762,
+    965826, 965890, 965954, 966018, 966082, 966146, 966210, 966274,
+    966338, 966402, 966466, 966530, 966594, 966658, 966722, 966786,
+    966850, 966914, 966978, 967042, 967106, 967170, 967234, 967298,
+    967362, 967426, 967490, 967554, 967618, 967682, 967746, 967810,
+    967874, 967938, 968002, 968066, 968130, 968194, 968258, 968322,
+    968386, 968450, 968514, 968578, 968642, 968706, 968770, 968834,
+    968898, 968962, 969026, 969090, 969154, 969218, 969282, 969346,
+    969410, 969474, 969538, 969602, 969666, 969730, 969794, 969858,
+    969922, 969986, 970050, 970114, 970178, 970242, 970306, 970370,
+    970434, 970498, 970562, 970626, 970690, 970754, 970818, 970882,
+    970946, 971010, 971074, 971138, 971202, 971266, 971330, 971394,
+    971458, 971522, 971586, 971650, 971714, 971778, 971842, 971906,
+    971970, 972034, 972098, 972162, 972226, 972290, 972354, 972418,
+    972482, 972546, 972610, 972674, 972738, 972802, 972866, 972930,
+    972994, 973058, 973122, 973186, 973250, 973314, 973378, 973442,
+    973506, 973570, 973634, 973698, 973762, 973826, 973890, 973954,
+    974018, 974082, 974146, 974210, 974274, 974338, 974402, 974466,
+    974530, 974594, 974658, 974722, 974786, 974850, 974914, 974978,
+    975042, 975106, 975170, 975234, 975298, 975362, 975426, 975490,
+    975554, 975618, 975682, 975746, 975810, 975874, 975938, 976002,
+    976066, 976130, 976194, 976258, 976322, 976386, 976450, 976514,
+    976578, 976642, 976706, 976770, 976834, 976898, 976962, 977026,
+    977090, 977154, 977218, 977282, 977346, 977410, 977474, 977538,
+    977602, 977666, 977730, 977794, 977858, 977922, 977986, 978050,
+    978114, 978178, 978242, 978306, 978370, 978434, 978498, 978562,
+    978626, 978690, 978754, 978818, 978882, 978946, 979010, 979074,
+    979138, 979202, 979266, 979330, 979394, 979458, 979522, 979586,
+    979650, 979714, 979778, 979842, 979906, 979970, 980034, 980098,
+    980162, 980226, 980290, 980354, 980418, 980482, 980546, 980610,
+    980674, 980738, 980802, 980866, 980930, 980994, 981058, 981122,
+    981186, 981250, 981314, 981378, 981442, 981506, 981570, 981634,
+    981698, 981762, 981826, 981890, 981954, 982018, 982082, 982146,
+    982210, 982274, 982338, 982402, 982466, 982530, 982594, 982658,
+    982722, 982786, 982850, 982914, 982978, 983042, 983106, 983170,
+    983234, 983298, 983362, 983426, 983490, 983554, 983618, 983682,
+    983746, 983810, 983874, 983938, 984002, 984066, 984130, 984194,
+    984258, 984322, 984386, 984450, 984514, 984578, 984642, 984706,
+    984770, 984834, 984898, 984962, 985026, 985090, 985154, 985218,
+    985282, 985346, 985410, 985474, 985538, 985602, 985666, 985730,
+    985794, 985858, 985922, 985986, 986050, 986114, 986178, 986242,
+    986306, 986370, 986434, 986498, 986562, 0, 0, 0,
+    986626, 986690, 986754, 986818, 986882, 986946, 987010, 987074,
+    987138, 987202, 987266, 987330, 987394, 987458, 987522, 987586,
+    987650, 987714, 987778, 987842, 987906, 987970, 988034, 988098,
+    988162, 988226, 988290, 988354, 988418, 988482, 988546, 988610,
+    988674, 988738, 988802, 988866, 988930, 988994, 989058, 989122,
+    989186, 989250, 989314, 989378, 989442, 989506, 989570, 989634,
+    989698, 989762, 989826, 989890, 989954, 990018, 990082, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    990146, 990210, 990274, 990338, 990402, 990466, 990530, 990594,
+    990658, 990722, 990786, 990850, 990914, 990978, 991042, 991106,
+    991170, 991234, 991298, 991362, 991426, 991490, 991554, 991618,
+    991682, 991746, 991810, 991874, 991938, 992002, 992066, 992130,
+    992194, 992258, 992322, 992386, 992450, 992514, 992578, 992642,
+    992706, 992770, 992834, 992898, 992962, 993026, 993090, 993154,
+    993218, 993282, 993346, 993410, 993474, 993538, 993602, 993666,
+    993730, 993794, 993858, 993922, 993986, 994050, 994114, 994178,
+    994242, 994306, 994370, 994434, 994498, 994562, 994626, 994690,
+    994754, 994818, 994882, 994946, 995010, 995074, 995138, 995202,
+    995266, 995330, 995394, 995458, 995522, 995586, 995650, 995714,
+    995778, 995842, 995906, 995970, 996034, 996098, 996162, 996226,
+    996290, 996354, 996418, 996482, 996546, 996610, 996674, 996738,
+    996802, 996866, 996930, 996994, 997058, 997122, 997186, 997250,
+    997314, 997378, 997442, 997506, 997570, 997634, 997698, 997762,
+    997826, 997890, 997954, 998018, 998082, 998146, 998210, 998274,
+    998338, 998402, 998466, 998530, 998594, 998658, 998722, 998786,
+    998850, 998914, 998978, 999042, 999106, 999170, 999234, 999298,
+    999362, 999426, 999490, 999554, 999618, 999682, 999746, 999810,
+    999874, 999938, 1000002, 1000066, 1000130, 1000194, 1000258, 1000322,
+    1000386, 1000450, 1000514, 1000578, 1000642, 1000706, 1000770, 1000834,
+    1000898, 1000962, 1001026, 1001090, 1001154, 1001218, 1001282, 1001346,
+    1001410, 1001474, 1001538, 1001602, 1001666, 1001730, 1001794, 1001858,
+    1001922, 1001986, 1002050, 1002114, 1002178, 1002242, 1002306, 1002370,
+    1002434, 1002498, 1002562, 1002626, 1002690, 1002754, 1002818, 1002882,
+    1002946, 1003010, 1003074, 1003138, 1003202, 1003266, 1003330, 1003394,
+    1003458, 1003522, 1003586, 1003650, 1003714, 1003778, 1003842, 1003906,
+    1003970, 1004034, 1004098, 1004162, 1004226, 1004290, 1004354, 1004418,
+    1004482, 1004546, 1004610, 1004674, 1004738, 1004802, 1004866, 1004930,
+    1004994, 1005058, 1005122, 1005186, 1005250, 1005314, 1005378, 1005442,
+    1005506, 1005570, 1005634, 1005698, 1005762, 1005826, 1005890, 1005954,
+    1006018, 1006082, 1006146, 1006210, 1006274, 1006338, 1006402, 1006466,
+    1006530, 1006594, 1006658, 1006722, 1006786, 1006850, 1006914, 1006978,
+    1007042, 1007106, 1007170, 1007234, 1007298, 1007362, 1007426, 1007490,
+    1007554, 1007618, 1007682, 1007746, 1007810, 1007874, 1007938, 1008002,
+    1008066, 1008130, 1008194, 1008258, 1008322, 1008386, 1008450, 1008514,
+    1008578, 1008642, 1008706, 1008770, 1008834, 1008898, 1008962, 1009026,
+    1009090, 1009154, 1009218, 1009282, 1009346, 1009410, 1009474, 1009538,
+    1009602, 1009666, 1009730, 1009794, 1009858, 1009922, 1009986, 1010050,
+    1010114, 1010178, 1010242, 1010306, 1010370, 1010434, 1010498, 1010562,
+    1010626, 1010690, 1010754, 1010820, 1010948, 1011076, 1011204, 1011332,
+    1011460, 1011588, 1011716, 1011844, 1011972, 1012100, 1012228, 1012356,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1012482, 1012546, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1012610, 1012674, 1012738, 1012802, 1012866, 1012930, 1012994, 1013058,
+    1013122, 1013186, 1013250, 1013314, 1013378, 1013442, 1013506, 1013570,
+    1013634, 1013698, 1013762, 1013826, 1013890, 1013954, 1014018, 1014082,
+    1014146, 1014210, 1014274, 1014338, 1014402, 1014466, 1014530, 1014594,
+    1014658, 1014722, 1014786, 1014850, 1014914, 1014978, 1015042, 1015106,
+    1015170, 403394, 1015170, 403394, 1015170, 403394, 403394, 1015234,
+    2, 2, 2, 1015298, 1015362, 1015426, 1015492, 1015618,
+    403586, 1015682, 1015746, 1015810, 67970, 67970, 1015874, 1015938,
+    1016002, 1016066, 1016130, 1016194, 1016258, 1016322, 1016386, 1016450,
+    1016514, 1016578, 1016642, 1016706, 1016770, 1016834, 1016898, 1016962,
+    1017026, 1017090, 1017154, 1017218, 1017282, 1017346, 1017410, 1017474,
+    1015170, 403394, 1015170, 403394, 1017538, 1017602, 1017666, 1017730,
+    1017794, 1017858, 1017922, 1017986, 1018050, 1018114, 1018178, 1018242,
+    1018306, 1018370, 1018434, 1018498, 1018562, 1018626, 1018690, 1018754,
+    1018818, 1018882, 1018946, 1019010, 1019074, 1019138, 1019202, 1019266,
+    1019330, 1019394, 1019458, 1019522, 1019586, 1019650, 1019714, 1019778,
+    1019842, 1019906, 1019970, 1020034, 1020098, 1020162, 1020226, 1020290,
+    1020354, 1020418, 1020482, 1020546, 1020610, 1020674, 1020738, 1020802,
+    1020866, 1020930, 1020994, 1021058, 1021122, 1021186, 1021250, 1021314,
+    1021378, 1021442, 1021506, 1021570, 1021634, 1021698, 1021762, 1021826,
+    1021890, 1021954, 1022018, 1022082, 1022146, 1022210, 1022274, 1022338,
+    1022402, 1022466, 1022530, 1022594, 1022658, 1022722, 1022786, 1022850,
+    1022914, 1022978, 1023042, 1023106, 1023170, 1023234, 1023298, 1023362,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1023426, 1023490, 1023554, 1023618, 1023682, 1023746, 1023810, 1023874,
+    1023938, 1024002, 1024066, 1024130, 1024194, 1024258, 1024322, 1024386,
+    1024450, 1024514, 1024578, 1024642, 1024706, 1024770, 1024834, 1024898,
+    1024962, 1025026, 1025090, 1025154, 1025218, 1025282, 1025346, 1025410,
+    1025474, 1025538, 1025602, 1025666, 1025730, 1025794, 1025858, 1025922,
+    1025988, 1026116, 1026242, 1026306, 1026370, 1026434, 1026498, 1026562,
+    1026626, 1026690, 1026756, 1026884, 1027012, 420228, 1027140, 1027268,
+    1027396, 420356, 1027526, 1027718, 1027908, 1028036, 1028162, 1028226,
+    1028290, 1028354, 1028418, 1028482, 1028546, 1028610, 1028674, 1028738,
+    1028802, 1028866, 1028930, 1028994, 1029058, 1029122, 1029188, 1029316,
+    1029442, 1029506, 1029570, 1029634, 1029698, 1029762, 1029826, 1029890,
+    1029954, 1030018, 1030082, 1030146, 1030210, 1030274, 1030338, 1030402,
+    1030468, 1030596, 1030722, 1030786, 1030850, 1030914, 1030978, 1031042,
+    1031106, 1031170, 1031234, 1031298, 1031362, 1031426, 1031490, 1031554,
+    1031618, 1031682, 1031746, 1031810, 1031874, 1031938, 1032002, 1032066,
+    1032130, 1032196, 420612, 1032324, 1032452, 1032580, 1032706, 1032770,
+    1032834, 1032898, 1032964, 1033092, 1033220, 33028, 1033348, 1033476,
+    1033602, 1033666, 1033730, 1033794, 1033858, 1033922, 1033986, 1034050,
+    1034114, 1034178, 1034242, 1034306, 1034370, 1034434, 1034498, 1034562,
+    1034626, 1034690, 1034756, 422276, 1034884, 422404, 1035012, 422532,
+    1035140, 1035268, 1035396, 1035524, 1035652, 1035780, 1035908, 1036036,
+    1036164, 1036292, 1036418, 1036482, 1036546, 1036610, 1036674, 1036738,
+    1036802, 1036866, 1036930, 1036994, 1037058, 1037122, 1037186, 1037250,
+    1037314, 1037378, 1037442, 1037506, 1037570, 1037634, 1037698, 1037762,
+    0, 0, 1037826, 1037890, 1037954, 1038018, 1038082, 1038146,
+    1038210, 1038274, 1038338, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1038402, 1038466, 1038530,
+    1038596, 1038726, 1038914, 1038978, 1039042, 1039106, 1039170, 1039234,
+    1039298, 1039362, 1039426, 1039490, 1039554, 1039618, 1039682, 1039746,
+    1039810, 1039874, 1039938, 150146, 1040002, 1040066, 1040130, 1040194,
+    1040258, 1040322, 1040386, 1040450, 1040514, 1040578, 1040642, 1040706,
+    1040770, 1040834, 1040898, 1040962, 1041026, 1041090, 1041154, 1041218,
+    1041282, 1041346, 1041410, 1041474, 1041538, 1041602, 1041666, 1041730,
+    1041794, 1041858, 1041922, 1041986, 1042050, 0, 0, 0,
+    1042114, 1042178, 1042242, 1042306, 1042370, 1042434, 1042498, 1042562,
+    1042626, 1042690, 0, 0, 0, 0, 0, 0,
+    1042754, 1042818, 1042882, 1042946, 1043010, 1043074, 1043138, 1043202,
+    1043266, 1043330, 1043394, 1043458, 1043522, 1043586, 1043650, 1043714,
+    1043778, 1043842, 1043906, 1043970, 1044034, 1044098, 1044162, 1044226,
+    1044290, 1044354, 1044418, 1044482, 1044546, 1044610, 1044674, 1044738,
+    1044802, 1044866, 1044930, 1044994, 1045058, 1045122, 1045186, 1045250,
+    1045314, 1045378, 1045442, 1045506, 1045570, 1045634, 1045698, 1045762,
+    1045826, 1045890, 1045954, 1046018, 1046082, 1046146, 1046210, 1046274,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    150146, 150210, 1046338, 1046402, 1046466, 1046530, 1046594, 1046658,
+    1046722, 1046786, 1046850, 1046914, 1046978, 1047042, 1047106, 1047170,
+    1047234, 1047298, 1047362, 1047426, 1047490, 1047554, 1047618, 1047682,
+    1047746, 1047810, 1047874, 1047938, 1048002, 1048066, 1048130, 1048194,
+    1048258, 1048322, 1048386, 1048450, 1048514, 1048578, 1048642, 1048706,
+    1048770, 1048834, 1048898, 1048962, 1049026, 1049090, 1049154, 1049218,
+    1049282, 1049346, 1049410, 1049474, 1049538, 1049602, 1049666, 1049730,
+    1049794, 1049858, 1049922, 1049986, 1050050, 1050114, 1050178, 1050242,
+    1050306, 1050370, 1050434, 1050498, 1050562, 150082, 0, 0,
+    0, 0, 0, 0, 0, 0, 1050626, 1050690,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 1050754, 1050818, 1050818, 1050818, 1050818, 1050818,
+    1050882, 1050946, 1051010, 1051074, 1051138, 1051202, 1051266, 1051330,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1051394, 1051458, 1051522, 1051586, 1051650, 1051714,
+    1051778, 1051842, 1051906, 1051970, 1052034, 1052098, 1052162, 1052226,
+    1052290, 1052354, 1052418, 1052482, 1052546, 1052610, 1052674, 1052738,
+    1052802, 1052866, 1052930, 1052994, 1053058, 1053122, 1053186, 1053250,
+    1053314, 1053378, 1053442, 1053506, 1053570, 1053634, 1053698, 1053762,
+    1053826, 1053890, 1053954, 1054018, 1054082, 1054146, 1054210, 1054274,
+    1054338, 1054402, 1054466, 1054530, 1054594, 1054658, 1054722, 1054786,
+    1054850, 1054914, 1054978, 1055042, 1055106, 1055170, 1055234, 1055298,
+    1055362, 1055426, 1055490, 1055554, 1055618, 1055682, 1055746, 1055810,
+    1055874, 1055938, 1056002, 1056066, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1056130,
+    1056194, 1056258, 1056322, 1056386, 1056450, 1056514, 1056578, 1056642,
+    1056706, 1056770, 1056834, 1056898, 1056962, 1057026, 1057090, 1057154,
+    1057218, 1057282, 1057346, 1057410, 1057474, 1057538, 1057602, 1057666,
+    1057730, 1057794, 1057858, 1057922, 1057986, 0, 0, 0,
+    150082, 150146, 1058050, 150210, 1058114, 1058178, 1058242, 1058306,
+    1058370, 1058434, 1058498, 1058562, 1058626, 1058690, 1058754, 1058818,
+    1058882, 1058946, 1059010, 1059074, 1059138, 1059202, 1059266, 1059330,
+    1059394, 1059458, 1059522, 1059586, 1059650, 1059714, 1059778, 1059842,
+    1059906, 1059970, 1060034, 1060098, 1060162, 1060226, 1060290, 1060354,
+    1060418, 1060482, 1060546, 1060610, 1060674, 1060738, 1060802, 1060866,
+    1060930, 1060994, 1061058, 154050, 1061122, 1061186, 1061250, 1061314,
+    1061378, 1061442, 1061506, 1061570, 1061634, 1061698, 1061762, 1061826,
+    1061890, 1061954, 1062018, 1062082, 1062146, 1062210, 1062274, 1062338,
+    1062402, 1062466, 1062530, 1062594, 1062658, 1062722, 0, 1062786,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 1062850, 1062914,
+    1062978, 1063042, 1063106, 1063170, 1063234, 1063298, 1063362, 1063426,
+    1063490, 1063554, 1063618, 1063682, 1063746, 1063810, 1063874, 1063938,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1064002, 1064066, 1064130, 1064194, 1064258, 0,
+    1064322, 1064386, 1064450, 1064514, 1064578, 1064642, 1064706, 1064770,
+    1064834, 1064898, 1064962, 1065026, 1065090, 1065154, 1065218, 1065282,
+    1065346, 1065410, 1065474, 1065538, 1065602, 1065666, 1065730, 1065794,
+    1065858, 1065922, 1065986, 1066050, 1066114, 1066178, 1066242, 1066306,
+    1066370, 1066434, 1066498, 1066562, 1066626, 1066690, 1066754, 1066818,
+    1066882, 1066946, 1067010, 1067074, 1067138, 1067202, 1067266, 1067330,
+    1067394, 1067458, 1067522, 1067586, 1067650, 1067714, 1067778, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1067842, 1067906, 1067970, 1068034, 1068098, 1068162, 1068226, 1068290,
+    1068354, 1068418, 1068482, 1068546, 1068610, 1068674, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 1068738, 1068802, 1068866, 1068930,
+    1068994, 1069058, 1069122, 1069186, 1069250, 1069314, 1069378, 1069442,
+    1069506, 1069570, 1069634, 1069698, 1069762, 1069826, 1069890, 1069954,
+    1070018, 1070082, 1070146, 1070210, 1070274, 1070338, 1070402, 1070466,
+    1070530, 1070594, 1070658, 1070722, 1070786, 1070850, 1070914, 1070978,
+    1071042, 1071106, 1071170, 1071234, 1071298, 1071362, 1071426, 1071490,
+    1071554, 1071618, 1071682, 1071746, 1071810, 1071874, 1071938, 1072002,
+    1072066, 1072130, 1072194, 1072258, 1072322, 1072386, 1072450, 1072514,
+    1072578, 1072642, 1072706, 1072770, 1072834, 1072898, 1072962, 1073026,
+    1073090, 1073154, 1073218, 1073282, 1073346, 1073410, 1073474, 1073538,
+    1073602, 1073666, 1073730, 1073794, 1073858, 1073922, 1073986, 1074050,
+    1074114, 1074178, 1074242, 1074306, 1074370, 1074435, 1074499, 1074562,
+    1074626, 1074691, 1074754, 1074819, 1074883, 1074946, 1075010, 1075074,
+    1075138, 1075202, 1075266, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1075330, 1075394, 1075458, 1075522, 1075586,
+    1075650, 1075714, 1075778, 1075842, 1075906, 1075970, 1076034, 1076098,
+    1076162, 1076226, 1076290, 1076354, 1076418, 1076482, 1076546, 1076610,
+    1076674, 1076738, 1076802, 1076866, 1076930, 1076994, 1077058, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1077122, 1077186, 1077250, 1077314, 1077378, 1077442, 0,
+    0, 1077506, 1077570, 1077634, 1077698, 1077762, 1077826, 0,
+    0, 1077890, 1077954, 1078018, 1078082, 1078146, 1078210, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1078274, 1078338, 1078402, 1078466, 1078530, 1078594, 1078658, 0,
+    1078722, 1078786, 1078850, 1078914, 1078978, 1079042, 1079106, 0,
+    1079170, 1079234, 1079298, 1079362, 1079426, 1079490, 1079554, 1079618,
+    1079682, 1079746, 1079810, 1079874, 1079938, 1080002, 1080066, 1080130,
+    1080194, 1080258, 1080322, 1080386, 1080450, 1080514, 1080578, 1080642,
+    1080706, 1080770, 1080834, 1080898, 1080962, 1081026, 1081090, 1081154,
+    1081218, 1081282, 1081346, 1081410, 1081474, 1081538, 1081602, 1081666,
+    1081730, 1081794, 1081858, 1081922, 1081986, 1082050, 1082114, 1082178,
+    1082242, 1082306, 1082370, 1082434, 1082498, 1082562, 1082628, 1082756,
+    1082882, 1082946, 1083010, 1083074, 0, 0, 0, 0,
+    1083138, 1083202, 1083266, 1083330, 1083394, 1083458, 1083522, 1083586,
+    1083650, 1083714, 1083778, 1083842, 1083906, 1083970, 1084034, 1084098,
+    1084162, 1084226, 1084290, 1084354, 1084418, 1084482, 1084546, 1084610,
+    1084674, 1084738, 1084802, 1084866, 1084930, 1084994, 1085058, 1085122,
+    1085186, 1085250, 1085314, 1085378, 1085442, 1085506, 1085570, 1085634,
+    1085698, 1085762, 1085826, 1085890, 1085954, 1086018, 1086082, 1086146,
+    1086210, 1086274, 1086338, 1086402, 1086466, 1086530, 1086594, 1086658,
+    1086722, 1086786, 1086850, 1086914, 1086978, 1087042, 1087106, 1087170,
+    1087234, 1087298, 1087362, 1087426, 1087490, 1087554, 1087618, 1087682,
+    1087746, 1087810, 1087874, 1087938, 1088002, 1088066, 1088130, 1088194,
+    1088258, 1088322, 1088386, 1088450, 1088514, 1088578, 1088642, 1088706,
+    1088770, 1088834, 1088898, 1088962, 1089026, 1089090, 1089154, 1089218,
+    1089282, 1089346, 1089410, 1089474, 1089538, 1089602, 1089666, 1089730,
+    1089794, 1089858, 1089922, 1089986, 1090050, 1090114, 1090178, 1090242,
+    1090306, 1090370, 1090434, 1090498, 1090562, 1090626, 1090690, 1090754,
+    1090818, 1090882, 1090946, 1091010, 1091074, 1091138, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1091202, 1091266, 1091330, 1091394, 1091458, 1091522, 1091586, 1091650,
+    1091714, 1091778, 1091842, 1091906, 1091970, 1092034, 1092098, 1092162,
+    1092226, 1092290, 1092354, 1092418, 1092482, 1092546, 1092610, 0,
+    0, 0, 0, 1092674, 1092738, 1092802, 1092866, 1092930,
+    1092994, 1093058, 1093122, 1093186, 1093250, 1093314, 1093378, 1093442,
+    1093506, 1093570, 1093634, 1093698, 1093762, 1093826, 1093890, 1093954,
+    1094018, 1094082, 1094146, 1094210, 1094274, 1094338, 1094402, 1094466,
+    1094530, 1094594, 1094658, 1094722, 1094786, 1094850, 1094914, 1094978,
+    1095042, 1095106, 1095170, 1095234, 1095298, 1095362, 1095426, 1095490,
+    1095554, 1095618, 1095682, 1095746, 0, 0, 0, 0,
+    1095812, 1095940, 1096068, 1096196, 1096324, 1096452, 1096580, 1096708,
+    1096708, 1096836, 1096964, 1097092, 1097220, 1097348, 1097476, 1097604,
+    1097732, 1097860, 1097988, 1098116, 1098244, 1098372, 1098500, 1098628,
+    1098756, 1098884, 1099012, 1099140, 1099268, 1099396, 1099524, 1099652,
+    1099780, 1099908, 1100036, 1100164, 1100292, 1100420, 1100548, 1100676,
+    1100804, 1100932, 1101060, 1101188, 1101316, 1101444, 1101572, 1101700,
+    1101828, 1101956, 1102084, 1102212, 1102340, 1102468, 1102596, 1102724,
+    1102852, 1102980, 1103108, 1103236, 1103364, 1103492, 1103620, 1103748,
+    1103876, 1104004, 1104132, 1104260, 1104388, 1104516, 1104644, 1104772,
+    1104900, 1105028, 1105156, 1105284, 1105412, 1105540, 1105668, 1105796,
+    1105924, 1106052, 1106180, 1106308, 1106436, 1106564, 1106692, 1106820,
+    1106948, 1107076, 1107204, 1107332, 1098244, 1107460, 1107588, 1107716,
+    1107844, 1107972, 1108100, 1108228, 1108356, 1108484, 1108612, 1108740,
+    1108868, 1108996, 1109124, 1109252, 1109380, 1109508, 1109636, 1109764,
+    1109892, 1110020, 1110148, 1110276, 1110404, 1110532, 1110660, 1110788,
+    1110916, 1111044, 1111172, 1111300, 1111428, 1111556, 1111684, 1111812,
+    1111940, 1112068, 1112196, 1112324, 1112452, 1112580, 1112708, 1112836,
+    1112964, 1113092, 1113220, 1113348, 1113476, 1113604, 1113732, 1113860,
+    1113988, 1114116, 1114244, 1114372, 1114500, 1114628, 1114756, 1114884,
+    1115012, 1115140, 1115268, 1115396, 1115524, 1115652, 1115780, 1115908,
+    1116036, 1109764, 1116164, 1116292, 1116420, 1116548, 1116676, 1116804,
+    1116932, 1117060, 1107716, 1117188, 1117316, 1117444, 1117572, 1117700,
+    1117828, 1117956, 1118084, 1118212, 1118340, 1118468, 1118596, 1118724,
+    1118852, 1118980, 1119108, 1119236, 1119364, 1119492, 1119620, 1098244,
+    1119748, 1119876, 1120004, 1120132, 1120260, 1120388, 1120516, 1120644,
+    1120772, 1120900, 1121028, 1121156, 1121284, 1121412, 1121540, 1121668,
+    1121796, 1121924, 1122052, 1122180, 1122308, 1122436, 1122564, 1122692,
+    1122820, 1122948, 1123076, 1107972, 1123204, 1123332, 1123460, 1123588,
+    1123716, 1123844, 1123972, 1124100, 1124228, 1124356, 1124484, 1124612,
+    1124740, 1124868, 1124996, 1125124, 1125252, 1125380, 1125508, 1125636,
+    1125764, 1125892, 1126020, 1126148, 1126276, 1126404, 1126532, 1126660,
+    1126788, 1126916, 1127044, 1127172, 1127300, 1127428, 1127556, 1127684,
+    1127812, 1127940, 1128068, 1128196, 1128324, 1128452, 1128580, 1128708,
+    1128836, 1128964, 1129092, 1129220, 1129348, 1129476, 1129604, 1129732,
+    1129860, 1129988, 1130116, 1130244, 1130372, 1130500, 1130628, 1130756,
+    1130884, 1131012, 1131140, 1131268, 1131396, 1131524, 1131652, 1131780,
+    1131908, 1132036, 1132164, 1132292, 1132420, 1132548, 1132676, 1132804,
+    1132932, 1133060, 1133188, 1133316, 1133444, 1133572, 1133700, 1133828,
+    1133956, 1134084, 1134212, 1134340, 1134468, 1134596, 1134724, 1134852,
+    1134980, 1135108, 1135236, 1135364, 1135492, 1135620, 1135748, 1135876,
+    1136004, 1136132, 1136260, 1136388, 1136516, 1136644, 1136772, 1136900,
+    1137028, 1137156, 1137284, 1137412, 1137540, 1137668, 1137796, 1137924,
+    1138052, 1138180, 1138308, 1138436, 1138564, 1138692, 1138820, 1114756,
+    1138948, 1139076, 1139204, 1139332, 1139460, 1139588, 1139588, 1139716,
+    1139844, 1139972, 1140100, 1140228, 1140356, 1140484, 1140612, 1132548,
+    1140740, 1140868, 1140996, 1141124, 1141252, 1141380, 0, 0,
+    1141508, 1141636, 1141764, 1141892, 1142020, 1142148, 1142276, 1142404,
+    1134724, 1142532, 1142660, 1142788, 1129860, 1142916, 1143044, 1143172,
+    1143300, 1143428, 1143556, 1143684, 1143812, 1143940, 1144068, 1144196,
+    1144324, 1135876, 1144452, 1136004, 1144580, 1144708, 1144836, 1144964,
+    1145092, 1130116, 1100932, 1145220, 1145348, 1145476, 1109892, 1121028,
+    1145604, 1145732, 1136900, 1145860, 1137028, 1145988, 1146116, 1146244,
+    1130628, 1146372, 1146500, 1146628, 1146756, 1146884, 1130756, 1147012,
+    1147140, 1147268, 1147396, 1147524, 1147652, 1138820, 1147780, 1147908,
+    1114756, 1148036, 1139332, 1148164, 1148292, 1148420, 1148548, 1148676,
+    1139972, 1148804, 1132164, 1148932, 1140100, 1107460, 1149060, 1140228,
+    1149188, 1140484, 1149316, 1149444, 1149572, 1149700, 1149828, 1140740,
+    1131396, 1149956, 1140868, 1150084, 1140996, 1150212, 1096708, 1150340,
+    1150468, 1150596, 1150724, 1150852, 1150980, 1151108, 1151236, 1151364,
+    1151492, 1151620, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1151748, 1151876, 1152004, 1152134, 1152326, 1152518, 1152708, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1152836, 1152964, 1153092, 1153220, 1153348,
+    0, 0, 0, 0, 0, 1153476, 1153602, 1153670,
+    1153858, 1153922, 1153986, 1154050, 1154114, 1154178, 1154242, 1154306,
+    1154370, 1154434, 1154500, 1154628, 1154758, 1154950, 1155140, 1155268,
+    1155396, 1155524, 1155652, 1155780, 1155908, 1156036, 1156164, 0,
+    1156292, 1156420, 1156548, 1156676, 1156804, 0, 1156932, 0,
+    1157060, 1157188, 0, 1157316, 1157444, 0, 1157572, 1157700,
+    1157828, 1157956, 1158084, 1158212, 1158340, 1158468, 1158596, 1158724,
+    1158850, 1158914, 1158978, 1159042, 1159106, 1159170, 1159234, 1159298,
+    1159362, 1159426, 1159490, 1159554, 1159618, 1159682, 1159746, 1159810,
+    1159874, 1159938, 1160002, 1160066, 1160130, 1160194, 1160258, 1160322,
+    1160386, 1160450, 1160514, 1160578, 1160642, 1160706, 1160770, 1160834,
+    1160898, 1160962, 1161026, 1161090, 1161154, 1161218, 1161282, 1161346,
+    1161410, 1161474, 1161538, 1161602, 1161666, 1161730, 1161794, 1161858,
+    1161922, 1161986, 1162050, 1162114, 1162178, 1162242, 1162306, 1162370,
+    1162434, 1162498, 1162562, 1162626, 1162690, 1162754, 1162818, 1162882,
+    1162946, 1163010, 1163074, 1163138, 1163202, 1163266, 1163330, 1163394,
+    1163458, 1163522, 1163586, 1163650, 1163714, 1163778, 1163842, 1163906,
+    1163970, 1164034, 1164098, 1164162, 1164228, 1164356, 1164482, 1164546,
+    1164610, 1164674, 1164738, 1164802, 1164866, 1164930, 1164994, 1165058,
+    1165124, 1165252, 1165378, 1165442, 1165506, 1165570, 1165634, 1165698,
+    1165762, 1165826, 1165890, 1165954, 1166018, 1166082, 1166146, 1166210,
+    1166274, 1166338, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1166402, 1166466, 1166530, 1166594, 1166658,
+    1166722, 1166786, 1166850, 1166914, 1166978, 1167044, 1167170, 1167234,
+    1167298, 1167362, 1167426, 1167490, 1167554, 1167618, 1167682, 1167746,
+    1167810, 1167874, 1167940, 1168068, 1168196, 1168324, 1168452, 1168580,
+    1168708, 1168836, 1168964, 1169092, 1169220, 1169348, 1169476, 1169604,
+    1169732, 1169860, 1169988, 1170116, 1170242, 1170306, 1170370, 1170434,
+    1170500, 1170628, 1170756, 1169860, 1170884, 1171012, 1171140, 1171268,
+    1171396, 1171524, 1171652, 1171780, 1171908, 1172036, 1172164, 1172292,
+    1172420, 1172548, 1172676, 1172804, 1172932, 1173060, 1173188, 1173316,
+    1173444, 1173572, 1173700, 1173828, 1173956, 1174084, 1174212, 1174340,
+    1174468, 1174596, 1174724, 1174852, 1174980, 1175108, 1175236, 1175364,
+    1175492, 1175620, 1175748, 1175876, 1176004, 1176132, 1176260, 1176388,
+    1176516, 1176644, 1176772, 1176900, 1177028, 1177156, 1177284, 1177412,
+    1177540, 1177668, 1177796, 1177924, 1178052, 1178180, 1178308, 1178436,
+    1178564, 1178692, 1178820, 1178948, 1179076, 1179204, 1179332, 1179460,
+    1179588, 1179716, 1179844, 1179972, 1180100, 1180228, 1180356, 1180484,
+    1180612, 1180740, 1180868, 1180996, 1181124, 1181252, 1181380, 1181508,
+    1181636, 1181764, 1181892, 1182020, 1182148, 1182276, 1182404, 1182532,
+    1182660, 1182788, 1182916, 1183044, 1183172, 1183300, 1183428, 1183556,
+    1169988, 1183684, 1183812, 1183940, 1184068, 1184196, 1184324, 1184452,
+    1184580, 1184708, 1184836, 1184964, 1185092, 1185220, 1185348, 1185476,
+    1185604, 1185732, 1185860, 1185988, 1186116, 1186244, 1186372, 1186500,
+    1186628, 1186756, 1186884, 1187012, 1187140, 1187268, 1187396, 1187524,
+    1187652, 1187780, 1187908, 1188036, 1188164, 1188292, 1188420, 1188548,
+    1188676, 1188804, 1188932, 1189060, 1189188, 1189316, 1189444, 1189572,
+    1189700, 1189828, 1189956, 1190084, 1190212, 1190340, 1190468, 1190596,
+    1190724, 1190852, 1190980, 1191108, 1191236, 1191364, 1191492, 1191620,
+    1191748, 1191876, 1192004, 1192132, 1192260, 1192388, 1192516, 1192644,
+    1192772, 1192900, 1193028, 1193156, 1193284, 1193412, 1193540, 1193668,
+    1193796, 1193924, 1194052, 1194180, 1194308, 1194436, 1194564, 1194692,
+    1194820, 1194948, 1195076, 1195204, 1195332, 1195460, 1195588, 1195716,
+    1195844, 1195972, 1196100, 1196228, 1196356, 1196484, 1196612, 1196740,
+    1196868, 1196996, 1197124, 1197252, 1197380, 1197508, 1197636, 1197764,
+    1197892, 1198020, 1198148, 1198276, 1198404, 1198532, 1198660, 1198788,
+    1198916, 1199044, 1199172, 1199300, 1199428, 1199556, 1199684, 1199812,
+    1199940, 1200068, 1200196, 1200324, 1200452, 1200580, 1200708, 1200836,
+    1200964, 1201092, 1201220, 1201348, 1201476, 1201604, 1201732, 1201860,
+    1201988, 1202116, 1202244, 1202372, 1202500, 1202628, 1202756, 1202884,
+    1203012, 1203140, 1203268, 1203396, 1203524, 1203652, 1203780, 1203908,
+    1204036, 1204164, 1204292, 1204420, 1204548, 1204676, 1204804, 1204932,
+    1205060, 1205188, 1205316, 1205444, 1205572, 1205700, 1205828, 1205956,
+    1206084, 1206212, 1206340, 1206468, 1206596, 1206724, 1206852, 1206980,
+    1207108, 1207236, 1207364, 1207492, 1207620, 1207748, 1207876, 1208004,
+    1208132, 1208260, 1208388, 1208516, 1208644, 1208772, 1208900, 1209028,
+    1209156, 1209284, 1209412, 1209540, 1209668, 1209796, 1209924, 1210052,
+    1210180, 1210308, 1210436, 1210564, 1210692, 1210820, 1210946, 1211010,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1211078, 1211270, 1211462, 1211654, 1211846, 1212038, 1212230, 1212422,
+    1212614, 1212806, 1212998, 1213190, 1213382, 1213574, 1213766, 1213958,
+    1214150, 1214342, 1214534, 1214726, 1214918, 1215110, 1215302, 1215494,
+    1215686, 1215878, 1216070, 1216262, 1216454, 1216646, 1216838, 1217030,
+    1217222, 1217414, 1217606, 1217798, 1217990, 1218182, 1218374, 1218566,
+    1218758, 1218950, 1219142, 1219334, 1219526, 1219718, 1219910, 1220102,
+    1220294, 1220486, 1220678, 1220870, 1221062, 1221254, 1221446, 1221638,
+    1221830, 1222022, 1222214, 1222406, 1222598, 1222790, 1222982, 1223174,
+    0, 0, 1223366, 1223558, 1223750, 1223942, 1224134, 1224326,
+    1224518, 1224710, 1224902, 1225094, 1225286, 1225478, 1225670, 1225862,
+    1226054, 1226246, 1226438, 1226630, 1226822, 1227014, 1227206, 1227398,
+    1227590, 1227782, 1227974, 1228166, 1228358, 1228550, 1228742, 1228934,
+    1229126, 1229318, 1229510, 1229702, 1229894, 1230086, 1230278, 1230470,
+    1230662, 1230854, 1231046, 1231238, 1231430, 1231622, 1231814, 1232006,
+    1232198, 1232390, 1232582, 1232774, 1232966, 1233158, 1233350, 1233542,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1233734, 1233926, 1234120, 1234376, 1234632, 1234888, 1235144, 1235400,
+    1235656, 1235910, 1236132, 1237264, 1237768, 1238018, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    1238082, 1238146, 1238210, 1238274, 1238338, 1238402, 1238466, 1238530,
+    1238594, 1238662, 0, 0, 0, 0, 0, 0,
+    70018, 2, 69954, 2, 2, 2, 2, 68354,
+    2, 69954, 2, 2, 2, 2, 90562, 2,
+    1238852, 1238978, 1239042, 1239106, 1239106, 1239170, 1239234, 1239298,
+    1239362, 1239426, 1239490, 1239554, 1239618, 1239682, 1239746, 1239810,
+    1239874, 1239938, 1240002, 1240066, 1240130, 1240194, 1240258, 1240322,
+    1240386, 1240450, 1240450, 1240450, 1240450, 1240514, 1240514, 1240514,
+    1240578, 1240642, 1240706, 0, 1240770, 1240834, 1240898, 1240962,
+    1241026, 1241090, 1241154, 1241218, 1241282, 1241346, 1241410, 1241474,
+    1241538, 1241602, 1241666, 1241730, 1241794, 1241858, 1241922, 0,
+    1241986, 1242050, 1242114, 1242178, 0, 0, 0, 0,
+    1242242, 1242306, 1242370, 2, 1242434, 0, 1242498, 1242562,
+    1242626, 1242690, 1242754, 1242818, 1242882, 1242946, 1243010, 1243074,
+    1243138, 1243202, 1243266, 1243330, 1243394, 1243458, 1243522, 1243586,
+    1243650, 1243714, 1243778, 1243842, 1243906, 1243970, 1244034, 1244098,
+    1244162, 1244226, 1244290, 1244354, 1244418, 1244482, 1244546, 1244610,
+    1244674, 1244738, 1244802, 1244866, 1244930, 1244994, 1245058, 1245122,
+    1245186, 1245250, 1245314, 1245378, 1245442, 1245506, 1245570, 1245634,
+    1245698, 1245762, 1245826, 1245890, 1245954, 1246018, 1246082, 1246146,
+    1246210, 1246274, 1246338, 1246402, 1246466, 1246530, 1246594, 1246658,
+    1246722, 1246786, 1246850, 1246914, 1246978, 1247042, 1247106, 1247170,
+    1247234, 1247298, 1247362, 1247426, 1247490, 1247554, 1247618, 1247682,
+    1247746, 1247810, 1247874, 1247938, 1248002, 1248066, 1248130, 1248194,
+    1248258, 1248322, 1248386, 1248450, 1248514, 1248578, 1248642, 1248706,
+    1248770, 1248834, 1248898, 1248962, 1249026, 1249090, 1249154, 1249218,
+    1249282, 1249346, 1249410, 1249474, 1249538, 1249602, 1249666, 1249730,
+    1249794, 1249858, 1249922, 1249986, 1250050, 1250114, 1250178, 1250242,
+    1250306, 1250370, 1250434, 1250498, 1250562, 1250628, 1250756, 1250884,
+    1251012, 1251140, 1251268, 1251396, 1251524, 0, 0, 2,
+    0, 1251650, 1251714, 1251778, 1251842, 1251906, 1251970, 1252034,
+    1252098, 1252162, 1252226, 1252290, 1252354, 1252418, 1252482, 1252546,
+    1252610, 1252674, 1252738, 1252802, 1252866, 1252930, 1252994, 1253058,
+    1253122, 1253186, 1253250, 1253314, 1253378, 1253442, 1253506, 1253570,
+    1253634, 1253698, 1253762, 1253826, 1253890, 1253954, 1254018, 1254082,
+    1254146, 1254210, 1254274, 1254338, 1254402, 1254466, 1254530, 1254594,
+    1254658, 1254722, 1254786, 1254850, 1254914, 1254978, 1255042, 1255106,
+    1255170, 1255234, 1255298, 1255362, 1255426, 1255490, 1255554, 1255618,
+    1255682, 1255746, 1255810, 1255874, 1255938, 1256002, 1256066, 1256130,
+    1256194, 1256258, 1256322, 1256386, 1256450, 1256514, 1256578, 1256642,
+    1256706, 1256770, 1256834, 1256898, 1256962, 1257026, 1257090, 1257154,
+    1257218, 1257282, 1257346, 1257410, 1257474, 1257538, 1257602, 1257666,
+    1257730, 1257794, 1257858, 1257922, 1257986, 1258050, 1258114, 1258178,
+    1258242, 1258306, 1258370, 1258434, 1258498, 1258562, 1258626, 1258690,
+    1258754, 1258818, 1258882, 1258946, 1259010, 1259074, 1259138, 1259202,
+    1259266, 1259330, 1259394, 1259458, 1259522, 1259586, 1259650, 1259714,
+    1259778, 1259842, 1259906, 1259970, 1260034, 1260098, 1260162, 1260226,
+    1260290, 1260354, 1260418, 1260482, 1260546, 1260610, 1260674, 1260738,
+    1260802, 1260866, 1260930, 1260994, 1261058, 1261122, 1261186, 1261250,
+    1261314, 1261378, 1261442, 1261506, 1261570, 1261634, 1261698, 1261762,
+    1261826, 1261890, 1261954, 1262018, 1262082, 1262146, 1262210, 1262274,
+    1262338, 1262402, 1262466, 1262530, 1262594, 1262658, 1262722, 1262786,
+    1262850, 1262914, 1262978, 1263042, 1263106, 1263170, 1263234, 1263298,
+    1263362, 1263426, 1263490, 1263554, 1263618, 1263682, 1263746, 0,
+    0, 0, 1263810, 1263874, 1263938, 1264002, 1264066, 1264130,
+    0, 0, 1264194, 1264258, 1264322, 1264386, 1264450, 1264514,
+    0, 0, 1264578, 1264642, 1264706, 1264770, 1264834, 1264898,
+    0, 0, 1264962, 1265026, 1265090, 0, 0, 0,
+    1265154, 1265218, 1265282, 1265346, 1265410, 1265474, 1265538, 0,
+    1265602, 1265666, 1265730, 1265794, 1265858, 1265922, 1265986, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 1266050, 1266114, 0, 0,
+    1266178, 1266242, 1266306, 1266370, 1266434, 1266498, 1266562, 1266626,
+    1266690, 1266754, 1266818, 1266882, 0, 1266946, 1267010, 1267074,
+    1267138, 1267202, 1267266, 1267330, 1267394, 1267458, 1267522, 1267586,
+    1267650, 1267714, 1267778, 1267842, 1267906, 1267970, 1268034, 1268098,
+    1268162, 1268226, 1268290, 1268354, 1268418, 1268482, 1268546, 0,
+    1268610, 1268674, 1268738, 1268802, 1268866, 1268930, 1268994, 1269058,
+    1269122, 1269186, 1269250, 1269314, 1269378, 1269442, 1269506, 1269570,
+    1269634, 1269698, 1269762, 0, 1269826, 1269890, 0, 1269954,
+    1270018, 1270082, 1270146, 1270210, 1270274, 1270338, 1270402, 1270466,
+    1270530, 1270594, 1270658, 1270722, 1270786, 1270850, 0, 0,
+    1270914, 1270978, 1271042, 1271106, 1271170, 1271234, 1271298, 1271362,
+    1271426, 1271490, 1271554, 1271618, 1271682, 1271746, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1271810, 1271874, 1271938, 1272002, 1272066, 1272130, 1272194, 1272258,
+    1272322, 1272386, 1272450, 1272514, 1272578, 1272642, 1272706, 1272770,
+    1272834, 1272898, 1272962, 1273026, 1273090, 1273154, 1273218, 1273282,
+    1273346, 1273410, 1273474, 1273538, 1273602, 1273666, 1273730, 1273794,
+    1273858, 1273922, 1273986, 1274050, 1274114, 1274178, 1274242, 1274306,
+    1274370, 1274434, 1274498, 1274562, 1274626, 1274690, 1274754, 1274818,
+    1274882, 1274946, 1275010, 1275074, 1275138, 1275202, 1275266, 1275330,
+    1275394, 1275458, 1275522, 1275586, 1275650, 1275714, 1275778, 1275842,
+    1275906, 1275970, 1276034, 1276098, 1276162, 1276226, 1276290, 1276354,
+    1276418, 1276482, 1276546, 1276610, 1276674, 1276738, 1276802, 1276866,
+    1276930, 1276994, 1277058, 1277122, 1277186, 1277250, 1277314, 1277378,
+    1277442, 1277506, 1277570, 1277634, 1277698, 1277762, 1277826, 1277890,
+    1277954, 1278018, 1278082, 1278146, 1278210, 1278274, 1278338, 1278402,
+    1278466, 1278530, 1278594, 1278658, 1278722, 1278786, 1278850, 1278914,
+    1278978, 1279042, 1279106, 1279170, 1279234, 1279298, 1279362, 1279426,
+    1279490, 1279554, 1279618, 0, 0, 0, 0, 0,
+    1279682, 1279746, 1279810, 0, 0, 0, 0, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    1279874, 1279938, 1280002, 1280066, 1280130, 1280194, 1280258, 1280322,
+    1280386, 1280450, 1280514, 1280578, 1280642, 1280706, 1280770, 1280834,
+    1280898, 1280962, 1281026, 1281090, 1281154, 1281218, 1281282, 1281346,
+    1281410, 1281474, 1281538, 1281602, 1281666, 1281730, 1281794, 1281858,
+    1281922, 1281986, 1282050, 1282114, 0, 0, 0, 1282178,
+    1282242, 1282306, 1282370, 1282434, 1282498, 1282562, 1282626, 1282690,
+    1282754, 1282818, 1474, 1730, 1282882, 1282946, 1283010, 1283074,
+    1730, 1283138, 1283202, 1283266, 1283330, 1283394, 1283458, 1730,
+    1283522, 1283586, 1283650, 1283714, 1283778, 1283842, 1283906, 1283970,
+    1474, 1474, 1474, 1538, 1538, 1538, 1538, 1730,
+    1284034, 1284098, 1284162, 1284226, 1284290, 1284354, 1284418, 1284482,
+    1284546, 1284610, 1284674, 1284738, 1284802, 1284866, 1284930, 1284994,
+    1285058, 1285122, 1285186, 1730, 1285250, 1285314, 1285378, 1285442,
+    1285506, 1285570, 1285634, 1285698, 1285762, 1285826, 1285890, 1285954,
+    1286018, 1286082, 1286146, 1286210, 1286274, 1286338, 1286402, 1286466,
+    1286530, 1286594, 1410, 1286658, 1286722, 1286786, 1286850, 0,
+    1286914, 1286978, 1287042, 1287106, 1287170, 1287234, 1287298, 1287362,
+    1287426, 1287490, 1287554, 1287618, 1287682, 0, 0, 0,
+    1287746, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1287810, 1287874, 1287938, 1288002, 1288066, 1288130, 1288194, 1288258,
+    1288322, 1288386, 1288450, 1288514, 1288578, 1288642, 1288706, 1288770,
+    1288834, 1288898, 1288962, 1289026, 1289090, 1289154, 1289218, 1289282,
+    1289346, 1289410, 1289474, 1289538, 1289602, 1289666, 1289730, 1289794,
+    1289858, 1289922, 1289986, 1290050, 1290114, 1290178, 1290242, 1290306,
+    1290370, 1290434, 1290498, 1290562, 1290626, 1290690, 0, 0,
+    1290754, 1290818, 1290882, 1290946, 1291010, 1291074, 1291138, 1291202,
+    1291266, 1291330, 1291394, 1291458, 1291522, 1291586, 1291650, 1291714,
+    1291778, 1291842, 1291906, 1291970, 1292034, 1292098, 1292162, 1292226,
+    1292290, 1292354, 1292418, 1292482, 1292546, 0, 0, 0,
+    1292610, 1292674, 1292738, 1292802, 1292866, 1292930, 1292994, 1293058,
+    1293122, 1293186, 1293250, 1293314, 1293378, 1293442, 1293506, 1293570,
+    1293634, 1293698, 1293762, 1293826, 1293890, 1293954, 1294018, 1294082,
+    1294146, 1294210, 1294274, 1294338, 1294402, 1294466, 1294530, 1294594,
+    1294658, 1294722, 1294786, 1294850, 1294914, 1294978, 1295042, 1295106,
+    1295170, 1295234, 1295298, 1295362, 1295426, 1295490, 1295554, 1295618,
+    1295682, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1295746, 1295810, 1295874, 1295938, 1296002, 1296066,
+    1296130, 1296194, 1296258, 1296322, 1296386, 1296450, 1296514, 1296578,
+    1296642, 1296706, 1296770, 1296834, 0, 0, 0, 0,
+    1296898, 1296962, 1297026, 1297090, 1297154, 1297218, 1297282, 1297346,
+    1297410, 1297474, 1297538, 1297602, 1297666, 1297730, 1297794, 1297858,
+    1297922, 1297986, 1298050, 1298114, 1298178, 1298242, 1298306, 1298370,
+    1298434, 1298498, 1298562, 1298626, 1298690, 1298754, 1298818, 1298882,
+    1474, 1730, 1298946, 1299010, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1299074, 1299138, 1299202,
+    1299266, 1299330, 1299394, 1299458, 1299522, 1299586, 1299650, 1299714,
+    1299778, 1299842, 1299906, 1299970, 1300034, 1300098, 1300162, 1300226,
+    1300290, 1300354, 1300418, 1300482, 1300546, 1300610, 1300674, 1300738,
+    1300802, 1300866, 1300930, 0, 0, 0, 0, 0,
+    1300994, 1301058, 1301122, 1301186, 1301250, 1301314, 1301378, 1301442,
+    1301506, 1301570, 1301634, 1301698, 1301762, 1301826, 1301890, 1301954,
+    1302018, 1302082, 1302146, 1302210, 1302274, 1302338, 1302402, 1302466,
+    1302530, 1302594, 1302658, 1302722, 1302786, 1302850, 1302914, 1302978,
+    1303042, 1303106, 1303170, 1303234, 1303298, 1303362, 1303426, 1303490,
+    1303554, 1303618, 1303682, 0, 0, 0, 0, 0,
+    1303746, 1303810, 1303874, 1303938, 1304002, 1304066, 1304130, 1304194,
+    1304258, 1304322, 1304386, 1304450, 1304514, 1304578, 1304642, 1304706,
+    1304770, 1304834, 1304898, 1304962, 1305026, 1305090, 1305154, 1305218,
+    1305282, 1305346, 1305410, 1305474, 1305538, 1305602, 0, 1305666,
+    1305730, 1305794, 1305858, 1305922, 1305986, 1306050, 1306114, 1306178,
+    1306242, 1306306, 1306370, 1306434, 1306498, 1306562, 1306626, 1306690,
+    1306754, 1306818, 1306882, 1306946, 1307010, 1307074, 1307138, 1307202,
+    1307266, 1307330, 1307394, 1307458, 1307522, 1307586, 1307650, 1307714,
+    1307778, 1307842, 1307906, 1307970, 0, 0, 0, 0,
+    1308034, 1308098, 1308162, 1308226, 1308290, 1308354, 1308418, 1308482,
+    1308546, 1474, 1538, 1308610, 1308674, 1308738, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1308802, 1308866, 1308930, 1308994, 1309058, 1309122, 1309186, 1309250,
+    1309314, 1309378, 1309442, 1309506, 1309570, 1309634, 1309698, 1309762,
+    1309826, 1309890, 1309954, 1310018, 1310082, 1310146, 1310210, 1310274,
+    1310338, 1310402, 1310466, 1310530, 1310594, 1310658, 1310722, 1310786,
+    1310850, 1310914, 1310978, 1311042, 1311106, 1311170, 1311234, 1311298,
+    1311362, 1311426, 1311490, 1311554, 1311618, 1311682, 1311746, 1311810,
+    1311874, 1311938, 1312002, 1312066, 1312130, 1312194, 1312258, 1312322,
+    1312386, 1312450, 1312514, 1312578, 1312642, 1312706, 1312770, 1312834,
+    1312898, 1312962, 1313026, 1313090, 1313154, 1313218, 1313282, 1313346,
+    1313410, 1313474, 1313538, 1313602, 1313666, 1313730, 1313794, 1313858,
+    1313922, 1313986, 1314050, 1314114, 1314178, 1314242, 1314306, 1314370,
+    1314434, 1314498, 1314562, 1314626, 1314690, 1314754, 1314818, 1314882,
+    1314946, 1315010, 1315074, 1315138, 1315202, 1315266, 1315330, 1315394,
+    1315458, 1315522, 1315586, 1315650, 1315714, 1315778, 1315842, 1315906,
+    1315970, 1316034, 1316098, 1316162, 1316226, 1316290, 1316354, 1316418,
+    1316482, 1316546, 1316610, 1316674, 1316738, 1316802, 1316866, 1316930,
+    1316994, 1317058, 1317122, 1317186, 1317250, 1317314, 1317378, 1317442,
+    1317506, 1317570, 1317634, 1317698, 1317762, 1317826, 1317890, 1317954,
+    1318018, 1318082, 1318146, 1318210, 1318274, 1318338, 1318402, 1318466,
+    1318530, 1318594, 1318658, 1318722, 1318786, 1318850, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    1318914, 1318978, 1319042, 1319106, 1319170, 1319234, 1319298, 1319362,
+    1319426, 1319490, 1319554, 1319618, 1319682, 1319746, 1319810, 1319874,
+    1319938, 1320002, 1320066, 1320130, 1320194, 1320258, 1320322, 1320386,
+    1320450, 1320514, 1320578, 1320642, 1320706, 1320770, 1320834, 1320898,
+    1320962, 1321026, 1321090, 1321154, 0, 0, 0, 0,
+    1321218, 1321282, 1321346, 1321410, 1321474, 1321538, 1321602, 1321666,
+    1321730, 1321794, 1321858, 1321922, 1321986, 1322050, 1322114, 1322178,
+    1322242, 1322306, 1322370, 1322434, 1322498, 1322562, 1322626, 1322690,
+    1322754, 1322818, 1322882, 1322946, 1323010, 1323074, 1323138, 1323202,
+    1323266, 1323330, 1323394, 1323458, 0, 0, 0, 0,
+    1323522, 1323586, 1323650, 1323714, 1323778, 1323842, 1323906, 1323970,
+    1324034, 1324098, 1324162, 1324226, 1324290, 1324354, 1324418, 1324482,
+    1324546, 1324610, 1324674, 1324738, 1324802, 1324866, 1324930, 1324994,
+    1325058, 1325122, 1325186, 1325250, 1325314, 1325378, 1325442, 1325506,
+    1325570, 1325634, 1325698, 1325762, 1325826, 1325890, 1325954, 1326018,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1326082, 1326146, 1326210, 1326274, 1326338, 1326402, 1326466, 1326530,
+    1326594, 1326658, 1326722, 1326786, 1326850, 1326914, 1326978, 1327042,
+    1327106, 1327170, 1327234, 1327298, 1327362, 1327426, 1327490, 1327554,
+    1327618, 1327682, 1327746, 1327810, 1327874, 1327938, 1328002, 1328066,
+    1328130, 1328194, 1328258, 1328322, 1328386, 1328450, 1328514, 1328578,
+    1328642, 1328706, 1328770, 1328834, 1328898, 1328962, 1329026, 1329090,
+    1329154, 1329218, 1329282, 1329346, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1329410,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1329474, 1329538, 1329602, 1329666, 1329730, 1329794, 1329858, 1329922,
+    1329986, 1330050, 1330114, 1330178, 1330242, 1330306, 1330370, 1330434,
+    1330498, 1330562, 1330626, 1330690, 1330754, 1330818, 1330882, 1330946,
+    1331010, 1331074, 1331138, 1331202, 1331266, 1331330, 1331394, 1331458,
+    1331522, 1331586, 1331650, 1331714, 1331778, 1331842, 1331906, 1331970,
+    1332034, 1332098, 1332162, 1332226, 1332290, 1332354, 1332418, 1332482,
+    1332546, 1332610, 1332674, 1332738, 1332802, 1332866, 1332930, 1332994,
+    1333058, 1333122, 1333186, 1333250, 1333314, 1333378, 1333442, 1333506,
+    1333570, 1333634, 1333698, 1333762, 1333826, 1333890, 1333954, 1334018,
+    1334082, 1334146, 1334210, 1334274, 1334338, 1334402, 1334466, 1334530,
+    1334594, 1334658, 1334722, 1334786, 1334850, 1334914, 1334978, 1335042,
+    1335106, 1335170, 1335234, 1335298, 1335362, 1335426, 1335490, 1335554,
+    1335618, 1335682, 1335746, 1335810, 1335874, 1335938, 1336002, 1336066,
+    1336130, 1336194, 1336258, 1336322, 1336386, 1336450, 1336514, 1336578,
+    1336642, 1336706, 1336770, 1336834, 1336898, 1336962, 1337026, 1337090,
+    1337154, 1337218, 1337282, 1337346, 1337410, 1337474, 1337538, 1337602,
+    1337666, 1337730, 1337794, 1337858, 1337922, 1337986, 1338050, 1338114,
+    1338178, 1338242, 1338306, 1338370, 1338434, 1338498, 1338562, 1338626,
+    1338690, 1338754, 1338818, 1338882, 1338946, 1339010, 1339074, 1339138,
+    1339202, 1339266, 1339330, 1339394, 1339458, 1339522, 1339586, 1339650,
+    1339714, 1339778, 1339842, 1339906, 1339970, 1340034, 1340098, 1340162,
+    1340226, 1340290, 1340354, 1340418, 1340482, 1340546, 1340610, 1340674,
+    1340738, 1340802, 1340866, 1340930, 1340994, 1341058, 1341122, 1341186,
+    1341250, 1341314, 1341378, 1341442, 1341506, 1341570, 1341634, 1341698,
+    1341762, 1341826, 1341890, 1341954, 1342018, 1342082, 1342146, 1342210,
+    1342274, 1342338, 1342402, 1342466, 1342530, 1342594, 1342658, 1342722,
+    1342786, 1342850, 1342914, 1342978, 1343042, 1343106, 1343170, 1343234,
+    1343298, 1343362, 1343426, 1343490, 1343554, 1343618, 1343682, 1343746,
+    1343810, 1343874, 1343938, 1344002, 1344066, 1344130, 1344194, 1344258,
+    1344322, 1344386, 1344450, 1344514, 1344578, 1344642, 1344706, 1344770,
+    1344834, 1344898, 1344962, 1345026, 1345090, 1345154, 1345218, 1345282,
+    1345346, 1345410, 1345474, 1345538, 1345602, 1345666, 1345730, 1345794,
+    1345858, 1345922, 1345986, 1346050, 1346114, 1346178, 1346242, 1346306,
+    1346370, 1346434, 1346498, 1346562, 1346626, 1346690, 1346754, 1346818,
+    1346882, 1346946, 1347010, 1347074, 1347138, 1347202, 1347266, 1347330,
+    1347394, 1347458, 1347522, 1347586, 1347650, 1347714, 1347778, 1347842,
+    1347906, 1347970, 1348034, 1348098, 1348162, 1348226, 1348290, 1348354,
+    1348418, 1348482, 1348546, 1348610, 1348674, 1348738, 1348802, 1348866,
+    1348930, 1348994, 1349058, 1349122, 1349186, 1349250, 1349314, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1349378, 1349442, 1349506, 1349570, 1349634, 1349698, 1349762, 1349826,
+    1349890, 1349954, 1350018, 1350082, 1350146, 1350210, 1350274, 1350338,
+    1350402, 1350466, 1350530, 1350594, 1350658, 1350722, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1350786, 1350850, 1350914, 1350978, 1351042, 1351106, 1351170, 1351234,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1351298, 1351362, 1351426, 1351490, 1351554, 1351618, 0, 0,
+    1351682, 0, 1351746, 1351810, 1351874, 1351938, 1352002, 1352066,
+    1352130, 1352194, 1352258, 1352322, 1352386, 1352450, 1352514, 1352578,
+    1352642, 1352706, 1352770, 1352834, 1352898, 1352962, 1353026, 1353090,
+    1353154, 1353218, 1353282, 1353346, 1353410, 1353474, 1353538, 1353602,
+    1353666, 1353730, 1353794, 1353858, 1353922, 1353986, 1354050, 1354114,
+    1354178, 1354242, 1354306, 1354370, 1354434, 1354498, 0, 1354562,
+    1354626, 0, 0, 0, 1354690, 0, 0, 1354754,
+    1354818, 1354882, 1354946, 1355010, 1355074, 1355138, 1355202, 1355266,
+    1355330, 1355394, 1355458, 1355522, 1355586, 1355650, 1355714, 1355778,
+    1355842, 1355906, 1355970, 1356034, 1356098, 1356162, 0, 1356226,
+    1474, 1538, 1602, 1356290, 1356354, 1356418, 1356482, 1356546,
+    1356610, 1356674, 1356738, 1356802, 1356866, 1356930, 1356994, 1357058,
+    1357122, 1357186, 1357250, 1357314, 1357378, 1357442, 1357506, 1357570,
+    1357634, 1357698, 1357762, 1357826, 1357890, 1357954, 1358018, 1358082,
+    1358146, 1474, 1538, 1602, 1666, 1730, 1358210, 1358274,
+    1358338, 1358402, 1358466, 1358530, 1358594, 1358658, 1358722, 1358786,
+    1358850, 1358914, 1358978, 1359042, 1359106, 1359170, 1359234, 1359298,
+    1359362, 1359426, 1359490, 1359554, 1359618, 1359682, 1359746, 1359810,
+    1359874, 1359938, 1360002, 1360066, 1360130, 1360194, 1360258, 0,
+    0, 0, 0, 0, 0, 0, 0, 1474,
+    1538, 1602, 1666, 1666, 1730, 1360322, 1360386, 1360450,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1360514, 1360578, 1360642, 1360706, 1360770, 1360834, 1360898, 1360962,
+    1361026, 1361090, 1361154, 1361218, 1361282, 1361346, 1361410, 1361474,
+    1361538, 1361602, 1361666, 0, 1361730, 1361794, 0, 0,
+    0, 0, 0, 1474, 1730, 1361858, 1361922, 1361986,
+    1362050, 1362114, 1362178, 1362242, 1362306, 1362370, 1362434, 1362498,
+    1362562, 1362626, 1362690, 1362754, 1362818, 1362882, 1362946, 1363010,
+    1363074, 1363138, 1363202, 1363266, 1363330, 1363394, 1474, 1363458,
+    1363522, 1363586, 1538, 1602, 0, 0, 0, 1363650,
+    1363714, 1363778, 1363842, 1363906, 1363970, 1364034, 1364098, 1364162,
+    1364226, 1364290, 1364354, 1364418, 1364482, 1364546, 1364610, 1364674,
+    1364738, 1364802, 1364866, 1364930, 1364994, 1365058, 1365122, 1365186,
+    1365250, 1365314, 0, 0, 0, 0, 0, 1365378,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1365444, 1365572, 1365700, 1365828, 1365956, 1366084, 1366212, 1366340,
+    1366468, 1366596, 1366724, 1366852, 1366980, 1367108, 1367236, 1367364,
+    1367492, 1367620, 1367748, 1367876, 1368004, 1368132, 1368260, 1368388,
+    1368516, 1368644, 1368772, 1368900, 1369028, 1369156, 1369282, 1369346,
+    1369410, 1369474, 1369538, 1369602, 1369666, 1369730, 1369794, 1369858,
+    1369922, 1369986, 1370050, 1370114, 1370178, 1370242, 1370306, 1370370,
+    1370436, 1370562, 1370626, 1370690, 1370754, 1370818, 1370882, 1370946,
+    0, 0, 0, 0, 1371010, 1371074, 1371138, 1371202,
+    1474, 1538, 1602, 1666, 1730, 1794, 1858, 1922,
+    1986, 1371266, 1371330, 1371394, 1371458, 1371522, 1371586, 1371650,
+    0, 0, 1371714, 1371778, 1371842, 1371906, 1371970, 1372034,
+    1372098, 1372162, 1372226, 1372290, 1372354, 1372418, 1372482, 1372546,
+    1372610, 1372674, 1372738, 1372802, 1372866, 1372930, 1372994, 1373058,
+    1373122, 1373186, 1373250, 1373314, 1373378, 1373442, 1373506, 1373570,
+    1373634, 1373698, 1373762, 1373826, 1373890, 1373954, 1374018, 1374082,
+    1374146, 1374210, 1374274, 1374338, 1374402, 1374466, 1374530, 1374594,
+    1374658, 1374722, 1374786, 1374850, 0, 1374914, 1374978, 0,
+    0, 0, 0, 0, 1375042, 68354, 150146, 150210,
+    1375106, 1375170, 1375234, 1375298, 0, 1375362, 1375426, 1375490,
+    0, 1375554, 1375618, 1375682, 1375746, 1375810, 1375874, 1375938,
+    1376002, 1376066, 1376130, 1376194, 1376258, 1376322, 1376386, 1376450,
+    1376514, 1376578, 1376642, 1376706, 1376770, 1376834, 1376898, 1376962,
+    1377026, 1377090, 1377154, 1377218, 1377282, 1377346, 0, 0,
+    1377410, 1377474, 1377538, 0, 0, 0, 0, 1377602,
+    1474, 1538, 1602, 1666, 1377666, 1377730, 1377794, 1377858,
+    1377922, 0, 0, 0, 0, 0, 0, 0,
+    1377986, 1378050, 1378114, 1378178, 1378242, 1378306, 1378370, 1378434,
+    1378498, 0, 0, 0, 0, 0, 0, 0,
+    1378562, 1378626, 1378690, 1378754, 1378818, 1378882, 1378946, 1379010,
+    1379074, 1379138, 1379202, 1379266, 1379330, 1379394, 1379458, 1379522,
+    1379586, 1379650, 1379714, 1379778, 1379842, 1379906, 1379970, 1380034,
+    1380098, 1380162, 1380226, 1380290, 1380354, 1474, 1380418, 1380482,
+    1380546, 1380610, 1380674, 1380738, 1380802, 1380866, 1380930, 1380994,
+    1381058, 1381122, 1381186, 1381250, 1381314, 1381378, 1381442, 1381506,
+    1381570, 1381634, 1381698, 1381762, 1381826, 1381890, 1381954, 1382018,
+    1382082, 1382146, 1382210, 1382274, 1382338, 1474, 1382402, 1382466,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1382530, 1382594, 1382658, 1382722, 1382786, 1382850, 1382914, 1382978,
+    1383044, 1383170, 1383234, 1383298, 1383362, 1383426, 1383490, 1383554,
+    1383618, 1383682, 1383746, 1383810, 1383874, 1383938, 1384002, 1384066,
+    1384130, 1384194, 1384258, 1384322, 1384386, 1384450, 1384514, 1384578,
+    1384642, 1384706, 1384770, 1384834, 1384898, 67970, 68354, 0,
+    0, 0, 0, 1474, 1730, 1384962, 1385026, 1385090,
+    1385154, 1385218, 1385282, 1385346, 1385410, 1385474, 1385538, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1385602, 1385666, 1385730, 1385794, 1385858, 1385922, 1385986, 1386050,
+    1386114, 1386178, 1386242, 1386306, 1386370, 1386434, 1386498, 1386562,
+    1386626, 1386690, 1386754, 1386818, 1386882, 1386946, 1387010, 1387074,
+    1387138, 1387202, 1387266, 1387330, 1387394, 1387458, 1387522, 1387586,
+    1387650, 1387714, 1387778, 1387842, 1387906, 1387970, 1388034, 1388098,
+    1388162, 1388226, 1388290, 1388354, 1388418, 1388482, 1388548, 1388674,
+    1388738, 1388802, 1388866, 1388930, 1388994, 1389058, 0, 0,
+    0, 1389122, 1389186, 1389250, 1389314, 1389378, 1389442, 1389506,
+    1389570, 1389634, 1389698, 1389762, 1389826, 1389890, 1389954, 1390018,
+    1390082, 1390146, 1390210, 1390274, 1390338, 1390402, 1390466, 1390530,
+    1390594, 1390658, 1390722, 1390786, 1390850, 1390914, 0, 0,
+    1474, 1538, 1602, 1666, 1390978, 1391042, 1391106, 1391170,
+    1391234, 1391298, 1391362, 1391426, 1391490, 1391554, 1391618, 1391682,
+    1391746, 1391810, 1391874, 1391938, 1392002, 1392066, 1392130, 1392194,
+    1392258, 1392322, 1392386, 0, 0, 0, 0, 0,
+    1474, 1538, 1602, 1666, 1392450, 1392514, 1392578, 1392642,
+    1392706, 1392770, 1392834, 1392898, 1392962, 1393026, 1393090, 1393154,
+    1393218, 1393282, 1393346, 1393410, 1393474, 1393538, 1393602, 1393666,
+    1393730, 1393794, 0, 0, 0, 0, 0, 0,
+    0, 1393858, 1393922, 1393986, 1394050, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1474, 1538, 1602, 1666, 1394114, 1394178, 1394242,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1394306, 1394372, 1394498, 1394562, 1394628, 1394754, 1394818, 1394882,
+    1394948, 1395074, 1395140, 1395266, 1395332, 1395458, 1395524, 1395650,
+    1395716, 1395842, 1395908, 1396034, 1396098, 1396164, 1396290, 1396356,
+    1396482, 1396548, 1396674, 1396740, 1396866, 1396932, 1397058, 1397124,
+    1397250, 1397314, 1397378, 1397442, 1397506, 1397572, 1397698, 1397764,
+    1397890, 1397956, 1398082, 1398148, 1398274, 1398338, 1398404, 1398530,
+    1398594, 1398658, 1398722, 1398788, 1398914, 1398980, 1399106, 1399172,
+    1399298, 1399364, 1399490, 1399556, 1399682, 1399746, 1399810, 1399874,
+    1399940, 1400066, 1400132, 1400258, 1400324, 1400450, 1400516, 1400642,
+    1400706, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1400770, 1400836, 1400962, 1401026, 1401090, 1401154, 1401218, 1401282,
+    1401346, 1401410, 1401476, 1401604, 1401730, 1401794, 1401858, 1401922,
+    1401986, 1402052, 1402178, 1402242, 1402306, 1402370, 1402434, 1402498,
+    1402562, 1402626, 1402690, 1402754, 1402820, 1402946, 1403012, 1403140,
+    1403266, 1403330, 1403394, 1403460, 1403586, 1403650, 1403714, 1403778,
+    1403842, 1403906, 1403970, 1404036, 1404162, 1404228, 1404354, 1404418,
+    1404482, 1404546, 1404610, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1404674, 1404740, 1404866, 1404930, 1404994, 1405058, 1405122, 1405186,
+    1405250, 1405314, 1405380, 1405508, 1405634, 1405698, 1405762, 1405826,
+    1405890, 1405956, 1406082, 1406146, 1406210, 1406274, 1406338, 1406402,
+    1406466, 1406530, 1406594, 1406658, 1406724, 1406850, 1406916, 1407044,
+    1407170, 1407234, 1407298, 1407364, 1407490, 1407554, 1407618, 1407682,
+    1407746, 1407810, 1407874, 1407940, 1408066, 1408132, 1408258, 1408322,
+    1408386, 1408450, 1408514, 0, 0, 0, 0, 0,
+    0, 0, 1474, 1730, 1408578, 1408642, 1408706, 1408770,
+    1408834, 1408898, 1408962, 1409026, 1409090, 1409154, 1409218, 1409282,
+    1409346, 1409410, 1409474, 1409538, 1409602, 1409666, 1409730, 1409794,
+    1409858, 1409922, 1409986, 1410050, 1410114, 1410178, 1410242, 1410306,
+    1410370, 1410434, 1410498, 1410562, 1410626, 1410690, 1410754, 1410818,
+    1410882, 1410946, 1411010, 1411074, 67970, 67970, 67970, 67970,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1474, 1538, 1602, 1666, 1730, 1794, 1858, 1922,
+    1986, 1411138, 1411202, 1411266, 1411330, 1411394, 1411458, 1411522,
+    1411586, 1411650, 1411714, 1411778, 1411842, 1411906, 1411970, 1412034,
+    1412098, 1412162, 1412226, 1412290, 1412354, 1412418, 1412482, 0,
+    1412546, 1412610, 1412674, 1412738, 1412802, 1412866, 1412930, 1412994,
+    1413058, 1413122, 1413186, 1413250, 1413314, 1413378, 1413442, 1413506,
+    1413570, 1413634, 1413698, 1413762, 1413826, 1413890, 1413954, 1414018,
+    1414082, 1414146, 1414210, 1414274, 1414338, 1414402, 1414466, 1414530,
+    1414594, 1414658, 1414722, 1414786, 1414850, 1414914, 1414978, 1415042,
+    1415106, 1415170, 0, 117250, 117186, 1415234, 0, 0,
+    1415298, 1415362, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1415426, 1415490, 1415554, 1415618, 1415682, 1415746, 1415810, 1415874,
+    1415938, 1416002, 1416066, 1416130, 1416194, 1416258, 1416322, 1416386,
+    1416452, 1416578, 1416642, 1416708, 1416834, 1416898, 1416962, 1417028,
+    1417154, 1417218, 1417282, 1417346, 1417412, 1474, 1538, 1602,
+    1666, 1730, 1417538, 1417602, 1417666, 1417730, 1417794, 1417860,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1417986, 1418050, 1418114, 1418178, 1418242, 1418306, 1418370, 1418434,
+    1418498, 1418562, 1418626, 1418690, 1418754, 1418818, 1418882, 1418946,
+    1419010, 1419074, 1419138, 1419202, 1419266, 1419332, 68354, 68354,
+    67970, 67970, 67970, 68354, 67970, 68354, 68354, 68354,
+    68354, 1474, 1419458, 1419522, 1419586, 1419650, 1419714, 1419778,
+    1419842, 1419906, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1419970, 1420034, 1420098, 1420162, 1420226, 1420290, 1420354, 1420418,
+    1420482, 1420546, 1420610, 1420674, 1420738, 1420802, 1420866, 1420930,
+    1420994, 1421058, 1421122, 1421186, 1421250, 1474, 1538, 1602,
+    1666, 1421314, 1421378, 1421442, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1421506, 1421570, 1421634, 1421698, 1421762, 1421826, 1421890, 1421954,
+    1422018, 1422082, 1422146, 1422210, 1422274, 1422338, 1422402, 1422466,
+    1422530, 1422594, 1422658, 1422722, 1422786, 1422850, 1422916, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    150082, 150146, 150210, 1423042, 1423106, 1423170, 1423234, 1423298,
+    1423362, 1423426, 1423490, 1423554, 1423618, 1423682, 1423746, 1423810,
+    1423874, 1423938, 1424002, 1424066, 1424130, 1424194, 1424258, 1424322,
+    1424386, 1424450, 1424514, 1424578, 1424642, 1424706, 1424770, 1424834,
+    1424898, 1424962, 1425026, 1425090, 1425154, 1425218, 1425282, 1425346,
+    1425410, 1425474, 1425538, 1425602, 1425666, 1425730, 1425794, 1425858,
+    1425922, 1425986, 1426050, 1426114, 1426178, 1426242, 1426306, 1426370,
+    1426434, 1426498, 1426562, 1426626, 1426690, 1426754, 1426818, 1426882,
+    1426946, 1427010, 1427074, 1427138, 1427202, 1427266, 1427330, 1427394,
+    1427458, 1427522, 1427586, 1427650, 1427714, 1427778, 0, 0,
+    0, 0, 1474, 1538, 1602, 1666, 1730, 1794,
+    1858, 1922, 1986, 1427842, 1427906, 1427970, 1428034, 1428098,
+    1428162, 1428226, 1428290, 1428354, 1428418, 1428482, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1428546,
+    150082, 150146, 150210, 1428610, 1428674, 1428738, 1428802, 1428866,
+    1428930, 1428994, 1429058, 1429122, 1429186, 1429250, 1429314, 1429378,
+    1429442, 1429506, 1429570, 1429634, 1429698, 1429762, 1429826, 1429890,
+    1429954, 1430018, 1430084, 1430210, 1430276, 1430402, 1430466, 1430530,
+    1430594, 1430658, 1430722, 1430786, 1430850, 1430914, 1430978, 1431042,
+    1431106, 1431170, 1431234, 1431300, 1431426, 1431490, 1431554, 1431618,
+    1431682, 1431746, 1431810, 1431874, 1431938, 1432002, 1432066, 1432130,
+    1432194, 1432258, 154050, 1432322, 1432386, 2, 1432450, 1432514,
+    1432578, 1432642, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0,
+    1432706, 1432770, 1432834, 1432898, 1432962, 1433026, 1433090, 1433154,
+    1433218, 1433282, 1433346, 1433410, 1433474, 1433538, 1433602, 1433666,
+    1433730, 1433794, 1433858, 1433922, 1433986, 1434050, 1434114, 1434178,
+    1434242, 0, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    150082, 150146, 150210, 1434306, 1434370, 1434434, 1434498, 1434562,
+    1434626, 1434690, 1434754, 1434818, 1434882, 1434946, 1435010, 1435074,
+    1435138, 1435202, 1435266, 1435330, 1435394, 1435458, 1435522, 1435586,
+    1435650, 1435714, 1435778, 1435842, 1435906, 1435970, 1436034, 1436098,
+    1436162, 1436226, 1436290, 1436354, 1436418, 1436482, 1436546, 1436610,
+    1436674, 1436738, 1436802, 1436866, 1436930, 1436994, 1437058, 1437122,
+    1437186, 1437251, 1437315, 1437378, 1437442, 0, 1410, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    1437506, 1437570, 1437634, 1437698, 1437762, 1437826, 1437890, 1437954,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1438018, 1438082, 1438146, 1438210, 1438274, 1438338, 1438402, 1438466,
+    1438530, 1438594, 1438658, 1438722, 1438786, 1438850, 1438914, 1438978,
+    1439042, 1439106, 1439170, 1439234, 1439298, 1439362, 1439426, 1439490,
+    1439554, 1439618, 1439682, 1439746, 1439810, 1439874, 1439938, 1440002,
+    1440066, 1440130, 1440194, 154050, 1440258, 1440322, 1440386, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    150082, 150146, 150210, 1440450, 1440514, 1440578, 1440642, 1440706,
+    1440770, 1440834, 1440898, 1440962, 1441026, 1441090, 1441154, 1441218,
+    1441282, 1441346, 1441410, 1441474, 1441538, 1441602, 1441666, 1441730,
+    1441794, 1441858, 1441922, 1441986, 1442050, 1442114, 1442178, 1442242,
+    1442306, 1442370, 1442434, 1442498, 1442562, 1442626, 1442690, 1442754,
+    1442818, 1442882, 1442946, 1443010, 1443074, 1443138, 1443202, 1443266,
+    1443330, 1443394, 1443458, 1443522, 1443586, 1443650, 1443714, 1443778,
+    1443842, 1443906, 1443970, 1444034, 1444098, 1444162, 1444226, 1444290,
+    1444354, 1444418, 1444482, 1444546, 1444610, 1444674, 1444738, 1444802,
+    1444866, 163458, 154050, 1444930, 1444994, 1445058, 1445122, 150082,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1445186, 1445250, 1445314, 1445378, 1445442, 1445506,
+    0, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1445570, 1445634, 1445698, 1445762, 1445826, 1445890,
+    1445954, 1446018, 1446082, 1446146, 1446210, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1446274, 1446338, 1446402, 1446466, 1446530, 1446594, 1446658, 1446722,
+    1446786, 1446850, 1446914, 1446978, 1447042, 1447106, 1447170, 1447234,
+    1447298, 1447362, 0, 1447426, 1447490, 1447554, 1447618, 1447682,
+    1447746, 1447810, 1447874, 1447938, 1448002, 1448066, 1448130, 1448194,
+    1448258, 1448322, 1448386, 1448450, 1448514, 1448578, 1448642, 1448706,
+    1448770, 1448834, 1448898, 1448962, 1449026, 1449090, 1449154, 1449218,
+    1449282, 1449346, 1449410, 1449474, 150146, 1449538, 154050, 117058,
+    1449602, 1449666, 1449730, 1449794, 1449858, 1449922, 117122, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1449986, 1450050, 1450114, 1450178, 1450242, 1450306, 1450370, 0,
+    1450434, 0, 1450498, 1450562, 1450626, 1450690, 0, 1450754,
+    1450818, 1450882, 1450946, 1451010, 1451074, 1451138, 1451202, 1451266,
+    1451330, 1451394, 1451458, 1451522, 1451586, 1451650, 0, 1451714,
+    1451778, 1451842, 1451906, 1451970, 1452034, 1452098, 1452162, 1452226,
+    1452290, 1452354, 0, 0, 0, 0, 0, 0,
+    1452418, 1452482, 1452546, 1452610, 1452674, 1452738, 1452802, 1452866,
+    1452930, 1452994, 1453058, 1453122, 1453186, 1453250, 1453314, 1453378,
+    1453442, 1453506, 1453570, 1453634, 1453698, 1453762, 1453826, 1453890,
+    1453954, 1454018, 1454082, 1454146, 1454210, 1454274, 1454338, 1454402,
+    1454466, 1454530, 1454594, 1454658, 1454722, 1454786, 1454850, 1454914,
+    1454978, 1455042, 1455106, 1455170, 1455234, 1455298, 1455362, 150146,
+    1455426, 1455490, 1455554, 1455618, 1455682, 1455746, 1455810, 1455874,
+    1455938, 154050, 1456002, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    150146, 150082, 150146, 150210, 0, 1456066, 1456130, 1456194,
+    1456258, 1456322, 1456386, 1456450, 1456514, 0, 0, 1456578,
+    1456642, 0, 0, 1456706, 1456770, 1456834, 1456898, 1456962,
+    1457026, 1457090, 1457154, 1457218, 1457282, 1457346, 1457410, 1457474,
+    1457538, 1457602, 1457666, 1457730, 1457794, 1457858, 1457922, 1457986,
+    1458050, 0, 1458114, 1458178, 1458242, 1458306, 1458370, 1458434,
+    1458498, 0, 1458562, 1458626, 0, 1458690, 1458754, 1458818,
+    1458882, 1458946, 0, 154050, 154050, 1459010, 1459074, 1459138,
+    1459202, 1459266, 1459330, 1459394, 1459458, 0, 0, 1459523,
+    1459586, 0, 0, 1459650, 1459714, 1459778, 0, 0,
+    1459842, 0, 0, 0, 0, 0, 0, 1459906,
+    0, 0, 0, 0, 0, 1459970, 1460034, 1460098,
+    1460162, 1460226, 1460290, 1460354, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 0, 0, 0,
+    2, 2, 2, 2, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1460418, 1460482, 1460546, 1460610, 1460674, 1460738, 1460802, 1460866,
+    1460930, 1460994, 1461058, 1461122, 1461186, 1461250, 1461314, 1461378,
+    1461442, 1461506, 1461570, 1461634, 1461698, 1461762, 1461826, 1461890,
+    1461954, 1462018, 1462082, 1462146, 1462210, 1462274, 1462338, 1462402,
+    1462466, 1462530, 1462594, 1462658, 1462722, 1462786, 1462850, 1462914,
+    1462978, 1463042, 1463106, 1463170, 1463234, 1463298, 1463362, 1463426,
+    1463490, 1463554, 1463618, 1463682, 1463746, 1463810, 1463874, 1463938,
+    1464002, 1464066, 1464130, 1464194, 1464258, 1464322, 1464386, 1464450,
+    1464514, 1464578, 1464642, 150082, 150146, 150210, 154050, 1464706,
+    1464770, 1464834, 1464898, 1464962, 1465026, 1465090, 1465154, 1465218,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1465282, 1465346, 0, 1465410, 163458, 1465474,
+    1465538, 1465602, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1465666, 1465730, 1465794, 1465858, 1465922, 1465986, 1466050, 1466114,
+    1466178, 1466242, 1466306, 1466370, 1466434, 1466498, 1466562, 1466626,
+    1466690, 1466754, 1466818, 1466882, 1466946, 1467010, 1467074, 1467138,
+    1467202, 1467266, 1467330, 1467394, 1467458, 1467522, 1467586, 1467650,
+    1467714, 1467778, 1467842, 1467906, 1467970, 1468034, 1468098, 1468162,
+    1468226, 1468290, 1468354, 1468418, 1468482, 1468546, 1468610, 1468674,
+    1468738, 1468802, 1468866, 1468930, 1468994, 1469058, 1469122, 1469186,
+    1469250, 1469315, 1469378, 1469442, 1469506, 1469570, 1469634, 150082,
+    150146, 150210, 1469698, 154050, 1469762, 1469826, 1469890, 1469954,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1470018, 1470082, 1470146, 1470210, 1470274, 1470338, 1470402, 1470466,
+    1470530, 1470594, 1470658, 1470722, 1470786, 1470850, 1470914, 1470978,
+    1471042, 1471106, 1471170, 1471234, 1471298, 1471362, 1471426, 1471490,
+    1471554, 1471618, 1471682, 1471746, 1471810, 1471874, 1471938, 1472002,
+    1472066, 1472130, 1472194, 1472258, 1472322, 1472386, 1472450, 1472514,
+    1472578, 1472642, 1472706, 1472770, 1472834, 1472898, 1472962, 1473026,
+    1473090, 1473154, 1473218, 1473282, 1473346, 1473410, 0, 0,
+    1473475, 1473539, 1473602, 1473666, 150082, 150146, 150210, 1473730,
+    154050, 1473794, 1473858, 1473922, 1473986, 1474050, 1474114, 1474178,
+    1474242, 1474306, 1474370, 1474434, 1474498, 1474562, 1474626, 1474690,
+    1474754, 1474818, 1474882, 1474946, 1475010, 1475074, 1475138, 1475202,
+    1475268, 1475396, 1475524, 1475652, 1475780, 1475908, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1476034, 1476098, 1476162, 1476226, 1476290, 1476354, 1476418, 1476482,
+    1476546, 1476610, 1476674, 1476738, 1476802, 1476866, 1476930, 1476994,
+    1477058, 1477122, 1477186, 1477250, 1477314, 1477378, 1477442, 1477506,
+    1477570, 1477634, 1477698, 1477762, 1477826, 1477890, 1477954, 1478018,
+    1478082, 1478146, 1478210, 1478274, 1478338, 1478402, 1478466, 1478530,
+    1478594, 1478658, 1478722, 1478786, 1478850, 1478914, 1478978, 1479042,
+    1479106, 1479170, 1479234, 1479298, 1479362, 1479426, 1479490, 1479554,
+    1479618, 1479682, 1479746, 1479810, 1479874, 150146, 150210, 1479938,
+    150082, 1480002, 1480066, 1480130, 1480194, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    1480258, 1480322, 1480386, 1480450, 1480514, 1480578, 1480642, 1480706,
+    1480770, 1480834, 1480898, 1480962, 1481026, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1481090, 1481154, 1481218, 1481282, 1481346, 1481410, 1481474, 1481538,
+    1481602, 1481666, 1481730, 1481794, 1481858, 1481922, 1481986, 1482050,
+    1482114, 1482178, 1482242, 1482306, 1482370, 1482434, 1482498, 1482562,
+    1482626, 1482690, 1482754, 1482818, 1482882, 1482946, 1483010, 1483074,
+    1483138, 1483202, 1483266, 1483330, 1483394, 1483458, 1483522, 1483586,
+    1483650, 1483714, 1483778, 150146, 150210, 1483842, 1483906, 1483970,
+    1484034, 1484098, 1484162, 1484226, 1484290, 1484354, 1484418, 154050,
+    1484482, 0, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1484546, 1484610, 1484674, 1484738, 1484802, 1484868, 1484994, 1485058,
+    1485122, 1485186, 1485250, 1485314, 1485378, 1485442, 1485506, 1485570,
+    1485634, 1485698, 1485762, 1485826, 1485890, 1485954, 1486020, 1486146,
+    1486210, 1486274, 1486340, 0, 0, 1486466, 1486530, 1486594,
+    1486658, 1486722, 1486786, 1486850, 1486914, 1486978, 1487042, 1487106,
+    1487170, 1487234, 1487298, 1487362, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1487426, 1487490, 1487554, 1487618, 1487682, 1487746,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1487810, 1487874, 1487938, 1488002, 1488066, 1488130, 1488194, 1488258,
+    1488322, 1488386, 1488450, 1488514, 1488578, 1488642, 1488706, 1488770,
+    1488834, 1488898, 1488962, 1489026, 1489090, 1489154, 1489218, 1489282,
+    1489346, 1489410, 1489474, 1489538, 1489602, 1489666, 1489730, 1489794,
+    1489858, 1489922, 1489986, 1490050, 1490114, 1490178, 1490242, 1490306,
+    1490370, 1490434, 1490498, 1490562, 1490626, 1490690, 1490754, 1490818,
+    1490882, 1490946, 1491010, 1491074, 1491138, 1491202, 1491266, 150146,
+    150210, 1491330, 154050, 1491394, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1491458, 1491522, 1491586, 1491650, 1491714, 1491778, 1491842, 1491906,
+    1491970, 1492034, 1492098, 1492162, 1492226, 1492290, 1492354, 1492418,
+    1492482, 1492546, 1492610, 1492674, 1492738, 1492802, 1492866, 1492930,
+    1492994, 1493058, 1493122, 1493186, 1493250, 1493314, 1493378, 1493442,
+    1493506, 1493570, 1493634, 1493698, 1493762, 1493826, 1493890, 1493954,
+    1494018, 1494082, 1494146, 1494210, 1494274, 1494338, 1494402, 1494466,
+    1494530, 1494594, 1494658, 1494722, 1494786, 1494850, 1494914, 1494978,
+    1495042, 1495106, 1495170, 1495234, 1495298, 1495362, 1495426, 1495490,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1495554, 1495618, 1495682, 1495746, 1495810, 1495874,
+    1495938, 1496002, 1496066, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1496130,
+    1496194, 1496258, 1496322, 1496386, 1496450, 1496514, 1496578, 0,
+    0, 1496642, 0, 0, 1496706, 1496770, 1496834, 1496898,
+    1496962, 1497026, 1497090, 1497154, 0, 1497218, 1497282, 0,
+    1497346, 1497410, 1497474, 1497538, 1497602, 1497666, 1497730, 1497794,
+    1497858, 1497922, 1497986, 1498050, 1498114, 1498178, 1498242, 1498306,
+    1498370, 1498434, 1498498, 1498562, 1498626, 1498690, 1498754, 1498818,
+    1498882, 1498946, 1499010, 1499074, 1499138, 1499203, 0, 1499266,
+    1499330, 0, 0, 150146, 150082, 1499394, 1499458, 1499522,
+    1499586, 1499650, 1499714, 154050, 1499778, 1499842, 1499906, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1499970, 1500034, 1500098, 1500162, 1500226, 1500290, 1500354, 1500418,
+    0, 0, 1500482, 1500546, 1500610, 1500674, 1500738, 1500802,
+    1500866, 1500930, 1500994, 1501058, 1501122, 1501186, 1501250, 1501314,
+    1501378, 1501442, 1501506, 1501570, 1501634, 1501698, 1501762, 1501826,
+    1501890, 1501954, 1502018, 1502082, 1502146, 1502210, 1502274, 1502338,
+    1502402, 1502466, 1502530, 1502594, 1502658, 1502722, 1502786, 1502850,
+    1502914, 1502978, 1503042, 1503106, 1503170, 1503234, 1503298, 1503362,
+    0, 0, 1503426, 1503490, 1503554, 1503618, 150146, 150210,
+    1503682, 1503746, 1503810, 1503874, 1503938, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1504002, 1504066, 1504130, 1504194, 1504258, 1504322, 1504386, 1504450,
+    1504514, 1504578, 1504642, 1504706, 1504770, 1504834, 1504898, 1504962,
+    1505026, 1505090, 1505154, 1505218, 1505282, 1505346, 1505410, 1505474,
+    1505538, 1505602, 1505666, 1505730, 1505794, 1505858, 1505922, 1505986,
+    1506050, 1506114, 1506178, 1506242, 1506306, 1506370, 1506434, 1506498,
+    1506562, 1506626, 1506690, 1506754, 1506818, 1506882, 1506946, 1507010,
+    1507074, 1507138, 1507202, 154050, 1507266, 150082, 150082, 150082,
+    150146, 150210, 1507330, 1507394, 1507458, 1507522, 1507586, 1507650,
+    1507714, 1507778, 1507842, 1507906, 1507970, 1508034, 1508098, 1508162,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1508226, 1508290, 1508354, 1508418, 1508482, 1508546, 1508610, 1508674,
+    1508738, 1508802, 1508866, 1508930, 1508994, 1509058, 1509122, 1509186,
+    1509250, 1509314, 1509378, 1509442, 1509506, 1509570, 1509634, 1509698,
+    1509762, 1509826, 1509890, 1509954, 1510018, 1510082, 1510146, 1510210,
+    1510274, 1510338, 1510402, 1510466, 1510530, 1510594, 1510658, 1510722,
+    1510786, 1510850, 1510914, 1510978, 1511042, 1511106, 1511170, 1511234,
+    1511298, 1511362, 1511426, 1511490, 1511554, 1511618, 1511682, 1511746,
+    1511810, 1511874, 1511938, 1512002, 1512066, 1512130, 1512194, 1512258,
+    1512322, 1512386, 1512450, 1512514, 1512578, 1512642, 150146, 150210,
+    1512706, 1512770, 1512834, 1512898, 1512962, 1513026, 1513090, 1513154,
+    1513218, 1513282, 1513346, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1513410, 1513474, 1513538, 1513602, 1513666, 1513730, 1513794, 1513858,
+    1513922, 1513986, 1514050, 1514114, 1514178, 1514242, 1514306, 1514370,
+    1514434, 1514498, 1514562, 1514626, 1514690, 1514754, 1514818, 1514882,
+    1514946, 1515010, 1515074, 1515138, 1515202, 1515266, 1515330, 1515394,
+    1515458, 1515522, 1515586, 1515650, 1515714, 1515778, 1515842, 1515906,
+    1515970, 1516034, 1516098, 1516162, 1516226, 1516290, 1516354, 1516418,
+    1516482, 1516546, 1516610, 1516674, 1516738, 1516802, 1516866, 1516930,
+    1516994, 0, 0, 0, 0, 0, 0, 0,
+    1517058, 1517122, 1517186, 1517250, 1517314, 1517378, 1517442, 1517506,
+    1517570, 0, 1517634, 1517698, 1517762, 1517826, 1517890, 1517954,
+    1518018, 1518082, 1518146, 1518210, 1518274, 1518338, 1518402, 1518466,
+    1518530, 1518594, 1518658, 1518722, 1518786, 1518850, 1518914, 1518978,
+    1519042, 1519106, 1519170, 1519234, 1519298, 1519362, 1519426, 1519490,
+    1519554, 1519618, 1519682, 1519746, 1519810, 1519874, 1519938, 1520002,
+    1520066, 1520130, 1520194, 1520258, 1520322, 1520386, 1520450, 0,
+    1520514, 1520578, 1520642, 1520706, 150082, 150146, 150210, 1520770,
+    1520834, 1520898, 1520962, 1521026, 1521090, 1521154, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1474, 1538, 1602, 1666, 1730, 1794,
+    1858, 1922, 1986, 1521218, 1521282, 1521346, 1521410, 1521474,
+    1521538, 1521602, 1521666, 1521730, 1521794, 0, 0, 0,
+    1521858, 1521922, 1521986, 1522050, 1522114, 1522178, 1522242, 1522306,
+    1522370, 1522434, 1522498, 1522562, 1522626, 1522690, 1522754, 1522818,
+    1522882, 1522946, 1523010, 1523074, 1523138, 1523202, 1523266, 1523330,
+    1523394, 1523458, 1523522, 1523586, 1523650, 1523714, 1523778, 1523842,
+    0, 0, 1523906, 1523970, 1524034, 1524098, 1524162, 1524226,
+    1524290, 1524354, 1524418, 1524482, 1524546, 1524610, 1524674, 1524738,
+    1524802, 1524866, 1524930, 1524994, 1525058, 1525122, 1525186, 1525250,
+    0, 1525314, 1525378, 1525442, 1525506, 1525570, 1525634, 1525698,
+    1525762, 1525826, 1525890, 1525954, 1526018, 150146, 150082, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1526082, 1526146, 1526210, 1526274, 1526338, 1526402, 1526466, 0,
+    1526530, 1526594, 0, 1526658, 1526722, 1526786, 1526850, 1526914,
+    1526978, 1527042, 1527106, 1527170, 1527234, 1527298, 1527362, 1527426,
+    1527490, 1527554, 1527618, 1527682, 1527746, 1527810, 1527874, 1527938,
+    1528002, 1528066, 1528130, 1528194, 1528258, 1528322, 1528386, 1528450,
+    1528514, 1528578, 1528642, 1528706, 1528770, 1528834, 1528898, 1528962,
+    1529026, 1529090, 1529154, 1529218, 1529282, 1529346, 1529410, 0,
+    0, 0, 1529474, 0, 1529538, 1529602, 0, 1529666,
+    150146, 150210, 154050, 150082, 1529730, 1529794, 1529858, 1529922,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    1529986, 1530050, 1530114, 1530178, 1530242, 1530306, 0, 1530370,
+    1530434, 0, 1530498, 1530562, 1530626, 1530690, 1530754, 1530818,
+    1530882, 1530946, 1531010, 1531074, 1531138, 1531202, 1531266, 1531330,
+    1531394, 1531458, 1531522, 1531586, 1531650, 1531714, 1531778, 1531842,
+    1531906, 1531970, 1532034, 1532098, 1532162, 1532226, 1532290, 1532354,
+    1532418, 1532482, 1532546, 1532610, 1532674, 1532738, 1532802, 0,
+    1532866, 1532930, 0, 1532994, 1533058, 150146, 150210, 1533122,
+    1533186, 0, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1533250, 1533314, 1533378, 1533442, 1533506, 1533570, 1533634, 1533698,
+    1533762, 1533826, 1533890, 1533954, 1534018, 1534082, 1534146, 1534210,
+    1534274, 1534338, 1534402, 1534466, 1534530, 1534594, 1534658, 1534722,
+    1534786, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1534850, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1534914, 1534978, 1535042, 1535106, 1535170, 1535234, 1535298, 1535362,
+    1535426, 1535490, 1535554, 1535618, 1535682, 1535746, 1535810, 1535874,
+    1535938, 1536002, 1536066, 1536130, 1536194, 1536258, 1536322, 1536386,
+    1536450, 1536514, 1536578, 1536642, 1536706, 1536770, 1536834, 1536898,
+    1536962, 1537026, 1537090, 1537154, 1537218, 1537282, 1537346, 1537410,
+    1537474, 1537538, 1537602, 1537666, 1537730, 1537794, 1537858, 1537922,
+    1537986, 1538050, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1538114,
+    1538178, 1538242, 1538306, 1538370, 1538434, 1538498, 1538562, 1538626,
+    1538690, 1538754, 1538818, 1538882, 1538946, 1539010, 1539074, 1539138,
+    1539202, 1539266, 1539330, 1539394, 1539458, 1539522, 1539586, 1539650,
+    1539714, 1539778, 1539842, 1539906, 1539970, 1540034, 1540098, 1540162,
+    1540226, 1540290, 1540354, 1540418, 1540482, 1540546, 1540610, 1540674,
+    1540738, 1540802, 1540866, 1540930, 1540994, 1541058, 1541122, 1541186,
+    1541250, 1541314, 1541378, 1541442, 1541506, 1541570, 1541634, 1541698,
+    1541762, 1541826, 1541890, 1541954, 1542018, 1542082, 1542146, 1542210,
+    1542274, 1542338, 1542402, 1542466, 1542530, 1542594, 1542658, 1542722,
+    1542786, 1542850, 1542914, 1542978, 1543042, 1543106, 1543170, 1543234,
+    1543298, 1543362, 1543426, 1543490, 1543554, 1543618, 1543682, 1543746,
+    1543810, 1543874, 1543938, 1544002, 1544066, 1544130, 1544194, 1544258,
+    1544322, 1544386, 1544450, 1544514, 1544578, 1544642, 1544706, 1544770,
+    1544834, 1544898, 1544962, 1545026, 1545090, 1545154, 1545218, 1545282,
+    1545346, 1545410, 1545474, 1545538, 1545602, 1545666, 1545730, 1545794,
+    1545858, 1545922, 1545986, 1546050, 1546114, 1546178, 1546242, 1546306,
+    1546370, 1546434, 1546498, 1546562, 1546626, 1546690, 1546754, 1546818,
+    1546882, 1546946, 1547010, 1547074, 1547138, 1547202, 1547266, 1547330,
+    1547394, 1547458, 1547522, 1547586, 1547650, 1547714, 1547778, 1547842,
+    1547906, 1547970, 1548034, 1548098, 1548162, 1548226, 1548290, 1548354,
+    1548418, 1548482, 1548546, 1548610, 1548674, 1548738, 1548802, 1548866,
+    1548930, 1548994, 1549058, 1549122, 1549186, 1549250, 1549314, 1549378,
+    1549442, 1549506, 1549570, 1549634, 1549698, 1549762, 1549826, 1549890,
+    1549954, 1550018, 1550082, 1550146, 1550210, 1550274, 1550338, 1550402,
+    1550466, 1550530, 1550594, 1550658, 1550722, 1550786, 1550850, 1550914,
+    1550978, 1551042, 1551106, 1551170, 1551234, 1551298, 1551362, 1551426,
+    1551490, 1551554, 1551618, 1551682, 1551746, 1551810, 1551874, 1551938,
+    1552002, 1552066, 1552130, 1552194, 1552258, 1552322, 1552386, 1552450,
+    1552514, 1552578, 1552642, 1552706, 1552770, 1552834, 1552898, 1552962,
+    1553026, 1553090, 1553154, 1553218, 1553282, 1553346, 1553410, 1553474,
+    1553538, 1553602, 1553666, 1553730, 1553794, 1553858, 1553922, 1553986,
+    1554050, 1554114, 1554178, 1554242, 1554306, 1554370, 1554434, 1554498,
+    1554562, 1554626, 1554690, 1554754, 1554818, 1554882, 1554946, 1555010,
+    1555074, 1555138, 1555202, 1555266, 1555330, 1555394, 1555458, 1555522,
+    1555586, 1555650, 1555714, 1555778, 1555842, 1555906, 1555970, 1556034,
+    1556098, 1556162, 1556226, 1556290, 1556354, 1556418, 1556482, 1556546,
+    1556610, 1556674, 1556738, 1556802, 1556866, 1556930, 1556994, 1557058,
+    1557122, 1557186, 1557250, 1557314, 1557378, 1557442, 1557506, 1557570,
+    1557634, 1557698, 1557762, 1557826, 1557890, 1557954, 1558018, 1558082,
+    1558146, 1558210, 1558274, 1558338, 1558402, 1558466, 1558530, 1558594,
+    1558658, 1558722, 1558786, 1558850, 1558914, 1558978, 1559042, 1559106,
+    1559170, 1559234, 1559298, 1559362, 1559426, 1559490, 1559554, 1559618,
+    1559682, 1559746, 1559810, 1559874, 1559938, 1560002, 1560066, 1560130,
+    1560194, 1560258, 1560322, 1560386, 1560450, 1560514, 1560578, 1560642,
+    1560706, 1560770, 1560834, 1560898, 1560962, 1561026, 1561090, 1561154,
+    1561218, 1561282, 1561346, 1561410, 1561474, 1561538, 1561602, 1561666,
+    1561730, 1561794, 1561858, 1561922, 1561986, 1562050, 1562114, 1562178,
+    1562242, 1562306, 1562370, 1562434, 1562498, 1562562, 1562626, 1562690,
+    1562754, 1562818, 1562882, 1562946, 1563010, 1563074, 1563138, 1563202,
+    1563266, 1563330, 1563394, 1563458, 1563522, 1563586, 1563650, 1563714,
+    1563778, 1563842, 1563906, 1563970, 1564034, 1564098, 1564162, 1564226,
+    1564290, 1564354, 1564418, 1564482, 1564546, 1564610, 1564674, 1564738,
+    1564802, 1564866, 1564930, 1564994, 1565058, 1565122, 1565186, 1565250,
+    1565314, 1565378, 1565442, 1565506, 1565570, 1565634, 1565698, 1565762,
+    1565826, 1565890, 1565954, 1566018, 1566082, 1566146, 1566210, 1566274,
+    1566338, 1566402, 1566466, 1566530, 1566594, 1566658, 1566722, 1566786,
+    1566850, 1566914, 1566978, 1567042, 1567106, 1567170, 1567234, 1567298,
+    1567362, 1567426, 1567490, 1567554, 1567618, 1567682, 1567746, 1567810,
+    1567874, 1567938, 1568002, 1568066, 1568130, 1568194, 1568258, 1568322,
+    1568386, 1568450, 1568514, 1568578, 1568642, 1568706, 1568770, 1568834,
+    1568898, 1568962, 1569026, 1569090, 1569154, 1569218, 1569282, 1569346,
+    1569410, 1569474, 1569538, 1569602, 1569666, 1569730, 1569794, 1569858,
+    1569922, 1569986, 1570050, 1570114, 1570178, 1570242, 1570306, 1570370,
+    1570434, 1570498, 1570562, 1570626, 1570690, 1570754, 1570818, 1570882,
+    1570946, 1571010, 1571074, 1571138, 1571202, 1571266, 1571330, 1571394,
+    1571458, 1571522, 1571586, 1571650, 1571714, 1571778, 1571842, 1571906,
+    1571970, 1572034, 1572098, 1572162, 1572226, 1572290, 1572354, 1572418,
+    1572482, 1572546, 1572610, 1572674, 1572738, 1572802, 1572866, 1572930,
+    1572994, 1573058, 1573122, 1573186, 1573250, 1573314, 1573378, 1573442,
+    1573506, 1573570, 1573634, 1573698, 1573762, 1573826, 1573890, 1573954,
+    1574018, 1574082, 1574146, 1574210, 1574274, 1574338, 1574402, 1574466,
+    1574530, 1574594, 1574658, 1574722, 1574786, 1574850, 1574914, 1574978,
+    1575042, 1575106, 1575170, 1575234, 1575298, 1575362, 1575426, 1575490,
+    1575554, 1575618, 1575682, 1575746, 1575810, 1575874, 1575938, 1576002,
+    1576066, 1576130, 1576194, 1576258, 1576322, 1576386, 1576450, 1576514,
+    1576578, 1576642, 1576706, 1576770, 1576834, 1576898, 1576962, 1577026,
+    1577090, 1577154, 1577218, 1577282, 1577346, 1577410, 1577474, 1577538,
+    1577602, 1577666, 1577730, 1577794, 1577858, 1577922, 1577986, 1578050,
+    1578114, 1578178, 1578242, 1578306, 1578370, 1578434, 1578498, 1578562,
+    1578626, 1578690, 1578754, 1578818, 1578882, 1578946, 1579010, 1579074,
+    1579138, 1579202, 1579266, 1579330, 1579394, 1579458, 1579522, 1579586,
+    1579650, 1579714, 1579778, 1579842, 1579906, 1579970, 1580034, 1580098,
+    1580162, 1580226, 1580290, 1580354, 1580418, 1580482, 1580546, 1580610,
+    1580674, 1580738, 1580802, 1580866, 1580930, 1580994, 1581058, 1581122,
+    1581186, 1581250, 1581314, 1581378, 1581442, 1581506, 1581570, 1581634,
+    1581698, 1581762, 1581826, 1581890, 1581954, 1582018, 1582082, 1582146,
+    1582210, 1582274, 1582338, 1582402, 1582466, 1582530, 1582594, 1582658,
+    1582722, 1582786, 1582850, 1582914, 1582978, 1583042, 1583106, 1583170,
+    1583234, 1583298, 1583362, 1583426, 1583490, 1583554, 1583618, 1583682,
+    1583746, 1583810, 1583874, 1583938, 1584002, 1584066, 1584130, 1584194,
+    1584258, 1584322, 1584386, 1584450, 1584514, 1584578, 1584642, 1584706,
+    1584770, 1584834, 1584898, 1584962, 1585026, 1585090, 1585154, 1585218,
+    1585282, 1585346, 1585410, 1585474, 1585538, 1585602, 1585666, 1585730,
+    1585794, 1585858, 1585922, 1585986, 1586050, 1586114, 1586178, 1586242,
+    1586306, 1586370, 1586434, 1586498, 1586562, 1586626, 1586690, 1586754,
+    1586818, 1586882, 1586946, 1587010, 1587074, 1587138, 1587202, 1587266,
+    1587330, 1587394, 1587458, 1587522, 1587586, 1587650, 1587714, 1587778,
+    1587842, 1587906, 1587970, 1588034, 1588098, 1588162, 1588226, 1588290,
+    1588354, 1588418, 1588482, 1588546, 1588610, 1588674, 1588738, 1588802,
+    1588866, 1588930, 1588994, 1589058, 1589122, 1589186, 1589250, 1589314,
+    1589378, 1589442, 1589506, 1589570, 1589634, 1589698, 1589762, 1589826,
+    1589890, 1589954, 1590018, 1590082, 1590146, 1590210, 1590274, 1590338,
+    1590402, 1590466, 1590530, 1590594, 1590658, 1590722, 1590786, 1590850,
+    1590914, 1590978, 1591042, 1591106, 1591170, 1591234, 1591298, 1591362,
+    1591426, 1591490, 1591554, 1591618, 1591682, 1591746, 1591810, 1591874,
+    1591938, 1592002, 1592066, 1592130, 1592194, 1592258, 1592322, 1592386,
+    1592450, 1592514, 1592578, 1592642, 1592706, 1592770, 1592834, 1592898,
+    1592962, 1593026, 1593090, 1593154, 1593218, 1593282, 1593346, 1593410,
+    1593474, 1593538, 1593602, 1593666, 1593730, 1593794, 1593858, 1593922,
+    1593986, 1594050, 1594114, 1594178, 1594242, 1594306, 1594370, 1594434,
+    1594498, 1594562, 1594626, 1594690, 1594754, 1594818, 1594882, 1594946,
+    1595010, 1595074, 1595138, 1595202, 1595266, 1595330, 1595394, 1595458,
+    1595522, 1595586, 1595650, 1595714, 1595778, 1595842, 1595906, 1595970,
+    1596034, 1596098, 1596162, 1596226, 1596290, 1596354, 1596418, 1596482,
+    1596546, 1596610, 1596674, 1596738, 1596802, 1596866, 1596930, 1596994,
+    1597058, 1597122, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    1602, 1666, 1730, 1794, 1858, 1922, 1986, 1666,
+    1730, 1794, 1858, 1922, 1986, 1474, 1538, 1602,
+    1666, 1730, 1794, 1858, 1922, 1986, 1474, 1538,
+    1602, 1666, 1730, 1538, 1602, 1602, 1666, 1730,
+    1794, 1858, 1922, 1986, 1474, 1538, 1602, 1602,
+    1666, 1730, 1597186, 1597250, 1474, 1538, 1602, 1602,
+    1666, 1730, 1602, 1602, 1666, 1666, 1666, 1666,
+    1794, 1858, 1858, 1858, 1922, 1922, 1986, 1986,
+    1986, 1986, 1538, 1602, 1666, 1730, 1794, 1474,
+    1538, 1602, 1666, 1666, 1730, 1730, 1538, 1602,
+    1474, 1538, 1597314, 1597378, 1597442, 1597506, 1597570, 1597634,
+    1597698, 1597762, 1597826, 1597890, 1597954, 1598018, 1598082, 1598146,
+    1598210, 1666, 1730, 1794, 1858, 1922, 1986, 0,
+    1598274, 1598338, 1598402, 1598466, 1598530, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1598594, 1598658, 1598722, 1598786, 1598850, 1598914, 1598978, 1599042,
+    1599106, 1599170, 1599234, 1599298, 1599362, 1599426, 1599490, 1599554,
+    1599618, 1599682, 1599746, 1599810, 1599874, 1599938, 1600002, 1600066,
+    1600130, 1600194, 1600258, 1600322, 1600386, 1600450, 1600514, 1600578,
+    1600642, 1600706, 1600770, 1600834, 1600898, 1600962, 1601026, 1601090,
+    1601154, 1601218, 1601282, 1601346, 1601410, 1601474, 1601538, 1601602,
+    1601666, 1601730, 1601794, 1601858, 1601922, 1601986, 1602050, 1602114,
+    1602178, 1602242, 1602306, 1602370, 1602434, 1602498, 1602562, 1602626,
+    1602690, 1602754, 1602818, 1602882, 1602946, 1603010, 1603074, 1603138,
+    1603202, 1603266, 1603330, 1603394, 1603458, 1603522, 1603586, 1603650,
+    1603714, 1603778, 1603842, 1603906, 1603970, 1604034, 1604098, 1604162,
+    1604226, 1604290, 1604354, 1604418, 1604482, 1604546, 1604610, 1604674,
+    1604738, 1604802, 1604866, 1604930, 1604994, 1605058, 1605122, 1605186,
+    1605250, 1605314, 1605378, 1605442, 1605506, 1605570, 1605634, 1605698,
+    1605762, 1605826, 1605890, 1605954, 1606018, 1606082, 1606146, 1606210,
+    1606274, 1606338, 1606402, 1606466, 1606530, 1606594, 1606658, 1606722,
+    1606786, 1606850, 1606914, 1606978, 1607042, 1607106, 1607170, 1607234,
+    1607298, 1607362, 1607426, 1607490, 1607554, 1607618, 1607682, 1607746,
+    1607810, 1607874, 1607938, 1608002, 1608066, 1608130, 1608194, 1608258,
+    1608322, 1608386, 1608450, 1608514, 1608578, 1608642, 1608706, 1608770,
+    1608834, 1608898, 1608962, 1609026, 1609090, 1609154, 1609218, 1609282,
+    1609346, 1609410, 1609474, 1609538, 1609602, 1609666, 1609730, 1609794,
+    1609858, 1609922, 1609986, 1610050, 1610114, 1610178, 1610242, 1610306,
+    1610370, 1610434, 1610498, 1610562, 1610626, 1610690, 1610754, 1610818,
+    1610882, 1610946, 1611010, 1611074, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1611138, 1611202, 1611266, 1611330, 1611394, 1611458, 1611522, 1611586,
+    1611650, 1611714, 1611778, 1611842, 1611906, 1611970, 1612034, 1612098,
+    1612162, 1612226, 1612290, 1612354, 1612418, 1612482, 1612546, 1612610,
+    1612674, 1612738, 1612802, 1612866, 1612930, 1612994, 1613058, 1613122,
+    1613186, 1613250, 1613314, 1613378, 1613442, 1613506, 1613570, 1613634,
+    1613698, 1613762, 1613826, 1613890, 1613954, 1614018, 1614082, 1614146,
+    1614210, 1614274, 1614338, 1614402, 1614466, 1614530, 1614594, 1614658,
+    1614722, 1614786, 1614850, 1614914, 1614978, 1615042, 1615106, 1615170,
+    1615234, 1615298, 1615362, 1615426, 1615490, 1615554, 1615618, 1615682,
+    1615746, 1615810, 1615874, 1615938, 1616002, 1616066, 1616130, 1616194,
+    1616258, 1616322, 1616386, 1616450, 1616514, 1616578, 1616642, 1616706,
+    1616770, 1616834, 1616898, 1616962, 1617026, 1617090, 1617154, 1617218,
+    1617282, 1617346, 1617410, 1617474, 1617538, 1617602, 1617666, 1617730,
+    1617794, 1617858, 1617922, 1617986, 1618050, 1618114, 1618178, 1618242,
+    1618306, 1618370, 1618434, 1618498, 1618562, 1618626, 1618690, 1618754,
+    1618818, 1618882, 1618946, 1619010, 1619074, 1619138, 1619202, 1619266,
+    1619330, 1619394, 1619458, 1619522, 1619586, 1619650, 1619714, 1619778,
+    1619842, 1619906, 1619970, 1620034, 1620098, 1620162, 1620226, 1620290,
+    1620354, 1620418, 1620482, 1620546, 1620610, 1620674, 1620738, 1620802,
+    1620866, 1620930, 1620994, 1621058, 1621122, 1621186, 1621250, 1621314,
+    1621378, 1621442, 1621506, 1621570, 1621634, 1621698, 1621762, 1621826,
+    1621890, 1621954, 1622018, 1622082, 1622146, 1622210, 1622274, 1622338,
+    1622402, 1622466, 1622530, 1622594, 1622658, 1622722, 1622786, 1622850,
+    1622914, 1622978, 1623042, 1623106, 1623170, 1623234, 1623298, 1623362,
+    1623426, 1623490, 1623554, 1623618, 1623682, 1623746, 1623810, 1623874,
+    1623938, 1624002, 1624066, 1624130, 1624194, 1624258, 1624322, 1624386,
+    1624450, 1624514, 1624578, 1624642, 1624706, 1624770, 1624834, 1624898,
+    1624962, 1625026, 1625090, 1625154, 1625218, 1625282, 1625346, 1625410,
+    1625474, 1625538, 1625602, 1625666, 1625730, 1625794, 1625858, 1625922,
+    1625986, 1626050, 1626114, 1626178, 1626242, 1626306, 1626370, 1626434,
+    1626498, 1626562, 1626626, 1626690, 1626754, 1626818, 1626882, 1626946,
+    1627010, 1627074, 1627138, 1627202, 1627266, 1627330, 1627394, 1627458,
+    1627522, 1627586, 1627650, 1627714, 1627778, 1627842, 1627906, 1627970,
+    1628034, 1628098, 1628162, 1628226, 1628290, 1628354, 1628418, 1628482,
+    1628546, 1628610, 1628674, 1628738, 1628802, 1628866, 1628930, 1628994,
+    1629058, 1629122, 1629186, 1629250, 1629314, 1629378, 1629442, 1629506,
+    1629570, 1629634, 1629698, 1629762, 1629826, 1629890, 1629954, 1630018,
+    1630082, 1630146, 1630210, 1630274, 1630338, 1630402, 1630466, 1630530,
+    1630594, 1630658, 1630722, 1630786, 1630850, 1630914, 1630978, 1631042,
+    1631106, 1631170, 1631234, 1631298, 1631362, 1631426, 1631490, 1631554,
+    1631618, 1631682, 1631746, 1631810, 1631874, 1631938, 1632002, 1632066,
+    1632130, 1632194, 1632258, 1632322, 1632386, 1632450, 1632514, 1632578,
+    1632642, 1632706, 1632770, 1632834, 1632898, 1632962, 1633026, 1633090,
+    1633154, 1633218, 1633282, 1633346, 1633410, 1633474, 1633538, 1633602,
+    1633666, 1633730, 1633794, 1633858, 1633922, 1633986, 1634050, 1634114,
+    1634178, 1634242, 1634306, 1634370, 1634434, 1634498, 1634562, 1634626,
+    1634690, 1634754, 1634818, 1634882, 1634946, 1635010, 1635074, 1635138,
+    1635202, 1635266, 1635330, 1635394, 1635458, 1635522, 1635586, 1635650,
+    1635714, 1635778, 1635842, 1635906, 1635970, 1636034, 1636098, 1636162,
+    1636226, 1636290, 1636354, 1636418, 1636482, 1636546, 1636610, 1636674,
+    1636738, 1636802, 1636866, 1636930, 1636994, 1637058, 1637122, 1637186,
+    1637250, 1637314, 1637378, 1637442, 1637506, 1637570, 1637634, 1637698,
+    1637762, 1637826, 1637890, 1637954, 1638018, 1638082, 1638146, 1638210,
+    1638274, 1638338, 1638402, 1638466, 1638530, 1638594, 1638658, 1638722,
+    1638786, 1638850, 1638914, 1638978, 1639042, 1639106, 1639170, 1639234,
+    1639298, 1639362, 1639426, 1639490, 1639554, 1639618, 1639682, 1639746,
+    1639810, 1639874, 1639938, 1640002, 1640066, 1640130, 1640194, 1640258,
+    1640322, 1640386, 1640450, 1640514, 1640578, 1640642, 1640706, 1640770,
+    1640834, 1640898, 1640962, 1641026, 1641090, 1641154, 1641218, 1641282,
+    1641346, 1641410, 1641474, 1641538, 1641602, 1641666, 1641730, 1641794,
+    1641858, 1641922, 1641986, 1642050, 1642114, 1642178, 1642242, 1642306,
+    1642370, 1642434, 1642498, 1642562, 1642626, 1642690, 1642754, 1642818,
+    1642882, 1642946, 1643010, 1643074, 1643138, 1643202, 1643266, 1643330,
+    1643394, 1643458, 1643522, 1643586, 1643650, 1643714, 1643778, 1643842,
+    1643906, 1643970, 1644034, 1644098, 1644162, 1644226, 1644290, 1644354,
+    1644418, 1644482, 1644546, 1644610, 1644674, 1644738, 1644802, 1644866,
+    1644930, 1644994, 1645058, 1645122, 1645186, 1645250, 1645314, 1645378,
+    1645442, 1645506, 1645570, 1645634, 1645698, 1645762, 1645826, 1645890,
+    1645954, 1646018, 1646082, 1646146, 1646210, 1646274, 1646338, 1646402,
+    1646466, 1646530, 1646594, 1646658, 1646722, 1646786, 1646850, 1646914,
+    1646978, 1647042, 1647106, 1647170, 1647234, 1647298, 1647362, 1647426,
+    1647490, 1647554, 1647618, 1647682, 1647746, 1647810, 1647874, 1647938,
+    1648002, 1648066, 1648130, 1648194, 1648258, 1648322, 1648386, 1648450,
+    1648514, 1648578, 1648642, 1648706, 1648770, 1648834, 1648898, 1648962,
+    1649026, 1649090, 1649154, 1649218, 1649282, 1649346, 1649410, 1649474,
+    1649538, 1649602, 1649666, 1649730, 1649794, 1649858, 1649922, 1649986,
+    1650050, 1650114, 1650178, 1650242, 1650306, 1650370, 1650434, 1650498,
+    1650562, 1650626, 1650690, 1650754, 1650818, 1650882, 1650946, 1651010,
+    1651074, 1651138, 1651202, 1651266, 1651330, 1651394, 1651458, 1651522,
+    1651586, 1651650, 1651714, 1651778, 1651842, 1651906, 1651970, 1652034,
+    1652098, 1652162, 1652226, 1652290, 1652354, 1652418, 1652482, 1652546,
+    1652610, 1652674, 1652738, 1652802, 1652866, 1652930, 1652994, 1653058,
+    1653122, 1653186, 1653250, 1653314, 1653378, 1653442, 1653506, 1653570,
+    1653634, 1653698, 1653762, 1653826, 1653890, 1653954, 1654018, 1654082,
+    1654146, 1654210, 1654274, 1654338, 1654402, 1654466, 1654530, 1654594,
+    1654658, 1654722, 1654786, 1654850, 1654914, 1654978, 1655042, 1655106,
+    1655170, 1655234, 1655298, 1655362, 1655426, 1655490, 1655554, 1655618,
+    1655682, 1655746, 1655810, 1655874, 1655938, 1656002, 1656066, 1656130,
+    1656194, 1656258, 1656322, 1656386, 1656450, 1656514, 1656578, 1656642,
+    1656706, 1656770, 1656834, 1656898, 1656962, 1657026, 1657090, 1657154,
+    1657218, 1657282, 1657346, 1657410, 1657474, 1657538, 1657602, 1657666,
+    1657730, 1657794, 1657858, 1657922, 1657986, 1658050, 1658114, 1658178,
+    1658242, 1658306, 1658370, 1658434, 1658498, 1658562, 1658626, 1658690,
+    1658754, 1658818, 1658882, 1658946, 1659010, 1659074, 1659138, 1659202,
+    1659266, 1659330, 1659394, 1659458, 1659522, 1659586, 1659650, 1659714,
+    1659778, 1659842, 1659906, 1659970, 1660034, 1660098, 1660162, 1660226,
+    1660290, 1660354, 1660418, 1660482, 1660546, 1660610, 1660674, 1660738,
+    1660802, 1660866, 1660930, 1660994, 1661058, 1661122, 1661186, 1661250,
+    1661314, 1661378, 1661442, 1661506, 1661570, 1661634, 1661698, 1661762,
+    1661826, 1661890, 1661954, 1662018, 1662082, 1662146, 1662210, 1662274,
+    1662338, 1662402, 1662466, 1662530, 1662594, 1662658, 1662722, 1662786,
+    1662850, 1662914, 1662978, 1663042, 1663106, 1663170, 1663234, 1663298,
+    1663362, 1663426, 1663490, 1663554, 1663618, 1663682, 1663746, 1663810,
+    1663874, 1663938, 1664002, 1664066, 1664130, 1664194, 1664258, 1664322,
+    1664386, 1664450, 1664514, 1664578, 1664642, 1664706, 1664770, 1664834,
+    1664898, 1664962, 1665026, 1665090, 1665154, 1665218, 1665282, 1665346,
+    1665410, 1665474, 1665538, 1665602, 1665666, 1665730, 1665794, 1665858,
+    1665922, 1665986, 1666050, 1666114, 1666178, 1666242, 1666306, 1666370,
+    1666434, 1666498, 1666562, 1666626, 1666690, 1666754, 1666818, 1666882,
+    1666946, 1667010, 1667074, 1667138, 1667202, 1667266, 1667330, 1667394,
+    1667458, 1667522, 1667586, 1667650, 1667714, 1667778, 1667842, 1667906,
+    1667970, 1668034, 1668098, 1668162, 1668226, 1668290, 1668354, 1668418,
+    1668482, 1668546, 1668610, 1668674, 1668738, 1668802, 1668866, 1668930,
+    1668994, 1669058, 1669122, 1669186, 1669250, 1669314, 1669378, 1669442,
+    1669506, 1669570, 1669634, 1669698, 1669762, 1669826, 1669890, 1669954,
+    1670018, 1670082, 1670146, 1670210, 1670274, 1670338, 1670402, 1670466,
+    1670530, 1670594, 1670658, 1670722, 1670786, 1670850, 1670914, 1670978,
+    1671042, 1671106, 1671170, 1671234, 1671298, 1671362, 1671426, 1671490,
+    1671554, 1671618, 1671682, 1671746, 1671810, 1671874, 1671938, 1672002,
+    1672066, 1672130, 1672194, 1672258, 1672322, 1672386, 1672450, 1672514,
+    1672578, 1672642, 1672706, 1672770, 1672834, 1672898, 1672962, 1673026,
+    1673090, 1673154, 1673218, 1673282, 1673346, 1673410, 1673474, 1673538,
+    1673602, 1673666, 1673730, 1673794, 1673858, 1673922, 1673986, 1674050,
+    1674114, 1674178, 1674242, 1674306, 1674370, 1674434, 1674498, 1674562,
+    1674626, 1674690, 1674754, 1674818, 1674882, 1674946, 1675010, 1675074,
+    1675138, 1675202, 1675266, 1675330, 1675394, 1675458, 1675522, 1675586,
+    1675650, 1675714, 1675778, 1675842, 1675906, 1675970, 1676034, 1676098,
+    1676162, 1676226, 1676290, 1676354, 1676418, 1676482, 1676546, 1676610,
+    1676674, 1676738, 1676802, 1676866, 1676930, 1676994, 1677058, 1677122,
+    1677186, 1677250, 1677314, 1677378, 1677442, 1677506, 1677570, 1677634,
+    1677698, 1677762, 1677826, 1677890, 1677954, 1678018, 1678082, 1678146,
+    1678210, 1678274, 1678338, 1678402, 1678466, 1678530, 1678594, 1678658,
+    1678722, 1678786, 1678850, 1678914, 1678978, 1679042, 1679106, 1679170,
+    1679234, 1679298, 1679362, 1679426, 1679490, 1679554, 1679618, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1679682, 1679746, 1679810, 1679874, 1679938, 1680002, 1680066, 1680130,
+    1680194, 1680258, 1680322, 1680386, 1680450, 1680514, 1680578, 1680642,
+    1680706, 1680770, 1680834, 1680898, 1680962, 1681026, 1681090, 1681154,
+    1681218, 1681282, 1681346, 1681410, 1681474, 1681538, 1681602, 1681666,
+    1681730, 1681794, 1681858, 1681922, 1681986, 1682050, 1682114, 1682178,
+    1682242, 1682306, 1682370, 1682434, 1682498, 1682562, 1682626, 1682690,
+    1682754, 1682818, 1682882, 1682946, 1683010, 1683074, 1683138, 1683202,
+    1683266, 1683330, 1683394, 1683458, 1683522, 1683586, 1683650, 1683714,
+    1683778, 1683842, 1683906, 1683970, 1684034, 1684098, 1684162, 1684226,
+    1684290, 1684354, 1684418, 1684482, 1684546, 1684610, 1684674, 1684738,
+    1684802, 1684866, 1684930, 1684994, 1685058, 1685122, 1685186, 1685250,
+    1685314, 1685378, 1685442, 1685506, 1685570, 1685634, 1685698, 1685762,
+    1685826, 1685890, 1685954, 1686018, 1686082, 1686146, 1686210, 1686274,
+    1686338, 1686402, 1686466, 1686530, 1686594, 1686658, 1686722, 1686786,
+    1686850, 1686914, 1686978, 1687042, 1687106, 1687170, 1687234, 1687298,
+    1687362, 1687426, 1687490, 1687554, 1687618, 1687682, 1687746, 1687810,
+    1687874, 1687938, 1688002, 1688066, 1688130, 1688194, 1688258, 1688322,
+    1688386, 1688450, 1688514, 1688578, 1688642, 1688706, 1688770, 1688834,
+    1688898, 1688962, 1689026, 1689090, 1689154, 1689218, 1689282, 1689346,
+    1689410, 1689474, 1689538, 1689602, 1689666, 1689730, 1689794, 1689858,
+    1689922, 1689986, 1690050, 1690114, 1690178, 1690242, 1690306, 1690370,
+    1690434, 1690498, 1690562, 1690626, 1690690, 1690754, 1690818, 1690882,
+    1690946, 1691010, 1691074, 1691138, 1691202, 1691266, 1691330, 1691394,
+    1691458, 1691522, 1691586, 1691650, 1691714, 1691778, 1691842, 1691906,
+    1691970, 1692034, 1692098, 1692162, 1692226, 1692290, 1692354, 1692418,
+    1692482, 1692546, 1692610, 1692674, 1692738, 1692802, 1692866, 1692930,
+    1692994, 1693058, 1693122, 1693186, 1693250, 1693314, 1693378, 1693442,
+    1693506, 1693570, 1693634, 1693698, 1693762, 1693826, 1693890, 1693954,
+    1694018, 1694082, 1694146, 1694210, 1694274, 1694338, 1694402, 1694466,
+    1694530, 1694594, 1694658, 1694722, 1694786, 1694850, 1694914, 1694978,
+    1695042, 1695106, 1695170, 1695234, 1695298, 1695362, 1695426, 1695490,
+    1695554, 1695618, 1695682, 1695746, 1695810, 1695874, 1695938, 1696002,
+    1696066, 1696130, 1696194, 1696258, 1696322, 1696386, 1696450, 1696514,
+    1696578, 1696642, 1696706, 1696770, 1696834, 1696898, 1696962, 1697026,
+    1697090, 1697154, 1697218, 1697282, 1697346, 1697410, 1697474, 1697538,
+    1697602, 1697666, 1697730, 1697794, 1697858, 1697922, 1697986, 1698050,
+    1698114, 1698178, 1698242, 1698306, 1698370, 1698434, 1698498, 1698562,
+    1698626, 1698690, 1698754, 1698818, 1698882, 1698946, 1699010, 1699074,
+    1699138, 1699202, 1699266, 1699330, 1699394, 1699458, 1699522, 1699586,
+    1699650, 1699714, 1699778, 1699842, 1699906, 1699970, 1700034, 1700098,
+    1700162, 1700226, 1700290, 1700354, 1700418, 1700482, 1700546, 1700610,
+    1700674, 1700738, 1700802, 1700866, 1700930, 1700994, 1701058, 1701122,
+    1701186, 1701250, 1701314, 1701378, 1701442, 1701506, 1701570, 1701634,
+    1701698, 1701762, 1701826, 1701890, 1701954, 1702018, 1702082, 1702146,
+    1702210, 1702274, 1702338, 1702402, 1702466, 1702530, 1702594, 1702658,
+    1702722, 1702786, 1702850, 1702914, 1702978, 1703042, 1703106, 1703170,
+    1703234, 1703298, 1703362, 1703426, 1703490, 1703554, 1703618, 1703682,
+    1703746, 1703810, 1703874, 1703938, 1704002, 1704066, 1704130, 1704194,
+    1704258, 1704322, 1704386, 1704450, 1704514, 1704578, 1704642, 1704706,
+    1704770, 1704834, 1704898, 1704962, 1705026, 1705090, 1705154, 1705218,
+    1705282, 1705346, 1705410, 1705474, 1705538, 1705602, 1705666, 1705730,
+    1705794, 1705858, 1705922, 1705986, 1706050, 1706114, 1706178, 1706242,
+    1706306, 1706370, 1706434, 1706498, 1706562, 1706626, 1706690, 1706754,
+    1706818, 1706882, 1706946, 1707010, 1707074, 1707138, 1707202, 1707266,
+    1707330, 1707394, 1707458, 1707522, 1707586, 1707650, 1707714, 1707778,
+    1707842, 1707906, 1707970, 1708034, 1708098, 1708162, 1708226, 1708290,
+    1708354, 1708418, 1708482, 1708546, 1708610, 1708674, 1708738, 1708802,
+    1708866, 1708930, 1708994, 1709058, 1709122, 1709186, 1709250, 1709314,
+    1709378, 1709442, 1709506, 1709570, 1709634, 1709698, 1709762, 1709826,
+    1709890, 1709954, 1710018, 1710082, 1710146, 1710210, 1710274, 1710338,
+    1710402, 1710466, 1710530, 1710594, 1710658, 1710722, 1710786, 1710850,
+    1710914, 1710978, 1711042, 1711106, 1711170, 1711234, 1711298, 1711362,
+    1711426, 1711490, 1711554, 1711618, 1711682, 1711746, 1711810, 1711874,
+    1711938, 1712002, 1712066, 1712130, 1712194, 1712258, 1712322, 1712386,
+    1712450, 1712514, 1712578, 1712642, 1712706, 1712770, 1712834, 1712898,
+    1712962, 1713026, 1713090, 1713154, 1713218, 1713282, 1713346, 1713410,
+    1713474, 1713538, 1713602, 1713666, 1713730, 1713794, 1713858, 1713922,
+    1713986, 1714050, 1714114, 1714178, 1714242, 1714306, 1714370, 1714434,
+    1714498, 1714562, 1714626, 1714690, 1714754, 1714818, 1714882, 1714946,
+    1715010, 1715074, 1715138, 1715202, 1715266, 1715330, 1715394, 1715458,
+    1715522, 1715586, 1715650, 1715714, 1715778, 1715842, 1715906, 1715970,
+    1716034, 1716098, 1716162, 1716226, 1716290, 1716354, 1716418, 1716482,
+    1716546, 1716610, 1716674, 1716738, 1716802, 1716866, 1716930, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1716994, 1717058, 1717122, 1717186, 1717250, 1717314, 1717378, 1717442,
+    1717506, 1717570, 1717634, 1717698, 1717762, 1717826, 1717890, 1717954,
+    1718018, 1718082, 1718146, 1718210, 1718274, 1718338, 1718402, 1718466,
+    1718530, 1718594, 1718658, 1718722, 1718786, 1718850, 1718914, 1718978,
+    1719042, 1719106, 1719170, 1719234, 1719298, 1719362, 1719426, 1719490,
+    1719554, 1719618, 1719682, 1719746, 1719810, 1719874, 1719938, 1720002,
+    1720066, 1720130, 1720194, 1720258, 1720322, 1720386, 1720450, 1720514,
+    1720578, 1720642, 1720706, 1720770, 1720834, 1720898, 1720962, 1721026,
+    1721090, 1721154, 1721218, 1721282, 1721346, 1721410, 1721474, 1721538,
+    1721602, 1721666, 1721730, 1721794, 1721858, 1721922, 1721986, 1722050,
+    1722114, 1722178, 1722242, 1722306, 1722370, 1722434, 1722498, 1722562,
+    1722626, 1722690, 1722754, 1722818, 1722882, 1722946, 1723010, 1723074,
+    1723138, 1723202, 1723266, 1723330, 1723394, 1723458, 1723522, 1723586,
+    1723650, 1723714, 1723778, 1723842, 1723906, 1723970, 1724034, 1724098,
+    1724162, 1724226, 1724290, 1724354, 1724418, 1724482, 1724546, 1724610,
+    1724674, 1724738, 1724802, 1724866, 1724930, 1724994, 1725058, 1725122,
+    1725186, 1725250, 1725314, 1725378, 1725442, 1725506, 1725570, 1725634,
+    1725698, 1725762, 1725826, 1725890, 1725954, 1726018, 1726082, 1726146,
+    1726210, 1726274, 1726338, 1726402, 1726466, 1726530, 1726594, 1726658,
+    1726722, 1726786, 1726850, 1726914, 1726978, 1727042, 1727106, 1727170,
+    1727234, 1727298, 1727362, 1727426, 1727490, 1727554, 1727618, 1727682,
+    1727746, 1727810, 1727874, 1727938, 1728002, 1728066, 1728130, 1728194,
+    1728258, 1728322, 1728386, 1728450, 1728514, 1728578, 1728642, 1728706,
+    1728770, 1728834, 1728898, 1728962, 1729026, 1729090, 1729154, 1729218,
+    1729282, 1729346, 1729410, 1729474, 1729538, 1729602, 1729666, 1729730,
+    1729794, 1729858, 1729922, 1729986, 1730050, 1730114, 1730178, 1730242,
+    1730306, 1730370, 1730434, 1730498, 1730562, 1730626, 1730690, 1730754,
+    1730818, 1730882, 1730946, 1731010, 1731074, 1731138, 1731202, 1731266,
+    1731330, 1731394, 1731458, 1731522, 1731586, 1731650, 1731714, 1731778,
+    1731842, 1731906, 1731970, 1732034, 1732098, 1732162, 1732226, 1732290,
+    1732354, 1732418, 1732482, 1732546, 1732610, 1732674, 1732738, 1732802,
+    1732866, 1732930, 1732994, 1733058, 1733122, 1733186, 1733250, 1733314,
+    1733378, 1733442, 1733506, 1733570, 1733634, 1733698, 1733762, 1733826,
+    1733890, 1733954, 1734018, 1734082, 1734146, 1734210, 1734274, 1734338,
+    1734402, 1734466, 1734530, 1734594, 1734658, 1734722, 1734786, 1734850,
+    1734914, 1734978, 1735042, 1735106, 1735170, 1735234, 1735298, 1735362,
+    1735426, 1735490, 1735554, 1735618, 1735682, 1735746, 1735810, 1735874,
+    1735938, 1736002, 1736066, 1736130, 1736194, 1736258, 1736322, 1736386,
+    1736450, 1736514, 1736578, 1736642, 1736706, 1736770, 1736834, 1736898,
+    1736962, 1737026, 1737090, 1737154, 1737218, 1737282, 1737346, 1737410,
+    1737474, 1737538, 1737602, 1737666, 1737730, 1737794, 1737858, 1737922,
+    1737986, 1738050, 1738114, 1738178, 1738242, 1738306, 1738370, 1738434,
+    1738498, 1738562, 1738626, 1738690, 1738754, 1738818, 1738882, 1738946,
+    1739010, 1739074, 1739138, 1739202, 1739266, 1739330, 1739394, 1739458,
+    1739522, 1739586, 1739650, 1739714, 1739778, 1739842, 1739906, 1739970,
+    1740034, 1740098, 1740162, 1740226, 1740290, 1740354, 1740418, 1740482,
+    1740546, 1740610, 1740674, 1740738, 1740802, 1740866, 1740930, 1740994,
+    1741058, 1741122, 1741186, 1741250, 1741314, 1741378, 1741442, 1741506,
+    1741570, 1741634, 1741698, 1741762, 1741826, 1741890, 1741954, 1742018,
+    1742082, 1742146, 1742210, 1742274, 1742338, 1742402, 1742466, 1742530,
+    1742594, 1742658, 1742722, 1742786, 1742850, 1742914, 1742978, 1743042,
+    1743106, 1743170, 1743234, 1743298, 1743362, 1743426, 1743490, 1743554,
+    1743618, 1743682, 1743746, 1743810, 1743874, 1743938, 1744002, 1744066,
+    1744130, 1744194, 1744258, 1744322, 1744386, 1744450, 1744514, 1744578,
+    1744642, 1744706, 1744770, 1744834, 1744898, 1744962, 1745026, 1745090,
+    1745154, 1745218, 1745282, 1745346, 1745410, 1745474, 1745538, 1745602,
+    1745666, 1745730, 1745794, 1745858, 1745922, 1745986, 1746050, 1746114,
+    1746178, 1746242, 1746306, 1746370, 1746434, 1746498, 1746562, 1746626,
+    1746690, 1746754, 1746818, 1746882, 1746946, 1747010, 1747074, 1747138,
+    1747202, 1747266, 1747330, 1747394, 1747458, 1747522, 1747586, 1747650,
+    1747714, 1747778, 1747842, 1747906, 1747970, 1748034, 1748098, 1748162,
+    1748226, 1748290, 1748354, 1748418, 1748482, 1748546, 1748610, 1748674,
+    1748738, 1748802, 1748866, 1748930, 1748994, 1749058, 1749122, 1749186,
+    1749250, 1749314, 1749378, 1749442, 1749506, 1749570, 1749634, 1749698,
+    1749762, 1749826, 1749890, 1749954, 1750018, 1750082, 1750146, 1750210,
+    1750274, 1750338, 1750402, 1750466, 1750530, 1750594, 1750658, 1750722,
+    1750786, 1750850, 1750914, 1750978, 1751042, 1751106, 1751170, 1751234,
+    1751298, 1751362, 1751426, 1751490, 1751554, 1751618, 1751682, 1751746,
+    1751810, 1751874, 1751938, 1752002, 1752066, 1752130, 1752194, 1752258,
+    1752322, 1752386, 1752450, 1752514, 1752578, 1752642, 1752706, 1752770,
+    1752834, 1752898, 1752962, 1753026, 1753090, 1753154, 1753218, 1753282,
+    1753346, 0, 0, 0, 0, 0, 0, 0,
+    1753410, 1753474, 1753538, 1753602, 1753666, 1753730, 1753794, 1753858,
+    1753922, 1753986, 1754050, 1754114, 1754178, 1754242, 1754306, 1754370,
+    1754434, 1754498, 1754562, 1754626, 1754690, 1754754, 1754818, 1754882,
+    1754946, 1755010, 1755074, 1755138, 1755202, 1755266, 1755330, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 1755394, 1755458,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1755522, 1755586, 1755650, 1755714, 1755778, 1755842, 1755906, 1755970,
+    1756034, 1756098, 1756162, 1756226, 1756290, 1756354, 1756418, 1756482,
+    1756546, 1756610, 1756674, 1756738, 1756802, 1756866, 1756930, 1756994,
+    1757058, 1757122, 1757186, 1757250, 1757314, 1757378, 0, 0,
+    1757442, 1757506, 1757570, 1757634, 1757698, 1757762, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1757826, 1757890, 1757954, 1758018, 1758082, 1758146, 1758210, 1758274,
+    1758338, 1758402, 1758466, 1758530, 1758594, 1758658, 1758722, 1758786,
+    1758850, 1758914, 1758978, 1759042, 1759106, 1759170, 1759234, 1759298,
+    1759362, 1759426, 1759490, 1759554, 1759618, 1759682, 1759746, 1759810,
+    1759874, 1759938, 1760002, 1760066, 1760130, 1760194, 1760258, 1760322,
+    1760386, 1760450, 1760514, 1760578, 1760642, 1760706, 1760770, 1760834,
+    1760898, 1760962, 1761026, 1761090, 1761154, 1761218, 1761282, 1761346,
+    1761410, 1761474, 1761538, 1761602, 1761666, 1761730, 1761794, 1761858,
+    1761922, 1761986, 1762050, 1762114, 1762178, 1762242, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 1762306, 1762370, 1762434, 1762498, 1762562,
+    1762626, 1762690, 0, 1762754, 1762818, 1762882, 1762946, 1763010,
+    1763074, 1763138, 1763202, 1763266, 1763330, 1763394, 1763458, 1763522,
+    1763586, 1763650, 1763714, 1763778, 1763842, 1763906, 1763970, 1764034,
+    0, 0, 0, 0, 0, 1764098, 1764162, 1764226,
+    1764290, 1764354, 1764418, 1764482, 1764546, 1764610, 1764674, 1764738,
+    1764802, 1764866, 1764930, 1764994, 1765058, 1765122, 1765186, 1765250,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1765314, 1765378, 1765442, 1765506, 1765570, 1765634, 1765698, 1765762,
+    1765826, 1765890, 1765954, 1766018, 1766082, 1766146, 1766210, 1766274,
+    1766338, 1766402, 1766466, 1766530, 1766594, 1766658, 1766722, 1766786,
+    1766850, 1766914, 1766978, 1767042, 1767106, 1767170, 1767234, 1767298,
+    1767362, 1767426, 1767490, 1767554, 1767618, 1767682, 1767746, 1767810,
+    1767874, 1767938, 1768002, 1768066, 1768130, 1768194, 1768258, 1768322,
+    1768386, 1768450, 1768514, 1768578, 1768642, 1768706, 1768770, 1768834,
+    1768898, 1768962, 1769026, 1769090, 1769154, 1769218, 1769282, 1769346,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1769410, 1769474, 1769538, 1769602, 1769666, 1769730,
+    1769794, 1769858, 1769922, 1769986, 1770052, 1770180, 1770308, 1770434,
+    1770498, 1770562, 1770626, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1770690, 1770754, 1770818, 1770882, 1770946, 1771010, 1771074, 1771138,
+    1771202, 1771266, 1771330, 1771394, 1771458, 1771522, 1771586, 1771650,
+    1771714, 1771778, 1771842, 1771906, 1771970, 1772034, 1772098, 1772162,
+    1772226, 1772290, 1772354, 1772418, 1772482, 1772546, 1772610, 1772674,
+    1772738, 1772802, 1772866, 1772930, 1772994, 1773058, 1773122, 1773186,
+    1773250, 1773314, 1773378, 1773442, 1773506, 1773570, 1773634, 1773698,
+    1773762, 1773826, 1773890, 1773954, 1774018, 1774082, 1774146, 1774210,
+    1774274, 1774338, 1774402, 1774466, 1774530, 1774594, 1774658, 1774722,
+    1774786, 1774850, 1774914, 1774978, 1775042, 1775106, 1775170, 1775234,
+    1775298, 1775362, 1775426, 0, 0, 0, 0, 1775490,
+    1775554, 1775618, 1775682, 1775746, 1775810, 1775874, 1775938, 1776002,
+    1776066, 1776130, 1776194, 1776258, 1776322, 1776386, 1776450, 1776514,
+    1776578, 1776642, 1776706, 1776770, 1776834, 1776898, 1776962, 1777026,
+    1777090, 1777154, 1777218, 1777282, 1777346, 1777410, 1777474, 1777538,
+    1777602, 1777666, 1777730, 1777794, 1777858, 1777922, 1777986, 1778050,
+    1778114, 1778178, 1778242, 1778306, 1778370, 1778434, 1778498, 1778562,
+    1778626, 1778690, 1778754, 1778818, 1778882, 1778946, 1779010, 1779074,
+    0, 0, 0, 0, 0, 0, 0, 1779138,
+    1779202, 1779266, 1779330, 1779394, 1779458, 1779522, 1779586, 1779650,
+    1779714, 1779778, 1779842, 1779906, 1779970, 1780034, 1780098, 1780162,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1780226, 1780290, 1780354, 1780418, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1780482, 1780546, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1780610, 1780674, 1780738, 1780802, 1780866, 1780930, 1780994, 1781058,
+    1781122, 1781186, 1781250, 1781314, 1781378, 1781442, 1781506, 1781570,
+    1781634, 1781698, 1781762, 1781826, 1781890, 1781954, 1782018, 1782082,
+    1782146, 1782210, 1782274, 1782338, 1782402, 1782466, 1782530, 1782594,
+    1782658, 1782722, 1782786, 1782850, 1782914, 1782978, 1783042, 1783106,
+    1783170, 1783234, 1783298, 1783362, 1783426, 1783490, 1783554, 1783618,
+    1783682, 1783746, 1783810, 1783874, 1783938, 1784002, 1784066, 1784130,
+    1784194, 1784258, 1784322, 1784386, 1784450, 1784514, 1784578, 1784642,
+    1784706, 1784770, 1784834, 1784898, 1784962, 1785026, 1785090, 1785154,
+    1785218, 1785282, 1785346, 1785410, 1785474, 1785538, 1785602, 1785666,
+    1785730, 1785794, 1785858, 1785922, 1785986, 1786050, 1786114, 1786178,
+    1786242, 1786306, 1786370, 1786434, 1786498, 1786562, 1786626, 1786690,
+    1786754, 1786818, 1786882, 1786946, 1787010, 1787074, 1787138, 1787202,
+    1787266, 1787330, 1787394, 1787458, 1787522, 1787586, 1787650, 1787714,
+    1787778, 1787842, 1787906, 1787970, 1788034, 1788098, 1788162, 1788226,
+    1788290, 1788354, 1788418, 1788482, 1788546, 1788610, 1788674, 1788738,
+    1788802, 1788866, 1788930, 1788994, 1789058, 1789122, 1789186, 1789250,
+    1789314, 1789378, 1789442, 1789506, 1789570, 1789634, 1789698, 1789762,
+    1789826, 1789890, 1789954, 1790018, 1790082, 1790146, 1790210, 1790274,
+    1790338, 1790402, 1790466, 1790530, 1790594, 1790658, 1790722, 1790786,
+    1790850, 1790914, 1790978, 1791042, 1791106, 1791170, 1791234, 1791298,
+    1791362, 1791426, 1791490, 1791554, 1791618, 1791682, 1791746, 1791810,
+    1791874, 1791938, 1792002, 1792066, 1792130, 1792194, 1792258, 1792322,
+    1792386, 1792450, 1792514, 1792578, 1792642, 1792706, 1792770, 1792834,
+    1792898, 1792962, 1793026, 1793090, 1793154, 1793218, 1793282, 1793346,
+    1793410, 1793474, 1793538, 1793602, 1793666, 1793730, 1793794, 1793858,
+    1793922, 1793986, 1794050, 1794114, 1794178, 1794242, 1794306, 1794370,
+    1794434, 1794498, 1794562, 1794626, 1794690, 1794754, 1794818, 1794882,
+    1794946, 1795010, 1795074, 1795138, 1795202, 1795266, 1795330, 1795394,
+    1795458, 1795522, 1795586, 1795650, 1795714, 1795778, 1795842, 1795906,
+    1795970, 1796034, 1796098, 1796162, 1796226, 1796290, 1796354, 1796418,
+    1796482, 1796546, 1796610, 1796674, 1796738, 1796802, 1796866, 1796930,
+    1796994, 1797058, 1797122, 1797186, 1797250, 1797314, 1797378, 1797442,
+    1797506, 1797570, 1797634, 1797698, 1797762, 1797826, 1797890, 1797954,
+    1798018, 1798082, 1798146, 1798210, 1798274, 1798338, 1798402, 1798466,
+    1798530, 1798594, 1798658, 1798722, 1798786, 1798850, 1798914, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1798978, 1799042, 1799106, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1799170, 1799234, 1799298, 1799362,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1799426, 1799490, 1799554, 1799618, 1799682, 1799746, 1799810, 1799874,
+    1799938, 1800002, 1800066, 1800130, 1800194, 1800258, 1800322, 1800386,
+    1800450, 1800514, 1800578, 1800642, 1800706, 1800770, 1800834, 1800898,
+    1800962, 1801026, 1801090, 1801154, 1801218, 1801282, 1801346, 1801410,
+    1801474, 1801538, 1801602, 1801666, 1801730, 1801794, 1801858, 1801922,
+    1801986, 1802050, 1802114, 1802178, 1802242, 1802306, 1802370, 1802434,
+    1802498, 1802562, 1802626, 1802690, 1802754, 1802818, 1802882, 1802946,
+    1803010, 1803074, 1803138, 1803202, 1803266, 1803330, 1803394, 1803458,
+    1803522, 1803586, 1803650, 1803714, 1803778, 1803842, 1803906, 1803970,
+    1804034, 1804098, 1804162, 1804226, 1804290, 1804354, 1804418, 1804482,
+    1804546, 1804610, 1804674, 1804738, 1804802, 1804866, 1804930, 1804994,
+    1805058, 1805122, 1805186, 1805250, 1805314, 1805378, 1805442, 1805506,
+    1805570, 1805634, 1805698, 1805762, 1805826, 1805890, 1805954, 1806018,
+    1806082, 1806146, 1806210, 0, 0, 0, 0, 0,
+    1806274, 1806338, 1806402, 1806466, 1806530, 1806594, 1806658, 1806722,
+    1806786, 1806850, 1806914, 1806978, 1807042, 0, 0, 0,
+    1807106, 1807170, 1807234, 1807298, 1807362, 1807426, 1807490, 1807554,
+    1807618, 0, 0, 0, 0, 0, 0, 0,
+    1807682, 1807746, 1807810, 1807874, 1807938, 1808002, 1808066, 1808130,
+    1808194, 1808258, 0, 0, 1808322, 67970, 69442, 1808386,
+    2, 2, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1808450, 1808514, 1808578, 1808642, 1808706, 1808770, 1808834, 1808898,
+    1808962, 1809026, 1809090, 1809154, 1809218, 1809282, 1809346, 1809410,
+    1809474, 1809538, 1809602, 1809666, 1809730, 1809794, 1809858, 1809922,
+    1809986, 1810050, 1810114, 1810178, 1810242, 1810306, 1810370, 1810434,
+    1810498, 1810562, 1810626, 1810690, 1810754, 1810818, 1810882, 1810946,
+    1811010, 1811074, 1811138, 1811202, 1811266, 1811330, 1811394, 1811458,
+    1811522, 1811586, 1811650, 1811714, 1811778, 1811842, 1811906, 1811970,
+    1812034, 1812098, 1812162, 1812226, 1812290, 1812354, 1812418, 1812482,
+    1812546, 1812610, 1812674, 1812738, 1812802, 1812866, 1812930, 1812994,
+    1813058, 1813122, 1813186, 1813250, 1813314, 1813378, 1813442, 1813506,
+    1813570, 1813634, 1813698, 1813762, 1813826, 1813890, 1813954, 1814018,
+    1814082, 1814146, 1814210, 1814274, 1814338, 1814402, 1814466, 1814530,
+    1814594, 1814658, 1814722, 1814786, 1814850, 1814914, 1814978, 1815042,
+    1815106, 1815170, 1815234, 1815298, 1815362, 1815426, 1815490, 1815554,
+    1815618, 1815682, 1815746, 1815810, 1815874, 1815938, 1816002, 1816066,
+    1816130, 1816194, 1816258, 1816322, 1816386, 1816450, 1816514, 1816578,
+    1816642, 1816706, 1816770, 1816834, 1816898, 1816962, 1817026, 1817090,
+    1817154, 1817218, 1817282, 1817346, 1817410, 1817474, 1817538, 1817602,
+    1817666, 1817730, 1817794, 1817858, 1817922, 1817986, 1818050, 1818114,
+    1818178, 1818242, 1818306, 1818370, 1818434, 1818498, 1818562, 1818626,
+    1818690, 1818754, 1818818, 1818882, 1818946, 1819010, 1819074, 1819138,
+    1819202, 1819266, 1819330, 1819394, 1819458, 1819522, 1819586, 1819650,
+    1819714, 1819778, 1819842, 1819906, 1819970, 1820034, 1820098, 1820162,
+    1820226, 1820290, 1820354, 1820418, 1820482, 1820546, 1820610, 1820674,
+    1820738, 1820802, 1820866, 1820930, 1820994, 1821058, 1821122, 1821186,
+    1821250, 1821314, 1821378, 1821442, 1821506, 1821570, 1821634, 1821698,
+    1821762, 1821826, 1821890, 1821954, 1822018, 1822082, 1822146, 1822210,
+    1822274, 1822338, 1822402, 1822466, 1822530, 1822594, 1822658, 1822722,
+    1822786, 1822850, 1822914, 1822978, 1823042, 1823106, 1823170, 1823234,
+    1823298, 1823362, 1823426, 1823490, 1823554, 1823618, 1823682, 1823746,
+    1823810, 1823874, 1823938, 1824002, 1824066, 1824130, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1824194, 1824258, 1824322, 1824386, 1824450, 1824514, 1824578, 1824642,
+    1824706, 1824770, 1824834, 1824898, 1824962, 1825026, 1825090, 1825154,
+    1825218, 1825282, 1825346, 1825410, 1825474, 1825538, 1825602, 1825666,
+    1825730, 1825794, 1825858, 1825922, 1825986, 1826050, 1826114, 1826178,
+    1826242, 1826306, 1826370, 1826434, 1826498, 1826562, 1826626, 0,
+    0, 1826690, 1826754, 1826818, 1826882, 1826946, 1827010, 1827074,
+    1827138, 1827202, 1827266, 1827330, 1827394, 1827458, 1827522, 1827586,
+    1827650, 1827714, 1827778, 1827842, 1827906, 1827970, 1828034, 1828098,
+    1828162, 1828226, 1828290, 1828354, 1828418, 1828482, 1828546, 1828610,
+    1828674, 1828738, 1828802, 1828866, 1828930, 1828994, 1829058, 1829122,
+    1829186, 1829250, 1829314, 1829378, 1829442, 1829506, 1829570, 1829634,
+    1829698, 1829762, 1829826, 1829890, 1829954, 1830018, 1830084, 1830212,
+    1830342, 1830342, 1830342, 1830342, 1830342, 2, 2, 2,
+    2, 2, 1830530, 1830594, 1830658, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 1830722, 1830786, 2, 2, 2,
+    2, 2, 2, 2, 1830850, 1830914, 1830978, 1831042,
+    1831106, 1831170, 1831234, 1831298, 1831362, 1831426, 1831490, 1831554,
+    1831618, 1831682, 1831746, 1831810, 1831874, 1831938, 1832002, 1832066,
+    1832130, 1832194, 1832258, 1832322, 1832386, 1832450, 1832514, 1832578,
+    1832642, 1832706, 2, 2, 2, 2, 1832770, 1832834,
+    1832898, 1832962, 1833026, 1833090, 1833154, 1833218, 1833282, 1833346,
+    1833410, 1833474, 1833538, 1833604, 1833732, 1833862, 1834054, 1833862,
+    1834054, 1834242, 1834306, 1834370, 1834434, 1834498, 1834562, 1834626,
+    1834690, 1834754, 1834818, 1834882, 1834946, 1835010, 1835074, 1835138,
+    1835202, 1835266, 1835330, 1835394, 1835458, 1835522, 1835586, 1835650,
+    1835714, 1835778, 1835842, 1835906, 1835970, 1836034, 1836098, 1836162,
+    1836226, 1836290, 1836354, 1836418, 1836482, 1836546, 1836610, 1836674,
+    1836738, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1836802, 1836866, 1836930, 1836994, 1837058, 1837122, 1837186, 1837250,
+    1837314, 1837378, 1837442, 1837506, 1837570, 1837634, 1837698, 1837762,
+    1837826, 1837890, 1837954, 1838018, 1838082, 1838146, 1838210, 1838274,
+    1838338, 1838402, 1838466, 1838530, 1838594, 1838658, 1838722, 1838786,
+    1838850, 1838914, 1838978, 1839042, 1839106, 1839170, 1839234, 1839298,
+    1839362, 1839426, 1839490, 1839554, 1839618, 1839682, 1839746, 1839810,
+    1839874, 1839938, 1840002, 1840066, 1840130, 1840194, 1840258, 1840322,
+    1840386, 1840450, 1840514, 1840578, 1840642, 1840706, 1840770, 1840834,
+    1840898, 1840962, 2, 2, 2, 1841026, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1841090, 1841154, 1841218, 1841282, 1841346, 1841410,
+    1841474, 1841538, 1841602, 1841666, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1841730, 1841794, 1841858, 1841922, 1841986, 1842050, 1842114, 1842178,
+    1842242, 1842306, 1842370, 1842434, 1842498, 1842562, 1842626, 1842690,
+    1842754, 1842818, 1842882, 1842946, 1843010, 1843074, 1843138, 1843202,
+    1843266, 1843330, 1843394, 1843458, 1843522, 1843586, 1843650, 1843714,
+    1843778, 1843842, 1843906, 1843970, 1844034, 1844098, 1844162, 1844226,
+    1844290, 1844354, 1844418, 1844482, 1844546, 1844610, 1844674, 1844738,
+    1844802, 1844866, 1844930, 1844994, 1845058, 1845122, 1845186, 1845250,
+    1845314, 1845378, 1845442, 1845506, 1845570, 1845634, 1845698, 1845762,
+    1845826, 1845890, 1845954, 1846018, 1846082, 1846146, 1846210, 1846274,
+    1846338, 1846402, 1846466, 1846530, 1846594, 1846658, 1846722, 1846786,
+    1846850, 1846914, 1846978, 1847042, 1847106, 1847170, 1847234, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1474, 1538, 1602, 1666, 1730, 1794, 1858, 1922,
+    1986, 1847298, 1847362, 1847426, 1847490, 1847554, 1847618, 1847682,
+    1847746, 1847810, 1474, 1538, 1602, 1666, 1730, 1474,
+    1730, 0, 0, 0, 0, 0, 0, 0,
+    1847874, 513346, 510594, 515010, 513538, 513602, 1847938, 511554,
+    511682, 1848002, 1848066, 511746, 513730, 511938, 1848130, 512258,
+    512322, 512386, 1848194, 1848258, 1848322, 1848386, 1848450, 1848514,
+    1848578, 513090, 1848642, 1848706, 1848770, 515074, 513474, 1848834,
+    511490, 511618, 514114, 515138, 1848898, 511810, 1848962, 1849026,
+    513794, 1849090, 1849154, 1849218, 1849282, 1849346, 1849410, 1849474,
+    1849538, 1849602, 1849666, 1849730, 1847874, 513346, 510594, 515010,
+    513538, 513602, 1847938, 511554, 511682, 1848002, 1848066, 511746,
+    513730, 511938, 1848130, 512258, 512322, 512386, 1848194, 1848258,
+    1848322, 1848386, 1848450, 1848514, 1848578, 513090, 1848642, 1848706,
+    1848770, 515074, 513474, 1848834, 511490, 0, 514114, 515138,
+    1848898, 511810, 1848962, 1849026, 513794, 1849090, 1849154, 1849218,
+    1849282, 1849346, 1849410, 1849474, 1849538, 1849602, 1849666, 1849730,
+    1847874, 513346, 510594, 515010, 513538, 513602, 1847938, 511554,
+    511682, 1848002, 1848066, 511746, 513730, 511938, 1848130, 512258,
+    512322, 512386, 1848194, 1848258, 1848322, 1848386, 1848450, 1848514,
+    1848578, 513090, 1848642, 1848706, 1848770, 515074, 513474, 1848834,
+    511490, 511618, 514114, 515138, 1848898, 511810, 1848962, 1849026,
+    513794, 1849090, 1849154, 1849218, 1849282, 1849346, 1849410, 1849474,
+    1849538, 1849602, 1849666, 1849730, 1847874, 0, 510594, 515010,
+    0, 0, 1847938, 0, 0, 1848002, 1848066, 0,
+    0, 511938, 1848130, 512258, 512322, 0, 1848194, 1848258,
+    1848322, 1848386, 1848450, 1848514, 1848578, 513090, 1848642, 1848706,
+    1848770, 515074, 0, 1848834, 0, 511618, 514114, 515138,
+    1848898, 511810, 1848962, 1849026, 0, 1849090, 1849154, 1849218,
+    1849282, 1849346, 1849410, 1849474, 1849538, 1849602, 1849666, 1849730,
+    1847874, 513346, 510594, 515010, 513538, 513602, 1847938, 511554,
+    511682, 1848002, 1848066, 511746, 513730, 511938, 1848130, 512258,
+    512322, 512386, 1848194, 1848258, 1848322, 1848386, 1848450, 1848514,
+    1848578, 513090, 1848642, 1848706, 1848770, 515074, 513474, 1848834,
+    511490, 511618, 514114, 515138, 1848898, 511810, 1848962, 1849026,
+    513794, 1849090, 1849154, 1849218, 1849282, 1849346, 1849410, 1849474,
+    1849538, 1849602, 1849666, 1849730, 1847874, 513346, 0, 515010,
+    513538, 513602, 1847938, 0, 0, 1848002, 1848066, 511746,
+    513730, 511938, 1848130, 512258, 512322, 0, 1848194, 1848258,
+    1848322, 1848386, 1848450, 1848514, 1848578, 0, 1848642, 1848706,
+    1848770, 515074, 513474, 1848834, 511490, 511618, 514114, 515138,
+    1848898, 511810, 1848962, 1849026, 513794, 1849090, 1849154, 1849218,
+    1849282, 1849346, 1849410, 1849474, 1849538, 1849602, 1849666, 1849730,
+    1847874, 513346, 0, 515010, 513538, 513602, 1847938, 0,
+    511682, 1848002, 1848066, 511746, 513730, 0, 1848130, 0,
+    0, 0, 1848194, 1848258, 1848322, 1848386, 1848450, 1848514,
+    1848578, 0, 1848642, 1848706, 1848770, 515074, 513474, 1848834,
+    511490, 511618, 514114, 515138, 1848898, 511810, 1848962, 1849026,
+    513794, 1849090, 1849154, 1849218, 1849282, 1849346, 1849410, 1849474,
+    1849538, 1849602, 1849666, 1849730, 1847874, 513346, 510594, 515010,
+    513538, 513602, 1847938, 511554, 511682, 1848002, 1848066, 511746,
+    513730, 511938, 1848130, 512258, 512322, 512386, 1848194, 1848258,
+    1848322, 1848386, 1848450, 1848514, 1848578, 513090, 1848642, 1848706,
+    1848770, 515074, 513474, 1848834, 511490, 511618, 514114, 515138,
+    1848898, 511810, 1848962, 1849026, 513794, 1849090, 1849154, 1849218,
+    1849282, 1849346, 1849410, 1849474, 1849538, 1849602, 1849666, 1849730,
+    1847874, 513346, 510594, 515010, 513538, 513602, 1847938, 511554,
+    511682, 1848002, 1848066, 511746, 513730, 511938, 1848130, 512258,
+    512322, 512386, 1848194, 1848258, 1848322, 1848386, 1848450, 1848514,
+    1848578, 513090, 1848642, 1848706, 1848770, 515074, 513474, 1848834,
+    511490, 511618, 514114, 515138, 1848898, 511810, 1848962, 1849026,
+    513794, 1849090, 1849154, 1849218, 1849282, 1849346, 1849410, 1849474,
+    1849538, 1849602, 1849666, 1849730, 1847874, 513346, 510594, 515010,
+    513538, 513602, 1847938, 511554, 511682, 1848002, 1848066, 511746,
+    513730, 511938, 1848130, 512258, 512322, 512386, 1848194, 1848258,
+    1848322, 1848386, 1848450, 1848514, 1848578, 513090, 1848642, 1848706,
+    1848770, 515074, 513474, 1848834, 511490, 511618, 514114, 515138,
+    1848898, 511810, 1848962, 1849026, 513794, 1849090, 1849154, 1849218,
+    1849282, 1849346, 1849410, 1849474, 1849538, 1849602, 1849666, 1849730,
+    1847874, 513346, 510594, 515010, 513538, 513602, 1847938, 511554,
+    511682, 1848002, 1848066, 511746, 513730, 511938, 1848130, 512258,
+    512322, 512386, 1848194, 1848258, 1848322, 1848386, 1848450, 1848514,
+    1848578, 513090, 1848642, 1848706, 1848770, 515074, 513474, 1848834,
+    511490, 511618, 514114, 515138, 1848898, 511810, 1848962, 1849026,
+    513794, 1849090, 1849154, 1849218, 1849282, 1849346, 1849410, 1849474,
+    1849538, 1849602, 1849666, 1849730, 1847874, 513346, 510594, 515010,
+    513538, 513602, 1847938, 511554, 511682, 1848002, 1848066, 511746,
+    513730, 511938, 1848130, 512258, 512322, 512386, 1848194, 1848258,
+    1848322, 1848386, 1848450, 1848514, 1848578, 513090, 1848642, 1848706,
+    1848770, 515074, 513474, 1848834, 511490, 511618, 514114, 515138,
+    1848898, 511810, 1848962, 1849026, 513794, 1849090, 1849154, 1849218,
+    1849282, 1849346, 1849410, 1849474, 1849538, 1849602, 1849666, 1849730,
+    1847874, 513346, 510594, 515010, 513538, 513602, 1847938, 511554,
+    511682, 1848002, 1848066, 511746, 513730, 511938, 1848130, 512258,
+    512322, 512386, 1848194, 1848258, 1848322, 1848386, 1848450, 1848514,
+    1848578, 513090, 1848642, 1848706, 1848770, 515074, 513474, 1848834,
+    511490, 511618, 514114, 515138, 1848898, 511810, 1848962, 1849026,
+    513794, 1849090, 1849154, 1849218, 1849282, 1849346, 1849410, 1849474,
+    1849538, 1849602, 1849666, 1849730, 1849794, 1849858, 0, 0,
+    1849922, 1849986, 514562, 1850050, 1850114, 1850178, 1850242, 1850306,
+    1850370, 1850434, 1850498, 1850562, 1850626, 1850690, 1850754, 514626,
+    1850818, 1850306, 1850882, 1850946, 1851010, 1851074, 1851138, 1851202,
+    1851266, 1851330, 1851394, 1851458, 514498, 1851522, 1851586, 1851650,
+    1851714, 1851778, 1851842, 1851906, 1851970, 1852034, 1852098, 1852162,
+    1852226, 514434, 1852290, 1852354, 1852354, 1852418, 1852482, 1852546,
+    1852610, 1852674, 1852738, 1852802, 1851586, 1851778, 1851906, 1852546,
+    1852290, 514434, 1849922, 1849986, 514562, 1850050, 1850114, 1850178,
+    1850242, 1850306, 1850370, 1850434, 1850498, 1850562, 1850626, 1850690,
+    1850754, 514626, 1850818, 1850306, 1850882, 1850946, 1851010, 1851074,
+    1851138, 1851202, 1851266, 1851330, 1851394, 1851458, 514498, 1851522,
+    1851586, 1851650, 1851714, 1851778, 1851842, 1851906, 1851970, 1852034,
+    1852098, 1852162, 1852226, 514434, 1852290, 1852354, 1852354, 1852418,
+    1852482, 1852546, 1852610, 1852674, 1852738, 1852802, 1851586, 1851778,
+    1851906, 1852546, 1852290, 514434, 1849922, 1849986, 514562, 1850050,
+    1850114, 1850178, 1850242, 1850306, 1850370, 1850434, 1850498, 1850562,
+    1850626, 1850690, 1850754, 514626, 1850818, 1850306, 1850882, 1850946,
+    1851010, 1851074, 1851138, 1851202, 1851266, 1851330, 1851394, 1851458,
+    514498, 1851522, 1851586, 1851650, 1851714, 1851778, 1851842, 1851906,
+    1851970, 1852034, 1852098, 1852162, 1852226, 514434, 1852290, 1852354,
+    1852354, 1852418, 1852482, 1852546, 1852610, 1852674, 1852738, 1852802,
+    1851586, 1851778, 1851906, 1852546, 1852290, 514434, 1849922, 1849986,
+    514562, 1850050, 1850114, 1850178, 1850242, 1850306, 1850370, 1850434,
+    1850498, 1850562, 1850626, 1850690, 1850754, 514626, 1850818, 1850306,
+    1850882, 1850946, 1851010, 1851074, 1851138, 1851202, 1851266, 1851330,
+    1851394, 1851458, 514498, 1851522, 1851586, 1851650, 1851714, 1851778,
+    1851842, 1851906, 1851970, 1852034, 1852098, 1852162, 1852226, 514434,
+    1852290, 1852354, 1852354, 1852418, 1852482, 1852546, 1852610, 1852674,
+    1852738, 1852802, 1851586, 1851778, 1851906, 1852546, 1852290, 514434,
+    1849922, 1849986, 514562, 1850050, 1850114, 1850178, 1850242, 1850306,
+    1850370, 1850434, 1850498, 1850562, 1850626, 1850690, 1850754, 514626,
+    1850818, 1850306, 1850882, 1850946, 1851010, 1851074, 1851138, 1851202,
+    1851266, 1851330, 1851394, 1851458, 514498, 1851522, 1851586, 1851650,
+    1851714, 1851778, 1851842, 1851906, 1851970, 1852034, 1852098, 1852162,
+    1852226, 514434, 1852290, 1852354, 1852354, 1852418, 1852482, 1852546,
+    1852610, 1852674, 1852738, 1852802, 1851586, 1851778, 1851906, 1852546,
+    1852290, 514434, 1852866, 1852930, 0, 0, 1852994, 1853058,
+    1853122, 1853186, 1853250, 1853314, 1853378, 1853442, 1853506, 1853570,
+    1852994, 1853058, 1853122, 1853186, 1853250, 1853314, 1853378, 1853442,
+    1853506, 1853570, 1852994, 1853058, 1853122, 1853186, 1853250, 1853314,
+    1853378, 1853442, 1853506, 1853570, 1852994, 1853058, 1853122, 1853186,
+    1853250, 1853314, 1853378, 1853442, 1853506, 1853570, 1852994, 1853058,
+    1853122, 1853186, 1853250, 1853314, 1853378, 1853442, 1853506, 1853570,
+    1853634, 1853698, 1853762, 1853826, 1853890, 1853954, 1854018, 1854082,
+    1854146, 1854210, 1854274, 1854338, 1854402, 1854466, 1854530, 1854594,
+    1854658, 1854722, 1854786, 1854850, 1854914, 1854978, 1855042, 1855106,
+    1855170, 1855234, 1855298, 1855362, 1855426, 1855490, 1855554, 1855618,
+    1855682, 1855746, 1855810, 1855874, 1855938, 1856002, 1856066, 1856130,
+    1856194, 1856258, 1856322, 1856386, 1856450, 1856514, 1856578, 1856642,
+    1856706, 1856770, 1856834, 1856898, 1856962, 1857026, 1857090, 1857154,
+    1857218, 1857282, 1857346, 1857410, 1857474, 1857538, 1857602, 1857666,
+    1857730, 1857794, 1857858, 1857922, 1857986, 1858050, 1858114, 1858178,
+    1858242, 1858306, 1858370, 1858434, 1858498, 1858562, 1858626, 1858690,
+    1858754, 1858818, 1858882, 1858946, 1859010, 1859074, 1859138, 1859202,
+    1859266, 1859330, 1859394, 1859458, 1859522, 1859586, 1859650, 1859714,
+    1859778, 1859842, 1859906, 1859970, 1860034, 1860098, 1860162, 1860226,
+    1860290, 1860354, 1860418, 1860482, 1860546, 1860610, 1860674, 1860738,
+    1860802, 1860866, 1860930, 1860994, 1861058, 1861122, 1861186, 1861250,
+    1861314, 1861378, 1861442, 1861506, 1861570, 1861634, 1861698, 1861762,
+    1861826, 1861890, 1861954, 1862018, 1862082, 1862146, 1862210, 1862274,
+    1862338, 1862402, 1862466, 1862530, 1862594, 1862658, 1862722, 1862786,
+    1862850, 1862914, 1862978, 1863042, 1863106, 1863170, 1863234, 1863298,
+    1863362, 1863426, 1863490, 1863554, 1863618, 1863682, 1863746, 1863810,
+    1863874, 1863938, 1864002, 1864066, 1864130, 1864194, 1864258, 1864322,
+    1864386, 1864450, 1864514, 1864578, 1864642, 1864706, 1864770, 1864834,
+    1864898, 1864962, 1865026, 1865090, 1865154, 1865218, 1865282, 1865346,
+    1865410, 1865474, 1865538, 1865602, 1865666, 1865730, 1865794, 1865858,
+    1865922, 1865986, 1866050, 1866114, 1866178, 1866242, 1866306, 1866370,
+    1866434, 1866498, 1866562, 1866626, 1866690, 1866754, 1866818, 1866882,
+    1866946, 1867010, 1867074, 1867138, 1867202, 1867266, 1867330, 1867394,
+    1867458, 1867522, 1867586, 1867650, 1867714, 1867778, 1867842, 1867906,
+    1867970, 1868034, 1868098, 1868162, 1868226, 1868290, 1868354, 1868418,
+    1868482, 1868546, 1868610, 1868674, 1868738, 1868802, 1868866, 1868930,
+    1868994, 1869058, 1869122, 1869186, 1869250, 1869314, 1869378, 1869442,
+    1869506, 1869570, 1869634, 1869698, 1869762, 1869826, 1869890, 1869954,
+    1870018, 1870082, 1870146, 1870210, 1870274, 1870338, 1870402, 1870466,
+    1870530, 1870594, 1870658, 1870722, 1870786, 1870850, 1870914, 1870978,
+    1871042, 1871106, 1871170, 1871234, 1871298, 1871362, 1871426, 1871490,
+    1871554, 1871618, 1871682, 1871746, 1871810, 1871874, 1871938, 1872002,
+    1872066, 1872130, 1872194, 1872258, 1872322, 1872386, 1872450, 1872514,
+    1872578, 1872642, 1872706, 1872770, 1872834, 1872898, 1872962, 1873026,
+    1873090, 1873154, 1873218, 1873282, 1873346, 1873410, 1873474, 1873538,
+    1873602, 1873666, 1873730, 1873794, 1873858, 1873922, 1873986, 1874050,
+    1874114, 1874178, 1874242, 1874306, 1874370, 1874434, 1874498, 1874562,
+    1874626, 1874690, 1874754, 1874818, 1874882, 1874946, 1875010, 1875074,
+    1875138, 1875202, 1875266, 1875330, 1875394, 1875458, 1875522, 1875586,
+    1875650, 1875714, 1875778, 1875842, 1875906, 1875970, 1876034, 1876098,
+    1876162, 1876226, 1876290, 1876354, 1876418, 1876482, 1876546, 1876610,
+    1876674, 1876738, 1876802, 1876866, 1876930, 1876994, 1877058, 1877122,
+    1877186, 1877250, 1877314, 1877378, 1877442, 1877506, 1877570, 1877634,
+    1877698, 1877762, 1877826, 1877890, 1877954, 1878018, 1878082, 1878146,
+    1878210, 1878274, 1878338, 1878402, 1878466, 1878530, 1878594, 1878658,
+    1878722, 1878786, 1878850, 1878914, 1878978, 1879042, 1879106, 1879170,
+    1879234, 1879298, 1879362, 1879426, 1879490, 1879554, 1879618, 1879682,
+    1879746, 1879810, 1879874, 1879938, 1880002, 1880066, 1880130, 1880194,
+    1880258, 1880322, 1880386, 1880450, 1880514, 1880578, 1880642, 1880706,
+    1880770, 1880834, 1880898, 1880962, 1881026, 1881090, 1881154, 1881218,
+    1881282, 1881346, 1881410, 1881474, 1881538, 1881602, 1881666, 1881730,
+    1881794, 1881858, 1881922, 1881986, 1882050, 1882114, 1882178, 1882242,
+    1882306, 1882370, 1882434, 1882498, 1882562, 1882626, 1882690, 1882754,
+    1882818, 1882882, 1882946, 1883010, 1883074, 1883138, 1883202, 1883266,
+    1883330, 1883394, 1883458, 1883522, 1883586, 1883650, 1883714, 1883778,
+    1883842, 1883906, 1883970, 1884034, 1884098, 1884162, 1884226, 1884290,
+    1884354, 1884418, 1884482, 1884546, 1884610, 1884674, 1884738, 1884802,
+    1884866, 1884930, 1884994, 1885058, 1885122, 1885186, 1885250, 1885314,
+    1885378, 1885442, 1885506, 1885570, 1885634, 1885698, 1885762, 1885826,
+    1885890, 1885954, 1886018, 1886082, 1886146, 1886210, 1886274, 1886338,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 1886402,
+    1886466, 1886530, 1886594, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 1886658, 1886722, 1886786,
+    1886850, 1886914, 1886978, 1887042, 1887106, 2, 1887170, 1887234,
+    1887298, 1887362, 1887426, 1887490, 1887554, 1887618, 1887682, 1887746,
+    1887810, 1887874, 1887938, 1888002, 2, 1888066, 1888130, 1888194,
+    1888258, 1888322, 1888386, 1888450, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 2, 2, 2,
+    0, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1888514, 1888578, 1888642, 1888706, 1888770, 1888834, 1888898, 0,
+    1888962, 1889026, 1889090, 1889154, 1889218, 1889282, 1889346, 1889410,
+    1889474, 1889538, 1889602, 1889666, 1889730, 1889794, 1889858, 1889922,
+    1889986, 0, 0, 1890050, 1890114, 1890178, 1890242, 1890306,
+    1890370, 1890434, 0, 1890498, 1890562, 0, 1890626, 1890690,
+    1890754, 1890818, 1890882, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1890946, 1891010, 1891074, 1891138, 1891202, 1891266, 1891330, 1891394,
+    1891458, 1891522, 1891586, 1891650, 1891714, 1891778, 1891842, 1891906,
+    1891970, 1892034, 1892098, 1892162, 1892226, 1892290, 1892354, 1892418,
+    1892482, 1892546, 1892610, 1892674, 1892738, 1892802, 1892866, 1892930,
+    1892994, 1893058, 1893122, 1893186, 1893250, 1893314, 1893378, 1893442,
+    1893506, 1893570, 1893634, 1893698, 1893762, 0, 0, 0,
+    1761154, 1760898, 1761026, 1761090, 1761218, 1761282, 1760962, 1893826,
+    1893890, 1893954, 1894018, 1894082, 1894146, 1894210, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 1894274, 1894338,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1894402, 1894466, 1894530, 1894594, 1894658, 1894722, 1894786, 1894850,
+    1894914, 1894978, 1895042, 1895106, 1895170, 1895234, 1895298, 1895362,
+    1895426, 1895490, 1895554, 1895618, 1895682, 1895746, 1895810, 1895874,
+    1895938, 1896002, 1896066, 1896130, 1896194, 1896258, 1896322, 1896386,
+    1896450, 1896514, 1896578, 1896642, 1896706, 1896770, 1896834, 1896898,
+    1896962, 1897026, 1897090, 1897154, 1897218, 1897282, 1897346, 1897410,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 0, 1897474,
+    1897538, 1897602, 1897666, 1897730, 1897794, 1897858, 1897922, 1897986,
+    1898050, 1898114, 1898178, 1898242, 1898306, 1898370, 1898434, 1898498,
+    1898562, 1898626, 1898690, 1898754, 1898818, 1898882, 1898946, 1899010,
+    1899074, 1899138, 1899202, 1899266, 1899330, 1899394, 1899458, 1899522,
+    1899586, 1899650, 1899714, 1899778, 1899842, 1899906, 1899970, 1900034,
+    1900098, 1900162, 1900226, 1900290, 1900354, 1900418, 1900482, 1900546,
+    1900610, 1900674, 1900738, 1900802, 1900866, 1900930, 1900994, 1901058,
+    1901122, 1901186, 1901250, 1901314, 1901378, 1901442, 1901506, 1901570,
+    1901634, 1901698, 1901762, 1901826, 1901890, 1901954, 1902018, 1902082,
+    1902146, 1902210, 1902274, 1902338, 1902402, 1902466, 1902530, 1902594,
+    1902658, 1902722, 1902786, 1902850, 1902914, 1902978, 1903042, 1903106,
+    1903170, 1903234, 1903298, 1903362, 1903426, 1903490, 1903554, 1903618,
+    1903682, 1903746, 1903810, 1903874, 1903938, 1904002, 1904066, 1904130,
+    1904194, 1904258, 1904322, 1904386, 1904450, 1904514, 1904578, 1904642,
+    1904706, 1904770, 1904834, 1904898, 1904962, 1905026, 1905090, 1905154,
+    1905218, 1905282, 1905346, 1905410, 1905474, 1905538, 1905602, 1905666,
+    1905730, 1905794, 1905858, 1905922, 1905986, 1906050, 1906114, 1906178,
+    1906242, 1906306, 1906370, 1906434, 1906498, 1906562, 1906626, 1906690,
+    1906754, 1906818, 1906882, 1906946, 1907010, 1907074, 1907138, 1907202,
+    1907266, 1907330, 1907394, 1907458, 1907522, 1907586, 1907650, 1907714,
+    1907778, 1907842, 1907906, 1907970, 1908034, 1908098, 1908162, 1908226,
+    1908290, 1908354, 1908418, 1908482, 1908546, 1908610, 1908674, 1908738,
+    1908802, 1908866, 1908930, 1908994, 1909058, 1909122, 1909186, 1909250,
+    1909314, 1909378, 1909442, 1909506, 1909570, 1909634, 1909698, 1909762,
+    1909826, 1909890, 1909954, 1910018, 1910082, 0, 0, 1474,
+    1538, 1602, 1666, 1730, 1794, 1858, 1922, 1986,
+    2, 2, 2, 2, 2, 2, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1910146, 1910210, 1910274, 1910338, 1910402, 1910466, 1910530, 1910594,
+    1910658, 1910722, 1910786, 1910850, 1910914, 1910978, 1911042, 1911106,
+    1911170, 1911234, 1911298, 1911362, 1911426, 1911490, 1911554, 1911618,
+    1911682, 1911746, 1911810, 1911874, 1911938, 1912002, 1912066, 1912130,
+    1912194, 1912258, 1912322, 1912386, 1912450, 1912514, 1912578, 1912642,
+    1912706, 1912770, 1912834, 1912898, 1912962, 1913026, 1913090, 1913154,
+    1913218, 1913282, 1913346, 1913410, 1913474, 1913538, 1913602, 1913666,
+    1913730, 1913794, 1913858, 1913922, 1913986, 1914050, 1914114, 1914178,
+    1914242, 1914306, 1914370, 1914434, 1914498, 1914498, 1914498, 1914562,
+    1914626, 1914690, 1914754, 1914818, 0, 0, 0, 0,
+    1410, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 0, 0, 0, 0, 1914882, 1914946,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1915010, 1915074, 1915138, 1915202, 1915266, 1915330,
+    1915394, 1915458, 1915522, 1915586, 1915650, 1915714, 1915778, 1915842,
+    1915906, 1915970, 1916034, 1916098, 1916162, 1916226, 1916290, 1916354,
+    1916418, 1916482, 1916546, 1916610, 1916674, 1916738, 1916802, 1916866,
+    1916930, 1916994, 1917058, 1917122, 1917186, 1917250, 1917314, 1917378,
+    1917442, 1917506, 1917570, 1474, 1538, 1602, 1666, 1730,
+    1794, 1858, 1922, 1986, 1917634, 1917698, 1917762, 1917826,
+    1917890, 1770052, 1770180, 1917954, 1918018, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1474, 1538, 1602, 1666, 1730, 1794, 1858,
+    1922, 1986, 1918082, 1918146, 1918210, 1918274, 1918338, 1918402,
+    1918466, 1918530, 1918594, 1918658, 1918722, 1918786, 1918850, 1918914,
+    1918978, 1919042, 1919106, 1919170, 1919234, 1919298, 1919362, 1919426,
+    1919490, 1919554, 1919618, 1919682, 1919746, 1919810, 1919874, 1919938,
+    1920002, 1920066, 1920130, 1920194, 1920258, 1920322, 1920386, 1770180,
+    1920452, 1920580, 1920708, 1920836, 1920964, 1921092, 1921220, 1921346,
+    1921410, 1921474, 1921538, 1921602, 1921666, 1921730, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1921794, 1921858, 1921922, 1921986, 0, 1922050, 1922114, 1922178,
+    1922242, 1922306, 1922370, 1922434, 1922498, 1922562, 1922626, 1922690,
+    1922754, 1922818, 1922882, 1922946, 1923010, 1923074, 1923138, 1923202,
+    1923266, 1923330, 1923394, 1923458, 1923522, 1923586, 1923650, 1923714,
+    0, 1921858, 1921922, 0, 1923778, 0, 0, 1922178,
+    0, 1922306, 1922370, 1922434, 1922498, 1922562, 1922626, 1922690,
+    1922754, 1922818, 1922882, 0, 1923010, 1923074, 1923138, 1923202,
+    0, 1923330, 0, 1923458, 0, 0, 0, 0,
+    0, 0, 1921922, 0, 0, 0, 0, 1922178,
+    0, 1922306, 0, 1922434, 0, 1922562, 1922626, 1922690,
+    0, 1922818, 1922882, 0, 1923010, 0, 0, 1923202,
+    0, 1923330, 0, 1923458, 0, 1923586, 0, 1923714,
+    0, 1921858, 1921922, 0, 1923778, 0, 0, 1922178,
+    1922242, 1922306, 1922370, 0, 1922498, 1922562, 1922626, 1922690,
+    1922754, 1922818, 1922882, 0, 1923010, 1923074, 1923138, 1923202,
+    0, 1923330, 1923394, 1923458, 1923522, 0, 1923650, 0,
+    1921794, 1921858, 1921922, 1921986, 1923778, 1922050, 1922114, 1922178,
+    1922242, 1922306, 0, 1922434, 1922498, 1922562, 1922626, 1922690,
+    1922754, 1922818, 1922882, 1922946, 1923010, 1923074, 1923138, 1923202,
+    1923266, 1923330, 1923394, 1923458, 0, 0, 0, 0,
+    0, 1921858, 1921922, 1921986, 0, 1922050, 1922114, 1922178,
+    1922242, 1922306, 0, 1922434, 1922498, 1922562, 1922626, 1922690,
+    1922754, 1922818, 1922882, 1922946, 1923010, 1923074, 1923138, 1923202,
+    1923266, 1923330, 1923394, 1923458, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1923842, 1923906, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1923970, 1924034, 1924098, 1924162, 1924226, 1924290, 1924354, 1924418,
+    1924482, 1924546, 1924610, 1924674, 1924738, 1924802, 1924866, 1924930,
+    1924994, 1925058, 1925122, 1925186, 1925250, 1925314, 1925378, 1925442,
+    1925506, 1925570, 1925634, 1925698, 1925762, 1925826, 1925890, 1925954,
+    1926018, 1926082, 1926146, 1926210, 1926274, 1926338, 1926402, 1926466,
+    1926530, 1926594, 1926658, 1926722, 0, 0, 0, 0,
+    1926786, 1926850, 1926914, 1926978, 1927042, 1927106, 1927170, 1927234,
+    1927298, 1927362, 1927426, 1927490, 1927554, 1927618, 1927682, 1927746,
+    1927810, 1927874, 1927938, 1928002, 1928066, 1928130, 1928194, 1928258,
+    1928322, 1928386, 1928450, 1928514, 1928578, 1928642, 1928706, 1928770,
+    1928834, 1928898, 1928962, 1929026, 1929090, 1929154, 1929218, 1929282,
+    1929346, 1929410, 1929474, 1929538, 1929602, 1929666, 1929730, 1929794,
+    1929858, 1929922, 1929986, 1930050, 1930114, 1930178, 1930242, 1930306,
+    1930370, 1930434, 1930498, 1930562, 1930626, 1930690, 1930754, 1930818,
+    1930882, 1930946, 1931010, 1931074, 1931138, 1931202, 1931266, 1931330,
+    1931394, 1931458, 1931522, 1931586, 1931650, 1931714, 1931778, 1931842,
+    1931906, 1931970, 1932034, 1932098, 1932162, 1932226, 1932290, 1932354,
+    1932418, 1932482, 1932546, 1932610, 1932674, 1932738, 1932802, 1932866,
+    1932930, 1932994, 1933058, 1933122, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1933186, 1933250, 1933314, 1933378, 1933442, 1933506, 1933570, 1933634,
+    1933698, 1933762, 1933826, 1933890, 1933954, 1934018, 1934082, 0,
+    0, 1934146, 1934210, 1934274, 1934338, 1934402, 1934466, 1934530,
+    1934594, 1934658, 1934722, 1934786, 1934850, 1934914, 1934978, 1935042,
+    0, 1935106, 1935170, 1935234, 1935298, 1935362, 1935426, 1935490,
+    1935554, 1935618, 1935682, 1935746, 1935810, 1935874, 1935938, 1936002,
+    0, 1936066, 1936130, 1936194, 1936258, 1936322, 1936386, 1936450,
+    1936514, 1936578, 1936642, 1936706, 1936770, 1936834, 1936898, 1936962,
+    1937026, 1937090, 1937154, 1937218, 1937282, 1937346, 1937410, 1937474,
+    1937538, 1937602, 1937666, 1937730, 1937794, 1937858, 1937922, 1937986,
+    1938050, 1938114, 1938178, 1938242, 1938306, 1938370, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1938436, 1938564, 1938692, 1938820, 1938948, 1939076, 1939204, 1939332,
+    1939460, 1939588, 1939716, 587458, 587458, 1939842, 1939906, 1939970,
+    1940038, 1940230, 1940422, 1940614, 1940806, 1940998, 1941190, 1941382,
+    1941574, 1941766, 1941958, 1942150, 1942342, 1942534, 1942726, 1942918,
+    1943110, 1943302, 1943494, 1943686, 1943878, 1944070, 1944262, 1944454,
+    1944646, 1944838, 1945030, 584258, 585218, 1945220, 1945348, 1945474,
+    410306, 410562, 1945538, 410690, 410754, 1945602, 410882, 410946,
+    411010, 411074, 411138, 411202, 411266, 411330, 411458, 411586,
+    1945666, 411650, 1945730, 411714, 411778, 708546, 411842, 1945794,
+    1945858, 1945922, 1945988, 894596, 1946116, 1946244, 1946374, 1946564,
+    584130, 584194, 584258, 584322, 584386, 584450, 584514, 584578,
+    584642, 584706, 584770, 584834, 584898, 584962, 585026, 585090,
+    585154, 585218, 585282, 585346, 585410, 585474, 585538, 585602,
+    585666, 585730, 1946692, 1946820, 1946948, 1947074, 1947138, 1947202,
+    410306, 410562, 1945538, 410690, 410754, 1945602, 410882, 410946,
+    411010, 411074, 411138, 411202, 411266, 411330, 411458, 411586,
+    1945666, 411650, 1945730, 411714, 411778, 708546, 411842, 1945794,
+    1945858, 1945922, 411586, 1947268, 1947396, 1947524, 1947652, 1946564,
+    1947780, 1947908, 1948040, 1948296, 1948548, 1948678, 1948868, 1948996,
+    1949126, 1949318, 1949508, 1949636, 1949774, 1950212, 1950340, 1950468,
+    1950598, 1950790, 1950984, 1951238, 1951432, 1951682, 1951748, 1951878,
+    1952076, 1952464, 1952966, 1953158, 1953350, 1953538, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1953602, 1953666,
+    1953730, 1953794, 1953858, 1953922, 1953986, 1954050, 1954114, 1954178,
+    1954242, 1954306, 1954370, 1954434, 1954498, 1954562, 1954626, 1954690,
+    1954754, 1954818, 1954882, 1954946, 1955010, 1955074, 1955138, 1955202,
+    1955268, 1955396, 1955522, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1955588, 1955716, 1955844, 1955972, 1956100, 1956228, 1956356, 1956484,
+    1956612, 1956740, 1956868, 1956996, 1957124, 1957252, 1957380, 1957508,
+    1957636, 1957764, 1957892, 1958020, 1958148, 1958276, 1958404, 1958532,
+    1958660, 1958788, 1958916, 1959044, 1959172, 1959300, 1959428, 1959556,
+    1959684, 1959812, 1959940, 1960068, 1960196, 1960324, 1960452, 1960580,
+    1960708, 1960836, 1960964, 1961092, 0, 0, 0, 0,
+    1961224, 1961480, 1961736, 1961992, 1962248, 1962504, 1962760, 1963016,
+    1963272, 0, 0, 0, 0, 0, 0, 0,
+    1963524, 1963652, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1963778, 1963842, 1963906, 1963970, 1964034, 1964098, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1964162, 1964226, 1964290, 1964354, 1964418, 1964482, 1964546, 1964610,
+    1964674, 1964738, 1964802, 1964866, 1964930, 1964994, 1965058, 1965122,
+    1965186, 1965250, 1965314, 1965378, 1965442, 1965506, 1965570, 1965634,
+    1965698, 1965762, 1965826, 1965890, 1965954, 1966018, 1966082, 1966146,
+    1966210, 1966274, 1966338, 1966402, 1966466, 1966530, 1966594, 1966658,
+    1966722, 1966786, 1966850, 1966914, 1966978, 1967042, 1967106, 1967170,
+    1967234, 1967298, 1967362, 1967426, 1967490, 1967554, 1967618, 1967682,
+    1967746, 1967810, 1967874, 1967938, 1968002, 1968066, 1968130, 1968194,
+    1968258, 1968322, 1968386, 1968450, 1968514, 1968578, 1968642, 1968706,
+    1968770, 1968834, 1968898, 1968962, 1969026, 1969090, 1969154, 1969218,
+    1969282, 1969346, 1969410, 1969474, 1969538, 1969602, 1969666, 1969730,
+    1969794, 1969858, 1969922, 1969986, 1970050, 1970114, 1970178, 1970242,
+    1970306, 1970370, 1970434, 1970498, 1970562, 1970626, 1970690, 1970754,
+    1970818, 1970882, 1970946, 1971010, 1971074, 1971138, 1971202, 1971266,
+    1971330, 1971394, 1971458, 1971522, 1971586, 1971650, 1971714, 1971778,
+    1971842, 1971906, 1971970, 1972034, 1972098, 1972162, 1972226, 1972290,
+    1972354, 1972418, 1972482, 1972546, 1972610, 1972674, 1972738, 1972802,
+    1972866, 1972930, 1972994, 1973058, 1973122, 1973186, 1973250, 1973314,
+    1973378, 1973442, 1973506, 1973570, 1973634, 1973698, 1973762, 1973826,
+    1973890, 1973954, 1974018, 1974082, 1974146, 1974210, 1974274, 1974338,
+    1974402, 1974466, 1974530, 1974594, 1974658, 1974722, 1974786, 1974850,
+    1974914, 1974978, 1975042, 1975106, 1975170, 1975234, 1975298, 1975362,
+    1975426, 1975490, 1975554, 1975618, 1975682, 1975746, 1975810, 1975874,
+    1975938, 1976002, 1976066, 1976130, 1976194, 1976258, 1976322, 1976386,
+    1976450, 1976514, 1976578, 1976642, 1976706, 1976770, 1976834, 1976898,
+    1976962, 1977026, 1977090, 1977154, 1977218, 1977282, 1977346, 1977410,
+    1977474, 1977538, 1977602, 1977666, 1977730, 1977794, 1977858, 1977922,
+    1977986, 1978050, 1978114, 1978178, 1978242, 1978306, 1978370, 1978434,
+    1978498, 1978562, 1978626, 1978690, 1978754, 1978818, 1978882, 1978946,
+    1979010, 1979074, 1979138, 1979202, 1979266, 1979330, 1979394, 1979458,
+    1979522, 1979586, 1979650, 1979714, 1979778, 1979842, 1979906, 1979970,
+    1980034, 1980098, 1980162, 1980226, 1980290, 1980354, 1980418, 1980482,
+    1980546, 1980610, 1980674, 1980738, 1980802, 1980866, 1980930, 1980994,
+    1981058, 1981122, 1981186, 1981250, 1981314, 1981378, 1981442, 1981506,
+    1981570, 1981634, 1981698, 1981762, 1981826, 1981890, 1981954, 1982018,
+    1982082, 1982146, 1982210, 1982274, 1982338, 1982402, 1982466, 1982530,
+    1982594, 1982658, 1982722, 1982786, 1982850, 1982914, 1982978, 1983042,
+    1983106, 1983170, 1983234, 1983298, 1983362, 1983426, 1983490, 1983554,
+    1983618, 1983682, 1983746, 1983810, 1983874, 1983938, 1984002, 1984066,
+    1984130, 1984194, 1984258, 1984322, 1984386, 1984450, 1984514, 1984578,
+    1984642, 1984706, 1984770, 1984834, 1984898, 1984962, 1985026, 1985090,
+    1985154, 1985218, 1985282, 1985346, 1985410, 1985474, 1985538, 1985602,
+    1985666, 1985730, 1985794, 1985858, 1985922, 1985986, 1986050, 1986114,
+    1986178, 1986242, 1986306, 1986370, 1986434, 1986498, 1986562, 1986626,
+    1986690, 1986754, 1986818, 1986882, 1986946, 1987010, 1987074, 1987138,
+    1987202, 1987266, 1987330, 1987394, 1987458, 1987522, 1987586, 1987650,
+    1987714, 1987778, 1987842, 1987906, 1987970, 1988034, 1988098, 1988162,
+    1988226, 1988290, 1988354, 1988418, 1988482, 1988546, 1988610, 1988674,
+    1988738, 1988802, 1988866, 1988930, 1988994, 1989058, 1989122, 1989186,
+    1989250, 1989314, 1989378, 1989442, 1989506, 1989570, 1989634, 1989698,
+    1989762, 1989826, 1989890, 1989954, 1990018, 1990082, 1990146, 1990210,
+    1990274, 1990338, 1990402, 1990466, 1990530, 1990594, 1990658, 1990722,
+    1990786, 1990850, 1990914, 1990978, 1991042, 1991106, 1991170, 1991234,
+    1991298, 1991362, 1991426, 1991490, 1991554, 1991618, 1991682, 1991746,
+    1991810, 1991874, 1991938, 1992002, 1992066, 1992130, 1992194, 1992258,
+    1992322, 1992386, 1992450, 1992514, 1992578, 1992642, 1992706, 1992770,
+    1992834, 1992898, 1992962, 1993026, 1993090, 1993154, 1993218, 1993282,
+    1993346, 1993410, 1993474, 1993538, 1993602, 1993666, 1993730, 1993794,
+    1993858, 1993922, 1993986, 1994050, 1994114, 1994178, 1994242, 1994306,
+    1994370, 1994434, 1994498, 1994562, 1994626, 1994690, 1994754, 1994818,
+    1994882, 1994946, 1995010, 1995074, 1995138, 1995202, 1995266, 1995330,
+    1995394, 1995458, 1995522, 1995586, 1995650, 1995714, 1995778, 1995842,
+    1995906, 1995970, 1996034, 1996098, 1996162, 1996226, 1996290, 1996354,
+    1996418, 1996482, 1996546, 1996610, 1996674, 1996738, 1996802, 1996866,
+    1996930, 1996994, 1997058, 1997122, 1997186, 1997250, 1997314, 1997378,
+    1997442, 1997506, 1997570, 1997634, 1997698, 1997762, 1997826, 1997890,
+    1997954, 1998018, 1998082, 1998146, 1998210, 1998274, 1998338, 1998402,
+    1998466, 1998530, 1998594, 1998658, 1998722, 1998786, 1998850, 1998914,
+    1998978, 1999042, 1999106, 1999170, 1999234, 1999298, 1999362, 1999426,
+    1999490, 1999554, 1999618, 1999682, 1999746, 1999810, 1999874, 1999938,
+    2000002, 2000066, 2000130, 2000194, 2000258, 2000322, 2000386, 2000450,
+    2000514, 2000578, 2000642, 2000706, 2000770, 2000834, 2000898, 2000962,
+    2001026, 2001090, 2001154, 2001218, 2001282, 2001346, 2001410, 2001474,
+    2001538, 2001602, 2001666, 2001730, 2001794, 2001858, 2001922, 2001986,
+    2002050, 2002114, 2002178, 2002242, 2002306, 2002370, 2002434, 2002498,
+    2002562, 2002626, 2002690, 2002754, 2002818, 2002882, 2002946, 2003010,
+    2003074, 2003138, 2003202, 2003266, 2003330, 2003394, 2003458, 2003522,
+    2003586, 2003650, 2003714, 2003778, 2003842, 2003906, 2003970, 2004034,
+    2004098, 2004162, 2004226, 2004290, 2004354, 2004418, 2004482, 2004546,
+    2004610, 2004674, 2004738, 2004802, 2004866, 2004930, 2004994, 2005058,
+    2005122, 2005186, 2005250, 2005314, 2005378, 2005442, 2005506, 2005570,
+    2005634, 2005698, 2005762, 2005826, 2005890, 2005954, 2006018, 2006082,
+    2006146, 2006210, 2006274, 2006338, 2006402, 2006466, 2006530, 2006594,
+    2006658, 2006722, 2006786, 2006850, 2006914, 2006978, 2007042, 2007106,
+    2007170, 2007234, 2007298, 2007362, 2007426, 2007490, 2007554, 2007618,
+    2007682, 2007746, 2007810, 2007874, 2007938, 2008002, 2008066, 2008130,
+    2008194, 2008258, 2008322, 2008386, 2008450, 2008514, 2008578, 2008642,
+    2008706, 2008770, 2008834, 2008898, 2008962, 2009026, 2009090, 2009154,
+    2009218, 2009282, 2009346, 2009410, 2009474, 2009538, 2009602, 2009666,
+    2009730, 2009794, 2009858, 2009922, 2009986, 2010050, 2010114, 2010178,
+    2010242, 2010306, 2010370, 2010434, 2010498, 2010562, 2010626, 2010690,
+    2010754, 2010818, 2010882, 2010946, 2011010, 2011074, 2011138, 2011202,
+    2011266, 2011330, 2011394, 2011458, 2011522, 2011586, 2011650, 2011714,
+    2011778, 2011842, 2011906, 2011970, 2012034, 2012098, 2012162, 2012226,
+    2012290, 2012354, 2012418, 2012482, 2012546, 2012610, 2012674, 2012738,
+    2012802, 2012866, 2012930, 2012994, 2013058, 2013122, 2013186, 2013250,
+    2013314, 2013378, 2013442, 2013506, 2013570, 2013634, 2013698, 2013762,
+    2013826, 2013890, 2013954, 2014018, 2014082, 2014146, 2014210, 2014274,
+    2014338, 2014402, 2014466, 2014530, 2014594, 2014658, 2014722, 2014786,
+    2014850, 2014914, 2014978, 2015042, 2015106, 2015170, 2015234, 2015298,
+    2015362, 2015426, 2015490, 2015554, 2015618, 2015682, 2015746, 2015810,
+    2015874, 2015938, 2016002, 2016066, 2016130, 2016194, 2016258, 2016322,
+    2016386, 2016450, 2016514, 2016578, 2016642, 2016706, 2016770, 2016834,
+    2016898, 2016962, 2017026, 2017090, 2017154, 2017218, 2017282, 2017346,
+    2017410, 2017474, 2017538, 2017602, 2017666, 2017730, 2017794, 2017858,
+    2017922, 2017986, 2018050, 2018114, 2018178, 2018242, 2018306, 2018370,
+    2018434, 2018498, 2018562, 2018626, 2018690, 2018754, 2018818, 2018882,
+    2018946, 2019010, 2019074, 2019138, 2019202, 2019266, 2019330, 2019394,
+    2019458, 2019522, 2019586, 2019650, 2019714, 2019778, 2019842, 2019906,
+    2019970, 2020034, 2020098, 2020162, 2020226, 2020290, 2020354, 2020418,
+    2020482, 2020546, 2020610, 2020674, 2020738, 2020802, 2020866, 2020930,
+    2020994, 2021058, 2021122, 2021186, 2021250, 2021314, 2021378, 2021442,
+    2021506, 2021570, 2021634, 2021698, 2021762, 2021826, 2021890, 2021954,
+    2022018, 2022082, 2022146, 2022210, 2022274, 2022338, 2022402, 2022466,
+    2022530, 2022594, 2022658, 2022722, 2022786, 2022850, 2022914, 2022978,
+    2023042, 2023106, 2023170, 2023234, 2023298, 2023362, 2023426, 2023490,
+    2023554, 2023618, 2023682, 2023746, 2023810, 2023874, 2023938, 2024002,
+    2024066, 2024130, 2024194, 2024258, 2024322, 2024386, 2024450, 2024514,
+    2024578, 2024642, 2024706, 2024770, 2024834, 2024898, 2024962, 2025026,
+    2025090, 2025154, 2025218, 2025282, 2025346, 2025410, 2025474, 2025538,
+    2025602, 2025666, 2025730, 2025794, 2025858, 2025922, 2025986, 2026050,
+    2026114, 2026178, 2026242, 2026306, 2026370, 2026434, 2026498, 2026562,
+    2026626, 2026690, 2026754, 2026818, 2026882, 2026946, 2027010, 2027074,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2027138, 2027202, 2027266, 2027330, 2027394, 2027458, 2027522, 2027586,
+    2027650, 2027714, 2027778, 2027842, 2027906, 0, 0, 0,
+    2027970, 2028034, 2028098, 2028162, 2028226, 2028290, 2028354, 2028418,
+    2028482, 2028546, 2028610, 2028674, 2028738, 0, 0, 0,
+    2028802, 2028866, 2028930, 2028994, 2029058, 2029122, 2029186, 2029250,
+    2029314, 2029378, 2029442, 2029506, 2029570, 2029634, 2029698, 2029762,
+    2029826, 2029890, 2029954, 2030018, 2030082, 2030146, 2030210, 2030274,
+    2030338, 2030402, 2030466, 2030530, 2030594, 2030658, 2030722, 2030786,
+    2030850, 2030914, 2030978, 2031042, 2031106, 2031170, 2031234, 2031298,
+    2031362, 2031426, 2031490, 2031554, 2031618, 2031682, 2031746, 2031810,
+    2031874, 2031938, 2032002, 2032066, 2032130, 2032194, 2032258, 2032322,
+    2032386, 2032450, 2032514, 2032578, 2032642, 2032706, 2032770, 2032834,
+    2032898, 2032962, 2033026, 2033090, 2033154, 2033218, 2033282, 2033346,
+    2033410, 2033474, 2033538, 2033602, 2033666, 2033730, 2033794, 2033858,
+    2033922, 2033986, 2034050, 2034114, 2034178, 2034242, 2034306, 2034370,
+    2034434, 2034498, 2034562, 2034626, 2034690, 2034754, 2034818, 2034882,
+    2034946, 2035010, 2035074, 2035138, 2035202, 2035266, 2035330, 2035394,
+    2035458, 2035522, 2035586, 2035650, 2035714, 2035778, 2035842, 2035906,
+    2035970, 2036034, 2036098, 2036162, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2036226, 2036290, 2036354, 2036418, 2036482, 2036546, 2036610, 2036674,
+    2036738, 2036802, 2036866, 2036930, 2036994, 2037058, 2037122, 2037186,
+    2037250, 2037314, 2037378, 2037442, 2037506, 2037570, 2037634, 2037698,
+    2037762, 2037826, 2037890, 2037954, 2038018, 2038082, 2038146, 2038210,
+    2038274, 2038338, 2038402, 2038466, 2038530, 2038594, 2038658, 2038722,
+    2038786, 2038850, 2038914, 2038978, 2039042, 2039106, 2039170, 2039234,
+    2039298, 2039362, 2039426, 2039490, 2039554, 2039618, 2039682, 2039746,
+    2039810, 2039874, 2039938, 2040002, 2040066, 2040130, 2040194, 2040258,
+    2040322, 2040386, 2040450, 2040514, 2040578, 2040642, 2040706, 2040770,
+    2040834, 2040898, 2040962, 2041026, 2041090, 2041154, 2041218, 2041282,
+    2041346, 2041410, 2041474, 2041538, 2041602, 2041666, 2041730, 2041794,
+    2041858, 0, 0, 0, 0, 0, 0, 0,
+    2041922, 2041986, 2042050, 2042114, 2042178, 2042242, 2042306, 2042370,
+    2042434, 2042498, 2042562, 2042626, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2042690, 2042754, 2042818, 2042882, 2042946, 2043010, 2043074, 2043138,
+    2043202, 2043266, 2043330, 2043394, 0, 0, 0, 0,
+    2043458, 2043522, 2043586, 2043650, 2043714, 2043778, 2043842, 2043906,
+    2043970, 2044034, 2044098, 2044162, 2044226, 2044290, 2044354, 2044418,
+    2044482, 2044546, 2044610, 2044674, 2044738, 2044802, 2044866, 2044930,
+    2044994, 2045058, 2045122, 2045186, 2045250, 2045314, 2045378, 2045442,
+    2045506, 2045570, 2045634, 2045698, 2045762, 2045826, 2045890, 2045954,
+    2046018, 2046082, 2046146, 2046210, 2046274, 2046338, 2046402, 2046466,
+    2046530, 2046594, 2046658, 2046722, 2046786, 2046850, 2046914, 2046978,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2047042, 2047106, 2047170, 2047234, 2047298, 2047362, 2047426, 2047490,
+    2047554, 2047618, 0, 0, 0, 0, 0, 0,
+    2047682, 2047746, 2047810, 2047874, 2047938, 2048002, 2048066, 2048130,
+    2048194, 2048258, 2048322, 2048386, 2048450, 2048514, 2048578, 2048642,
+    2048706, 2048770, 2048834, 2048898, 2048962, 2049026, 2049090, 2049154,
+    2049218, 2049282, 2049346, 2049410, 2049474, 2049538, 2049602, 2049666,
+    2049730, 2049794, 2049858, 2049922, 2049986, 2050050, 2050114, 2050178,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2050242, 2050306, 2050370, 2050434, 2050498, 2050562, 2050626, 2050690,
+    2050754, 2050818, 2050882, 2050946, 2051010, 2051074, 2051138, 2051202,
+    2051266, 2051330, 2051394, 2051458, 2051522, 2051586, 2051650, 2051714,
+    2051778, 2051842, 2051906, 2051970, 2052034, 2052098, 0, 0,
+    2052162, 2052226, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2052290, 2052354, 2052418, 2052482, 2052546, 2052610, 2052674, 2052738,
+    2052802, 2052866, 2052930, 2052994, 2053058, 2053122, 2053186, 2053250,
+    2053314, 2053378, 2053442, 2053506, 2053570, 2053634, 2053698, 2053762,
+    2053826, 2053890, 2053954, 2054018, 2054082, 2054146, 2054210, 2054274,
+    2054338, 2054402, 2054466, 2054530, 2054594, 2054658, 2054722, 2054786,
+    2054850, 2054914, 2054978, 2055042, 2055106, 2055170, 2055234, 2055298,
+    2055362, 2055426, 2055490, 2055554, 2055618, 2055682, 2055746, 2055810,
+    2055874, 2055938, 2056002, 2056066, 2056130, 2056194, 2056258, 2056322,
+    2056386, 2056450, 2056514, 2056578, 2056642, 2056706, 2056770, 2056834,
+    2056898, 2056962, 2057026, 2057090, 2057154, 2057218, 2057282, 2057346,
+    2057410, 2057474, 2057538, 2057602, 2057666, 2057730, 2057794, 2057858,
+    2057922, 2057986, 2058050, 2058114, 2058178, 2058242, 2058306, 2058370,
+    2058434, 2058498, 2058562, 2058626, 2058690, 2058754, 2058818, 2058882,
+    2058946, 2059010, 2059074, 2059138, 2059202, 2059266, 2059330, 2059394,
+    2059458, 2059522, 2059586, 2059650, 2059714, 2059778, 2059842, 2059906,
+    2059970, 0, 2060034, 2060098, 2060162, 2060226, 2060290, 2060354,
+    2060418, 2060482, 2060546, 2060610, 2060674, 2060738, 2060802, 2060866,
+    2060930, 2060994, 2061058, 2061122, 2061186, 2061250, 2061314, 2061378,
+    2061442, 2061506, 2061570, 2061634, 2061698, 2061762, 2061826, 2061890,
+    2061954, 2062018, 2062082, 2062146, 2062210, 2062274, 2062338, 2062402,
+    2062466, 2062530, 2062594, 2062658, 2062722, 2062786, 2062850, 2062914,
+    2062978, 2063042, 2063106, 2063170, 2063234, 2063298, 2063362, 2063426,
+    2063490, 2063554, 2063618, 2063682, 2063746, 2063810, 2063874, 2063938,
+    2064002, 2064066, 2064130, 2064194, 2064258, 2064322, 2064386, 2064450,
+    2064514, 2064578, 2064642, 2064706, 2064770, 2064834, 2064898, 2064962,
+    2065026, 2065090, 2065154, 2065218, 0, 2065282, 2065346, 2065410,
+    2065474, 2065538, 2065602, 2065666, 2065730, 2065794, 2065858, 2065922,
+    2065986, 2066050, 2066114, 2066178, 2066242, 2066306, 2066370, 2066434,
+    2066498, 2066562, 2066626, 2066690, 2066754, 2066818, 2066882, 2066946,
+    2067010, 2067074, 2067138, 2067202, 2067266, 2067330, 2067394, 2067458,
+    2067522, 2067586, 2067650, 2067714, 2067778, 2067842, 2067906, 2067970,
+    2068034, 2068098, 2068162, 2068226, 2068290, 2068354, 2068418, 2068482,
+    2068546, 2068610, 2068674, 2068738, 2068802, 2068866, 2068930, 2068994,
+    2069058, 2069122, 2069186, 2069250, 2069314, 2069378, 2069442, 2069506,
+    2069570, 2069634, 2069698, 2069762, 2069826, 2069890, 2069954, 2070018,
+    2070082, 2070146, 2070210, 2070274, 2070338, 2070402, 2070466, 2070530,
+    2070594, 2070658, 2070722, 2070786, 2070850, 2070914, 2070978, 2071042,
+    2071106, 2071170, 2071234, 2071298, 2071362, 2071426, 2071490, 2071554,
+    2071618, 2071682, 2071746, 2071810, 2071874, 2071938, 2072002, 2072066,
+    2072130, 2072194, 2072258, 2072322, 2072386, 2072450, 2072514, 2072578,
+    2072642, 2072706, 2072770, 2072834, 2072898, 2072962, 2073026, 2073090,
+    2073154, 2073218, 2073282, 2073346, 2073410, 2073474, 2073538, 2073602,
+    2073666, 2073730, 2073794, 2073858, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2073922, 2073986, 2074050, 2074114, 2074178, 2074242, 2074306, 2074370,
+    2074434, 2074498, 2074562, 2074626, 2074690, 2074754, 0, 0,
+    2074818, 2074882, 2074946, 2075010, 2075074, 0, 0, 0,
+    2075138, 2075202, 2075266, 0, 0, 0, 0, 0,
+    2075330, 2075394, 2075458, 2075522, 2075586, 2075650, 2075714, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2075778, 2075842, 2075906, 2075970, 2076034, 2076098, 2076162, 2076226,
+    2076290, 2076354, 2076418, 2076482, 2076546, 2076610, 2076674, 2076738,
+    2076802, 2076866, 2076930, 2076994, 2077058, 2077122, 2077186, 2077250,
+    2077314, 0, 0, 0, 0, 0, 0, 0,
+    2077378, 2077442, 2077506, 2077570, 2077634, 2077698, 2077762, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2077826, 2077890, 2077954, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2078018, 2078082, 2078146, 2078210, 2078274, 2078338, 2078402, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2078466, 2078530, 2078594, 2078658, 2078722, 2078786, 2078850, 2078914,
+    2078978, 2079042, 2079106, 2079170, 2079234, 2079298, 2079362, 2079426,
+    2079490, 2079554, 2079618, 2079682, 2079746, 2079810, 2079874, 2079938,
+    2080002, 2080066, 2080130, 2080194, 2080258, 2080322, 2080386, 2080450,
+    2080514, 2080578, 2080642, 2080706, 2080770, 2080834, 2080898, 2080962,
+    2081026, 2081090, 2081154, 2081218, 2081282, 2081346, 2081410, 2081474,
+    2081538, 2081602, 2081666, 2081730, 2081794, 2081858, 2081922, 2081986,
+    2082050, 2082114, 2082178, 2082242, 2082306, 2082370, 2082434, 2082498,
+    2082562, 2082626, 2082690, 2082754, 2082818, 2082882, 2082946, 2083010,
+    2083074, 2083138, 2083202, 2083266, 2083330, 2083394, 2083458, 2083522,
+    2083586, 2083650, 2083714, 2083778, 2083842, 2083906, 2083970, 2084034,
+    2084098, 2084162, 2084226, 2084290, 2084354, 2084418, 2084482, 2084546,
+    2084610, 2084674, 2084738, 2084802, 2084866, 2084930, 2084994, 2085058,
+    2085122, 2085186, 2085250, 2085314, 2085378, 2085442, 2085506, 2085570,
+    2085634, 2085698, 2085762, 2085826, 2085890, 2085954, 2086018, 2086082,
+    2086146, 2086210, 2086274, 2086338, 2086402, 2086466, 2086530, 2086594,
+    2086658, 2086722, 2086786, 2086850, 2086914, 2086978, 2087042, 2087106,
+    2087170, 2087234, 2087298, 2087362, 2087426, 2087490, 2087554, 2087618,
+    2087682, 2087746, 2087810, 0, 2087874, 2087938, 2088002, 2088066,
+    2088130, 2088194, 2088258, 2088322, 2088386, 2088450, 2088514, 2088578,
+    2088642, 2088706, 2088770, 2088834, 2088898, 2088962, 2089026, 2089090,
+    2089154, 2089218, 2089282, 2089346, 2089410, 2089474, 2089538, 2089602,
+    2089666, 2089730, 2089794, 2089858, 2089922, 2089986, 2090050, 2090114,
+    2090178, 2090242, 2090306, 2090370, 2090434, 2090498, 2090562, 2090626,
+    2090690, 2090754, 2090818, 2090882, 2090946, 2091010, 2091074, 2091138,
+    2091202, 2091266, 2091330, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1852994, 1853058, 1853122, 1853186, 1853250, 1853314, 1853378, 1853442,
+    1853506, 1853570, 0, 0, 0, 0, 0, 0,
+    2091396, 2091524, 2091652, 2091780, 2091908, 1133956, 2092036, 2092164,
+    2092292, 2092420, 1134084, 2092548, 2092676, 2092804, 1134212, 2092932,
+    2093060, 2093188, 2093316, 2093444, 2093572, 2093700, 2093828, 2093956,
+    2094084, 2094212, 2094340, 1141636, 2094468, 2094596, 2094724, 2094852,
+    2094980, 2095108, 2095236, 2095364, 2095492, 1142276, 1134340, 1134468,
+    1142404, 2095620, 2095748, 1108228, 2095876, 1134596, 2096004, 2096132,
+    2096260, 2096388, 2096388, 2096388, 2096516, 2096644, 2096772, 2096900,
+    2097028, 2097156, 2097284, 2097412, 2097540, 2097668, 2097796, 2097924,
+    2098052, 2098180, 2098308, 2098436, 2098564, 2098692, 2098692, 1142660,
+    2098820, 2098948, 2099076, 2099204, 1134852, 2099332, 2099460, 2099588,
+    1127812, 2099716, 2099844, 2099972, 2100100, 2100228, 2100356, 2100484,
+    2100612, 2100740, 2100868, 2100996, 2101124, 2101252, 2101380, 2101508,
+    2101636, 2101764, 2101892, 2102020, 2102148, 2102276, 2102404, 2102532,
+    2102660, 2102788, 2102916, 2102916, 2103044, 2103172, 2103300, 1107716,
+    2103428, 2103556, 2103684, 2103812, 2103940, 2104068, 2104196, 2104324,
+    1135492, 2104452, 2104580, 2104708, 2104836, 2104964, 2105092, 2105220,
+    2105348, 2105476, 2105604, 2105732, 2105860, 2105988, 2106116, 2106244,
+    2106372, 2106500, 2106628, 2106756, 2106884, 2107012, 1100804, 2107140,
+    2107268, 2107396, 2107396, 2107524, 2107652, 2107652, 2107780, 2107908,
+    2108036, 2108164, 2108292, 2108420, 2108548, 2108676, 2108804, 2108932,
+    2109060, 2109188, 2109316, 1135620, 2109444, 2109572, 2109700, 2109828,
+    1144196, 2109828, 2109956, 1135876, 2110084, 2110212, 2110340, 2110468,
+    1136004, 1097348, 2110596, 2110724, 2110852, 2110980, 2111108, 2111236,
+    2111364, 2111492, 2111620, 2111748, 2111876, 2112004, 2112132, 2112260,
+    2112388, 2112516, 2112644, 2112772, 2112900, 2113028, 2113156, 2113284,
+    1136132, 2113412, 2113540, 2113668, 2113796, 2113924, 2114052, 1136388,
+    2114180, 2114308, 2114436, 2114564, 2114692, 2114820, 2114948, 2115076,
+    1100932, 1145220, 2115204, 2115332, 2115460, 2115588, 2115716, 2115844,
+    2115972, 2116100, 1136516, 2116228, 2116356, 2116484, 2116612, 1150724,
+    2116740, 2116868, 2116996, 2117124, 2117252, 2117380, 2117508, 2117636,
+    2117764, 2117892, 2118020, 2118148, 2118276, 1109892, 2118404, 2118532,
+    2118660, 2118788, 2118916, 2119044, 2119172, 2119300, 2119428, 2119556,
+    2119684, 1136644, 1121028, 2119812, 2119940, 2120068, 2120196, 2120324,
+    2120452, 2120580, 2120708, 1145732, 2120836, 2120964, 2121092, 2121220,
+    2121348, 2121476, 2121604, 2121732, 1145860, 2121860, 2121988, 2122116,
+    2122244, 2122372, 2122500, 2122628, 2122756, 2122884, 2123012, 2123140,
+    2123268, 1146116, 2123396, 2123524, 2123652, 2123780, 2123908, 2124036,
+    2124164, 2124292, 2124420, 2124548, 2124676, 2124676, 2124804, 2124932,
+    1146372, 2125060, 2125188, 2125316, 2125444, 2125572, 2125700, 2125828,
+    1108100, 2125956, 2126084, 2126212, 2126340, 2126468, 2126596, 2126724,
+    1147140, 2126852, 2126980, 2127108, 2127236, 2127364, 2127492, 2127492,
+    1147268, 1150980, 2127620, 2127748, 2127876, 2128004, 2128132, 1103236,
+    1147524, 2128260, 2128388, 1138052, 2128516, 2128644, 1131268, 2128772,
+    2128900, 1138564, 2129028, 2129156, 2129284, 2129412, 2129412, 2129540,
+    2129668, 2129796, 2129924, 2130052, 2130180, 2130308, 2130436, 2130564,
+    2130692, 2130820, 2130948, 2131076, 2131204, 2131332, 2131460, 2131588,
+    2131716, 2131844, 2131972, 2132100, 2132228, 2132356, 2132484, 2132612,
+    2132740, 2132868, 1139332, 2132996, 2133124, 2133252, 2133380, 2133508,
+    2133636, 2133764, 2133892, 2134020, 2134148, 2134276, 2134404, 2134532,
+    2134660, 2134788, 2134916, 2107524, 2135044, 2135172, 2135300, 2135428,
+    2135556, 2135684, 2135812, 2135940, 2136068, 2136196, 2136324, 2136452,
+    1110404, 2136580, 2136708, 2136836, 2136964, 2137092, 2137220, 1139716,
+    2137348, 2137476, 2137604, 2137732, 2137860, 2137988, 2138116, 2138244,
+    2138372, 2138500, 2138628, 2138756, 2138884, 2139012, 2139140, 2139268,
+    2139396, 2139524, 2139652, 2139780, 1102596, 2139908, 2140036, 2140164,
+    2140292, 2140420, 2140548, 1148420, 2140676, 2140804, 2140932, 2141060,
+    2141188, 2141316, 2141444, 2141572, 2141700, 2141828, 2141956, 2142084,
+    2142212, 2142340, 2142468, 2142596, 2142724, 2142852, 2142980, 2143108,
+    1149060, 1149188, 2143236, 2143364, 2143492, 2143620, 2143748, 2143876,
+    2144004, 2144132, 2144260, 2144388, 2144516, 2144644, 2144772, 1149316,
+    2144900, 2145028, 2145156, 2145284, 2145412, 2145540, 2145668, 2145796,
+    2145924, 2146052, 2146180, 2146308, 2146436, 2146564, 2146692, 2146820,
+    2146948, 2147076, 2147204, 2147332, 2147460, 2147588, 2147716, 2147844,
+    2147972, 2148100, 2148228, 2148356, 2148484, 2148612, 1150084, 1150084,
+    2148740, 2148868, 2148996, 2149124, 2149252, 2149380, 2149508, 2149636,
+    2149764, 2149892, 1150212, 2150020, 2150148, 2150276, 2150404, 2150532,
+    2150660, 2150788, 2150916, 2151044, 2151172, 2151300, 2151428, 2151556,
+    2151684, 2151812, 2151940, 2152068, 2152196, 2152324, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+inline constexpr uint32_t sCollationElements[] = {
+    0x00000000, 0x02010402, 0x02020402, 0x02030402, 0x02040402, 0x02050402, 0x02090402, 0x02670402,
+    0x031D0402, 0x03AC0402, 0x1F640402, 0x03AD0402, 0x03A90402, 0x03160402, 0x03280402, 0x03290402,
+    0x03A10402, 0x06660402, 0x02230402, 0x020D0402, 0x027E0402, 0x03A60402, 0x1F980402, 0x1F990402,
+    0x1F9A0402, 0x1F9B0402, 0x1F9C0402, 0x1F9D0402, 0x1F9E0402, 0x1F9F0402, 0x1FA00402, 0x1FA10402,
+    0x02400402, 0x023A0402, 0x066A0402, 0x066B0402, 0x066C0402, 0x026D0402, 0x03A00402, 0x1FA20408,
+    0x1FBC0408, 0x1FD60408, 0x1FEB0408, 0x20070408, 0x20420408, 0x20510408, 0x20750408, 0x20900408,
+    0x20AB0408, 0x20C40408, 0x20D60408, 0x21090408, 0x21180408, 0x213C0408, 0x216B0408, 0x21800408,
+    0x21930408, 0x21D20408, 0x21F70408, 0x22170408, 0x22470408, 0x22590408, 0x22640408, 0x22700408,
+    0x22860408, 0x032A0402, 0x03A70402, 0x032B0402, 0x04B70402, 0x020B0402, 0x04B40402, 0x1FA20402,
+    0x1FBC0402, 0x1FD60402, 0x1FEB0402, 0x20070402, 0x20420402, 0x20510402, 0x20750402, 0x20900402,
+    0x20AB0402, 0x20C40402, 0x20D60402, 0x21090402, 0x21180402, 0x213C0402, 0x216B0402, 0x21800402,
+    0x21930402, 0x21D20402, 0x21F70402, 0x22170402, 0x22470402, 0x22590402, 0x22640402, 0x22700402,
+    0x22860402, 0x032C0402, 0x066E0402, 0x032D0402, 0x06700402, 0x02060402, 0x0209041B, 0x02680402,
+    0x1F630402, 0x1F650402, 0x1F620402, 0x1F660402, 0x066F0402, 0x039A0402, 0x04BB0402, 0x05D20402,
+    0x1FA20414, 0x03260402, 0x066D0402, 0x05D40402, 0x04B80402, 0x052A0402, 0x06670402, 0x1F9A0414,
+    0x1F9B0414, 0x04B50402, 0x23300404, 0x039C0402, 0x02930402, 0x04BE0402, 0x1F990414, 0x213C0414,
+    0x03270402, 0x1F99041E, 0x0676041E, 0x1F9C041E, 0x1F99041E, 0x0676041E, 0x1F9A041E, 0x1F9B041E,
+    0x0676041E, 0x1F9C041E, 0x026E0402, 0x1FA20408, 0x000004A2, 0x1FA20408, 0x00000482, 0x1FA20408,
+    0x000004E2, 0x1FA20408, 0x000005A2, 0x1FA20408, 0x00000562, 0x1FA20408, 0x00000522, 0x1FA2040A,
+    0x00002304, 0x2007040A, 0x1FD60408, 0x00000602, 0x20070408, 0x000004A2, 0x20070408, 0x00000482,
+    0x20070408, 0x000004E2, 0x20070408, 0x00000562, 0x20900408, 0x000004A2, 0x20900408, 0x00000482,
+    0x20900408, 0x000004E2, 0x20900408, 0x00000562, 0x1FEB040A, 0x00002304, 0x21180408, 0x000005A2,
+    0x213C0408, 0x000004A2, 0x213C0408, 0x00000482, 0x213C0408, 0x000004E2, 0x213C0408, 0x000005A2,
+    0x213C0408, 0x00000562, 0x06690402, 0x213C0408, 0x000005E2, 0x22170408, 0x000004A2, 0x22170408,
+    0x00000482, 0x22170408, 0x000004E2, 0x22170408, 0x00000562, 0x22700408, 0x00000482, 0x22B50408,
+    0x21D20404, 0x00002304, 0x21D20404, 0x1FA20402, 0x000004A2, 0x1FA20402, 0x00000482, 0x1FA20402,
+    0x000004E2, 0x1FA20402, 0x000005A2, 0x1FA20402, 0x00000562, 0x1FA20402, 0x00000522, 0x1FA20404,
+    0x00002304, 0x20070404, 0x1FD60402, 0x00000602, 0x20070402, 0x000004A2, 0x20070402, 0x00000482,
+    0x20070402, 0x000004E2, 0x20070402, 0x00000562, 0x20900402, 0x000004A2, 0x20900402, 0x00000482,
+    0x20900402, 0x000004E2, 0x20900402, 0x00000562, 0x1FEB0404, 0x00002304, 0x21180402, 0x000005A2,
+    0x213C0402, 0x000004A2, 0x213C0402, 0x00000482, 0x213C0402, 0x000004E2, 0x213C0402, 0x000005A2,
+    0x213C0402, 0x00000562, 0x06680402, 0x213C0402, 0x000005E2, 0x22170402, 0x000004A2, 0x22170402,
+    0x00000482, 0x22170402, 0x000004E2, 0x22170402, 0x00000562, 0x22700402, 0x00000482, 0x22B50402,
+    0x22700402, 0x00000562, 0x1FA20408, 0x00000642, 0x1FA20402, 0x00000642, 0x1FA20408, 0x000004C2,
+    0x1FA20402, 0x000004C2, 0x1FA20408, 0x00000622, 0x1FA20402, 0x00000622, 0x1FD60408, 0x00000482,
+    0x1FD60402, 0x00000482, 0x1FD60408, 0x000004E2, 0x1FD60402, 0x000004E2, 0x1FD60408, 0x000005C2,
+    0x1FD60402, 0x000005C2, 0x1FD60408, 0x00000502, 0x1FD60402, 0x00000502, 0x1FEB0408, 0x00000502,
+    0x1FEB0402, 0x00000502, 0x1FEB0408, 0x00000722, 0x1FEB0402, 0x00000722, 0x20070408, 0x00000642,
+    0x20070402, 0x00000642, 0x20070408, 0x000004C2, 0x20070402, 0x000004C2, 0x20070408, 0x000005C2,
+    0x20070402, 0x000005C2, 0x20070408, 0x00000622, 0x20070402, 0x00000622, 0x20070408, 0x00000502,
+    0x20070402, 0x00000502, 0x20510408, 0x000004E2, 0x20510402, 0x000004E2, 0x20510408, 0x000004C2,
+    0x20510402, 0x000004C2, 0x20510408, 0x000005C2, 0x20510402, 0x000005C2, 0x20510408, 0x00000602,
+    0x20510402, 0x00000602, 0x20750408, 0x000004E2, 0x20750402, 0x000004E2, 0x20750408, 0x00000722,
+    0x20750402, 0x00000722, 0x20900408, 0x000005A2, 0x20900402, 0x000005A2, 0x20900408, 0x00000642,
+    0x20900402, 0x00000642, 0x20900408, 0x000004C2, 0x20900402, 0x000004C2, 0x20900408, 0x00000622,
+    0x20900402, 0x00000622, 0x20900408, 0x000005C2, 0x20940402, 0x2090040A, 0x20AB040A, 0x20900404,
+    0x20AB0404, 0x20AB0408, 0x000004E2, 0x20AB0402, 0x000004E2, 0x20C40408, 0x00000602, 0x20C40402,
+    0x00000602, 0x218F0402, 0x20D60408, 0x00000482, 0x20D60402, 0x00000482, 0x20D60408, 0x00000602,
+    0x20D60402, 0x00000602, 0x20D60408, 0x00000502, 0x20D60402, 0x00000502, 0x20D60408, 0x00002302,
+    0x20D60402, 0x00002302, 0x20D60408, 0x00000722, 0x20D60402, 0x00000722, 0x21180408, 0x00000482,
+    0x21180402, 0x00000482, 0x21180408, 0x00000602, 0x21180402, 0x00000602, 0x21180408, 0x00000502,
+    0x21180402, 0x00000502, 0x22E30404, 0x21180404, 0x21370408, 0x21370402, 0x213C0408, 0x00000642,
+    0x213C0402, 0x00000642, 0x213C0408, 0x000004C2, 0x213C0402, 0x000004C2, 0x213C0408, 0x00000582,
+    0x213C0402, 0x00000582, 0x213C040A, 0x00002304, 0x2007040A, 0x213C0404, 0x00002304, 0x20070404,
+    0x21930408, 0x00000482, 0x21930402, 0x00000482, 0x21930408, 0x00000602, 0x21930402, 0x00000602,
+    0x21930408, 0x00000502, 0x21930402, 0x00000502, 0x21D20408, 0x00000482, 0x21D20402, 0x00000482,
+    0x21D20408, 0x000004E2, 0x21D20402, 0x000004E2, 0x21D20408, 0x00000602, 0x21D20402, 0x00000602,
+    0x21D20408, 0x00000502, 0x21D20402, 0x00000502, 0x21F70408, 0x00000602, 0x21F70402, 0x00000602,
+    0x21F70408, 0x00000502, 0x21F70402, 0x00000502, 0x21FC0408, 0x21FC0402, 0x22170408, 0x000005A2,
+    0x22170402, 0x000005A2, 0x22170408, 0x00000642, 0x22170402, 0x00000642, 0x22170408, 0x000004C2,
+    0x22170402, 0x000004C2, 0x22170408, 0x00000522, 0x22170402, 0x00000522, 0x22170408, 0x00000582,
+    0x22170402, 0x00000582, 0x22170408, 0x00000622, 0x22170402, 0x00000622, 0x22590408, 0x000004E2,
+    0x22590402, 0x000004E2, 0x22700408, 0x000004E2, 0x22700402, 0x000004E2, 0x22700408, 0x00000562,
+    0x22860408, 0x00000482, 0x22860402, 0x00000482, 0x22860408, 0x000005C2, 0x22860402, 0x000005C2,
+    0x22860408, 0x00000502, 0x22860402, 0x00000502, 0x21D20404, 0x00002324, 0x1FC40402, 0x1FCD0408,
+    0x1FD10408, 0x1FD10402, 0x22D60408, 0x22D60402, 0x214F0408, 0x1FE10408, 0x1FE10402, 0x1FF40408,
+    0x1FF80408, 0x1FFD0408, 0x1FFD0402, 0x22860404, 0x22590404, 0x20150408, 0x201A0408, 0x201F0408,
+    0x204B0408, 0x204B0402, 0x20630408, 0x206D0408, 0x207D0402, 0x20A60408, 0x209F0408, 0x20CA0408,
+    0x20CA0402, 0x20E10402, 0x21010402, 0x22380408, 0x21230408, 0x21270402, 0x215C0408, 0x213C0408,
+    0x000007E2, 0x213C0402, 0x000007E2, 0x20710408, 0x20710402, 0x21740408, 0x21740402, 0x21980408,
+    0x22CE0408, 0x22CE0402, 0x21E40408, 0x21EA0402, 0x22020402, 0x22060408, 0x22060402, 0x220A0408,
+    0x22170408, 0x000007E2, 0x22170402, 0x000007E2, 0x22420408, 0x224E0408, 0x227C0408, 0x227C0402,
+    0x228B0408, 0x228B0402, 0x22A30408, 0x22A80408, 0x22A80402, 0x22AD0402, 0x22C70402, 0x22D20408,
+    0x22D20402, 0x21F70404, 0x21D20404, 0x22BB0402, 0x22FE0402, 0x23020402, 0x23060402, 0x230A0402,
+    0x1FEB040A, 0x2286040A, 0x00000504, 0x1FEB040A, 0x22860404, 0x00000504, 0x1FEB0404, 0x22860404,
+    0x00000504, 0x20D6040A, 0x20AB040A, 0x20D6040A, 0x20AB0404, 0x20D60404, 0x20AB0404, 0x2118040A,
+    0x20AB040A, 0x2118040A, 0x20AB0404, 0x21180404, 0x20AB0404, 0x1FA20408, 0x00000502, 0x1FA20402,
+    0x00000502, 0x20900408, 0x00000502, 0x20900402, 0x00000502, 0x213C0408, 0x00000502, 0x213C0402,
+    0x00000502, 0x22170408, 0x00000502, 0x22170402, 0x00000502, 0x22170408, 0x00000562, 0x00000642,
+    0x22170402, 0x00000562, 0x00000642, 0x22170408, 0x00000562, 0x00000482, 0x22170402, 0x00000562,
+    0x00000482, 0x22170408, 0x00000562, 0x00000502, 0x22170402, 0x00000562, 0x00000502, 0x22170408,
+    0x00000562, 0x000004A2, 0x22170402, 0x00000562, 0x000004A2, 0x20150402, 0x1FA20408, 0x00000562,
+    0x00000642, 0x1FA20402, 0x00000562, 0x00000642, 0x1FA20408, 0x000005C2, 0x00000642, 0x1FA20402,
+    0x000005C2, 0x00000642, 0x1FA2040A, 0x00002304, 0x2007040A, 0x00000642, 0x1FA20404, 0x00002304,
+    0x20070404, 0x00000642, 0x205E0408, 0x205E0402, 0x20510408, 0x00000502, 0x20510402, 0x00000502,
+    0x20C40408, 0x00000502, 0x20C40402, 0x00000502, 0x213C0408, 0x00000622, 0x213C0402, 0x00000622,
+    0x213C0408, 0x00000622, 0x00000642, 0x213C0402, 0x00000622, 0x00000642, 0x22A30408, 0x00000502,
+    0x22A30402, 0x00000502, 0x20AB0402, 0x00000502, 0x1FEB040A, 0x2286040A, 0x1FEB040A, 0x22860404,
+    0x1FEB0404, 0x22860404, 0x20510408, 0x00000482, 0x20510402, 0x00000482, 0x207D0408, 0x22BB0408,
+    0x21180408, 0x000004A2, 0x21180402, 0x000004A2, 0x1FA20408, 0x00000522, 0x00000482, 0x1FA20402,
+    0x00000522, 0x00000482, 0x1FA2040A, 0x00002304, 0x2007040A, 0x00000482, 0x1FA20404, 0x00002304,
+    0x20070404, 0x00000482, 0x213C0408, 0x000005E2, 0x00000482, 0x213C0402, 0x000005E2, 0x00000482,
+    0x1FA20408, 0x00000782, 0x1FA20402, 0x00000782, 0x1FA20408, 0x000007C2, 0x1FA20402, 0x000007C2,
+    0x20070408, 0x00000782, 0x20070402, 0x00000782, 0x20070408, 0x000007C2, 0x20070402, 0x000007C2,
+    0x20900408, 0x00000782, 0x20900402, 0x00000782, 0x20900408, 0x000007C2, 0x20900402, 0x000007C2,
+    0x213C0408, 0x00000782, 0x213C0402, 0x00000782, 0x213C0408, 0x000007C2, 0x213C0402, 0x000007C2,
+    0x21930408, 0x00000782, 0x21930402, 0x00000782, 0x21930408, 0x000007C2, 0x21930402, 0x000007C2,
+    0x22170408, 0x00000782, 0x22170402, 0x00000782, 0x22170408, 0x000007C2, 0x22170402, 0x000007C2,
+    0x21D20408, 0x000008A2, 0x21D20402, 0x000008A2, 0x21F70408, 0x000008A2, 0x21F70402, 0x000008A2,
+    0x22820408, 0x22820402, 0x20750408, 0x00000502, 0x20750402, 0x00000502, 0x21270408, 0x20010402,
+    0x21660408, 0x21660402, 0x22910408, 0x22910402, 0x1FA20408, 0x000005C2, 0x1FA20402, 0x000005C2,
+    0x20070408, 0x00000602, 0x20070402, 0x00000602, 0x213C0408, 0x00000562, 0x00000642, 0x213C0402,
+    0x00000562, 0x00000642, 0x213C0408, 0x000005A2, 0x00000642, 0x213C0402, 0x000005A2, 0x00000642,
+    0x213C0408, 0x000005C2, 0x213C0402, 0x000005C2, 0x213C0408, 0x000005C2, 0x00000642, 0x213C0402,
+    0x000005C2, 0x00000642, 0x22700408, 0x00000642, 0x22700402, 0x00000642, 0x20F70402, 0x21310402,
+    0x220E0402, 0x20AF0402, 0x1FEB0404, 0x1FBC0404, 0x21800404, 0x216B0404, 0x1FA70408, 0x1FDB0408,
+    0x1FDB0402, 0x20E10408, 0x22000408, 0x21DE0402, 0x229D0402, 0x22DE0408, 0x22DE0402, 0x1FC40408,
+    0x22220408, 0x22550408, 0x200E0408, 0x200E0402, 0x20B40408, 0x20B40402, 0x218B0408, 0x218B0402,
+    0x219F0408, 0x219F0402, 0x22780408, 0x22780402, 0x1FAD0402, 0x1FB10402, 0x1FB70402, 0x1FCD0402,
+    0x214F0402, 0x1FE50402, 0x1FF40402, 0x1FF80402, 0x20240402, 0x201A0402, 0x20280402, 0x201F0402,
+    0x202C0402, 0x20320402, 0x20360402, 0x20BC0402, 0x20630402, 0x20550402, 0x205A0402, 0x206D0402,
+    0x203E0402, 0x222C0402, 0x20820402, 0x208A0402, 0x209F0402, 0x20A60402, 0x20980402, 0x20E60402,
+    0x20EC0402, 0x20F20402, 0x20FC0402, 0x22380402, 0x223E0402, 0x21100402, 0x21230402, 0x212D0402,
+    0x211C0402, 0x215C0402, 0x21430402, 0x21610402, 0x217B0402, 0x21A40402, 0x21A90402, 0x21AE0402,
+    0x21B30402, 0x21B70402, 0x21BC0402, 0x21C10402, 0x21980402, 0x21CA0402, 0x21DA0402, 0x21E40402,
+    0x20C00402, 0x21EE0402, 0x21F30402, 0x22130402, 0x220A0402, 0x22220402, 0x22420402, 0x224E0402,
+    0x22550402, 0x22600402, 0x21050402, 0x22740402, 0x22950402, 0x22990402, 0x22A30402, 0x22B10402,
+    0x22DA0402, 0x22E90402, 0x22FA0402, 0x230E0402, 0x23120402, 0x1FC00402, 0x203A0402, 0x20670402,
+    0x20790402, 0x20B80402, 0x20D20402, 0x20DA0402, 0x21870402, 0x22F20402, 0x22F60402, 0x1FEB0404,
+    0x22A30404, 0x1FEB0404, 0x22990404, 0x21F70404, 0x21E40404, 0x21F70404, 0x1FE50404, 0x20420404,
+    0x21370404, 0x20D60404, 0x21D20404, 0x20D60404, 0x22860404, 0x23160402, 0x231A0402, 0x22300402,
+    0x22340402, 0x20750414, 0x20820414, 0x20AB0414, 0x21930414, 0x21A40414, 0x21AE0414, 0x21CA0414,
+    0x22590414, 0x22700414, 0x04C50402, 0x04C70402, 0x208E0402, 0x22E30402, 0x208F0402, 0x22E50402,
+    0x22ED0402, 0x22E20402, 0x22EE0402, 0x04C80402, 0x04C90402, 0x04CA0402, 0x04CB0402, 0x04CC0402,
+    0x04CD0402, 0x04CE0402, 0x04CF0402, 0x04D00402, 0x04D10402, 0x04D20402, 0x04D30402, 0x04D40402,
+    0x04D50402, 0x1F460402, 0x1F470402, 0x04D60402, 0x04D70402, 0x04D80402, 0x04D90402, 0x04DC0402,
+    0x04DD0402, 0x04B90402, 0x04BA0402, 0x04BC0402, 0x04BF0402, 0x04B60402, 0x04BD0402, 0x04DE0402,
+    0x04DF0402, 0x206D0414, 0x20D60414, 0x21D20414, 0x22640414, 0x22E90414, 0x04E00402, 0x04E10402,
+    0x04E20402, 0x04E30402, 0x04E40402, 0x04E50402, 0x04E60402, 0x04E70402, 0x04E80402, 0x22E40402,
+    0x04E90402, 0x04EA0402, 0x04EB0402, 0x04EC0402, 0x04ED0402, 0x04EE0402, 0x04EF0402, 0x04F00402,
+    0x04F10402, 0x04F20402, 0x04F30402, 0x04F40402, 0x04F50402, 0x04F60402, 0x04F70402, 0x04F80402,
+    0x04F90402, 0x000004A2, 0x00000482, 0x000004E2, 0x000005A2, 0x00000642, 0x00000742, 0x000004C2,
+    0x000005C2, 0x00000562, 0x00000762, 0x00000522, 0x00000582, 0x00000502, 0x00000662, 0x00000782,
+    0x000007A2, 0x000007C2, 0x00000442, 0x00000462, 0x00000682, 0x000007E2, 0x00000802, 0x00000822,
+    0x00000842, 0x00000862, 0x00000882, 0x000008A2, 0x00000602, 0x00000622, 0x000008C2, 0x000008E2,
+    0x00000902, 0x00000922, 0x00000422, 0x00000942, 0x00000722, 0x000006A2, 0x000005E2, 0x00000962,
+    0x00000542, 0x00000562, 0x00000482, 0x00000982, 0x000009A2, 0x000009C2, 0x000009E2, 0x1FA20404,
+    0x20070404, 0x20900404, 0x213C0404, 0x22170404, 0x1FD60404, 0x1FEB0404, 0x20750404, 0x21090404,
+    0x21930404, 0x21F70404, 0x22470404, 0x22640404, 0x23280408, 0x23280402, 0x23490408, 0x23490402,
+    0x04C60402, 0x23250408, 0x23250402, 0x232B0404, 0x233E0402, 0x233D0402, 0x233F0402, 0x232C0408,
+    0x04BB0402, 0x00000482, 0x231E0408, 0x00000482, 0x23230408, 0x00000482, 0x23290408, 0x00000482,
+    0x232B0408, 0x00000482, 0x23330408, 0x00000482, 0x23410408, 0x00000482, 0x23460408, 0x00000482,
+    0x232B0402, 0x00000562, 0x00000482, 0x231E0408, 0x231F0408, 0x23200408, 0x23220408, 0x23230408,
+    0x23270408, 0x23290408, 0x232A0408, 0x232B0408, 0x232D0408, 0x232E0408, 0x23300408, 0x23310408,
+    0x23320408, 0x23330408, 0x23340408, 0x23390408, 0x233C0408, 0x23400408, 0x23410408, 0x23420408,
+    0x23430408, 0x23440408, 0x23460408, 0x232B0408, 0x00000562, 0x23410408, 0x00000562, 0x231E0402,
+    0x00000482, 0x23230402, 0x00000482, 0x23290402, 0x00000482, 0x232B0402, 0x00000482, 0x23410402,
+    0x00000562, 0x00000482, 0x231E0402, 0x231F0402, 0x23200402, 0x23220402, 0x23230402, 0x23270402,
+    0x23290402, 0x232A0402, 0x232B0402, 0x232D0402, 0x232E0402, 0x23300402, 0x23310402, 0x23320402,
+    0x23330402, 0x23340402, 0x23390402, 0x233C0419, 0x233C0402, 0x23400402, 0x23410402, 0x23420402,
+    0x23430402, 0x23440402, 0x23460402, 0x232B0402, 0x00000562, 0x23410402, 0x00000562, 0x23330402,
+    0x00000482, 0x23410402, 0x00000482, 0x23460402, 0x00000482, 0x232D040A, 0x231E0404, 0x232B0404,
+    0x231F0404, 0x232A0404, 0x2341040A, 0x2341040A, 0x00000482, 0x2341040A, 0x00000562, 0x23420404,
+    0x23340404, 0x232D0404, 0x231E0404, 0x232B0404, 0x23380408, 0x23380402, 0x23260408, 0x23260402,
+    0x23240408, 0x23240402, 0x23370408, 0x23370402, 0x23480408, 0x23480402, 0x236A0408, 0x236A0402,
+    0x236F0408, 0x236F0402, 0x23700408, 0x23700402, 0x23730408, 0x23730402, 0x237A0408, 0x237A0402,
+    0x237D0408, 0x237D0402, 0x23810408, 0x23810402, 0x232D0404, 0x23390404, 0x233C0404, 0x232C0402,
+    0x232A040A, 0x23230404, 0x06610402, 0x234A0408, 0x234A0402, 0x233C040A, 0x23360408, 0x23360402,
+    0x233B0402, 0x233E0408, 0x233D0408, 0x233F0408, 0x23BF0408, 0x000004A2, 0x23BF0408, 0x00000562,
+    0x23B50408, 0x239B0408, 0x00000482, 0x23C30408, 0x23D90408, 0x23ED0408, 0x23ED0408, 0x00000562,
+    0x23F60408, 0x24210408, 0x24470408, 0x247E0408, 0x23FB0408, 0x00000482, 0x23E50408, 0x000004A2,
+    0x24820408, 0x000004C2, 0x24E40408, 0x23870408, 0x23930408, 0x23970408, 0x239B0408, 0x23AF0408,
+    0x23BF0408, 0x23C70408, 0x23D10408, 0x23E50408, 0x23F20408, 0x23FB0408, 0x24150408, 0x24280408,
+    0x24310408, 0x244C0408, 0x24540408, 0x24610408, 0x246A0408, 0x24730408, 0x24820408, 0x24930408,
+    0x24970408, 0x24BE0408, 0x24C90408, 0x24E80408, 0x24ED0408, 0x24F40408, 0x24F90408, 0x24FD0408,
+    0x250A0408, 0x250E0408, 0x25140408, 0x23870402, 0x23930402, 0x23970402, 0x239B0402, 0x23AF0402,
+    0x23BF0402, 0x23C70402, 0x23D10402, 0x23E50402, 0x23F20402, 0x23FB0402, 0x24150402, 0x24280402,
+    0x24310402, 0x244C0402, 0x24540402, 0x24610402, 0x246A0402, 0x24730402, 0x24820402, 0x24930402,
+    0x24970402, 0x24BE0402, 0x24C90402, 0x24E80402, 0x24ED0402, 0x24F40402, 0x24F90402, 0x24FD0402,
+    0x250A0402, 0x250E0402, 0x25140402, 0x23BF0402, 0x000004A2, 0x23BF0402, 0x00000562, 0x23B50402,
+    0x239B0402, 0x00000482, 0x23C30402, 0x23D90402, 0x23ED0402, 0x23ED0402, 0x00000562, 0x23F60402,
+    0x24210402, 0x24470402, 0x247E0402, 0x23FB0402, 0x00000482, 0x23E50402, 0x000004A2, 0x24820402,
+    0x000004C2, 0x24E40402, 0x24AD0408, 0x24AD0402, 0x25050408, 0x25050402, 0x25190408, 0x25190402,
+    0x251D0408, 0x251D0402, 0x25270408, 0x25270402, 0x25220408, 0x25220402, 0x252C0408, 0x252C0402,
+    0x25300408, 0x25300402, 0x25340408, 0x25340402, 0x25380408, 0x25380402, 0x253C0408, 0x253C0402,
+    0x253C0408, 0x00000782, 0x253C0402, 0x00000782, 0x248F0408, 0x248F0402, 0x24BA0408, 0x24BA0402,
+    0x24B60408, 0x24B60402, 0x24B10408, 0x24B10402, 0x245D0408, 0x245D0402, 0x052B0402, 0x00000A02,
+    0x23E90408, 0x23E90402, 0x25010408, 0x25010402, 0x24650408, 0x24650402, 0x239B040A, 0x00002324,
+    0x239B0404, 0x00002324, 0x239F0408, 0x239F0402, 0x23A70408, 0x23A70402, 0x23CD0408, 0x23CD0402,
+    0x23BB0408, 0x23BB0402, 0x23FF0408, 0x23FF0402, 0x240F0408, 0x240F0402, 0x240B0408, 0x240B0402,
+    0x24070408, 0x24070402, 0x243A0408, 0x243A0402, 0x24430408, 0x24430402, 0x24590408, 0x24590402,
+    0x25410408, 0x25410402, 0x246F0408, 0x246F0402, 0x24790408, 0x24790402, 0x24860408, 0x24860402,
+    0x248A0408, 0x248A0402, 0x24A30408, 0x24A30402, 0x24C40408, 0x24C40402, 0x24CF0408, 0x24CF0402,
+    0x24D70408, 0x24D70402, 0x24A70408, 0x24A70402, 0x24DC0408, 0x24DC0402, 0x24E00408, 0x24E00402,
+    0x25460408, 0x23C70408, 0x000004C2, 0x23C70402, 0x000004C2, 0x24030408, 0x24030402, 0x241A0408,
+    0x241A0402, 0x243E0408, 0x243E0402, 0x24360408, 0x24360402, 0x24D30408, 0x24D30402, 0x242C0408,
+    0x242C0402, 0x25460402, 0x23870408, 0x000004C2, 0x23870402, 0x000004C2, 0x23870408, 0x00000562,
+    0x23870402, 0x00000562, 0x238F0408, 0x238F0402, 0x23BF0408, 0x000004C2, 0x23BF0402, 0x000004C2,
+    0x238B0408, 0x238B0402, 0x238B0408, 0x00000562, 0x238B0402, 0x00000562, 0x23C70408, 0x00000562,
+    0x23C70402, 0x00000562, 0x23D10408, 0x00000562, 0x23D10402, 0x00000562, 0x23DE0408, 0x23DE0402,
+    0x23E50408, 0x00000642, 0x23E50402, 0x00000642, 0x23E50408, 0x00000562, 0x23E50402, 0x00000562,
+    0x244C0408, 0x00000562, 0x244C0402, 0x00000562, 0x24500408, 0x24500402, 0x24500408, 0x00000562,
+    0x24500402, 0x00000562, 0x250A0408, 0x00000562, 0x250A0402, 0x00000562, 0x24820408, 0x00000642,
+    0x24820402, 0x00000642, 0x24820408, 0x00000562, 0x24820402, 0x00000562, 0x24820408, 0x00000582,
+    0x24820402, 0x00000582, 0x24C90408, 0x00000562, 0x24C90402, 0x00000562, 0x23AB0408, 0x23AB0402,
+    0x24F90408, 0x00000562, 0x24F90402, 0x00000562, 0x23A30408, 0x23A30402, 0x249B0408, 0x249B0402,
+    0x249F0408, 0x249F0402, 0x23B30408, 0x23B30402, 0x23BA0408, 0x23BA0402, 0x23D60408, 0x23D60402,
+    0x23E30408, 0x23E30402, 0x24260408, 0x24260402, 0x244B0408, 0x244B0402, 0x246E0408, 0x246E0402,
+    0x24780408, 0x24780402, 0x23D70408, 0x23D70402, 0x241F0408, 0x241F0402, 0x24270408, 0x24270402,
+    0x24690408, 0x24690402, 0x25180408, 0x25180402, 0x24140408, 0x24140402, 0x25450408, 0x25450402,
+    0x24130408, 0x24130402, 0x24200408, 0x24200402, 0x24420408, 0x24420402, 0x24580408, 0x24580402,
+    0x24AB0408, 0x24AB0402, 0x24350408, 0x24350402, 0x23CB0408, 0x23CB0402, 0x24CD0408, 0x24CD0402,
+    0x241E0408, 0x241E0402, 0x25F50408, 0x25F70408, 0x25F80408, 0x25F90408, 0x25FA0408, 0x25FB0408,
+    0x25FC0408, 0x25FD0408, 0x25FE0408, 0x25FF0408, 0x26000408, 0x26010408, 0x26020408, 0x26030408,
+    0x26040408, 0x26050408, 0x26060408, 0x26070408, 0x26080408, 0x26090408, 0x260A0408, 0x260C0408,
+    0x260D0408, 0x260E0408, 0x260F0408, 0x26100408, 0x26110408, 0x26120408, 0x26130408, 0x26140408,
+    0x26150408, 0x26160408, 0x26170408, 0x26180408, 0x26190408, 0x261A0408, 0x261B0408, 0x261C0408,
+    0x261D0402, 0x03E40402, 0x03E50402, 0x02690402, 0x022A0402, 0x02700402, 0x03E60402, 0x25F60402,
+    0x25F50402, 0x25F70402, 0x25F80402, 0x25F90402, 0x25FA0402, 0x25FB0402, 0x25FC0402, 0x25FD0402,
+    0x25FE0402, 0x25FF0402, 0x26000402, 0x26010402, 0x26020402, 0x26030402, 0x26040402, 0x26050402,
+    0x26060402, 0x26070402, 0x26080402, 0x26090402, 0x260A0402, 0x260C0402, 0x260D0402, 0x260E0402,
+    0x260F0402, 0x26100402, 0x26110402, 0x26120402, 0x26130402, 0x26140402, 0x26150402, 0x26160402,
+    0x26170402, 0x26180402, 0x26190402, 0x261A0402, 0x261B0402, 0x261C0402, 0x25FA0404, 0x26180404,
+    0x260B0402, 0x02410402, 0x020E0402, 0x052C0402, 0x052D0402, 0x1F670402, 0x00000A42, 0x00000A62,
+    0x00000A82, 0x00000AA2, 0x00000AC2, 0x00000AE2, 0x00000B02, 0x00000B22, 0x00000B42, 0x00000B62,
+    0x00000B82, 0x00000BE2, 0x03E70402, 0x00000C02, 0x03E80402, 0x00000BC2, 0x00000BA2, 0x03E90402,
+    0x03EA0402, 0x261E0402, 0x261F0402, 0x26200402, 0x26210402, 0x26220402, 0x26230402, 0x26240402,
+    0x26250402, 0x26260402, 0x26270402, 0x26280419, 0x26280402, 0x26290402, 0x262A0419, 0x262A0402,
+    0x262B0419, 0x262B0402, 0x262C0402, 0x262D0402, 0x262E0419, 0x262E0402, 0x262F0419, 0x262F0402,
+    0x26300402, 0x26310402, 0x26320402, 0x26330402, 0x26270404, 0x26220404, 0x26230404, 0x26220404,
+    0x26230404, 0x26230404, 0x26230404, 0x26270404, 0x26270404, 0x26270404, 0x03EB0402, 0x03EC0402,
+    0x067D0402, 0x067F0402, 0x052E0402, 0x03B00402, 0x03B20402, 0x1F680402, 0x022B0402, 0x022C0402,
+    0x05310402, 0x05320402, 0x023B0402, 0x02420402, 0x02710402, 0x27400402, 0x26640402, 0x26650402,
+    0x26660402, 0x26690402, 0x266A0402, 0x266E0402, 0x26720402, 0x26740402, 0x26840402, 0x26850402,
+    0x26860402, 0x268F0402, 0x26990402, 0x269A0402, 0x26A40402, 0x26A50402, 0x26B30402, 0x26B40402,
+    0x26C60402, 0x26C70402, 0x26D10402, 0x26D20402, 0x26D70402, 0x26D80402, 0x26DB0402, 0x26DC0402,
+    0x27070402, 0x27080402, 0x273D0402, 0x273E0402, 0x273F0402, 0x26E40402, 0x26F00402, 0x26F60402,
+    0x270C0402, 0x27140402, 0x27180402, 0x27220402, 0x27280402, 0x27360402, 0x27370402, 0x00000DA2,
+    0x00000E02, 0x00000E62, 0x00000EC2, 0x00000F42, 0x00000FA2, 0x00001002, 0x00001022, 0x00001042,
+    0x00001062, 0x00001082, 0x000010C2, 0x000010E2, 0x00001102, 0x00001142, 0x00001162, 0x00001182,
+    0x000011A2, 0x000011C2, 0x000011E2, 0x000010A2, 0x03AE0402, 0x022D0402, 0x022E0402, 0x03A40402,
+    0x26730402, 0x26EF0402, 0x00001302, 0x26680402, 0x26670402, 0x266B0402, 0x26640404, 0x26720404,
+    0x26640404, 0x27280404, 0x26640404, 0x272C0404, 0x26640404, 0x27370404, 0x26640404, 0x26870402,
+    0x26880402, 0x26750402, 0x26890402, 0x268A0402, 0x26760402, 0x268B0402, 0x26770402, 0x269B0402,
+    0x269C0402, 0x26900402, 0x26910402, 0x269D0402, 0x26920402, 0x26940402, 0x26A60402, 0x26A70402,
+    0x26A80402, 0x26A90402, 0x26AA0402, 0x26AB0402, 0x26AD0402, 0x26AE0402, 0x26AF0402, 0x26B50402,
+    0x26B60402, 0x26B70402, 0x26B80402, 0x26B90402, 0x26BA0402, 0x26BB0402, 0x26BC0402, 0x26BD0402,
+    0x26C80402, 0x26C90402, 0x26CA0402, 0x26D30402, 0x26D50402, 0x26D90402, 0x26DD0402, 0x26E50402,
+    0x26E60402, 0x26E80402, 0x26E90402, 0x26EB0402, 0x26EC0402, 0x26F10402, 0x26F30402, 0x26F70402,
+    0x26F80402, 0x26F90402, 0x26FA0402, 0x26FC0402, 0x26FD0402, 0x26FF0402, 0x27010402, 0x27020402,
+    0x27030402, 0x27040402, 0x27050402, 0x270D0402, 0x270E0402, 0x270F0402, 0x27100402, 0x271E0402,
+    0x27190402, 0x271B0402, 0x271C0402, 0x271D0402, 0x27230402, 0x26930402, 0x27270402, 0x00001062,
+    0x27240402, 0x27240402, 0x00001062, 0x27250402, 0x27290402, 0x272A0402, 0x272B0402, 0x272C0402,
+    0x272D0402, 0x272E0402, 0x272F0402, 0x27300402, 0x27380402, 0x27390402, 0x273A0402, 0x27320402,
+    0x273B0402, 0x273C0402, 0x27450402, 0x27450402, 0x00001062, 0x02800402, 0x27270402, 0x05330402,
+    0x27280404, 0x27370404, 0x05340402, 0x26B00402, 0x26BE0402, 0x26CB0402, 0x26D60402, 0x26DF0402,
+    0x26640404, 0x00002324, 0x27140404, 0x00002324, 0x27260402, 0x02CD0402, 0x02810402, 0x02820402,
+    0x02430402, 0x02440402, 0x02450402, 0x02460402, 0x02470402, 0x02480402, 0x02720402, 0x03ED0402,
+    0x03EE0402, 0x03EF0402, 0x03F00402, 0x27480402, 0x00001322, 0x27490402, 0x274A0402, 0x274A0404,
+    0x00002324, 0x274C0402, 0x274B0402, 0x274D0402, 0x274E0402, 0x274F0402, 0x27510402, 0x27520402,
+    0x27520404, 0x00002324, 0x27530402, 0x27540402, 0x27550402, 0x27570402, 0x27580402, 0x27590402,
+    0x275A0402, 0x275A0419, 0x275B0402, 0x275C0402, 0x275C0404, 0x00002324, 0x275E0402, 0x275F0402,
+    0x27600402, 0x27610402, 0x27620402, 0x27490404, 0x00002344, 0x274A0404, 0x00002344, 0x274C0404,
+    0x00002344, 0x00001342, 0x00001362, 0x00001382, 0x000013A2, 0x000013C2, 0x000013E2, 0x00001402,
+    0x00001422, 0x00001442, 0x00001462, 0x00001482, 0x000014A2, 0x000014C2, 0x000014E2, 0x00001502,
+    0x00001522, 0x27500402, 0x27560402, 0x275D0402, 0x26780402, 0x26790402, 0x267A0402, 0x267B0402,
+    0x267C0402, 0x267D0402, 0x267F0402, 0x269E0402, 0x269F0402, 0x26B10402, 0x26B20402, 0x26BF0402,
+    0x26CC0402, 0x26E00402, 0x26E10402, 0x26E20402, 0x26ED0402, 0x26EE0402, 0x27060402, 0x27090402,
+    0x270A0402, 0x27150402, 0x27160402, 0x271F0402, 0x27200402, 0x27210402, 0x27110402, 0x26C00402,
+    0x26C10402, 0x26CD0402, 0x26A00402, 0x26A10402, 0x26CE0402, 0x26C20402, 0x26A20402, 0x266C0402,
+    0x266D0402, 0x27410402, 0x27420402, 0x27430402, 0x27330402, 0x27340402, 0x27460402, 0x27470402,
+    0x26A30402, 0x26CF0402, 0x26D00402, 0x26FB0402, 0x27870402, 0x278A0402, 0x278B0402, 0x278C0402,
+    0x278E0402, 0x278F0402, 0x27900402, 0x27910402, 0x27940402, 0x27960402, 0x27970402, 0x27980402,
+    0x279A0402, 0x279E0402, 0x279F0402, 0x27A10402, 0x27A20402, 0x27A60402, 0x27A70402, 0x27A80402,
+    0x27A90402, 0x27AA0402, 0x27AB0402, 0x27AC0402, 0x279B0402, 0x27880402, 0x27890402, 0x27990402,
+    0x278D0402, 0x27A30402, 0x27A40402, 0x27A50402, 0x279C0402, 0x279D0402, 0x27920402, 0x27930402,
+    0x27A00402, 0x27950402, 0x27AE0402, 0x27AF0402, 0x27B00402, 0x27B10402, 0x27B20402, 0x27B30402,
+    0x27B40402, 0x27B50402, 0x27B60402, 0x27B70402, 0x27B80402, 0x27AD0402, 0x27B90402, 0x27BA0402,
+    0x27BB0402, 0x27BC0402, 0x27BD0402, 0x27BE0402, 0x27BF0402, 0x27C00402, 0x27C10402, 0x27C20402,
+    0x27C30402, 0x27C40402, 0x27C50402, 0x27C60402, 0x27C70402, 0x27C80402, 0x27C90402, 0x27CA0402,
+    0x27CB0402, 0x27CC0402, 0x27CD0402, 0x27CE0402, 0x27CF0402, 0x27D00402, 0x27D10402, 0x27D20402,
+    0x27D30402, 0x27D40402, 0x27D50402, 0x27D60402, 0x27C50404, 0x00002304, 0x27C60404, 0x00002304,
+    0x27C80404, 0x00002304, 0x00001542, 0x00001562, 0x00001582, 0x000015A2, 0x000015C2, 0x000015E2,
+    0x00001602, 0x00001622, 0x00001642, 0x27D70402, 0x27D80402, 0x05460402, 0x02CE0402, 0x022F0402,
+    0x026A0402, 0x1F690402, 0x1F6A0402, 0x264A0402, 0x264B0402, 0x264C0402, 0x264D0402, 0x264E0402,
+    0x264F0402, 0x26500402, 0x26510402, 0x26520402, 0x26530402, 0x26540402, 0x26550402, 0x26560402,
+    0x26570402, 0x26580402, 0x26590402, 0x265A0402, 0x265B0402, 0x265C0402, 0x265D0402, 0x265E0402,
+    0x265F0402, 0x26600402, 0x26610402, 0x00000D42, 0x00000D62, 0x26620402, 0x26630402, 0x00000C42,
+    0x00000C62, 0x00000C82, 0x00000CA2, 0x00000CC2, 0x00000CE2, 0x00000D02, 0x00000D22, 0x00000D82,
+    0x02490402, 0x024A0402, 0x024B0402, 0x024C0402, 0x024D0402, 0x024E0402, 0x024F0402, 0x02500402,
+    0x02510402, 0x02520402, 0x02530402, 0x02540402, 0x02550402, 0x02560402, 0x02570402, 0x276E0402,
+    0x276F0402, 0x27700402, 0x27710402, 0x27720402, 0x27730402, 0x27740402, 0x27750402, 0x27760402,
+    0x27770402, 0x27780402, 0x27790402, 0x277A0402, 0x277B0402, 0x277C0402, 0x277D0402, 0x277E0402,
+    0x277F0402, 0x27800402, 0x27810402, 0x27820402, 0x27830402, 0x27840402, 0x27850402, 0x27860402,
+    0x03F10402, 0x27630402, 0x27640402, 0x27650402, 0x27660402, 0x27670402, 0x27680402, 0x27690402,
+    0x276A0402, 0x276B0402, 0x276C0402, 0x276D0402, 0x267E0402, 0x26810402, 0x26950402, 0x26DA0402,
+    0x26EA0402, 0x26F50402, 0x27120402, 0x27170402, 0x266F0402, 0x26700402, 0x26C30402, 0x27350402,
+    0x26710402, 0x26720404, 0x26AC0402, 0x26D40402, 0x27000402, 0x27310402, 0x26C40402, 0x26E30402,
+    0x26FE0402, 0x26820402, 0x26830402, 0x268C0402, 0x26C50402, 0x27440402, 0x26E70402, 0x26F20402,
+    0x271A0402, 0x26800402, 0x268D0402, 0x268E0402, 0x26960402, 0x270B0402, 0x26DE0402, 0x26F40402,
+    0x26970402, 0x26980402, 0x27130402, 0x00001202, 0x00000EE2, 0x00000F62, 0x00000FC2, 0x00000DE2,
+    0x00000E42, 0x00000EA2, 0x00000DC2, 0x00000E22, 0x00000E82, 0x00000F02, 0x00000F22, 0x00000FE2,
+    0x00001222, 0x00001242, 0x000012C2, 0x000012E2, 0x00001282, 0x000012A2, 0x00001262, 0x00000F82,
+    0x00001122, 0x00001862, 0x00001882, 0x000018A2, 0x29DA0402, 0x29DB0402, 0x29DC0402, 0x29E20402,
+    0x29E30402, 0x29E40402, 0x29E50402, 0x29E60402, 0x29E80402, 0x29EA0402, 0x29EB0402, 0x29EC0402,
+    0x29ED0402, 0x29EF0402, 0x29F00402, 0x29F10402, 0x29F20402, 0x29F30402, 0x29F40402, 0x29F50402,
+    0x29F70402, 0x29F80402, 0x29F90402, 0x29FA0402, 0x29FB0402, 0x29FE0402, 0x29FF0402, 0x2A000402,
+    0x2A010402, 0x2A030402, 0x2A050402, 0x2A060402, 0x2A070402, 0x2A080402, 0x2A090402, 0x2A0A0402,
+    0x2A0B0402, 0x2A0B0402, 0x00001842, 0x2A0C0402, 0x2A0D0402, 0x2A0E0402, 0x2A100402, 0x2A110402,
+    0x2A120402, 0x2A140402, 0x2A140402, 0x00001842, 0x2A150402, 0x2A160402, 0x2A160402, 0x00001842,
+    0x2A170402, 0x2A180402, 0x2A190402, 0x2A1A0402, 0x2A1B0402, 0x2A240402, 0x2A250402, 0x00001842,
+    0x2A1C0402, 0x2A230402, 0x2A290402, 0x2A2A0402, 0x2A2B0402, 0x2A2C0402, 0x2A2D0402, 0x2A2E0402,
+    0x2A310402, 0x2A330402, 0x2A340402, 0x2A360402, 0x2A380402, 0x2A390402, 0x2A3A0402, 0x2A3B0402,
+    0x2A3C0402, 0x2A350402, 0x2A260402, 0x29D70402, 0x2A320402, 0x2A270402, 0x2A280402, 0x29F30402,
+    0x00001842, 0x29F40402, 0x00001842, 0x29F50402, 0x00001842, 0x29FB0402, 0x00001842, 0x2A030402,
+    0x00001842, 0x2A050402, 0x00001842, 0x2A0D0402, 0x00001842, 0x2A120402, 0x00001842, 0x29E70402,
+    0x29E90402, 0x2A2F0402, 0x2A300402, 0x02960402, 0x02970402, 0x04000402, 0x1F480402, 0x29D90402,
+    0x29DD0402, 0x29DE0402, 0x29DF0402, 0x29E00402, 0x29E10402, 0x2A020402, 0x29FC0402, 0x2A130402,
+    0x29F60402, 0x29FD0402, 0x2A1D0402, 0x2A040402, 0x2A0F0402, 0x2A3D0402, 0x2A3E0402, 0x2A3F0402,
+    0x2A400402, 0x2A410402, 0x2A420402, 0x2A430402, 0x2A440402, 0x2A460402, 0x2A480402, 0x2A490402,
+    0x2A4A0402, 0x2A4B0402, 0x2A4C0402, 0x2A4D0402, 0x2A4E0402, 0x2A4F0402, 0x2A500402, 0x2A510402,
+    0x2A520402, 0x2A530402, 0x2A540402, 0x2A550402, 0x2A560402, 0x2A570402, 0x2A580402, 0x2A590402,
+    0x2A5A0402, 0x2A5B0402, 0x2A5C0402, 0x2A5D0402, 0x2A5E0402, 0x2A5F0402, 0x2A600402, 0x2A610402,
+    0x2A620402, 0x2A630402, 0x2A640402, 0x2A650402, 0x2A660402, 0x2A680402, 0x2A6A0402, 0x2A6B0402,
+    0x2A6C0402, 0x2A6D0402, 0x2A6E0402, 0x2A6F0402, 0x2A700402, 0x2A710402, 0x2A720402, 0x2A730402,
+    0x2A740402, 0x2A750402, 0x2A780402, 0x2A790402, 0x2A7A0402, 0x2A7B0402, 0x2A7C0402, 0x2A5B0404,
+    0x2A7C0404, 0x2A7D0402, 0x2A580402, 0x00001842, 0x2A590402, 0x00001842, 0x2A650402, 0x00001842,
+    0x2A450402, 0x2A470402, 0x2A760402, 0x2A770402, 0x2A670402, 0x2A690402, 0x1F6B0402, 0x1F6C0402,
+    0x1D560402, 0x1D570402, 0x1D580402, 0x1D590402, 0x1D5A0402, 0x1D5B0402, 0x05470402, 0x1F6D0402,
+    0x2A7E0402, 0x04050402, 0x000018C2, 0x2A840402, 0x2A850402, 0x2A890402, 0x2A8A0402, 0x2A810402,
+    0x2A820402, 0x2A8B0402, 0x2A860402, 0x2A830402, 0x2A870402, 0x2A8F0402, 0x2A900402, 0x2A910402,
+    0x2A920402, 0x2A930402, 0x2A940402, 0x2A950402, 0x2A960402, 0x2A970402, 0x2A980402, 0x2A990402,
+    0x2A9A0402, 0x2A9B0402, 0x2A9C0402, 0x2A9D0402, 0x2A9E0402, 0x2A9F0402, 0x2AA00402, 0x2AA10402,
+    0x2AA20402, 0x2AA30402, 0x2AA40402, 0x2AA50402, 0x2AA60402, 0x2AA70402, 0x2AA80402, 0x2AAA0402,
+    0x2AAB0402, 0x2AAB0402, 0x00001842, 0x2AAC0402, 0x2A8C0402, 0x00001842, 0x2A8C0402, 0x2A8D0402,
+    0x2AAE0402, 0x2AAF0402, 0x2AB00402, 0x2AB10402, 0x2AB20402, 0x2AB30402, 0x2AB40402, 0x2AB50402,
+    0x2AB60402, 0x2AB70402, 0x2A8E0402, 0x2A900402, 0x00001842, 0x2A910402, 0x00001842, 0x2A960402,
+    0x00001842, 0x2AAD0402, 0x2AA40402, 0x00001842, 0x000018E2, 0x00001902, 0x2A880402, 0x2A800402,
+    0x2A7F0402, 0x2AA90402, 0x04060402, 0x2AB90402, 0x2ABA0402, 0x2ABB0402, 0x2ABC0402, 0x2ABD0402,
+    0x2ABE0402, 0x2ABF0402, 0x2AC10402, 0x2AC30402, 0x2AC40402, 0x2AC50402, 0x2AC60402, 0x2AC70402,
+    0x2AC80402, 0x2AC90402, 0x2ACA0402, 0x2ACB0402, 0x2ACC0402, 0x2ACD0402, 0x2ACE0402, 0x2ACF0402,
+    0x2AD00402, 0x2AD20402, 0x2AD30402, 0x2AD40402, 0x2AD50402, 0x2AD60402, 0x2AD70402, 0x2AD80402,
+    0x2AD90402, 0x2ADA0402, 0x2ADB0402, 0x2ADC0402, 0x2ADD0402, 0x2ADE0402, 0x2ADF0402, 0x2AE00402,
+    0x2AE10402, 0x2AE20402, 0x2AE30402, 0x2AE40402, 0x2AE50402, 0x2AEB0402, 0x2AE60402, 0x2AE70402,
+    0x2AE80402, 0x2AE90402, 0x2AEA0402, 0x2AEC0402, 0x2AED0402, 0x2AEE0402, 0x2AEF0402, 0x2AF00402,
+    0x2AF10402, 0x2AF20402, 0x2AF30402, 0x2AF60402, 0x2AF70402, 0x2AF80402, 0x2AF90402, 0x2AFA0402,
+    0x2AFB0402, 0x2AFC0402, 0x2AB80402, 0x2AC00402, 0x2AC20402, 0x2AF40402, 0x2AF50402, 0x04070402,
+    0x1F6E0402, 0x2AD10402, 0x2AFD0402, 0x2AFE0402, 0x2AFF0402, 0x2B000402, 0x2B010402, 0x2B020402,
+    0x2B030402, 0x2B050402, 0x2B070402, 0x2B080402, 0x2B090402, 0x2B0A0402, 0x2B0B0402, 0x2B0C0402,
+    0x2B0D0402, 0x2B0E0402, 0x2B0F0402, 0x2B100402, 0x2B110402, 0x2B120402, 0x2B130402, 0x2B140402,
+    0x2B150402, 0x2B160402, 0x2B170402, 0x2B180402, 0x2B190402, 0x2B1A0402, 0x2B1B0402, 0x2B1C0402,
+    0x2B1D0402, 0x2B1E0402, 0x2B1F0402, 0x2B200402, 0x2B210402, 0x2B220402, 0x2B230402, 0x2B240402,
+    0x2B260402, 0x2B270402, 0x2B280402, 0x2B290402, 0x2B2B0402, 0x2B2C0402, 0x2B2D0402, 0x2B2E0402,
+    0x2B2F0402, 0x2B300402, 0x2B310402, 0x2B320402, 0x2B330402, 0x2B340402, 0x2B350402, 0x2B360402,
+    0x2B390402, 0x2B3A0402, 0x2B3B0402, 0x2B3C0402, 0x2B3D0402, 0x2B3E0402, 0x2B3F0402, 0x2B170402,
+    0x00001842, 0x2B180402, 0x00001842, 0x2B250402, 0x2B040402, 0x2B060402, 0x2B370402, 0x2B380402,
+    0x05480402, 0x2B2A0402, 0x1D5C0402, 0x1D5D0402, 0x1D5E0402, 0x1D5F0402, 0x1D600402, 0x1D610402,
+    0x2B4D0402, 0x2B410402, 0x2B420402, 0x2B430402, 0x2B440402, 0x2B450402, 0x2B460402, 0x2B470402,
+    0x2B480402, 0x2B490402, 0x2B4A0402, 0x2B4B0402, 0x2B4C0402, 0x2B4E0402, 0x2B4F0402, 0x2B500402,
+    0x2B600402, 0x2B510402, 0x2B520402, 0x2B530402, 0x2B540402, 0x2B550402, 0x2B5F0402, 0x2B560402,
+    0x2B570402, 0x2B580402, 0x2B590402, 0x2B5E0402, 0x2B5A0402, 0x2B5D0402, 0x2B5C0402, 0x2B5B0402,
+    0x2B610402, 0x2B620402, 0x2B630402, 0x2B640402, 0x2B650402, 0x2B660402, 0x2B670402, 0x2B680402,
+    0x2B690402, 0x2B6A0402, 0x2B6B0402, 0x2B6C0402, 0x2B6D0402, 0x2B6E0402, 0x2B6F0402, 0x2B700402,
+    0x2B400402, 0x2B710402, 0x1D680402, 0x1D690402, 0x1D6A0402, 0x05490402, 0x054A0402, 0x054B0402,
+    0x054C0402, 0x054D0402, 0x054E0402, 0x1F700402, 0x054F0402, 0x2B720402, 0x2B730402, 0x2B740402,
+    0x2B750402, 0x2B760402, 0x2B770402, 0x2B780402, 0x2B7A0402, 0x2B7C0402, 0x2B7D0402, 0x2B7E0402,
+    0x2B7F0402, 0x2B800402, 0x2B810402, 0x2B820402, 0x2B830402, 0x2B840402, 0x2B850402, 0x2B860402,
+    0x2B870402, 0x2B890402, 0x2B8A0402, 0x2B8C0402, 0x2B8D0402, 0x2B8E0402, 0x2B8F0402, 0x2B900402,
+    0x2B910402, 0x2B920402, 0x2B930402, 0x2B940402, 0x2B950402, 0x2B960402, 0x2B970402, 0x2B980402,
+    0x2B990402, 0x2B9A0402, 0x2B9B0402, 0x2B9C0402, 0x2B9D0402, 0x2B9E0402, 0x2B9F0402, 0x2BA00402,
+    0x2BA60402, 0x2BA70402, 0x2BA10402, 0x2BA20402, 0x2BA30402, 0x2BA40402, 0x2BA50402, 0x2BA90402,
+    0x2BAA0402, 0x2BAB0402, 0x2BAC0402, 0x2BAD0402, 0x2BAE0402, 0x2BAF0402, 0x2BB00402, 0x2BB30402,
+    0x2BB40402, 0x2BB50402, 0x2BB60402, 0x2BB70402, 0x2BB80402, 0x2BB90402, 0x2BBA0402, 0x2BBB0402,
+    0x2B880402, 0x2B8B0402, 0x2BA80402, 0x2B790402, 0x2B7B0402, 0x2BB10402, 0x2BB20402, 0x04080402,
+    0x05690402, 0x2BF30402, 0x04090402, 0x2BBC0402, 0x2BBD0402, 0x2BBE0402, 0x2BBF0402, 0x2BC00402,
+    0x2BC10402, 0x2BC20402, 0x2BC40402, 0x2BC60402, 0x2BC70402, 0x2BC80402, 0x2BC90402, 0x2BCA0402,
+    0x2BCB0402, 0x2BCC0402, 0x2BCD0402, 0x2BCE0402, 0x2BCF0402, 0x2BD00402, 0x2BD10402, 0x2BD20402,
+    0x2BD30402, 0x2BD40402, 0x2BD50402, 0x2BD60402, 0x2BD70402, 0x2BD80402, 0x2BD90402, 0x2BDA0402,
+    0x2BDB0402, 0x2BDC0402, 0x2BDD0402, 0x2BDE0402, 0x2BDF0402, 0x2BE00402, 0x2BE10402, 0x2BE20402,
+    0x2BE30402, 0x2BE40402, 0x2BE50402, 0x2BE60402, 0x2BE70402, 0x2BE80402, 0x2BEE0402, 0x2BE90402,
+    0x2BEA0402, 0x2BEB0402, 0x2BEC0402, 0x2BED0402, 0x2BF00402, 0x2BF40402, 0x2BF50402, 0x2BF60402,
+    0x2BF70402, 0x2BF80402, 0x2BF90402, 0x2BFA0402, 0x2BFD0402, 0x2BFE0402, 0x2BFF0402, 0x2C000402,
+    0x2C010402, 0x2C020402, 0x2C030402, 0x2C040402, 0x2C050402, 0x2BEF0402, 0x2BC30402, 0x2BC50402,
+    0x2BFB0402, 0x2BFC0402, 0x2BF10402, 0x2BF20402, 0x2C3E0402, 0x2C060402, 0x2C070402, 0x2C080402,
+    0x2C090402, 0x2C0B0402, 0x2C0C0402, 0x2C0D0402, 0x2C0F0402, 0x2C110402, 0x2C120402, 0x2C130402,
+    0x2C140402, 0x2C150402, 0x2C160402, 0x2C170402, 0x2C180402, 0x2C190402, 0x2C1A0402, 0x2C1B0402,
+    0x2C1C0402, 0x2C1D0402, 0x2C1E0402, 0x2C1F0402, 0x2C200402, 0x2C210402, 0x2C220402, 0x2C230402,
+    0x2C240402, 0x2C250402, 0x2C260402, 0x2C270402, 0x2C280402, 0x2C290402, 0x2C2A0402, 0x2C2B0402,
+    0x2C2C0402, 0x2C2D0402, 0x2C2E0402, 0x2C2F0402, 0x2C300402, 0x2C310402, 0x2C320402, 0x2C3B0402,
+    0x2C330402, 0x2C390402, 0x2C3A0402, 0x2C340402, 0x2C350402, 0x2C360402, 0x2C370402, 0x2C380402,
+    0x2C3C0402, 0x2C4F0404, 0x2C3D0402, 0x2C3F0402, 0x2C400402, 0x2C410402, 0x2C420402, 0x2C430402,
+    0x2C440402, 0x2C450402, 0x2C480402, 0x2C490402, 0x2C4A0402, 0x2C4B0402, 0x2C4C0402, 0x2C4D0402,
+    0x2C4F0402, 0x2C320404, 0x2C4F0404, 0x056A0402, 0x2C300404, 0x2C4F0404, 0x2C310404, 0x2C4F0404,
+    0x2C3A0404, 0x2C4F0404, 0x2C4E0402, 0x1D800402, 0x1D810402, 0x1D820402, 0x1D830402, 0x1D840402,
+    0x1D850402, 0x1D860402, 0x2C0A0402, 0x2C0E0402, 0x2C100402, 0x2C460402, 0x2C470402, 0x1D870402,
+    0x1D880402, 0x1D890402, 0x1D8A0402, 0x1D8B0402, 0x1D8C0402, 0x1D8D0402, 0x1D8E0402, 0x1D8F0402,
+    0x056B0402, 0x2C250404, 0x2C4F0404, 0x2C2A0404, 0x2C4F0404, 0x2C330404, 0x2C4F0404, 0x2C390404,
+    0x2C4F0404, 0x2C170404, 0x2C4F0404, 0x2C500402, 0x2C510402, 0x2C520402, 0x2C530402, 0x2C540402,
+    0x2C550402, 0x2C560402, 0x2C570402, 0x2C580402, 0x2C590402, 0x2C5A0402, 0x2C5B0402, 0x2C5C0402,
+    0x2C5D0402, 0x2C5E0402, 0x2C5F0402, 0x2C600402, 0x2C610402, 0x2C620402, 0x2C630402, 0x2C640402,
+    0x2C650402, 0x2C660402, 0x2C670402, 0x2C680402, 0x2C690402, 0x2C6A0402, 0x2C6B0402, 0x2C6C0402,
+    0x2C6D0402, 0x2C6E0402, 0x2C6F0402, 0x2C700402, 0x2C710402, 0x2C720402, 0x2C730402, 0x2C740402,
+    0x2C750402, 0x2C760402, 0x2C770402, 0x2C780402, 0x2C790402, 0x2C7A0402, 0x2C7B0402, 0x2C7C0402,
+    0x2C7D0402, 0x2C7E0402, 0x2C7F0402, 0x2C800402, 0x2C810402, 0x2C820402, 0x2C830402, 0x2C840402,
+    0x2C850402, 0x2C860402, 0x2C870402, 0x2C880402, 0x2C890402, 0x2C8A0402, 0x2C9C0402, 0x2C8B0402,
+    0x2C8C0402, 0x2C8D0402, 0x2C8E0402, 0x2C8F0402, 0x2C900402, 0x2C910402, 0x2C920402, 0x2C960402,
+    0x2C970402, 0x2C980402, 0x2C990402, 0x2C9A0402, 0x2C9B0402, 0x2C940402, 0x2C930402, 0x2C950402,
+    0x040A0402, 0x32170402, 0x32180402, 0x32190402, 0x321A0402, 0x321B0402, 0x321C0402, 0x321D0402,
+    0x321E0402, 0x321F0402, 0x32200402, 0x32210402, 0x32220402, 0x32230402, 0x32240402, 0x32250402,
+    0x32260402, 0x32270402, 0x32280402, 0x32290402, 0x322A0402, 0x322B0402, 0x322C0402, 0x322D0402,
+    0x322E0402, 0x322F0402, 0x32300402, 0x32310402, 0x32320402, 0x32330402, 0x32340402, 0x32350402,
+    0x32360402, 0x32370402, 0x32380402, 0x32390402, 0x323A0402, 0x323B0402, 0x323C0402, 0x323D0402,
+    0x323E0402, 0x323F0402, 0x32400402, 0x32410402, 0x32420402, 0x32430402, 0x32440402, 0x32450402,
+    0x32460402, 0x32470402, 0x32480402, 0x32490402, 0x324A0402, 0x324B0402, 0x324C0402, 0x324D0402,
+    0x324E0402, 0x324F0402, 0x32500402, 0x1F750402, 0x32510402, 0x32520402, 0x32530402, 0x32540402,
+    0x32550402, 0x32560402, 0x1F490402, 0x00001A82, 0x00001AA2, 0x00001AC2, 0x00001AE2, 0x00001B02,
+    0x00001B22, 0x00001B42, 0x00001A62, 0x040B0402, 0x040C0402, 0x040D0402, 0x32580402, 0x32590402,
+    0x325A0402, 0x325B0402, 0x325C0402, 0x325D0402, 0x325E0402, 0x32600402, 0x32610402, 0x32640402,
+    0x32620402, 0x32650402, 0x32660402, 0x32670402, 0x32680402, 0x32690402, 0x326A0402, 0x326B0402,
+    0x326C0402, 0x326D0402, 0x326E0402, 0x326F0402, 0x32700402, 0x32710402, 0x32720402, 0x32730402,
+    0x32740402, 0x32750402, 0x32760402, 0x32770402, 0x32780402, 0x32790402, 0x327A0402, 0x327B0402,
+    0x327C0402, 0x327D0402, 0x325F0402, 0x327E0402, 0x327F0402, 0x32800402, 0x32810402, 0x32820402,
+    0x32830402, 0x32840402, 0x32850402, 0x32860402, 0x32870402, 0x32880402, 0x32890402, 0x328A0402,
+    0x328B0402, 0x328C0402, 0x328D0402, 0x328E0402, 0x328F0402, 0x32900402, 0x32910402, 0x32920402,
+    0x32930402, 0x32940402, 0x32950402, 0x1F4A0402, 0x00001B62, 0x00001B82, 0x00001BA2, 0x00001BC2,
+    0x00001BE2, 0x00001C02, 0x327E0404, 0x326F0404, 0x327E0404, 0x32770404, 0x32570402, 0x32630402,
+    0x331F0404, 0x33360404, 0x00001884, 0x05730402, 0x05740402, 0x05750402, 0x04100402, 0x04110402,
+    0x04120402, 0x04130402, 0x04140402, 0x04150402, 0x04160402, 0x04190402, 0x0419041B, 0x041A0402,
+    0x041B0402, 0x041C0402, 0x041D0402, 0x041E0402, 0x041F0402, 0x05760402, 0x025F0402, 0x05770402,
+    0x05780402, 0x05790402, 0x057A0402, 0x057B0402, 0x057C0402, 0x057D0402, 0x057E0402, 0x057F0402,
+    0x1F990404, 0x1F9A0404, 0x1F9B0404, 0x1F9C0404, 0x1F9D0404, 0x1F9E0404, 0x1F9F0404, 0x1FA00404,
+    0x1FA10404, 0x1F980404, 0x05800402, 0x05810402, 0x05820402, 0x00001C62, 0x032E0402, 0x032F0402,
+    0x03300402, 0x03310402, 0x32D90402, 0x32DC0402, 0x32DE0402, 0x32DE0402, 0x331E0402, 0x32E00402,
+    0x32E20402, 0x32E40402, 0x32E60402, 0x32E80402, 0x32EA0402, 0x32EC0402, 0x32EE0402, 0x32EE0402,
+    0x331E0402, 0x32F00402, 0x32F20402, 0x32F40402, 0x32F60402, 0x32F60402, 0x331E0402, 0x32F80402,
+    0x32FA0402, 0x32FC0402, 0x32FE0402, 0x32FE0402, 0x331E0402, 0x33000402, 0x33020402, 0x33040402,
+    0x33060402, 0x33060402, 0x331E0402, 0x33080402, 0x330A0402, 0x330C0402, 0x330E0402, 0x33100402,
+    0x33120402, 0x33150402, 0x33170402, 0x33190402, 0x331B0402, 0x331D0402, 0x331F0402, 0x32D90402,
+    0x331A0402, 0x33120404, 0x00002324, 0x32DB0402, 0x33140402, 0x33290402, 0x332A0402, 0x332B0402,
+    0x332E0402, 0x332F0402, 0x33300402, 0x33310402, 0x33320402, 0x33330402, 0x33340402, 0x33350402,
+    0x33360402, 0x33370402, 0x332C0402, 0x332D0402, 0x33380402, 0x04200402, 0x33210402, 0x33230402,
+    0x33270402, 0x33280402, 0x33250402, 0x33220402, 0x33240402, 0x33260402, 0x32DA0402, 0x32DD0402,
+    0x32DF0402, 0x32DF0402, 0x331E0402, 0x32E10402, 0x32E30402, 0x32E50402, 0x32E70402, 0x32E90402,
+    0x32EB0402, 0x32ED0402, 0x32EF0402, 0x32EF0402, 0x331E0402, 0x32F10402, 0x32F30402, 0x32F50402,
+    0x32F70402, 0x32F70402, 0x331E0402, 0x32F90402, 0x32FB0402, 0x32FD0402, 0x32FF0402, 0x32FF0402,
+    0x331E0402, 0x33010402, 0x33030402, 0x33050402, 0x33070402, 0x33070402, 0x331E0402, 0x33090402,
+    0x330B0402, 0x330D0402, 0x330F0402, 0x33110402, 0x33130402, 0x33160402, 0x33180402, 0x331A0402,
+    0x331C0402, 0x331E0402, 0x33200402, 0x32DA0402, 0x331A0402, 0x33090404, 0x00002324, 0x33110404,
+    0x00002324, 0x33130404, 0x00002324, 0x05830402, 0x05840402, 0x05850402, 0x05860402, 0x05870402,
+    0x05880402, 0x05890402, 0x058A0402, 0x058B0402, 0x058C0402, 0x058D0402, 0x058E0402, 0x058F0402,
+    0x05900402, 0x05910402, 0x05920402, 0x04170402, 0x04180402, 0x04210402, 0x04220402, 0x04230402,
+    0x05930402, 0x05940402, 0x05950402, 0x05960402, 0x04240402, 0x04250402, 0x356C0402, 0x356E0402,
+    0x35700402, 0x35740402, 0x35770402, 0x35790402, 0x357C0402, 0x35800402, 0x35850402, 0x358C0402,
+    0x35900402, 0x35910402, 0x35930402, 0x35950402, 0x35980402, 0x359B0402, 0x359F0402, 0x35A00402,
+    0x35A10402, 0x35A40402, 0x35A70402, 0x35AB0402, 0x35AC0402, 0x35B20402, 0x35B50402, 0x35B80402,
+    0x35BA0402, 0x35BC0402, 0x35C00402, 0x35C20402, 0x35C90402, 0x35CB0402, 0x35D10402, 0x35D80402,
+    0x35D90402, 0x35DA0402, 0x35DB0402, 0x35DC0402, 0x35DD0402, 0x35E20402, 0x35E30402, 0x35E40402,
+    0x35E50402, 0x35E60404, 0x35E60402, 0x35EA0402, 0x35EC0402, 0x35EE0402, 0x35F10402, 0x35F60402,
+    0x35FA0402, 0x35ED0402, 0x35FC0402, 0x35F80402, 0x00001CE2, 0x36020402, 0x36030402, 0x35BB0402,
+    0x35BF0402, 0x35C30402, 0x35CE0402, 0x35C90404, 0x36020404, 0x35C90404, 0x02A10402, 0x02A20402,
+    0x043B0402, 0x043C0402, 0x043D0402, 0x043E0402, 0x35C60402, 0x35C70402, 0x35DE0402, 0x35DF0402,
+    0x35E00402, 0x35E10402, 0x35F20402, 0x35F30402, 0x35F40402, 0x35F50402, 0x35780402, 0x35860402,
+    0x35D30402, 0x35D40402, 0x35AA0402, 0x35B90402, 0x35C10402, 0x358A0402, 0x35FD0402, 0x36040402,
+    0x36050402, 0x35C80402, 0x35D70402, 0x35FE0402, 0x35FF0402, 0x36060402, 0x36070402, 0x36080402,
+    0x36090402, 0x360A0402, 0x359C0402, 0x35D50402, 0x35D60402, 0x35EB0402, 0x35E80402, 0x35EF0402,
+    0x35F00402, 0x356D0402, 0x356F0402, 0x35710402, 0x357A0402, 0x35830402, 0x358D0402, 0x35A20402,
+    0x35A80402, 0x35AD0402, 0x35AE0402, 0x35B30402, 0x35C50402, 0x35CC0402, 0x35C40402, 0x35E70402,
+    0x35F70402, 0x35F90402, 0x36010402, 0x360B0402, 0x360D0402, 0x36100402, 0x36110402, 0x360C0402,
+    0x360E0402, 0x360F0402, 0x35B00402, 0x36120402, 0x36130402, 0x36140402, 0x35E90402, 0x35FB0402,
+    0x05990402, 0x059A0402, 0x25A00408, 0x25A20408, 0x25A40408, 0x25A60408, 0x25A80408, 0x25AA0408,
+    0x25AC0408, 0x25B00408, 0x25B20408, 0x25B40408, 0x25B60408, 0x25B80408, 0x25BA0408, 0x25BE0408,
+    0x25C00408, 0x25C20408, 0x25C40408, 0x25C60408, 0x25C80408, 0x25CC0408, 0x25CE0408, 0x25D00408,
+    0x25D20408, 0x25D40408, 0x25D60408, 0x25D80408, 0x25DA0408, 0x25DC0408, 0x25DE0408, 0x25E00408,
+    0x25E20408, 0x25E60408, 0x25E80408, 0x25AE0408, 0x25BC0408, 0x25CA0408, 0x25E40408, 0x25EA0408,
+    0x25ED0408, 0x25F20408, 0x259F0402, 0x25A10402, 0x25A30402, 0x25A50402, 0x25A70402, 0x25A90402,
+    0x25AB0402, 0x25AF0402, 0x25B10402, 0x25B30402, 0x25B50402, 0x25B70402, 0x25B90402, 0x25BD0402,
+    0x25BF0402, 0x25C10402, 0x25C30402, 0x25C50402, 0x25C70402, 0x25CB0402, 0x25CD0402, 0x25CF0402,
+    0x25D10402, 0x25D30402, 0x25D50402, 0x25D70402, 0x25D90402, 0x25DB0402, 0x25DD0402, 0x25DF0402,
+    0x25E10402, 0x25E50402, 0x25E70402, 0x25AD0402, 0x25BB0402, 0x25C90402, 0x25E30402, 0x25E90402,
+    0x25EB0402, 0x25EC0402, 0x25EE0402, 0x25EF0402, 0x25F00402, 0x02CF0402, 0x25B90414, 0x25F10402,
+    0x25F30402, 0x25F40402, 0x41750402, 0x41760402, 0x41770402, 0x41780402, 0x41790402, 0x417A0402,
+    0x417B0402, 0x417C0402, 0x417D0402, 0x417E0402, 0x417F0402, 0x41800402, 0x41810402, 0x41820402,
+    0x41830402, 0x41840402, 0x41850402, 0x41860402, 0x41870402, 0x41880402, 0x41890402, 0x418A0402,
+    0x418B0402, 0x418C0402, 0x418D0402, 0x418E0402, 0x418F0402, 0x41900402, 0x41910402, 0x41920402,
+    0x41930402, 0x41940402, 0x41950402, 0x41960402, 0x41970402, 0x41980402, 0x41990402, 0x419A0402,
+    0x419B0402, 0x419C0402, 0x419D0402, 0x419E0402, 0x419F0402, 0x41A00402, 0x41A10402, 0x41A20402,
+    0x41A30402, 0x41A40402, 0x41A50402, 0x41A60402, 0x41A70402, 0x41A80402, 0x41A90402, 0x41AA0402,
+    0x41AB0402, 0x41AC0402, 0x41AD0402, 0x41AE0402, 0x41AF0402, 0x41B00402, 0x41B10402, 0x41B20402,
+    0x41B30402, 0x41B40402, 0x41B50402, 0x41B60402, 0x41B70402, 0x41B80402, 0x41B90402, 0x41BA0402,
+    0x41BB0402, 0x41BC0402, 0x41BD0402, 0x41BE0402, 0x41BF0402, 0x41C00402, 0x41C10402, 0x41C20402,
+    0x41C30402, 0x41C40402, 0x41C50402, 0x41C60402, 0x41C70402, 0x41C80402, 0x41C90402, 0x41CA0402,
+    0x41CB0402, 0x41CC0402, 0x41CD0402, 0x41CE0402, 0x41CF0402, 0x41D00402, 0x41D10402, 0x41D20402,
+    0x41D30402, 0x41F10402, 0x41F20402, 0x41F30402, 0x41F40402, 0x41F50402, 0x41F60402, 0x41F70402,
+    0x41F80402, 0x41F90402, 0x41FA0402, 0x41FB0402, 0x41FC0402, 0x41FD0402, 0x41FE0402, 0x41FF0402,
+    0x42000402, 0x42010402, 0x42020402, 0x42030402, 0x42040402, 0x42050402, 0x42060402, 0x42070402,
+    0x42080402, 0x42090402, 0x420A0402, 0x420B0402, 0x420C0402, 0x420D0402, 0x420E0402, 0x420F0402,
+    0x42100402, 0x42110402, 0x42120402, 0x42130402, 0x42140402, 0x42150402, 0x42160402, 0x42170402,
+    0x42180402, 0x42190402, 0x421A0402, 0x421B0402, 0x421C0402, 0x421D0402, 0x421E0402, 0x421F0402,
+    0x42200402, 0x42210402, 0x42220402, 0x42230402, 0x42240402, 0x42250402, 0x42260402, 0x42270402,
+    0x42280402, 0x42290402, 0x422A0402, 0x422B0402, 0x422C0402, 0x422D0402, 0x422E0402, 0x422F0402,
+    0x42300402, 0x42310402, 0x42320402, 0x42330402, 0x42340402, 0x42350402, 0x42360402, 0x42370402,
+    0x42380402, 0x42390402, 0x42510402, 0x42520402, 0x42530402, 0x42540402, 0x42550402, 0x42560402,
+    0x42570402, 0x42580402, 0x42590402, 0x425A0402, 0x425B0402, 0x425C0402, 0x425D0402, 0x425E0402,
+    0x425F0402, 0x42600402, 0x42610402, 0x42620402, 0x42630402, 0x42640402, 0x42650402, 0x42660402,
+    0x42670402, 0x42680402, 0x42690402, 0x426A0402, 0x426B0402, 0x426C0402, 0x426D0402, 0x426E0402,
+    0x426F0402, 0x42700402, 0x42710402, 0x42720402, 0x42730402, 0x42740402, 0x42750402, 0x42760402,
+    0x42770402, 0x42780402, 0x42790402, 0x427A0402, 0x427B0402, 0x427C0402, 0x427D0402, 0x427E0402,
+    0x427F0402, 0x42800402, 0x42810402, 0x42820402, 0x42830402, 0x42840402, 0x42850402, 0x42860402,
+    0x42870402, 0x42880402, 0x42890402, 0x428A0402, 0x428B0402, 0x428C0402, 0x428D0402, 0x428E0402,
+    0x428F0402, 0x42900402, 0x42910402, 0x42920402, 0x42930402, 0x42940402, 0x42950402, 0x42960402,
+    0x42970402, 0x42980402, 0x42990402, 0x429A0402, 0x429B0402, 0x429C0402, 0x429D0402, 0x429E0402,
+    0x429F0402, 0x42A00402, 0x42A10402, 0x42A20402, 0x42A30402, 0x42A40402, 0x42A50402, 0x42A60402,
+    0x42A70402, 0x42A80402, 0x28120402, 0x28130402, 0x28140402, 0x28150402, 0x28160402, 0x28170402,
+    0x28180402, 0x28190402, 0x281A0402, 0x281B0402, 0x281C0402, 0x281D0402, 0x281E0402, 0x281F0402,
+    0x28200402, 0x28210402, 0x28230402, 0x28240402, 0x28250402, 0x28260402, 0x28270402, 0x28280402,
+    0x28290402, 0x282A0402, 0x282B0402, 0x282C0402, 0x282D0402, 0x282E0402, 0x282F0402, 0x28300402,
+    0x28310402, 0x28320402, 0x28380402, 0x28390402, 0x283A0402, 0x283B0402, 0x283C0402, 0x283D0402,
+    0x283E0402, 0x283F0402, 0x28400402, 0x28410402, 0x28420402, 0x28430402, 0x28440402, 0x28450402,
+    0x28460402, 0x28470402, 0x28490402, 0x284A0402, 0x284B0402, 0x284C0402, 0x284D0402, 0x284E0402,
+    0x284F0402, 0x28500402, 0x28580402, 0x28590402, 0x285A0402, 0x285B0402, 0x285C0402, 0x285D0402,
+    0x285E0402, 0x285F0402, 0x28610402, 0x28620402, 0x28630402, 0x28640402, 0x28650402, 0x28660402,
+    0x28670402, 0x28680402, 0x28690402, 0x286A0402, 0x286B0402, 0x286C0402, 0x286D0402, 0x286E0402,
+    0x286F0402, 0x28700402, 0x28710402, 0x28720402, 0x28730402, 0x28740402, 0x28750402, 0x28760402,
+    0x28770402, 0x28780402, 0x28790402, 0x287A0402, 0x287B0402, 0x287C0402, 0x287D0402, 0x287E0402,
+    0x287F0402, 0x28800402, 0x28810402, 0x28870402, 0x28880402, 0x28890402, 0x288A0402, 0x288B0402,
+    0x288C0402, 0x288D0402, 0x288E0402, 0x288F0402, 0x28900402, 0x28910402, 0x28920402, 0x28930402,
+    0x28940402, 0x28950402, 0x28960402, 0x28980402, 0x28990402, 0x289A0402, 0x289B0402, 0x289C0402,
+    0x289D0402, 0x289E0402, 0x289F0402, 0x28A10402, 0x28A20402, 0x28A30402, 0x28A40402, 0x28A50402,
+    0x28A60402, 0x28A70402, 0x28A80402, 0x28A90402, 0x28AA0402, 0x28AB0402, 0x28AC0402, 0x28AD0402,
+    0x28AE0402, 0x28AF0402, 0x28B00402, 0x28B10402, 0x28B20402, 0x28B30402, 0x28B40402, 0x28B50402,
+    0x28B70402, 0x28B80402, 0x28B90402, 0x28BA0402, 0x28BB0402, 0x28BC0402, 0x28BD0402, 0x28BE0402,
+    0x28C00402, 0x28C10402, 0x28C20402, 0x28C30402, 0x28C40402, 0x28C50402, 0x28C60402, 0x28C70402,
+    0x28C90402, 0x28CA0402, 0x28CB0402, 0x28CC0402, 0x28CD0402, 0x28CE0402, 0x28CF0402, 0x28D00402,
+    0x28D10402, 0x28D20402, 0x28D30402, 0x28D40402, 0x28D50402, 0x28D60402, 0x28D70402, 0x28D80402,
+    0x28D90402, 0x28DA0402, 0x28DB0402, 0x28DC0402, 0x28DD0402, 0x28DE0402, 0x28DF0402, 0x28E00402,
+    0x28E10402, 0x28E20402, 0x28E30402, 0x28E40402, 0x28E50402, 0x28E60402, 0x28E70402, 0x28E80402,
+    0x28E90402, 0x28EA0402, 0x28EB0402, 0x28EC0402, 0x28ED0402, 0x28EE0402, 0x28EF0402, 0x28F00402,
+    0x28F10402, 0x28F20402, 0x28F30402, 0x28F40402, 0x28F50402, 0x28F60402, 0x28F70402, 0x28F80402,
+    0x29000402, 0x29010402, 0x29020402, 0x29030402, 0x29040402, 0x29050402, 0x29060402, 0x29070402,
+    0x29080402, 0x29090402, 0x290A0402, 0x290B0402, 0x290C0402, 0x290D0402, 0x290E0402, 0x290F0402,
+    0x29100402, 0x29110402, 0x29120402, 0x29130402, 0x29140402, 0x29150402, 0x29160402, 0x29170402,
+    0x291F0402, 0x29200402, 0x29210402, 0x29220402, 0x29230402, 0x29240402, 0x29250402, 0x29260402,
+    0x29280402, 0x29290402, 0x292A0402, 0x292B0402, 0x292C0402, 0x292D0402, 0x292E0402, 0x292F0402,
+    0x29310402, 0x29320402, 0x29330402, 0x29340402, 0x29350402, 0x29360402, 0x29370402, 0x29380402,
+    0x29390402, 0x293A0402, 0x293B0402, 0x293C0402, 0x293D0402, 0x293E0402, 0x293F0402, 0x29400402,
+    0x29410402, 0x29420402, 0x29430402, 0x29440402, 0x29450402, 0x294A0402, 0x294B0402, 0x294C0402,
+    0x294D0402, 0x294E0402, 0x294F0402, 0x29500402, 0x29510402, 0x29530402, 0x29540402, 0x29550402,
+    0x29560402, 0x29570402, 0x29580402, 0x29590402, 0x295A0402, 0x29630402, 0x29640402, 0x29650402,
+    0x29660402, 0x29670402, 0x29680402, 0x29690402, 0x296A0402, 0x296C0402, 0x296D0402, 0x296E0402,
+    0x296F0402, 0x29700402, 0x29710402, 0x29720402, 0x29730402, 0x297B0402, 0x297C0402, 0x297D0402,
+    0x297E0402, 0x297F0402, 0x29800402, 0x29810402, 0x29820402, 0x29830402, 0x29840402, 0x29850402,
+    0x29860402, 0x29870402, 0x29880402, 0x29890402, 0x298A0402, 0x298F0402, 0x29900402, 0x29910402,
+    0x29920402, 0x29930402, 0x29940402, 0x29950402, 0x29960402, 0x299C0402, 0x299D0402, 0x299E0402,
+    0x000016A2, 0x00001682, 0x00001662, 0x02D00402, 0x02580402, 0x02830402, 0x02590402, 0x025A0402,
+    0x025B0402, 0x025C0402, 0x02730402, 0x02D10402, 0x1D900402, 0x1D910402, 0x1D920402, 0x1D930402,
+    0x1D940402, 0x1D950402, 0x1D960402, 0x1D970402, 0x1D980402, 0x1D990402, 0x1D9A0402, 0x28330402,
+    0x28340402, 0x28350402, 0x28360402, 0x28820402, 0x28830402, 0x28840402, 0x28850402, 0x298B0402,
+    0x298C0402, 0x298D0402, 0x298E0402, 0x29970402, 0x29980402, 0x29990402, 0x299A0402, 0x04FA0402,
+    0x04FB0402, 0x04FC0402, 0x04FD0402, 0x04FE0402, 0x04FF0402, 0x05000402, 0x05010402, 0x05020402,
+    0x05030402, 0x38DE0408, 0x38DF0408, 0x38E00408, 0x38E10408, 0x38E20408, 0x38E30408, 0x38E40408,
+    0x38E50408, 0x38E60408, 0x38E70408, 0x38E80408, 0x38E90408, 0x38EA0408, 0x38EB0408, 0x38EC0408,
+    0x38ED0408, 0x38EE0408, 0x38EF0408, 0x38F00408, 0x38F10408, 0x38F20408, 0x38F30408, 0x38F40408,
+    0x38F50408, 0x38F60408, 0x38F70408, 0x38F80408, 0x38F90408, 0x38FA0408, 0x38FB0408, 0x38FC0408,
+    0x38FD0408, 0x38FE0408, 0x38FF0408, 0x39000408, 0x39010408, 0x39020408, 0x39030408, 0x39040408,
+    0x39050408, 0x39060408, 0x39070408, 0x39080408, 0x39090408, 0x390A0408, 0x390B0408, 0x390C0408,
+    0x390D0408, 0x390E0408, 0x390F0408, 0x39100408, 0x39110408, 0x39120408, 0x39130408, 0x39140408,
+    0x39150408, 0x39160408, 0x39170408, 0x39180408, 0x39190408, 0x391A0408, 0x391B0408, 0x391C0408,
+    0x391D0408, 0x391E0408, 0x391F0408, 0x39200408, 0x39210408, 0x39220408, 0x39230408, 0x39240408,
+    0x39250408, 0x39260408, 0x39270408, 0x39280408, 0x39290408, 0x392A0408, 0x392B0408, 0x392C0408,
+    0x392D0408, 0x392E0408, 0x392F0408, 0x39300408, 0x39310408, 0x39320408, 0x39330408, 0x392E0402,
+    0x392F0402, 0x39300402, 0x39310402, 0x39320402, 0x39330402, 0x020F0402, 0x39580402, 0x39590402,
+    0x395A0402, 0x395B0402, 0x395C0402, 0x395D0402, 0x395E0402, 0x395F0402, 0x39600402, 0x39610402,
+    0x39620402, 0x39630402, 0x39640402, 0x39650402, 0x39660402, 0x39670402, 0x39680402, 0x39690402,
+    0x396A0402, 0x396B0402, 0x396C0402, 0x396D0402, 0x396E0402, 0x396F0402, 0x39700402, 0x39710402,
+    0x39720402, 0x39730402, 0x39740402, 0x39750402, 0x39760402, 0x39770402, 0x39780402, 0x39790402,
+    0x397A0402, 0x397B0402, 0x397C0402, 0x397D0402, 0x397E0402, 0x397F0402, 0x39800402, 0x39810402,
+    0x39820402, 0x39830402, 0x39840402, 0x39850402, 0x39860402, 0x39870402, 0x39880402, 0x39890402,
+    0x398A0402, 0x398B0402, 0x398C0402, 0x398D0402, 0x398E0402, 0x398F0402, 0x39900402, 0x39910402,
+    0x39920402, 0x39930402, 0x39940402, 0x39950402, 0x39960402, 0x39970402, 0x39980402, 0x39990402,
+    0x399A0402, 0x399B0402, 0x399C0402, 0x399D0402, 0x399E0402, 0x399F0402, 0x39A00402, 0x39A10402,
+    0x39A20402, 0x39A30402, 0x39A40402, 0x39A50402, 0x39A60402, 0x39A70402, 0x39A80402, 0x39A90402,
+    0x39AA0402, 0x39AB0402, 0x39AC0402, 0x39AD0402, 0x39AE0402, 0x39AF0402, 0x39B00402, 0x39B10402,
+    0x39B20402, 0x39B30402, 0x39B40402, 0x39B50402, 0x39B60402, 0x39B70402, 0x39B80402, 0x39B90402,
+    0x39BA0402, 0x39BB0402, 0x39BC0402, 0x39BD0402, 0x39BE0402, 0x39BF0402, 0x39C00402, 0x39C10402,
+    0x39C20402, 0x39C30402, 0x39C40402, 0x39C50402, 0x39C60402, 0x39C70402, 0x39C80402, 0x39C90402,
+    0x39CA0402, 0x39CB0402, 0x39CC0402, 0x39CD0402, 0x39CE0402, 0x39CF0402, 0x39D00402, 0x39D10402,
+    0x39D20402, 0x39D30402, 0x39D40402, 0x39D50402, 0x39D60402, 0x39D70402, 0x39D80402, 0x39D90402,
+    0x39DA0402, 0x39DB0402, 0x39DC0402, 0x39DD0402, 0x39DE0402, 0x39DF0402, 0x39E00402, 0x39E10402,
+    0x39E20402, 0x39E30402, 0x39E40402, 0x39E50402, 0x39E60402, 0x39E70402, 0x39E80402, 0x39E90402,
+    0x39EA0402, 0x39EB0402, 0x39EC0402, 0x39ED0402, 0x39EE0402, 0x39EF0402, 0x39F00402, 0x39F10402,
+    0x39F20402, 0x39F30402, 0x39F40402, 0x39F50402, 0x39F60402, 0x39F70402, 0x39F80402, 0x39F90402,
+    0x39FA0402, 0x39FB0402, 0x39FC0402, 0x39FD0402, 0x39FE0402, 0x39FF0402, 0x3A000402, 0x3A010402,
+    0x3A020402, 0x3A030402, 0x3A040402, 0x3A050402, 0x3A060402, 0x3A070402, 0x3A080402, 0x3A090402,
+    0x3A0A0402, 0x3A0B0402, 0x3A0C0402, 0x3A0D0402, 0x3A0E0402, 0x3A0F0402, 0x3A100402, 0x3A110402,
+    0x3A120402, 0x3A130402, 0x3A140402, 0x3A150402, 0x3A160402, 0x3A170402, 0x3A180402, 0x3A190402,
+    0x3A1A0402, 0x3A1B0402, 0x3A1C0402, 0x3A1D0402, 0x3A1E0402, 0x3A1F0402, 0x3A200402, 0x3A210402,
+    0x3A220402, 0x3A230402, 0x3A240402, 0x3A250402, 0x3A260402, 0x3A270402, 0x3A280402, 0x3A290402,
+    0x3A2A0402, 0x3A2B0402, 0x3A2C0402, 0x3A2D0402, 0x3A2E0402, 0x3A2F0402, 0x3A300402, 0x3A310402,
+    0x3A320402, 0x3A330402, 0x3A340402, 0x3A350402, 0x3A360402, 0x3A370402, 0x3A380402, 0x3A390402,
+    0x3A3A0402, 0x3A3B0402, 0x3A3C0402, 0x3A3D0402, 0x3A3E0402, 0x3A3F0402, 0x3A400402, 0x3A410402,
+    0x3A420402, 0x3A430402, 0x3A440402, 0x3A450402, 0x3A460402, 0x3A470402, 0x3A480402, 0x3A490402,
+    0x3A4A0402, 0x3A4B0402, 0x3A4C0402, 0x3A4D0402, 0x3A4E0402, 0x3A4F0402, 0x3A500402, 0x3A510402,
+    0x3A520402, 0x3A530402, 0x3A540402, 0x3A550402, 0x3A560402, 0x3A570402, 0x3A580402, 0x3A590402,
+    0x3A5A0402, 0x3A5B0402, 0x3A5C0402, 0x3A5D0402, 0x3A5E0402, 0x3A5F0402, 0x3A600402, 0x3A610402,
+    0x3A620402, 0x3A630402, 0x3A640402, 0x3A650402, 0x3A660402, 0x3A670402, 0x3A680402, 0x3A690402,
+    0x3A6A0402, 0x3A6B0402, 0x3A6C0402, 0x3A6D0402, 0x3A6E0402, 0x3A6F0402, 0x3A700402, 0x3A710402,
+    0x3A720402, 0x3A730402, 0x3A740402, 0x3A750402, 0x3A760402, 0x3A770402, 0x3A780402, 0x3A790402,
+    0x3A7A0402, 0x3A7B0402, 0x3A7C0402, 0x3A7D0402, 0x3A7E0402, 0x3A7F0402, 0x3A800402, 0x3A810402,
+    0x3A820402, 0x3A830402, 0x3A840402, 0x3A850402, 0x3A860402, 0x3A870402, 0x3A880402, 0x3A890402,
+    0x3A8A0402, 0x3A8B0402, 0x3A8C0402, 0x3A8D0402, 0x3A8E0402, 0x3A8F0402, 0x3A900402, 0x3A910402,
+    0x3A920402, 0x3A930402, 0x3A940402, 0x3A950402, 0x3A960402, 0x3A970402, 0x3A980402, 0x3A990402,
+    0x3A9A0402, 0x3A9B0402, 0x3A9C0402, 0x3A9D0402, 0x3A9E0402, 0x3A9F0402, 0x3AA00402, 0x3AA10402,
+    0x3AA20402, 0x3AA30402, 0x3AA40402, 0x3AA50402, 0x3AA60402, 0x3AA70402, 0x3AA80402, 0x3AA90402,
+    0x3AAA0402, 0x3AAB0402, 0x3AAC0402, 0x3AAD0402, 0x3AAE0402, 0x3AAF0402, 0x3AB00402, 0x3AB10402,
+    0x3AB20402, 0x3AB30402, 0x3AB40402, 0x3AB50402, 0x3AB60402, 0x3AB70402, 0x3AB80402, 0x3AB90402,
+    0x3ABA0402, 0x3ABB0402, 0x3ABC0402, 0x3ABD0402, 0x3ABE0402, 0x3ABF0402, 0x3AC00402, 0x3AC10402,
+    0x3AC20402, 0x3AC30402, 0x3AC40402, 0x3AC50402, 0x3AC60402, 0x3AC70402, 0x3AC80402, 0x3AC90402,
+    0x3ACA0402, 0x3ACB0402, 0x3ACC0402, 0x3ACD0402, 0x3ACE0402, 0x3ACF0402, 0x3AD00402, 0x3AD10402,
+    0x3AD20402, 0x3B050402, 0x3AD30402, 0x3AD50402, 0x3AD60402, 0x3AD70402, 0x3AD80402, 0x3AD90402,
+    0x3ADA0402, 0x3ADB0402, 0x3ADC0402, 0x3ADD0402, 0x3ADE0402, 0x3ADF0402, 0x3AE00402, 0x3AE10402,
+    0x3AE20402, 0x3AE30402, 0x3AE40402, 0x3AE60402, 0x3AE70402, 0x3AE80402, 0x3AE90402, 0x3AEA0402,
+    0x3AEB0402, 0x3AEC0402, 0x3AED0402, 0x3AF40402, 0x3AF50402, 0x3AF60402, 0x3AF70402, 0x3AF80402,
+    0x3AF90402, 0x3AFA0402, 0x3AFB0402, 0x3AFC0402, 0x3AFD0402, 0x3AFE0402, 0x3AFF0402, 0x3B000402,
+    0x3B010402, 0x3B020402, 0x3B030402, 0x3B040402, 0x3B060402, 0x3B070402, 0x3B080402, 0x3B090402,
+    0x3B0A0402, 0x3B0B0402, 0x3B0C0402, 0x3B0D0402, 0x3B0E0402, 0x3B0F0402, 0x3B100402, 0x3B110402,
+    0x3B120402, 0x3B130402, 0x3B140402, 0x3B150402, 0x3B160402, 0x3B170402, 0x3B180402, 0x3B190402,
+    0x3B1A0402, 0x3B1B0402, 0x3B1C0402, 0x3B1D0402, 0x3B1E0402, 0x3B1F0402, 0x3B200402, 0x3B210402,
+    0x3B220402, 0x3B230402, 0x3B240402, 0x3B250402, 0x3B260402, 0x3B270402, 0x3B280402, 0x3B290402,
+    0x3B2A0402, 0x3B2B0402, 0x3B2C0402, 0x3B2D0402, 0x3B2E0402, 0x3B2F0402, 0x3B300402, 0x3B310402,
+    0x3B320402, 0x3B330402, 0x3B340402, 0x3B350402, 0x3B360402, 0x3B370402, 0x3B380402, 0x3B390402,
+    0x3B3A0402, 0x3B3B0402, 0x3B3C0402, 0x3B3D0402, 0x3B3E0402, 0x3B3F0402, 0x3B400402, 0x3B410402,
+    0x3B420402, 0x3B430402, 0x3B440402, 0x3B450402, 0x3B460402, 0x3B470402, 0x3B480402, 0x3B490402,
+    0x3B4A0402, 0x3B4B0402, 0x3B4C0402, 0x3B4D0402, 0x3B4E0402, 0x3B4F0402, 0x3B500402, 0x3B510402,
+    0x3B520402, 0x3B530402, 0x3B540402, 0x3B550402, 0x3B560402, 0x3B570402, 0x3B580402, 0x3B590402,
+    0x3B5A0402, 0x3B5B0402, 0x3B5C0402, 0x3B5D0402, 0x3B5E0402, 0x3B5F0402, 0x3B600402, 0x3B610402,
+    0x3B620402, 0x3B630402, 0x3B640402, 0x3B650402, 0x3B660402, 0x3B670402, 0x3B680402, 0x3B690402,
+    0x3B6A0402, 0x3B6B0402, 0x3B6C0402, 0x3B6D0402, 0x3B6E0402, 0x3B6F0402, 0x3B700402, 0x3B710402,
+    0x3B720402, 0x3B730402, 0x3B740402, 0x3B750402, 0x3B760402, 0x3B770402, 0x3B780402, 0x3B790402,
+    0x3B7A0402, 0x3B7B0402, 0x3B7C0402, 0x3B7D0402, 0x3B7E0402, 0x3B7F0402, 0x3B800402, 0x3B810402,
+    0x3B820402, 0x3B830402, 0x3B840402, 0x3B850402, 0x3B860402, 0x3B870402, 0x3B880402, 0x3B890402,
+    0x3B8A0402, 0x3B8B0402, 0x3B8C0402, 0x3B8D0402, 0x3B8E0402, 0x3B8F0402, 0x3B900402, 0x3B910402,
+    0x3B920402, 0x3B930402, 0x3B940402, 0x3B950402, 0x3B960402, 0x3B970402, 0x3B980402, 0x3B990402,
+    0x3B9A0402, 0x3B9B0402, 0x3B9C0402, 0x3B9D0402, 0x3B9E0402, 0x3B9F0402, 0x3BA00402, 0x3BA10402,
+    0x3BA20402, 0x3BA30402, 0x3BA40402, 0x3BA50402, 0x3BA60402, 0x3BA70402, 0x3BA80402, 0x3BA90402,
+    0x3BAA0402, 0x3BAB0402, 0x3BAC0402, 0x3BAD0402, 0x3BAE0402, 0x3BAF0402, 0x3BB00402, 0x3BB10402,
+    0x3BB20402, 0x3BB30402, 0x3BB40402, 0x3BB50402, 0x3BB60402, 0x3BB70402, 0x3BB80402, 0x3BB90402,
+    0x3BBA0402, 0x3BBB0402, 0x3BBC0402, 0x3BBD0402, 0x3BBE0402, 0x3BBF0402, 0x3BC00402, 0x3BC10402,
+    0x3BC20402, 0x3BC30402, 0x3BC40402, 0x3BC50402, 0x3BC60402, 0x3BC70402, 0x3BC80402, 0x3BC90402,
+    0x3BCA0402, 0x3BCB0402, 0x05970402, 0x02860402, 0x3AD40402, 0x3AE50402, 0x3AEE0402, 0x3AEF0402,
+    0x3AF00402, 0x3AF10402, 0x3AF20402, 0x3AF30402, 0x3BCC0402, 0x3BCD0402, 0x3BCE0402, 0x3BCF0402,
+    0x3BD00402, 0x3BD10402, 0x3BD20402, 0x3BD30402, 0x3BD40402, 0x02090404, 0x3C1B0402, 0x3C1C0402,
+    0x3C1D0402, 0x3C1E0402, 0x3C1F0402, 0x3C200402, 0x3C210402, 0x3C220402, 0x3C230402, 0x3C240402,
+    0x3C250402, 0x3C260402, 0x3C270402, 0x3C280402, 0x3C290402, 0x3C2A0402, 0x3C2B0402, 0x3C2C0402,
+    0x3C2D0402, 0x3C2E0402, 0x3C2F0402, 0x3C300402, 0x3C310402, 0x3C320402, 0x3C330402, 0x3C340402,
+    0x03320402, 0x03330402, 0x3C350402, 0x3C350404, 0x00002304, 0x3C360402, 0x3C5A0402, 0x3C360404,
+    0x00002304, 0x3C360404, 0x00002324, 0x3C370402, 0x3C370404, 0x00002304, 0x3C380402, 0x3C380404,
+    0x00002304, 0x3C560402, 0x3C580402, 0x3C380404, 0x00002324, 0x3C380404, 0x00002344, 0x3C380404,
+    0x00002364, 0x3C3A0402, 0x3C3B0402, 0x3C3C0402, 0x3C3D0402, 0x3C3D0404, 0x00002304, 0x3C3D0404,
+    0x00002324, 0x3C3D0404, 0x00002344, 0x3C3D0404, 0x00002364, 0x3C3F0402, 0x3C5D0402, 0x3C400402,
+    0x3C410402, 0x3C410404, 0x00002304, 0x3C410404, 0x00002324, 0x3C410404, 0x00002344, 0x3C420402,
+    0x3C420404, 0x00002304, 0x3C420404, 0x00002324, 0x3C430402, 0x3C430404, 0x00002304, 0x3C450402,
+    0x3C450404, 0x00002304, 0x3C460402, 0x3C460404, 0x00002304, 0x3C470402, 0x3C480402, 0x3C490402,
+    0x3C4A0402, 0x3C4A0404, 0x00002304, 0x3C4A0404, 0x00002344, 0x3C4A0404, 0x00002364, 0x3C4A0404,
+    0x00002384, 0x3C4C0402, 0x3C4C0404, 0x00002304, 0x3C4C0404, 0x00002324, 0x3C4D0402, 0x3C4D0404,
+    0x00002304, 0x3C4D0404, 0x00002324, 0x3C480404, 0x00002304, 0x3C4E0402, 0x3C500402, 0x3C500404,
+    0x00002304, 0x3C500404, 0x00002324, 0x3C510402, 0x3C510404, 0x00002304, 0x3C520402, 0x3C520404,
+    0x00002304, 0x3C530402, 0x3C540402, 0x3C5B0402, 0x3C5F0402, 0x3C600402, 0x3C5C0402, 0x3C5E0402,
+    0x3C610402, 0x3C620402, 0x3C620404, 0x00002304, 0x3C620404, 0x00002324, 0x3C400404, 0x00002304,
+    0x3C4A0404, 0x00002324, 0x02630402, 0x02640402, 0x02650402, 0x3C460404, 0x3C510404, 0x3C500404,
+    0x00002304, 0x3C500404, 0x00002304, 0x3C370404, 0x3C370404, 0x3C3E0402, 0x3C4B0402, 0x3C550402,
+    0x3C390402, 0x3C440402, 0x3C4F0402, 0x3C570402, 0x3C590402, 0x34860402, 0x34870402, 0x34880402,
+    0x34890402, 0x348A0402, 0x348B0402, 0x348C0402, 0x348D0402, 0x348E0402, 0x348F0402, 0x34900402,
+    0x34910402, 0x34920402, 0x34930402, 0x34940402, 0x34950402, 0x34960402, 0x34970402, 0x34980402,
+    0x34990402, 0x349A0402, 0x349B0402, 0x349C0402, 0x349D0402, 0x349E0402, 0x349F0402, 0x34A00402,
+    0x34A10402, 0x34A20402, 0x34A30402, 0x34A40402, 0x34A50402, 0x34A60402, 0x34A70402, 0x34A80402,
+    0x34A90402, 0x34AA0402, 0x34AB0402, 0x34AC0402, 0x34AD0402, 0x34AE0402, 0x029E0402, 0x029F0402,
+    0x34AF0402, 0x34B00402, 0x34B10402, 0x34B20402, 0x34B30402, 0x34B40402, 0x34B50402, 0x34B60402,
+    0x34B70402, 0x34B80402, 0x34B90402, 0x34BA0402, 0x34BB0402, 0x34BC0402, 0x34BD0402, 0x34BE0402,
+    0x34BF0402, 0x34C00402, 0x34C10402, 0x34C20402, 0x34C30402, 0x34C40402, 0x34C50402, 0x34C60402,
+    0x34C70402, 0x34C80402, 0x34C90402, 0x34CA0402, 0x34CB0402, 0x34CC0402, 0x34CD0402, 0x34CE0402,
+    0x34CF0402, 0x34D00402, 0x34D10402, 0x34D20402, 0x34D30402, 0x34D40402, 0x36750402, 0x36760402,
+    0x36770402, 0x36780402, 0x36790402, 0x367A0402, 0x367B0402, 0x367C0402, 0x367D0402, 0x367E0402,
+    0x367F0402, 0x36800402, 0x36810402, 0x36820402, 0x36830402, 0x36840402, 0x36850402, 0x36860402,
+    0x36870402, 0x36880402, 0x36890402, 0x368A0402, 0x368B0402, 0x368C0402, 0x368D0402, 0x368E0402,
+    0x368F0402, 0x36900402, 0x36910402, 0x36920402, 0x36930402, 0x36940402, 0x36950402, 0x36960402,
+    0x36970402, 0x36990402, 0x369A0402, 0x369B0402, 0x369C0402, 0x369D0402, 0x369E0402, 0x369F0402,
+    0x36A00402, 0x36A10402, 0x36A20402, 0x36A30402, 0x36A40402, 0x36A50402, 0x36A60402, 0x36A70402,
+    0x36A80402, 0x36A90402, 0x36AA0402, 0x36AB0402, 0x36AC0402, 0x36AD0402, 0x36AE0402, 0x36AF0402,
+    0x36B00402, 0x36B10402, 0x36B20402, 0x36B30402, 0x36B40402, 0x36B50402, 0x36B60402, 0x36B70402,
+    0x36B80402, 0x36B90402, 0x00001D02, 0x00001D22, 0x00001D42, 0x36BA0402, 0x02A30402, 0x02A40402,
+    0x02600402, 0x1F4B0402, 0x043F0402, 0x04400402, 0x04410402, 0x1F760402, 0x36980402, 0x03F20402,
+    0x027F0402, 0x02300402, 0x02840402, 0x025D0402, 0x025E0402, 0x02110402, 0x02120402, 0x02310402,
+    0x02850402, 0x383E0402, 0x38400402, 0x38430402, 0x38490402, 0x384B0402, 0x384E0402, 0x38500402,
+    0x38530402, 0x38540402, 0x38550402, 0x385A0402, 0x385C0402, 0x385F0402, 0x38610402, 0x38660402,
+    0x38680402, 0x38690402, 0x386A0402, 0x38710402, 0x38740402, 0x38770402, 0x387D0402, 0x38810402,
+    0x38840402, 0x38860402, 0x38880402, 0x388B0402, 0x38900402, 0x38910402, 0x38940402, 0x38980402,
+    0x389B0402, 0x389C0402, 0x389D0402, 0x389E0402, 0x383D0402, 0x38410402, 0x38440402, 0x384A0402,
+    0x384C0402, 0x384F0402, 0x38510402, 0x38560402, 0x385B0402, 0x385D0402, 0x38600402, 0x38620402,
+    0x38670402, 0x38720402, 0x38750402, 0x38780402, 0x387E0402, 0x38920402, 0x38820402, 0x38870402,
+    0x388C0402, 0x38960402, 0x38990402, 0x389F0402, 0x38A00402, 0x387B0402, 0x38420402, 0x38450402,
+    0x38480402, 0x38520402, 0x384D0402, 0x38570402, 0x388D0402, 0x38630402, 0x38650402, 0x385E0402,
+    0x386B0402, 0x38730402, 0x38760402, 0x387F0402, 0x38890402, 0x38970402, 0x389A0402, 0x38930402,
+    0x38950402, 0x38A10402, 0x38790402, 0x38830402, 0x38460402, 0x388E0402, 0x38850402, 0x388A0402,
+    0x38800402, 0x387A0402, 0x38360402, 0x38370402, 0x38380402, 0x38390402, 0x383A0402, 0x383B0402,
+    0x383C0402, 0x383F0402, 0x38470402, 0x388F0402, 0x38580402, 0x387C0402, 0x38A20402, 0x38A40402,
+    0x38A50402, 0x38A70402, 0x38A80402, 0x38AB0402, 0x38AD0402, 0x38AE0402, 0x38B00402, 0x38B20402,
+    0x38B40402, 0x38B50402, 0x38A90402, 0x38B30402, 0x38640402, 0x38590402, 0x386C0402, 0x386D0402,
+    0x38A30402, 0x38A60402, 0x38AA0402, 0x38AC0402, 0x386E0402, 0x38B10402, 0x386F0402, 0x38700402,
+    0x38B60402, 0x38B70402, 0x38AF0402, 0x38B90402, 0x38B80402, 0x3BD50402, 0x3BD60402, 0x3BD70402,
+    0x3BD80402, 0x3BD90402, 0x3BDA0402, 0x3BDB0402, 0x3BDC0402, 0x3BDD0402, 0x3BDE0402, 0x3BDF0402,
+    0x3BE00402, 0x3BE10402, 0x3BE20402, 0x3BE30402, 0x3BE40402, 0x3BE50402, 0x3BE60402, 0x3BE70402,
+    0x3BE80402, 0x3BE90402, 0x3BEA0402, 0x3BEB0402, 0x3BEC0402, 0x3BED0402, 0x3BEE0402, 0x3BEF0402,
+    0x3BF00402, 0x3BF10402, 0x3BF20402, 0x3BF30402, 0x3BF40402, 0x3BF50402, 0x3BF60402, 0x3BF70402,
+    0x3BF80402, 0x3BF90402, 0x3BFA0402, 0x3BFB0402, 0x3BFC0402, 0x3BFD0402, 0x3BFE0402, 0x3BFF0402,
+    0x3C000402, 0x3C010402, 0x3C020402, 0x3C030402, 0x3C040402, 0x3C050402, 0x3C060402, 0x3C070402,
+    0x3C080402, 0x3C090402, 0x3C0A0402, 0x3C0B0402, 0x3C0C0402, 0x3C0D0402, 0x3C0E0402, 0x3C0F0402,
+    0x3C100402, 0x3C110402, 0x3C120402, 0x3C130402, 0x3C140402, 0x3C150402, 0x3C160402, 0x3C170402,
+    0x3C180402, 0x3C190402, 0x3C1A0402, 0x34540402, 0x34550402, 0x34560402, 0x34570402, 0x34580402,
+    0x34590402, 0x345A0402, 0x345B0402, 0x345C0402, 0x345D0402, 0x345E0402, 0x345F0402, 0x34600402,
+    0x34610402, 0x34620402, 0x34630402, 0x34640402, 0x34650402, 0x34660402, 0x34670402, 0x34680402,
+    0x34690402, 0x346A0402, 0x346B0402, 0x346C0402, 0x346D0402, 0x346E0402, 0x346F0402, 0x34700402,
+    0x345C0404, 0x347A0404, 0x345F0404, 0x347B0404, 0x34710402, 0x34720402, 0x34730402, 0x34740402,
+    0x34750402, 0x34760402, 0x34770402, 0x34780402, 0x34790402, 0x347A0402, 0x347B0402, 0x347C0402,
+    0x347D0402, 0x347E0402, 0x347F0402, 0x34800402, 0x34810402, 0x34820402, 0x34830402, 0x34840402,
+    0x34850402, 0x00001E62, 0x00001E82, 0x00001EA2, 0x05980402, 0x026B0402, 0x02740402, 0x36BB0402,
+    0x36BC0402, 0x36BD0402, 0x36BE0402, 0x36BF0402, 0x36C00402, 0x36C10402, 0x36C20402, 0x36C30402,
+    0x36C40402, 0x36C50402, 0x36C60402, 0x36C70402, 0x36C80402, 0x36C90402, 0x36CA0402, 0x36CB0402,
+    0x36CC0402, 0x36CD0402, 0x36CE0402, 0x36CF0402, 0x36D00402, 0x36D10402, 0x36D20402, 0x36D30402,
+    0x36D40402, 0x36D50402, 0x36D60402, 0x36D70402, 0x36D80402, 0x36D90402, 0x36DA0402, 0x36DB0402,
+    0x36DC0402, 0x36DD0402, 0x36DE0402, 0x36DF0402, 0x36E00402, 0x36E10402, 0x36E20402, 0x36E30402,
+    0x36E40402, 0x36E50402, 0x36E60402, 0x36E70402, 0x36E80402, 0x36E90402, 0x36EA0402, 0x36EB0402,
+    0x36EC0402, 0x36ED0402, 0x36EE0402, 0x36EF0402, 0x36F00402, 0x36F10402, 0x36F20402, 0x36F30402,
+    0x36F40402, 0x36F50402, 0x36F60402, 0x36F70402, 0x36F80402, 0x36F90402, 0x36FA0402, 0x36FB0402,
+    0x36FC0402, 0x36FD0402, 0x36FE0402, 0x36FF0402, 0x37000402, 0x37010402, 0x37020402, 0x37030402,
+    0x37040402, 0x37050402, 0x37060402, 0x37070402, 0x37080402, 0x37090402, 0x370A0402, 0x370B0402,
+    0x370C0402, 0x370D0402, 0x370E0402, 0x370F0402, 0x37100402, 0x37110402, 0x37120402, 0x37130402,
+    0x37140402, 0x37150402, 0x37160402, 0x37170402, 0x37180402, 0x37190402, 0x371A0402, 0x371B0402,
+    0x371C0402, 0x371D0402, 0x371E0402, 0x371F0402, 0x37200402, 0x37210402, 0x37220402, 0x37230402,
+    0x36FA0404, 0x37100404, 0x36FA0404, 0x37100404, 0x371B0404, 0x059F0402, 0x05A00402, 0x05A10402,
+    0x05A20402, 0x05A30402, 0x05A40402, 0x05A50402, 0x05A60402, 0x05A70402, 0x05A80402, 0x05A90402,
+    0x05AA0402, 0x05AB0402, 0x05AC0402, 0x05AD0402, 0x05AE0402, 0x05AF0402, 0x05B00402, 0x05B10402,
+    0x05B20402, 0x05B30402, 0x05B40402, 0x05B50402, 0x05B60402, 0x05B70402, 0x05B80402, 0x05B90402,
+    0x05BA0402, 0x05BB0402, 0x05BC0402, 0x05BD0402, 0x05BE0402, 0x34D50402, 0x34D60402, 0x34D70402,
+    0x34D80402, 0x34D90402, 0x34DA0402, 0x34DB0402, 0x34DC0402, 0x34DD0402, 0x34DE0402, 0x34DF0402,
+    0x34E00402, 0x34E10402, 0x34E20402, 0x34E30402, 0x34E40402, 0x34E50402, 0x34E60402, 0x34E70402,
+    0x34E80402, 0x34E90402, 0x34EA0402, 0x34EB0402, 0x34EC0402, 0x34ED0402, 0x34EE0402, 0x34EF0402,
+    0x34F00402, 0x02D20402, 0x02D30402, 0x37240402, 0x37250402, 0x37260402, 0x37270402, 0x37280402,
+    0x37290402, 0x372A0402, 0x372B0402, 0x372C0402, 0x372D0402, 0x372E0402, 0x372F0402, 0x37300402,
+    0x37310402, 0x37320402, 0x37330402, 0x37340402, 0x37350402, 0x37360402, 0x37370402, 0x37380402,
+    0x37390402, 0x373A0402, 0x373B0402, 0x373C0402, 0x373D0402, 0x373E0402, 0x373F0402, 0x37400402,
+    0x37410402, 0x37420402, 0x37430402, 0x37440402, 0x37450402, 0x37460402, 0x37470402, 0x37480402,
+    0x37490402, 0x374A0402, 0x374B0402, 0x374C0402, 0x374D0402, 0x374E0402, 0x374F0402, 0x37500402,
+    0x37590402, 0x375A0402, 0x375B0402, 0x375C0402, 0x375D0402, 0x375E0402, 0x37510402, 0x374A0404,
+    0x37700404, 0x374A0404, 0x37530402, 0x37540402, 0x37550402, 0x372A0404, 0x373F0404, 0x37560402,
+    0x37570402, 0x37580402, 0x37700402, 0x375F0402, 0x37610402, 0x37620402, 0x37620404, 0x37630402,
+    0x37640402, 0x37650402, 0x37660402, 0x37670402, 0x37680402, 0x37520402, 0x37600402, 0x376F0402,
+    0x37690402, 0x376A0402, 0x376C0402, 0x376D0402, 0x376E0402, 0x376B0402, 0x00001D62, 0x00001D82,
+    0x00001DA2, 0x00001DC2, 0x00001DE2, 0x00001E02, 0x00001E22, 0x00001E42, 0x04420402, 0x04430402,
+    0x04440402, 0x04450402, 0x04460402, 0x04470402, 0x04480402, 0x1F4C0402, 0x02A50402, 0x02A60402,
+    0x02A70402, 0x02A80402, 0x04490402, 0x044A0402, 0x000006C2, 0x22590404, 0x22600404, 0x00001922,
+    0x37B60402, 0x37B70402, 0x37B80402, 0x37B90402, 0x37BA0402, 0x37BB0402, 0x37BC0402, 0x37BD0402,
+    0x37BE0402, 0x37BF0402, 0x37C00402, 0x37C10402, 0x37C20402, 0x37C30402, 0x37C40402, 0x37C70402,
+    0x37C80402, 0x37C90402, 0x37CA0402, 0x37CB0402, 0x37CC0402, 0x37CD0402, 0x37CE0402, 0x37CF0402,
+    0x37D00402, 0x37D10402, 0x37D20402, 0x37D30402, 0x37D40402, 0x37D50402, 0x37D70402, 0x37D80402,
+    0x37D90402, 0x37DA0402, 0x37DB0402, 0x37DD0402, 0x37DE0402, 0x37DF0402, 0x37E00402, 0x37E10402,
+    0x37E20402, 0x37E30402, 0x37E40402, 0x37E60402, 0x37E70402, 0x37E80402, 0x37EB0402, 0x37EC0402,
+    0x37ED0402, 0x37EE0402, 0x37EF0402, 0x37F00402, 0x37F10402, 0x37F20402, 0x37F30402, 0x37F40402,
+    0x37F50402, 0x37F60402, 0x37F70402, 0x37F80402, 0x37F90402, 0x37FA0402, 0x37FB0402, 0x37C50402,
+    0x37C60402, 0x37D60402, 0x37DC0402, 0x37E50402, 0x37E90402, 0x37EA0402, 0x02D40402, 0x02D50402,
+    0x02870402, 0x02610402, 0x02A90402, 0x02AA0402, 0x02100402, 0x05BF0402, 0x05C00402, 0x05C10402,
+    0x05C20402, 0x05C30402, 0x05C40402, 0x05C50402, 0x05C60402, 0x05C70402, 0x05C80402, 0x05C90402,
+    0x05CA0402, 0x05CB0402, 0x05CC0402, 0x05CD0402, 0x05CE0402, 0x05CF0402, 0x05D00402, 0x05D10402,
+    0x00001962, 0x313A0402, 0x313B0402, 0x313C0402, 0x313D0402, 0x313E0402, 0x313F0402, 0x31400402,
+    0x31410402, 0x31430402, 0x31440402, 0x31450402, 0x31460402, 0x31470402, 0x31480402, 0x31490402,
+    0x314A0402, 0x314B0402, 0x314C0402, 0x314D0402, 0x314E0402, 0x314F0402, 0x31500402, 0x31520402,
+    0x31540402, 0x31560402, 0x31590402, 0x315C0402, 0x315E0402, 0x315F0402, 0x31610402, 0x31550402,
+    0x31570402, 0x315A0402, 0x31620402, 0x31630402, 0x31640402, 0x31650402, 0x31660402, 0x31670402,
+    0x31680402, 0x31690402, 0x31530402, 0x315D0402, 0x31420402, 0x31600402, 0x313A0404, 0x31580402,
+    0x315B0402, 0x31510402, 0x31410419, 0x31520419, 0x35080402, 0x35080404, 0x35090402, 0x35090404,
+    0x350A0402, 0x350A0404, 0x350B0402, 0x350B0404, 0x350C0402, 0x350C0404, 0x350D0402, 0x350D0404,
+    0x350E0402, 0x350E0404, 0x350F0402, 0x35100402, 0x35110402, 0x35110404, 0x35120402, 0x35120404,
+    0x35130402, 0x35130404, 0x35140402, 0x35140404, 0x35150402, 0x35150404, 0x35160402, 0x35170402,
+    0x35170404, 0x35180402, 0x35190402, 0x351A0402, 0x351B0402, 0x351C0402, 0x351D0402, 0x351E0402,
+    0x351E0404, 0x351F0402, 0x35200402, 0x35200404, 0x35210402, 0x35210404, 0x35220402, 0x35220404,
+    0x35230402, 0x35240402, 0x35250402, 0x35260402, 0x04560402, 0x04570402, 0x04580402, 0x04590402,
+    0x33E60402, 0x33E70402, 0x33E80402, 0x33E90402, 0x33EA0402, 0x33EB0402, 0x33EC0402, 0x33ED0402,
+    0x33EE0402, 0x33EF0402, 0x33F30402, 0x33F40402, 0x33F50402, 0x33F60402, 0x33F70402, 0x33F80402,
+    0x33F90402, 0x33FA0402, 0x33FB0402, 0x33FC0402, 0x33FD0402, 0x33FE0402, 0x33FF0402, 0x34000402,
+    0x34010402, 0x34020402, 0x34030402, 0x34050402, 0x34070402, 0x34080402, 0x34090402, 0x340A0402,
+    0x340B0402, 0x340C0402, 0x340D0402, 0x340E0402, 0x34040402, 0x34060402, 0x34100402, 0x34110402,
+    0x34120402, 0x34130402, 0x34140402, 0x34150402, 0x34160402, 0x34170402, 0x34180402, 0x34190402,
+    0x341A0402, 0x341B0402, 0x341C0402, 0x341D0402, 0x341E0402, 0x341F0402, 0x340F0402, 0x029A0402,
+    0x029B0402, 0x04380402, 0x04390402, 0x043A0402, 0x33F00402, 0x33F10402, 0x33F20402, 0x38BA0402,
+    0x38BB0402, 0x38BC0402, 0x38BD0402, 0x38BE0402, 0x38BF0402, 0x38C00402, 0x38C10402, 0x38C20402,
+    0x38C30402, 0x38C40402, 0x38C50402, 0x38C60402, 0x38C70402, 0x38C80402, 0x38C90402, 0x38CA0402,
+    0x38CB0402, 0x38CC0402, 0x38CD0402, 0x38CE0402, 0x38CF0402, 0x38D00402, 0x38D10402, 0x38D20402,
+    0x38D30402, 0x38D40402, 0x38D50402, 0x38D60402, 0x38D70402, 0x38D80402, 0x38D90402, 0x38DA0402,
+    0x38DB0402, 0x38DC0402, 0x38DD0402, 0x02CB0402, 0x02CC0402, 0x23970404, 0x23AF0404, 0x244C0404,
+    0x246A0404, 0x24730404, 0x24F40404, 0x25050404, 0x248E0404, 0x259F0408, 0x25A10408, 0x25A30408,
+    0x25A50408, 0x25A70408, 0x25A90408, 0x25AB0408, 0x25AF0408, 0x25B10408, 0x25B30408, 0x25B50408,
+    0x25B70408, 0x25B90408, 0x25BD0408, 0x25BF0408, 0x25C10408, 0x25C30408, 0x25C50408, 0x25C70408,
+    0x25CB0408, 0x25CD0408, 0x25CF0408, 0x25D10408, 0x25D30408, 0x25D50408, 0x25D70408, 0x25D90408,
+    0x25DB0408, 0x25DD0408, 0x25DF0408, 0x25E10408, 0x25E50408, 0x25E70408, 0x25AD0408, 0x25BB0408,
+    0x25C90408, 0x25E30408, 0x25E90408, 0x25EB0408, 0x25EC0408, 0x25EE0408, 0x25EF0408, 0x25F00408,
+    0x25F10408, 0x25F30408, 0x25F40408, 0x044B0402, 0x044C0402, 0x044D0402, 0x044E0402, 0x044F0402,
+    0x04500402, 0x04510402, 0x04520402, 0x2A1E0402, 0x2A1E0404, 0x2A1F0402, 0x2A200402, 0x1FA60402,
+    0x1FAA0402, 0x1FAB0402, 0x1FC90402, 0x1FDA0402, 0x1FEF0402, 0x1FF00402, 0x200B0402, 0x20310402,
+    0x209E0402, 0x20B30402, 0x20C80402, 0x20DF0402, 0x210D0402, 0x21210402, 0x21400402, 0x21530402,
+    0x21410402, 0x21540402, 0x214D0402, 0x21470402, 0x216A0402, 0x21590402, 0x215A0402, 0x216F0402,
+    0x219E0402, 0x21A80402, 0x21FB0402, 0x221B0402, 0x221D0402, 0x221E0402, 0x223D0402, 0x224B0402,
+    0x225D0402, 0x228A0402, 0x22A70402, 0x22EF0402, 0x22F00402, 0x23210402, 0x232F0402, 0x23350402,
+    0x233A0402, 0x23450402, 0x24190402, 0x1FA2041D, 0x1FA20414, 0x00002314, 0x20070414, 0x1FBC041D,
+    0x1FC80402, 0x1FEB041D, 0x2007041D, 0x2015041D, 0x2051041D, 0x2075041D, 0x2090041D, 0x20AB041D,
+    0x20C4041D, 0x20D6041D, 0x2109041D, 0x2118041D, 0x21200402, 0x213C041D, 0x2166041D, 0x216B041D,
+    0x2193041D, 0x21F7041D, 0x2217041D, 0x2259041D, 0x1FAD0414, 0x1FB10414, 0x1FAB0414, 0x1FBC0414,
+    0x1FEB0414, 0x20070414, 0x201A0414, 0x201F0414, 0x20310414, 0x20510414, 0x209E0414, 0x20C40414,
+    0x21090414, 0x21370414, 0x214F0414, 0x21590414, 0x215A0414, 0x216B0414, 0x21F70414, 0x22170414,
+    0x221D0414, 0x22380414, 0x22470414, 0x22F00414, 0x231F0414, 0x23200414, 0x23220414, 0x23420414,
+    0x23430414, 0x20900415, 0x21930415, 0x22170415, 0x22470415, 0x231F0415, 0x23200415, 0x23390415,
+    0x23420415, 0x23430415, 0x221F0402, 0x1FCA0402, 0x1FF20402, 0x20490402, 0x210E0402, 0x21220402,
+    0x21720402, 0x21A30402, 0x21C00402, 0x21D80402, 0x22010402, 0x228F0402, 0x206B0402, 0x24310414,
+    0x20510404, 0x00002324, 0x21F70404, 0x00002304, 0x20750404, 0x20A30402, 0x20AA0402, 0x21700402,
+    0x22280402, 0x22460402, 0x1FCC0402, 0x1FF30402, 0x204A0402, 0x20620402, 0x20C90402, 0x20F10402,
+    0x210F0402, 0x212C0402, 0x21730402, 0x21AD0402, 0x21D90402, 0x21E90402, 0x224D0402, 0x22680402,
+    0x22900402, 0x1FA80402, 0x1FB60402, 0x1FFC0402, 0x20120402, 0x20230402, 0x20300402, 0x201E0402,
+    0x20A40402, 0x21560402, 0x21F20402, 0x22290402, 0x22AC0402, 0x1FB70414, 0x1FD60414, 0x1FE50414,
+    0x1FEB0414, 0x00002314, 0x202C0414, 0x20420414, 0x20BC0414, 0x20550414, 0x222C0414, 0x209F0414,
+    0x20A60414, 0x20980414, 0x20A30414, 0x20B80414, 0x20F20414, 0x20F10414, 0x20DA0414, 0x21100414,
+    0x223E0414, 0x21230414, 0x212D0414, 0x211C0414, 0x215C0414, 0x217B0414, 0x21DA0414, 0x21E40414,
+    0x22020414, 0x22220414, 0x22420414, 0x221B0414, 0x224E0414, 0x22550414, 0x22860414, 0x22950414,
+    0x22990414, 0x22A30414, 0x232A0414, 0x22C50404, 0x1FA20404, 0x00002304, 0x1FA20404, 0x213C0404,
+    0x1FA20404, 0x22470404, 0x1FD60404, 0x00000604, 0x1FEB0404, 0x00002324, 0x20510404, 0x205A0404,
+    0x20C40404, 0x20D60404, 0x20DA0404, 0x210D0404, 0x21180404, 0x211C0404, 0x21980404, 0x219D0404,
+    0x21D20404, 0x22860404, 0x1FB10404, 0x1FBC0404, 0x1FD50404, 0x201A0404, 0x20420404, 0x20EA0404,
+    0x213C0404, 0x00000684, 0x216B0404, 0x21E40404, 0x22170404, 0x00000684, 0x1FA20404, 0x00000564,
+    0x213C0404, 0x00000564, 0x22170404, 0x00000564, 0x1FA20408, 0x00000882, 0x1FA20402, 0x00000882,
+    0x1FBC0408, 0x000005C2, 0x1FBC0402, 0x000005C2, 0x1FBC0408, 0x00000842, 0x1FBC0402, 0x00000842,
+    0x1FBC0408, 0x00000922, 0x1FBC0402, 0x00000922, 0x1FD60408, 0x00000602, 0x00000482, 0x1FD60402,
+    0x00000602, 0x00000482, 0x1FEB0408, 0x000005C2, 0x1FEB0402, 0x000005C2, 0x1FEB0408, 0x00000842,
+    0x1FEB0402, 0x00000842, 0x1FEB0408, 0x00000922, 0x1FEB0402, 0x00000922, 0x1FEB0408, 0x00000602,
+    0x1FEB0402, 0x00000602, 0x1FEB0408, 0x000008C2, 0x1FEB0402, 0x000008C2, 0x20070408, 0x00000642,
+    0x000004A2, 0x20070402, 0x00000642, 0x000004A2, 0x20070408, 0x00000642, 0x00000482, 0x20070402,
+    0x00000642, 0x00000482, 0x20070408, 0x000008C2, 0x20070402, 0x000008C2, 0x20070408, 0x00000902,
+    0x20070402, 0x00000902, 0x20070408, 0x00000602, 0x000004C2, 0x20070402, 0x00000602, 0x000004C2,
+    0x20420408, 0x000005C2, 0x20420402, 0x000005C2, 0x20510408, 0x00000642, 0x20510402, 0x00000642,
+    0x20750408, 0x000005C2, 0x20750402, 0x000005C2, 0x20750408, 0x00000842, 0x20750402, 0x00000842,
+    0x20750408, 0x00000562, 0x20750402, 0x00000562, 0x20750408, 0x00000602, 0x20750402, 0x00000602,
+    0x20750408, 0x000008E2, 0x20750402, 0x000008E2, 0x20900408, 0x00000902, 0x20900402, 0x00000902,
+    0x20900408, 0x00000562, 0x00000482, 0x20900402, 0x00000562, 0x00000482, 0x20C40408, 0x00000482,
+    0x20C40402, 0x00000482, 0x20C40408, 0x00000842, 0x20C40402, 0x00000842, 0x20C40408, 0x00000922,
+    0x20C40402, 0x00000922, 0x20D60408, 0x00000842, 0x20D60402, 0x00000842, 0x20D60408, 0x00000842,
+    0x00000642, 0x20D60402, 0x00000842, 0x00000642, 0x20D60408, 0x00000922, 0x20D60402, 0x00000922,
+    0x20D60408, 0x000008C2, 0x20D60402, 0x000008C2, 0x21090408, 0x00000482, 0x21090402, 0x00000482,
+    0x21090408, 0x000005C2, 0x21090402, 0x000005C2, 0x21090408, 0x00000842, 0x21090402, 0x00000842,
+    0x21180408, 0x000005C2, 0x21180402, 0x000005C2, 0x21180408, 0x00000842, 0x21180402, 0x00000842,
+    0x21180408, 0x00000922, 0x21180402, 0x00000922, 0x21180408, 0x000008C2, 0x21180402, 0x000008C2,
+    0x213C0408, 0x000005A2, 0x00000482, 0x213C0402, 0x000005A2, 0x00000482, 0x213C0408, 0x000005A2,
+    0x00000562, 0x213C0402, 0x000005A2, 0x00000562, 0x213C0408, 0x00000642, 0x000004A2, 0x213C0402,
+    0x00000642, 0x000004A2, 0x213C0408, 0x00000642, 0x00000482, 0x213C0402, 0x00000642, 0x00000482,
+    0x216B0408, 0x00000482, 0x216B0402, 0x00000482, 0x216B0408, 0x000005C2, 0x216B0402, 0x000005C2,
+    0x21930408, 0x000005C2, 0x21930402, 0x000005C2, 0x21930408, 0x00000842, 0x21930402, 0x00000842,
+    0x21930408, 0x00000842, 0x00000642, 0x21930402, 0x00000842, 0x00000642, 0x21930408, 0x00000922,
+    0x21930402, 0x00000922, 0x21D20408, 0x000005C2, 0x21D20402, 0x000005C2, 0x21D20408, 0x00000842,
+    0x21D20402, 0x00000842, 0x21D20408, 0x00000482, 0x000005C2, 0x21D20402, 0x00000482, 0x000005C2,
+    0x21D20408, 0x00000502, 0x000005C2, 0x21D20402, 0x00000502, 0x000005C2, 0x21D20408, 0x00000842,
+    0x000005C2, 0x21D20402, 0x00000842, 0x000005C2, 0x21F70408, 0x000005C2, 0x21F70402, 0x000005C2,
+    0x21F70408, 0x00000842, 0x21F70402, 0x00000842, 0x21F70408, 0x00000922, 0x21F70402, 0x00000922,
+    0x21F70408, 0x000008C2, 0x21F70402, 0x000008C2, 0x22170408, 0x00000862, 0x22170402, 0x00000862,
+    0x22170408, 0x00000902, 0x22170402, 0x00000902, 0x22170408, 0x000008C2, 0x22170402, 0x000008C2,
+    0x22170408, 0x000005A2, 0x00000482, 0x22170402, 0x000005A2, 0x00000482, 0x22170408, 0x00000642,
+    0x00000562, 0x22170402, 0x00000642, 0x00000562, 0x22470408, 0x000005A2, 0x22470402, 0x000005A2,
+    0x22470408, 0x00000842, 0x22470402, 0x00000842, 0x22590408, 0x000004A2, 0x22590402, 0x000004A2,
+    0x22590408, 0x00000482, 0x22590402, 0x00000482, 0x22590408, 0x00000562, 0x22590402, 0x00000562,
+    0x22590408, 0x000005C2, 0x22590402, 0x000005C2, 0x22590408, 0x00000842, 0x22590402, 0x00000842,
+    0x22640408, 0x000005C2, 0x22640402, 0x000005C2, 0x22640408, 0x00000562, 0x22640402, 0x00000562,
+    0x22700408, 0x000005C2, 0x22700402, 0x000005C2, 0x22860408, 0x000004E2, 0x22860402, 0x000004E2,
+    0x22860408, 0x00000842, 0x22860402, 0x00000842, 0x22860408, 0x00000922, 0x22860402, 0x00000922,
+    0x20750402, 0x00000922, 0x21F70402, 0x00000562, 0x22590402, 0x00000522, 0x22700402, 0x00000522,
+    0x1FA20404, 0x22E50404, 0x21D20404, 0x00002324, 0x000005C2, 0x21E20402, 0x21E30402, 0x21D2040A,
+    0x00002304, 0x21D2040A, 0x20060402, 0x1FA20408, 0x00000842, 0x1FA20402, 0x00000842, 0x1FA20408,
+    0x00000762, 0x1FA20402, 0x00000762, 0x1FA20408, 0x000004E2, 0x00000482, 0x1FA20402, 0x000004E2,
+    0x00000482, 0x1FA20408, 0x000004E2, 0x000004A2, 0x1FA20402, 0x000004E2, 0x000004A2, 0x1FA20408,
+    0x000004E2, 0x00000762, 0x1FA20402, 0x000004E2, 0x00000762, 0x1FA20408, 0x000004E2, 0x000005A2,
+    0x1FA20402, 0x000004E2, 0x000005A2, 0x1FA20408, 0x00000842, 0x000004E2, 0x1FA20402, 0x00000842,
+    0x000004E2, 0x1FA20408, 0x000004C2, 0x00000482, 0x1FA20402, 0x000004C2, 0x00000482, 0x1FA20408,
+    0x000004C2, 0x000004A2, 0x1FA20402, 0x000004C2, 0x000004A2, 0x1FA20408, 0x000004C2, 0x00000762,
+    0x1FA20402, 0x000004C2, 0x00000762, 0x1FA20408, 0x000004C2, 0x000005A2, 0x1FA20402, 0x000004C2,
+    0x000005A2, 0x1FA20408, 0x00000842, 0x000004C2, 0x1FA20402, 0x00000842, 0x000004C2, 0x20070408,
+    0x00000842, 0x20070402, 0x00000842, 0x20070408, 0x00000762, 0x20070402, 0x00000762, 0x20070408,
+    0x000005A2, 0x20070402, 0x000005A2, 0x20070408, 0x000004E2, 0x00000482, 0x20070402, 0x000004E2,
+    0x00000482, 0x20070408, 0x000004E2, 0x000004A2, 0x20070402, 0x000004E2, 0x000004A2, 0x20070408,
+    0x000004E2, 0x00000762, 0x20070402, 0x000004E2, 0x00000762, 0x20070408, 0x000004E2, 0x000005A2,
+    0x20070402, 0x000004E2, 0x000005A2, 0x20070408, 0x00000842, 0x000004E2, 0x20070402, 0x00000842,
+    0x000004E2, 0x20900408, 0x00000762, 0x20900402, 0x00000762, 0x20900408, 0x00000842, 0x20900402,
+    0x00000842, 0x213C0408, 0x00000842, 0x213C0402, 0x00000842, 0x213C0408, 0x00000762, 0x213C0402,
+    0x00000762, 0x213C0408, 0x000004E2, 0x00000482, 0x213C0402, 0x000004E2, 0x00000482, 0x213C0408,
+    0x000004E2, 0x000004A2, 0x213C0402, 0x000004E2, 0x000004A2, 0x213C0408, 0x000004E2, 0x00000762,
+    0x213C0402, 0x000004E2, 0x00000762, 0x213C0408, 0x000004E2, 0x000005A2, 0x213C0402, 0x000004E2,
+    0x000005A2, 0x213C0408, 0x00000842, 0x000004E2, 0x213C0402, 0x00000842, 0x000004E2, 0x213C0408,
+    0x000007E2, 0x00000482, 0x213C0402, 0x000007E2, 0x00000482, 0x213C0408, 0x000007E2, 0x000004A2,
+    0x213C0402, 0x000007E2, 0x000004A2, 0x213C0408, 0x000007E2, 0x00000762, 0x213C0402, 0x000007E2,
+    0x00000762, 0x213C0408, 0x000007E2, 0x000005A2, 0x213C0402, 0x000007E2, 0x000005A2, 0x213C0408,
+    0x000007E2, 0x00000842, 0x213C0402, 0x000007E2, 0x00000842, 0x22170408, 0x00000842, 0x22170402,
+    0x00000842, 0x22170408, 0x00000762, 0x22170402, 0x00000762, 0x22170408, 0x000007E2, 0x00000482,
+    0x22170402, 0x000007E2, 0x00000482, 0x22170408, 0x000007E2, 0x000004A2, 0x22170402, 0x000007E2,
+    0x000004A2, 0x22170408, 0x000007E2, 0x00000762, 0x22170402, 0x000007E2, 0x00000762, 0x22170408,
+    0x000007E2, 0x000005A2, 0x22170402, 0x000007E2, 0x000005A2, 0x22170408, 0x000007E2, 0x00000842,
+    0x22170402, 0x000007E2, 0x00000842, 0x22700408, 0x000004A2, 0x22700402, 0x000004A2, 0x22700408,
+    0x00000842, 0x22700402, 0x00000842, 0x22700408, 0x00000762, 0x22700402, 0x00000762, 0x22700408,
+    0x000005A2, 0x22700402, 0x000005A2, 0x20D6040A, 0x20D6040A, 0x20D60404, 0x20D60404, 0x22540408,
+    0x22540402, 0x22800408, 0x22800402, 0x231E0402, 0x00000442, 0x231E0402, 0x00000462, 0x231E0402,
+    0x00000442, 0x000004A2, 0x231E0402, 0x00000462, 0x000004A2, 0x231E0402, 0x00000442, 0x00000482,
+    0x231E0402, 0x00000462, 0x00000482, 0x231E0402, 0x00000442, 0x00000542, 0x231E0402, 0x00000462,
+    0x00000542, 0x231E0408, 0x00000442, 0x231E0408, 0x00000462, 0x231E0408, 0x00000442, 0x000004A2,
+    0x231E0408, 0x00000462, 0x000004A2, 0x231E0408, 0x00000442, 0x00000482, 0x231E0408, 0x00000462,
+    0x00000482, 0x231E0408, 0x00000442, 0x00000542, 0x231E0408, 0x00000462, 0x00000542, 0x23230402,
+    0x00000442, 0x23230402, 0x00000462, 0x23230402, 0x00000442, 0x000004A2, 0x23230402, 0x00000462,
+    0x000004A2, 0x23230402, 0x00000442, 0x00000482, 0x23230402, 0x00000462, 0x00000482, 0x23230408,
+    0x00000442, 0x23230408, 0x00000462, 0x23230408, 0x00000442, 0x000004A2, 0x23230408, 0x00000462,
+    0x000004A2, 0x23230408, 0x00000442, 0x00000482, 0x23230408, 0x00000462, 0x00000482, 0x23290402,
+    0x00000442, 0x23290402, 0x00000462, 0x23290402, 0x00000442, 0x000004A2, 0x23290402, 0x00000462,
+    0x000004A2, 0x23290402, 0x00000442, 0x00000482, 0x23290402, 0x00000462, 0x00000482, 0x23290402,
+    0x00000442, 0x00000542, 0x23290402, 0x00000462, 0x00000542, 0x23290408, 0x00000442, 0x23290408,
+    0x00000462, 0x23290408, 0x00000442, 0x000004A2, 0x23290408, 0x00000462, 0x000004A2, 0x23290408,
+    0x00000442, 0x00000482, 0x23290408, 0x00000462, 0x00000482, 0x23290408, 0x00000442, 0x00000542,
+    0x23290408, 0x00000462, 0x00000542, 0x232B0402, 0x00000442, 0x232B0402, 0x00000462, 0x232B0402,
+    0x00000442, 0x000004A2, 0x232B0402, 0x00000462, 0x000004A2, 0x232B0402, 0x00000442, 0x00000482,
+    0x232B0402, 0x00000462, 0x00000482, 0x232B0402, 0x00000442, 0x00000542, 0x232B0402, 0x00000462,
+    0x00000542, 0x232B0408, 0x00000442, 0x232B0408, 0x00000462, 0x232B0408, 0x00000442, 0x000004A2,
+    0x232B0408, 0x00000462, 0x000004A2, 0x232B0408, 0x00000442, 0x00000482, 0x232B0408, 0x00000462,
+    0x00000482, 0x232B0408, 0x00000442, 0x00000542, 0x232B0408, 0x00000462, 0x00000542, 0x23330402,
+    0x00000442, 0x23330402, 0x00000462, 0x23330402, 0x00000442, 0x000004A2, 0x23330402, 0x00000462,
+    0x000004A2, 0x23330402, 0x00000442, 0x00000482, 0x23330402, 0x00000462, 0x00000482, 0x23330408,
+    0x00000442, 0x23330408, 0x00000462, 0x23330408, 0x00000442, 0x000004A2, 0x23330408, 0x00000462,
+    0x000004A2, 0x23330408, 0x00000442, 0x00000482, 0x23330408, 0x00000462, 0x00000482, 0x23410402,
+    0x00000442, 0x23410402, 0x00000462, 0x23410402, 0x00000442, 0x000004A2, 0x23410402, 0x00000462,
+    0x000004A2, 0x23410402, 0x00000442, 0x00000482, 0x23410402, 0x00000462, 0x00000482, 0x23410402,
+    0x00000442, 0x00000542, 0x23410402, 0x00000462, 0x00000542, 0x23410408, 0x00000462, 0x23410408,
+    0x00000462, 0x000004A2, 0x23410408, 0x00000462, 0x00000482, 0x23410408, 0x00000462, 0x00000542,
+    0x23460402, 0x00000442, 0x23460402, 0x00000462, 0x23460402, 0x00000442, 0x000004A2, 0x23460402,
+    0x00000462, 0x000004A2, 0x23460402, 0x00000442, 0x00000482, 0x23460402, 0x00000462, 0x00000482,
+    0x23460402, 0x00000442, 0x00000542, 0x23460402, 0x00000462, 0x00000542, 0x23460408, 0x00000442,
+    0x23460408, 0x00000462, 0x23460408, 0x00000442, 0x000004A2, 0x23460408, 0x00000462, 0x000004A2,
+    0x23460408, 0x00000442, 0x00000482, 0x23460408, 0x00000462, 0x00000482, 0x23460408, 0x00000442,
+    0x00000542, 0x23460408, 0x00000462, 0x00000542, 0x231E0402, 0x000004A2, 0x23230402, 0x000004A2,
+    0x23290402, 0x000004A2, 0x232B0402, 0x000004A2, 0x23330402, 0x000004A2, 0x23410402, 0x000004A2,
+    0x23460402, 0x000004A2, 0x231E0402, 0x00000442, 0x00000982, 0x231E0402, 0x00000462, 0x00000982,
+    0x231E0402, 0x00000442, 0x000004A2, 0x00000982, 0x231E0402, 0x00000462, 0x000004A2, 0x00000982,
+    0x231E0402, 0x00000442, 0x00000482, 0x00000982, 0x231E0402, 0x00000462, 0x00000482, 0x00000982,
+    0x231E0402, 0x00000442, 0x00000542, 0x00000982, 0x231E0402, 0x00000462, 0x00000542, 0x00000982,
+    0x231E0408, 0x00000442, 0x00000982, 0x231E0408, 0x00000462, 0x00000982, 0x231E0408, 0x00000442,
+    0x000004A2, 0x00000982, 0x231E0408, 0x00000462, 0x000004A2, 0x00000982, 0x231E0408, 0x00000442,
+    0x00000482, 0x00000982, 0x231E0408, 0x00000462, 0x00000482, 0x00000982, 0x231E0408, 0x00000442,
+    0x00000542, 0x00000982, 0x231E0408, 0x00000462, 0x00000542, 0x00000982, 0x23290402, 0x00000442,
+    0x00000982, 0x23290402, 0x00000462, 0x00000982, 0x23290402, 0x00000442, 0x000004A2, 0x00000982,
+    0x23290402, 0x00000462, 0x000004A2, 0x00000982, 0x23290402, 0x00000442, 0x00000482, 0x00000982,
+    0x23290402, 0x00000462, 0x00000482, 0x00000982, 0x23290402, 0x00000442, 0x00000542, 0x00000982,
+    0x23290402, 0x00000462, 0x00000542, 0x00000982, 0x23290408, 0x00000442, 0x00000982, 0x23290408,
+    0x00000462, 0x00000982, 0x23290408, 0x00000442, 0x000004A2, 0x00000982, 0x23290408, 0x00000462,
+    0x000004A2, 0x00000982, 0x23290408, 0x00000442, 0x00000482, 0x00000982, 0x23290408, 0x00000462,
+    0x00000482, 0x00000982, 0x23290408, 0x00000442, 0x00000542, 0x00000982, 0x23290408, 0x00000462,
+    0x00000542, 0x00000982, 0x23460402, 0x00000442, 0x00000982, 0x23460402, 0x00000462, 0x00000982,
+    0x23460402, 0x00000442, 0x000004A2, 0x00000982, 0x23460402, 0x00000462, 0x000004A2, 0x00000982,
+    0x23460402, 0x00000442, 0x00000482, 0x00000982, 0x23460402, 0x00000462, 0x00000482, 0x00000982,
+    0x23460402, 0x00000442, 0x00000542, 0x00000982, 0x23460402, 0x00000462, 0x00000542, 0x00000982,
+    0x23460408, 0x00000442, 0x00000982, 0x23460408, 0x00000462, 0x00000982, 0x23460408, 0x00000442,
+    0x000004A2, 0x00000982, 0x23460408, 0x00000462, 0x000004A2, 0x00000982, 0x23460408, 0x00000442,
+    0x00000482, 0x00000982, 0x23460408, 0x00000462, 0x00000482, 0x00000982, 0x23460408, 0x00000442,
+    0x00000542, 0x00000982, 0x23460408, 0x00000462, 0x00000542, 0x00000982, 0x231E0402, 0x000004C2,
+    0x231E0402, 0x00000642, 0x231E0402, 0x000004A2, 0x00000982, 0x231E0402, 0x00000982, 0x231E0402,
+    0x00000482, 0x00000982, 0x231E0402, 0x00000542, 0x231E0402, 0x00000542, 0x00000982, 0x231E0408,
+    0x000004C2, 0x231E0408, 0x00000642, 0x231E0408, 0x000004A2, 0x231E0408, 0x00000982, 0x04C00402,
+    0x04C20402, 0x04BB0402, 0x00000542, 0x23290402, 0x000004A2, 0x00000982, 0x23290402, 0x00000982,
+    0x23290402, 0x00000482, 0x00000982, 0x23290402, 0x00000542, 0x23290402, 0x00000542, 0x00000982,
+    0x23230408, 0x000004A2, 0x23290408, 0x000004A2, 0x23290408, 0x00000982, 0x04C00402, 0x000004A2,
+    0x04C00402, 0x00000482, 0x04C00402, 0x00000542, 0x232B0402, 0x000004C2, 0x232B0402, 0x00000642,
+    0x232B0402, 0x00000562, 0x000004A2, 0x232B0402, 0x00000542, 0x232B0402, 0x00000562, 0x00000542,
+    0x232B0408, 0x000004C2, 0x232B0408, 0x00000642, 0x232B0408, 0x000004A2, 0x04C10402, 0x000004A2,
+    0x04C10402, 0x00000482, 0x04C10402, 0x00000542, 0x23410402, 0x000004C2, 0x23410402, 0x00000642,
+    0x23410402, 0x00000562, 0x000004A2, 0x23390402, 0x00000442, 0x23390402, 0x00000462, 0x23410402,
+    0x00000542, 0x23410402, 0x00000562, 0x00000542, 0x23410408, 0x000004C2, 0x23410408, 0x00000642,
+    0x23410408, 0x000004A2, 0x23390408, 0x00000462, 0x04BB0402, 0x000004A2, 0x23460402, 0x000004A2,
+    0x00000982, 0x23460402, 0x00000982, 0x23460402, 0x00000482, 0x00000982, 0x23460402, 0x00000542,
+    0x23460402, 0x00000542, 0x00000982, 0x23330408, 0x000004A2, 0x23460408, 0x000004A2, 0x23460408,
+    0x00000982, 0x04C10402, 0x02130402, 0x0213041B, 0x02140402, 0x02150402, 0x02160402, 0x02170402,
+    0x03940402, 0x020C0402, 0x03170402, 0x03180402, 0x03190402, 0x031A0402, 0x031E0402, 0x031F0402,
+    0x03200402, 0x03210402, 0x03B30402, 0x03B40402, 0x03B90402, 0x03BA0402, 0x027E0404, 0x027E0404,
+    0x027E0404, 0x027E0404, 0x027E0404, 0x027E0404, 0x03BB0402, 0x02070402, 0x02080402, 0x03AF0402,
+    0x03B10402, 0x03BF0402, 0x03BF0404, 0x03BF0404, 0x03BF0404, 0x03BF0404, 0x03BF0404, 0x03C00402,
+    0x03C00404, 0x03C00404, 0x03C00404, 0x03C00404, 0x03C00404, 0x03C30402, 0x031B0402, 0x031C0402,
+    0x03C40402, 0x02670404, 0x02670404, 0x027C0402, 0x020A0402, 0x03C50402, 0x03C70402, 0x03C90402,
+    0x03CA0402, 0x03BC0402, 0x06760402, 0x03340402, 0x03350402, 0x026D0404, 0x026D0404, 0x026D0404,
+    0x02670404, 0x02670404, 0x026D0404, 0x03AA0402, 0x039D0402, 0x03BD0402, 0x03BE0402, 0x03A20402,
+    0x023C0402, 0x03C80402, 0x03A30402, 0x06720402, 0x021A0402, 0x03C60402, 0x02F90402, 0x02FA0402,
+    0x03BF0404, 0x03BF0404, 0x03BF0404, 0x03BF0404, 0x02FB0402, 0x02FC0402, 0x02FD0402, 0x02FE0402,
+    0x02FF0402, 0x03000402, 0x03010402, 0x1F980414, 0x20900414, 0x1F9C0414, 0x1F9D0414, 0x1F9E0414,
+    0x1F9F0414, 0x1FA00414, 0x1FA10414, 0x06660414, 0x06710414, 0x066B0414, 0x03280414, 0x03290414,
+    0x21180414, 0x1F980415, 0x1F990415, 0x1F9A0415, 0x1F9B0415, 0x1F9C0415, 0x1F9D0415, 0x1F9E0415,
+    0x1F9F0415, 0x1FA00415, 0x1FA10415, 0x06660415, 0x06710415, 0x066B0415, 0x03280415, 0x03290415,
+    0x1FA20415, 0x20070415, 0x213C0415, 0x22640415, 0x201A0415, 0x20750415, 0x20C40415, 0x20D60415,
+    0x21090415, 0x21180415, 0x216B0415, 0x21D20415, 0x21F70415, 0x1F780402, 0x1F790402, 0x1F7A0402,
+    0x1F7B0402, 0x1F7C0402, 0x1F7D0402, 0x1F7E0402, 0x1F7F0402, 0x2193040A, 0x21D20404, 0x1F800402,
+    0x1F810402, 0x1F820402, 0x1F830402, 0x1F840402, 0x1F850402, 0x1F860402, 0x1F870402, 0x1F880402,
+    0x1F890402, 0x1F8A0402, 0x1F8B0402, 0x1F8C0402, 0x1F8D0402, 0x1F8E0402, 0x1F8F0402, 0x1F900402,
+    0x1F920402, 0x1F930402, 0x1F940402, 0x1F950402, 0x1F960402, 0x1F970402, 0x00002122, 0x00002142,
+    0x00002162, 0x00002182, 0x000021A2, 0x000021C2, 0x000021E2, 0x00002202, 0x00002222, 0x00002242,
+    0x00002262, 0x00002282, 0x000022A2, 0x000022C2, 0x1FA20404, 0x03A60404, 0x1FD60404, 0x1FA20404,
+    0x03A60404, 0x21D20404, 0x1FD6040B, 0x052A0404, 0x1FD6040A, 0x05D60402, 0x1FD60404, 0x03A60404,
+    0x213C0404, 0x1FD60404, 0x03A60404, 0x22170404, 0x201F040A, 0x05D70402, 0x052A0404, 0x2042040A,
+    0x20510405, 0x2075040B, 0x20750405, 0x2090040B, 0x20D6040B, 0x20D60405, 0x05D80402, 0x2118040B,
+    0x2118040A, 0x213C0404, 0x05D90402, 0x05DA0402, 0x216B040B, 0x2180040B, 0x2193040B, 0x05DB0402,
+    0x05DC0402, 0x21D20414, 0x21090414, 0x21F7040A, 0x2007040A, 0x20D6040A, 0x21F70414, 0x21090414,
+    0x05DD0402, 0x2286040B, 0x05DE0402, 0x05DF0402, 0x05E00402, 0x1FBC040B, 0x05E10402, 0x20070405,
+    0x2007040B, 0x2042040B, 0x204F0408, 0x2109040B, 0x213C0405, 0x261E0404, 0x261F0404, 0x26200404,
+    0x26210404, 0x20900405, 0x05E20402, 0x2042040A, 0x1FA2040A, 0x2264040A, 0x23340405, 0x23200405,
+    0x2320040B, 0x2334040B, 0x06650405, 0x05E30402, 0x05E40402, 0x05E50402, 0x05E60402, 0x1FEB040B,
+    0x1FEB0405, 0x20AB0405, 0x05E70402, 0x07010402, 0x05E80402, 0x1FA2040A, 0x03A60404, 0x21D2040A,
+    0x204F0402, 0x05E90402, 0x1F99041E, 0x0676041E, 0x1F9F041E, 0x1F99041E, 0x0676041E, 0x1FA1041E,
+    0x1F99041E, 0x0676041E, 0x1F99041E, 0x1F98041E, 0x1F99041E, 0x0676041E, 0x1F9B041E, 0x1F9A041E,
+    0x0676041E, 0x1F9B041E, 0x1F99041E, 0x0676041E, 0x1F9D041E, 0x1F9A041E, 0x0676041E, 0x1F9D041E,
+    0x1F9B041E, 0x0676041E, 0x1F9D041E, 0x1F9C041E, 0x0676041E, 0x1F9D041E, 0x1F99041E, 0x0676041E,
+    0x1F9E041E, 0x1F9D041E, 0x0676041E, 0x1F9E041E, 0x1F99041E, 0x0676041E, 0x1FA0041E, 0x1F9B041E,
+    0x0676041E, 0x1FA0041E, 0x1F9D041E, 0x0676041E, 0x1FA0041E, 0x1F9F041E, 0x0676041E, 0x1FA0041E,
+    0x1F99041E, 0x0676041E, 0x2090040A, 0x2090040A, 0x2090040A, 0x2090040A, 0x2090040A, 0x2090040A,
+    0x2090040A, 0x2247040A, 0x2247040A, 0x2247040A, 0x2090040A, 0x2247040A, 0x2090040A, 0x2090040A,
+    0x2247040A, 0x2090040A, 0x2090040A, 0x2090040A, 0x2090040A, 0x2264040A, 0x2264040A, 0x2264040A,
+    0x2090040A, 0x2264040A, 0x2090040A, 0x2090040A, 0x20D6040A, 0x1FD6040A, 0x1FEB040A, 0x2109040A,
+    0x20900404, 0x20900404, 0x20900404, 0x20900404, 0x20900404, 0x20900404, 0x22470404, 0x22470404,
+    0x20900404, 0x22470404, 0x20900404, 0x20900404, 0x22470404, 0x20900404, 0x20900404, 0x20900404,
+    0x20900404, 0x22640404, 0x22640404, 0x20900404, 0x22640404, 0x20900404, 0x20900404, 0x1D9B0402,
+    0x1D9C0402, 0x1D9D0402, 0x1FE90408, 0x1FE90402, 0x1D9E0402, 0x1D9F0402, 0x1DA00402, 0x1F98041E,
+    0x0676041E, 0x1F9B041E, 0x05EA0402, 0x05EB0402, 0x05EC0402, 0x05EE0402, 0x05ED0402, 0x05EF0402,
+    0x05F00402, 0x05F10402, 0x05F20402, 0x05F30402, 0x05F40402, 0x05F50402, 0x05EC0402, 0x000005E2,
+    0x05ED0402, 0x000005E2, 0x05F60402, 0x05F70402, 0x05F80402, 0x05F90402, 0x05FA0402, 0x05FB0402,
+    0x05FC0402, 0x05FD0402, 0x05FE0402, 0x05FF0402, 0x06000402, 0x06010402, 0x06020402, 0x06030402,
+    0x06040402, 0x06050402, 0x06060402, 0x06070402, 0x05F00402, 0x000005E2, 0x06080402, 0x06090402,
+    0x060A0402, 0x060B0402, 0x060C0402, 0x060D0402, 0x060E0402, 0x060F0402, 0x06100402, 0x06110402,
+    0x06120402, 0x06130402, 0x06140402, 0x06150402, 0x06160402, 0x06170402, 0x06180402, 0x06190402,
+    0x061A0402, 0x061B0402, 0x061C0402, 0x061D0402, 0x061E0402, 0x061F0402, 0x06200402, 0x06210402,
+    0x06220402, 0x06230402, 0x06240402, 0x06250402, 0x06260402, 0x000005E2, 0x062A0402, 0x000005E2,
+    0x06280402, 0x000005E2, 0x06260402, 0x06270402, 0x06280402, 0x06290402, 0x062A0402, 0x062B0402,
+    0x062C0402, 0x062D0402, 0x062E0402, 0x062F0402, 0x06300402, 0x06310402, 0x06320402, 0x06330402,
+    0x06340402, 0x06350402, 0x06360402, 0x06370402, 0x06380402, 0x06390402, 0x063A0402, 0x063B0402,
+    0x063C0402, 0x063D0402, 0x063E0402, 0x063F0402, 0x06400402, 0x06410402, 0x06420402, 0x06430402,
+    0x06440402, 0x06450402, 0x06460402, 0x06470402, 0x06480402, 0x06490402, 0x064A0402, 0x064B0402,
+    0x064C0402, 0x064D0402, 0x064E0402, 0x064F0402, 0x06500402, 0x06510402, 0x06520402, 0x06530402,
+    0x06540402, 0x06550402, 0x06560402, 0x06570402, 0x06580402, 0x06590402, 0x06590402, 0x000005E2,
+    0x065A0402, 0x065B0402, 0x065C0402, 0x065D0402, 0x065D0402, 0x000005E2, 0x065E0402, 0x065F0402,
+    0x065F0402, 0x000005E2, 0x06600402, 0x06620402, 0x06630402, 0x06640402, 0x06650402, 0x06710402,
+    0x06730402, 0x06740402, 0x06750402, 0x06770402, 0x06780402, 0x06790402, 0x067A0402, 0x067B0402,
+    0x067C0402, 0x067E0402, 0x06800402, 0x06810402, 0x06820402, 0x06830402, 0x06840402, 0x06850402,
+    0x06860402, 0x06860402, 0x000005E2, 0x06870402, 0x06870402, 0x000005E2, 0x06880402, 0x06890402,
+    0x068A0402, 0x068B0402, 0x068C0402, 0x068C0404, 0x068C0404, 0x068C0404, 0x068C0404, 0x068C0404,
+    0x068D0402, 0x068D0404, 0x068D0404, 0x068D0404, 0x068D0404, 0x068D0404, 0x068E0402, 0x068F0402,
+    0x06900402, 0x06910402, 0x06920402, 0x06930402, 0x06940402, 0x06950402, 0x06960402, 0x06970402,
+    0x06980402, 0x06990402, 0x069A0402, 0x069B0402, 0x069C0402, 0x069D0402, 0x06990402, 0x000005E2,
+    0x069E0402, 0x069F0402, 0x069F0402, 0x000005E2, 0x06A00402, 0x06A10402, 0x06A00402, 0x000005E2,
+    0x06A20402, 0x06A20402, 0x000005E2, 0x06A30402, 0x06A40402, 0x06A50402, 0x06A60402, 0x06A70402,
+    0x06A80402, 0x06A90402, 0x06AA0402, 0x06AB0402, 0x06AC0402, 0x06AD0402, 0x06AE0402, 0x06AF0402,
+    0x06B00402, 0x06B10402, 0x06B20402, 0x06B30402, 0x06B40402, 0x06B50402, 0x06B60402, 0x06B70402,
+    0x06B80402, 0x066B0402, 0x000005E2, 0x06B90402, 0x06B90402, 0x000005E2, 0x06BA0402, 0x06BB0402,
+    0x06BC0402, 0x06BD0402, 0x06BE0402, 0x06BF0402, 0x06C00402, 0x06C10402, 0x06C20402, 0x06C30402,
+    0x06A60402, 0x000005E2, 0x066A0402, 0x000005E2, 0x066C0402, 0x000005E2, 0x06BB0402, 0x000005E2,
+    0x06BC0402, 0x000005E2, 0x06C40402, 0x06C50402, 0x06C40402, 0x000005E2, 0x06C50402, 0x000005E2,
+    0x06C60402, 0x06C70402, 0x06C60402, 0x000005E2, 0x06C70402, 0x000005E2, 0x06C80402, 0x06C90402,
+    0x06CA0402, 0x06CB0402, 0x06CC0402, 0x06CD0402, 0x06C80402, 0x000005E2, 0x06C90402, 0x000005E2,
+    0x06CE0402, 0x06CF0402, 0x06CE0402, 0x000005E2, 0x06CF0402, 0x000005E2, 0x06D00402, 0x06D10402,
+    0x06D00402, 0x000005E2, 0x06D10402, 0x000005E2, 0x06D20402, 0x06D30402, 0x06D40402, 0x06D50402,
+    0x06D60402, 0x06D70402, 0x06D80402, 0x06D90402, 0x06DA0402, 0x06DB0402, 0x06DC0402, 0x06DD0402,
+    0x06DE0402, 0x06DF0402, 0x06E00402, 0x06E10402, 0x06E20402, 0x06E30402, 0x06E40402, 0x06E50402,
+    0x06E60402, 0x06E70402, 0x06E80402, 0x06E90402, 0x06EA0402, 0x06EB0402, 0x06EC0402, 0x06ED0402,
+    0x06EE0402, 0x06EF0402, 0x06F00402, 0x06F10402, 0x06F20402, 0x06F30402, 0x06EA0402, 0x000005E2,
+    0x06F00402, 0x000005E2, 0x06F10402, 0x000005E2, 0x06F30402, 0x000005E2, 0x06F40402, 0x06F50402,
+    0x06F60402, 0x06F70402, 0x06F80402, 0x06F90402, 0x06FA0402, 0x06FB0402, 0x06FC0402, 0x06FD0402,
+    0x06FE0402, 0x06FF0402, 0x07000402, 0x07020402, 0x07030402, 0x07040402, 0x07050402, 0x07060402,
+    0x07070402, 0x07080402, 0x07090402, 0x070A0402, 0x070B0402, 0x070C0402, 0x070D0402, 0x070E0402,
+    0x070F0402, 0x07100402, 0x07110402, 0x07120402, 0x07130402, 0x07140402, 0x07150402, 0x07160402,
+    0x07170402, 0x07180402, 0x07190402, 0x071A0402, 0x071B0402, 0x071C0402, 0x071D0402, 0x071E0402,
+    0x071F0402, 0x07200402, 0x07210402, 0x07220402, 0x07230402, 0x07240402, 0x06CA0402, 0x000005E2,
+    0x06CB0402, 0x000005E2, 0x06D90402, 0x000005E2, 0x06DA0402, 0x000005E2, 0x07250402, 0x07260402,
+    0x07270402, 0x07280402, 0x07290402, 0x072A0402, 0x06F60402, 0x000005E2, 0x06F70402, 0x000005E2,
+    0x06F80402, 0x000005E2, 0x06F90402, 0x000005E2, 0x072B0402, 0x072C0402, 0x072D0402, 0x072E0402,
+    0x072F0402, 0x07300402, 0x07310402, 0x07320402, 0x07330402, 0x07340402, 0x07350402, 0x07360402,
+    0x07370402, 0x07380402, 0x07390402, 0x073A0402, 0x073B0402, 0x073C0402, 0x073D0402, 0x073E0402,
+    0x073F0402, 0x07400402, 0x07410402, 0x07420402, 0x07430402, 0x07440402, 0x03360402, 0x03370402,
+    0x03380402, 0x03390402, 0x07450402, 0x07460402, 0x07470402, 0x07480402, 0x07490402, 0x074A0402,
+    0x074B0402, 0x074C0402, 0x074D0402, 0x074E0402, 0x074F0402, 0x07500402, 0x07510402, 0x07520402,
+    0x07530402, 0x07540402, 0x07550402, 0x07560402, 0x07570402, 0x07580402, 0x07590402, 0x075A0402,
+    0x075B0402, 0x075C0402, 0x075D0402, 0x075E0402, 0x075F0402, 0x07600402, 0x07610402, 0x03800402,
+    0x03810402, 0x07620402, 0x07630402, 0x07640402, 0x07650402, 0x07660402, 0x07670402, 0x07680402,
+    0x07690402, 0x076A0402, 0x076B0402, 0x076C0402, 0x076D0402, 0x076E0402, 0x076F0402, 0x07700402,
+    0x07710402, 0x07720402, 0x07730402, 0x07740402, 0x07750402, 0x07760402, 0x07770402, 0x07780402,
+    0x07790402, 0x077A0402, 0x077B0402, 0x077C0402, 0x077D0402, 0x077E0402, 0x077F0402, 0x07800402,
+    0x07810402, 0x07820402, 0x07830402, 0x07840402, 0x07850402, 0x07860402, 0x07870402, 0x07880402,
+    0x07890402, 0x078A0402, 0x078B0402, 0x078C0402, 0x078D0402, 0x078E0402, 0x078F0402, 0x07900402,
+    0x07910402, 0x07920402, 0x07930402, 0x07940402, 0x07950402, 0x07960402, 0x07970402, 0x07980402,
+    0x07990402, 0x079A0402, 0x079B0402, 0x079C0402, 0x079D0402, 0x079E0402, 0x079F0402, 0x07A00402,
+    0x07A10402, 0x07A20402, 0x07A30402, 0x07A40402, 0x07A50402, 0x07A60402, 0x07A70402, 0x07A80402,
+    0x07A90402, 0x07AA0402, 0x07AB0402, 0x07AC0402, 0x07AD0402, 0x07AE0402, 0x07AF0402, 0x07B00402,
+    0x07B10402, 0x07B20402, 0x07B30402, 0x07B40402, 0x07B50402, 0x07B60402, 0x07B70402, 0x07B80402,
+    0x07B90402, 0x07BA0402, 0x07BB0402, 0x07BC0402, 0x07BD0402, 0x07BE0402, 0x07BF0402, 0x07C00402,
+    0x07C10402, 0x07C20402, 0x07C30402, 0x07C40402, 0x07C50402, 0x07C60402, 0x07C70402, 0x07C80402,
+    0x07C90402, 0x07CA0402, 0x07CB0402, 0x07CC0402, 0x07CD0402, 0x07CE0402, 0x07CF0402, 0x07D00402,
+    0x07D10402, 0x07D20402, 0x07D30402, 0x07D40402, 0x07D50402, 0x07D60402, 0x07D70402, 0x07D80402,
+    0x07D90402, 0x07DA0402, 0x07DB0402, 0x07DC0402, 0x07DD0402, 0x07DE0402, 0x07DF0402, 0x07E00402,
+    0x07E10402, 0x07E20402, 0x07E30402, 0x07E40402, 0x07E50402, 0x07E60402, 0x07E70402, 0x07E80402,
+    0x07E90402, 0x07EA0402, 0x07EB0402, 0x07EC0402, 0x07ED0402, 0x07EE0402, 0x07EF0402, 0x07F00402,
+    0x07F10402, 0x07F20402, 0x07F30402, 0x07F40402, 0x07F50402, 0x07F60402, 0x07F70402, 0x07F80402,
+    0x07F90402, 0x07FA0402, 0x07FB0402, 0x07FC0402, 0x07FD0402, 0x07FE0402, 0x07FF0402, 0x08000402,
+    0x08010402, 0x08020402, 0x08030402, 0x08040402, 0x08050402, 0x08060402, 0x08070402, 0x08080402,
+    0x08090402, 0x080A0402, 0x080B0402, 0x080C0402, 0x080D0402, 0x080E0402, 0x080F0402, 0x08100402,
+    0x08110402, 0x08120402, 0x08130402, 0x08140402, 0x08150402, 0x08160402, 0x08170402, 0x08180402,
+    0x08190402, 0x081A0402, 0x081B0402, 0x081C0402, 0x081D0402, 0x081E0402, 0x081F0402, 0x08200402,
+    0x08210402, 0x08220402, 0x08230402, 0x08240402, 0x08250402, 0x08260402, 0x08270402, 0x08280402,
+    0x08290402, 0x082A0402, 0x082B0402, 0x082C0402, 0x082D0402, 0x082E0402, 0x082F0402, 0x08300402,
+    0x08310402, 0x08320402, 0x08330402, 0x08340402, 0x08350402, 0x08360402, 0x08370402, 0x08380402,
+    0x08390402, 0x083A0402, 0x083B0402, 0x083C0402, 0x083D0402, 0x083E0402, 0x083F0402, 0x08400402,
+    0x08410402, 0x08420402, 0x08430402, 0x08440402, 0x08450402, 0x08460402, 0x08470402, 0x08480402,
+    0x08490402, 0x084A0402, 0x084B0402, 0x084C0402, 0x084D0402, 0x084E0402, 0x084F0402, 0x08500402,
+    0x08510402, 0x08520402, 0x08530402, 0x08540402, 0x08550402, 0x08560402, 0x08570402, 0x08580402,
+    0x08590402, 0x085A0402, 0x085B0402, 0x085C0402, 0x085D0402, 0x085E0402, 0x085F0402, 0x08600402,
+    0x08610402, 0x08620402, 0x08630402, 0x08640402, 0x08650402, 0x08660402, 0x08670402, 0x08680402,
+    0x1F990406, 0x1F9A0406, 0x1F9B0406, 0x1F9C0406, 0x1F9D0406, 0x1F9E0406, 0x1F9F0406, 0x1FA00406,
+    0x1FA10406, 0x1F990406, 0x1F980406, 0x1F990406, 0x1F990406, 0x1F990406, 0x1F9A0406, 0x1F990406,
+    0x1F9B0406, 0x1F990406, 0x1F9C0406, 0x1F990406, 0x1F9D0406, 0x1F990406, 0x1F9E0406, 0x1F990406,
+    0x1F9F0406, 0x1F990406, 0x1FA00406, 0x1F990406, 0x1FA10406, 0x1F9A0406, 0x1F980406, 0x03280404,
+    0x1F990404, 0x03290404, 0x03280404, 0x1F9A0404, 0x03290404, 0x03280404, 0x1F9B0404, 0x03290404,
+    0x03280404, 0x1F9C0404, 0x03290404, 0x03280404, 0x1F9D0404, 0x03290404, 0x03280404, 0x1F9E0404,
+    0x03290404, 0x03280404, 0x1F9F0404, 0x03290404, 0x03280404, 0x1FA00404, 0x03290404, 0x03280404,
+    0x1FA10404, 0x03290404, 0x03280404, 0x1F990404, 0x1F980404, 0x03290404, 0x03280404, 0x1F990404,
+    0x1F990404, 0x03290404, 0x03280404, 0x1F990404, 0x1F9A0404, 0x03290404, 0x03280404, 0x1F990404,
+    0x1F9B0404, 0x03290404, 0x03280404, 0x1F990404, 0x1F9C0404, 0x03290404, 0x03280404, 0x1F990404,
+    0x1F9D0404, 0x03290404, 0x03280404, 0x1F990404, 0x1F9E0404, 0x03290404, 0x03280404, 0x1F990404,
+    0x1F9F0404, 0x03290404, 0x03280404, 0x1F990404, 0x1FA00404, 0x03290404, 0x03280404, 0x1F990404,
+    0x1FA10404, 0x03290404, 0x03280404, 0x1F9A0404, 0x1F980404, 0x03290404, 0x1F990404, 0x027E0404,
+    0x1F9A0404, 0x027E0404, 0x1F9B0404, 0x027E0404, 0x1F9C0404, 0x027E0404, 0x1F9D0404, 0x027E0404,
+    0x1F9E0404, 0x027E0404, 0x1F9F0404, 0x027E0404, 0x1FA00404, 0x027E0404, 0x1FA10404, 0x027E0404,
+    0x1F990404, 0x1F980404, 0x027E0404, 0x1F990404, 0x1F990404, 0x027E0404, 0x1F990404, 0x1F9A0404,
+    0x027E0404, 0x1F990404, 0x1F9B0404, 0x027E0404, 0x1F990404, 0x1F9C0404, 0x027E0404, 0x1F990404,
+    0x1F9D0404, 0x027E0404, 0x1F990404, 0x1F9E0404, 0x027E0404, 0x1F990404, 0x1F9F0404, 0x027E0404,
+    0x1F990404, 0x1FA00404, 0x027E0404, 0x1F990404, 0x1FA10404, 0x027E0404, 0x1F9A0404, 0x1F980404,
+    0x027E0404, 0x03280404, 0x1FA20404, 0x03290404, 0x03280404, 0x1FBC0404, 0x03290404, 0x03280404,
+    0x1FD60404, 0x03290404, 0x03280404, 0x1FEB0404, 0x03290404, 0x03280404, 0x20070404, 0x03290404,
+    0x03280404, 0x20420404, 0x03290404, 0x03280404, 0x20510404, 0x03290404, 0x03280404, 0x20750404,
+    0x03290404, 0x03280404, 0x20900404, 0x03290404, 0x03280404, 0x20AB0404, 0x03290404, 0x03280404,
+    0x20C40404, 0x03290404, 0x03280404, 0x20D60404, 0x03290404, 0x03280404, 0x21090404, 0x03290404,
+    0x03280404, 0x21180404, 0x03290404, 0x03280404, 0x213C0404, 0x03290404, 0x03280404, 0x216B0404,
+    0x03290404, 0x03280404, 0x21800404, 0x03290404, 0x03280404, 0x21930404, 0x03290404, 0x03280404,
+    0x21D20404, 0x03290404, 0x03280404, 0x21F70404, 0x03290404, 0x03280404, 0x22170404, 0x03290404,
+    0x03280404, 0x22470404, 0x03290404, 0x03280404, 0x22590404, 0x03290404, 0x03280404, 0x22640404,
+    0x03290404, 0x03280404, 0x22700404, 0x03290404, 0x03280404, 0x22860404, 0x03290404, 0x1FA2040C,
+    0x1FBC040C, 0x1FD6040C, 0x1FEB040C, 0x2007040C, 0x2042040C, 0x2051040C, 0x2075040C, 0x2090040C,
+    0x20AB040C, 0x20C4040C, 0x20D6040C, 0x2109040C, 0x2118040C, 0x213C040C, 0x216B040C, 0x2180040C,
+    0x2193040C, 0x21D2040C, 0x21F7040C, 0x2217040C, 0x2247040C, 0x2259040C, 0x2264040C, 0x2270040C,
+    0x2286040C, 0x1FA20406, 0x1FBC0406, 0x1FD60406, 0x1FEB0406, 0x20070406, 0x20420406, 0x20510406,
+    0x20750406, 0x20900406, 0x20AB0406, 0x20C40406, 0x20D60406, 0x21090406, 0x21180406, 0x213C0406,
+    0x216B0406, 0x21800406, 0x21930406, 0x21D20406, 0x21F70406, 0x22170406, 0x22470406, 0x22590406,
+    0x22640406, 0x22700406, 0x22860406, 0x1F980406, 0x08690402, 0x086A0402, 0x086B0402, 0x086C0402,
+    0x086D0402, 0x086E0402, 0x086F0402, 0x08700402, 0x08710402, 0x08720402, 0x08730402, 0x08740402,
+    0x08750402, 0x08760402, 0x08770402, 0x08780402, 0x08790402, 0x087A0402, 0x087B0402, 0x087C0402,
+    0x087D0402, 0x087E0402, 0x087F0402, 0x08800402, 0x08810402, 0x08820402, 0x08830402, 0x08840402,
+    0x08850402, 0x08860402, 0x08870402, 0x08880402, 0x08890402, 0x088A0402, 0x088B0402, 0x088C0402,
+    0x088D0402, 0x088E0402, 0x088F0402, 0x08900402, 0x08910402, 0x08920402, 0x08930402, 0x08940402,
+    0x08950402, 0x08960402, 0x08970402, 0x08980402, 0x08990402, 0x089A0402, 0x089B0402, 0x089C0402,
+    0x089D0402, 0x089E0402, 0x089F0402, 0x08A00402, 0x08A10402, 0x08A20402, 0x08A30402, 0x08A40402,
+    0x08A50402, 0x08A60402, 0x08A70402, 0x08A80402, 0x08A90402, 0x08AA0402, 0x08AB0402, 0x08AC0402,
+    0x08AD0402, 0x08AE0402, 0x08AF0402, 0x08B00402, 0x08B10402, 0x08B20402, 0x08B30402, 0x08B40402,
+    0x08B50402, 0x08B60402, 0x08B70402, 0x08B80402, 0x08B90402, 0x08BA0402, 0x08BB0402, 0x08BC0402,
+    0x08BD0402, 0x08BE0402, 0x08BF0402, 0x08C00402, 0x08C10402, 0x08C20402, 0x08C30402, 0x08C40402,
+    0x08C50402, 0x08C60402, 0x08C70402, 0x08C80402, 0x08C90402, 0x08CA0402, 0x08CB0402, 0x08CC0402,
+    0x08CD0402, 0x08CE0402, 0x08CF0402, 0x08D00402, 0x08D10402, 0x08D20402, 0x08D30402, 0x08D40402,
+    0x08D50402, 0x08D60402, 0x08D70402, 0x08D80402, 0x08D90402, 0x08DA0402, 0x08DB0402, 0x08DC0402,
+    0x08DD0402, 0x08DE0402, 0x08DF0402, 0x08E00402, 0x08E10402, 0x08E20402, 0x08E30402, 0x08E40402,
+    0x08E50402, 0x08E60402, 0x08E70402, 0x08E80402, 0x08E90402, 0x08EA0402, 0x08EB0402, 0x08EC0402,
+    0x08ED0402, 0x08EE0402, 0x08EF0402, 0x08F00402, 0x08F10402, 0x08F20402, 0x08F30402, 0x08F40402,
+    0x08F50402, 0x08F60402, 0x08F70402, 0x08F80402, 0x08F90402, 0x08FA0402, 0x08FB0402, 0x08FC0402,
+    0x08FD0402, 0x08FE0402, 0x08FF0402, 0x09000402, 0x09010402, 0x09020402, 0x09030402, 0x09040402,
+    0x09050402, 0x09060402, 0x09070402, 0x09080402, 0x09090402, 0x090A0402, 0x090B0402, 0x090C0402,
+    0x090D0402, 0x090E0402, 0x090F0402, 0x09100402, 0x09110402, 0x09120402, 0x09130402, 0x09140402,
+    0x09150402, 0x09160402, 0x09170402, 0x09180402, 0x09190402, 0x091A0402, 0x091B0402, 0x091C0402,
+    0x091D0402, 0x091E0402, 0x091F0402, 0x09200402, 0x09210402, 0x09220402, 0x09230402, 0x09240402,
+    0x09250402, 0x09260402, 0x09270402, 0x09280402, 0x09290402, 0x092A0402, 0x092B0402, 0x092C0402,
+    0x092D0402, 0x092E0402, 0x092F0402, 0x09300402, 0x09310402, 0x09320402, 0x09330402, 0x09340402,
+    0x09350402, 0x09360402, 0x09370402, 0x09380402, 0x09390402, 0x093A0402, 0x093B0402, 0x093C0402,
+    0x093D0402, 0x093E0402, 0x093F0402, 0x09400402, 0x09410402, 0x09420402, 0x09430402, 0x09440402,
+    0x09450402, 0x09460402, 0x09470402, 0x09480402, 0x09490402, 0x094A0402, 0x094B0402, 0x094C0402,
+    0x094D0402, 0x094E0402, 0x094F0402, 0x09500402, 0x09510402, 0x09520402, 0x09530402, 0x09540402,
+    0x09550402, 0x09560402, 0x09570402, 0x09580402, 0x09590402, 0x095A0402, 0x095B0402, 0x095C0402,
+    0x095D0402, 0x095E0402, 0x095F0402, 0x09600402, 0x09610402, 0x09620402, 0x09630402, 0x09640402,
+    0x09650402, 0x09660402, 0x09670402, 0x09680402, 0x0A330402, 0x0A340402, 0x0A350402, 0x0A360402,
+    0x0A370402, 0x0A380402, 0x0A390402, 0x0A3A0402, 0x0A3B0402, 0x0A3C0402, 0x0A3D0402, 0x0A3E0402,
+    0x0A3F0402, 0x0A400402, 0x0A410402, 0x0A420402, 0x0A430402, 0x0A440402, 0x0A450402, 0x0A460402,
+    0x0A470402, 0x0A480402, 0x0A490402, 0x0A4A0402, 0x0A4B0402, 0x0A4C0402, 0x0A4D0402, 0x0A4E0402,
+    0x0A4F0402, 0x0A500402, 0x0A510402, 0x0A520402, 0x0A530402, 0x0A540402, 0x0A550402, 0x0A560402,
+    0x0A570402, 0x0A580402, 0x0A590402, 0x0A5A0402, 0x0A5B0402, 0x0A5C0402, 0x0A5D0402, 0x0A5E0402,
+    0x0A5F0402, 0x0A600402, 0x0A610402, 0x0A620402, 0x0FEE0402, 0x0FEF0402, 0x0FF00402, 0x0FF10402,
+    0x0FF20402, 0x0FF30402, 0x0FF40402, 0x0FF50402, 0x0A630402, 0x0A640402, 0x0A650402, 0x0A660402,
+    0x0A670402, 0x0A680402, 0x0A690402, 0x0A6A0402, 0x0A6B0402, 0x0A6C0402, 0x0A6D0402, 0x0A6E0402,
+    0x0A6F0402, 0x0A700402, 0x0A710402, 0x0A720402, 0x0A730402, 0x0A740402, 0x0A750402, 0x0A760402,
+    0x0A770402, 0x0A780402, 0x0A790402, 0x0A7A0402, 0x0A7B0402, 0x0A7C0402, 0x0A7D0402, 0x0A7E0402,
+    0x0A7F0402, 0x0A800402, 0x0A810402, 0x0A820402, 0x0A830402, 0x0A840402, 0x0A850402, 0x0A860402,
+    0x0A870402, 0x0A880402, 0x0A890402, 0x0A8A0402, 0x0A8B0402, 0x0A8C0402, 0x0A8D0402, 0x0A8E0402,
+    0x0A8F0402, 0x0A900402, 0x0A910402, 0x0A920402, 0x0A930402, 0x0A940402, 0x0A950402, 0x0A960402,
+    0x0A970402, 0x12410402, 0x12420402, 0x12430402, 0x0A980402, 0x0A990402, 0x0A9A0402, 0x0A9B0402,
+    0x0A9C0402, 0x0A9D0402, 0x0A9E0402, 0x0A9F0402, 0x0AA00402, 0x0AA10402, 0x0AA20402, 0x0AA30402,
+    0x0AA40402, 0x0AA50402, 0x0AA60402, 0x0AA70402, 0x0AA80402, 0x0AA90402, 0x0AAA0402, 0x0AAB0402,
+    0x0AAC0402, 0x0AAD0402, 0x0AAE0402, 0x0AAF0402, 0x0AB00402, 0x0AB10402, 0x0FE80402, 0x0FE90402,
+    0x0FEA0402, 0x0FEB0402, 0x0FEC0402, 0x0FED0402, 0x0AB20402, 0x0AB30402, 0x0AB40402, 0x0AB50402,
+    0x0AB60402, 0x0AB70402, 0x0AB80402, 0x0AB90402, 0x0ABA0402, 0x0ABB0402, 0x0ABC0402, 0x0ABD0402,
+    0x0ABE0402, 0x0ABF0402, 0x0AC00402, 0x0AC10402, 0x0AC20402, 0x0AC30402, 0x0AC40402, 0x0AC50402,
+    0x0AC60402, 0x0AC70402, 0x0AC80402, 0x0AC90402, 0x0ACA0402, 0x0ACB0402, 0x0ACC0402, 0x0ACD0402,
+    0x0ACE0402, 0x0ACF0402, 0x0AD00402, 0x0AD10402, 0x0AD20402, 0x0AD30402, 0x0AD40402, 0x0AD50402,
+    0x0AD60402, 0x0AD70402, 0x0AD80402, 0x0AD90402, 0x0ADA0402, 0x0ADB0402, 0x0ADC0402, 0x0ADD0402,
+    0x0ADE0402, 0x0ADF0402, 0x0AE00402, 0x0AE10402, 0x0AE20402, 0x0AE30402, 0x0AE40402, 0x0AE50402,
+    0x0AE60402, 0x0AE70402, 0x0AE80402, 0x0AE90402, 0x0AEA0402, 0x0AEB0402, 0x0AEC0402, 0x0AED0402,
+    0x0AEE0402, 0x0AEF0402, 0x0AF00402, 0x0AF10402, 0x0AF20402, 0x0AF30402, 0x0AF40402, 0x0AF50402,
+    0x0AF60402, 0x0AF70402, 0x0AF80402, 0x0AF90402, 0x0AFA0402, 0x0AFB0402, 0x0AFC0402, 0x0AFD0402,
+    0x0AFE0402, 0x0AFF0402, 0x0B000402, 0x0B010402, 0x0B020402, 0x0B030402, 0x0B040402, 0x0B050402,
+    0x0B060402, 0x0B070402, 0x0B080402, 0x0B090402, 0x0B0A0402, 0x0B0B0402, 0x0B0C0402, 0x0B0D0402,
+    0x0B0E0402, 0x0B0F0402, 0x0B100402, 0x0B110402, 0x0B120402, 0x0B130402, 0x0B140402, 0x0B150402,
+    0x0B160402, 0x0B170402, 0x0B180402, 0x0B190402, 0x0B1A0402, 0x0B1B0402, 0x0B1C0402, 0x0B1D0402,
+    0x0B1E0402, 0x0B1F0402, 0x0B200402, 0x0B210402, 0x0B3C0402, 0x0B3D0402, 0x0B3E0402, 0x0B3F0402,
+    0x0B400402, 0x0B410402, 0x0B420402, 0x0B430402, 0x0B440402, 0x0B450402, 0x0B460402, 0x0B470402,
+    0x0B480402, 0x0B490402, 0x0B4A0402, 0x0B4B0402, 0x0B4C0402, 0x0B4D0402, 0x0B4E0402, 0x0B4F0402,
+    0x0B500402, 0x0B510402, 0x0B520402, 0x0B530402, 0x0B540402, 0x0B550402, 0x0B560402, 0x0B570402,
+    0x0B580402, 0x0B590402, 0x0B5A0402, 0x0B5B0402, 0x0B5C0402, 0x0B5F0402, 0x0B600402, 0x0B610402,
+    0x0B620402, 0x0B630402, 0x0B640402, 0x0B650402, 0x0B660402, 0x0B670402, 0x0B680402, 0x0B690402,
+    0x0B6A0402, 0x0B6B0402, 0x0B6C0402, 0x0B6D0402, 0x0B6E0402, 0x0B6F0402, 0x0B700402, 0x0B710402,
+    0x0B720402, 0x0B730402, 0x0B740402, 0x0B750402, 0x0B760402, 0x0B770402, 0x0B780402, 0x0B790402,
+    0x0B7A0402, 0x0B7B0402, 0x0B7C0402, 0x0B7D0402, 0x0B7E0402, 0x0B7F0402, 0x0B800402, 0x0B810402,
+    0x0B820402, 0x0B830402, 0x0B840402, 0x0B850402, 0x0B860402, 0x0B870402, 0x0B880402, 0x0B890402,
+    0x0B8A0402, 0x0B8B0402, 0x0B8C0402, 0x0B8D0402, 0x0B8E0402, 0x0B8F0402, 0x0B900402, 0x0B910402,
+    0x0B920402, 0x0B930402, 0x0B940402, 0x0B950402, 0x0B960402, 0x0B970402, 0x0B980402, 0x0B990402,
+    0x0B9A0402, 0x0B9B0402, 0x0B9C0402, 0x0B9D0402, 0x0B9E0402, 0x0B9F0402, 0x0BA00402, 0x0BA10402,
+    0x0BA20402, 0x0BA30402, 0x0BA40402, 0x0BA50402, 0x035E0402, 0x035F0402, 0x03600402, 0x03610402,
+    0x03620402, 0x03630402, 0x03640402, 0x03650402, 0x03660402, 0x03670402, 0x03680402, 0x03690402,
+    0x036A0402, 0x036B0402, 0x0BA60402, 0x0BA70402, 0x0BA80402, 0x0BA90402, 0x0BAA0402, 0x0BAB0402,
+    0x0BAC0402, 0x0BAD0402, 0x0BAE0402, 0x0BAF0402, 0x0BB00402, 0x0BB10402, 0x0BB20402, 0x0BB30402,
+    0x0BB40402, 0x0BB50402, 0x0BB60402, 0x0BB70402, 0x0BB80402, 0x0BB90402, 0x0BBA0402, 0x0BBB0402,
+    0x0BBC0402, 0x0BBD0402, 0x0BBE0402, 0x0BBF0402, 0x0BC00402, 0x0BC10402, 0x0BC20402, 0x0BC30402,
+    0x0BC40402, 0x0BC50402, 0x0BC60402, 0x0BC70402, 0x0BC80402, 0x0BC90402, 0x0BCA0402, 0x0BCB0402,
+    0x0BCC0402, 0x0BCD0402, 0x0BCE0402, 0x0BCF0402, 0x0BD00402, 0x0BD10402, 0x0BD20402, 0x0BD30402,
+    0x0BD40402, 0x0BD50402, 0x0BD60402, 0x03520402, 0x03530402, 0x0BD70402, 0x0BD80402, 0x0BD90402,
+    0x0BDA0402, 0x0BDB0402, 0x0BDC0402, 0x0BDD0402, 0x0BDE0402, 0x0BDF0402, 0x0BE00402, 0x0BE10402,
+    0x0BE20402, 0x0BE30402, 0x0BE40402, 0x0BE50402, 0x0BE60402, 0x0BE70402, 0x0BE80402, 0x0BE90402,
+    0x0BEA0402, 0x0BEB0402, 0x0BEC0402, 0x0BED0402, 0x0BEE0402, 0x0BEF0402, 0x0BF00402, 0x0BF10402,
+    0x0BF20402, 0x0BF30402, 0x0BF40402, 0x0BF50402, 0x03540402, 0x03550402, 0x03560402, 0x03570402,
+    0x03580402, 0x03590402, 0x035A0402, 0x035B0402, 0x035C0402, 0x035D0402, 0x0BF60402, 0x0BF70402,
+    0x0BF80402, 0x0BF90402, 0x0BFA0402, 0x0BFB0402, 0x0BFC0402, 0x0BFD0402, 0x0BFE0402, 0x0BFF0402,
+    0x0C000402, 0x0C010402, 0x0C020402, 0x0C030402, 0x0C040402, 0x0C050402, 0x0EE80402, 0x0EE90402,
+    0x0EEA0402, 0x0EEB0402, 0x0EEC0402, 0x0EED0402, 0x0EEE0402, 0x0EEF0402, 0x0EF00402, 0x0EF10402,
+    0x0EF20402, 0x0EF30402, 0x0EF40402, 0x0EF50402, 0x0EF60402, 0x0EF70402, 0x0EF80402, 0x0EF90402,
+    0x0EFA0402, 0x0EFB0402, 0x0EFC0402, 0x0EFD0402, 0x0EFE0402, 0x0EFF0402, 0x0F000402, 0x0F010402,
+    0x0F020402, 0x0F030402, 0x0F040402, 0x0F050402, 0x0F060402, 0x0F070402, 0x0F080402, 0x0F090402,
+    0x0F0A0402, 0x0F0B0402, 0x0F0C0402, 0x0F0D0402, 0x0F0E0402, 0x0F0F0402, 0x0F100402, 0x0F110402,
+    0x0F120402, 0x0F130402, 0x0F140402, 0x0F150402, 0x0F160402, 0x0F170402, 0x0F180402, 0x0F190402,
+    0x0F1A0402, 0x0F1B0402, 0x0F1C0402, 0x0F1D0402, 0x0F1E0402, 0x0F1F0402, 0x0F200402, 0x0F210402,
+    0x0F220402, 0x0F230402, 0x0F240402, 0x0F250402, 0x0F260402, 0x0F270402, 0x0F280402, 0x0F290402,
+    0x0F2A0402, 0x0F2B0402, 0x0F2C0402, 0x0F2D0402, 0x0F2E0402, 0x0F2F0402, 0x0F300402, 0x0F310402,
+    0x0F320402, 0x0F330402, 0x0F340402, 0x0F350402, 0x0F360402, 0x0F370402, 0x0F380402, 0x0F390402,
+    0x0F3A0402, 0x0F3B0402, 0x0F3C0402, 0x0F3D0402, 0x0F3E0402, 0x0F3F0402, 0x0F400402, 0x0F410402,
+    0x0F420402, 0x0F430402, 0x0F440402, 0x0F450402, 0x0F460402, 0x0F470402, 0x0F480402, 0x0F490402,
+    0x0F4A0402, 0x0F4B0402, 0x0F4C0402, 0x0F4D0402, 0x0F4E0402, 0x0F4F0402, 0x0F500402, 0x0F510402,
+    0x0F520402, 0x0F530402, 0x0F540402, 0x0F550402, 0x0F560402, 0x0F570402, 0x0F580402, 0x0F590402,
+    0x0F5A0402, 0x0F5B0402, 0x0F5C0402, 0x0F5D0402, 0x0F5E0402, 0x0F5F0402, 0x0F600402, 0x0F610402,
+    0x0F620402, 0x0F630402, 0x0F640402, 0x0F650402, 0x0F660402, 0x0F670402, 0x0F680402, 0x0F690402,
+    0x0F6A0402, 0x0F6B0402, 0x0F6C0402, 0x0F6D0402, 0x0F6E0402, 0x0F6F0402, 0x0F700402, 0x0F710402,
+    0x0F720402, 0x0F730402, 0x0F740402, 0x0F750402, 0x0F760402, 0x0F770402, 0x0F780402, 0x0F790402,
+    0x0F7A0402, 0x0F7B0402, 0x0F7C0402, 0x0F7D0402, 0x0F7E0402, 0x0F7F0402, 0x0F800402, 0x0F810402,
+    0x0F820402, 0x0F830402, 0x0F840402, 0x0F850402, 0x0F860402, 0x0F870402, 0x0F880402, 0x0F890402,
+    0x0F8A0402, 0x0F8B0402, 0x0F8C0402, 0x0F8D0402, 0x0F8E0402, 0x0F8F0402, 0x0F900402, 0x0F910402,
+    0x0F920402, 0x0F930402, 0x0F940402, 0x0F950402, 0x0F960402, 0x0F970402, 0x0F980402, 0x0F990402,
+    0x0F9A0402, 0x0F9B0402, 0x0F9C0402, 0x0F9D0402, 0x0F9E0402, 0x0F9F0402, 0x0FA00402, 0x0FA10402,
+    0x0FA20402, 0x0FA30402, 0x0FA40402, 0x0FA50402, 0x0FA60402, 0x0FA70402, 0x0FA80402, 0x0FA90402,
+    0x0FAA0402, 0x0FAB0402, 0x0FAC0402, 0x0FAD0402, 0x0FAE0402, 0x0FAF0402, 0x0FB00402, 0x0FB10402,
+    0x0FB20402, 0x0FB30402, 0x0FB40402, 0x0FB50402, 0x0FB60402, 0x0FB70402, 0x0FB80402, 0x0FB90402,
+    0x0FBA0402, 0x0FBB0402, 0x0FBC0402, 0x0FBD0402, 0x0FBE0402, 0x0FBF0402, 0x0FC00402, 0x0FC10402,
+    0x0FC20402, 0x0FC30402, 0x0FC40402, 0x0FC50402, 0x0FC60402, 0x0FC70402, 0x0FC80402, 0x0FC90402,
+    0x0FCA0402, 0x0FCB0402, 0x0FCC0402, 0x0FCD0402, 0x0FCE0402, 0x0FCF0402, 0x0FD00402, 0x0FD10402,
+    0x0FD20402, 0x0FD30402, 0x0FD40402, 0x0FD50402, 0x0FD60402, 0x0FD70402, 0x0FD80402, 0x0FD90402,
+    0x0FDA0402, 0x0FDB0402, 0x0FDC0402, 0x0FDD0402, 0x0FDE0402, 0x0FDF0402, 0x0FE00402, 0x0FE10402,
+    0x0FE20402, 0x0FE30402, 0x0FE40402, 0x0FE50402, 0x0FE60402, 0x0FE70402, 0x0C060402, 0x0C070402,
+    0x0C080402, 0x0C090402, 0x0C0A0402, 0x0C0B0402, 0x0C0C0402, 0x0C0D0402, 0x0C0E0402, 0x0C0F0402,
+    0x0C100402, 0x0C110402, 0x0C120402, 0x0C130402, 0x0C140402, 0x0C150402, 0x0C160402, 0x0C170402,
+    0x0C180402, 0x0C190402, 0x0C1A0402, 0x0C1B0402, 0x0C1C0402, 0x0C1D0402, 0x0C1E0402, 0x0C1F0402,
+    0x0C200402, 0x0C210402, 0x0C220402, 0x0C230402, 0x0C240402, 0x0C250402, 0x0C260402, 0x0C270402,
+    0x0C280402, 0x0C290402, 0x0C2A0402, 0x0C2B0402, 0x0C2C0402, 0x0C2D0402, 0x0C2E0402, 0x0C2F0402,
+    0x0C300402, 0x0C310402, 0x0C320402, 0x0C330402, 0x0C340402, 0x0C350402, 0x0C360402, 0x0C370402,
+    0x0C380402, 0x0C390402, 0x0C3A0402, 0x0C3B0402, 0x0C3C0402, 0x0C3D0402, 0x0C3E0402, 0x0C3F0402,
+    0x0C400402, 0x0C410402, 0x0C420402, 0x0C430402, 0x0C440402, 0x0C450402, 0x0C460402, 0x0C470402,
+    0x0C480402, 0x0C490402, 0x0C4A0402, 0x0C4B0402, 0x0C4C0402, 0x0C4D0402, 0x0C4E0402, 0x0C4F0402,
+    0x0C500402, 0x0C510402, 0x0C520402, 0x0C530402, 0x0C540402, 0x0C550402, 0x0C560402, 0x0C570402,
+    0x0C580402, 0x0C590402, 0x0C5A0402, 0x0C5B0402, 0x0C5C0402, 0x0C5D0402, 0x0C5E0402, 0x0C5F0402,
+    0x0C600402, 0x0C610402, 0x0C620402, 0x0C630402, 0x0C640402, 0x0C650402, 0x0C660402, 0x0C670402,
+    0x0C680402, 0x0C690402, 0x0C6A0402, 0x0C6B0402, 0x0C6C0402, 0x0C6D0402, 0x0C6E0402, 0x0C6F0402,
+    0x0C700402, 0x0C710402, 0x0C720402, 0x0C730402, 0x0C740402, 0x0C750402, 0x0C760402, 0x0C770402,
+    0x0C780402, 0x0C790402, 0x0C7A0402, 0x0C7B0402, 0x0C7C0402, 0x0C7D0402, 0x0C7E0402, 0x0C7F0402,
+    0x0C800402, 0x0C810402, 0x0C820402, 0x0C830402, 0x0C840402, 0x0C850402, 0x0C860402, 0x0C870402,
+    0x0C880402, 0x033C0402, 0x033D0402, 0x033E0402, 0x033F0402, 0x03400402, 0x03410402, 0x03420402,
+    0x03430402, 0x03440402, 0x03450402, 0x03460402, 0x03470402, 0x03480402, 0x03490402, 0x034A0402,
+    0x034B0402, 0x034C0402, 0x034D0402, 0x034E0402, 0x034F0402, 0x03500402, 0x03510402, 0x0C890402,
+    0x0C8A0402, 0x0C8B0402, 0x0C8C0402, 0x0C8D0402, 0x0C8E0402, 0x0C8F0402, 0x0C900402, 0x0C910402,
+    0x0C920402, 0x0C930402, 0x0C940402, 0x0C950402, 0x0C960402, 0x0C970402, 0x0C980402, 0x0C990402,
+    0x0C9A0402, 0x0C9B0402, 0x0C9C0402, 0x0C9D0402, 0x0C9E0402, 0x0C9F0402, 0x0CA00402, 0x0CA10402,
+    0x0CA20402, 0x0CA30402, 0x0CA40402, 0x0CA50402, 0x0CA60402, 0x0CA70402, 0x0CA80402, 0x0CA90402,
+    0x0CAA0402, 0x0CAB0402, 0x0CAC0402, 0x0CAD0402, 0x0CAE0402, 0x0CAF0402, 0x0CB00402, 0x0CB10402,
+    0x0CB20402, 0x0CB30402, 0x0CB40402, 0x0CB50402, 0x0CB60402, 0x0CB70402, 0x0CB80402, 0x0CB90402,
+    0x0CBA0402, 0x0CBB0402, 0x0CBC0402, 0x0CBD0402, 0x0CBE0402, 0x0CBF0402, 0x0CC00402, 0x0CC10402,
+    0x0CC20402, 0x0CC30402, 0x0CC40402, 0x0CC50402, 0x0CC60402, 0x0CC70402, 0x03960402, 0x03970402,
+    0x03980402, 0x03990402, 0x0CC80402, 0x0CC90402, 0x0CCA0402, 0x0CCB0402, 0x0CCC0402, 0x0CCD0402,
+    0x0CCE0402, 0x0CCF0402, 0x0CD00402, 0x0CD10402, 0x0CD20402, 0x0CD30402, 0x0CD40402, 0x0CD50402,
+    0x0CD60402, 0x0CD70402, 0x0CD80402, 0x0CD90402, 0x0CDA0402, 0x0CDB0402, 0x0CDC0402, 0x0CDD0402,
+    0x0CDE0402, 0x0CDF0402, 0x0CE00402, 0x0CE10402, 0x0CE20402, 0x0CE30402, 0x0CE40402, 0x0CE50402,
+    0x0CE60402, 0x0CE70402, 0x033A0402, 0x033B0402, 0x0CE80402, 0x0CE90402, 0x0CEA0402, 0x0CEB0402,
+    0x0CEC0402, 0x0CED0402, 0x0CEE0402, 0x0CEF0402, 0x0CF00402, 0x0CF10402, 0x0CF20402, 0x0CF30402,
+    0x0CF40402, 0x0CF50402, 0x068C0404, 0x068C0404, 0x068C0404, 0x068C0404, 0x0CF60402, 0x0CF70402,
+    0x0CF80402, 0x0CF90402, 0x0CFA0402, 0x0CFB0402, 0x0CFC0402, 0x0CFD0402, 0x0CFE0402, 0x0CFF0402,
+    0x0D000402, 0x0D010402, 0x0D020402, 0x0D030402, 0x0D040402, 0x0D050402, 0x0D060402, 0x0D070402,
+    0x0D080402, 0x0D090402, 0x0D0A0402, 0x0D0B0402, 0x0D0C0402, 0x0D0D0402, 0x0D0E0402, 0x0D0F0402,
+    0x0D100402, 0x0D110402, 0x0D120402, 0x0D130402, 0x0D140402, 0x0D150402, 0x0D160402, 0x0D170402,
+    0x0D180402, 0x0D190402, 0x0D1A0402, 0x0D1B0402, 0x0D1C0402, 0x0D1D0402, 0x0D1E0402, 0x0D1F0402,
+    0x0D200402, 0x0D210402, 0x0D220402, 0x0D230402, 0x0D240402, 0x0D250402, 0x0D260402, 0x0D270402,
+    0x0D280402, 0x0D290402, 0x0D2A0402, 0x0D2B0402, 0x0D2C0402, 0x0D2D0402, 0x0D2E0402, 0x0D2F0402,
+    0x0D300402, 0x0D310402, 0x0D320402, 0x0D330402, 0x0D340402, 0x0D350402, 0x0D360402, 0x0D370402,
+    0x0D380402, 0x0D390402, 0x0D3A0402, 0x0D3B0402, 0x0D3C0402, 0x0D3D0402, 0x0D3E0402, 0x0D3F0402,
+    0x0D400402, 0x0D410402, 0x0D420402, 0x0D430402, 0x0D440402, 0x0D450402, 0x0D460402, 0x0D470402,
+    0x0D480402, 0x0D490402, 0x0D4A0402, 0x0D4B0402, 0x0D4C0402, 0x0D4D0402, 0x0D4E0402, 0x0D4F0402,
+    0x0D500402, 0x0D510402, 0x0D520402, 0x0D530402, 0x0D540402, 0x0D550402, 0x0D560402, 0x0D570402,
+    0x0D580402, 0x0D590402, 0x0D5A0402, 0x0D5B0402, 0x0D5C0402, 0x02400404, 0x02400404, 0x066B0404,
+    0x066B0404, 0x066B0404, 0x066B0404, 0x066B0404, 0x066B0404, 0x0D5D0402, 0x0D5E0402, 0x0D5F0402,
+    0x0D600402, 0x0D610402, 0x0D620402, 0x0D630402, 0x0D640402, 0x0D650402, 0x0D660402, 0x0D670402,
+    0x0D680402, 0x0D690402, 0x0D6A0402, 0x0D6B0402, 0x0D6C0402, 0x0D6D0402, 0x0D6E0402, 0x0D6F0402,
+    0x0D700402, 0x0D710402, 0x0D720402, 0x0D730402, 0x0D740402, 0x0D750402, 0x0D760402, 0x0D770402,
+    0x0D780402, 0x0D790402, 0x0D7A0402, 0x0D7B0402, 0x0D7C0402, 0x0D7D0402, 0x0D7E0402, 0x0D7F0402,
+    0x0D800402, 0x0D810402, 0x0D820402, 0x0D830402, 0x0D840402, 0x0D850402, 0x0D860402, 0x0D870402,
+    0x0D880402, 0x0D890402, 0x0D8A0402, 0x0D8B0402, 0x0D8C0402, 0x0D8D0402, 0x0D8E0402, 0x0D8F0402,
+    0x0D900402, 0x0D910402, 0x0D920402, 0x0D930402, 0x0D940402, 0x0D950402, 0x0D960402, 0x0D970402,
+    0x0D980402, 0x0D990402, 0x0D9A0402, 0x0D9B0402, 0x0D9C0402, 0x0D9D0402, 0x0D9E0402, 0x0D9F0402,
+    0x0DA00402, 0x0DA10402, 0x0DA20402, 0x0DA30402, 0x0DA40402, 0x0DA50402, 0x0DA60402, 0x0DA70402,
+    0x0DA80402, 0x0DA90402, 0x0DAA0402, 0x0DAB0402, 0x0DAC0402, 0x0DAD0402, 0x0DAE0402, 0x0DAF0402,
+    0x0DB00402, 0x0DB10402, 0x0DB20402, 0x0DB30402, 0x0DB40402, 0x0DB50402, 0x0DB60402, 0x0DB70402,
+    0x0DB80402, 0x0DB90402, 0x0DBA0402, 0x0DBB0402, 0x0DBC0402, 0x0DBD0402, 0x0DBE0402, 0x0DBF0402,
+    0x0DC00402, 0x0DC10402, 0x0DC20402, 0x000005E2, 0x0DC20402, 0x0DC30402, 0x0DC40402, 0x0DC50402,
+    0x0DC60402, 0x0DC70402, 0x0DC80402, 0x0DC90402, 0x0DCA0402, 0x0DCB0402, 0x0DCC0402, 0x0DCD0402,
+    0x0DCE0402, 0x0DCF0402, 0x0DD00402, 0x0DD10402, 0x0DD20402, 0x0DD30402, 0x0DD40402, 0x0DD50402,
+    0x0DD60402, 0x0DD70402, 0x0DD80402, 0x0DD90402, 0x0DDA0402, 0x0DDB0402, 0x0DDC0402, 0x0DDD0402,
+    0x0DDE0402, 0x0DDF0402, 0x0DE00402, 0x0DE10402, 0x0DE20402, 0x0DE30402, 0x0DE40402, 0x0DE50402,
+    0x0DE60402, 0x0DE70402, 0x0DE80402, 0x0DE90402, 0x0DEA0402, 0x0DEB0402, 0x0DEC0402, 0x0DED0402,
+    0x0DEE0402, 0x0DEF0402, 0x0DF00402, 0x0DF10402, 0x0DF20402, 0x0DF30402, 0x0DF40402, 0x0DF50402,
+    0x0DF60402, 0x0DF70402, 0x0DF80402, 0x0DF90402, 0x0DFA0402, 0x0DFB0402, 0x0DFC0402, 0x0DFD0402,
+    0x0DFE0402, 0x0DFF0402, 0x0E000402, 0x0E010402, 0x0E020402, 0x0E030402, 0x0E040402, 0x0E050402,
+    0x0E060402, 0x0E070402, 0x0E080402, 0x0E090402, 0x0E0A0402, 0x0E0B0402, 0x0E0C0402, 0x0E0D0402,
+    0x0E0E0402, 0x0E0F0402, 0x0E100402, 0x0E110402, 0x0E120402, 0x0E130402, 0x0E140402, 0x0E150402,
+    0x0E160402, 0x0E170402, 0x0E180402, 0x0E190402, 0x0E1A0402, 0x0E1B0402, 0x0E1C0402, 0x0E1D0402,
+    0x0E1E0402, 0x0E1F0402, 0x0E200402, 0x0E210402, 0x0E220402, 0x0E230402, 0x0E240402, 0x0E250402,
+    0x0E260402, 0x0E270402, 0x0E280402, 0x0E290402, 0x0E2A0402, 0x0E2B0402, 0x0E2C0402, 0x0E2D0402,
+    0x0E2E0402, 0x0E2F0402, 0x0E300402, 0x0E310402, 0x0E320402, 0x0E330402, 0x0E340402, 0x0E350402,
+    0x0E360402, 0x0E370402, 0x0E380402, 0x0E390402, 0x0E3A0402, 0x0E3B0402, 0x0E3C0402, 0x0E3D0402,
+    0x0E3E0402, 0x0E3F0402, 0x0E400402, 0x0E410402, 0x0E420402, 0x0E430402, 0x0E440402, 0x0E450402,
+    0x0E460402, 0x0E470402, 0x0E480402, 0x0E490402, 0x0E4A0402, 0x0E4B0402, 0x0E4C0402, 0x0E4D0402,
+    0x0E4E0402, 0x0E4F0402, 0x0E500402, 0x0E510402, 0x0E520402, 0x0E530402, 0x0E540402, 0x0E550402,
+    0x0E560402, 0x0E570402, 0x0E580402, 0x0E590402, 0x0E5A0402, 0x0E5B0402, 0x0E5C0402, 0x0E5D0402,
+    0x0E5E0402, 0x0E5F0402, 0x0E600402, 0x0E610402, 0x0E620402, 0x0E630402, 0x0E640402, 0x0E650402,
+    0x0E660402, 0x0E670402, 0x0E680402, 0x0E690402, 0x0E6A0402, 0x0E6B0402, 0x0E6C0402, 0x0E6D0402,
+    0x0E6E0402, 0x0E6F0402, 0x0E700402, 0x0E710402, 0x0E720402, 0x0E730402, 0x0E740402, 0x0E750402,
+    0x0E760402, 0x0E770402, 0x0E780402, 0x0E790402, 0x0E7A0402, 0x0E7B0402, 0x0E7C0402, 0x0E7D0402,
+    0x0E7E0402, 0x0E7F0402, 0x0E800402, 0x0E810402, 0x0E820402, 0x0E830402, 0x0E840402, 0x0E850402,
+    0x0E860402, 0x0E870402, 0x0E880402, 0x0E890402, 0x0E8A0402, 0x0E8B0402, 0x0E8C0402, 0x0E8D0402,
+    0x0E8E0402, 0x0E8F0402, 0x0E900402, 0x0E910402, 0x0E920402, 0x0E930402, 0x0E940402, 0x0E950402,
+    0x0E960402, 0x0E970402, 0x0E980402, 0x0E990402, 0x0E9A0402, 0x0E9B0402, 0x0E9C0402, 0x0E9D0402,
+    0x0E9E0402, 0x0E9F0402, 0x0EA00402, 0x0EA10402, 0x0EA20402, 0x0EA30402, 0x0EA40402, 0x0EA50402,
+    0x0EA60402, 0x0EA70402, 0x0EA80402, 0x0EA90402, 0x0EAA0402, 0x0EAB0402, 0x0EAC0402, 0x0EAD0402,
+    0x0EAE0402, 0x0EAF0402, 0x0EB00402, 0x0EB10402, 0x0EB20402, 0x0EB30402, 0x0EB40402, 0x0EB50402,
+    0x0EB60402, 0x0EB70402, 0x0EB80402, 0x0EB90402, 0x0EBA0402, 0x0EBB0402, 0x0EBC0402, 0x0EBD0402,
+    0x0EBE0402, 0x0EBF0402, 0x0EC00402, 0x0EC10402, 0x0EC20402, 0x0EC30402, 0x0EC40402, 0x0EC50402,
+    0x0EC60402, 0x0EC70402, 0x0EC80402, 0x0EC90402, 0x0ECA0402, 0x0ECB0402, 0x0ECC0402, 0x0ECD0402,
+    0x0ECE0402, 0x0ECF0402, 0x0ED00402, 0x0ED10402, 0x0ED20402, 0x0ED30402, 0x0ED40402, 0x0ED50402,
+    0x0ED60402, 0x0ED70402, 0x0ED80402, 0x0ED90402, 0x0EDA0402, 0x0EDB0402, 0x0EDC0402, 0x0EDD0402,
+    0x0EDE0402, 0x0EDF0402, 0x0EE00402, 0x0EE10402, 0x254A0408, 0x254B0408, 0x254C0408, 0x254D0408,
+    0x254E0408, 0x254F0408, 0x25500408, 0x25510408, 0x25520408, 0x25530408, 0x25540408, 0x25550408,
+    0x25560408, 0x25570408, 0x25580408, 0x25590408, 0x255A0408, 0x255B0408, 0x255C0408, 0x255D0408,
+    0x255E0408, 0x255F0408, 0x25600408, 0x25610408, 0x25620408, 0x25630408, 0x25640408, 0x25650408,
+    0x25660408, 0x25670408, 0x25680408, 0x25690408, 0x256A0408, 0x256B0408, 0x256C0408, 0x256D0408,
+    0x256E0408, 0x256F0408, 0x25700408, 0x25710408, 0x25720408, 0x25730408, 0x25740408, 0x25750408,
+    0x25760408, 0x25770408, 0x25780408, 0x254A0402, 0x254B0402, 0x254C0402, 0x254D0402, 0x254E0402,
+    0x254F0402, 0x25500402, 0x25510402, 0x25520402, 0x25530402, 0x25540402, 0x25550402, 0x25560402,
+    0x25570402, 0x25580402, 0x25590402, 0x255A0402, 0x255B0402, 0x255C0402, 0x255D0402, 0x255E0402,
+    0x255F0402, 0x25600402, 0x25610402, 0x25620402, 0x25630402, 0x25640402, 0x25650402, 0x25660402,
+    0x25670402, 0x25680402, 0x25690402, 0x256A0402, 0x256B0402, 0x256C0402, 0x256D0402, 0x256E0402,
+    0x256F0402, 0x25700402, 0x25710402, 0x25720402, 0x25730402, 0x25740402, 0x25750402, 0x25760402,
+    0x25770402, 0x25780402, 0x20E50408, 0x20E50402, 0x20E60408, 0x21700408, 0x21B70408, 0x1FA70402,
+    0x22000402, 0x20860408, 0x20860402, 0x20CE0408, 0x20CE0402, 0x22A10408, 0x22A10402, 0x1FB10408,
+    0x21100408, 0x1FAD0408, 0x1FB70408, 0x22520402, 0x225F0408, 0x225F0402, 0x22530402, 0x20870408,
+    0x20870402, 0x217F0402, 0x20140402, 0x21B20402, 0x215B0402, 0x20190402, 0x20AB0415, 0x2247041D,
+    0x21DE0408, 0x229D0408, 0x234B0408, 0x234B0402, 0x234C0408, 0x234C0402, 0x234D0408, 0x234D0402,
+    0x234E0408, 0x234E0402, 0x234F0408, 0x234F0402, 0x23510408, 0x23510402, 0x23520408, 0x23520402,
+    0x23530408, 0x23530402, 0x23540408, 0x23540402, 0x23550408, 0x23550402, 0x23560408, 0x23560402,
+    0x23580408, 0x23580402, 0x23590408, 0x23590402, 0x235A0408, 0x235A0402, 0x235D0408, 0x235D0402,
+    0x235E0408, 0x235E0402, 0x235F0408, 0x235F0402, 0x23600408, 0x23600402, 0x23610408, 0x23610402,
+    0x23620408, 0x23620402, 0x23630408, 0x23630402, 0x23640408, 0x23640402, 0x23650408, 0x23650402,
+    0x23660408, 0x23660402, 0x23670408, 0x23670402, 0x23820408, 0x23820402, 0x23830408, 0x23830402,
+    0x23500408, 0x23500402, 0x23570408, 0x23570402, 0x235B0408, 0x235B0402, 0x235C0408, 0x235C0402,
+    0x23680408, 0x23680402, 0x23690408, 0x23690402, 0x236C0408, 0x236C0402, 0x236D0408, 0x236D0402,
+    0x236E0408, 0x236E0402, 0x23720408, 0x23720402, 0x23740408, 0x23740402, 0x23750408, 0x23750402,
+    0x23760408, 0x23760402, 0x23770408, 0x23770402, 0x23780408, 0x23780402, 0x23790408, 0x23790402,
+    0x237C0408, 0x237C0402, 0x237E0408, 0x237E0402, 0x237F0408, 0x237F0402, 0x23800408, 0x23800402,
+    0x23840408, 0x23840402, 0x23850408, 0x23850402, 0x23860408, 0x23860402, 0x23560404, 0x234B0404,
+    0x23550404, 0x0EE20402, 0x0EE30402, 0x0EE40402, 0x0EE50402, 0x0EE60402, 0x0EE70402, 0x236B0408,
+    0x236B0402, 0x237B0408, 0x237B0402, 0x23710408, 0x23710402, 0x02880402, 0x02750402, 0x02760402,
+    0x03070402, 0x1DB70402, 0x02890402, 0x03080402, 0x25A00402, 0x25A20402, 0x25A40402, 0x25A60402,
+    0x25A80402, 0x25AA0402, 0x25AC0402, 0x25B00402, 0x25B20402, 0x25B40402, 0x25B60402, 0x25B80402,
+    0x25BA0402, 0x25BE0402, 0x25C00402, 0x25C20402, 0x25C40402, 0x25C60402, 0x25C80402, 0x25CC0402,
+    0x25CE0402, 0x25D00402, 0x25D20402, 0x25D40402, 0x25D60402, 0x25D80402, 0x25DA0402, 0x25DC0402,
+    0x25DE0402, 0x25E00402, 0x25E20402, 0x25E60402, 0x25E80402, 0x25AE0402, 0x25BC0402, 0x25CA0402,
+    0x25E40402, 0x25EA0402, 0x25ED0402, 0x25F20402, 0x27D90402, 0x27DA0402, 0x27DB0402, 0x27DC0402,
+    0x27DD0402, 0x27DE0402, 0x27DF0402, 0x27E00402, 0x27E10402, 0x27E20402, 0x27E30402, 0x27E40402,
+    0x27E60402, 0x27E70402, 0x27E80402, 0x27E90402, 0x27EA0402, 0x27EB0402, 0x27EC0402, 0x27ED0402,
+    0x27EE0402, 0x27EF0402, 0x27F00402, 0x27F10402, 0x27F20402, 0x27F30402, 0x27F40402, 0x27F50402,
+    0x27F60402, 0x27F70402, 0x27F80402, 0x27F90402, 0x27FA0402, 0x27FB0402, 0x27FC0402, 0x27FD0402,
+    0x27FF0402, 0x28000402, 0x28010402, 0x28020402, 0x28030402, 0x28040402, 0x28050402, 0x28060402,
+    0x28070402, 0x28080402, 0x28090402, 0x280A0402, 0x280B0402, 0x280C0402, 0x280D0402, 0x280E0402,
+    0x280F0402, 0x28100402, 0x27E50402, 0x27FE0402, 0x28110402, 0x04530402, 0x28220402, 0x28370402,
+    0x28480402, 0x28510402, 0x28600402, 0x28860402, 0x28970402, 0x28A00402, 0x28B60402, 0x28BF0402,
+    0x28C80402, 0x28F90402, 0x29180402, 0x29270402, 0x29300402, 0x29520402, 0x295B0402, 0x296B0402,
+    0x299B0402, 0x29460402, 0x29470402, 0x29480402, 0x29490402, 0x299F0402, 0x29A00402, 0x29A10402,
+    0x29A20402, 0x29A30402, 0x29A40402, 0x29A50402, 0x29A60402, 0x29A70402, 0x29A80402, 0x29A90402,
+    0x29AA0402, 0x29AB0402, 0x29AC0402, 0x29AD0402, 0x29AE0402, 0x29AF0402, 0x29B00402, 0x29B10402,
+    0x29B20402, 0x29B30402, 0x29B40402, 0x29B50402, 0x29B60402, 0x29B70402, 0x29B80402, 0x29B90402,
+    0x29BA0402, 0x29BB0402, 0x29BC0402, 0x29BD0402, 0x29BE0402, 0x29BF0402, 0x29C00402, 0x29C10402,
+    0x29C20402, 0x29C30402, 0x29C40402, 0x29C50402, 0x29C60402, 0x29C70402, 0x29C80402, 0x29C90402,
+    0x29CA0402, 0x29CB0402, 0x29CC0402, 0x29CD0402, 0x29CE0402, 0x29CF0402, 0x29D00402, 0x29D10402,
+    0x29D20402, 0x29D30402, 0x29D40402, 0x29D50402, 0x29D60402, 0x23930404, 0x239B0404, 0x23C70404,
+    0x23D10404, 0x23FB0404, 0x24150404, 0x24280404, 0x24310404, 0x24540404, 0x24610404, 0x24970404,
+    0x24BE0404, 0x24C90404, 0x24E80404, 0x24ED0404, 0x25380404, 0x246A0404, 0x24730404, 0x23870404,
+    0x23BF0404, 0x23FA0404, 0x250E0404, 0x25130404, 0x251D0404, 0x25220404, 0x252C0404, 0x03CB0402,
+    0x03CC0402, 0x036C0402, 0x036D0402, 0x036E0402, 0x036F0402, 0x03CD0402, 0x03CE0402, 0x03CF0402,
+    0x03700402, 0x03710402, 0x03D00402, 0x03720402, 0x03730402, 0x03D10402, 0x03D20402, 0x03D30402,
+    0x03D40402, 0x03D50402, 0x03D60402, 0x03D70402, 0x03D80402, 0x03D90402, 0x021C0402, 0x027D0402,
+    0x03090402, 0x03DA0402, 0x03DB0402, 0x03740402, 0x03750402, 0x03DC0402, 0x03DD0402, 0x03760402,
+    0x03770402, 0x03780402, 0x03790402, 0x037A0402, 0x037B0402, 0x037C0402, 0x037D0402, 0x037E0402,
+    0x037F0402, 0x03020402, 0x03030402, 0x03040402, 0x03050402, 0x026F0402, 0x24F20402, 0x028A0402,
+    0x02940402, 0x02250402, 0x02950402, 0x02240402, 0x023D0402, 0x03B50402, 0x03B60402, 0x03B70402,
+    0x039B0402, 0x02180402, 0x02190402, 0x028B0402, 0x03060402, 0x03950402, 0x039F0402, 0x021D0402,
+    0x02260402, 0x03220402, 0x021B0402, 0x03DE0402, 0x03DF0402, 0x03E00402, 0x03E10402, 0x03E20402,
+    0x023F0402, 0x03A80402, 0x03B80402, 0x02270402, 0x039E0402, 0x02280402, 0x02290402, 0x0B5D0402,
+    0x0B5E0402, 0x03AB0402, 0xFB400404, 0xCE360000, 0x00002304, 0xFB400404, 0xD3820000, 0x00002304,
+    0xFB400404, 0xCE5B0000, 0xFB400404, 0xCE5A0000, 0xFB400404, 0xCE590000, 0x00002304, 0xFB400404,
+    0xCEBB0000, 0xFB400404, 0xD1820000, 0x00002304, 0xFB400404, 0xD1E00000, 0x00002304, 0xFB400404,
+    0xD2000000, 0x00002304, 0xFB400404, 0xD2020000, 0xFB400404, 0xD35C0000, 0x00002304, 0xFB400404,
+    0xD3690000, 0x00002304, 0xFB400404, 0xDC0F0000, 0x00002304, 0xFB400404, 0xDC0F0000, 0x00002324,
+    0xFB400404, 0xDC220000, 0x00002304, 0xFB400404, 0xDC230000, 0xFB400404, 0xDC220000, 0xFB400404,
+    0xDC230000, 0x00002304, 0xFB400404, 0xDDF30000, 0xFB400404, 0xDE7A0000, 0xFB400404, 0xDF510000,
+    0xFB400404, 0xDF500000, 0x00002304, 0xFB400404, 0xDFC40000, 0xFB400404, 0xDFC30000, 0x00002304,
+    0xFB400404, 0xE24C0000, 0xFB400404, 0xE5350000, 0xFB400404, 0xE5E10000, 0xFB400404, 0xE5E50000,
+    0x00002304, 0xFB400404, 0xE7080000, 0x00002304, 0xFB400404, 0xEB7A0000, 0x00002304, 0xFB400404,
+    0xEBCD0000, 0xFB400404, 0xEC110000, 0xFB400404, 0xEC350000, 0xFB400404, 0xEC3A0000, 0xFB400404,
+    0xF06C0000, 0xFB400404, 0xF22B0000, 0xFB400404, 0xF22B0000, 0x00002304, 0xFB400404, 0xCE2C0000,
+    0xFB400404, 0xF25B0000, 0x00002304, 0xFB400404, 0xF2AD0000, 0xFB400404, 0xF38B0000, 0x00002304,
+    0xFB400404, 0xF58B0000, 0x00002304, 0xFB400404, 0xF6EE0000, 0x00002304, 0xFB400404, 0xF93A0000,
+    0x00002304, 0xFB400404, 0xF93B0000, 0xFB400404, 0xFAF90000, 0x00002304, 0xFB400404, 0xFCF90000,
+    0xFB400404, 0xFE9F0000, 0xFB400404, 0xFF530000, 0xFB400404, 0xFF520000, 0xFB400404, 0xFF530000,
+    0x00002304, 0xFB400404, 0xFF530000, 0x00002324, 0xFB400404, 0xFF520000, 0x00002304, 0xFB400404,
+    0xFF8A0000, 0x00002304, 0xFB400404, 0xFF8A0000, 0x00002324, 0xFB400404, 0xFF8B0000, 0xFB410404,
+    0x80020000, 0xFB410404, 0x80800000, 0xFB410404, 0x807F0000, 0x00002304, 0xFB410404, 0x80890000,
+    0x00002304, 0xFB410404, 0x81FC0000, 0x00002304, 0xFB410404, 0x82790000, 0xFB410404, 0x82790000,
+    0x00002304, 0xFB410404, 0x82790000, 0x00002324, 0xFB410404, 0x864E0000, 0xFB410404, 0x88640000,
+    0xFB410404, 0x89800000, 0xFB410404, 0x897F0000, 0xFB410404, 0x89C10000, 0xFB410404, 0x89D20000,
+    0xFB410404, 0x89D20000, 0x00002304, 0xFB410404, 0x8BA00000, 0xFB410404, 0x8D1D0000, 0xFB410404,
+    0x8DB30000, 0x00002304, 0xFB410404, 0x8F660000, 0xFB410404, 0x8FB60000, 0xFB410404, 0x8FB60000,
+    0x00002304, 0xFB410404, 0x8FB60000, 0x00002324, 0xFB410404, 0x90910000, 0x00002304, 0xFB410404,
+    0x94850000, 0xFB410404, 0x95770000, 0xFB410404, 0x95780000, 0xFB410404, 0x957F0000, 0xFB410404,
+    0x95E80000, 0xFB410404, 0x961C0000, 0x00002304, 0xFB410404, 0x961D0000, 0xFB410404, 0x96E80000,
+    0x00002304, 0xFB410404, 0x97520000, 0xFB410404, 0x97E60000, 0xFB410404, 0x98750000, 0xFB410404,
+    0x98CE0000, 0xFB410404, 0x98DE0000, 0xFB410404, 0x98DF0000, 0xFB410404, 0x98E00000, 0x00002304,
+    0xFB410404, 0x98E00000, 0xFB410404, 0x99630000, 0xFB410404, 0x99960000, 0x00002304, 0xFB410404,
+    0x9A6C0000, 0xFB410404, 0x9AA80000, 0x00002304, 0xFB410404, 0x9B3C0000, 0x00002304, 0xFB410404,
+    0x9C7C0000, 0xFB410404, 0x9E1F0000, 0xFB410404, 0x9E750000, 0x00002304, 0xFB410404, 0x9EA60000,
+    0xFB410404, 0x9EC40000, 0xFB410404, 0x9EFE0000, 0xFB410404, 0x9F4A0000, 0x00002304, 0xFB410404,
+    0x9F500000, 0xFB410404, 0x9F520000, 0x00002304, 0xFB410404, 0x9F7F0000, 0xFB410404, 0x9F8D0000,
+    0x00002304, 0xFB410404, 0x9F990000, 0xFB410404, 0x9F9C0000, 0x00002304, 0xFB410404, 0x9F9C0000,
+    0x00002324, 0xFB410404, 0x9F9F0000, 0xFB400404, 0xCE000000, 0xFB400404, 0xCE280000, 0xFB400404,
+    0xCE360000, 0xFB400404, 0xCE3F0000, 0xFB400404, 0xCE590000, 0xFB400404, 0xCE850000, 0xFB400404,
+    0xCE8C0000, 0xFB400404, 0xCEA00000, 0xFB400404, 0xCEBA0000, 0xFB400404, 0xD13F0000, 0xFB400404,
+    0xD1650000, 0xFB400404, 0xD16B0000, 0xFB400404, 0xD1820000, 0xFB400404, 0xD1960000, 0xFB400404,
+    0xD1AB0000, 0xFB400404, 0xD1E00000, 0xFB400404, 0xD1F50000, 0xFB400404, 0xD2000000, 0xFB400404,
+    0xD29B0000, 0xFB400404, 0xD2F90000, 0xFB400404, 0xD3150000, 0xFB400404, 0xD31A0000, 0xFB400404,
+    0xD3380000, 0xFB400404, 0xD3410000, 0xFB400404, 0xD35C0000, 0xFB400404, 0xD3690000, 0xFB400404,
+    0xD3820000, 0xFB400404, 0xD3B60000, 0xFB400404, 0xD3C80000, 0xFB400404, 0xD3E30000, 0xFB400404,
+    0xD6D70000, 0xFB400404, 0xD71F0000, 0xFB400404, 0xD8EB0000, 0xFB400404, 0xD9020000, 0xFB400404,
+    0xD90A0000, 0xFB400404, 0xD9150000, 0xFB400404, 0xD9270000, 0xFB400404, 0xD9730000, 0xFB400404,
+    0xDB500000, 0xFB400404, 0xDB800000, 0xFB400404, 0xDBF80000, 0xFB400404, 0xDC0F0000, 0xFB400404,
+    0xDC380000, 0xFB400404, 0xDC6E0000, 0xFB400404, 0xDC710000, 0xFB400404, 0xDDDB0000, 0xFB400404,
+    0xDDE50000, 0xFB400404, 0xDDF10000, 0xFB400404, 0xDDFE0000, 0xFB400404, 0xDE720000, 0xFB400404,
+    0xDE7F0000, 0xFB400404, 0xDEF40000, 0xFB400404, 0xDEFE0000, 0xFB400404, 0xDF0B0000, 0xFB400404,
+    0xDF130000, 0xFB400404, 0xDF500000, 0xFB400404, 0xDF610000, 0xFB400404, 0xDF730000, 0xFB400404,
+    0xDFC30000, 0xFB400404, 0xE2080000, 0xFB400404, 0xE2360000, 0xFB400404, 0xE24B0000, 0xFB400404,
+    0xE52F0000, 0xFB400404, 0xE5340000, 0xFB400404, 0xE5870000, 0xFB400404, 0xE5970000, 0xFB400404,
+    0xE5A40000, 0xFB400404, 0xE5B90000, 0xFB400404, 0xE5E00000, 0xFB400404, 0xE5E50000, 0xFB400404,
+    0xE6F00000, 0xFB400404, 0xE7080000, 0xFB400404, 0xE7280000, 0xFB400404, 0xEB200000, 0xFB400404,
+    0xEB620000, 0xFB400404, 0xEB790000, 0xFB400404, 0xEBB30000, 0xFB400404, 0xEBCB0000, 0xFB400404,
+    0xEBD40000, 0xFB400404, 0xEBDB0000, 0xFB400404, 0xEC0F0000, 0xFB400404, 0xEC140000, 0xFB400404,
+    0xEC340000, 0xFB400404, 0xF06B0000, 0xFB400404, 0xF22A0000, 0xFB400404, 0xF2360000, 0xFB400404,
+    0xF23B0000, 0xFB400404, 0xF23F0000, 0xFB400404, 0xF2470000, 0xFB400404, 0xF2590000, 0xFB400404,
+    0xF25B0000, 0xFB400404, 0xF2AC0000, 0xFB400404, 0xF3840000, 0xFB400404, 0xF3890000, 0xFB400404,
+    0xF4DC0000, 0xFB400404, 0xF4E60000, 0xFB400404, 0xF5180000, 0xFB400404, 0xF51F0000, 0xFB400404,
+    0xF5280000, 0xFB400404, 0xF5300000, 0xFB400404, 0xF58B0000, 0xFB400404, 0xF5920000, 0xFB400404,
+    0xF6760000, 0xFB400404, 0xF67D0000, 0xFB400404, 0xF6AE0000, 0xFB400404, 0xF6BF0000, 0xFB400404,
+    0xF6EE0000, 0xFB400404, 0xF7DB0000, 0xFB400404, 0xF7E20000, 0xFB400404, 0xF7F30000, 0xFB400404,
+    0xF93A0000, 0xFB400404, 0xF9B80000, 0xFB400404, 0xF9BE0000, 0xFB400404, 0xFA740000, 0xFB400404,
+    0xFACB0000, 0xFB400404, 0xFAF90000, 0xFB400404, 0xFC730000, 0xFB400404, 0xFCF80000, 0xFB400404,
+    0xFF360000, 0xFB400404, 0xFF510000, 0xFB400404, 0xFF8A0000, 0xFB400404, 0xFFBD0000, 0xFB410404,
+    0x80010000, 0xFB410404, 0x800C0000, 0xFB410404, 0x80120000, 0xFB410404, 0x80330000, 0xFB410404,
+    0x807F0000, 0xFB410404, 0x80890000, 0xFB410404, 0x81E30000, 0xFB410404, 0x81EA0000, 0xFB410404,
+    0x81F30000, 0xFB410404, 0x81FC0000, 0xFB410404, 0x820C0000, 0xFB410404, 0x821B0000, 0xFB410404,
+    0x821F0000, 0xFB410404, 0x826E0000, 0xFB410404, 0x82720000, 0xFB410404, 0x82780000, 0xFB410404,
+    0x864D0000, 0xFB410404, 0x866B0000, 0xFB410404, 0x88400000, 0xFB410404, 0x884C0000, 0xFB410404,
+    0x88630000, 0xFB410404, 0x897E0000, 0xFB410404, 0x898B0000, 0xFB410404, 0x8A000000, 0xFB410404,
+    0x8C370000, 0xFB410404, 0x8C460000, 0xFB410404, 0x8C550000, 0xFB410404, 0x8C780000, 0xFB410404,
+    0x8C9D0000, 0xFB410404, 0x8D640000, 0xFB410404, 0x8D700000, 0xFB410404, 0x8DB30000, 0xFB410404,
+    0x8EAB0000, 0xFB410404, 0x8ECA0000, 0xFB410404, 0x8F9B0000, 0xFB410404, 0x8FB00000, 0xFB410404,
+    0x8FB50000, 0xFB410404, 0x90910000, 0xFB410404, 0x91490000, 0xFB410404, 0x91C60000, 0xFB410404,
+    0x91CC0000, 0xFB410404, 0x91D10000, 0xFB410404, 0x95800000, 0xFB410404, 0x961C0000, 0xFB410404,
+    0x96B60000, 0xFB410404, 0x96B90000, 0xFB410404, 0x96E80000, 0xFB410404, 0x97510000, 0xFB410404,
+    0x975E0000, 0xFB410404, 0x97620000, 0xFB410404, 0x97690000, 0xFB410404, 0x97CB0000, 0xFB410404,
+    0x97ED0000, 0xFB410404, 0x97F30000, 0xFB410404, 0x98010000, 0xFB410404, 0x98A80000, 0xFB410404,
+    0x98DB0000, 0xFB410404, 0x99960000, 0xFB410404, 0x99990000, 0xFB410404, 0x99AC0000, 0xFB410404,
+    0x9AA80000, 0xFB410404, 0x9AD80000, 0xFB410404, 0x9ADF0000, 0xFB410404, 0x9B250000, 0xFB410404,
+    0x9B2F0000, 0xFB410404, 0x9B320000, 0xFB410404, 0x9B3C0000, 0xFB410404, 0x9B5A0000, 0xFB410404,
+    0x9CE50000, 0xFB410404, 0x9E750000, 0xFB410404, 0x9E7F0000, 0xFB410404, 0x9EA50000, 0xFB410404,
+    0x9EBB0000, 0xFB410404, 0x9EC30000, 0xFB410404, 0x9ECD0000, 0xFB410404, 0x9ED10000, 0xFB410404,
+    0x9EF90000, 0xFB410404, 0x9EFD0000, 0xFB410404, 0x9F0E0000, 0xFB410404, 0x9F130000, 0xFB410404,
+    0x9F200000, 0xFB410404, 0x9F3B0000, 0xFB410404, 0x9F4A0000, 0xFB410404, 0x9F520000, 0xFB410404,
+    0x9F8D0000, 0xFB410404, 0x9F9C0000, 0xFB410404, 0x9FA00000, 0x1D1B0402, 0x1D1C0402, 0x1D1D0402,
+    0x1D1E0402, 0x1D1F0402, 0x1D200402, 0x1D210402, 0x1D220402, 0x1D230402, 0x1D240402, 0x1D250402,
+    0x1D260402, 0x02090403, 0x02360402, 0x02920402, 0x03C10402, 0x1D4B0402, 0x1F570402, 0x42E60404,
+    0x42FC0404, 0x03820402, 0x03830402, 0x03840402, 0x03850402, 0x03860402, 0x03870402, 0x03880402,
+    0x03890402, 0x1D4C0402, 0x1D4D0402, 0x038A0402, 0x038B0402, 0x038C0402, 0x038D0402, 0x038E0402,
+    0x038F0402, 0x03900402, 0x03910402, 0x021E0402, 0x03230402, 0x03240402, 0x03250402, 0x1D4E0402,
+    0x00002022, 0x00002042, 0x00002062, 0x00002082, 0x000020A2, 0x000020C2, 0x021F0402, 0x1F5C0402,
+    0x1F5C0402, 0x000006E2, 0x1F5D0402, 0x1F5D0402, 0x000006E2, 0x1F5E0402, 0x1D4C0404, 0x1D4F0402,
+    0xFB400404, 0xD3440000, 0xFB400404, 0xD3450000, 0x1F580402, 0x42F90404, 0x42E70404, 0x03C20402,
+    0x1D500402, 0x1D510402, 0x42DA040D, 0x42DA040E, 0x42DB040D, 0x42DB040E, 0x42DC040D, 0x42DC040E,
+    0x42DE040D, 0x42DE040E, 0x42DF040D, 0x42DF040E, 0x42E0040E, 0x42E0040E, 0x000006E2, 0x42E1040E,
+    0x42E1040E, 0x000006E2, 0x42E2040E, 0x42E2040E, 0x000006E2, 0x42E3040E, 0x42E3040E, 0x000006E2,
+    0x42E4040E, 0x42E4040E, 0x000006E2, 0x42E5040E, 0x42E5040E, 0x000006E2, 0x42E6040E, 0x42E6040E,
+    0x000006E2, 0x42E7040E, 0x42E7040E, 0x000006E2, 0x42E8040E, 0x42E8040E, 0x000006E2, 0x42E9040E,
+    0x42E9040E, 0x000006E2, 0x42EA040E, 0x42EA040E, 0x000006E2, 0x42EB040E, 0x42EB040E, 0x000006E2,
+    0x42EC040D, 0x42EC040E, 0x42EC040E, 0x000006E2, 0x42ED040E, 0x42ED040E, 0x000006E2, 0x42EE040E,
+    0x42EE040E, 0x000006E2, 0x42EF040E, 0x42F0040E, 0x42F1040E, 0x42F2040E, 0x42F3040E, 0x42F4040E,
+    0x42F4040E, 0x000006E2, 0x42F4040E, 0x00000702, 0x42F5040E, 0x42F5040E, 0x000006E2, 0x42F5040E,
+    0x00000702, 0x42F6040E, 0x42F6040E, 0x000006E2, 0x42F6040E, 0x00000702, 0x42F7040E, 0x42F7040E,
+    0x000006E2, 0x42F7040E, 0x00000702, 0x42F8040E, 0x42F8040E, 0x000006E2, 0x42F8040E, 0x00000702,
+    0x42F9040E, 0x42FA040E, 0x42FB040E, 0x42FC040E, 0x42FD040E, 0x42FE040D, 0x42FE040E, 0x42FF040D,
+    0x42FF040E, 0x4300040D, 0x4300040E, 0x4301040E, 0x4302040E, 0x4303040E, 0x4304040E, 0x4305040E,
+    0x4306040D, 0x4306040E, 0x4307040E, 0x4308040E, 0x4309040E, 0x430A040E, 0x42DC040E, 0x000006E2,
+    0x42E0040D, 0x42E3040D, 0x000006E2, 0x00000702, 0x04C30402, 0x04C40402, 0x1F5F0402, 0x1F5F0402,
+    0x000006E2, 0x43000416, 0x43020416, 0x02200402, 0x42DA040F, 0x42DA0411, 0x42DB040F, 0x42DB0411,
+    0x42DC040F, 0x42DC0411, 0x42DE040F, 0x42DE0411, 0x42DF040F, 0x42DF0411, 0x42E00411, 0x42E00411,
+    0x000006E2, 0x42E10411, 0x42E10411, 0x000006E2, 0x42E20411, 0x42E20411, 0x000006E2, 0x42E30411,
+    0x42E30411, 0x000006E2, 0x42E40411, 0x42E40411, 0x000006E2, 0x42E50411, 0x42E50411, 0x000006E2,
+    0x42E60411, 0x42E60411, 0x000006E2, 0x42E70411, 0x42E70411, 0x000006E2, 0x42E80411, 0x42E80411,
+    0x000006E2, 0x42E90411, 0x42E90411, 0x000006E2, 0x42EA0411, 0x42EA0411, 0x000006E2, 0x42EB0411,
+    0x42EB0411, 0x000006E2, 0x42EC040F, 0x42EC0411, 0x42EC0411, 0x000006E2, 0x42ED0411, 0x42ED0411,
+    0x000006E2, 0x42EE0411, 0x42EE0411, 0x000006E2, 0x42EF0411, 0x42F00411, 0x42F10411, 0x42F20411,
+    0x42F30411, 0x42F40411, 0x42F40411, 0x000006E2, 0x42F40411, 0x00000702, 0x42F50411, 0x42F50411,
+    0x000006E2, 0x42F50411, 0x00000702, 0x42F60411, 0x42F60411, 0x000006E2, 0x42F60411, 0x00000702,
+    0x42F70411, 0x42F70411, 0x000006E2, 0x42F70411, 0x00000702, 0x42F80411, 0x42F80411, 0x000006E2,
+    0x42F80411, 0x00000702, 0x42F90411, 0x42FA0411, 0x42FB0411, 0x42FC0411, 0x42FD0411, 0x42FE040F,
+    0x42FE0411, 0x42FF040F, 0x42FF0411, 0x4300040F, 0x43000411, 0x43010411, 0x43020411, 0x43030411,
+    0x43040411, 0x43050411, 0x4306040F, 0x43060411, 0x43070411, 0x43080411, 0x43090411, 0x430A0411,
+    0x42DC0411, 0x000006E2, 0x42E0040F, 0x42E3040F, 0x43060411, 0x000006E2, 0x43070411, 0x000006E2,
+    0x43080411, 0x000006E2, 0x43090411, 0x000006E2, 0x02210402, 0x1F600402, 0x1F610402, 0x1F610402,
+    0x000006E2, 0x42E40416, 0x42EE0416, 0x44290402, 0x442A0402, 0x442B0402, 0x442D0402, 0x442F0402,
+    0x44300402, 0x44310402, 0x44330402, 0x44340402, 0x44350402, 0x44380402, 0x44390402, 0x443A0402,
+    0x443B0402, 0x443F0402, 0x44400402, 0x44410402, 0x44420402, 0x44430402, 0x44440402, 0x44450402,
+    0x44490402, 0x444A0402, 0x444C0402, 0x444D0402, 0x444F0402, 0x44500402, 0x44510402, 0x44520402,
+    0x44530402, 0x44540402, 0x44550402, 0x44570402, 0x445A0402, 0x445B0402, 0x445C0402, 0x445D0402,
+    0x442E0402, 0x44360402, 0x443C0402, 0x445E0402, 0x444C0404, 0x44320402, 0x41750404, 0x41760404,
+    0x42530404, 0x41770404, 0x42550404, 0x42560404, 0x41780404, 0x41790404, 0x417A0404, 0x42590404,
+    0x425A0404, 0x425B0404, 0x425C0404, 0x425D0404, 0x425E0404, 0x418F0404, 0x417B0404, 0x417C0404,
+    0x417D0404, 0x41960404, 0x417E0404, 0x417F0404, 0x41800404, 0x41810404, 0x41820404, 0x41830404,
+    0x41840404, 0x41850404, 0x41860404, 0x41870404, 0x41F30404, 0x41F40404, 0x41F50404, 0x41F60404,
+    0x41F70404, 0x41F80404, 0x41F90404, 0x41FA0404, 0x41FB0404, 0x41FC0404, 0x41FD0404, 0x41FE0404,
+    0x41FF0404, 0x42000404, 0x42010404, 0x42020404, 0x42030404, 0x42040404, 0x42050404, 0x42060404,
+    0x42070404, 0x41F20404, 0x41890404, 0x418A0404, 0x42700404, 0x42710404, 0x42750404, 0x42770404,
+    0x427C0404, 0x42800404, 0x42820404, 0x41910404, 0x42860404, 0x42880404, 0x41920404, 0x41930404,
+    0x41950404, 0x41970404, 0x41980404, 0x419C0404, 0x419E0404, 0x41A00404, 0x41A10404, 0x41A20404,
+    0x41A30404, 0x41A40404, 0x41A70404, 0x41AB0404, 0x41B50404, 0x41BC0404, 0x41C10404, 0x429A0404,
+    0x429B0404, 0x41CC0404, 0x41CD0404, 0x41CE0404, 0x42160404, 0x42170404, 0x421A0404, 0x42230404,
+    0x42240404, 0x42260404, 0x42300404, 0x42330404, 0x1D520402, 0x1D530402, 0xFB400414, 0xCE000000,
+    0xFB400414, 0xCE8C0000, 0xFB400414, 0xCE090000, 0xFB400414, 0xD6DB0000, 0xFB400414, 0xCE0A0000,
+    0xFB400414, 0xCE2D0000, 0xFB400414, 0xCE0B0000, 0xFB400414, 0xF5320000, 0xFB400414, 0xCE590000,
+    0xFB400414, 0xCE190000, 0xFB400414, 0xCE010000, 0xFB400414, 0xD9290000, 0xFB400414, 0xD7300000,
+    0xFB400414, 0xCEBA0000, 0x44290404, 0x00002324, 0x44430404, 0x00002324, 0x44390404, 0x00002324,
+    0x44340404, 0x00002324, 0x444E0402, 0x444E0404, 0x00002324, 0x444B0402, 0x444A0404, 0x00002324,
+    0x445C0404, 0x00002344, 0x44490404, 0x00002324, 0x445B0404, 0x00002324, 0x445C0404, 0x00002324,
+    0x442C0402, 0x44370402, 0x444F0404, 0x00002324, 0x44510404, 0x00002324, 0x44580402, 0x44590402,
+    0x44560402, 0x445B0416, 0x00002336, 0x442A0419, 0x44300419, 0x44350419, 0x44380419, 0x44460402,
+    0x44470402, 0x44480402, 0x44340419, 0x443D0402, 0x443E0402, 0x445F0402, 0x44600402, 0x1D270402,
+    0x1D280402, 0x1D290402, 0x1D2A0402, 0x1D2B0402, 0x1D2C0402, 0x1D2D0402, 0x1D2E0402, 0x1D2F0402,
+    0x1D300402, 0x1D310402, 0x1D320402, 0x1D330402, 0x1D340402, 0x1D350402, 0x1D360402, 0x1D370402,
+    0x1D380402, 0x1D390402, 0x1D3A0402, 0x1D3B0402, 0x1D3C0402, 0x1D3D0402, 0x1D3E0402, 0x1D3F0402,
+    0x1D400402, 0x1D410402, 0x1D420402, 0x1D430402, 0x1D440402, 0x1D450402, 0x1D460402, 0x1D470402,
+    0x1D480402, 0x1D490402, 0x1D4A0402, 0x42E2040F, 0x42E6040F, 0x42E7040F, 0x42EE040F, 0x42F1040F,
+    0x42F4040F, 0x42F5040F, 0x42F6040F, 0x42F7040F, 0x42F8040F, 0x42FB040F, 0x4301040F, 0x4302040F,
+    0x4303040F, 0x4304040F, 0x4305040F, 0x03280404, 0x41750404, 0x03290404, 0x03280404, 0x41770404,
+    0x03290404, 0x03280404, 0x41780404, 0x03290404, 0x03280404, 0x417A0404, 0x03290404, 0x03280404,
+    0x417B0404, 0x03290404, 0x03280404, 0x417C0404, 0x03290404, 0x03280404, 0x417E0404, 0x03290404,
+    0x03280404, 0x41800404, 0x03290404, 0x03280404, 0x41810404, 0x03290404, 0x03280404, 0x41830404,
+    0x03290404, 0x03280404, 0x41840404, 0x03290404, 0x03280404, 0x41850404, 0x03290404, 0x03280404,
+    0x41860404, 0x03290404, 0x03280404, 0x41870404, 0x03290404, 0x03280404, 0x41750404, 0x41F30404,
+    0x03290404, 0x03280404, 0x41770404, 0x41F30404, 0x03290404, 0x03280404, 0x41780404, 0x41F30404,
+    0x03290404, 0x03280404, 0x417A0404, 0x41F30404, 0x03290404, 0x03280404, 0x417B0404, 0x41F30404,
+    0x03290404, 0x03280404, 0x417C0404, 0x41F30404, 0x03290404, 0x03280404, 0x417E0404, 0x41F30404,
+    0x03290404, 0x03280404, 0x41800404, 0x41F30404, 0x03290404, 0x03280404, 0x41810404, 0x41F30404,
+    0x03290404, 0x03280404, 0x41830404, 0x41F30404, 0x03290404, 0x03280404, 0x41840404, 0x41F30404,
+    0x03290404, 0x03280404, 0x41850404, 0x41F30404, 0x03290404, 0x03280404, 0x41860404, 0x41F30404,
+    0x03290404, 0x03280404, 0x41870404, 0x41F30404, 0x03290404, 0x03280404, 0x41810404, 0x42000404,
+    0x03290404, 0x03280404, 0x41800404, 0x41FB0404, 0x41810404, 0x41F70404, 0x42540404, 0x03290404,
+    0x03280404, 0x41800404, 0x41FB0404, 0x41870404, 0x42000404, 0x03290404, 0x03280404, 0xFB400404,
+    0xCE000000, 0x03290404, 0x03280404, 0xFB400404, 0xCE8C0000, 0x03290404, 0x03280404, 0xFB400404,
+    0xCE090000, 0x03290404, 0x03280404, 0xFB400404, 0xD6DB0000, 0x03290404, 0x03280404, 0xFB400404,
+    0xCE940000, 0x03290404, 0x03280404, 0xFB400404, 0xD16D0000, 0x03290404, 0x03280404, 0xFB400404,
+    0xCE030000, 0x03290404, 0x03280404, 0xFB400404, 0xD16B0000, 0x03290404, 0x03280404, 0xFB400404,
+    0xCE5D0000, 0x03290404, 0x03280404, 0xFB400404, 0xD3410000, 0x03290404, 0x03280404, 0xFB400404,
+    0xE7080000, 0x03290404, 0x03280404, 0xFB400404, 0xF06B0000, 0x03290404, 0x03280404, 0xFB400404,
+    0xEC340000, 0x03290404, 0x03280404, 0xFB400404, 0xE7280000, 0x03290404, 0x03280404, 0xFB410404,
+    0x91D10000, 0x03290404, 0x03280404, 0xFB400404, 0xD71F0000, 0x03290404, 0x03280404, 0xFB400404,
+    0xE5E50000, 0x03290404, 0x03280404, 0xFB400404, 0xE82A0000, 0x03290404, 0x03280404, 0xFB400404,
+    0xE7090000, 0x03290404, 0x03280404, 0xFB400404, 0xF93E0000, 0x03290404, 0x03280404, 0xFB400404,
+    0xD40D0000, 0x03290404, 0x03280404, 0xFB400404, 0xF2790000, 0x03290404, 0x03280404, 0xFB410404,
+    0x8CA10000, 0x03290404, 0x03280404, 0xFB400404, 0xF95D0000, 0x03290404, 0x03280404, 0xFB400404,
+    0xD2B40000, 0x03290404, 0x03280404, 0xFB400404, 0xCEE30000, 0x03290404, 0x03280404, 0xFB400404,
+    0xD47C0000, 0x03290404, 0x03280404, 0xFB400404, 0xDB660000, 0x03290404, 0x03280404, 0xFB400404,
+    0xF6E30000, 0x03290404, 0x03280404, 0xFB400404, 0xCF010000, 0x03290404, 0x03280404, 0xFB410404,
+    0x8CC70000, 0x03290404, 0x03280404, 0xFB400404, 0xD3540000, 0x03290404, 0x03280404, 0xFB400404,
+    0xF96D0000, 0x03290404, 0x03280404, 0xFB400404, 0xCF110000, 0x03290404, 0x03280404, 0xFB410404,
+    0x81EA0000, 0x03290404, 0x03280404, 0xFB410404, 0x81F30000, 0x03290404, 0xFB400406, 0xD54F0000,
+    0xFB400406, 0xDE7C0000, 0xFB400406, 0xE5870000, 0xFB400406, 0xFB8F0000, 0x1F9B0406, 0x1F980406,
+    0x1F9C0406, 0x1F980406, 0x1F9D0406, 0x1F980406, 0x1F9E0406, 0x1F980406, 0x1F9F0406, 0x1F980406,
+    0x1FA00406, 0x1F980406, 0x216B041D, 0x21F7041D, 0x2007041D, 0x1F9A0406, 0x1F990406, 0x1F9A0406,
+    0x1F9A0406, 0x1F9A0406, 0x1F9B0406, 0x1F9A0406, 0x1F9C0406, 0x1F9A0406, 0x1F9D0406, 0x1F9A0406,
+    0x1F9E0406, 0x1F9A0406, 0x1F9F0406, 0x1F9A0406, 0x1FA00406, 0x1F9A0406, 0x1FA10406, 0x1F9B0406,
+    0x1F990406, 0x1F9B0406, 0x1F9A0406, 0x1F9B0406, 0x1F9B0406, 0x1F9B0406, 0x1F9C0406, 0x1F9B0406,
+    0x1F9D0406, 0x41750406, 0x41770406, 0x41780406, 0x417A0406, 0x417B0406, 0x417C0406, 0x417E0406,
+    0x41800406, 0x41810406, 0x41830406, 0x41840406, 0x41850406, 0x41860406, 0x41870406, 0x41750406,
+    0x41F30406, 0x41770406, 0x41F30406, 0x41780406, 0x41F30406, 0x417A0406, 0x41F30406, 0x417B0406,
+    0x41F30406, 0x417C0406, 0x41F30406, 0x417E0406, 0x41F30406, 0x41800406, 0x41F30406, 0x41810406,
+    0x41F30406, 0x41830406, 0x41F30406, 0x41840406, 0x41F30406, 0x41850406, 0x41F30406, 0x41860406,
+    0x41F30406, 0x41870406, 0x41F30406, 0x41830406, 0x41F30406, 0x42600406, 0x41750406, 0x41FB0406,
+    0x41810406, 0x42000406, 0x41800406, 0x42060406, 0x41800406, 0x42000406, 0x1D540402, 0xFB400406,
+    0xCE000000, 0xFB400406, 0xCE8C0000, 0xFB400406, 0xCE090000, 0xFB400406, 0xD6DB0000, 0xFB400406,
+    0xCE940000, 0xFB400406, 0xD16D0000, 0xFB400406, 0xCE030000, 0xFB400406, 0xD16B0000, 0xFB400406,
+    0xCE5D0000, 0xFB400406, 0xD3410000, 0xFB400406, 0xE7080000, 0xFB400406, 0xF06B0000, 0xFB400406,
+    0xEC340000, 0xFB400406, 0xE7280000, 0xFB410406, 0x91D10000, 0xFB400406, 0xD71F0000, 0xFB400406,
+    0xE5E50000, 0xFB400406, 0xE82A0000, 0xFB400406, 0xE7090000, 0xFB400406, 0xF93E0000, 0xFB400406,
+    0xD40D0000, 0xFB400406, 0xF2790000, 0xFB410406, 0x8CA10000, 0xFB400406, 0xF95D0000, 0xFB400406,
+    0xD2B40000, 0xFB400406, 0xF9D80000, 0xFB400406, 0xF5370000, 0xFB400406, 0xD9730000, 0xFB410406,
+    0x90690000, 0xFB400406, 0xD12A0000, 0xFB400406, 0xD3700000, 0xFB400406, 0xECE80000, 0xFB410406,
+    0x98050000, 0xFB400406, 0xCF110000, 0xFB400406, 0xD1990000, 0xFB400406, 0xEB630000, 0xFB400406,
+    0xCE0A0000, 0xFB400406, 0xCE2D0000, 0xFB400406, 0xCE0B0000, 0xFB400406, 0xDDE60000, 0xFB400406,
+    0xD3F30000, 0xFB400406, 0xD33B0000, 0xFB400406, 0xDB970000, 0xFB400406, 0xDB660000, 0xFB400406,
+    0xF6E30000, 0xFB400406, 0xCF010000, 0xFB410406, 0x8CC70000, 0xFB400406, 0xD3540000, 0xFB400406,
+    0xD91C0000, 0x1F9B0406, 0x1F9E0406, 0x1F9B0406, 0x1F9F0406, 0x1F9B0406, 0x1FA00406, 0x1F9B0406,
+    0x1FA10406, 0x1F9C0406, 0x1F990406, 0x1F9C0406, 0x1F9A0406, 0x1F9C0406, 0x1F9B0406, 0x1F9C0406,
+    0x1F9C0406, 0x1F9C0406, 0x1F9D0406, 0x1F9C0406, 0x1F9E0406, 0x1F9C0406, 0x1F9F0406, 0x1F9C0406,
+    0x1FA00406, 0x1F9C0406, 0x1FA10406, 0x1F990404, 0xFB400404, 0xE7080000, 0x1F9A0404, 0xFB400404,
+    0xE7080000, 0x1F9B0404, 0xFB400404, 0xE7080000, 0x1F9C0404, 0xFB400404, 0xE7080000, 0x1F9D0404,
+    0xFB400404, 0xE7080000, 0x1F9E0404, 0xFB400404, 0xE7080000, 0x1F9F0404, 0xFB400404, 0xE7080000,
+    0x1FA00404, 0xFB400404, 0xE7080000, 0x1FA10404, 0xFB400404, 0xE7080000, 0x1F990404, 0x1F980404,
+    0xFB400404, 0xE7080000, 0x1F990404, 0x1F990404, 0xFB400404, 0xE7080000, 0x1F990404, 0x1F9A0404,
+    0xFB400404, 0xE7080000, 0x2075041D, 0x2051041C, 0x2007041C, 0x2193041C, 0x2051041C, 0x2007041C,
+    0x2247041D, 0x20D6041D, 0x21F7041D, 0x1FEB041D, 0x42DA0413, 0x42DB0413, 0x42DC0413, 0x42DE0413,
+    0x42DF0413, 0x42E00413, 0x42E10413, 0x42E20413, 0x42E30413, 0x42E40413, 0x42E50413, 0x42E60413,
+    0x42E70413, 0x42E80413, 0x42E90413, 0x42EA0413, 0x42EB0413, 0x42EC0413, 0x42ED0413, 0x42EE0413,
+    0x42EF0413, 0x42F00413, 0x42F10413, 0x42F20413, 0x42F30413, 0x42F40413, 0x42F50413, 0x42F60413,
+    0x42F70413, 0x42F80413, 0x42F90413, 0x42FA0413, 0x42FB0413, 0x42FC0413, 0x42FD0413, 0x42FE0413,
+    0x42FF0413, 0x43000413, 0x43010413, 0x43020413, 0x43030413, 0x43040413, 0x43050413, 0x43060413,
+    0x43070413, 0x43080413, 0x43090413, 0xFB40041C, 0xCEE40000, 0xFB40041C, 0xD48C0000, 0x42DA041C,
+    0x42F4041C, 0x0000071C, 0x1F60041C, 0x42EE041C, 0x42DA041C, 0x4303041C, 0x42F6041C, 0x42DA041C,
+    0x42DA041C, 0x430A041C, 0x42F7041C, 0x0000071C, 0x42DA041C, 0x42DA041C, 0x1F60041C, 0x4303041C,
+    0x42DB041C, 0x42F0041C, 0x430A041C, 0x42E2041C, 0x000006FC, 0x42DB041C, 0x430A041C, 0x42EB041C,
+    0x42DC041C, 0x42DF041C, 0x430A041C, 0x42DE041C, 0x42E7041C, 0x42E2041C, 0x1F60041C, 0x42EE041C,
+    0x000006FC, 0x42DE041C, 0x1F60041C, 0x42E0041C, 0x1F60041C, 0x42DF041C, 0x430A041C, 0x42E7041C,
+    0x42DF041C, 0x1F60041C, 0x42FB041C, 0x42E0041C, 0x42DB041C, 0x4302041C, 0x42E0041C, 0x4301041C,
+    0x42EC041C, 0x42EE041C, 0x42E0041C, 0x4305041C, 0x4302041C, 0x1F60041C, 0x42E0041C, 0x000006FC,
+    0x4305041C, 0x430A041C, 0x42E0041C, 0x000006FC, 0x430A041C, 0x42F9041C, 0x42E1041C, 0x000006FC,
+    0x42E0041C, 0x000006FC, 0x42E1041C, 0x000006FC, 0x42F0041C, 0x1F60041C, 0x42E1041C, 0x42FF041C,
+    0x4302041C, 0x1F60041C, 0x42E1041C, 0x000006FC, 0x4303041C, 0x42EA041C, 0x000006FC, 0x1F60041C,
+    0x42E1041C, 0x4305041C, 0x42E1041C, 0x4305041C, 0x42E2041C, 0x000006FC, 0x4301041C, 0x42FB041C,
+    0x42E1041C, 0x4305041C, 0x42FC041C, 0x1F60041C, 0x42EE041C, 0x4303041C, 0x42E1041C, 0x4305041C,
+    0x4306041C, 0x42EC041C, 0x42EE041C, 0x42E2041C, 0x000006FC, 0x4301041C, 0x42FB041C, 0x42E2041C,
+    0x000006FC, 0x4301041C, 0x42FB041C, 0x42EE041C, 0x430A041C, 0x42E2041C, 0x4303041C, 0x42E8041C,
+    0x000006FC, 0x42DB041C, 0x4305041C, 0x42E2041C, 0x4305041C, 0x1F60041C, 0x42F2041C, 0x42E3041C,
+    0x1F60041C, 0x42E7041C, 0x42E4041C, 0x4303041C, 0x42EF041C, 0x42E4041C, 0x1F60041C, 0x42F8041C,
+    0x0000071C, 0x42E5041C, 0x42DB041C, 0x42E2041C, 0x4303041C, 0x42E5041C, 0x430A041C, 0x42EB041C,
+    0x1F60041C, 0x42FB041C, 0x42E6041C, 0x4302041C, 0x430A041C, 0x42E2041C, 0x000006FC, 0x42E8041C,
+    0x430A041C, 0x42EB041C, 0x42E8041C, 0x430A041C, 0x42EE041C, 0x42EA041C, 0x000006FC, 0x1F60041C,
+    0x42E7041C, 0x42ED041C, 0x000006FC, 0x42E6041C, 0x42EE041C, 0x000006FC, 0x4303041C, 0x42EE041C,
+    0x430A041C, 0x42EF041C, 0x42F3041C, 0x42F3041C, 0x42EC041C, 0x42EE041C, 0x42F4041C, 0x42DB041C,
+    0x42EC041C, 0x42F4041C, 0x0000071C, 0x1F60041C, 0x42E8041C, 0x430A041C, 0x42EE041C, 0x42F4041C,
+    0x0000071C, 0x1F60041C, 0x42EC041C, 0x42F4041C, 0x000006FC, 0x1F60041C, 0x4304041C, 0x4303041C,
+    0x42F5041C, 0x0000071C, 0x42DA041C, 0x42E7041C, 0x42EE041C, 0x4303041C, 0x42F5041C, 0x0000071C,
+    0x42E2041C, 0x4303041C, 0x42F5041C, 0x0000071C, 0x42E4041C, 0x42F5041C, 0x000006FC, 0x4303041C,
+    0x42F6041C, 0x42DA041C, 0x4301041C, 0x42EC041C, 0x42EE041C, 0x000006FC, 0x42F6041C, 0x42DB041C,
+    0x1F60041C, 0x42EE041C, 0x42F6041C, 0x000006FC, 0x42EC041C, 0x42E6041C, 0x42DE041C, 0x4303041C,
+    0x42F6041C, 0x4301041C, 0x430A041C, 0x42F7041C, 0x42E2041C, 0x42EA041C, 0x1F60041C, 0x4303041C,
+    0x42F7041C, 0x0000071C, 0x42E9041C, 0x42F7041C, 0x0000071C, 0x42F0041C, 0x42F5041C, 0x42F7041C,
+    0x4303041C, 0x42EC041C, 0x42F7041C, 0x0000071C, 0x430A041C, 0x42E7041C, 0x42F7041C, 0x0000071C,
+    0x1F60041C, 0x42E6041C, 0x000006FC, 0x42F7041C, 0x000006FC, 0x1F60041C, 0x42EA041C, 0x42F8041C,
+    0x0000071C, 0x42DB041C, 0x430A041C, 0x42EE041C, 0x42F8041C, 0x000006FC, 0x4303041C, 0x42EE041C,
+    0x42F8041C, 0x430A041C, 0x42F8041C, 0x0000071C, 0x430A041C, 0x42EE041C, 0x000006FC, 0x42F8041C,
+    0x1F60041C, 0x4303041C, 0x42F8041C, 0x1F60041C, 0x430A041C, 0x42F9041C, 0x42DB041C, 0x42E2041C,
+    0x4305041C, 0x42F9041C, 0x42DB041C, 0x4303041C, 0x42F9041C, 0x42EC041C, 0x42F4041C, 0x42F9041C,
+    0x4303041C, 0x42E2041C, 0x42F9041C, 0x430A041C, 0x42E6041C, 0x4300041C, 0x430A041C, 0x42FA041C,
+    0x42E2041C, 0x4305041C, 0x430A041C, 0x42FA041C, 0x4302041C, 0x42FA041C, 0x4302041C, 0x42F4041C,
+    0x000006FC, 0x1F60041C, 0x4303041C, 0x42FC041C, 0x42E0041C, 0x000006FC, 0x42FC041C, 0x42E0041C,
+    0x000006FC, 0x42EE041C, 0x430A041C, 0x42FC041C, 0x1F60041C, 0x42EE041C, 0x4303041C, 0x42FE041C,
+    0x1F60041C, 0x42EE041C, 0x000006FC, 0x42FE041C, 0x1F60041C, 0x4303041C, 0x42FF041C, 0x42DA041C,
+    0x430A041C, 0x4302041C, 0x42EC041C, 0x42EE041C, 0x4303041C, 0x4302041C, 0x4301041C, 0x4303041C,
+    0x42F5041C, 0x0000071C, 0x1F60041C, 0x4303041C, 0x1F60041C, 0x42F6041C, 0x000006FC, 0x4303041C,
+    0x4304041C, 0x42FB041C, 0x4304041C, 0x430A041C, 0x42EE041C, 0x42E3041C, 0x000006FC, 0x430A041C,
+    0x4306041C, 0x42EC041C, 0x42EE041C, 0x1F980404, 0xFB400404, 0xF0B90000, 0x1F990404, 0xFB400404,
+    0xF0B90000, 0x1F9A0404, 0xFB400404, 0xF0B90000, 0x1F9B0404, 0xFB400404, 0xF0B90000, 0x1F9C0404,
+    0xFB400404, 0xF0B90000, 0x1F9D0404, 0xFB400404, 0xF0B90000, 0x1F9E0404, 0xFB400404, 0xF0B90000,
+    0x1F9F0404, 0xFB400404, 0xF0B90000, 0x1FA00404, 0xFB400404, 0xF0B90000, 0x1FA10404, 0xFB400404,
+    0xF0B90000, 0x1F990404, 0x1F980404, 0xFB400404, 0xF0B90000, 0x1F990404, 0x1F990404, 0xFB400404,
+    0xF0B90000, 0x1F990404, 0x1F9A0404, 0xFB400404, 0xF0B90000, 0x1F990404, 0x1F9B0404, 0xFB400404,
+    0xF0B90000, 0x1F990404, 0x1F9C0404, 0xFB400404, 0xF0B90000, 0x1F990404, 0x1F9D0404, 0xFB400404,
+    0xF0B90000, 0x1F990404, 0x1F9E0404, 0xFB400404, 0xF0B90000, 0x1F990404, 0x1F9F0404, 0xFB400404,
+    0xF0B90000, 0x1F990404, 0x1FA00404, 0xFB400404, 0xF0B90000, 0x1F990404, 0x1FA10404, 0xFB400404,
+    0xF0B90000, 0x1F9A0404, 0x1F980404, 0xFB400404, 0xF0B90000, 0x1F9A0404, 0x1F990404, 0xFB400404,
+    0xF0B90000, 0x1F9A0404, 0x1F9A0404, 0xFB400404, 0xF0B90000, 0x1F9A0404, 0x1F9B0404, 0xFB400404,
+    0xF0B90000, 0x1F9A0404, 0x1F9C0404, 0xFB400404, 0xF0B90000, 0x2075041C, 0x216B041D, 0x1FA2041C,
+    0x1FEB041C, 0x1FA2041C, 0x1FA2041D, 0x2217041D, 0x1FBC041C, 0x1FA2041C, 0x2193041C, 0x213C041C,
+    0x2247041D, 0x216B041C, 0x1FD6041C, 0x1FEB041C, 0x2109041C, 0x1FEB041C, 0x2109041C, 0x1F9A041C,
+    0x1FEB041C, 0x2109041C, 0x1F9B041C, 0x2090041D, 0x2217041D, 0xFB40041C, 0xDE730000, 0xFB40041C,
+    0xE2100000, 0xFB40041C, 0xE62D0000, 0xFB40041C, 0xD48C0000, 0xFB40041C, 0xD9270000, 0xFB40041C,
+    0xEB630000, 0xFB40041C, 0xE60E0000, 0xFB40041C, 0xECBB0000, 0xFB40041C, 0xE82A0000, 0xFB40041C,
+    0xDF0F0000, 0xFB40041C, 0xCF1A0000, 0xFB40041C, 0xF93E0000, 0x216B041C, 0x1FA2041D, 0x2118041C,
+    0x1FA2041D, 0x2330041C, 0x1FA2041D, 0x2109041C, 0x1FA2041D, 0x20C4041C, 0x1FA2041D, 0x20C4041D,
+    0x1FBC041D, 0x2109041D, 0x1FBC041D, 0x2051041D, 0x1FBC041D, 0x1FD6041C, 0x1FA2041C, 0x20D6041C,
+    0x20C4041C, 0x1FD6041C, 0x1FA2041C, 0x20D6041C, 0x216B041C, 0x2042041D, 0x2118041C, 0x2042041D,
+    0x2330041C, 0x2042041D, 0x2330041C, 0x2051041C, 0x2109041C, 0x2051041C, 0x20C4041C, 0x2051041C,
+    0x2075041D, 0x2286041C, 0x20C4041C, 0x2075041D, 0x2286041C, 0x2109041D, 0x2075041D, 0x2286041C,
+    0x2051041D, 0x2075041D, 0x2286041C, 0x21F7041D, 0x2075041D, 0x2286041C, 0x2330041C, 0x20D6041C,
+    0x2109041C, 0x20D6041C, 0x1FEB041C, 0x20D6041C, 0x20C4041C, 0x20D6041C, 0x2042041C, 0x2109041C,
+    0x2118041C, 0x2109041C, 0x2330041C, 0x2109041C, 0x2109041C, 0x2109041C, 0x1FD6041C, 0x2109041C,
+    0x20C4041C, 0x2109041C, 0x2109041C, 0x2109041C, 0x1F9A041C, 0x1FD6041C, 0x2109041C, 0x1F9A041C,
+    0x2109041C, 0x1F9A041C, 0x20C4041C, 0x2109041C, 0x1F9A041C, 0x2109041C, 0x2109041C, 0x1F9B041C,
+    0x1FD6041C, 0x2109041C, 0x1F9B041C, 0x2109041C, 0x1F9B041C, 0x20C4041C, 0x2109041C, 0x1F9B041C,
+    0x2109041C, 0x0675041C, 0x21D2041C, 0x2109041C, 0x0675041C, 0x21D2041C, 0x1F9A041C, 0x216B041D,
+    0x1FA2041C, 0x20C4041C, 0x216B041D, 0x1FA2041C, 0x2109041D, 0x216B041D, 0x1FA2041C, 0x2051041D,
+    0x216B041D, 0x1FA2041C, 0x2193041C, 0x1FA2041C, 0x1FEB041C, 0x2193041C, 0x1FA2041C, 0x1FEB041C,
+    0x0675041C, 0x21D2041C, 0x2193041C, 0x1FA2041C, 0x1FEB041C, 0x0675041C, 0x21D2041C, 0x1F9A041C,
+    0x216B041C, 0x21D2041C, 0x2118041C, 0x21D2041C, 0x2330041C, 0x21D2041C, 0x2109041C, 0x21D2041C,
+    0x216B041C, 0x2247041D, 0x2118041C, 0x2247041D, 0x2330041C, 0x2247041D, 0x2109041C, 0x2247041D,
+    0x20C4041C, 0x2247041D, 0x2109041D, 0x2247041D, 0x216B041C, 0x2259041D, 0x2118041C, 0x2259041D,
+    0x2330041C, 0x2259041D, 0x2109041C, 0x2259041D, 0x20C4041C, 0x2259041D, 0x2109041D, 0x2259041D,
+    0x20C4041C, 0x2346041D, 0x2109041D, 0x2346041D, 0x1FA2041C, 0x027E041C, 0x2109041C, 0x027E041C,
+    0x1FBC041D, 0x2180041C, 0x1FD6041C, 0x1FD6041C, 0x1FD6041C, 0x1FEB041C, 0x1FD6041D, 0x0675041C,
+    0x20C4041C, 0x2051041C, 0x1FD6041D, 0x213C041C, 0x027E041C, 0x1FEB041C, 0x1FBC041D, 0x2051041D,
+    0x2270041C, 0x2075041C, 0x1FA2041C, 0x2075041D, 0x216B041D, 0x2090041C, 0x2118041C, 0x20C4041D,
+    0x20C4041D, 0x20C4041D, 0x2109041D, 0x20C4041C, 0x21F7041C, 0x20D6041C, 0x2109041C, 0x20D6041C,
+    0x2118041C, 0x20D6041C, 0x213C041C, 0x2051041C, 0x20D6041C, 0x2264041C, 0x2109041C, 0x1FBC041C,
+    0x2109041C, 0x2090041C, 0x20D6041C, 0x2109041C, 0x213C041C, 0x20D6041C, 0x216B041D, 0x2075041D,
+    0x216B041C, 0x027E041C, 0x2109041C, 0x027E041C, 0x216B041D, 0x216B041D, 0x2109041D, 0x216B041D,
+    0x2193041D, 0x21D2041C, 0x2193041C, 0x21D2041D, 0x2247041C, 0x2259041D, 0x1FBC041C, 0x2247041D,
+    0x0675041C, 0x2109041C, 0x1FA2041D, 0x0675041C, 0x2109041C, 0x1F990404, 0xFB400404, 0xE5E50000,
+    0x1F9A0404, 0xFB400404, 0xE5E50000, 0x1F9B0404, 0xFB400404, 0xE5E50000, 0x1F9C0404, 0xFB400404,
+    0xE5E50000, 0x1F9D0404, 0xFB400404, 0xE5E50000, 0x1F9E0404, 0xFB400404, 0xE5E50000, 0x1F9F0404,
+    0xFB400404, 0xE5E50000, 0x1FA00404, 0xFB400404, 0xE5E50000, 0x1FA10404, 0xFB400404, 0xE5E50000,
+    0x1F990404, 0x1F980404, 0xFB400404, 0xE5E50000, 0x1F990404, 0x1F990404, 0xFB400404, 0xE5E50000,
+    0x1F990404, 0x1F9A0404, 0xFB400404, 0xE5E50000, 0x1F990404, 0x1F9B0404, 0xFB400404, 0xE5E50000,
+    0x1F990404, 0x1F9C0404, 0xFB400404, 0xE5E50000, 0x1F990404, 0x1F9D0404, 0xFB400404, 0xE5E50000,
+    0x1F990404, 0x1F9E0404, 0xFB400404, 0xE5E50000, 0x1F990404, 0x1F9F0404, 0xFB400404, 0xE5E50000,
+    0x1F990404, 0x1FA00404, 0xFB400404, 0xE5E50000, 0x1F990404, 0x1FA10404, 0xFB400404, 0xE5E50000,
+    0x1F9A0404, 0x1F980404, 0xFB400404, 0xE5E50000, 0x1F9A0404, 0x1F990404, 0xFB400404, 0xE5E50000,
+    0x1F9A0404, 0x1F9A0404, 0xFB400404, 0xE5E50000, 0x1F9A0404, 0x1F9B0404, 0xFB400404, 0xE5E50000,
+    0x1F9A0404, 0x1F9C0404, 0xFB400404, 0xE5E50000, 0x1F9A0404, 0x1F9D0404, 0xFB400404, 0xE5E50000,
+    0x1F9A0404, 0x1F9E0404, 0xFB400404, 0xE5E50000, 0x1F9A0404, 0x1F9F0404, 0xFB400404, 0xE5E50000,
+    0x1F9A0404, 0x1FA00404, 0xFB400404, 0xE5E50000, 0x1F9A0404, 0x1FA10404, 0xFB400404, 0xE5E50000,
+    0x1F9B0404, 0x1F980404, 0xFB400404, 0xE5E50000, 0x1F9B0404, 0x1F990404, 0xFB400404, 0xE5E50000,
+    0x2051041C, 0x1FA2041C, 0x20D6041C, 0x0FF60402, 0x0FF70402, 0x0FF80402, 0x0FF90402, 0x0FFA0402,
+    0x0FFB0402, 0x0FFC0402, 0x0FFD0402, 0x0FFE0402, 0x0FFF0402, 0x10000402, 0x10010402, 0x10020402,
+    0x10030402, 0x10040402, 0x10050402, 0x10060402, 0x10070402, 0x10080402, 0x10090402, 0x100A0402,
+    0x100B0402, 0x100C0402, 0x100D0402, 0x100E0402, 0x100F0402, 0x10100402, 0x10110402, 0x10120402,
+    0x10130402, 0x10140402, 0x10150402, 0x10160402, 0x10170402, 0x10180402, 0x10190402, 0x101A0402,
+    0x101B0402, 0x101C0402, 0x101D0402, 0x101E0402, 0x101F0402, 0x10200402, 0x10210402, 0x10220402,
+    0x10230402, 0x10240402, 0x10250402, 0x10260402, 0x10270402, 0x10280402, 0x10290402, 0x102A0402,
+    0x102B0402, 0x102C0402, 0x102D0402, 0x102E0402, 0x102F0402, 0x10300402, 0x10310402, 0x10320402,
+    0x10330402, 0x10340402, 0x10350402, 0x44610402, 0x44620402, 0x44630402, 0x44640402, 0x44650402,
+    0x44660402, 0x44670402, 0x44680402, 0x44690402, 0x446A0402, 0x446B0402, 0x446C0402, 0x446D0402,
+    0x446E0402, 0x446F0402, 0x44700402, 0x44710402, 0x44720402, 0x44730402, 0x44740402, 0x44750402,
+    0x44760402, 0x44770402, 0x44780402, 0x44790402, 0x447A0402, 0x447B0402, 0x447C0402, 0x447D0402,
+    0x447E0402, 0x447F0402, 0x44800402, 0x44810402, 0x44820402, 0x44830402, 0x44840402, 0x44850402,
+    0x44860402, 0x44870402, 0x44880402, 0x44890402, 0x448A0402, 0x448B0402, 0x448C0402, 0x448D0402,
+    0x448E0402, 0x448F0402, 0x44900402, 0x44910402, 0x44920402, 0x44930402, 0x44940402, 0x44950402,
+    0x44960402, 0x44970402, 0x44980402, 0x44990402, 0x449A0402, 0x449B0402, 0x449C0402, 0x449D0402,
+    0x449E0402, 0x449F0402, 0x44A00402, 0x44A10402, 0x44A20402, 0x44A30402, 0x44A40402, 0x44A50402,
+    0x44A60402, 0x44A70402, 0x44A80402, 0x44A90402, 0x44AA0402, 0x44AB0402, 0x44AC0402, 0x44AD0402,
+    0x44AE0402, 0x44AF0402, 0x44B00402, 0x44B10402, 0x44B20402, 0x44B30402, 0x44B40402, 0x44B50402,
+    0x44B60402, 0x44B70402, 0x44B80402, 0x44B90402, 0x44BA0402, 0x44BB0402, 0x44BC0402, 0x44BD0402,
+    0x44BE0402, 0x44BF0402, 0x44C00402, 0x44C10402, 0x44C20402, 0x44C30402, 0x44C40402, 0x44C50402,
+    0x44C60402, 0x44C70402, 0x44C80402, 0x44C90402, 0x44CA0402, 0x44CB0402, 0x44CC0402, 0x44CD0402,
+    0x44CE0402, 0x44CF0402, 0x44D00402, 0x44D10402, 0x44D20402, 0x44D30402, 0x44D40402, 0x44D50402,
+    0x44D60402, 0x44D70402, 0x44D80402, 0x44D90402, 0x44DA0402, 0x44DB0402, 0x44DC0402, 0x44DD0402,
+    0x44DE0402, 0x44DF0402, 0x44E00402, 0x44E10402, 0x44E20402, 0x44E30402, 0x44E40402, 0x44E50402,
+    0x44E60402, 0x44E70402, 0x44E80402, 0x44E90402, 0x44EA0402, 0x44EB0402, 0x44EC0402, 0x44ED0402,
+    0x44EE0402, 0x44EF0402, 0x44F00402, 0x44F10402, 0x44F20402, 0x44F30402, 0x44F40402, 0x44F50402,
+    0x44F60402, 0x44F70402, 0x44F80402, 0x44F90402, 0x44FA0402, 0x44FB0402, 0x44FC0402, 0x44FD0402,
+    0x44FE0402, 0x44FF0402, 0x45000402, 0x45010402, 0x45020402, 0x45030402, 0x45040402, 0x45050402,
+    0x45060402, 0x45070402, 0x45080402, 0x45090402, 0x450A0402, 0x450B0402, 0x450C0402, 0x450D0402,
+    0x450E0402, 0x450F0402, 0x45100402, 0x45110402, 0x45120402, 0x45130402, 0x45140402, 0x45150402,
+    0x45160402, 0x45170402, 0x45180402, 0x45190402, 0x451A0402, 0x451B0402, 0x451C0402, 0x451D0402,
+    0x451E0402, 0x451F0402, 0x45200402, 0x45210402, 0x45220402, 0x45230402, 0x45240402, 0x45250402,
+    0x45260402, 0x45270402, 0x45280402, 0x45290402, 0x452A0402, 0x452B0402, 0x452C0402, 0x452D0402,
+    0x452E0402, 0x452F0402, 0x45300402, 0x45310402, 0x45320402, 0x45330402, 0x45340402, 0x45350402,
+    0x45360402, 0x45370402, 0x45380402, 0x45390402, 0x453A0402, 0x453B0402, 0x453C0402, 0x453D0402,
+    0x453E0402, 0x453F0402, 0x45400402, 0x45410402, 0x45420402, 0x45430402, 0x45440402, 0x45450402,
+    0x45460402, 0x45470402, 0x45480402, 0x45490402, 0x454A0402, 0x454B0402, 0x454C0402, 0x454D0402,
+    0x454E0402, 0x454F0402, 0x45500402, 0x45510402, 0x45520402, 0x45530402, 0x45540402, 0x45550402,
+    0x45560402, 0x45570402, 0x45580402, 0x45590402, 0x455A0402, 0x455B0402, 0x455C0402, 0x455D0402,
+    0x455E0402, 0x455F0402, 0x45600402, 0x45610402, 0x45620402, 0x45630402, 0x45640402, 0x45650402,
+    0x45660402, 0x45670402, 0x45680402, 0x45690402, 0x456A0402, 0x456B0402, 0x456C0402, 0x456D0402,
+    0x456E0402, 0x456F0402, 0x45700402, 0x45710402, 0x45720402, 0x45730402, 0x45740402, 0x45750402,
+    0x45760402, 0x45770402, 0x45780402, 0x45790402, 0x457A0402, 0x457B0402, 0x457C0402, 0x457D0402,
+    0x457E0402, 0x457F0402, 0x45800402, 0x45810402, 0x45820402, 0x45830402, 0x45840402, 0x45850402,
+    0x45860402, 0x45870402, 0x45880402, 0x45890402, 0x458A0402, 0x458B0402, 0x458C0402, 0x458D0402,
+    0x458E0402, 0x458F0402, 0x45900402, 0x45910402, 0x45920402, 0x45930402, 0x45940402, 0x45950402,
+    0x45960402, 0x45970402, 0x45980402, 0x45990402, 0x459A0402, 0x459B0402, 0x459C0402, 0x459D0402,
+    0x459E0402, 0x459F0402, 0x45A00402, 0x45A10402, 0x45A20402, 0x45A30402, 0x45A40402, 0x45A50402,
+    0x45A60402, 0x45A70402, 0x45A80402, 0x45A90402, 0x45AA0402, 0x45AB0402, 0x45AC0402, 0x45AD0402,
+    0x45AE0402, 0x45AF0402, 0x45B00402, 0x45B10402, 0x45B20402, 0x45B30402, 0x45B40402, 0x45B50402,
+    0x45B60402, 0x45B70402, 0x45B80402, 0x45B90402, 0x45BA0402, 0x45BB0402, 0x45BC0402, 0x45BD0402,
+    0x45BE0402, 0x45BF0402, 0x45C00402, 0x45C10402, 0x45C20402, 0x45C30402, 0x45C40402, 0x45C50402,
+    0x45C60402, 0x45C70402, 0x45C80402, 0x45C90402, 0x45CA0402, 0x45CB0402, 0x45CC0402, 0x45CD0402,
+    0x45CE0402, 0x45CF0402, 0x45D00402, 0x45D10402, 0x45D20402, 0x45D30402, 0x45D40402, 0x45D50402,
+    0x45D60402, 0x45D70402, 0x45D80402, 0x45D90402, 0x45DA0402, 0x45DB0402, 0x45DC0402, 0x45DD0402,
+    0x45DE0402, 0x45DF0402, 0x45E00402, 0x45E10402, 0x45E20402, 0x45E30402, 0x45E40402, 0x45E50402,
+    0x45E60402, 0x45E70402, 0x45E80402, 0x45E90402, 0x45EA0402, 0x45EB0402, 0x45EC0402, 0x45ED0402,
+    0x45EE0402, 0x45EF0402, 0x45F00402, 0x45F10402, 0x45F20402, 0x45F30402, 0x45F40402, 0x45F50402,
+    0x45F60402, 0x45F70402, 0x45F80402, 0x45F90402, 0x45FA0402, 0x45FB0402, 0x45FC0402, 0x45FD0402,
+    0x45FE0402, 0x45FF0402, 0x46000402, 0x46010402, 0x46020402, 0x46030402, 0x46040402, 0x46050402,
+    0x46060402, 0x46070402, 0x46080402, 0x46090402, 0x460A0402, 0x460B0402, 0x460C0402, 0x460D0402,
+    0x460E0402, 0x460F0402, 0x46100402, 0x46110402, 0x46120402, 0x46130402, 0x46140402, 0x46150402,
+    0x46160402, 0x46170402, 0x46180402, 0x46190402, 0x461A0402, 0x461B0402, 0x461C0402, 0x461D0402,
+    0x461E0402, 0x461F0402, 0x46200402, 0x46210402, 0x46220402, 0x46230402, 0x46240402, 0x46250402,
+    0x46260402, 0x46270402, 0x46280402, 0x46290402, 0x462A0402, 0x462B0402, 0x462C0402, 0x462D0402,
+    0x462E0402, 0x462F0402, 0x46300402, 0x46310402, 0x46320402, 0x46330402, 0x46340402, 0x46350402,
+    0x46360402, 0x46370402, 0x46380402, 0x46390402, 0x463A0402, 0x463B0402, 0x463C0402, 0x463D0402,
+    0x463E0402, 0x463F0402, 0x46400402, 0x46410402, 0x46420402, 0x46430402, 0x46440402, 0x46450402,
+    0x46460402, 0x46470402, 0x46480402, 0x46490402, 0x464A0402, 0x464B0402, 0x464C0402, 0x464D0402,
+    0x464E0402, 0x464F0402, 0x46500402, 0x46510402, 0x46520402, 0x46530402, 0x46540402, 0x46550402,
+    0x46560402, 0x46570402, 0x46580402, 0x46590402, 0x465A0402, 0x465B0402, 0x465C0402, 0x465D0402,
+    0x465E0402, 0x465F0402, 0x46600402, 0x46610402, 0x46620402, 0x46630402, 0x46640402, 0x46650402,
+    0x46660402, 0x46670402, 0x46680402, 0x46690402, 0x466A0402, 0x466B0402, 0x466C0402, 0x466D0402,
+    0x466E0402, 0x466F0402, 0x46700402, 0x46710402, 0x46720402, 0x46730402, 0x46740402, 0x46750402,
+    0x46760402, 0x46770402, 0x46780402, 0x46790402, 0x467A0402, 0x467B0402, 0x467C0402, 0x467D0402,
+    0x467E0402, 0x467F0402, 0x46800402, 0x46810402, 0x46820402, 0x46830402, 0x46840402, 0x46850402,
+    0x46860402, 0x46870402, 0x46880402, 0x46890402, 0x468A0402, 0x468B0402, 0x468C0402, 0x468D0402,
+    0x468E0402, 0x468F0402, 0x46900402, 0x46910402, 0x46920402, 0x46930402, 0x46940402, 0x46950402,
+    0x46960402, 0x46970402, 0x46980402, 0x46990402, 0x469A0402, 0x469B0402, 0x469C0402, 0x469D0402,
+    0x469E0402, 0x469F0402, 0x46A00402, 0x46A10402, 0x46A20402, 0x46A30402, 0x46A40402, 0x46A50402,
+    0x46A60402, 0x46A70402, 0x46A80402, 0x46A90402, 0x46AA0402, 0x46AB0402, 0x46AC0402, 0x46AD0402,
+    0x46AE0402, 0x46AF0402, 0x46B00402, 0x46B10402, 0x46B20402, 0x46B30402, 0x46B40402, 0x46B50402,
+    0x46B60402, 0x46B70402, 0x46B80402, 0x46B90402, 0x46BA0402, 0x46BB0402, 0x46BC0402, 0x46BD0402,
+    0x46BE0402, 0x46BF0402, 0x46C00402, 0x46C10402, 0x46C20402, 0x46C30402, 0x46C40402, 0x46C50402,
+    0x46C60402, 0x46C70402, 0x46C80402, 0x46C90402, 0x46CA0402, 0x46CB0402, 0x46CC0402, 0x46CD0402,
+    0x46CE0402, 0x46CF0402, 0x46D00402, 0x46D10402, 0x46D20402, 0x46D30402, 0x46D40402, 0x46D50402,
+    0x46D60402, 0x46D70402, 0x46D80402, 0x46D90402, 0x46DA0402, 0x46DB0402, 0x46DC0402, 0x46DD0402,
+    0x46DE0402, 0x46DF0402, 0x46E00402, 0x46E10402, 0x46E20402, 0x46E30402, 0x46E40402, 0x46E50402,
+    0x46E60402, 0x46E70402, 0x46E80402, 0x46E90402, 0x46EA0402, 0x46EB0402, 0x46EC0402, 0x46ED0402,
+    0x46EE0402, 0x46EF0402, 0x46F00402, 0x46F10402, 0x46F20402, 0x46F30402, 0x46F40402, 0x46F50402,
+    0x46F60402, 0x46F70402, 0x46F80402, 0x46F90402, 0x46FA0402, 0x46FB0402, 0x46FC0402, 0x46FD0402,
+    0x46FE0402, 0x46FF0402, 0x47000402, 0x47010402, 0x47020402, 0x47030402, 0x47040402, 0x47050402,
+    0x47060402, 0x47070402, 0x47080402, 0x47090402, 0x470A0402, 0x470B0402, 0x470C0402, 0x470D0402,
+    0x470E0402, 0x470F0402, 0x47100402, 0x47110402, 0x47120402, 0x47130402, 0x47140402, 0x47150402,
+    0x47160402, 0x47170402, 0x47180402, 0x47190402, 0x471A0402, 0x471B0402, 0x471C0402, 0x471D0402,
+    0x471E0402, 0x471F0402, 0x47200402, 0x47210402, 0x47220402, 0x47230402, 0x47240402, 0x47250402,
+    0x47260402, 0x47270402, 0x47280402, 0x47290402, 0x472A0402, 0x472B0402, 0x472C0402, 0x472D0402,
+    0x472E0402, 0x472F0402, 0x47300402, 0x47310402, 0x47320402, 0x47330402, 0x47340402, 0x47350402,
+    0x47360402, 0x47370402, 0x47380402, 0x47390402, 0x473A0402, 0x473B0402, 0x473C0402, 0x473D0402,
+    0x473E0402, 0x473F0402, 0x47400402, 0x47410402, 0x47420402, 0x47430402, 0x47440402, 0x47450402,
+    0x47460402, 0x47470402, 0x47480402, 0x47490402, 0x474A0402, 0x474B0402, 0x474C0402, 0x474D0402,
+    0x474E0402, 0x474F0402, 0x47500402, 0x47510402, 0x47520402, 0x47530402, 0x47540402, 0x47550402,
+    0x47560402, 0x47570402, 0x47580402, 0x47590402, 0x475A0402, 0x475B0402, 0x475C0402, 0x475D0402,
+    0x475E0402, 0x475F0402, 0x47600402, 0x47610402, 0x47620402, 0x47630402, 0x47640402, 0x47650402,
+    0x47660402, 0x47670402, 0x47680402, 0x47690402, 0x476A0402, 0x476B0402, 0x476C0402, 0x476D0402,
+    0x476E0402, 0x476F0402, 0x47700402, 0x47710402, 0x47720402, 0x47730402, 0x47740402, 0x47750402,
+    0x47760402, 0x47770402, 0x47780402, 0x47790402, 0x477A0402, 0x477B0402, 0x477C0402, 0x477D0402,
+    0x477E0402, 0x477F0402, 0x47800402, 0x47810402, 0x47820402, 0x47830402, 0x47840402, 0x47850402,
+    0x47860402, 0x47870402, 0x47880402, 0x47890402, 0x478A0402, 0x478B0402, 0x478C0402, 0x478D0402,
+    0x478E0402, 0x478F0402, 0x47900402, 0x47910402, 0x47920402, 0x47930402, 0x47940402, 0x47950402,
+    0x47960402, 0x47970402, 0x47980402, 0x47990402, 0x479A0402, 0x479B0402, 0x479C0402, 0x479D0402,
+    0x479E0402, 0x479F0402, 0x47A00402, 0x47A10402, 0x47A20402, 0x47A30402, 0x47A40402, 0x47A50402,
+    0x47A60402, 0x47A70402, 0x47A80402, 0x47A90402, 0x47AA0402, 0x47AB0402, 0x47AC0402, 0x47AD0402,
+    0x47AE0402, 0x47AF0402, 0x47B00402, 0x47B10402, 0x47B20402, 0x47B30402, 0x47B40402, 0x47B50402,
+    0x47B60402, 0x47B70402, 0x47B80402, 0x47B90402, 0x47BA0402, 0x47BB0402, 0x47BC0402, 0x47BD0402,
+    0x47BE0402, 0x47BF0402, 0x47C00402, 0x47C10402, 0x47C20402, 0x47C30402, 0x47C40402, 0x47C50402,
+    0x47C60402, 0x47C70402, 0x47C80402, 0x47C90402, 0x47CA0402, 0x47CB0402, 0x47CC0402, 0x47CD0402,
+    0x47CE0402, 0x47CF0402, 0x47D00402, 0x47D10402, 0x47D20402, 0x47D30402, 0x47D40402, 0x47D50402,
+    0x47D60402, 0x47D70402, 0x47D80402, 0x47D90402, 0x47DA0402, 0x47DB0402, 0x47DC0402, 0x47DD0402,
+    0x47DE0402, 0x47DF0402, 0x47E00402, 0x47E10402, 0x47E20402, 0x47E30402, 0x47E40402, 0x47E50402,
+    0x47E60402, 0x47E70402, 0x47E80402, 0x47E90402, 0x47EA0402, 0x47EB0402, 0x47EC0402, 0x47ED0402,
+    0x47EE0402, 0x47EF0402, 0x47F00402, 0x47F10402, 0x47F20402, 0x47F30402, 0x47F40402, 0x47F50402,
+    0x47F60402, 0x47F70402, 0x47F80402, 0x47F90402, 0x47FA0402, 0x47FB0402, 0x47FC0402, 0x47FD0402,
+    0x47FE0402, 0x47FF0402, 0x48000402, 0x48010402, 0x48020402, 0x48030402, 0x48040402, 0x48050402,
+    0x48060402, 0x48070402, 0x48080402, 0x48090402, 0x480A0402, 0x480B0402, 0x480C0402, 0x480D0402,
+    0x480E0402, 0x480F0402, 0x48100402, 0x48110402, 0x48120402, 0x48130402, 0x48140402, 0x48150402,
+    0x48160402, 0x48170402, 0x48180402, 0x48190402, 0x481A0402, 0x481B0402, 0x481C0402, 0x481D0402,
+    0x481E0402, 0x481F0402, 0x48200402, 0x48210402, 0x48220402, 0x48230402, 0x48240402, 0x48250402,
+    0x48260402, 0x48270402, 0x48280402, 0x48290402, 0x482A0402, 0x482B0402, 0x482C0402, 0x482D0402,
+    0x482E0402, 0x482F0402, 0x48300402, 0x48310402, 0x48320402, 0x48330402, 0x48340402, 0x48350402,
+    0x48360402, 0x48370402, 0x48380402, 0x48390402, 0x483A0402, 0x483B0402, 0x483C0402, 0x483D0402,
+    0x483E0402, 0x483F0402, 0x48400402, 0x48410402, 0x48420402, 0x48430402, 0x48440402, 0x48450402,
+    0x48460402, 0x48470402, 0x48480402, 0x48490402, 0x484A0402, 0x484B0402, 0x484C0402, 0x484D0402,
+    0x484E0402, 0x484F0402, 0x48500402, 0x48510402, 0x48520402, 0x48530402, 0x48540402, 0x48550402,
+    0x48560402, 0x48570402, 0x48580402, 0x48590402, 0x485A0402, 0x485B0402, 0x485C0402, 0x485D0402,
+    0x485E0402, 0x485F0402, 0x48600402, 0x48610402, 0x48620402, 0x48630402, 0x48640402, 0x48650402,
+    0x48660402, 0x48670402, 0x48680402, 0x48690402, 0x486A0402, 0x486B0402, 0x486C0402, 0x486D0402,
+    0x486E0402, 0x486F0402, 0x48700402, 0x48710402, 0x48720402, 0x48730402, 0x48740402, 0x48750402,
+    0x48760402, 0x48770402, 0x48780402, 0x48790402, 0x487A0402, 0x487B0402, 0x487C0402, 0x487D0402,
+    0x487E0402, 0x487F0402, 0x48800402, 0x48810402, 0x48820402, 0x48830402, 0x48840402, 0x48850402,
+    0x48860402, 0x48870402, 0x48880402, 0x48890402, 0x488A0402, 0x488B0402, 0x488C0402, 0x488D0402,
+    0x488E0402, 0x488F0402, 0x48900402, 0x48910402, 0x48920402, 0x48930402, 0x48940402, 0x48950402,
+    0x48960402, 0x48970402, 0x48980402, 0x48990402, 0x489A0402, 0x489B0402, 0x489C0402, 0x489D0402,
+    0x489E0402, 0x489F0402, 0x48A00402, 0x48A10402, 0x48A20402, 0x48A30402, 0x48A40402, 0x48A50402,
+    0x48A60402, 0x48A70402, 0x48A80402, 0x48A90402, 0x48AA0402, 0x48AB0402, 0x48AC0402, 0x48AD0402,
+    0x48AE0402, 0x48AF0402, 0x48B00402, 0x48B10402, 0x48B20402, 0x48B30402, 0x48B40402, 0x48B50402,
+    0x48B60402, 0x48B70402, 0x48B80402, 0x48B90402, 0x48BA0402, 0x48BB0402, 0x48BC0402, 0x48BD0402,
+    0x48BE0402, 0x48BF0402, 0x48C00402, 0x48C10402, 0x48C20402, 0x48C30402, 0x48C40402, 0x48C50402,
+    0x48C60402, 0x48C70402, 0x48C80402, 0x48C90402, 0x48CA0402, 0x48CB0402, 0x48CC0402, 0x48CD0402,
+    0x48CE0402, 0x48CF0402, 0x48D00402, 0x48D10402, 0x48D20402, 0x48D30402, 0x48D40402, 0x48D50402,
+    0x48D60402, 0x48D70402, 0x48D80402, 0x48D90402, 0x48DA0402, 0x48DB0402, 0x48DC0402, 0x48DD0402,
+    0x48DE0402, 0x48DF0402, 0x48E00402, 0x48E10402, 0x48E20402, 0x48E30402, 0x48E40402, 0x48E50402,
+    0x48E60402, 0x48E70402, 0x48E80402, 0x48E90402, 0x48EA0402, 0x48EB0402, 0x48EC0402, 0x48ED0402,
+    0x108D0402, 0x108E0402, 0x108F0402, 0x10900402, 0x10910402, 0x10920402, 0x10930402, 0x10940402,
+    0x10950402, 0x10960402, 0x10970402, 0x10980402, 0x10990402, 0x109A0402, 0x109B0402, 0x109C0402,
+    0x109D0402, 0x109E0402, 0x109F0402, 0x10A00402, 0x10A10402, 0x10A20402, 0x10A30402, 0x10A40402,
+    0x10A50402, 0x10A60402, 0x10A70402, 0x10A80402, 0x10A90402, 0x10AA0402, 0x10AB0402, 0x10AC0402,
+    0x10AD0402, 0x10AE0402, 0x10AF0402, 0x10B00402, 0x10B10402, 0x10B20402, 0x10B30402, 0x10B40402,
+    0x10B50402, 0x10B60402, 0x10B70402, 0x10B80402, 0x10B90402, 0x10BA0402, 0x10BB0402, 0x10BC0402,
+    0x10BD0402, 0x10BE0402, 0x10BF0402, 0x10C00402, 0x10C10402, 0x10C20402, 0x10C30402, 0x48F40402,
+    0x48F50402, 0x48F60402, 0x48F70402, 0x48F80402, 0x48F90402, 0x48FA0402, 0x48FB0402, 0x48FC0402,
+    0x48FD0402, 0x48FE0402, 0x48FF0402, 0x49000402, 0x49010402, 0x49020402, 0x49030402, 0x49040402,
+    0x49050402, 0x49060402, 0x49070402, 0x49080402, 0x49090402, 0x490A0402, 0x490B0402, 0x490C0402,
+    0x490D0402, 0x49100402, 0x490E0402, 0x49110402, 0x490F0402, 0x49130402, 0x49140402, 0x49150402,
+    0x49160402, 0x49170402, 0x49180402, 0x49190402, 0x491A0402, 0x491B0402, 0x491C0402, 0x48EE0402,
+    0x48EF0402, 0x48F00402, 0x48F10402, 0x48F30402, 0x48F20402, 0x02320402, 0x028C0402, 0x3CB90402,
+    0x3CBA0402, 0x3CBB0402, 0x3CBC0402, 0x3CBD0402, 0x3CBE0402, 0x3CBF0402, 0x3CC00402, 0x3CC10402,
+    0x3CC20402, 0x3CC30402, 0x3CC40402, 0x3CC50402, 0x3CC60402, 0x3CC70402, 0x3CC80402, 0x3CC90402,
+    0x3CCA0402, 0x3CCB0402, 0x3CCC0402, 0x3CCD0402, 0x3CCE0402, 0x3CCF0402, 0x3CD00402, 0x3CD10402,
+    0x3CD20402, 0x3CD30402, 0x3CD40402, 0x3CD50402, 0x3CD60402, 0x3CD70402, 0x3CD80402, 0x3CD90402,
+    0x3CDA0402, 0x3CDB0402, 0x3CDC0402, 0x3CDD0402, 0x3CDE0402, 0x3CDF0402, 0x3CE00402, 0x3CE10402,
+    0x3CE20402, 0x3CE30402, 0x3CE40402, 0x3CE50402, 0x3CE60402, 0x3CE70402, 0x3CE80402, 0x3CE90402,
+    0x3CEA0402, 0x3CEB0402, 0x3CEC0402, 0x3CED0402, 0x3CEE0402, 0x3CEF0402, 0x3CF00402, 0x3CF10402,
+    0x3CF20402, 0x3CF30402, 0x3CF40402, 0x3CF50402, 0x3CF60402, 0x3CF70402, 0x3CF80402, 0x3CF90402,
+    0x3CFA0402, 0x3CFB0402, 0x3CFC0402, 0x3CFD0402, 0x3CFE0402, 0x3CFF0402, 0x3D000402, 0x3D010402,
+    0x3D020402, 0x3D030402, 0x3D040402, 0x3D050402, 0x3D060402, 0x3D070402, 0x3D080402, 0x3D090402,
+    0x3D0A0402, 0x3D0B0402, 0x3D0C0402, 0x3D0D0402, 0x3D0E0402, 0x3D0F0402, 0x3D100402, 0x3D110402,
+    0x3D120402, 0x3D130402, 0x3D140402, 0x3D150402, 0x3D160402, 0x3D170402, 0x3D180402, 0x3D190402,
+    0x3D1A0402, 0x3D1B0402, 0x3D1C0402, 0x3D1D0402, 0x3D1E0402, 0x3D1F0402, 0x3D200402, 0x3D210402,
+    0x3D220402, 0x3D230402, 0x3D240402, 0x3D250402, 0x3D260402, 0x3D270402, 0x3D280402, 0x3D290402,
+    0x3D2A0402, 0x3D2B0402, 0x3D2C0402, 0x3D2D0402, 0x3D2E0402, 0x3D2F0402, 0x3D300402, 0x3D310402,
+    0x3D320402, 0x3D330402, 0x3D340402, 0x3D350402, 0x3D360402, 0x3D370402, 0x3D380402, 0x3D390402,
+    0x3D3A0402, 0x3D3B0402, 0x3D3C0402, 0x3D3D0402, 0x3D3E0402, 0x3D3F0402, 0x3D400402, 0x3D410402,
+    0x3D420402, 0x3D430402, 0x3D440402, 0x3D450402, 0x3D460402, 0x3D470402, 0x3D480402, 0x3D490402,
+    0x3D4A0402, 0x3D4B0402, 0x3D4C0402, 0x3D4D0402, 0x3D4E0402, 0x3D4F0402, 0x3D500402, 0x3D510402,
+    0x3D520402, 0x3D530402, 0x3D540402, 0x3D550402, 0x3D560402, 0x3D570402, 0x3D580402, 0x3D590402,
+    0x3D5A0402, 0x3D5B0402, 0x3D5C0402, 0x3D5D0402, 0x3D5E0402, 0x3D5F0402, 0x3D600402, 0x3D610402,
+    0x3D620402, 0x3D630402, 0x3D640402, 0x3D650402, 0x3D660402, 0x3D670402, 0x3D680402, 0x3D690402,
+    0x3D6A0402, 0x3D6B0402, 0x3D6C0402, 0x3D6D0402, 0x3D6E0402, 0x3D6F0402, 0x3D700402, 0x3D710402,
+    0x3D720402, 0x3D730402, 0x3D740402, 0x3D750402, 0x3D760402, 0x3D770402, 0x3D780402, 0x3D790402,
+    0x3D7A0402, 0x3D7B0402, 0x3D7C0402, 0x3D7D0402, 0x3D7E0402, 0x3D7F0402, 0x3D800402, 0x3D810402,
+    0x3D820402, 0x3D830402, 0x3D840402, 0x3D850402, 0x3D860402, 0x3D870402, 0x3D880402, 0x3D890402,
+    0x3D8A0402, 0x3D8B0402, 0x3D8C0402, 0x3D8D0402, 0x3D8E0402, 0x3D8F0402, 0x3D900402, 0x3D910402,
+    0x3D920402, 0x3D930402, 0x3D940402, 0x3D950402, 0x3D960402, 0x3D970402, 0x3D980402, 0x3D990402,
+    0x3D9A0402, 0x3D9B0402, 0x3D9C0402, 0x3D9D0402, 0x3D9E0402, 0x3D9F0402, 0x3DA00402, 0x3DA10402,
+    0x3DA20402, 0x3DA30402, 0x3DA40402, 0x3DA50402, 0x3DA60402, 0x3DA70402, 0x3DA80402, 0x3DA90402,
+    0x3DAA0402, 0x3DAB0402, 0x3DAC0402, 0x3DAD0402, 0x3DAE0402, 0x3DAF0402, 0x3DB00402, 0x3DB10402,
+    0x3DB20402, 0x3DB30402, 0x3DB40402, 0x3DB50402, 0x3DB60402, 0x3DB70402, 0x3DB80402, 0x3DB90402,
+    0x3DBA0402, 0x3DBB0402, 0x3DBC0402, 0x3DBD0402, 0x3DBE0402, 0x3DBF0402, 0x3DC00402, 0x3DC10402,
+    0x3DC20402, 0x3DC30402, 0x3DC40402, 0x3DC50402, 0x02330402, 0x028D0402, 0x02770402, 0x3D110404,
+    0x3D230404, 0x3D400404, 0x3CC50404, 0x3DC40404, 0x3CD70404, 0x3DC40404, 0x3CEC0404, 0x3DC40404,
+    0x3D000404, 0x3DC50404, 0x3D0B0404, 0x3DC40404, 0x3D110404, 0x3DC50404, 0x3D130404, 0x3DC50404,
+    0x3D190404, 0x3DC40404, 0x3D3E0404, 0x3DC40404, 0x3D6D0404, 0x3DC40404, 0x3D840404, 0x3DC40404,
+    0x3D8A0404, 0x3DC50404, 0x3D910404, 0x3DC40404, 0x3D270404, 0x3D8A0404, 0x23D50408, 0x23D50402,
+    0x23D80408, 0x23D80402, 0x23DD0408, 0x23DD0402, 0x23F10408, 0x23F10402, 0x23FA0408, 0x23FA0402,
+    0x248E0408, 0x248E0402, 0x24B50408, 0x24B50402, 0x24F10408, 0x24F10402, 0x24F80408, 0x24F80402,
+    0x25090408, 0x25090402, 0x25120408, 0x25120402, 0x25130408, 0x25130402, 0x25210408, 0x25210402,
+    0x25260408, 0x25260402, 0x252B0408, 0x252B0402, 0x25400408, 0x25400402, 0x24C20408, 0x24C20402,
+    0x23B90408, 0x23B90402, 0x24250408, 0x24250402, 0x24300408, 0x24300402, 0x244C040A, 0x00000A22,
+    0x03A50402, 0x23C30404, 0x23E50404, 0x23ED0404, 0x00000564, 0x24820404, 0x24F90404, 0x24FD0404,
+    0x24AD0404, 0x03E30402, 0x24F30402, 0x23B40408, 0x23B40402, 0x23E40408, 0x23E40402, 0x23CC0408,
+    0x23CC0402, 0x24DB0408, 0x24DB0402, 0x23E20408, 0x23E20402, 0x247D0408, 0x247D0402, 0x24770408,
+    0x24770402, 0x24C30408, 0x24C30402, 0x24C80408, 0x24C80402, 0x24CE0408, 0x24CE0402, 0x24AC0408,
+    0x24AC0402, 0x24EC0408, 0x24EC0402, 0x24F40414, 0x24FD0414, 0x24930404, 0x25190404, 0x3DC60402,
+    0x3DC70402, 0x3DC80402, 0x3DC90402, 0x3DCA0402, 0x3DCB0402, 0x3DCC0402, 0x3DCD0402, 0x3DCE0402,
+    0x3DCF0402, 0x3DD00402, 0x3DD10402, 0x3DD20402, 0x3DD30402, 0x3DD40402, 0x3DD50402, 0x3DD60402,
+    0x3DD70402, 0x3DD80402, 0x3DD90402, 0x3DDA0402, 0x3DDB0402, 0x3DDC0402, 0x3DDD0402, 0x3DDE0402,
+    0x3DDF0402, 0x3DE00402, 0x3DE10402, 0x3DE20402, 0x3DE30402, 0x3DE40402, 0x3DE50402, 0x3DE60402,
+    0x3DE70402, 0x3DE80402, 0x3DE90402, 0x3DEA0402, 0x3DEB0402, 0x3DEC0402, 0x3DED0402, 0x3DEE0402,
+    0x3DEF0402, 0x3DF00402, 0x3DF10402, 0x3DF20402, 0x3DF30402, 0x3DF40402, 0x3DF50402, 0x3DF60402,
+    0x3DF70402, 0x3DF80402, 0x3DF90402, 0x3DFA0402, 0x3DFB0402, 0x3DFC0402, 0x3DFD0402, 0x3DFE0402,
+    0x3DFF0402, 0x3E000402, 0x3E010402, 0x3E020402, 0x3E030402, 0x3E040402, 0x3E050402, 0x3E060402,
+    0x3E070402, 0x3E080402, 0x3E090402, 0x3E0A0402, 0x3E0B0402, 0x3E0C0402, 0x3E0D0402, 0x3E0E0402,
+    0x3E0F0402, 0x3E100402, 0x3E110402, 0x3E120402, 0x3E130402, 0x3E140402, 0x3E150402, 0x000016C2,
+    0x000016E2, 0x02E00402, 0x028E0402, 0x02660402, 0x02340402, 0x023E0402, 0x02780402, 0x05040402,
+    0x05050402, 0x05060402, 0x05070402, 0x05080402, 0x05090402, 0x050A0402, 0x050B0402, 0x050C0402,
+    0x050D0402, 0x050E0402, 0x050F0402, 0x05100402, 0x05110402, 0x05120402, 0x05130402, 0x05140402,
+    0x05150402, 0x05160402, 0x05170402, 0x05180402, 0x05190402, 0x051A0402, 0x051B0402, 0x051C0402,
+    0x051D0402, 0x051E0402, 0x051F0402, 0x05200402, 0x05210402, 0x05220402, 0x05230402, 0x05240402,
+    0x05250402, 0x22E60408, 0x22E60402, 0x22F10408, 0x22F10402, 0x20890408, 0x20890402, 0x21F7040A,
+    0x22860404, 0x21F70404, 0x22860404, 0x22CB0408, 0x22CB0402, 0x22CC0408, 0x22CC0402, 0x22CD0408,
+    0x22CD0402, 0x20460402, 0x21D60402, 0x1FA2040A, 0x1FA2040A, 0x1FA20404, 0x1FA20404, 0x1FA2040A,
+    0x213C040A, 0x1FA2040A, 0x2217040A, 0x1FA20404, 0x22170404, 0x1FA2040A, 0x2247040A, 0x1FA2040A,
+    0x00002304, 0x2247040A, 0x1FA20404, 0x00002304, 0x22470404, 0x1FA2040A, 0x2270040A, 0x1FA20404,
+    0x22700404, 0x1FEA0408, 0x1FEA0402, 0x20CF0408, 0x20CF0402, 0x20D00408, 0x20D00402, 0x20D10408,
+    0x20D10402, 0x20DE0408, 0x20DE0402, 0x20E00408, 0x20E00402, 0x21600408, 0x21600402, 0x21580408,
+    0x21580402, 0x213C040A, 0x213C040A, 0x213C0404, 0x213C0404, 0x21710408, 0x21710402, 0x21780408,
+    0x21780402, 0x21790408, 0x21790402, 0x21850408, 0x21850402, 0x21860408, 0x21860402, 0x219D0408,
+    0x219D0402, 0x21D10408, 0x21D10402, 0x224C0408, 0x224C0402, 0x2247040A, 0x2270040A, 0x22470404,
+    0x22700404, 0x22A20408, 0x22A20402, 0x22B90408, 0x22B90402, 0x22BA0408, 0x22BA0402, 0x22BF0408,
+    0x22BF0402, 0x22C30408, 0x22C30402, 0x22C40408, 0x22C40402, 0x22C50408, 0x22C50402, 0x22C50414,
+    0x20050402, 0x20FB0402, 0x21170402, 0x21360402, 0x21CF0402, 0x21D00402, 0x22120402, 0x22C60402,
+    0x1FEB040A, 0x00002324, 0x2042040A, 0x00002324, 0x20420404, 0x00002324, 0x2051040A, 0x00002324,
+    0x206C0408, 0x206C0402, 0x21000408, 0x21000402, 0x2193040A, 0x00002324, 0x21930404, 0x00002324,
+    0x21D2040A, 0x00002324, 0x21F7040A, 0x00002324, 0x21F70404, 0x00002324, 0x05260402, 0x05270402,
+    0x05280402, 0x22E70408, 0x22E70402, 0x222C0408, 0x20F60402, 0x22E80402, 0x212B0408, 0x212B0402,
+    0x1FDF0408, 0x1FDF0402, 0x1FE00402, 0x20810402, 0x1FCB0408, 0x1FCB0402, 0x20480408, 0x20480402,
+    0x1FA2040A, 0x00000564, 0x213C040A, 0x00000564, 0x2217040A, 0x00000564, 0x2051040A, 0x000006A4,
+    0x20510404, 0x000006A4, 0x20C4040A, 0x000006A4, 0x20C40404, 0x000006A4, 0x2118040A, 0x000006A4,
+    0x21180404, 0x000006A4, 0x2193040A, 0x000006A4, 0x21930404, 0x000006A4, 0x21D2040A, 0x000006A4,
+    0x21D20404, 0x000006A4, 0x20820408, 0x202C0408, 0x20550408, 0x20EC0408, 0x20980408, 0x21840402,
+    0x20D20408, 0x22130408, 0x20B80408, 0x226D0408, 0x1FD50408, 0x1FD50402, 0x21650408, 0x21650402,
+    0x22270408, 0x22270402, 0x1FA90408, 0x1FA90402, 0x20A50408, 0x20A50402, 0x222B0408, 0x222B0402,
+    0x225E0408, 0x225E0402, 0x1FE00408, 0x21DA0408, 0x22900408, 0x1FF10408, 0x1FF10402, 0x21D70408,
+    0x21D70402, 0x20880408, 0x20880402, 0x209D0402, 0x20750414, 0x00000734, 0x213C0414, 0x00002314,
+    0x20070414, 0x223C0402, 0x20500402, 0x217A0402, 0x21150402, 0x209C0402, 0x21160402, 0x2CDC0402,
+    0x2CDD0402, 0x2CDE0402, 0x2CDF0402, 0x2CE00402, 0x2CE10402, 0x2CE20402, 0x2CE40402, 0x2CE50402,
+    0x2CE60402, 0x2CE70402, 0x2CE80402, 0x2CE90402, 0x2CEA0402, 0x2CEB0402, 0x2CEC0402, 0x2CED0402,
+    0x2CEE0402, 0x2CEF0402, 0x2CF00402, 0x2CF10402, 0x2CF20402, 0x2CF30402, 0x2CF40402, 0x2CF50402,
+    0x2CF60402, 0x2CF70402, 0x2CF80402, 0x2CF90402, 0x2CFA0402, 0x2CFB0402, 0x2CFC0402, 0x2CFD0402,
+    0x2CFE0402, 0x2CFF0402, 0x2D000402, 0x2D010402, 0x2D020402, 0x2D030402, 0x056C0402, 0x056D0402,
+    0x056E0402, 0x056F0402, 0x2CE30402, 0x1D620402, 0x1D630402, 0x1D640402, 0x1D650402, 0x1D660402,
+    0x1D670402, 0x05700402, 0x05710402, 0x1F6F0402, 0x05720402, 0x34200402, 0x34210402, 0x34220402,
+    0x34230402, 0x34240402, 0x34250402, 0x34260402, 0x34270402, 0x342C0402, 0x342D0402, 0x342E0402,
+    0x342F0402, 0x34300402, 0x34310402, 0x34320402, 0x34330402, 0x34340402, 0x34350402, 0x34360402,
+    0x34370402, 0x34390402, 0x343A0402, 0x343B0402, 0x343C0402, 0x343F0402, 0x34420402, 0x34430402,
+    0x34450402, 0x34460402, 0x34490402, 0x344E0402, 0x344F0402, 0x34500402, 0x34510402, 0x344A0402,
+    0x344B0402, 0x344C0402, 0x344D0402, 0x34520402, 0x34380402, 0x343D0402, 0x34280402, 0x34290402,
+    0x342A0402, 0x342B0402, 0x343E0402, 0x34440402, 0x34470402, 0x34480402, 0x34400402, 0x34410402,
+    0x34530402, 0x04540402, 0x04550402, 0x029C0402, 0x029D0402, 0x2D040402, 0x2D050402, 0x2D060402,
+    0x2D070402, 0x2D080402, 0x2D090402, 0x2D0A0402, 0x2D0B0402, 0x2D0C0402, 0x2D0D0402, 0x2D0E0402,
+    0x2D0F0402, 0x2D100402, 0x2D110402, 0x2D120402, 0x2D130402, 0x2D140402, 0x2D150402, 0x2D160402,
+    0x2D170402, 0x2D180402, 0x2D190402, 0x2D1A0402, 0x2D1B0402, 0x2D1C0402, 0x2D1D0402, 0x2D1E0402,
+    0x2D1F0402, 0x2D200402, 0x2D210402, 0x2D220402, 0x2D230402, 0x2D240402, 0x2D250402, 0x2D260402,
+    0x2D270402, 0x2D280402, 0x2D290402, 0x2D2A0402, 0x2D2B0402, 0x2D2C0402, 0x2D2D0402, 0x2D2E0402,
+    0x2D2F0402, 0x2D300402, 0x2D310402, 0x2D320402, 0x2D330402, 0x2D340402, 0x2D350402, 0x2D360402,
+    0x2D370402, 0x2D380402, 0x2D390402, 0x2D3A0402, 0x2D3B0402, 0x2D3C0402, 0x2D3D0402, 0x2D3E0402,
+    0x2D3F0402, 0x2D400402, 0x2D410402, 0x2D420402, 0x2D430402, 0x2D440402, 0x2D450402, 0x2D460402,
+    0x02980402, 0x02990402, 0x2A210402, 0x2A210404, 0x04010402, 0x04020402, 0x04030402, 0x2A220402,
+    0x04040402, 0x29D80402, 0x29EE0402, 0x2A370402, 0x354B0402, 0x354C0402, 0x354D0402, 0x354E0402,
+    0x354F0402, 0x35500402, 0x35510402, 0x35520402, 0x35530402, 0x35540402, 0x35550402, 0x35560402,
+    0x35570402, 0x35580402, 0x35590402, 0x355A0402, 0x355B0402, 0x355C0402, 0x355D0402, 0x355E0402,
+    0x355F0402, 0x35600402, 0x35610402, 0x35620402, 0x35630402, 0x35640402, 0x35650402, 0x35660402,
+    0x35670402, 0x35680402, 0x35690402, 0x356A0402, 0x356B0402, 0x00001C82, 0x00001CA2, 0x00001CC2,
+    0x045A0402, 0x02A00402, 0x35270402, 0x35280402, 0x35290402, 0x352A0402, 0x352B0402, 0x352C0402,
+    0x352D0402, 0x352E0402, 0x352F0402, 0x35300402, 0x35310402, 0x35320402, 0x35330402, 0x35340402,
+    0x35350402, 0x35360402, 0x35370402, 0x35380402, 0x35390402, 0x353A0402, 0x353B0402, 0x353C0402,
+    0x353D0402, 0x353E0402, 0x353F0402, 0x35400402, 0x35410402, 0x35420402, 0x35430402, 0x35440402,
+    0x35450402, 0x35460402, 0x35470402, 0x35480402, 0x35490402, 0x354A0402, 0x02E10402, 0x41D40402,
+    0x41D50402, 0x41D60402, 0x41D70402, 0x41D80402, 0x41D90402, 0x41DA0402, 0x41DB0402, 0x41DC0402,
+    0x41DD0402, 0x41DE0402, 0x41DF0402, 0x41E00402, 0x41E10402, 0x41E20402, 0x41E30402, 0x41E40402,
+    0x41E50402, 0x41E60402, 0x41E70402, 0x41E80402, 0x41E90402, 0x41EA0402, 0x41EB0402, 0x41EC0402,
+    0x41ED0402, 0x41EE0402, 0x41EF0402, 0x41F00402, 0x00001942, 0x37FC0402, 0x37FD0402, 0x37FE0402,
+    0x37FF0402, 0x38000402, 0x38010402, 0x38020402, 0x38030402, 0x38040402, 0x38050402, 0x38060402,
+    0x38070402, 0x38080402, 0x38090402, 0x380A0402, 0x380B0402, 0x380C0402, 0x380D0402, 0x380E0402,
+    0x380F0402, 0x38100402, 0x38110402, 0x38120402, 0x38130402, 0x38140402, 0x38150402, 0x38160402,
+    0x38170402, 0x38180402, 0x38190402, 0x381A0402, 0x381B0402, 0x381C0402, 0x381D0402, 0x381E0402,
+    0x381F0402, 0x38200402, 0x38210402, 0x38220402, 0x38240402, 0x38240404, 0x38260402, 0x38270402,
+    0x38280402, 0x38290402, 0x382A0402, 0x382B0402, 0x382C0402, 0x382C0404, 0x382E0402, 0x382F0402,
+    0x38300402, 0x38310402, 0x38330402, 0x38340402, 0x382D0402, 0x38320402, 0x38230402, 0x38250402,
+    0x38350402, 0x02D60402, 0x02D70402, 0x02D80402, 0x02D90402, 0x02DA0402, 0x02DB0402, 0x02620402,
+    0x02AB0402, 0x02AC0402, 0x02DC0402, 0x02DD0402, 0x02DE0402, 0x02DF0402, 0x1F4D0402, 0x045B0402,
+    0x045C0402, 0x35750402, 0x357D0402, 0x35870402, 0x359D0402, 0x35B60402, 0x36000402, 0x1F4E0402,
+    0x358F0402, 0x35B10402, 0x35730402, 0x35760402, 0x35820402, 0x35890402, 0x35970402, 0x359A0402,
+    0x359E0402, 0x35D20402, 0x35A30402, 0x35A60402, 0x35B40402, 0x35B70402, 0x37710402, 0x37720402,
+    0x37730402, 0x37740402, 0x37750402, 0x37760402, 0x37770402, 0x37780402, 0x37790402, 0x377A0402,
+    0x377B0402, 0x377C0402, 0x377D0402, 0x377E0402, 0x377F0402, 0x37800402, 0x37810402, 0x37820402,
+    0x37830402, 0x37840402, 0x37850402, 0x37860402, 0x37870402, 0x37880402, 0x37890402, 0x378A0402,
+    0x378B0402, 0x378C0402, 0x378D0402, 0x378E0402, 0x378F0402, 0x37900402, 0x37910402, 0x37920402,
+    0x37930402, 0x37940402, 0x37950402, 0x37960402, 0x37970402, 0x37980402, 0x37990402, 0x379E0402,
+    0x379F0402, 0x37A00402, 0x37A10402, 0x37A20402, 0x37A30402, 0x37A40402, 0x37A50402, 0x37A60402,
+    0x37A70402, 0x379A0402, 0x379B0402, 0x379C0402, 0x379D0402, 0x37A80402, 0x37A90402, 0x37AA0402,
+    0x37AB0402, 0x37AC0402, 0x37AD0402, 0x37AE0402, 0x37AF0402, 0x37B00402, 0x37B10402, 0x37B20402,
+    0x37B30402, 0x37B40402, 0x37B50402, 0x045D0402, 0x02AD0402, 0x02AE0402, 0x02AF0402, 0x35720402,
+    0x357B0402, 0x357E0402, 0x35810402, 0x35880402, 0x358E0402, 0x35920402, 0x35940402, 0x35960402,
+    0x35990402, 0x35A50402, 0x35A90402, 0x35CA0402, 0x35CD0402, 0x35CF0402, 0x35AF0402, 0x1F4F0402,
+    0x35D00402, 0x35840402, 0x35BD0402, 0x36180402, 0x36190402, 0x361A0402, 0x059B0402, 0x059C0402,
+    0x059D0402, 0x35BE0402, 0x36150402, 0x36160402, 0x36170402, 0x357F0402, 0x358B0402, 0x32960402,
+    0x32970402, 0x32980402, 0x32990402, 0x329A0402, 0x329B0402, 0x329C0402, 0x329D0402, 0x329E0402,
+    0x329F0402, 0x32A00402, 0x32A10402, 0x32A20402, 0x32A30402, 0x32A40402, 0x32A50402, 0x32A60402,
+    0x32A70402, 0x32A80402, 0x32A90402, 0x32AA0402, 0x32AB0402, 0x32AC0402, 0x32AD0402, 0x32AE0402,
+    0x32AF0402, 0x32B00402, 0x32B10402, 0x32B20402, 0x32B30402, 0x32B40402, 0x32B50402, 0x32B60402,
+    0x32B70402, 0x32B80402, 0x32B90402, 0x32BA0402, 0x32BB0402, 0x32BC0402, 0x32BD0402, 0x32BE0402,
+    0x32BF0402, 0x32C00402, 0x32C10402, 0x32C20402, 0x32C30402, 0x32C40402, 0x32C50402, 0x32C60402,
+    0x32C70402, 0x32C80402, 0x32C90402, 0x32CA0402, 0x32CB0402, 0x32CC0402, 0x32CD0402, 0x32CE0402,
+    0x32CF0402, 0x32D00402, 0x32D10402, 0x32D20402, 0x32D30402, 0x32D40402, 0x00001C22, 0x32D50402,
+    0x00001C42, 0x32D60402, 0x32D70402, 0x32D80402, 0x1F500402, 0x040E0402, 0x040F0402, 0x2CB90402,
+    0x2CBA0402, 0x2CBB0402, 0x2CBC0402, 0x2CBD0402, 0x2CBE0402, 0x2CBF0402, 0x2CC00402, 0x2CC10402,
+    0x2CC20402, 0x2CC30402, 0x2CCC0402, 0x2CCD0402, 0x2CCE0402, 0x2CCF0402, 0x2CD00402, 0x02B00402,
+    0x02790402, 0x2C9D0402, 0x1F510402, 0x1F520402, 0x2CD10402, 0x2CDB0402, 0x28520402, 0x28530402,
+    0x28540402, 0x28550402, 0x28560402, 0x28570402, 0x29190402, 0x291A0402, 0x291B0402, 0x291C0402,
+    0x291D0402, 0x291E0402, 0x28FA0402, 0x28FB0402, 0x28FC0402, 0x28FD0402, 0x28FE0402, 0x28FF0402,
+    0x295C0402, 0x295D0402, 0x295E0402, 0x295F0402, 0x29600402, 0x29610402, 0x29620402, 0x29740402,
+    0x29750402, 0x29760402, 0x29770402, 0x29780402, 0x29790402, 0x297A0402, 0x1FB50402, 0x1FAC0402,
+    0x200C0402, 0x200D0402, 0x20130402, 0x20470402, 0x20590402, 0x20F00402, 0x20EA0402, 0x20EB0402,
+    0x21140402, 0x21350402, 0x213B0402, 0x21420402, 0x214E0402, 0x21550402, 0x214A0402, 0x21480402,
+    0x21490402, 0x214B0402, 0x214C0402, 0x21970402, 0x219C0402, 0x21C50402, 0x21C60402, 0x21BB0402,
+    0x21C70402, 0x21C80402, 0x21C90402, 0x21E80402, 0x221C0402, 0x22260402, 0x22200402, 0x22210402,
+    0x222A0402, 0x226D0402, 0x226E0402, 0x226F0402, 0x22690402, 0x226A0402, 0x226B0402, 0x226C0402,
+    0x22810402, 0x05290402, 0x20890414, 0x20F00414, 0x20E60414, 0x222A0414, 0x22C00402, 0x22C10402,
+    0x21570402, 0x22C20402, 0x1FBB0402, 0x23470402, 0x1FEB0404, 0x22950404, 0x21F70404, 0x21DA0404,
+    0x21CE0402, 0x22600414, 0x04DA0402, 0x04DB0402, 0x38DE0402, 0x38DF0402, 0x38E00402, 0x38E10402,
+    0x38E20402, 0x38E30402, 0x38E40402, 0x38E50402, 0x38E60402, 0x38E70402, 0x38E80402, 0x38E90402,
+    0x38EA0402, 0x38EB0402, 0x38EC0402, 0x38ED0402, 0x38EE0402, 0x38EF0402, 0x38F00402, 0x38F10402,
+    0x38F20402, 0x38F30402, 0x38F40402, 0x38F50402, 0x38F60402, 0x38F70402, 0x38F80402, 0x38F90402,
+    0x38FA0402, 0x38FB0402, 0x38FC0402, 0x38FD0402, 0x38FE0402, 0x38FF0402, 0x39000402, 0x39010402,
+    0x39020402, 0x39030402, 0x39040402, 0x39050402, 0x39060402, 0x39070402, 0x39080402, 0x39090402,
+    0x390A0402, 0x390B0402, 0x390C0402, 0x390D0402, 0x390E0402, 0x390F0402, 0x39100402, 0x39110402,
+    0x39120402, 0x39130402, 0x39140402, 0x39150402, 0x39160402, 0x39170402, 0x39180402, 0x39190402,
+    0x391A0402, 0x391B0402, 0x391C0402, 0x391D0402, 0x391E0402, 0x391F0402, 0x39200402, 0x39210402,
+    0x39220402, 0x39230402, 0x39240402, 0x39250402, 0x39260402, 0x39270402, 0x39280402, 0x39290402,
+    0x392A0402, 0x392B0402, 0x392C0402, 0x392D0402, 0x2C9E0402, 0x2C9F0402, 0x2CA00402, 0x2CA10402,
+    0x2CA20402, 0x2CA30402, 0x2CA40402, 0x2CA50402, 0x2CA60402, 0x2CA70402, 0x2CA80402, 0x2CA90402,
+    0x2CAA0402, 0x2CAB0402, 0x2CAC0402, 0x2CAD0402, 0x2CAE0402, 0x2CAF0402, 0x2CB00402, 0x2CB10402,
+    0x2CB20402, 0x2CB30402, 0x2CB40402, 0x2CB50402, 0x2CB60402, 0x2CB70402, 0x2CB80402, 0x2CD20402,
+    0x2CD30402, 0x2CD40402, 0x2CD50402, 0x2CD60402, 0x2CD70402, 0x2CD80402, 0x2CD90402, 0x2CC40402,
+    0x2CC50402, 0x2CC60402, 0x2CC70402, 0x2CC80402, 0x2CC90402, 0x2CCA0402, 0x2CCB0402, 0x02B10402,
+    0x00001982, 0x2CDA0402, 0x423A0402, 0x423B0402, 0x423C0402, 0x423D0402, 0x423E0402, 0x423F0402,
+    0x42400402, 0x42410402, 0x42420402, 0x42430402, 0x42440402, 0x42450402, 0x42460402, 0x42470402,
+    0x42480402, 0x42490402, 0x424A0402, 0x424B0402, 0x424C0402, 0x424D0402, 0x424E0402, 0x424F0402,
+    0x42500402, 0x42A90402, 0x42AA0402, 0x42AB0402, 0x42AC0402, 0x42AD0402, 0x42AE0402, 0x42AF0402,
+    0x42B00402, 0x42B10402, 0x42B20402, 0x42B30402, 0x42B40402, 0x42B50402, 0x42B60402, 0x42B70402,
+    0x42B80402, 0x42B90402, 0x42BA0402, 0x42BB0402, 0x42BC0402, 0x42BD0402, 0x42BE0402, 0x42BF0402,
+    0x42C00402, 0x42C10402, 0x42C20402, 0x42C30402, 0x42C40402, 0x42C50402, 0x42C60402, 0x42C70402,
+    0x42C80402, 0x42C90402, 0x42CA0402, 0x42CB0402, 0x42CC0402, 0x42CD0402, 0x42CE0402, 0x42CF0402,
+    0x42D00402, 0x42D10402, 0x42D20402, 0x42D30402, 0x42D40402, 0x42D50402, 0x42D60402, 0x42D70402,
+    0x42D80402, 0x42D90402, 0xFB410402, 0x8C480000, 0xFB400402, 0xE6F40000, 0xFB410402, 0x8ECA0000,
+    0xFB410402, 0x8CC80000, 0xFB400402, 0xEED10000, 0xFB400402, 0xCE320000, 0xFB400402, 0xD3E50000,
+    0xFB410402, 0x9F9C0000, 0xFB400402, 0xD9510000, 0xFB410402, 0x91D10000, 0xFB400402, 0xD5870000,
+    0xFB400402, 0xD9480000, 0xFB400402, 0xE1F60000, 0xFB400402, 0xF6690000, 0xFB400402, 0xFF850000,
+    0xFB410402, 0x863F0000, 0xFB410402, 0x87BA0000, 0xFB410402, 0x88F80000, 0xFB410402, 0x908F0000,
+    0xFB400402, 0xEA020000, 0xFB400402, 0xED1B0000, 0xFB400402, 0xF0D90000, 0xFB400402, 0xF3DE0000,
+    0xFB410402, 0x843D0000, 0xFB410402, 0x916A0000, 0xFB410402, 0x99F10000, 0xFB400402, 0xCE820000,
+    0xFB400402, 0xD3750000, 0xFB400402, 0xEB040000, 0xFB400402, 0xF21B0000, 0xFB410402, 0x862D0000,
+    0xFB410402, 0x9E1E0000, 0xFB400402, 0xDD500000, 0xFB400402, 0xEFEB0000, 0xFB410402, 0x85CD0000,
+    0xFB410402, 0x89640000, 0xFB400402, 0xE2C90000, 0xFB410402, 0x81D80000, 0xFB410402, 0x881F0000,
+    0xFB400402, 0xDECA0000, 0xFB400402, 0xE7170000, 0xFB400402, 0xED6A0000, 0xFB400402, 0xF2FC0000,
+    0xFB410402, 0x90CE0000, 0xFB400402, 0xCF860000, 0xFB400402, 0xD1B70000, 0xFB400402, 0xD2DE0000,
+    0xFB400402, 0xE4C40000, 0xFB400402, 0xEAD30000, 0xFB400402, 0xF2100000, 0xFB400402, 0xF6E70000,
+    0xFB410402, 0x80010000, 0xFB410402, 0x86060000, 0xFB410402, 0x865C0000, 0xFB410402, 0x8DEF0000,
+    0xFB410402, 0x97320000, 0xFB410402, 0x9B6F0000, 0xFB410402, 0x9DFA0000, 0xFB400402, 0xF88C0000,
+    0xFB400402, 0xF97F0000, 0xFB400402, 0xFDA00000, 0xFB410402, 0x83C90000, 0xFB410402, 0x93040000,
+    0xFB410402, 0x9E7F0000, 0xFB410402, 0x8AD60000, 0xFB400402, 0xD8DF0000, 0xFB400402, 0xDF040000,
+    0xFB400402, 0xFC600000, 0xFB410402, 0x807E0000, 0xFB400402, 0xF2620000, 0xFB400402, 0xF8CA0000,
+    0xFB410402, 0x8CC20000, 0xFB410402, 0x96F70000, 0xFB400402, 0xD8D80000, 0xFB400402, 0xDC620000,
+    0xFB400402, 0xEA130000, 0xFB400402, 0xEDDA0000, 0xFB400402, 0xEF0F0000, 0xFB400402, 0xFD2F0000,
+    0xFB400402, 0xFE370000, 0xFB410402, 0x964B0000, 0xFB400402, 0xD2D20000, 0xFB410402, 0x808B0000,
+    0xFB400402, 0xD1DC0000, 0xFB400402, 0xD1CC0000, 0xFB400402, 0xFA1C0000, 0xFB400402, 0xFDBE0000,
+    0xFB410402, 0x83F10000, 0xFB410402, 0x96750000, 0xFB410402, 0x8B800000, 0xFB400402, 0xE2CF0000,
+    0xFB410402, 0x8AFE0000, 0xFB400402, 0xCE390000, 0xFB400402, 0xDBE70000, 0xFB400402, 0xE0120000,
+    0xFB400402, 0xF3870000, 0xFB400402, 0xF5700000, 0xFB400402, 0xD3170000, 0xFB400402, 0xF8FB0000,
+    0xFB400402, 0xCFBF0000, 0xFB400402, 0xDFA90000, 0xFB400402, 0xCE0D0000, 0xFB400402, 0xECCC0000,
+    0xFB400402, 0xE5780000, 0xFB400402, 0xFD220000, 0xFB400402, 0xD3C30000, 0xFB400402, 0xD85E0000,
+    0xFB400402, 0xF7010000, 0xFB410402, 0x84490000, 0xFB410402, 0x8AAA0000, 0xFB400402, 0xEBBA0000,
+    0xFB410402, 0x8FB00000, 0xFB400402, 0xEC880000, 0xFB400402, 0xE2FE0000, 0xFB410402, 0x82E50000,
+    0xFB400402, 0xE3A00000, 0xFB400402, 0xF5650000, 0xFB400402, 0xCEAE0000, 0xFB400402, 0xD1690000,
+    0xFB400402, 0xD1C90000, 0xFB400402, 0xE8810000, 0xFB400402, 0xFCE70000, 0xFB410402, 0x826F0000,
+    0xFB410402, 0x8AD20000, 0xFB410402, 0x91CF0000, 0xFB400402, 0xD2F50000, 0xFB400402, 0xD4420000,
+    0xFB400402, 0xD9730000, 0xFB400402, 0xDEEC0000, 0xFB400402, 0xE5C50000, 0xFB400402, 0xEFFE0000,
+    0xFB400402, 0xF92A0000, 0xFB410402, 0x95AD0000, 0xFB410402, 0x9A6A0000, 0xFB410402, 0x9E970000,
+    0xFB410402, 0x9ECE0000, 0xFB400402, 0xD29B0000, 0xFB400402, 0xE6C60000, 0xFB400402, 0xEB770000,
+    0xFB410402, 0x8F620000, 0xFB400402, 0xDE740000, 0xFB400402, 0xE1900000, 0xFB400402, 0xE2000000,
+    0xFB400402, 0xE49A0000, 0xFB400402, 0xEF230000, 0xFB400402, 0xF1490000, 0xFB400402, 0xF4890000,
+    0xFB400402, 0xF9CA0000, 0xFB400402, 0xFDF40000, 0xFB410402, 0x806F0000, 0xFB410402, 0x8F260000,
+    0xFB410402, 0x84EE0000, 0xFB410402, 0x90230000, 0xFB410402, 0x934A0000, 0xFB400402, 0xD2170000,
+    0xFB400402, 0xD2A30000, 0xFB400402, 0xD4BD0000, 0xFB400402, 0xF0C80000, 0xFB410402, 0x88C20000,
+    0xFB400402, 0xDEC90000, 0xFB400402, 0xDFF50000, 0xFB400402, 0xE37B0000, 0xFB400402, 0xEBAE0000,
+    0xFB400402, 0xFC3E0000, 0xFB400402, 0xF3750000, 0xFB400402, 0xCEE40000, 0xFB400402, 0xD6F90000,
+    0xFB400402, 0xDDBA0000, 0xFB400402, 0xE01C0000, 0xFB400402, 0xF3B20000, 0xFB400402, 0xF4690000,
+    0xFB400402, 0xFF9A0000, 0xFB410402, 0x80460000, 0xFB410402, 0x92340000, 0xFB410402, 0x96F60000,
+    0xFB410402, 0x97480000, 0xFB410402, 0x98180000, 0xFB400402, 0xCF8B0000, 0xFB400402, 0xF9AE0000,
+    0xFB410402, 0x91B40000, 0xFB410402, 0x96B80000, 0xFB400402, 0xE0E10000, 0xFB400402, 0xCE860000,
+    0xFB400402, 0xD0DA0000, 0xFB400402, 0xDBEE0000, 0xFB400402, 0xDC3F0000, 0xFB400402, 0xE5990000,
+    0xFB400402, 0xF1CE0000, 0xFB400402, 0xF6420000, 0xFB410402, 0x84FC0000, 0xFB410402, 0x907C0000,
+    0xFB410402, 0x9F8D0000, 0xFB400402, 0xE6880000, 0xFB410402, 0x962E0000, 0xFB400402, 0xD2890000,
+    0xFB400402, 0xE77B0000, 0xFB400402, 0xE7F30000, 0xFB400402, 0xED410000, 0xFB400402, 0xEE9C0000,
+    0xFB400402, 0xF4090000, 0xFB400402, 0xF5590000, 0xFB400402, 0xF86B0000, 0xFB400402, 0xFD100000,
+    0xFB410402, 0x985E0000, 0xFB400402, 0xD16D0000, 0xFB400402, 0xE22E0000, 0xFB410402, 0x96780000,
+    0xFB400402, 0xD02B0000, 0xFB400402, 0xDD190000, 0xFB400402, 0xEDEA0000, 0xFB410402, 0x8F2A0000,
+    0xFB400402, 0xDF8B0000, 0xFB400402, 0xE1440000, 0xFB400402, 0xE8170000, 0xFB410402, 0x96860000,
+    0xFB400402, 0xD2290000, 0xFB400402, 0xD40F0000, 0xFB400402, 0xDC650000, 0xFB400402, 0xE6130000,
+    0xFB400402, 0xE74E0000, 0xFB400402, 0xE8A80000, 0xFB400402, 0xECE50000, 0xFB400402, 0xF4060000,
+    0xFB400402, 0xF5E20000, 0xFB400402, 0xFF790000, 0xFB410402, 0x88CF0000, 0xFB410402, 0x88E10000,
+    0xFB410402, 0x91CC0000, 0xFB410402, 0x96E20000, 0xFB400402, 0xD33F0000, 0xFB400402, 0xEEBA0000,
+    0xFB400402, 0xD41D0000, 0xFB400402, 0xF1D00000, 0xFB400402, 0xF4980000, 0xFB410402, 0x85FA0000,
+    0xFB410402, 0x96A30000, 0xFB410402, 0x9C570000, 0xFB410402, 0x9E9F0000, 0xFB400402, 0xE7970000,
+    0xFB400402, 0xEDCB0000, 0xFB410402, 0x81E80000, 0xFB400402, 0xFACB0000, 0xFB400402, 0xFB200000,
+    0xFB400402, 0xFC920000, 0xFB400402, 0xF2C00000, 0xFB400402, 0xF0990000, 0xFB410402, 0x8B580000,
+    0xFB400402, 0xCEC00000, 0xFB410402, 0x83360000, 0xFB400402, 0xD23A0000, 0xFB400402, 0xD2070000,
+    0xFB400402, 0xDEA60000, 0xFB400402, 0xE2D30000, 0xFB400402, 0xFCD60000, 0xFB400402, 0xDB850000,
+    0xFB400402, 0xED1E0000, 0xFB400402, 0xE6B40000, 0xFB410402, 0x8F3B0000, 0xFB410402, 0x884C0000,
+    0xFB410402, 0x964D0000, 0xFB410402, 0x898B0000, 0xFB400402, 0xDED30000, 0xFB400402, 0xD1400000,
+    0xFB400402, 0xD5C00000, 0xFB410402, 0xFA0E0000, 0xFB410402, 0xFA0F0000, 0xFB400402, 0xD85A0000,
+    0xFB410402, 0xFA110000, 0xFB400402, 0xE6740000, 0xFB410402, 0xFA130000, 0xFB410402, 0xFA140000,
+    0xFB400402, 0xD1DE0000, 0xFB400402, 0xF32A0000, 0xFB400402, 0xF6CA0000, 0xFB400402, 0xF93C0000,
+    0xFB400402, 0xF95E0000, 0xFB400402, 0xF9650000, 0xFB400402, 0xF98F0000, 0xFB410402, 0x97560000,
+    0xFB400402, 0xFCBE0000, 0xFB400402, 0xFFBD0000, 0xFB410402, 0xFA1F0000, 0xFB410402, 0x86120000,
+    0xFB410402, 0xFA210000, 0xFB410402, 0x8AF80000, 0xFB410402, 0xFA230000, 0xFB410402, 0xFA240000,
+    0xFB410402, 0x90380000, 0xFB410402, 0x90FD0000, 0xFB410402, 0xFA270000, 0xFB410402, 0xFA280000,
+    0xFB410402, 0xFA290000, 0xFB410402, 0x98EF0000, 0xFB410402, 0x98FC0000, 0xFB410402, 0x99280000,
+    0xFB410402, 0x9DB40000, 0xFB410402, 0x90DE0000, 0xFB410402, 0x96B70000, 0xFB400402, 0xCFAE0000,
+    0xFB400402, 0xD0E70000, 0xFB400402, 0xD14D0000, 0xFB400402, 0xD2C90000, 0xFB400402, 0xD2E40000,
+    0xFB400402, 0xD3510000, 0xFB400402, 0xD59D0000, 0xFB400402, 0xD6060000, 0xFB400402, 0xD6680000,
+    0xFB400402, 0xD8400000, 0xFB400402, 0xD8A80000, 0xFB400402, 0xDC640000, 0xFB400402, 0xDC6E0000,
+    0xFB400402, 0xE0940000, 0xFB400402, 0xE1680000, 0xFB400402, 0xE18E0000, 0xFB400402, 0xE1F20000,
+    0xFB400402, 0xE54F0000, 0xFB400402, 0xE5E20000, 0xFB400402, 0xE6910000, 0xFB400402, 0xE8850000,
+    0xFB400402, 0xED770000, 0xFB400402, 0xEE1A0000, 0xFB400402, 0xEF220000, 0xFB400402, 0xF16E0000,
+    0xFB400402, 0xF22B0000, 0xFB400402, 0xF4220000, 0xFB400402, 0xF8910000, 0xFB400402, 0xF93E0000,
+    0xFB400402, 0xF9490000, 0xFB400402, 0xF9480000, 0xFB400402, 0xF9500000, 0xFB400402, 0xF9560000,
+    0xFB400402, 0xF95D0000, 0xFB400402, 0xF98D0000, 0xFB400402, 0xF98E0000, 0xFB400402, 0xFA400000,
+    0xFB400402, 0xFA810000, 0xFB400402, 0xFBC00000, 0xFB400402, 0xFE090000, 0xFB400402, 0xFE410000,
+    0xFB400402, 0xFF720000, 0xFB410402, 0x80050000, 0xFB410402, 0x81ED0000, 0xFB410402, 0x82790000,
+    0xFB410402, 0x84570000, 0xFB410402, 0x89100000, 0xFB410402, 0x89960000, 0xFB410402, 0x8B010000,
+    0xFB410402, 0x8B390000, 0xFB410402, 0x8CD30000, 0xFB410402, 0x8D080000, 0xFB410402, 0x8FB60000,
+    0xFB410402, 0x96E30000, 0xFB410402, 0x97FF0000, 0xFB410402, 0x983B0000, 0xFB400402, 0xE0750000,
+    0xFB840402, 0xC2EE0000, 0xFB410402, 0x82180000, 0xFB400402, 0xCE260000, 0xFB400402, 0xD1B50000,
+    0xFB400402, 0xD1680000, 0xFB400402, 0xCF800000, 0xFB400402, 0xD1450000, 0xFB400402, 0xD1800000,
+    0xFB400402, 0xD2C70000, 0xFB400402, 0xD2FA0000, 0xFB400402, 0xD5550000, 0xFB400402, 0xD5990000,
+    0xFB400402, 0xD5E20000, 0xFB400402, 0xD8B30000, 0xFB400402, 0xD9440000, 0xFB400402, 0xD9540000,
+    0xFB400402, 0xDA620000, 0xFB400402, 0xDB280000, 0xFB400402, 0xDED20000, 0xFB400402, 0xDED90000,
+    0xFB400402, 0xDF690000, 0xFB400402, 0xDFAD0000, 0xFB400402, 0xE0D80000, 0xFB400402, 0xE14E0000,
+    0xFB400402, 0xE1080000, 0xFB400402, 0xE1600000, 0xFB400402, 0xE2340000, 0xFB400402, 0xE3C40000,
+    0xFB400402, 0xE41C0000, 0xFB400402, 0xE4520000, 0xFB400402, 0xE5560000, 0xFB400402, 0xE71B0000,
+    0xFB400402, 0xE7560000, 0xFB400402, 0xEB790000, 0xFB400402, 0xEEDB0000, 0xFB400402, 0xEECB0000,
+    0xFB400402, 0xF01E0000, 0xFB400402, 0xF7A70000, 0xFB400402, 0xF2350000, 0xFB400402, 0xF2AF0000,
+    0xFB400402, 0xF4710000, 0xFB400402, 0xF5060000, 0xFB400402, 0xF53B0000, 0xFB400402, 0xF61D0000,
+    0xFB400402, 0xF61F0000, 0xFB400402, 0xF6DB0000, 0xFB400402, 0xF6F40000, 0xFB400402, 0xF74A0000,
+    0xFB400402, 0xF7400000, 0xFB400402, 0xF8CC0000, 0xFB400402, 0xFAB10000, 0xFB400402, 0xFC7B0000,
+    0xFB400402, 0xFD5B0000, 0xFB400402, 0xFF3E0000, 0xFB410402, 0x83520000, 0xFB410402, 0x83EF0000,
+    0xFB410402, 0x87790000, 0xFB410402, 0x89410000, 0xFB410402, 0x89860000, 0xFB410402, 0x8ABF0000,
+    0xFB410402, 0x8ACB0000, 0xFB410402, 0x8AED0000, 0xFB410402, 0x8B8A0000, 0xFB410402, 0x8F380000,
+    0xFB410402, 0x90720000, 0xFB410402, 0x91990000, 0xFB410402, 0x92760000, 0xFB410402, 0x967C0000,
+    0xFB410402, 0x97DB0000, 0xFB410402, 0x980B0000, 0xFB410402, 0x9B120000, 0xFB840402, 0xA84A0000,
+    0xFB840402, 0xA8440000, 0xFB840402, 0xB3D50000, 0xFB800402, 0xBB9D0000, 0xFB800402, 0xC0180000,
+    0xFB800402, 0xC0390000, 0xFB840402, 0xD2490000, 0xFB840402, 0xDCD00000, 0xFB840402, 0xFED30000,
+    0xFB410402, 0x9F430000, 0xFB410402, 0x9F8E0000, 0x20420404, 0x20420404, 0x20420404, 0x20900404,
+    0x20420404, 0x20D60404, 0x20420404, 0x20420404, 0x20900404, 0x20420404, 0x20420404, 0x20D60404,
+    0x21D20404, 0x00002324, 0x21F70404, 0x21D20404, 0x21F70404, 0x26090404, 0x260C0404, 0x26090404,
+    0x25FA0404, 0x26090404, 0x26000404, 0x26140404, 0x260C0404, 0x26090404, 0x26020404, 0x26270402,
+    0x00000AC2, 0x00000C22, 0x26270404, 0x26270404, 0x00000B22, 0x262D0405, 0x261E0405, 0x26210405,
+    0x26220405, 0x26280405, 0x26290405, 0x262A0405, 0x26310405, 0x26330405, 0x06660405, 0x26320402,
+    0x00000BC2, 0x26320402, 0x00000BA2, 0x26320402, 0x00000BE2, 0x00000BC2, 0x26320402, 0x00000BE2,
+    0x00000BA2, 0x261E0402, 0x00000B22, 0x261E0402, 0x00000B42, 0x261E0402, 0x00000BE2, 0x261F0402,
+    0x00000BE2, 0x26200402, 0x00000BE2, 0x26210402, 0x00000BE2, 0x26220402, 0x00000BE2, 0x26230402,
+    0x00000BE2, 0x26240402, 0x00000BE2, 0x26260402, 0x00000BE2, 0x26270402, 0x00000BE2, 0x26280419,
+    0x00000BE2, 0x26280402, 0x00000BE2, 0x26290402, 0x00000BE2, 0x262A0402, 0x00000BE2, 0x262B0402,
+    0x00000BE2, 0x262C0402, 0x00000BE2, 0x262E0419, 0x00000BE2, 0x262E0402, 0x00000BE2, 0x262F0402,
+    0x00000BE2, 0x26300402, 0x00000BE2, 0x26310402, 0x00000BE2, 0x26320402, 0x00000BE2, 0x26330402,
+    0x00000BE2, 0x26230402, 0x00000B62, 0x261F0402, 0x00000C02, 0x26280402, 0x00000C02, 0x262E0402,
+    0x00000C02, 0x261E0404, 0x26290404, 0x2668041A, 0x26680419, 0x2675041A, 0x26750419, 0x26750417,
+    0x26750418, 0x2676041A, 0x26760419, 0x26760417, 0x26760418, 0x2677041A, 0x26770419, 0x26770417,
+    0x26770418, 0x2688041A, 0x26880419, 0x26880417, 0x26880418, 0x268B041A, 0x268B0419, 0x268B0417,
+    0x268B0418, 0x2687041A, 0x26870419, 0x26870417, 0x26870418, 0x26E9041A, 0x26E90419, 0x26E90417,
+    0x26E90418, 0x26EC041A, 0x26EC0419, 0x26EC0417, 0x26EC0418, 0x2691041A, 0x26910419, 0x26910417,
+    0x26910418, 0x2690041A, 0x26900419, 0x26900417, 0x26900418, 0x2692041A, 0x26920419, 0x26920417,
+    0x26920418, 0x2694041A, 0x26940419, 0x26940417, 0x26940418, 0x26AB041A, 0x26AB0419, 0x26AA041A,
+    0x26AA0419, 0x26AD041A, 0x26AD0419, 0x26A6041A, 0x26A60419, 0x26BC041A, 0x26BC0419, 0x26B5041A,
+    0x26B50419, 0x26F7041A, 0x26F70419, 0x26F70417, 0x26F70418, 0x26FF041A, 0x26FF0419, 0x26FF0417,
+    0x26FF0418, 0x2704041A, 0x27040419, 0x27040417, 0x27040418, 0x2702041A, 0x27020419, 0x27020417,
+    0x27020418, 0x2719041A, 0x27190419, 0x271B041A, 0x271B0419, 0x271B0417, 0x271B0418, 0x2727041A,
+    0x0000107A, 0x27270419, 0x00001079, 0x2724041A, 0x27240419, 0x27240417, 0x27240418, 0x2723041A,
+    0x27230419, 0x27230417, 0x27230418, 0x2745041A, 0x27450419, 0x2745041A, 0x0000107A, 0x27450419,
+    0x00001079, 0x05360402, 0x05370402, 0x05380402, 0x05390402, 0x053A0402, 0x053B0402, 0x053C0402,
+    0x053D0402, 0x053E0402, 0x053F0402, 0x05400402, 0x05410402, 0x05420402, 0x05430402, 0x05440402,
+    0x05450402, 0x26FC041A, 0x26FC0419, 0x26FC0417, 0x26FC0418, 0x272C041A, 0x272C0419, 0x272B041A,
+    0x272B0419, 0x272D041A, 0x272D0419, 0x272C041A, 0x2664041A, 0x2730041A, 0x27300419, 0x272A041A,
+    0x272A0419, 0x272E041A, 0x272E0419, 0x273B041A, 0x273B0419, 0x273B0417, 0x273B0418, 0x27360417,
+    0x27360418, 0x266E041A, 0x2672041A, 0x266E0419, 0x26720419, 0x266E041A, 0x2727041A, 0x266E0419,
+    0x27270419, 0x266E041A, 0x2728041A, 0x266E0419, 0x27280419, 0x266E041A, 0x272C041A, 0x266E0419,
+    0x272C0419, 0x266E041A, 0x272B041A, 0x266E0419, 0x272B0419, 0x266E041A, 0x272D041A, 0x266E0419,
+    0x272D0419, 0x266E041A, 0x273B041A, 0x266E0419, 0x273B0419, 0x266E0417, 0x273B0417, 0x266E041A,
+    0x2736041A, 0x266E0419, 0x27360419, 0x266E0417, 0x27360417, 0x2738041A, 0x27380419, 0x27380417,
+    0x27380418, 0x266E041A, 0x268F041A, 0x266E041A, 0x2699041A, 0x266E041A, 0x2714041A, 0x266E041A,
+    0x2737041A, 0x2674041A, 0x268F041A, 0x2674041A, 0x2699041A, 0x2674041A, 0x269A041A, 0x2674041A,
+    0x2714041A, 0x2674041A, 0x2736041A, 0x2674041A, 0x2737041A, 0x2685041A, 0x268F041A, 0x2685041A,
+    0x2699041A, 0x2685041A, 0x269A041A, 0x2685041A, 0x2714041A, 0x2685041A, 0x2736041A, 0x2685041A,
+    0x2737041A, 0x2686041A, 0x268F041A, 0x2686041A, 0x2714041A, 0x2686041A, 0x2736041A, 0x2686041A,
+    0x2737041A, 0x268F041A, 0x2699041A, 0x268F041A, 0x2714041A, 0x2699041A, 0x268F041A, 0x2699041A,
+    0x2714041A, 0x269A041A, 0x268F041A, 0x269A041A, 0x2699041A, 0x269A041A, 0x2714041A, 0x26C6041A,
+    0x268F041A, 0x26C6041A, 0x2699041A, 0x26C6041A, 0x269A041A, 0x26C6041A, 0x2714041A, 0x26D1041A,
+    0x2699041A, 0x26D1041A, 0x2714041A, 0x26D2041A, 0x268F041A, 0x26D2041A, 0x2699041A, 0x26D2041A,
+    0x269A041A, 0x26D2041A, 0x2714041A, 0x26D7041A, 0x2699041A, 0x26D7041A, 0x2714041A, 0x26D8041A,
+    0x2714041A, 0x26DB041A, 0x268F041A, 0x26DB041A, 0x2714041A, 0x26DC041A, 0x268F041A, 0x26DC041A,
+    0x2714041A, 0x26E4041A, 0x268F041A, 0x26E4041A, 0x2699041A, 0x26E4041A, 0x269A041A, 0x26E4041A,
+    0x2714041A, 0x26E4041A, 0x2736041A, 0x26E4041A, 0x2737041A, 0x26F0041A, 0x2699041A, 0x26F0041A,
+    0x2714041A, 0x26F0041A, 0x2736041A, 0x26F0041A, 0x2737041A, 0x26F6041A, 0x2672041A, 0x26F6041A,
+    0x268F041A, 0x26F6041A, 0x2699041A, 0x26F6041A, 0x269A041A, 0x26F6041A, 0x270C041A, 0x26F6041A,
+    0x2714041A, 0x26F6041A, 0x2736041A, 0x26F6041A, 0x2737041A, 0x270C041A, 0x268F041A, 0x270C041A,
+    0x2699041A, 0x270C041A, 0x269A041A, 0x270C041A, 0x2714041A, 0x270C041A, 0x2736041A, 0x270C041A,
+    0x2737041A, 0x2714041A, 0x268F041A, 0x2714041A, 0x2699041A, 0x2714041A, 0x269A041A, 0x2714041A,
+    0x2714041A, 0x2714041A, 0x2736041A, 0x2714041A, 0x2737041A, 0x2718041A, 0x268F041A, 0x2718041A,
+    0x2699041A, 0x2718041A, 0x269A041A, 0x2718041A, 0x2714041A, 0x2718041A, 0x2736041A, 0x2718041A,
+    0x2737041A, 0x2722041A, 0x268F041A, 0x2722041A, 0x2714041A, 0x2722041A, 0x2736041A, 0x2722041A,
+    0x2737041A, 0x2737041A, 0x268F041A, 0x2737041A, 0x2699041A, 0x2737041A, 0x269A041A, 0x2737041A,
+    0x2714041A, 0x2737041A, 0x2736041A, 0x2737041A, 0x2737041A, 0x26A5041A, 0x0000131A, 0x26B3041A,
+    0x0000131A, 0x2736041A, 0x0000131A, 0x00000E1A, 0x0000101A, 0x00000E7A, 0x0000101A, 0x00000EDA,
+    0x0000101A, 0x00000F5A, 0x0000101A, 0x00000FBA, 0x0000101A, 0x0000101A, 0x0000131A, 0x266E0419,
+    0x26B30419, 0x266E0419, 0x26B40419, 0x266E0419, 0x27140419, 0x266E0419, 0x27180419, 0x266E0419,
+    0x27370419, 0x26740419, 0x26B30419, 0x26740419, 0x26B40419, 0x26740419, 0x27140419, 0x26740419,
+    0x27180419, 0x26740419, 0x27360419, 0x26740419, 0x27370419, 0x26850419, 0x26B30419, 0x26850419,
+    0x26B40419, 0x26850419, 0x27140419, 0x26850419, 0x27180419, 0x26850419, 0x27360419, 0x26850419,
+    0x27370419, 0x26860419, 0x26B30419, 0x26860419, 0x26B40419, 0x26860419, 0x27140419, 0x26860419,
+    0x27180419, 0x26860419, 0x27360419, 0x26860419, 0x27370419, 0x26E40419, 0x27360419, 0x26E40419,
+    0x27370419, 0x26F00419, 0x27360419, 0x26F00419, 0x27370419, 0x26F60419, 0x26720419, 0x26F60419,
+    0x270C0419, 0x26F60419, 0x27140419, 0x26F60419, 0x27360419, 0x26F60419, 0x27370419, 0x270C0419,
+    0x27140419, 0x270C0419, 0x27360419, 0x270C0419, 0x27370419, 0x27140419, 0x26720419, 0x27140419,
+    0x27140419, 0x27180419, 0x26B30419, 0x27180419, 0x26B40419, 0x27180419, 0x27140419, 0x27180419,
+    0x27180419, 0x27180419, 0x27360419, 0x27180419, 0x27370419, 0x27360419, 0x00001319, 0x27370419,
+    0x26B30419, 0x27370419, 0x26B40419, 0x27370419, 0x27140419, 0x27370419, 0x27180419, 0x27370419,
+    0x27360419, 0x27370419, 0x27370419, 0x266E0417, 0x268F0417, 0x266E0417, 0x26990417, 0x266E0417,
+    0x269A0417, 0x266E0417, 0x27140417, 0x266E0417, 0x27220417, 0x26740417, 0x268F0417, 0x26740417,
+    0x26990417, 0x26740417, 0x269A0417, 0x26740417, 0x27140417, 0x26740417, 0x27220417, 0x26850417,
+    0x268F0417, 0x26850417, 0x26990417, 0x26850417, 0x269A0417, 0x26850417, 0x27140417, 0x26850417,
+    0x27220417, 0x26860417, 0x27140417, 0x268F0417, 0x26990417, 0x268F0417, 0x27140417, 0x26990417,
+    0x268F0417, 0x26990417, 0x27140417, 0x269A0417, 0x268F0417, 0x269A0417, 0x27140417, 0x26C60417,
+    0x268F0417, 0x26C60417, 0x26990417, 0x26C60417, 0x269A0417, 0x26C60417, 0x27140417, 0x26D10417,
+    0x26990417, 0x26D10417, 0x269A0417, 0x26D10417, 0x27140417, 0x26D20417, 0x268F0417, 0x26D20417,
+    0x26990417, 0x26D20417, 0x269A0417, 0x26D20417, 0x27140417, 0x26D70417, 0x26990417, 0x26D80417,
+    0x27140417, 0x26DB0417, 0x268F0417, 0x26DB0417, 0x27140417, 0x26DC0417, 0x268F0417, 0x26DC0417,
+    0x27140417, 0x26E40417, 0x268F0417, 0x26E40417, 0x26990417, 0x26E40417, 0x269A0417, 0x26E40417,
+    0x27140417, 0x26F00417, 0x26990417, 0x26F00417, 0x27140417, 0x26F60417, 0x268F0417, 0x26F60417,
+    0x26990417, 0x26F60417, 0x269A0417, 0x26F60417, 0x270C0417, 0x26F60417, 0x27140417, 0x270C0417,
+    0x268F0417, 0x270C0417, 0x26990417, 0x270C0417, 0x269A0417, 0x270C0417, 0x27140417, 0x270C0417,
+    0x27220417, 0x27140417, 0x268F0417, 0x27140417, 0x26990417, 0x27140417, 0x269A0417, 0x27140417,
+    0x27140417, 0x27180417, 0x268F0417, 0x27180417, 0x26990417, 0x27180417, 0x269A0417, 0x27180417,
+    0x27140417, 0x27180417, 0x27220417, 0x27220417, 0x268F0417, 0x27220417, 0x27140417, 0x27220417,
+    0x00001317, 0x27370417, 0x268F0417, 0x27370417, 0x26990417, 0x27370417, 0x269A0417, 0x27370417,
+    0x27140417, 0x27370417, 0x27220417, 0x266E0418, 0x27140418, 0x266E0418, 0x27220418, 0x26740418,
+    0x27140418, 0x26740418, 0x27220418, 0x26850418, 0x27140418, 0x26850418, 0x27220418, 0x26860418,
+    0x27140418, 0x26860418, 0x27220418, 0x26C60418, 0x27140418, 0x26C60418, 0x27220418, 0x26C70418,
+    0x27140418, 0x26C70418, 0x27220418, 0x26F60418, 0x270C0418, 0x26F60418, 0x27140418, 0x270C0418,
+    0x27140418, 0x27180418, 0x27140418, 0x27180418, 0x27220418, 0x27370418, 0x27140418, 0x27370418,
+    0x27220418, 0x00000ED8, 0x00001018, 0x00000F58, 0x00001018, 0x00000FB8, 0x00001018, 0x26D7041A,
+    0x2736041A, 0x26D7041A, 0x2737041A, 0x26DB041A, 0x2736041A, 0x26DB041A, 0x2737041A, 0x26DC041A,
+    0x2736041A, 0x26DC041A, 0x2737041A, 0x26C6041A, 0x2736041A, 0x26C6041A, 0x2737041A, 0x26C7041A,
+    0x2736041A, 0x26C7041A, 0x2737041A, 0x2699041A, 0x2736041A, 0x2699041A, 0x2737041A, 0x268F041A,
+    0x2736041A, 0x268F041A, 0x2737041A, 0x269A041A, 0x2736041A, 0x269A041A, 0x2737041A, 0x26D1041A,
+    0x2736041A, 0x26D1041A, 0x2737041A, 0x26D2041A, 0x2736041A, 0x26D2041A, 0x2737041A, 0x26C7041A,
+    0x268F041A, 0x26C7041A, 0x2699041A, 0x26C7041A, 0x269A041A, 0x26C7041A, 0x2714041A, 0x26C7041A,
+    0x26B3041A, 0x26C6041A, 0x26B3041A, 0x26D1041A, 0x26B3041A, 0x26D2041A, 0x26B3041A, 0x26D70419,
+    0x27360419, 0x26D70419, 0x27370419, 0x26DB0419, 0x27360419, 0x26DB0419, 0x27370419, 0x26DC0419,
+    0x27360419, 0x26DC0419, 0x27370419, 0x26C60419, 0x27360419, 0x26C60419, 0x27370419, 0x26C70419,
+    0x27360419, 0x26C70419, 0x27370419, 0x26990419, 0x27360419, 0x26990419, 0x27370419, 0x268F0419,
+    0x27360419, 0x268F0419, 0x27370419, 0x269A0419, 0x27360419, 0x269A0419, 0x27370419, 0x26D10419,
+    0x27360419, 0x26D10419, 0x27370419, 0x26D20419, 0x27360419, 0x26D20419, 0x27370419, 0x26C70419,
+    0x268F0419, 0x26C70419, 0x26990419, 0x26C70419, 0x269A0419, 0x26C70419, 0x27140419, 0x26C70419,
+    0x26B30419, 0x26C60419, 0x26B30419, 0x26D10419, 0x26B30419, 0x26D20419, 0x26B30419, 0x26C70417,
+    0x268F0417, 0x26C70417, 0x26990417, 0x26C70417, 0x269A0417, 0x26C70417, 0x27140417, 0x26C60417,
+    0x27220417, 0x26C70417, 0x27220417, 0x26D70417, 0x27140417, 0x26C60418, 0x268F0418, 0x26C60418,
+    0x26990418, 0x26C60418, 0x269A0418, 0x26C70418, 0x268F0418, 0x26C70418, 0x26990418, 0x26C70418,
+    0x269A0418, 0x26D70418, 0x27140418, 0x26D80418, 0x27140418, 0x26720419, 0x00000DB9, 0x2672041A,
+    0x00000DBA, 0x03920402, 0x03930402, 0x26850417, 0x268F0417, 0x27140417, 0x26850419, 0x26990419,
+    0x268F0419, 0x26850417, 0x26990417, 0x268F0417, 0x26850417, 0x26990417, 0x27140417, 0x26850417,
+    0x269A0417, 0x27140417, 0x26850417, 0x27140417, 0x268F0417, 0x26850417, 0x27140417, 0x26990417,
+    0x26850417, 0x27140417, 0x269A0417, 0x268F0419, 0x27140419, 0x26990419, 0x268F0417, 0x27140417,
+    0x26990417, 0x26990419, 0x27140419, 0x27370419, 0x26990419, 0x27140419, 0x27360419, 0x26C60417,
+    0x26990417, 0x268F0417, 0x26C60417, 0x268F0417, 0x26990417, 0x26C60419, 0x268F0419, 0x27360419,
+    0x26C60419, 0x27140419, 0x26990419, 0x26C60417, 0x27140417, 0x26990417, 0x26C60417, 0x27140417,
+    0x268F0417, 0x26C60419, 0x27140419, 0x27140419, 0x26C60417, 0x27140417, 0x27140417, 0x26D10419,
+    0x26990419, 0x26990419, 0x26D10417, 0x26990417, 0x26990417, 0x26D10419, 0x27140419, 0x27140419,
+    0x26C70419, 0x26990419, 0x27140419, 0x26C70417, 0x26990417, 0x27140417, 0x26C70419, 0x268F0419,
+    0x27370419, 0x26C70419, 0x27140419, 0x269A0419, 0x26C70417, 0x27140417, 0x269A0417, 0x26C70419,
+    0x27140419, 0x27140419, 0x26C70417, 0x27140417, 0x27140417, 0x26D20419, 0x26990419, 0x27360419,
+    0x26D20419, 0x269A0419, 0x27140419, 0x26D20417, 0x269A0417, 0x27140417, 0x26D70419, 0x27140419,
+    0x26990419, 0x26D70417, 0x27140417, 0x26990417, 0x26D70417, 0x27140417, 0x27140417, 0x26D70419,
+    0x27140419, 0x27370419, 0x26DB0419, 0x268F0419, 0x27140419, 0x26DB0419, 0x27140419, 0x27140419,
+    0x26DB0417, 0x27140417, 0x27140417, 0x26DB0419, 0x27140419, 0x27360419, 0x26DC0419, 0x27140419,
+    0x27140419, 0x26DC0419, 0x27140419, 0x27370419, 0x26DC0419, 0x27140419, 0x27360419, 0x26E40419,
+    0x269A0419, 0x27140419, 0x26E40417, 0x269A0417, 0x27140417, 0x26F00419, 0x27140419, 0x26990419,
+    0x26F00419, 0x27140419, 0x27140419, 0x270C0419, 0x26990419, 0x27140419, 0x270C0419, 0x26990419,
+    0x27370419, 0x270C0419, 0x26990419, 0x27360419, 0x270C0417, 0x268F0417, 0x268F0417, 0x270C0419,
+    0x268F0419, 0x268F0419, 0x270C0419, 0x269A0419, 0x27140419, 0x270C0417, 0x269A0417, 0x27140417,
+    0x270C0419, 0x27140419, 0x26990419, 0x270C0417, 0x27140417, 0x26990417, 0x27140417, 0x26990417,
+    0x268F0417, 0x27140417, 0x26990417, 0x27140417, 0x27140419, 0x26990419, 0x27370419, 0x27140417,
+    0x268F0417, 0x26990417, 0x27140417, 0x268F0417, 0x27140417, 0x27140417, 0x269A0417, 0x268F0417,
+    0x27140417, 0x269A0417, 0x27140417, 0x27140417, 0x268F0417, 0x269A0417, 0x27220417, 0x27140417,
+    0x268F0417, 0x27220417, 0x27140417, 0x27140417, 0x27180417, 0x26990417, 0x27140417, 0x27180419,
+    0x26990419, 0x27360419, 0x27180419, 0x268F0419, 0x27140419, 0x27180417, 0x268F0417, 0x27140417,
+    0x27180419, 0x268F0419, 0x27360419, 0x27180419, 0x27140419, 0x27370419, 0x27180419, 0x27140419,
+    0x27360419, 0x27370419, 0x27140419, 0x27140419, 0x27370417, 0x27140417, 0x27140417, 0x26740419,
+    0x269A0419, 0x27370419, 0x26850419, 0x268F0419, 0x27370419, 0x26850419, 0x268F0419, 0x27360419,
+    0x26850419, 0x269A0419, 0x27370419, 0x26850419, 0x269A0419, 0x27360419, 0x26850419, 0x27140419,
+    0x27370419, 0x26850419, 0x27140419, 0x27360419, 0x268F0419, 0x27140419, 0x27370419, 0x268F0419,
+    0x26990419, 0x27360419, 0x268F0419, 0x27140419, 0x27360419, 0x26C60419, 0x269A0419, 0x27360419,
+    0x26D10419, 0x26990419, 0x27370419, 0x26C70419, 0x26990419, 0x27370419, 0x26D20419, 0x26990419,
+    0x27370419, 0x270C0419, 0x268F0419, 0x27370419, 0x270C0419, 0x27140419, 0x27370419, 0x27370419,
+    0x26990419, 0x27370419, 0x27370419, 0x268F0419, 0x27370419, 0x27370419, 0x27140419, 0x27370419,
+    0x27140419, 0x27140419, 0x27370419, 0x26F00419, 0x27140419, 0x27370419, 0x27180419, 0x26990419,
+    0x27370419, 0x26F00417, 0x27140417, 0x26990417, 0x270C0417, 0x26990417, 0x27140417, 0x26DB0419,
+    0x27140419, 0x27370419, 0x26F60419, 0x27140419, 0x27370419, 0x27180417, 0x268F0417, 0x26990417,
+    0x27140419, 0x269A0419, 0x27370419, 0x270C0417, 0x268F0417, 0x27140417, 0x26F60419, 0x27140419,
+    0x27140419, 0x270C0419, 0x268F0419, 0x27140419, 0x27180419, 0x268F0419, 0x26990419, 0x268F0419,
+    0x26990419, 0x27370419, 0x26990419, 0x268F0419, 0x27370419, 0x27140419, 0x268F0419, 0x27370419,
+    0x26E40419, 0x27140419, 0x27370419, 0x26740419, 0x26990419, 0x27370419, 0x26F60417, 0x27140417,
+    0x27140417, 0x26DB0417, 0x268F0417, 0x27140417, 0x26D10417, 0x27140417, 0x27140417, 0x26C60419,
+    0x269A0419, 0x27370419, 0x27180419, 0x268F0419, 0x27370419, 0x26D1041A, 0x270C041A, 0x2745041A,
+    0x26F0041A, 0x270C041A, 0x2745041A, 0x2672041A, 0x270C041A, 0x270C041A, 0x2722041A, 0x2672041A,
+    0x26F6041A, 0x2674041A, 0x26B3041A, 0x2714041A, 0x2699041A, 0x2714041A, 0x26A4041A, 0x26D1041A,
+    0x270C041A, 0x26DB041A, 0x2714041A, 0x26B3041A, 0x26C6041A, 0x2728041A, 0x270C041A, 0x26DB041A,
+    0x270C041A, 0x2737041A, 0x2722041A, 0x2728041A, 0x26C6041A, 0x270C041A, 0x2714041A, 0x26D1041A,
+    0x270C041A, 0x2736041A, 0x26D1041A, 0x270C041A, 0x2736041A, 0x0209041A, 0x2672041A, 0x270C041A,
+    0x270C041A, 0x2722041A, 0x0209041A, 0x26DB041A, 0x270C041A, 0x2737041A, 0x2722041A, 0x0209041A,
+    0x2728041A, 0x26C6041A, 0x270C041A, 0x2714041A, 0x268F041A, 0x270C041A, 0x0209041A, 0x268F041A,
+    0x270C041A, 0x2672041A, 0x270C041A, 0x2722041A, 0x26B3041A, 0x2738041A, 0x2672041A, 0x270C041A,
+    0x05350402, 0x02230416, 0x02360416, 0x02920416, 0x02400416, 0x023A0416, 0x02670416, 0x026D0416,
+    0x038C0416, 0x038D0416, 0x027E0416, 0x027E0416, 0x027E0416, 0x027E0416, 0x027E0416, 0x02160416,
+    0x02150416, 0x020B0416, 0x03280416, 0x03290416, 0x032C0416, 0x032D0416, 0x038A0416, 0x038B0416,
+    0x03880416, 0x03890416, 0x03820416, 0x03830416, 0x03800416, 0x03810416, 0x03840416, 0x03850416,
+    0x03860416, 0x03870416, 0x02370402, 0x02380402, 0x032A0416, 0x032B0416, 0x020A0404, 0x020B0404,
+    0x0223040F, 0x0236040F, 0x027E040F, 0x023A040F, 0x0240040F, 0x026D040F, 0x0267040F, 0x0216040F,
+    0x0328040F, 0x0329040F, 0x032C040F, 0x032D040F, 0x038A040F, 0x038B040F, 0x03AC040F, 0x03A9040F,
+    0x03A1040F, 0x0666040F, 0x020D040F, 0x066A040F, 0x066C040F, 0x066B040F, 0x03A7040F, 0x1F64040F,
+    0x03AD040F, 0x03A0040F, 0x00000DBA, 0x00000DB8, 0x00000E1A, 0x00000E7A, 0x00000EDA, 0x00000ED8,
+    0x00000F5A, 0x00000F58, 0x00000FBA, 0x00000FB8, 0x0000101A, 0x00001018, 0x0000103A, 0x00001038,
+    0x2664041A, 0x2665041A, 0x26650419, 0x2666041A, 0x26660419, 0x2669041A, 0x26690419, 0x266A041A,
+    0x266A0419, 0x266E041A, 0x266E0419, 0x266E0417, 0x266E0418, 0x2672041A, 0x26720419, 0x2674041A,
+    0x26740419, 0x26740417, 0x26740418, 0x2684041A, 0x26840419, 0x2685041A, 0x26850419, 0x26850417,
+    0x26850418, 0x2686041A, 0x26860419, 0x26860417, 0x26860418, 0x268F041A, 0x268F0419, 0x268F0417,
+    0x268F0418, 0x2699041A, 0x26990419, 0x26990417, 0x26990418, 0x269A041A, 0x269A0419, 0x269A0417,
+    0x269A0418, 0x26A4041A, 0x26A40419, 0x26A5041A, 0x26A50419, 0x26B3041A, 0x26B30419, 0x26B4041A,
+    0x26B40419, 0x26C6041A, 0x26C60419, 0x26C60417, 0x26C60418, 0x26C7041A, 0x26C70419, 0x26C70417,
+    0x26C70418, 0x26D1041A, 0x26D10419, 0x26D10417, 0x26D10418, 0x26D2041A, 0x26D20419, 0x26D20417,
+    0x26D20418, 0x26D7041A, 0x26D70419, 0x26D70417, 0x26D70418, 0x26D8041A, 0x26D80419, 0x26D80417,
+    0x26D80418, 0x26DB041A, 0x26DB0419, 0x26DB0417, 0x26DB0418, 0x26DC041A, 0x26DC0419, 0x26DC0417,
+    0x26DC0418, 0x26E4041A, 0x26E40419, 0x26E40417, 0x26E40418, 0x26F0041A, 0x26F00419, 0x26F00417,
+    0x26F00418, 0x26F6041A, 0x26F60419, 0x26F60417, 0x26F60418, 0x270C041A, 0x270C0419, 0x270C0417,
+    0x270C0418, 0x2714041A, 0x27140419, 0x27140417, 0x27140418, 0x2718041A, 0x27180419, 0x27180417,
+    0x27180418, 0x2722041A, 0x27220419, 0x27220417, 0x27220418, 0x2728041A, 0x27280419, 0x2736041A,
+    0x27360419, 0x2737041A, 0x27370419, 0x27370417, 0x27370418, 0x270C041A, 0x2665041A, 0x270C0419,
+    0x26650419, 0x270C041A, 0x2666041A, 0x270C0419, 0x26660419, 0x270C041A, 0x266A041A, 0x270C0419,
+    0x266A0419, 0x270C041A, 0x2672041A, 0x270C0419, 0x26720419, 0x02670403, 0x031D0403, 0x03AC0403,
+    0x1F640403, 0x03AD0403, 0x03A90403, 0x03160403, 0x03280403, 0x03290403, 0x03A10403, 0x06660403,
+    0x02230403, 0x020D0403, 0x027E0403, 0x03A60403, 0x1F980403, 0x1F990403, 0x1F9A0403, 0x1F9B0403,
+    0x1F9C0403, 0x1F9D0403, 0x1F9E0403, 0x1F9F0403, 0x1FA00403, 0x1FA10403, 0x02400403, 0x023A0403,
+    0x066A0403, 0x066B0403, 0x066C0403, 0x026D0403, 0x03A00403, 0x1FA20409, 0x1FBC0409, 0x1FD60409,
+    0x1FEB0409, 0x20070409, 0x20420409, 0x20510409, 0x20750409, 0x20900409, 0x20AB0409, 0x20C40409,
+    0x20D60409, 0x21090409, 0x21180409, 0x213C0409, 0x216B0409, 0x21800409, 0x21930409, 0x21D20409,
+    0x21F70409, 0x22170409, 0x22470409, 0x22590409, 0x22640409, 0x22700409, 0x22860409, 0x032A0403,
+    0x03A70403, 0x032B0403, 0x04B70403, 0x020B0403, 0x04B40403, 0x1FA20403, 0x1FBC0403, 0x1FD60403,
+    0x1FEB0403, 0x20070403, 0x20420403, 0x20510403, 0x20750403, 0x20900403, 0x20AB0403, 0x20C40403,
+    0x20D60403, 0x21090403, 0x21180403, 0x213C0403, 0x216B0403, 0x21800403, 0x21930403, 0x21D20403,
+    0x21F70403, 0x22170403, 0x22470403, 0x22590403, 0x22640403, 0x22700403, 0x22860403, 0x032C0403,
+    0x066E0403, 0x032D0403, 0x06700403, 0x033E0403, 0x033F0403, 0x02920412, 0x03840412, 0x03850412,
+    0x02360412, 0x02210412, 0x43090412, 0x42DA0410, 0x42DB0410, 0x42DC0410, 0x42DE0410, 0x42DF0410,
+    0x42FE0410, 0x42FF0410, 0x43000410, 0x42EC0410, 0x1F600412, 0x42DA0412, 0x42DB0412, 0x42DC0412,
+    0x42DE0412, 0x42DF0412, 0x42E00412, 0x42E10412, 0x42E20412, 0x42E30412, 0x42E40412, 0x42E50412,
+    0x42E60412, 0x42E70412, 0x42E80412, 0x42E90412, 0x42EA0412, 0x42EB0412, 0x42EC0412, 0x42ED0412,
+    0x42EE0412, 0x42EF0412, 0x42F00412, 0x42F10412, 0x42F20412, 0x42F30412, 0x42F40412, 0x42F50412,
+    0x42F60412, 0x42F70412, 0x42F80412, 0x42F90412, 0x42FA0412, 0x42FB0412, 0x42FC0412, 0x42FD0412,
+    0x42FE0412, 0x42FF0412, 0x43000412, 0x43010412, 0x43020412, 0x43030412, 0x43040412, 0x43050412,
+    0x43060412, 0x430A0412, 0x000006F2, 0x00000712, 0x41F20412, 0x41750412, 0x41760412, 0x42530412,
+    0x41770412, 0x42550412, 0x42560412, 0x41780412, 0x41790412, 0x417A0412, 0x42590412, 0x425A0412,
+    0x425B0412, 0x425C0412, 0x425D0412, 0x425E0412, 0x418F0412, 0x417B0412, 0x417C0412, 0x417D0412,
+    0x41960412, 0x417E0412, 0x417F0412, 0x41800412, 0x41810412, 0x41820412, 0x41830412, 0x41840412,
+    0x41850412, 0x41860412, 0x41870412, 0x41F30412, 0x41F40412, 0x41F50412, 0x41F60412, 0x41F70412,
+    0x41F80412, 0x41F90412, 0x41FA0412, 0x41FB0412, 0x41FC0412, 0x41FD0412, 0x41FE0412, 0x41FF0412,
+    0x42000412, 0x42010412, 0x42020412, 0x42030412, 0x42040412, 0x42050412, 0x42060412, 0x42070412,
+    0x1F630403, 0x1F650403, 0x066D0403, 0x04B80403, 0x066F0403, 0x1F660403, 0x1F800403, 0x086B0412,
+    0x05EC0412, 0x05EE0412, 0x05ED0412, 0x05EF0412, 0x09090412, 0x09340412, 0x1D550402, 0xFFFD0402,
+    0x4CFC0402, 0x4CFD0402, 0x4CFE0402, 0x4CFF0402, 0x4D000402, 0x4D010402, 0x4D020402, 0x4D030402,
+    0x4D040402, 0x4D050402, 0x4D060402, 0x4D070402, 0x4D080402, 0x4D090402, 0x4D0A0402, 0x4D0B0402,
+    0x4D0C0402, 0x4D0D0402, 0x4D0E0402, 0x4D0F0402, 0x4D100402, 0x4D110402, 0x4D120402, 0x4D130402,
+    0x4D140402, 0x4D150402, 0x4D160402, 0x4D170402, 0x4D180402, 0x4D190402, 0x4D1A0402, 0x4D1B0402,
+    0x4D1C0402, 0x4D1D0402, 0x4D1E0402, 0x4D1F0402, 0x4D200402, 0x4D210402, 0x4D220402, 0x4D230402,
+    0x4D240402, 0x4D250402, 0x4D260402, 0x4D270402, 0x4D280402, 0x4D290402, 0x4D2A0402, 0x4D2B0402,
+    0x4D2C0402, 0x4D2D0402, 0x4D2E0402, 0x4D2F0402, 0x4D300402, 0x4D310402, 0x4D320402, 0x4D330402,
+    0x4D340402, 0x4D350402, 0x4D360402, 0x4D370402, 0x4D380402, 0x4D390402, 0x4D3A0402, 0x4D3B0402,
+    0x4D3C0402, 0x4D3D0402, 0x4D3E0402, 0x4D3F0402, 0x4D400402, 0x4D410402, 0x4D420402, 0x4D430402,
+    0x4D440402, 0x4D450402, 0x4D460402, 0x4D470402, 0x4D480402, 0x4D490402, 0x4D4A0402, 0x4D4B0402,
+    0x4D4C0402, 0x4D4D0402, 0x4D4E0402, 0x4D4F0402, 0x4D500402, 0x4D510402, 0x4D520402, 0x4D530402,
+    0x4D540402, 0x4D550402, 0x4D560402, 0x4D570402, 0x4D580402, 0x4D590402, 0x4D5A0402, 0x4D5B0402,
+    0x4D5C0402, 0x4D5D0402, 0x4D5E0402, 0x4D5F0402, 0x4D600402, 0x4D610402, 0x4D620402, 0x4D630402,
+    0x4D640402, 0x4D650402, 0x4D660402, 0x4D670402, 0x4D680402, 0x4D690402, 0x4D6A0402, 0x4D6B0402,
+    0x4D6C0402, 0x4D6D0402, 0x4D6E0402, 0x4D6F0402, 0x4D700402, 0x4D710402, 0x4D720402, 0x4D730402,
+    0x4D740402, 0x4D750402, 0x4D760402, 0x4D770402, 0x4D780402, 0x4D790402, 0x4D7A0402, 0x4D7B0402,
+    0x4D7C0402, 0x4D7D0402, 0x4D7E0402, 0x4D7F0402, 0x4D800402, 0x4D810402, 0x4D820402, 0x4D830402,
+    0x4D840402, 0x4D850402, 0x4D860402, 0x4D870402, 0x4D880402, 0x4D890402, 0x4D8A0402, 0x4D8B0402,
+    0x4D8C0402, 0x4D8D0402, 0x4D8E0402, 0x4D8F0402, 0x4D900402, 0x4D910402, 0x4D920402, 0x4D930402,
+    0x4D940402, 0x4D950402, 0x4D960402, 0x4D970402, 0x4D980402, 0x4D990402, 0x4D9A0402, 0x4D9B0402,
+    0x4D9C0402, 0x4D9D0402, 0x4D9E0402, 0x4D9F0402, 0x4DA00402, 0x4DA10402, 0x4DA20402, 0x4DA30402,
+    0x4DA40402, 0x4DA50402, 0x4DA60402, 0x4DA70402, 0x4DA80402, 0x4DA90402, 0x4DAA0402, 0x4DAB0402,
+    0x4DAC0402, 0x4DAD0402, 0x4DAE0402, 0x4DAF0402, 0x4DB00402, 0x4DB10402, 0x4DB20402, 0x4DB30402,
+    0x4DB40402, 0x4DB50402, 0x4DB60402, 0x4DB70402, 0x4DB80402, 0x4DB90402, 0x4DBA0402, 0x4DBB0402,
+    0x4DBC0402, 0x4DBD0402, 0x4DBE0402, 0x4DBF0402, 0x4DC00402, 0x4DC10402, 0x4DC20402, 0x4DC30402,
+    0x4DC40402, 0x4DC50402, 0x4DC60402, 0x4DC70402, 0x4DC80402, 0x4DC90402, 0x4DCA0402, 0x4DCB0402,
+    0x4DCC0402, 0x4DCD0402, 0x4DCE0402, 0x030B0402, 0x030C0402, 0x030D0402, 0x1DBE0402, 0x1DBF0402,
+    0x1DC00402, 0x1DC10402, 0x1DC20402, 0x1DC30402, 0x1DC40402, 0x1DC50402, 0x1DC60402, 0x1DC70402,
+    0x1DC80402, 0x1DC90402, 0x1DCA0402, 0x1DCB0402, 0x1DCC0402, 0x1DCD0402, 0x1DCE0402, 0x1DCF0402,
+    0x1DD00402, 0x1DD10402, 0x1DD20402, 0x1DD30402, 0x1DD40402, 0x1DD50402, 0x1DD60402, 0x1DD70402,
+    0x1DD80402, 0x1DD90402, 0x1DDA0402, 0x1DDB0402, 0x1DDC0402, 0x1DDD0402, 0x1DDE0402, 0x1DDF0402,
+    0x1DE00402, 0x1DE10402, 0x10C40402, 0x10C50402, 0x10C60402, 0x10C70402, 0x10C80402, 0x10C90402,
+    0x10CA0402, 0x10CB0402, 0x10CC0402, 0x1DE20402, 0x1DE30402, 0x1DE40402, 0x1DE50402, 0x1DE60402,
+    0x1DE70402, 0x1DE80402, 0x1DE90402, 0x1DEA0402, 0x1DEB0402, 0x1DEC0402, 0x1DED0402, 0x1DEE0402,
+    0x1DEF0402, 0x1DF00402, 0x1DF10402, 0x1DF20402, 0x1DF30402, 0x1DF40402, 0x1DF50402, 0x1DF60402,
+    0x1DF70402, 0x1DF80402, 0x1DF90402, 0x1DFA0402, 0x1DFB0402, 0x1DFC0402, 0x1DFD0402, 0x1DFE0402,
+    0x1DFF0402, 0x1E000402, 0x1E010402, 0x1E020402, 0x1E030402, 0x1E040402, 0x1E050402, 0x1E060402,
+    0x1E070402, 0x1E080402, 0x1E090402, 0x1E0A0402, 0x1E0B0402, 0x1E0C0402, 0x1E0D0402, 0x10CD0402,
+    0x10CE0402, 0x10CF0402, 0x10D00402, 0x10D10402, 0x10D20402, 0x10D30402, 0x10D40402, 0x10D50402,
+    0x10D60402, 0x10D70402, 0x10D80402, 0x10D90402, 0x10DA0402, 0x10DB0402, 0x10DC0402, 0x10DD0402,
+    0x1E0E0402, 0x10DE0402, 0x10DF0402, 0x10E00402, 0x10E10402, 0x10E20402, 0x10E30402, 0x10E40402,
+    0x10E50402, 0x10E60402, 0x10E70402, 0x10E80402, 0x10E90402, 0x10EA0402, 0x10EB0402, 0x10EC0402,
+    0x10ED0402, 0x10EE0402, 0x10EF0402, 0x10F00402, 0x10F10402, 0x10F20402, 0x10F30402, 0x10F40402,
+    0x10F50402, 0x10F60402, 0x10F70402, 0x10F80402, 0x10F90402, 0x10FA0402, 0x10FB0402, 0x10FC0402,
+    0x10FD0402, 0x10FE0402, 0x10FF0402, 0x11000402, 0x11010402, 0x11020402, 0x11030402, 0x11040402,
+    0x11050402, 0x11060402, 0x11070402, 0x11080402, 0x11090402, 0x110A0402, 0x110B0402, 0x110C0402,
+    0x110D0402, 0x110E0402, 0x110F0402, 0x11100402, 0x11110402, 0x11120402, 0x11130402, 0x11140402,
+    0x11150402, 0x11160402, 0x11170402, 0x11180402, 0x11190402, 0x111A0402, 0x111B0402, 0x000022E2,
+    0x4AC10402, 0x4AC20402, 0x4AC30402, 0x4AC40402, 0x4AC50402, 0x4AC60402, 0x4AC70402, 0x4AC80402,
+    0x4AC90402, 0x4ACA0402, 0x4ACB0402, 0x4ACC0402, 0x4ACD0402, 0x4ACE0402, 0x4ACF0402, 0x4AD00402,
+    0x4AD10402, 0x4AD20402, 0x4AD30402, 0x4AD40402, 0x4AD50402, 0x4AD60402, 0x4AD70402, 0x4AD80402,
+    0x4AD90402, 0x4ADA0402, 0x4ADB0402, 0x4ADC0402, 0x4ADD0402, 0x4ADE0402, 0x4ADF0402, 0x4AE00402,
+    0x4AE10402, 0x4AE20402, 0x4AE30402, 0x4AE40402, 0x4AE50402, 0x4AE60402, 0x4AE70402, 0x4AE80402,
+    0x4AE90402, 0x4AEA0402, 0x4AEB0402, 0x4AEC0402, 0x4AED0402, 0x4AEE0402, 0x4AEF0402, 0x4AF00402,
+    0x4AF10402, 0x4AF20402, 0x4AF30402, 0x4AF40402, 0x4AF50402, 0x4AF60402, 0x4AF70402, 0x4AF80402,
+    0x4AF90402, 0x4AFA0402, 0x4AFB0402, 0x4AFC0402, 0x4AFD0402, 0x4AFE0402, 0x4AFF0402, 0x4B000402,
+    0x4B010402, 0x4B020402, 0x4B030402, 0x4B040402, 0x4B050402, 0x4B060402, 0x4B070402, 0x4B080402,
+    0x4B090402, 0x4B0A0402, 0x4B0B0402, 0x4B0C0402, 0x4B0D0402, 0x4B0E0402, 0x1E0F0402, 0x1E100402,
+    0x1E110402, 0x1E120402, 0x1E130402, 0x1E140402, 0x1E150402, 0x1E160402, 0x1E170402, 0x1E180402,
+    0x1E190402, 0x1E1A0402, 0x1E1B0402, 0x1E1C0402, 0x1E1D0402, 0x1E1E0402, 0x1E1F0402, 0x1E200402,
+    0x4B290402, 0x4B2A0402, 0x4B2B0402, 0x4B2C0402, 0x4B2D0402, 0x4B2E0402, 0x4B2F0402, 0x4B300402,
+    0x4B310402, 0x4B320402, 0x4B330402, 0x4B340402, 0x4B350402, 0x4B360402, 0x4B370402, 0x4B390402,
+    0x4B3A0402, 0x4B3B0402, 0x4B3C0402, 0x4B3D0402, 0x4B3E0402, 0x4B3F0402, 0x4B400402, 0x4B410402,
+    0x4B420402, 0x4B430402, 0x4B440402, 0x4B450402, 0x4B460402, 0x4B470402, 0x4B480402, 0x4B380402,
+    0x1DB80402, 0x1DB90402, 0x4B490402, 0x4B4A0402, 0x4B4B0402, 0x4B4C0402, 0x4B4D0402, 0x4B4E0402,
+    0x4B4F0402, 0x4B500402, 0x4B510402, 0x4B520402, 0x4B530402, 0x4B540402, 0x4B550402, 0x4B560402,
+    0x4B570402, 0x4B580402, 0x4B590402, 0x4B5A0402, 0x4B5B0402, 0x4B5C0402, 0x4B5D0402, 0x4B5E0402,
+    0x4B5F0402, 0x4B600402, 0x4B610402, 0x4B620402, 0x4B630402, 0x4B640402, 0x4B650402, 0x4B660402,
+    0x25790402, 0x257A0402, 0x257B0402, 0x257C0402, 0x257D0402, 0x257E0402, 0x257F0402, 0x25800402,
+    0x25810402, 0x25820402, 0x25830402, 0x25840402, 0x25850402, 0x25860402, 0x25870402, 0x25880402,
+    0x25890402, 0x258A0402, 0x258B0402, 0x258C0402, 0x258D0402, 0x258E0402, 0x258F0402, 0x25900402,
+    0x25910402, 0x25920402, 0x25930402, 0x25940402, 0x25950402, 0x25960402, 0x25970402, 0x25980402,
+    0x25990402, 0x259A0402, 0x259B0402, 0x259C0402, 0x259D0402, 0x259E0402, 0x25790404, 0x257C0404,
+    0x25800404, 0x25860404, 0x258A0404, 0x50FF0402, 0x51000402, 0x51010402, 0x51020402, 0x51030402,
+    0x51040402, 0x51050402, 0x51060402, 0x51070402, 0x51080402, 0x51090402, 0x510A0402, 0x510B0402,
+    0x510C0402, 0x510D0402, 0x510E0402, 0x510F0402, 0x51100402, 0x51110402, 0x51120402, 0x51130402,
+    0x51140402, 0x51150402, 0x51160402, 0x51170402, 0x51180402, 0x51190402, 0x511A0402, 0x511B0402,
+    0x511C0402, 0x030E0402, 0x511D0402, 0x511E0402, 0x511F0402, 0x51200402, 0x51210402, 0x51220402,
+    0x51230402, 0x51240402, 0x51250402, 0x51260402, 0x51270402, 0x51280402, 0x51290402, 0x512A0402,
+    0x512B0402, 0x512C0402, 0x512D0402, 0x512E0402, 0x512F0402, 0x51300402, 0x51310402, 0x51320402,
+    0x51330402, 0x51340402, 0x51350402, 0x51360402, 0x51370402, 0x51380402, 0x51390402, 0x513A0402,
+    0x513B0402, 0x513C0402, 0x513D0402, 0x513E0402, 0x513F0402, 0x51400402, 0x51410402, 0x51420402,
+    0x51430402, 0x51440402, 0x51450402, 0x51460402, 0x51470402, 0x51480402, 0x030F0402, 0x1E210402,
+    0x1E220402, 0x1E230402, 0x4B670408, 0x4B680408, 0x4B690408, 0x4B6A0408, 0x4B6B0408, 0x4B6C0408,
+    0x4B6D0408, 0x4B6E0408, 0x4B6F0408, 0x4B700408, 0x4B710408, 0x4B720408, 0x4B730408, 0x4B740408,
+    0x4B750408, 0x4B760408, 0x4B770408, 0x4B780408, 0x4B790408, 0x4B7A0408, 0x4B7B0408, 0x4B7C0408,
+    0x4B7D0408, 0x4B7E0408, 0x4B7F0408, 0x4B800408, 0x4B810408, 0x4B820408, 0x4B830408, 0x4B840408,
+    0x4B850408, 0x4B860408, 0x4B870408, 0x4B880408, 0x4B890408, 0x4B8A0408, 0x4B8B0408, 0x4B8C0408,
+    0x4B8D0408, 0x4B8E0408, 0x4B670402, 0x4B680402, 0x4B690402, 0x4B6A0402, 0x4B6B0402, 0x4B6C0402,
+    0x4B6D0402, 0x4B6E0402, 0x4B6F0402, 0x4B700402, 0x4B710402, 0x4B720402, 0x4B730402, 0x4B740402,
+    0x4B750402, 0x4B760402, 0x4B770402, 0x4B780402, 0x4B790402, 0x4B7A0402, 0x4B7B0402, 0x4B7C0402,
+    0x4B7D0402, 0x4B7E0402, 0x4B7F0402, 0x4B800402, 0x4B810402, 0x4B820402, 0x4B830402, 0x4B840402,
+    0x4B850402, 0x4B860402, 0x4B870402, 0x4B880402, 0x4B890402, 0x4B8A0402, 0x4B8B0402, 0x4B8C0402,
+    0x4B8D0402, 0x4B8E0402, 0x4B8F0402, 0x4B900402, 0x4B910402, 0x4B920402, 0x4B930402, 0x4B940402,
+    0x4B950402, 0x4B960402, 0x4B970402, 0x4B980402, 0x4B990402, 0x4B9A0402, 0x4B9B0402, 0x4B9C0402,
+    0x4B9D0402, 0x4B9E0402, 0x4B9F0402, 0x4BA00402, 0x4BA10402, 0x4BA20402, 0x4BA30402, 0x4BA40402,
+    0x4BA50402, 0x4BA60402, 0x4BA70402, 0x4BA80402, 0x4BA90402, 0x4BAA0402, 0x4BAB0402, 0x4BAC0402,
+    0x4BAD0402, 0x4BAE0402, 0x4BAF0402, 0x4BB00402, 0x4BB10402, 0x4BB20402, 0x4BB30402, 0x4BB40402,
+    0x4BB50402, 0x4BB60402, 0x4BB70402, 0x4BB80402, 0x4BB90402, 0x4BBA0402, 0x4BBB0402, 0x4BBC0402,
+    0x4BBD0402, 0x4BBE0402, 0x4C4A0402, 0x4C4B0402, 0x4C4C0402, 0x4C4D0402, 0x4C4E0402, 0x4C4F0402,
+    0x4C500402, 0x4C510402, 0x4C520402, 0x4C530402, 0x4C540402, 0x4C550402, 0x4C560402, 0x4C570402,
+    0x4C580402, 0x4C590402, 0x4C5A0402, 0x4C5B0402, 0x4C5C0402, 0x4C5D0402, 0x4C5E0402, 0x4C5F0402,
+    0x4C600402, 0x4C610402, 0x4C620402, 0x4C630402, 0x4C640402, 0x4C650402, 0x4C660402, 0x4C670402,
+    0x39340408, 0x39350408, 0x39360408, 0x39370408, 0x39380408, 0x39390408, 0x393A0408, 0x393B0408,
+    0x393C0408, 0x393D0408, 0x393E0408, 0x393F0408, 0x39400408, 0x39410408, 0x39420408, 0x39430408,
+    0x39440408, 0x39450408, 0x39460408, 0x39470408, 0x39480408, 0x39490408, 0x394A0408, 0x394B0408,
+    0x394C0408, 0x394D0408, 0x394E0408, 0x394F0408, 0x39500408, 0x39510408, 0x39520408, 0x39530408,
+    0x39540408, 0x39550408, 0x39560408, 0x39570408, 0x39340402, 0x39350402, 0x39360402, 0x39370402,
+    0x39380402, 0x39390402, 0x393A0402, 0x393B0402, 0x393C0402, 0x393D0402, 0x393E0402, 0x393F0402,
+    0x39400402, 0x39410402, 0x39420402, 0x39430402, 0x39440402, 0x39450402, 0x39460402, 0x39470402,
+    0x39480402, 0x39490402, 0x394A0402, 0x394B0402, 0x394C0402, 0x394D0402, 0x394E0402, 0x394F0402,
+    0x39500402, 0x39510402, 0x39520402, 0x39530402, 0x39540402, 0x39550402, 0x39560402, 0x39570402,
+    0x4C680402, 0x4C690402, 0x4C6A0402, 0x4C6B0402, 0x4C6C0402, 0x4C6D0402, 0x4C6E0402, 0x4C6F0402,
+    0x4C700402, 0x4C710402, 0x4C720402, 0x4C730402, 0x4C740402, 0x4C750402, 0x4C760402, 0x4C770402,
+    0x4C780402, 0x4C790402, 0x4C7A0402, 0x4C7B0402, 0x4C7C0402, 0x4C7D0402, 0x4C7E0402, 0x4C7F0402,
+    0x4C800402, 0x4C810402, 0x4C820402, 0x4C830402, 0x4C840402, 0x4C850402, 0x4C860402, 0x4C870402,
+    0x4C880402, 0x4C890402, 0x4C8A0402, 0x4C8B0402, 0x4C8C0402, 0x4C8D0402, 0x4C8E0402, 0x4C8F0402,
+    0x4C900402, 0x4C910402, 0x4C920402, 0x4C930402, 0x4C940402, 0x4C950402, 0x4C960402, 0x4C970402,
+    0x4C980402, 0x4C990402, 0x4C9A0402, 0x4C9B0402, 0x4C9C0402, 0x4C9D0402, 0x4C9E0402, 0x4C9F0402,
+    0x4CA00402, 0x4CA10402, 0x4CA20402, 0x4CA30402, 0x4CA40402, 0x4CA50402, 0x4CA60402, 0x4CA70402,
+    0x4CA80402, 0x4CA90402, 0x4CAA0402, 0x4CAB0402, 0x4CAC0402, 0x4CAD0402, 0x4CAE0402, 0x4CAF0402,
+    0x4CB00402, 0x4CB10402, 0x4CB20402, 0x4CB30402, 0x4CB40402, 0x4CB50402, 0x4CB60402, 0x4CB70402,
+    0x4CB80402, 0x4CB90402, 0x4CBA0402, 0x4CBB0402, 0x4CBC0402, 0x4CBD0402, 0x4CBE0402, 0x4CBF0402,
+    0x4CC00402, 0x4CC10402, 0x4CC20402, 0x4CC30402, 0x045E0402, 0x4DCF0402, 0x4DD00402, 0x4DD10402,
+    0x4DD20402, 0x4DD30402, 0x4DD40402, 0x4DD50402, 0x4DD60402, 0x4DD70402, 0x4DD80402, 0x4DD90402,
+    0x4DDA0402, 0x4DDB0402, 0x4DDC0402, 0x4DDD0402, 0x4DDE0402, 0x4DDF0402, 0x4DE00402, 0x4DE10402,
+    0x4DE20402, 0x4DE30402, 0x4DE40402, 0x4DE50402, 0x4DE60402, 0x4DE70402, 0x4DE80402, 0x4DE90402,
+    0x4DEA0402, 0x4DEB0402, 0x4DEC0402, 0x4DED0402, 0x4DEE0402, 0x4DEF0402, 0x4DF00402, 0x4DF10402,
+    0x4DF20402, 0x4DF30402, 0x4DF40402, 0x4DF50402, 0x4DF60402, 0x4DF70402, 0x4DF80402, 0x4DF90402,
+    0x4DFA0402, 0x4DFB0402, 0x4DFC0402, 0x4DFD0402, 0x4DFE0402, 0x4DFF0402, 0x4E000402, 0x4E010402,
+    0x4E020402, 0x4E030402, 0x4E040402, 0x4E050402, 0x4E060402, 0x4E070402, 0x4E080402, 0x4E090402,
+    0x4E0A0402, 0x4E0B0402, 0x4E0C0402, 0x4E0D0402, 0x4E0E0402, 0x4E0F0402, 0x4E100402, 0x4E110402,
+    0x4E120402, 0x4E130402, 0x4E140402, 0x4E150402, 0x4E160402, 0x4E170402, 0x4E180402, 0x4E190402,
+    0x4E1A0402, 0x4E1B0402, 0x4E1C0402, 0x4E1D0402, 0x4E1E0402, 0x4E1F0402, 0x4E200402, 0x4E210402,
+    0x4E220402, 0x4E230402, 0x4E240402, 0x4E250402, 0x4E260402, 0x4E270402, 0x4E280402, 0x4E290402,
+    0x4E2A0402, 0x4E2B0402, 0x4E2C0402, 0x4E2D0402, 0x4E2E0402, 0x4E2F0402, 0x4E300402, 0x4E310402,
+    0x4E320402, 0x4E330402, 0x4E340402, 0x4E350402, 0x4E360402, 0x4E370402, 0x4E380402, 0x4E390402,
+    0x4E3A0402, 0x4E3B0402, 0x4E3C0402, 0x4E3D0402, 0x4E3E0402, 0x4E3F0402, 0x4E400402, 0x4E410402,
+    0x4E420402, 0x4E430402, 0x4E440402, 0x4E450402, 0x4E460402, 0x4E470402, 0x4E480402, 0x4E490402,
+    0x4E4A0402, 0x4E4B0402, 0x4E4C0402, 0x4E4D0402, 0x4E4E0402, 0x4E4F0402, 0x4E500402, 0x4E510402,
+    0x4E520402, 0x4E530402, 0x4E540402, 0x4E550402, 0x4E560402, 0x4E570402, 0x4E580402, 0x4E590402,
+    0x4E5A0402, 0x4E5B0402, 0x4E5C0402, 0x4E5D0402, 0x4E5E0402, 0x4E5F0402, 0x4E600402, 0x4E610402,
+    0x4E620402, 0x4E630402, 0x4E640402, 0x4E650402, 0x4E660402, 0x4E670402, 0x4E680402, 0x4E690402,
+    0x4E6A0402, 0x4E6B0402, 0x4E6C0402, 0x4E6D0402, 0x4E6E0402, 0x4E6F0402, 0x4E700402, 0x4E710402,
+    0x4E720402, 0x4E730402, 0x4E740402, 0x4E750402, 0x4E760402, 0x4E770402, 0x4E780402, 0x4E790402,
+    0x4E7A0402, 0x4E7B0402, 0x4E7C0402, 0x4E7D0402, 0x4E7E0402, 0x4E7F0402, 0x4E800402, 0x4E810402,
+    0x4E820402, 0x4E830402, 0x4E840402, 0x4E850402, 0x4E860402, 0x4E870402, 0x4E880402, 0x4E890402,
+    0x4E8A0402, 0x4E8B0402, 0x4E8C0402, 0x4E8D0402, 0x4E8E0402, 0x4E8F0402, 0x4E900402, 0x4E910402,
+    0x4E920402, 0x4E930402, 0x4E940402, 0x4E950402, 0x4E960402, 0x4E970402, 0x4E980402, 0x4E990402,
+    0x4E9A0402, 0x4E9B0402, 0x4E9C0402, 0x4E9D0402, 0x4E9E0402, 0x4E9F0402, 0x4EA00402, 0x4EA10402,
+    0x4EA20402, 0x4EA30402, 0x4EA40402, 0x4EA50402, 0x4EA60402, 0x4EA70402, 0x4EA80402, 0x4EA90402,
+    0x4EAA0402, 0x4EAB0402, 0x4EAC0402, 0x4EAD0402, 0x4EAE0402, 0x4EAF0402, 0x4EB00402, 0x4EB10402,
+    0x4EB20402, 0x4EB30402, 0x4EB40402, 0x4EB50402, 0x4EB60402, 0x4EB70402, 0x4EB80402, 0x4EB90402,
+    0x4EBA0402, 0x4EBB0402, 0x4EBC0402, 0x4EBD0402, 0x4EBE0402, 0x4EBF0402, 0x4EC00402, 0x4EC10402,
+    0x4EC20402, 0x4EC30402, 0x4EC40402, 0x4EC50402, 0x4EC60402, 0x4EC70402, 0x4EC80402, 0x4EC90402,
+    0x4ECA0402, 0x4ECB0402, 0x4ECC0402, 0x4ECD0402, 0x4ECE0402, 0x4ECF0402, 0x4ED00402, 0x4ED10402,
+    0x4ED20402, 0x4ED30402, 0x4ED40402, 0x4ED50402, 0x4ED60402, 0x4ED70402, 0x4ED80402, 0x4ED90402,
+    0x4EDA0402, 0x4EDB0402, 0x4EDC0402, 0x4EDD0402, 0x4EDE0402, 0x4EDF0402, 0x4EE00402, 0x4EE10402,
+    0x4EE20402, 0x4EE30402, 0x4EE40402, 0x4EE50402, 0x4EE60402, 0x4EE70402, 0x4EE80402, 0x4EE90402,
+    0x4EEA0402, 0x4EEB0402, 0x4EEC0402, 0x4EED0402, 0x4EEE0402, 0x4EEF0402, 0x4EF00402, 0x4EF10402,
+    0x4EF20402, 0x4EF30402, 0x4EF40402, 0x4EF50402, 0x4EF60402, 0x4EF70402, 0x4EF80402, 0x4EF90402,
+    0x4EFA0402, 0x4EFB0402, 0x4EFC0402, 0x4EFD0402, 0x4EFE0402, 0x4EFF0402, 0x4F000402, 0x4F010402,
+    0x4F020402, 0x4F030402, 0x4F040402, 0x4F050402, 0x4F060402, 0x4F070402, 0x4F080402, 0x4F090402,
+    0x4F0A0402, 0x4F0B0402, 0x4F0C0402, 0x4F0D0402, 0x4F0E0402, 0x4F0F0402, 0x4F100402, 0x4F110402,
+    0x4F120402, 0x4F130402, 0x4F140402, 0x4F150402, 0x4F160402, 0x4F170402, 0x4F180402, 0x4F190402,
+    0x4F1A0402, 0x4F1B0402, 0x4F1C0402, 0x4F1D0402, 0x4F1E0402, 0x4F1F0402, 0x4F200402, 0x4F210402,
+    0x4F220402, 0x4F230402, 0x4F240402, 0x4F250402, 0x4F260402, 0x4F270402, 0x4F280402, 0x4F290402,
+    0x4F2A0402, 0x4F2B0402, 0x4F2C0402, 0x4F2D0402, 0x4F2E0402, 0x4F2F0402, 0x4F300402, 0x4F310402,
+    0x4F320402, 0x4F330402, 0x4F340402, 0x4F350402, 0x4F360402, 0x4F370402, 0x4F380402, 0x4F390402,
+    0x4F3A0402, 0x4F3B0402, 0x4F3C0402, 0x4F3D0402, 0x4F3E0402, 0x4F3F0402, 0x4F400402, 0x4F410402,
+    0x4F420402, 0x4F430402, 0x4F440402, 0x4F450402, 0x4F460402, 0x4F470402, 0x4F480402, 0x4F490402,
+    0x4F4A0402, 0x4F4B0402, 0x4F4C0402, 0x4F4D0402, 0x4F4E0402, 0x4F4F0402, 0x4F500402, 0x4F510402,
+    0x4F520402, 0x4F530402, 0x4F540402, 0x4F550402, 0x4F560402, 0x4F570402, 0x4F580402, 0x4F590402,
+    0x4F5A0402, 0x500B0402, 0x500C0402, 0x500D0402, 0x500E0402, 0x500F0402, 0x50100402, 0x50110402,
+    0x50120402, 0x50130402, 0x50140402, 0x50150402, 0x50160402, 0x50170402, 0x50180402, 0x50190402,
+    0x501A0402, 0x501B0402, 0x501C0402, 0x501D0402, 0x501E0402, 0x501F0402, 0x50200402, 0x02E20402,
+    0x1E330402, 0x1E340402, 0x1E350402, 0x1E360402, 0x1E370402, 0x4FCA0402, 0x4FCB0402, 0x4FCC0402,
+    0x4FCD0402, 0x4FCE0402, 0x4FCF0402, 0x4FD00402, 0x4FD10402, 0x4FD20402, 0x4FD30402, 0x4FD40402,
+    0x4FD50402, 0x4FD60402, 0x4FD70419, 0x4FD70402, 0x4FD80402, 0x4FD90402, 0x4FDA0402, 0x4FDB0402,
+    0x4FDC0402, 0x4FDD0402, 0x4FDE0402, 0x4FDF0402, 0x111C0402, 0x111D0402, 0x1E240402, 0x1E250402,
+    0x4FE00419, 0x4FE00402, 0x4FE10419, 0x4FE10402, 0x4FE20402, 0x4FE30402, 0x4FE40419, 0x4FE40402,
+    0x4FE50402, 0x4FE60402, 0x4FE70402, 0x4FE80402, 0x4FE90419, 0x4FE90402, 0x4FEA0419, 0x4FEA0402,
+    0x4FEB0419, 0x4FEB0402, 0x4FEC0419, 0x4FEC0402, 0x4FED0419, 0x4FED0402, 0x4FEE0402, 0x4FEF0402,
+    0x4FF00402, 0x4FF10402, 0x4FF20402, 0x4FF30402, 0x4FF40419, 0x4FF40402, 0x4FF50402, 0x1E260402,
+    0x1E270402, 0x1E280402, 0x4FF60402, 0x4FF70402, 0x4FF80402, 0x4FF90402, 0x4FFA0402, 0x4FFB0402,
+    0x4FFC0402, 0x4FFD0402, 0x4FFE0402, 0x4FFF0402, 0x50000402, 0x50010402, 0x50020402, 0x50030402,
+    0x50040402, 0x50050402, 0x50060402, 0x50070402, 0x50080402, 0x50090402, 0x500A0402, 0x1E290402,
+    0x1E2A0402, 0x1E2B0402, 0x26340402, 0x26350402, 0x26360402, 0x26370402, 0x26380402, 0x26390402,
+    0x263A0402, 0x263B0402, 0x263C0402, 0x263D0402, 0x263E0402, 0x263F0402, 0x26400402, 0x26410402,
+    0x26420402, 0x26430402, 0x26440402, 0x26450402, 0x26460402, 0x26470402, 0x26480402, 0x26490402,
+    0x1E300402, 0x1E310402, 0x1E320402, 0x03100402, 0x4B0F0402, 0x4B100402, 0x4B110402, 0x4B120402,
+    0x4B130402, 0x4B140402, 0x4B150402, 0x4B160402, 0x4B170402, 0x4B180402, 0x4B190402, 0x4B1A0402,
+    0x4B1B0402, 0x4B1C0402, 0x4B1D0402, 0x4B1E0402, 0x4B1F0402, 0x4B200402, 0x4B210402, 0x4B220402,
+    0x4B230402, 0x4B240402, 0x4B250402, 0x4B260402, 0x4B270402, 0x4B280402, 0x030A0402, 0x59D60404,
+    0x00002304, 0x59D70404, 0x00002304, 0x59D80404, 0x00002304, 0x59D90404, 0x00002304, 0x59DA0404,
+    0x00002304, 0x59DB0404, 0x00002304, 0x59DC0404, 0x00002304, 0x59DC0404, 0x00002324, 0x59DD0404,
+    0x00002304, 0x59DE0404, 0x00002304, 0x59DF0404, 0x00002304, 0x59DF0404, 0x00002324, 0x59E00404,
+    0x00002304, 0x59E00404, 0x00002324, 0x59E10404, 0x00002304, 0x59E10404, 0x00002324, 0x59E20404,
+    0x00002304, 0x59E30404, 0x00002304, 0x59E40404, 0x00002304, 0x59E50404, 0x00002324, 0x59E50404,
+    0x00002344, 0x59E60404, 0x00002304, 0x59E70404, 0x00002304, 0x59E80404, 0x00002304, 0x59E90404,
+    0x00002304, 0x59E90404, 0x00002324, 0x59EA0404, 0x00002304, 0x59EA0404, 0x00002324, 0x59EB0404,
+    0x00002304, 0x59EC0404, 0x00002304, 0x59EF0402, 0x59F00402, 0x59D60402, 0x59D70402, 0x59D80402,
+    0x59D90402, 0x59DA0402, 0x59DB0402, 0x59DC0402, 0x59DD0402, 0x59DE0402, 0x59DF0402, 0x59E00402,
+    0x59E10402, 0x59E20402, 0x59E30402, 0x59E40402, 0x59E50402, 0x59E50404, 0x00002304, 0x59E60402,
+    0x59E70402, 0x59E80402, 0x59E90402, 0x59EA0402, 0x59EB0402, 0x59EC0402, 0x1F2B0402, 0x1F200402,
+    0x59ED0402, 0x59EE0402, 0x1EF50402, 0x1EF60402, 0x1EF70402, 0x1EF80402, 0x1EF90402, 0x1EFA0402,
+    0x1EFB0402, 0x1EFC0402, 0x1EFD0402, 0x1EFE0402, 0x1EFF0402, 0x1F000402, 0x1F010402, 0x1F020402,
+    0x1F030402, 0x1F040402, 0x1F050402, 0x1F060402, 0x1F070402, 0x1F080402, 0x1F090402, 0x1F0A0402,
+    0x1F0B0402, 0x1F0C0402, 0x1F0D0402, 0x1F0E0402, 0x1F0F0402, 0x1F100402, 0x1F110402, 0x1F120402,
+    0x1F130402, 0x1F140402, 0x1F150402, 0x1F160402, 0x1F170402, 0x1F180402, 0x1F190402, 0x1F1A0402,
+    0x1F1B0402, 0x1F1C0402, 0x1F1D0402, 0x1F1E0402, 0x1F1F0402, 0x1F210402, 0x1F220402, 0x1F230402,
+    0x1F240402, 0x1F250402, 0x1F260402, 0x1F270402, 0x1F280402, 0x1F290402, 0x1F2A0402, 0x31AF0402,
+    0x31B00402, 0x31B10402, 0x31B20402, 0x31B30402, 0x31B40402, 0x31B50402, 0x31B60402, 0x31B80402,
+    0x31B90402, 0x31BA0402, 0x31BB0402, 0x31BC0402, 0x31BD0402, 0x31BE0402, 0x31BF0402, 0x31C10402,
+    0x31C30402, 0x31C40402, 0x31C50402, 0x31C60402, 0x31C70402, 0x31C80402, 0x31C90402, 0x31CA0402,
+    0x31CB0402, 0x31CC0402, 0x31CD0402, 0x31CE0402, 0x31CF0402, 0x31D00402, 0x31D10402, 0x31D20402,
+    0x31D30402, 0x31D50402, 0x31D60402, 0x31D70402, 0x31D80402, 0x31D90402, 0x31B70402, 0x31C20402,
+    0x31C00402, 0x31D40402, 0x000019A2, 0x000019C2, 0x000019E2, 0x31DA0402, 0x1E5E0402, 0x1E5F0402,
+    0x1E600402, 0x1E610402, 0x1E620402, 0x04640402, 0x04650402, 0x04660402, 0x04670402, 0x04680402,
+    0x04690402, 0x02B20402, 0x02B30402, 0x046A0402, 0x4F5B0402, 0x4F5C0402, 0x4F5D0402, 0x4F5E0402,
+    0x4F5F0402, 0x4F600402, 0x4F610402, 0x4F620402, 0x4F630402, 0x4F640402, 0x4F650402, 0x4F660402,
+    0x4F670402, 0x4F680402, 0x4F690402, 0x4F6A0402, 0x4F6B0402, 0x4F6C0402, 0x4F6D0402, 0x4F6E0402,
+    0x4F6F0402, 0x4F700402, 0x4F710402, 0x4F720402, 0x4F730402, 0x4F740402, 0x4F750402, 0x4F760402,
+    0x4F770402, 0x1E2C0402, 0x1E2D0402, 0x4F780402, 0x4F790402, 0x4F7A0402, 0x4F7B0402, 0x4F7C0402,
+    0x4F7D0402, 0x4F7E0402, 0x4F7F0402, 0x4F800402, 0x4F810402, 0x4F820402, 0x4F830402, 0x4F840402,
+    0x4F850402, 0x4F860402, 0x4F870402, 0x4F880402, 0x4F890402, 0x4F8A0402, 0x4F8B0402, 0x4F8C0402,
+    0x4F8D0402, 0x4F8E0402, 0x4F8F0402, 0x4F900402, 0x4F910402, 0x4F920402, 0x4F930402, 0x4F940402,
+    0x1E2E0402, 0x1E2F0402, 0x50720402, 0x50730402, 0x50740402, 0x50750402, 0x50760402, 0x50770402,
+    0x50780402, 0x50790402, 0x50790404, 0x00002324, 0x507A0402, 0x507B0402, 0x507C0402, 0x507D0402,
+    0x507E0402, 0x507F0402, 0x50800402, 0x50810402, 0x50820402, 0x50830402, 0x50840402, 0x50850402,
+    0x50860402, 0x50870402, 0x50880402, 0x50890402, 0x508A0402, 0x508B0402, 0x508C0402, 0x508D0402,
+    0x508E0402, 0x508F0402, 0x50900402, 0x50910402, 0x50920402, 0x50930402, 0x50940402, 0x50950402,
+    0x1E380402, 0x1E390402, 0x1E3A0402, 0x046F0402, 0x04700402, 0x04710402, 0x04720402, 0x04730402,
+    0x04740402, 0x04750402, 0x4F950402, 0x4F960402, 0x4F970402, 0x4F980402, 0x4F990402, 0x4F9A0402,
+    0x4F9B0402, 0x4F9C0402, 0x4F9D0402, 0x4F9E0402, 0x4F9F0402, 0x4FA00402, 0x4FA10402, 0x4FA20402,
+    0x4FA30402, 0x4FA40402, 0x4FA50402, 0x4FA60402, 0x4FA70402, 0x4FA80402, 0x4FA90402, 0x4FAA0402,
+    0x4FAB0402, 0x4FAC0402, 0x4FAD0402, 0x4FAE0402, 0x4FAF0402, 0x4FB00402, 0x4FB10402, 0x4FB20402,
+    0x4FB30402, 0x4FB40402, 0x4FB50402, 0x4FB60402, 0x4FB70402, 0x4FB80402, 0x4FB90402, 0x4FBA0402,
+    0x4FBB0402, 0x4FBC0402, 0x4FBD0402, 0x4FBE0402, 0x4FBF0402, 0x4FC00402, 0x4FC10402, 0x4FC20402,
+    0x4FC20404, 0x00002304, 0x4FC30402, 0x4FC40402, 0x4FC50402, 0x4FC60402, 0x4FC70402, 0x4FC80402,
+    0x4FC90402, 0x046E0402, 0x02E30402, 0x02E40402, 0x02E50402, 0x02E60402, 0x02E70402, 0x02E80402,
+    0x50210402, 0x50220402, 0x50230402, 0x50240402, 0x50250402, 0x50260402, 0x50270402, 0x50280402,
+    0x50290402, 0x502A0402, 0x502B0402, 0x502C0402, 0x502D0402, 0x502E0402, 0x502F0402, 0x50300402,
+    0x50310402, 0x50320402, 0x50330402, 0x50340402, 0x50350402, 0x50360402, 0x1E3B0402, 0x1E3C0402,
+    0x1E3D0402, 0x1E3E0402, 0x50370402, 0x50380402, 0x50390402, 0x503A0402, 0x503B0402, 0x503C0402,
+    0x503D0402, 0x503E0402, 0x503F0402, 0x50400402, 0x50410402, 0x50420402, 0x50430402, 0x50440402,
+    0x50450402, 0x50460402, 0x50470402, 0x50480402, 0x50490402, 0x1E3F0402, 0x1E400402, 0x1E410402,
+    0x1E420402, 0x504A0402, 0x504B0402, 0x504C0402, 0x504D0402, 0x504E0402, 0x504F0402, 0x50500402,
+    0x50510402, 0x50520402, 0x50530402, 0x50540402, 0x50550402, 0x50560402, 0x50570402, 0x50580402,
+    0x50590402, 0x505A0402, 0x505B0402, 0x04760402, 0x04770402, 0x04780402, 0x04790402, 0x1E430402,
+    0x1E440402, 0x1E450402, 0x3C8C0402, 0x3C8C0404, 0x00002304, 0x3C8D0402, 0x3C8E0402, 0x3C8E0404,
+    0x00002304, 0x3C8F0402, 0x3C900402, 0x3C910402, 0x3C910404, 0x00002304, 0x3C920402, 0x3C920404,
+    0x00002304, 0x3C930402, 0x3C930404, 0x00002304, 0x3C940402, 0x3C940404, 0x00002304, 0x3C950402,
+    0x3C950404, 0x00002304, 0x3C960402, 0x3C960404, 0x00002304, 0x3C970402, 0x3C980402, 0x3C980404,
+    0x00002304, 0x3C990402, 0x3C990404, 0x00002304, 0x3C9A0402, 0x3C9A0404, 0x00002304, 0x3C9B0402,
+    0x3C9B0404, 0x00002304, 0x3C9C0402, 0x3C9C0404, 0x00002304, 0x3C9D0402, 0x3C9D0404, 0x00002304,
+    0x3C9E0402, 0x3C9F0402, 0x3CA00402, 0x3CA10402, 0x3CA20402, 0x3CA20404, 0x00002304, 0x3CA30402,
+    0x3CA30404, 0x00002304, 0x3CA40402, 0x3CA40404, 0x00002304, 0x3CA50402, 0x3CA50404, 0x00002304,
+    0x3CA60402, 0x3CA70402, 0x3CA70404, 0x00002304, 0x3CA80402, 0x3CA90402, 0x3CAA0402, 0x3CAB0402,
+    0x3CAB0404, 0x00002304, 0x3CAC0402, 0x3CAC0404, 0x00002304, 0x3CAD0402, 0x3CAD0404, 0x00002304,
+    0x3CAE0402, 0x3CAE0404, 0x00002304, 0x3CAF0402, 0x3CAF0404, 0x00002304, 0x3CB00402, 0x3CB10402,
+    0x3CB20402, 0x3CB30402, 0x3CB30404, 0x00002304, 0x3CB40402, 0x3CB40404, 0x00002304, 0x3CB50402,
+    0x3CB50404, 0x00002304, 0x3CB60402, 0x3CB60404, 0x00002304, 0x3CB70402, 0x3CB80402, 0x3C630408,
+    0x3C63040A, 0x00002304, 0x3C640408, 0x3C650408, 0x3C660408, 0x3C670408, 0x3C680408, 0x3C690408,
+    0x3C6A0408, 0x3C6B0408, 0x3C6B040A, 0x00002304, 0x3C6B040A, 0x00002324, 0x3C6C0408, 0x3C6D0408,
+    0x3C6E0408, 0x3C6F0408, 0x3C700408, 0x3C70040A, 0x00002304, 0x3C710408, 0x3C720408, 0x3C730408,
+    0x3C740408, 0x3C750408, 0x3C760408, 0x3C770408, 0x3C780408, 0x3C790408, 0x3C7A0408, 0x3C7A040A,
+    0x00002304, 0x3C7B0408, 0x3C7B040A, 0x00002304, 0x3C7B040A, 0x00002324, 0x3C7C0408, 0x3C7D0408,
+    0x3C7E0408, 0x3C7E040A, 0x00002304, 0x3C7F0408, 0x3C800408, 0x3C810408, 0x3C820408, 0x3C830408,
+    0x3C840408, 0x3C850408, 0x3C85040A, 0x00002304, 0x3C860408, 0x3C86040A, 0x00002304, 0x3C870408,
+    0x3C880408, 0x3C890408, 0x3C8A0408, 0x3C8B0408, 0x3C630402, 0x3C630404, 0x00002304, 0x3C640402,
+    0x3C650402, 0x3C660402, 0x3C670402, 0x3C680402, 0x3C690402, 0x3C6A0402, 0x3C6B0402, 0x3C6B0404,
+    0x00002304, 0x3C6B0404, 0x00002324, 0x3C6C0402, 0x3C6D0402, 0x3C6E0402, 0x3C6F0402, 0x3C700402,
+    0x3C700404, 0x00002304, 0x3C710402, 0x3C720402, 0x3C730402, 0x3C740402, 0x3C750402, 0x3C760402,
+    0x3C770402, 0x3C780402, 0x3C790402, 0x3C7A0402, 0x3C7A0404, 0x00002304, 0x3C7B0402, 0x3C7B0404,
+    0x00002304, 0x3C7B0404, 0x00002324, 0x3C7C0402, 0x3C7D0402, 0x3C7E0402, 0x3C7E0404, 0x00002304,
+    0x3C7F0402, 0x3C800402, 0x3C810402, 0x3C820402, 0x3C830402, 0x3C840402, 0x3C850402, 0x3C850404,
+    0x00002304, 0x3C860402, 0x3C860404, 0x00002304, 0x3C870402, 0x3C880402, 0x3C890402, 0x3C8A0402,
+    0x3C8B0402, 0x1DBA0402, 0x1DBB0402, 0x1DBC0402, 0x1DBD0402, 0x361B0402, 0x36210402, 0x36220402,
+    0x36230402, 0x36240402, 0x36250402, 0x36260402, 0x36270402, 0x36280402, 0x36290402, 0x362A0402,
+    0x362B0402, 0x362C0402, 0x362D0402, 0x362E0402, 0x362F0402, 0x36300402, 0x36310402, 0x36320402,
+    0x36330402, 0x36340402, 0x36350402, 0x36360402, 0x36370402, 0x36380402, 0x36390402, 0x363A0402,
+    0x363B0402, 0x363C0402, 0x361C0402, 0x361D0402, 0x361E0402, 0x361F0402, 0x36200402, 0x363D0402,
+    0x363E0402, 0x1DA10402, 0x1DA20402, 0x1DA30402, 0x1DA40402, 0x1DA50402, 0x1DA60402, 0x1DA70402,
+    0x1DA80402, 0x1DA90402, 0x1DAA0402, 0x1DAB0402, 0x1DAC0402, 0x1DAD0402, 0x1DAE0402, 0x1DAF0402,
+    0x1DB00402, 0x1DB10402, 0x1DB20402, 0x1DB30402, 0x1DB40402, 0x1DB50402, 0x1DB60402, 0x50BE0402,
+    0x50BF0402, 0x50C00402, 0x50C10402, 0x50C20402, 0x50C30402, 0x50C40402, 0x50C50402, 0x50C60402,
+    0x50C70402, 0x50C80402, 0x50C90402, 0x50CA0402, 0x50CB0402, 0x50CC0402, 0x50CD0402, 0x50CE0402,
+    0x50CF0402, 0x50D00402, 0x50D10402, 0x50D20402, 0x50D30402, 0x50D40402, 0x50D50402, 0x50D60402,
+    0x50D70402, 0x50D80402, 0x50D90402, 0x50DA0402, 0x50DB0402, 0x50DC0402, 0x50DD0402, 0x50DE0402,
+    0x50E00402, 0x50E10402, 0x50E20402, 0x50E30402, 0x50E40402, 0x50E50402, 0x50E60402, 0x50E70402,
+    0x50E90402, 0x02220402, 0x50DF0402, 0x50E80402, 0x50960402, 0x50960419, 0x50970402, 0x50970419,
+    0x50980402, 0x50990402, 0x50990419, 0x509A0402, 0x509B0402, 0x509C0402, 0x509D0402, 0x509E0402,
+    0x509F0402, 0x50A00402, 0x50A10402, 0x50A10419, 0x50A10404, 0x00002324, 0x50A20402, 0x50A30402,
+    0x50A30404, 0x00002324, 0x50A40402, 0x50A50402, 0x50A50419, 0x50A50404, 0x00002324, 0x50A60402,
+    0x50A70402, 0x50A80402, 0x50A80419, 0x50A80404, 0x00002324, 0x1E460402, 0x1E470402, 0x1E480402,
+    0x1E490402, 0x1E4A0402, 0x50A30404, 0x50A60404, 0x50A90402, 0x50AA0402, 0x50AB0402, 0x50AC0402,
+    0x50AD0402, 0x50AE0402, 0x50AF0402, 0x50B00402, 0x50B10402, 0x50B20402, 0x50B30402, 0x50B40402,
+    0x50B50402, 0x50B60402, 0x50B70402, 0x50B80402, 0x50B90402, 0x50BA0402, 0x50BB0402, 0x50BC0402,
+    0x50BD0402, 0x50BA0404, 0x00002324, 0x1E4B0402, 0x1E4C0402, 0x1E4D0402, 0x02E90402, 0x02EA0402,
+    0x02EB0402, 0x02EC0402, 0x02ED0402, 0x50EA0402, 0x50EB0402, 0x50EC0402, 0x50ED0402, 0x50EE0402,
+    0x50EF0402, 0x50F00402, 0x50F10402, 0x50F20402, 0x50F30402, 0x50F40402, 0x50F50402, 0x50F60402,
+    0x50F70402, 0x50F80402, 0x50F90402, 0x50FA0402, 0x50FB0402, 0x50FC0402, 0x50FD0402, 0x50FE0402,
+    0x1E4E0402, 0x1E4F0402, 0x1E500402, 0x505C0402, 0x505D0402, 0x505E0402, 0x505F0402, 0x50600402,
+    0x50610402, 0x50620402, 0x50630402, 0x50640402, 0x50650402, 0x50660402, 0x50670402, 0x50680402,
+    0x50690402, 0x506A0402, 0x506B0402, 0x506C0402, 0x506D0402, 0x506E0402, 0x506F0402, 0x50700402,
+    0x50710402, 0x50620404, 0x50650404, 0x31990402, 0x319A0402, 0x316A0402, 0x316B0402, 0x316C0402,
+    0x316D0402, 0x316E0402, 0x316F0402, 0x31700402, 0x31710402, 0x31720402, 0x31730402, 0x31740402,
+    0x31750402, 0x31760402, 0x31770402, 0x31780402, 0x31790402, 0x317A0402, 0x317B0402, 0x317C0402,
+    0x317D0402, 0x317E0402, 0x317F0402, 0x31800402, 0x31810402, 0x31820402, 0x31830402, 0x31840402,
+    0x31850402, 0x31860402, 0x31870402, 0x31880402, 0x31890402, 0x318A0402, 0x318B0402, 0x318C0402,
+    0x318D0402, 0x318E0402, 0x318F0402, 0x31900402, 0x31910402, 0x31920402, 0x31930402, 0x31940402,
+    0x31950402, 0x31960402, 0x31970402, 0x31980402, 0x319B0402, 0x319C0402, 0x319D0402, 0x319E0402,
+    0x319F0402, 0x31A00402, 0x31A10402, 0x31A20402, 0x31A30402, 0x31A40402, 0x31A50402, 0x31A60402,
+    0x31A70402, 0x31A80402, 0x31A90402, 0x31AA0402, 0x31AB0402, 0x31AC0402, 0x31AD0402, 0x02B40402,
+    0x02B50402, 0x045F0402, 0x04600402, 0x04610402, 0x04620402, 0x04630402, 0x1E530402, 0x1E540402,
+    0x1E550402, 0x1E560402, 0x1E570402, 0x1E580402, 0x1E590402, 0x1E5A0402, 0x1E5B0402, 0x1E5C0402,
+    0x1E5D0402, 0x31AE0402, 0x2D470402, 0x2D480402, 0x2D490402, 0x2D4A0402, 0x2D4B0402, 0x2D4C0402,
+    0x2D4D0402, 0x2D4E0402, 0x2D4F0402, 0x2D500402, 0x2D510402, 0x2D520402, 0x2D530402, 0x2D540402,
+    0x2D550402, 0x2D560402, 0x2D570402, 0x2D580402, 0x2D590402, 0x2D5A0402, 0x2D5B0402, 0x2D5C0402,
+    0x2D5D0402, 0x2D5D0402, 0x00001842, 0x2D5E0402, 0x2D5E0402, 0x00001842, 0x2D5F0402, 0x2D600402,
+    0x2D610402, 0x2D620402, 0x2D630402, 0x2D640402, 0x2D650402, 0x2D660402, 0x2D670402, 0x2D680402,
+    0x2D690402, 0x2D6A0402, 0x2D6B0402, 0x2D6C0402, 0x2D670402, 0x00001842, 0x2D6D0402, 0x2D6E0402,
+    0x2D6F0402, 0x2D700402, 0x2D710402, 0x2D720402, 0x2D730402, 0x2D740402, 0x2D750402, 0x2D760402,
+    0x2D770402, 0x2D780402, 0x2D790402, 0x2D7A0402, 0x047A0402, 0x047B0402, 0x02EE0402, 0x02EF0402,
+    0x02B60402, 0x02B70402, 0x4CC40402, 0x4CC50402, 0x4CC60402, 0x4CC70402, 0x4CC80402, 0x4CC90402,
+    0x4CCA0402, 0x4CCB0402, 0x4CCC0402, 0x4CCD0402, 0x4CCE0402, 0x4CCF0402, 0x4CD00402, 0x4CD10402,
+    0x4CD20402, 0x4CD30402, 0x4CD40402, 0x4CD50402, 0x4CD60402, 0x4CD70402, 0x4CD80402, 0x4CD90402,
+    0x4CDA0402, 0x4CDB0402, 0x4CDC0402, 0x363F0402, 0x36400402, 0x36410402, 0x36420402, 0x36430402,
+    0x36440402, 0x36450402, 0x36460402, 0x36470402, 0x36480402, 0x36490402, 0x364A0402, 0x364B0402,
+    0x364C0402, 0x364D0402, 0x364E0402, 0x364F0402, 0x36500402, 0x36510402, 0x36520402, 0x36530402,
+    0x36540402, 0x36550402, 0x36560402, 0x36570402, 0x36580402, 0x36590402, 0x365A0402, 0x365B0402,
+    0x365C0402, 0x365D0402, 0x365E0402, 0x365F0402, 0x36610402, 0x36620402, 0x36630402, 0x36650402,
+    0x36660402, 0x36670402, 0x36680402, 0x36690402, 0x366A0402, 0x366B0402, 0x366C0402, 0x366D0402,
+    0x366E0402, 0x366F0402, 0x36700402, 0x36730402, 0x36740402, 0x02F00402, 0x02B80402, 0x02B90402,
+    0x027A0402, 0x36640402, 0x36710402, 0x36720402, 0x36600402, 0x2D7B0402, 0x2D7C0402, 0x2D7D0402,
+    0x2D7E0402, 0x2D7F0402, 0x2D800402, 0x2D810402, 0x2D820402, 0x2D830402, 0x2D840402, 0x2D850402,
+    0x2D860402, 0x2D870402, 0x2D880402, 0x2D890402, 0x2D8A0402, 0x2D8B0402, 0x2D8C0402, 0x2D8D0402,
+    0x2D8E0402, 0x2D8F0402, 0x2D900402, 0x2D910402, 0x2D920402, 0x2D930402, 0x2D940402, 0x2D950402,
+    0x2D960402, 0x2D970402, 0x2D980402, 0x2D990402, 0x2D9A0402, 0x2D9C0402, 0x2D9D0402, 0x2D9E0402,
+    0x047C0402, 0x047D0402, 0x2D9B0402, 0x2DA10402, 0x2DA20402, 0x2DA30402, 0x2DA40402, 0x2DA50402,
+    0x2DA60402, 0x2DA70402, 0x2DA80402, 0x2DA90402, 0x2DAA0402, 0x2DAB0402, 0x2DAC0402, 0x2DAD0402,
+    0x2DAE0402, 0x2DAF0402, 0x2DB00402, 0x2DB10402, 0x2DB20402, 0x2DB30402, 0x2DB40402, 0x2DB50402,
+    0x2DB60402, 0x2DB70402, 0x2DB80402, 0x2DB90402, 0x2DBA0402, 0x2DBB0402, 0x2DBC0402, 0x2DBD0402,
+    0x2DBE0402, 0x2DBF0402, 0x2DC00402, 0x2DC10402, 0x2DC20402, 0x2DC30402, 0x2DC40402, 0x2DC50402,
+    0x2DC60402, 0x2DC70402, 0x2DC80402, 0x2DC90402, 0x2DCA0402, 0x2DCB0402, 0x2DCC0402, 0x2DCD0402,
+    0x2DCE0402, 0x2DCF0402, 0x2DD00402, 0x2DD50402, 0x2DD60402, 0x2DD70402, 0x2DD80402, 0x2DD90402,
+    0x2DDA0402, 0x2DDB0402, 0x2DDC0402, 0x2DDD0402, 0x2DDE0402, 0x2DE00402, 0x2DE10402, 0x2DE20402,
+    0x2DE30402, 0x2DD10402, 0x2DD20402, 0x2DD30402, 0x2D9F0402, 0x02BA0402, 0x02BB0402, 0x047F0402,
+    0x02F10402, 0x00001A02, 0x00001A22, 0x047E0402, 0x2DDF0402, 0x2DA00402, 0x04800402, 0x2DD40402,
+    0x04810402, 0x02F20402, 0x02F30402, 0x1E6D0402, 0x1E6E0402, 0x1E6F0402, 0x1E700402, 0x1E710402,
+    0x1E720402, 0x1E730402, 0x1E740402, 0x1E750402, 0x1E760402, 0x1E770402, 0x2DE40402, 0x2DE50402,
+    0x2DE60402, 0x2DE70402, 0x2DE80402, 0x2DE90402, 0x2DEA0402, 0x2DEB0402, 0x2DEC0402, 0x2DED0402,
+    0x2DEE0402, 0x2DEF0402, 0x2DF00402, 0x2DF10402, 0x2DF20402, 0x2DF30402, 0x2DF40402, 0x2DF50402,
+    0x2DF60402, 0x2DF70402, 0x2DF80402, 0x2DF90402, 0x2DFA0402, 0x2DFB0402, 0x2DFC0402, 0x2DFD0402,
+    0x2DFE0402, 0x2DFF0402, 0x2E000402, 0x2E010402, 0x2E020402, 0x2E030402, 0x2E040402, 0x2E050402,
+    0x2E060402, 0x2E070402, 0x2E080402, 0x2E090402, 0x2E0A0402, 0x2E0B0402, 0x2E0C0402, 0x2E0D0402,
+    0x2E0E0402, 0x2E0F0402, 0x2E100402, 0x2E110402, 0x2E120402, 0x2E130402, 0x2E140402, 0x2E150402,
+    0x2E160402, 0x2E170402, 0x02BC0402, 0x02BD0402, 0x04820402, 0x04830402, 0x04840402, 0x04850402,
+    0x2E510402, 0x2E520402, 0x2E530402, 0x2E540402, 0x2E570402, 0x2E580402, 0x2E590402, 0x2E5A0402,
+    0x2E5B0402, 0x2E5C0402, 0x2E5D0402, 0x2E5E0402, 0x2E5F0402, 0x2E600402, 0x2E610402, 0x2E620402,
+    0x2E630402, 0x2E640402, 0x2E650402, 0x2E660402, 0x2E670402, 0x2E680402, 0x2E690402, 0x2E6A0402,
+    0x2E6B0402, 0x2E6C0402, 0x2E6D0402, 0x2E6E0402, 0x2E6F0402, 0x2E700402, 0x2E710402, 0x2E720402,
+    0x2E730402, 0x2E550402, 0x2E560402, 0x2E740402, 0x2E750402, 0x02F40402, 0x2E180402, 0x2E190402,
+    0x2E1A0402, 0x2E1B0402, 0x2E1C0402, 0x2E1D0402, 0x2E1E0402, 0x2E1F0402, 0x2E200402, 0x2E210402,
+    0x2E220402, 0x2E230402, 0x2E240402, 0x2E250402, 0x2E260402, 0x2E270402, 0x2E280402, 0x2E290402,
+    0x2E2A0402, 0x2E2B0402, 0x2E2C0402, 0x2E2D0402, 0x2E2E0402, 0x2E2F0402, 0x2E300402, 0x2E310402,
+    0x2E320402, 0x2E330402, 0x2E340402, 0x2E350402, 0x2E360402, 0x2E370402, 0x2E380402, 0x2E390402,
+    0x2E3A0402, 0x2E3B0402, 0x2E3C0402, 0x2E3D0402, 0x2E3E0402, 0x2E3F0402, 0x2E400402, 0x2E410402,
+    0x2E420402, 0x2E430402, 0x2E440402, 0x2E450402, 0x2E460402, 0x2E470402, 0x2E480402, 0x2E490402,
+    0x2E4A0402, 0x2E4B0402, 0x2E4C0402, 0x2E4D0402, 0x2E4E0402, 0x2E4F0402, 0x2E500402, 0x2E770402,
+    0x2E780402, 0x2E790402, 0x2E7A0402, 0x2E7B0402, 0x2E7C0402, 0x2E7D0402, 0x2E7F0402, 0x2E810402,
+    0x2E820402, 0x2E830402, 0x2E840402, 0x2E850402, 0x2E860402, 0x2E870402, 0x2E880402, 0x2E890402,
+    0x2E8A0402, 0x2E8B0402, 0x2E8C0402, 0x2E8D0402, 0x2E8E0402, 0x2E8F0402, 0x2E900402, 0x2E910402,
+    0x2E920402, 0x2E930402, 0x2E940402, 0x2E950402, 0x2E960402, 0x2E970402, 0x2E980402, 0x2E990402,
+    0x2E9A0402, 0x2E9B0402, 0x2E9C0402, 0x2E9D0402, 0x2E9E0402, 0x2E9F0402, 0x2EA00402, 0x2EA10402,
+    0x2EA20402, 0x2EA30402, 0x2EA40402, 0x2EA50402, 0x2EA60402, 0x2EA70402, 0x2EAA0402, 0x2EAB0402,
+    0x2EAC0402, 0x2EAD0402, 0x2EAE0402, 0x2EAF0402, 0x2EB00402, 0x2EB30402, 0x2EB40402, 0x2EB50402,
+    0x2EB60402, 0x2EB70402, 0x2E760402, 0x2EB80402, 0x2EB90402, 0x2EA80402, 0x2EA90402, 0x2E7E0402,
+    0x2E800402, 0x2EB10402, 0x2EB20402, 0x2EBC0402, 0x2EBD0402, 0x2EBE0402, 0x2EBF0402, 0x2EC00402,
+    0x2EC10402, 0x2EC20402, 0x2EC30402, 0x2EC40402, 0x2EC50402, 0x2EC60402, 0x2EC70402, 0x2EC80402,
+    0x2EC90402, 0x2ECA0402, 0x2ECB0402, 0x2ECC0402, 0x2ECD0402, 0x2ECE0402, 0x2ECF0402, 0x2ED00402,
+    0x2ED10402, 0x2ED20402, 0x2ED30402, 0x2ED40402, 0x2ED50402, 0x2ED60402, 0x2ED70402, 0x2ED80402,
+    0x2ED90402, 0x2EDA0402, 0x2EDB0402, 0x2EDC0402, 0x2EDD0402, 0x2EDE0402, 0x2EDF0402, 0x2EE00402,
+    0x2EE10402, 0x2EE20402, 0x2EE30402, 0x2EE40402, 0x2EE50402, 0x2EE60402, 0x2EE70402, 0x2EE80402,
+    0x2EE90402, 0x2EEA0402, 0x2EEB0402, 0x2EEC0402, 0x2EED0402, 0x2EEE0402, 0x2EEF0402, 0x2EF00402,
+    0x2EF60402, 0x2EF70402, 0x2EF80402, 0x2EF90402, 0x2EFA0402, 0x2EFB0402, 0x2EFC0402, 0x2EFD0402,
+    0x2EFE0402, 0x2EFF0402, 0x2F000402, 0x2F010402, 0x2F020402, 0x2F030402, 0x2EF10402, 0x2EF40402,
+    0x2EBA0402, 0x2EBB0402, 0x02BE0402, 0x02BF0402, 0x04860402, 0x04880402, 0x04890402, 0x04870402,
+    0x048A0402, 0x048B0402, 0x2EF50402, 0x2EF20402, 0x2EF30402, 0x2F050402, 0x2F060402, 0x2F070402,
+    0x2F080402, 0x2F090402, 0x2F0A0402, 0x2F0B0402, 0x2F0C0402, 0x2F0D0402, 0x2F0E0402, 0x2F0F0402,
+    0x2F100402, 0x2F110402, 0x2F120402, 0x2F130402, 0x2F140402, 0x2F150402, 0x2F160402, 0x2F170402,
+    0x2F180402, 0x2F190402, 0x2F1A0402, 0x2F1B0402, 0x2F1C0402, 0x2F1D0402, 0x2F1E0402, 0x2F1F0402,
+    0x2F200402, 0x2F210402, 0x2F220402, 0x2F230402, 0x2F240402, 0x2F250402, 0x2F260402, 0x2F270402,
+    0x2F280402, 0x2F290402, 0x2F2A0402, 0x2F2B0402, 0x2F2C0402, 0x2F2D0402, 0x2F2E0402, 0x2F2F0402,
+    0x2F300402, 0x2F310402, 0x2F320402, 0x2F330402, 0x2F340402, 0x2F370402, 0x2F380402, 0x2F390402,
+    0x2F3A0402, 0x2F3B0402, 0x2F3C0402, 0x2F3D0402, 0x2F3E0402, 0x2F3F0402, 0x2F400402, 0x2F410402,
+    0x2F420402, 0x2F430402, 0x2F440402, 0x2F450402, 0x2F460402, 0x2F350402, 0x2F360402, 0x048C0402,
+    0x2F040402, 0x2F470402, 0x2F480402, 0x2F490402, 0x2F4A0402, 0x2F4B0402, 0x2F4C0402, 0x2F4D0402,
+    0x2F4E0402, 0x2F4F0402, 0x2F500402, 0x2F510402, 0x2F520402, 0x2F530402, 0x2F540402, 0x2F550402,
+    0x2F560402, 0x2F570402, 0x2F580402, 0x2F590402, 0x2F5A0402, 0x2F5B0402, 0x2F5C0402, 0x2F5D0402,
+    0x2F5E0402, 0x2F5F0402, 0x2F600402, 0x2F610402, 0x2F620402, 0x2F630402, 0x2F640402, 0x2F650402,
+    0x2F660402, 0x2F670402, 0x2F680402, 0x2F690402, 0x2F6A0402, 0x2F6B0402, 0x2F6C0402, 0x2F6D0402,
+    0x2F6E0402, 0x2F6F0402, 0x2F700402, 0x2F710402, 0x2F720402, 0x2F730402, 0x2F740402, 0x2F750402,
+    0x2F760402, 0x2F770402, 0x2F780402, 0x2F790402, 0x2F7A0402, 0x2F7B0402, 0x2F7C0402, 0x2F7D0402,
+    0x2F7E0402, 0x2F7F0402, 0x2F800402, 0x2F810402, 0x048D0402, 0x02C00402, 0x02C10402, 0x048E0402,
+    0x048F0402, 0x04900402, 0x04910402, 0x04920402, 0x04930402, 0x04940402, 0x04950402, 0x04960402,
+    0x04970402, 0x04980402, 0x04990402, 0x049A0402, 0x049B0402, 0x049C0402, 0x049D0402, 0x049E0402,
+    0x049F0402, 0x04A00402, 0x04A10402, 0x2F490404, 0x00002304, 0x2F490404, 0x00002324, 0x2F4A0404,
+    0x00002304, 0x2F4B0404, 0x00002304, 0x2F790404, 0x00002304, 0x2F7A0404, 0x00002304, 0x2F820402,
+    0x2F830402, 0x2F840402, 0x2F850402, 0x2F860402, 0x2F870402, 0x2F880402, 0x2F890402, 0x2F8A0402,
+    0x2F8B0402, 0x2F8C0402, 0x2F8D0402, 0x2F8E0402, 0x2F8F0402, 0x2F900402, 0x2F910402, 0x2F920402,
+    0x2F930402, 0x2F940402, 0x2F950402, 0x2F960402, 0x2F970402, 0x2F980402, 0x2F990402, 0x2F9A0402,
+    0x2F9B0402, 0x2F9C0402, 0x2F9D0402, 0x2F9E0402, 0x2F9F0402, 0x2FA00402, 0x2FA10402, 0x2FA20402,
+    0x2FA30402, 0x2FA40402, 0x2FA50402, 0x2FA60402, 0x2FA70402, 0x2FA80402, 0x2FA90402, 0x2FAA0402,
+    0x2FAB0402, 0x2FAC0402, 0x2FAD0402, 0x2FAE0402, 0x2FAF0402, 0x2FB00402, 0x2FB10402, 0x2FB20402,
+    0x2FB30402, 0x2FB40402, 0x2FB50402, 0x2FB60402, 0x2FB70402, 0x2FB80402, 0x2FB90402, 0x2FBA0402,
+    0x2FBB0402, 0x2FBC0402, 0x2FBD0402, 0x2FBE0402, 0x2FBF0402, 0x02C20402, 0x02C30402, 0x04A20402,
+    0x2FC00402, 0x03F30402, 0x03F40402, 0x03F50402, 0x03F60402, 0x03F70402, 0x03F80402, 0x03F90402,
+    0x03FA0402, 0x03FB0402, 0x03FC0402, 0x03FD0402, 0x03FE0402, 0x03FF0402, 0x2FC10402, 0x2FC20402,
+    0x2FC30402, 0x2FC40402, 0x2FC50402, 0x2FC60402, 0x2FC70402, 0x2FC80402, 0x2FC90402, 0x2FCA0402,
+    0x2FCE0402, 0x2FCF0402, 0x2FD10402, 0x2FD20402, 0x2FD30402, 0x2FD40402, 0x2FD50402, 0x2FD60402,
+    0x2FD70402, 0x2FD80402, 0x2FD90402, 0x2FDA0402, 0x2FDB0402, 0x2FDC0402, 0x2FDD0402, 0x2FDE0402,
+    0x2FDF0402, 0x2FE00402, 0x2FE10402, 0x2FE20402, 0x2FE30402, 0x2FE40402, 0x2FE50402, 0x2FE60402,
+    0x2FE70402, 0x2FE80402, 0x2FE90402, 0x2FEA0402, 0x2FEB0402, 0x2FCC0402, 0x2FCB0402, 0x2FCD0402,
+    0x2FEC0402, 0x2FED0402, 0x2FEE0402, 0x2FEF0402, 0x2FF00402, 0x2FF10402, 0x2FF20402, 0x2FF30402,
+    0x2FF40402, 0x2FF50402, 0x2FF60402, 0x2FD00402, 0x30A50402, 0x30A60402, 0x30A70402, 0x30A80402,
+    0x30A90402, 0x30A90404, 0x00002304, 0x30AA0402, 0x30AB0402, 0x30AC0402, 0x30AD0402, 0x30AE0402,
+    0x30AF0402, 0x30B00402, 0x30B10402, 0x30B20402, 0x30B30402, 0x30B40402, 0x30B50402, 0x30B60402,
+    0x30B70402, 0x30B80402, 0x30B90402, 0x30B90404, 0x00002304, 0x30BA0402, 0x30BB0402, 0x30BC0402,
+    0x30AC0404, 0x00002304, 0x30C90402, 0x30CA0402, 0x30CB0402, 0x30BD0402, 0x30BE0402, 0x30BF0402,
+    0x30C00402, 0x30C10402, 0x30C20402, 0x30C30402, 0x30C40402, 0x30C50402, 0x30C60402, 0x30C70402,
+    0x30C80402, 0x1E510402, 0x1E520402, 0x02C40402, 0x02C50402, 0x02F50402, 0x059E0402, 0x306D0402,
+    0x306E0402, 0x306F0402, 0x30700402, 0x30710402, 0x30720402, 0x30730402, 0x30740402, 0x30750402,
+    0x30760402, 0x30770402, 0x30780402, 0x30790402, 0x307A0402, 0x307B0402, 0x307C0402, 0x307D0402,
+    0x307E0402, 0x307F0402, 0x30800402, 0x30810402, 0x30820402, 0x30830402, 0x30840402, 0x30850402,
+    0x30860402, 0x30870402, 0x30880402, 0x30890402, 0x308A0402, 0x308B0402, 0x308C0402, 0x308D0402,
+    0x308E0402, 0x308F0402, 0x30900402, 0x30910402, 0x30920402, 0x30930402, 0x30940402, 0x30950402,
+    0x30960402, 0x30970402, 0x30980402, 0x30990402, 0x309A0402, 0x309B0402, 0x309C0402, 0x309D0402,
+    0x309E0402, 0x309F0402, 0x30A00402, 0x30A10402, 0x30A20402, 0x30A30402, 0x30A40402, 0x04A30402,
+    0x49AF0408, 0x49B00408, 0x49B10408, 0x49B20408, 0x49B30408, 0x49B40408, 0x49B50408, 0x49B60408,
+    0x49B70408, 0x49B80408, 0x49B90408, 0x49BA0408, 0x49BB0408, 0x49BC0408, 0x49BD0408, 0x49BE0408,
+    0x49BF0408, 0x49C00408, 0x49C10408, 0x49C20408, 0x49C30408, 0x49C40408, 0x49C50408, 0x49C60408,
+    0x49C70408, 0x49C80408, 0x49C90408, 0x49CA0408, 0x49CB0408, 0x49CC0408, 0x49CD0408, 0x49CE0408,
+    0x49AF0402, 0x49B00402, 0x49B10402, 0x49B20402, 0x49B30402, 0x49B40402, 0x49B50402, 0x49B60402,
+    0x49B70402, 0x49B80402, 0x49B90402, 0x49BA0402, 0x49BB0402, 0x49BC0402, 0x49BD0402, 0x49BE0402,
+    0x49BF0402, 0x49C00402, 0x49C10402, 0x49C20402, 0x49C30402, 0x49C40402, 0x49C50402, 0x49C60402,
+    0x49C70402, 0x49C80402, 0x49C90402, 0x49CA0402, 0x49CB0402, 0x49CC0402, 0x49CD0402, 0x49CE0402,
+    0x1E780402, 0x1E790402, 0x1E7A0402, 0x1E7B0402, 0x1E7C0402, 0x1E7D0402, 0x1E7E0402, 0x1E7F0402,
+    0x1E800402, 0x49AE0402, 0x2FF70402, 0x2FF80402, 0x2FF90402, 0x2FFA0402, 0x2FFB0402, 0x2FFC0402,
+    0x2FFD0402, 0x2FFE0402, 0x2FFF0402, 0x30000402, 0x30010402, 0x30020402, 0x30030402, 0x30050402,
+    0x30060402, 0x30070402, 0x30080402, 0x30090402, 0x300A0402, 0x300B0402, 0x300C0402, 0x300D0402,
+    0x300E0402, 0x300F0402, 0x30100402, 0x30110402, 0x30120402, 0x30130402, 0x30140402, 0x30150402,
+    0x30160402, 0x30170402, 0x30190402, 0x301B0402, 0x301D0402, 0x301E0402, 0x301F0402, 0x30200402,
+    0x30210402, 0x30220402, 0x30230402, 0x30240402, 0x30250402, 0x30260402, 0x30270402, 0x30280402,
+    0x30290402, 0x302A0402, 0x302B0402, 0x302C0402, 0x302D0402, 0x302E0402, 0x30040402, 0x30180402,
+    0x301A0402, 0x301C0402, 0x02C60402, 0x04A40402, 0x02F60402, 0x302F0402, 0x30300402, 0x30310402,
+    0x30320402, 0x30330402, 0x30340402, 0x30350402, 0x30360402, 0x30370402, 0x30380402, 0x30390402,
+    0x303A0402, 0x303B0402, 0x303C0402, 0x303D0402, 0x303E0402, 0x303F0402, 0x30400402, 0x30410402,
+    0x30420402, 0x30430402, 0x30440402, 0x30450402, 0x30460402, 0x30470402, 0x30480402, 0x30490402,
+    0x304A0402, 0x304B0402, 0x304C0402, 0x304D0402, 0x304E0402, 0x304F0402, 0x30500402, 0x30510402,
+    0x30520402, 0x30530402, 0x30540402, 0x30550402, 0x30560402, 0x30570402, 0x30580402, 0x30590402,
+    0x305A0402, 0x305B0402, 0x305C0402, 0x305D0402, 0x30600402, 0x30610402, 0x30620402, 0x30630402,
+    0x30640402, 0x30650402, 0x30660402, 0x30670402, 0x30690402, 0x306A0402, 0x306B0402, 0x306C0402,
+    0x305E0402, 0x04A50402, 0x305F0402, 0x30680402, 0x33610402, 0x33620402, 0x33630402, 0x33640402,
+    0x33650402, 0x33660402, 0x33670402, 0x33680402, 0x33690402, 0x336A0402, 0x336B0402, 0x33390402,
+    0x333B0402, 0x333C0402, 0x333D0402, 0x333E0402, 0x333F0402, 0x33400402, 0x33410402, 0x33420402,
+    0x33430402, 0x33440402, 0x33450402, 0x33460402, 0x33470402, 0x33480402, 0x33490402, 0x334A0402,
+    0x334B0402, 0x334C0402, 0x334D0402, 0x334E0402, 0x334F0402, 0x33500402, 0x33510402, 0x33520402,
+    0x33530402, 0x33540402, 0x33550402, 0x33560402, 0x33570402, 0x33580402, 0x33590402, 0x335A0402,
+    0x335B0402, 0x335C0402, 0x335D0402, 0x335E0402, 0x335F0402, 0x33600402, 0x333A0402, 0x336C0402,
+    0x335A0417, 0x33590419, 0x335A0419, 0x335B0419, 0x335C0419, 0x04260402, 0x04270402, 0x04280402,
+    0x04290402, 0x042A0402, 0x042B0402, 0x042C0402, 0x042D0402, 0x336D0402, 0x336E0402, 0x336F0402,
+    0x33700402, 0x33710402, 0x33740402, 0x33760402, 0x33750402, 0x33770402, 0x33780402, 0x33720402,
+    0x33730402, 0x33790402, 0x337A0402, 0x337C0402, 0x337D0402, 0x337E0402, 0x337F0402, 0x33800402,
+    0x33810402, 0x33820402, 0x33830402, 0x33840402, 0x33850402, 0x33860402, 0x33870402, 0x33880402,
+    0x33890402, 0x338A0402, 0x338B0402, 0x338C0402, 0x338D0402, 0x338E0402, 0x338F0402, 0x33900402,
+    0x33910402, 0x33920402, 0x33930402, 0x33940402, 0x33950402, 0x33960402, 0x33970402, 0x33980402,
+    0x33990402, 0x339A0402, 0x339B0402, 0x339C0402, 0x339D0402, 0x339E0402, 0x339F0402, 0x33A00402,
+    0x33A10402, 0x337B0402, 0x33A20402, 0x33A30402, 0x339B0417, 0x339C0417, 0x339E0417, 0x33A00417,
+    0x337A0419, 0x337C0419, 0x337F0419, 0x338A0419, 0x338E0419, 0x338F0419, 0x33930419, 0x339B0419,
+    0x339C0419, 0x339E0419, 0x33A00419, 0x33990419, 0x00001A42, 0x33A40402, 0x042E0402, 0x042F0402,
+    0x04300402, 0x33A50402, 0x04310402, 0x04320402, 0x04330402, 0x04340402, 0x04350402, 0x49D60402,
+    0x49D70402, 0x49D80402, 0x49D90402, 0x49DA0402, 0x49DB0402, 0x49DC0402, 0x49DD0402, 0x49DE0402,
+    0x49DF0402, 0x49E00402, 0x49E10402, 0x49E20402, 0x49E30402, 0x49E40402, 0x49E50402, 0x49E60402,
+    0x49E70402, 0x49E80402, 0x49E90402, 0x49EA0402, 0x49CF0402, 0x49D00402, 0x49D10402, 0x49D20402,
+    0x49D30402, 0x49D40402, 0x49D50402, 0x49EB0402, 0x49EC0402, 0x49F20402, 0x49ED0402, 0x49EE0402,
+    0x49EF0402, 0x49F00402, 0x49F10402, 0x49F30402, 0x49F90402, 0x49F70402, 0x4A050402, 0x49FA0402,
+    0x49F80402, 0x4A060402, 0x4A010402, 0x49FF0402, 0x4A020402, 0x4A000402, 0x49F40402, 0x4A070402,
+    0x49F60402, 0x49F50402, 0x49FD0402, 0x49FB0402, 0x4A030402, 0x49FE0402, 0x49FC0402, 0x4A040402,
+    0x31DB0402, 0x31DC0402, 0x31DD0402, 0x31DE0402, 0x31DF0402, 0x31E00402, 0x31E10402, 0x31E20402,
+    0x31E30402, 0x31E40402, 0x31E50402, 0x31E60402, 0x31E70402, 0x31E80402, 0x31E90402, 0x31EA0402,
+    0x31EB0402, 0x31EC0402, 0x31ED0402, 0x31EE0402, 0x31EF0402, 0x31F00402, 0x31F10402, 0x31F20402,
+    0x31F30402, 0x31F40402, 0x31F50402, 0x31F60402, 0x31F70402, 0x31F80402, 0x31F90402, 0x31FA0402,
+    0x31FB0402, 0x31FC0402, 0x31FD0402, 0x31FE0402, 0x31FF0402, 0x32000402, 0x32010402, 0x32020402,
+    0x32030402, 0x32040402, 0x32050402, 0x32060402, 0x32070402, 0x32080402, 0x320A0402, 0x320B0402,
+    0x320C0402, 0x320D0402, 0x320E0402, 0x320F0402, 0x32100402, 0x32110402, 0x32120402, 0x32130402,
+    0x32140402, 0x32150402, 0x32160402, 0x32090402, 0x02C70402, 0x02C80402, 0x046B0402, 0x046C0402,
+    0x046D0402, 0x1E630402, 0x1E640402, 0x1E650402, 0x1E660402, 0x1E670402, 0x1E680402, 0x1E690402,
+    0x1E6A0402, 0x1E6B0402, 0x1E6C0402, 0x04360402, 0x04370402, 0x33A60402, 0x33A80402, 0x33AA0402,
+    0x33AC0402, 0x33AE0402, 0x33B00402, 0x33B20402, 0x33B40402, 0x33B60402, 0x33B80402, 0x33BA0402,
+    0x33BC0402, 0x33BE0402, 0x33C00402, 0x33C20402, 0x33C40402, 0x33C60402, 0x33C80402, 0x33CA0402,
+    0x33CC0402, 0x33CE0402, 0x33D00402, 0x33D20402, 0x33D30402, 0x33D50402, 0x33D70402, 0x33D90402,
+    0x33DB0402, 0x33DD0402, 0x33DF0402, 0x33A70402, 0x33A90402, 0x33AB0402, 0x33AD0402, 0x33AF0402,
+    0x33B10402, 0x33B30402, 0x33B50402, 0x33B70402, 0x33B90402, 0x33BB0402, 0x33BD0402, 0x33BF0402,
+    0x33C10402, 0x33C30402, 0x33C50402, 0x33C70402, 0x33C90402, 0x33CB0402, 0x33CD0402, 0x33CF0402,
+    0x33D10402, 0x33D40402, 0x33D60402, 0x33D80402, 0x33DA0402, 0x33DC0402, 0x33DE0402, 0x33E00402,
+    0x33E10402, 0x33E20402, 0x33E30402, 0x33E40402, 0x33E50402, 0x30CC0402, 0x30CD0402, 0x30CE0402,
+    0x30CF0402, 0x30D00402, 0x30D10402, 0x30D20402, 0x30D30402, 0x30D40402, 0x30D50402, 0x30D60402,
+    0x30D70402, 0x30D80402, 0x30D90402, 0x30DA0402, 0x30DB0402, 0x30DC0402, 0x30DD0402, 0x30DE0402,
+    0x30DF0402, 0x30E00402, 0x30E10402, 0x30E20402, 0x30E30402, 0x30E40402, 0x30E50402, 0x30E60402,
+    0x30E70402, 0x30E80402, 0x30E90402, 0x30EA0402, 0x30EB0402, 0x30EC0402, 0x30ED0402, 0x30EE0402,
+    0x30EF0402, 0x30F00402, 0x30F10402, 0x30F20402, 0x30F30402, 0x30F40402, 0x30F50402, 0x30F60402,
+    0x30F70402, 0x30F80402, 0x30F90402, 0x30FA0402, 0x30FB0402, 0x30FC0402, 0x30FD0402, 0x30FE0402,
+    0x30FF0402, 0x31000402, 0x31010402, 0x31020402, 0x31030402, 0x31040402, 0x31050402, 0x31060402,
+    0x30F00417, 0x30F00419, 0x31080402, 0x31090402, 0x310A0402, 0x310B0402, 0x310C0402, 0x310D0402,
+    0x310E0402, 0x310F0402, 0x31100402, 0x31110402, 0x31120402, 0x31130402, 0x31140402, 0x31150402,
+    0x31160402, 0x31170402, 0x31180402, 0x31190402, 0x311A0402, 0x311B0402, 0x311C0402, 0x311D0402,
+    0x311E0402, 0x311F0402, 0x31200402, 0x31210402, 0x31220402, 0x31230402, 0x31240402, 0x31250402,
+    0x31260402, 0x31270402, 0x31280402, 0x31290402, 0x312A0402, 0x312B0402, 0x312C0402, 0x312D0402,
+    0x312E0402, 0x312F0402, 0x31300402, 0x31310402, 0x31320402, 0x31330402, 0x31340402, 0x31350402,
+    0x31360402, 0x31370402, 0x31380402, 0x31390402, 0x31070402, 0x34F10402, 0x34F20402, 0x34F30402,
+    0x34F40402, 0x34F50402, 0x34F60402, 0x34F70402, 0x34F80402, 0x34F90402, 0x34FA0402, 0x34FB0402,
+    0x34FC0402, 0x34FD0402, 0x34FE0402, 0x34FF0402, 0x35000402, 0x35010402, 0x35020402, 0x35030402,
+    0x35040402, 0x35050402, 0x35060402, 0x35070402, 0x02F70402, 0x02F80402, 0x49120402, 0x1D6B0402,
+    0x1D6C0402, 0x1D6D0402, 0x1D6E0402, 0x1D6F0402, 0x1D700402, 0x1D710402, 0x1D720402, 0x1D730402,
+    0x1D740402, 0x1D750402, 0x1D760402, 0x1D770402, 0x1D780402, 0x1D790402, 0x1D7A0402, 0x1D7B0402,
+    0x1D7C0402, 0x1D7D0402, 0x1D7E0402, 0x1D7F0402, 0x05500402, 0x05510402, 0x05520402, 0x05530402,
+    0x05540402, 0x05550402, 0x05560402, 0x05570402, 0x1F710402, 0x1F720402, 0x1F730402, 0x1F740402,
+    0x05580402, 0x05590402, 0x055A0402, 0x055B0402, 0x055C0402, 0x055D0402, 0x055E0402, 0x055F0402,
+    0x05600402, 0x05610402, 0x05620402, 0x05630402, 0x05640402, 0x05650402, 0x05660402, 0x05670402,
+    0x05680402, 0x04A60402, 0x51490402, 0x514A0402, 0x514B0402, 0x514C0402, 0x514D0402, 0x514E0402,
+    0x514F0402, 0x51500402, 0x51510402, 0x51520402, 0x51530402, 0x51540402, 0x51550402, 0x51560402,
+    0x51570402, 0x51580402, 0x51590402, 0x515A0402, 0x515B0402, 0x515C0402, 0x515D0402, 0x515E0402,
+    0x515F0402, 0x51600402, 0x51610402, 0x51620402, 0x51630402, 0x51640402, 0x51650402, 0x51660402,
+    0x51670402, 0x51680402, 0x51690402, 0x516A0402, 0x516B0402, 0x516C0402, 0x516D0402, 0x516E0402,
+    0x516F0402, 0x51700402, 0x51710402, 0x51720402, 0x51730402, 0x51740402, 0x51750402, 0x51760402,
+    0x51770402, 0x51780402, 0x51790402, 0x517A0402, 0x517B0402, 0x517C0402, 0x517D0402, 0x517E0402,
+    0x517F0402, 0x51800402, 0x51810402, 0x51820402, 0x51830402, 0x51840402, 0x51850402, 0x51860402,
+    0x51870402, 0x51880402, 0x51890402, 0x518A0402, 0x518B0402, 0x518C0402, 0x518D0402, 0x518E0402,
+    0x518F0402, 0x51900402, 0x51910402, 0x51920402, 0x51930402, 0x51940402, 0x51950402, 0x51960402,
+    0x51970402, 0x51980402, 0x51990402, 0x519A0402, 0x519B0402, 0x519C0402, 0x519D0402, 0x519E0402,
+    0x519F0402, 0x51A00402, 0x51A10402, 0x51A20402, 0x51A30402, 0x51A40402, 0x51A50402, 0x51A60402,
+    0x51A70402, 0x51A80402, 0x51A90402, 0x51AA0402, 0x51AB0402, 0x51AC0402, 0x51AD0402, 0x51AE0402,
+    0x51AF0402, 0x51B00402, 0x51B10402, 0x51B20402, 0x51B30402, 0x51B40402, 0x51B50402, 0x51B60402,
+    0x51B70402, 0x51B80402, 0x51B90402, 0x51BA0402, 0x51BB0402, 0x51BC0402, 0x51BD0402, 0x51BE0402,
+    0x51BF0402, 0x51C00402, 0x51C10402, 0x51C20402, 0x51C30402, 0x51C40402, 0x51C50402, 0x51C60402,
+    0x51C70402, 0x51C80402, 0x51C90402, 0x51CA0402, 0x51CB0402, 0x51CC0402, 0x51CD0402, 0x51CE0402,
+    0x51CF0402, 0x51D00402, 0x51D10402, 0x51D20402, 0x51D30402, 0x51D40402, 0x51D50402, 0x51D60402,
+    0x51D70402, 0x51D80402, 0x51D90402, 0x51DA0402, 0x51DB0402, 0x51DC0402, 0x51DD0402, 0x51DE0402,
+    0x51DF0402, 0x51E00402, 0x51E10402, 0x51E20402, 0x51E30402, 0x51E40402, 0x51E50402, 0x51E60402,
+    0x51E70402, 0x51E80402, 0x51E90402, 0x51EA0402, 0x51EB0402, 0x51EC0402, 0x51ED0402, 0x51EE0402,
+    0x51EF0402, 0x51F00402, 0x51F10402, 0x51F20402, 0x51F30402, 0x51F40402, 0x51F50402, 0x51F60402,
+    0x51F70402, 0x51F80402, 0x51F90402, 0x51FA0402, 0x51FB0402, 0x51FC0402, 0x51FD0402, 0x51FE0402,
+    0x51FF0402, 0x52000402, 0x52010402, 0x52020402, 0x52030402, 0x52040402, 0x52050402, 0x52060402,
+    0x52070402, 0x52080402, 0x52090402, 0x520A0402, 0x520B0402, 0x520C0402, 0x520D0402, 0x520E0402,
+    0x520F0402, 0x52100402, 0x52110402, 0x52120402, 0x52130402, 0x52140402, 0x52150402, 0x52160402,
+    0x52170402, 0x52180402, 0x52190402, 0x521A0402, 0x521B0402, 0x521C0402, 0x521D0402, 0x521E0402,
+    0x521F0402, 0x52200402, 0x52210402, 0x52220402, 0x52230402, 0x52240402, 0x52250402, 0x52260402,
+    0x52270402, 0x52280402, 0x52290402, 0x522A0402, 0x522B0402, 0x522C0402, 0x522D0402, 0x522E0402,
+    0x522F0402, 0x52300402, 0x52310402, 0x52320402, 0x52330402, 0x52340402, 0x52350402, 0x52360402,
+    0x52370402, 0x52380402, 0x52390402, 0x523A0402, 0x523B0402, 0x523C0402, 0x523D0402, 0x523E0402,
+    0x523F0402, 0x52400402, 0x52410402, 0x52420402, 0x52430402, 0x52440402, 0x52450402, 0x52460402,
+    0x52470402, 0x52480402, 0x52490402, 0x524A0402, 0x524B0402, 0x524C0402, 0x524D0402, 0x524E0402,
+    0x524F0402, 0x52500402, 0x52510402, 0x52520402, 0x52530402, 0x52540402, 0x52550402, 0x52560402,
+    0x52570402, 0x52580402, 0x52590402, 0x525A0402, 0x525B0402, 0x525C0402, 0x525D0402, 0x525E0402,
+    0x525F0402, 0x52600402, 0x52610402, 0x52620402, 0x52630402, 0x52640402, 0x52650402, 0x52660402,
+    0x52670402, 0x52680402, 0x52690402, 0x526A0402, 0x526B0402, 0x526C0402, 0x526D0402, 0x526E0402,
+    0x526F0402, 0x52700402, 0x52710402, 0x52720402, 0x52730402, 0x52740402, 0x52750402, 0x52760402,
+    0x52770402, 0x52780402, 0x52790402, 0x527A0402, 0x527B0402, 0x527C0402, 0x527D0402, 0x527E0402,
+    0x527F0402, 0x52800402, 0x52810402, 0x52820402, 0x52830402, 0x52840402, 0x52850402, 0x52860402,
+    0x52870402, 0x52880402, 0x52890402, 0x528A0402, 0x528B0402, 0x528C0402, 0x528D0402, 0x528E0402,
+    0x528F0402, 0x52900402, 0x52910402, 0x52920402, 0x52930402, 0x52940402, 0x52950402, 0x52960402,
+    0x52970402, 0x52980402, 0x52990402, 0x529A0402, 0x529B0402, 0x529C0402, 0x529D0402, 0x529E0402,
+    0x529F0402, 0x52A00402, 0x52A10402, 0x52A20402, 0x52A30402, 0x52A40402, 0x52A50402, 0x52A60402,
+    0x52A70402, 0x52A80402, 0x52A90402, 0x52AA0402, 0x52AB0402, 0x52AC0402, 0x52AD0402, 0x52AE0402,
+    0x52AF0402, 0x52B00402, 0x52B10402, 0x52B20402, 0x52B30402, 0x52B40402, 0x52B50402, 0x52B60402,
+    0x52B70402, 0x52B80402, 0x52B90402, 0x52BA0402, 0x52BB0402, 0x52BC0402, 0x52BD0402, 0x52BE0402,
+    0x52BF0402, 0x52C00402, 0x52C10402, 0x52C20402, 0x52C30402, 0x52C40402, 0x52C50402, 0x52C60402,
+    0x52C70402, 0x52C80402, 0x52C90402, 0x52CA0402, 0x52CB0402, 0x52CC0402, 0x52CD0402, 0x52CE0402,
+    0x52CF0402, 0x52D00402, 0x52D10402, 0x52D20402, 0x52D30402, 0x52D40402, 0x52D50402, 0x52D60402,
+    0x52D70402, 0x52D80402, 0x52D90402, 0x52DA0402, 0x52DB0402, 0x52DC0402, 0x52DD0402, 0x52DE0402,
+    0x52DF0402, 0x52E00402, 0x52E10402, 0x52E20402, 0x52E30402, 0x52E40402, 0x52E50402, 0x52E60402,
+    0x52E70402, 0x52E80402, 0x52E90402, 0x52EA0402, 0x52EB0402, 0x52EC0402, 0x52ED0402, 0x52EE0402,
+    0x52EF0402, 0x52F00402, 0x52F10402, 0x52F20402, 0x52F30402, 0x52F40402, 0x52F50402, 0x52F60402,
+    0x52F70402, 0x52F80402, 0x52F90402, 0x52FA0402, 0x52FB0402, 0x52FC0402, 0x52FD0402, 0x52FE0402,
+    0x52FF0402, 0x53000402, 0x53010402, 0x53020402, 0x53030402, 0x53040402, 0x53050402, 0x53060402,
+    0x53070402, 0x53080402, 0x53090402, 0x530A0402, 0x530B0402, 0x530C0402, 0x530D0402, 0x530E0402,
+    0x530F0402, 0x53100402, 0x53110402, 0x53120402, 0x53130402, 0x53140402, 0x53150402, 0x53160402,
+    0x53170402, 0x53180402, 0x53190402, 0x531A0402, 0x531B0402, 0x531C0402, 0x531D0402, 0x531E0402,
+    0x531F0402, 0x53200402, 0x53210402, 0x53220402, 0x53230402, 0x53240402, 0x53250402, 0x53260402,
+    0x53270402, 0x53280402, 0x53290402, 0x532A0402, 0x532B0402, 0x532C0402, 0x532D0402, 0x532E0402,
+    0x532F0402, 0x53300402, 0x53310402, 0x53320402, 0x53330402, 0x53340402, 0x53350402, 0x53360402,
+    0x53370402, 0x53380402, 0x53390402, 0x533A0402, 0x533B0402, 0x533C0402, 0x533D0402, 0x533E0402,
+    0x533F0402, 0x53400402, 0x53410402, 0x53420402, 0x53430402, 0x53440402, 0x53450402, 0x53460402,
+    0x53470402, 0x53480402, 0x53490402, 0x534A0402, 0x534B0402, 0x534C0402, 0x534D0402, 0x534E0402,
+    0x534F0402, 0x53500402, 0x53510402, 0x53520402, 0x53530402, 0x53540402, 0x53550402, 0x53560402,
+    0x53570402, 0x53580402, 0x53590402, 0x535A0402, 0x535B0402, 0x535C0402, 0x535D0402, 0x535E0402,
+    0x535F0402, 0x53600402, 0x53610402, 0x53620402, 0x53630402, 0x53640402, 0x53650402, 0x53660402,
+    0x53670402, 0x53680402, 0x53690402, 0x536A0402, 0x536B0402, 0x536C0402, 0x536D0402, 0x536E0402,
+    0x536F0402, 0x53700402, 0x53710402, 0x53720402, 0x53730402, 0x53740402, 0x53750402, 0x53760402,
+    0x53770402, 0x53780402, 0x53790402, 0x537A0402, 0x537B0402, 0x537C0402, 0x537D0402, 0x537E0402,
+    0x537F0402, 0x53800402, 0x53810402, 0x53820402, 0x53830402, 0x53840402, 0x53850402, 0x53860402,
+    0x53870402, 0x53880402, 0x53890402, 0x538A0402, 0x538B0402, 0x538C0402, 0x538D0402, 0x538E0402,
+    0x538F0402, 0x53900402, 0x53910402, 0x53920402, 0x53930402, 0x53940402, 0x53950402, 0x53960402,
+    0x53970402, 0x53980402, 0x53990402, 0x539A0402, 0x539B0402, 0x539C0402, 0x539D0402, 0x539E0402,
+    0x539F0402, 0x53A00402, 0x53A10402, 0x53A20402, 0x53A30402, 0x53A40402, 0x53A50402, 0x53A60402,
+    0x53A70402, 0x53A80402, 0x53A90402, 0x53AA0402, 0x53AB0402, 0x53AE0402, 0x53AF0402, 0x53B00402,
+    0x53B10402, 0x53B20402, 0x53B30402, 0x53B40402, 0x53B50402, 0x53B60402, 0x53B70402, 0x53B80402,
+    0x53B90402, 0x53BA0402, 0x53BB0402, 0x53BC0402, 0x53BD0402, 0x53BE0402, 0x53BF0402, 0x53C00402,
+    0x53C10402, 0x53C20402, 0x53C30402, 0x53C40402, 0x53C50402, 0x53C60402, 0x53C70402, 0x53C80402,
+    0x53C90402, 0x53CA0402, 0x53CB0402, 0x53CC0402, 0x53CD0402, 0x53CE0402, 0x53CF0402, 0x53D00402,
+    0x53D10402, 0x53D20402, 0x53D30402, 0x53D40402, 0x53D50402, 0x53D60402, 0x53D70402, 0x53D80402,
+    0x53D90402, 0x53DA0402, 0x53DB0402, 0x53DC0402, 0x53DD0402, 0x53DE0402, 0x53DF0402, 0x53E00402,
+    0x53E10402, 0x53E20402, 0x53E30402, 0x53E40402, 0x53E50402, 0x53E60402, 0x53E70402, 0x53E80402,
+    0x53E90402, 0x53EA0402, 0x53EB0402, 0x53EC0402, 0x53ED0402, 0x53EE0402, 0x53EF0402, 0x53F00402,
+    0x53F10402, 0x53F20402, 0x53F30402, 0x53F40402, 0x53F50402, 0x53F60402, 0x53F70402, 0x53F80402,
+    0x53F90402, 0x53FA0402, 0x53FB0402, 0x53FC0402, 0x53FD0402, 0x53FE0402, 0x53FF0402, 0x54000402,
+    0x54010402, 0x54020402, 0x54030402, 0x54040402, 0x54050402, 0x54060402, 0x54070402, 0x54080402,
+    0x54090402, 0x540A0402, 0x540B0402, 0x540C0402, 0x540D0402, 0x540E0402, 0x540F0402, 0x54100402,
+    0x54110402, 0x54120402, 0x54130402, 0x54140402, 0x54150402, 0x54160402, 0x54170402, 0x54180402,
+    0x54190402, 0x541A0402, 0x541B0402, 0x541C0402, 0x541D0402, 0x541E0402, 0x53AC0402, 0x53AD0402,
+    0x541F0402, 0x54200402, 0x54210402, 0x54220402, 0x54230402, 0x54240402, 0x54250402, 0x54260402,
+    0x54270402, 0x54280402, 0x54290402, 0x542A0402, 0x542B0402, 0x542C0402, 0x542D0402, 0x542E0402,
+    0x542F0402, 0x54300402, 0x54310402, 0x54320402, 0x54330402, 0x54340402, 0x54350402, 0x54360402,
+    0x54370402, 0x54380402, 0x54390402, 0x543A0402, 0x543B0402, 0x543C0402, 0x543D0402, 0x543E0402,
+    0x543F0402, 0x54400402, 0x54410402, 0x54420402, 0x54430402, 0x54440402, 0x54450402, 0x54460402,
+    0x54470402, 0x54480402, 0x54490402, 0x544A0402, 0x544B0402, 0x544C0402, 0x544D0402, 0x544E0402,
+    0x544F0402, 0x54500402, 0x54510402, 0x54520402, 0x54530402, 0x54540402, 0x54550402, 0x54560402,
+    0x54570402, 0x54580402, 0x54590402, 0x545A0402, 0x545B0402, 0x545C0402, 0x545D0402, 0x545E0402,
+    0x545F0402, 0x54600402, 0x54610402, 0x54620402, 0x54630402, 0x54640402, 0x54650402, 0x54660402,
+    0x54670402, 0x54680402, 0x54690402, 0x546A0402, 0x546B0402, 0x546C0402, 0x546D0402, 0x546E0402,
+    0x546F0402, 0x54700402, 0x54710402, 0x54720402, 0x54730402, 0x54740402, 0x54750402, 0x54760402,
+    0x54770402, 0x54780402, 0x54790402, 0x547A0402, 0x547B0402, 0x547C0402, 0x547D0402, 0x547E0402,
+    0x547F0402, 0x54800402, 0x54810402, 0x54820402, 0x54830402, 0x54840402, 0x54850402, 0x54860402,
+    0x54870402, 0x54880402, 0x54890402, 0x548A0402, 0x548B0402, 0x548C0402, 0x548D0402, 0x548E0402,
+    0x548F0402, 0x54900402, 0x54910402, 0x54920402, 0x54930402, 0x54940402, 0x54950402, 0x54960402,
+    0x54970402, 0x54980402, 0x54990402, 0x549A0402, 0x549B0402, 0x549C0402, 0x549D0402, 0x549E0402,
+    0x549F0402, 0x54A00402, 0x54A10402, 0x54A20402, 0x54A30402, 0x54A40402, 0x54A50402, 0x54A60402,
+    0x54A70402, 0x54A80402, 0x54A90402, 0x54AA0402, 0x54AB0402, 0x54AC0402, 0x54AD0402, 0x54AE0402,
+    0x54AF0402, 0x54B00402, 0x54B10402, 0x54B20402, 0x54B30402, 0x54B40402, 0x54B50402, 0x54B60402,
+    0x54B70402, 0x54B80402, 0x54B90402, 0x54BA0402, 0x54BB0402, 0x54BC0402, 0x54BD0402, 0x54BE0402,
+    0x54BF0402, 0x54C00402, 0x54C10402, 0x54C20402, 0x54C30402, 0x54C40402, 0x54C50402, 0x54C60402,
+    0x54C70402, 0x54C80402, 0x54C90402, 0x54CA0402, 0x54CB0402, 0x54CC0402, 0x54CD0402, 0x54CE0402,
+    0x54CF0402, 0x54D00402, 0x54D10402, 0x54D20402, 0x54D30402, 0x54D40402, 0x54D50402, 0x54D60402,
+    0x54D70402, 0x54D80402, 0x54D90402, 0x54DA0402, 0x54DB0402, 0x54DC0402, 0x54DD0402, 0x54DE0402,
+    0x54DF0402, 0x54E00402, 0x54E10402, 0x54E20402, 0x1F2C0402, 0x1F2D0402, 0x1F2E0402, 0x1F2F0402,
+    0x1F300402, 0x1F310402, 0x1F320402, 0x1F330402, 0x1F340402, 0x1F350402, 0x1F360402, 0x1F370402,
+    0x1F380402, 0x1F390402, 0x1F3A0402, 0x1F3B0402, 0x1F3C0402, 0x03110402, 0x03120402, 0x03130402,
+    0x03140402, 0x03150402, 0x54E30402, 0x54E40402, 0x54E50402, 0x54E60402, 0x54E70402, 0x54E80402,
+    0x54E90402, 0x54EA0402, 0x54EB0402, 0x54EC0402, 0x54ED0402, 0x54EE0402, 0x54EF0402, 0x54F00402,
+    0x54F10402, 0x54F20402, 0x54F30402, 0x54F40402, 0x54F50402, 0x54F60402, 0x54F70402, 0x54F80402,
+    0x54F90402, 0x54FA0402, 0x54FB0402, 0x54FC0402, 0x54FD0402, 0x54FE0402, 0x54FF0402, 0x55000402,
+    0x55010402, 0x55020402, 0x55030402, 0x55040402, 0x55050402, 0x55060402, 0x55070402, 0x55080402,
+    0x55090402, 0x550A0402, 0x550B0402, 0x550C0402, 0x550D0402, 0x550E0402, 0x550F0402, 0x55100402,
+    0x55110402, 0x55120402, 0x55130402, 0x55140402, 0x55150402, 0x55160402, 0x55170402, 0x55180402,
+    0x55190402, 0x551A0402, 0x551B0402, 0x551C0402, 0x551D0402, 0x551E0402, 0x551F0402, 0x55200402,
+    0x55210402, 0x55220402, 0x55230402, 0x55240402, 0x55250402, 0x55260402, 0x55270402, 0x55280402,
+    0x55290402, 0x552A0402, 0x552B0402, 0x552C0402, 0x552D0402, 0x552E0402, 0x552F0402, 0x55300402,
+    0x55310402, 0x55320402, 0x55330402, 0x55340402, 0x55350402, 0x55360402, 0x55370402, 0x55380402,
+    0x55390402, 0x553A0402, 0x553B0402, 0x553C0402, 0x553D0402, 0x553E0402, 0x553F0402, 0x55400402,
+    0x55410402, 0x55420402, 0x55430402, 0x55440402, 0x55450402, 0x55460402, 0x55470402, 0x55480402,
+    0x55490402, 0x554A0402, 0x554B0402, 0x554C0402, 0x554D0402, 0x554E0402, 0x554F0402, 0x55500402,
+    0x55510402, 0x55520402, 0x55530402, 0x55540402, 0x55550402, 0x55560402, 0x55570402, 0x55580402,
+    0x55590402, 0x555A0402, 0x555B0402, 0x555C0402, 0x555D0402, 0x555E0402, 0x555F0402, 0x55600402,
+    0x55610402, 0x55620402, 0x55630402, 0x55640402, 0x55650402, 0x55660402, 0x55670402, 0x55680402,
+    0x55690402, 0x556A0402, 0x556B0402, 0x556C0402, 0x556D0402, 0x556E0402, 0x556F0402, 0x55700402,
+    0x55710402, 0x55720402, 0x55730402, 0x55740402, 0x55750402, 0x55760402, 0x55770402, 0x55780402,
+    0x55790402, 0x557A0402, 0x557B0402, 0x557C0402, 0x557D0402, 0x557E0402, 0x557F0402, 0x55800402,
+    0x55810402, 0x55820402, 0x55830402, 0x55840402, 0x55850402, 0x55860402, 0x55870402, 0x55880402,
+    0x55890402, 0x558A0402, 0x558B0402, 0x558C0402, 0x558D0402, 0x558E0402, 0x558F0402, 0x55900402,
+    0x55910402, 0x55920402, 0x55930402, 0x55940402, 0x55950402, 0x55960402, 0x55970402, 0x55980402,
+    0x55990402, 0x559A0402, 0x559B0402, 0x559C0402, 0x559D0402, 0x559E0402, 0x559F0402, 0x55A00402,
+    0x55A10402, 0x55A20402, 0x55A30402, 0x55A40402, 0x55A50402, 0x55A60402, 0x55A70402, 0x55A80402,
+    0x55A90402, 0x55AA0402, 0x55AB0402, 0x55AC0402, 0x55AD0402, 0x55AE0402, 0x55AF0402, 0x55B00402,
+    0x55B10402, 0x55B20402, 0x55B30402, 0x55B40402, 0x55B50402, 0x55B60402, 0x55B70402, 0x55B80402,
+    0x55B90402, 0x55BA0402, 0x55BB0402, 0x55BC0402, 0x55BD0402, 0x55BE0402, 0x55BF0402, 0x55C00402,
+    0x55C10402, 0x55C20402, 0x55C30402, 0x55C40402, 0x55C50402, 0x55C60402, 0x55C70402, 0x55C80402,
+    0x55C90402, 0x55CA0402, 0x55CB0402, 0x55CC0402, 0x55CD0402, 0x55CE0402, 0x55CF0402, 0x55D00402,
+    0x55D10402, 0x55D20402, 0x55D30402, 0x55D40402, 0x55D50402, 0x55D60402, 0x55D70402, 0x55D80402,
+    0x55D90402, 0x55DA0402, 0x55DB0402, 0x55DC0402, 0x55DD0402, 0x55DE0402, 0x55DF0402, 0x55E00402,
+    0x55E10402, 0x55E20402, 0x55E30402, 0x55E40402, 0x55E50402, 0x55E60402, 0x55E70402, 0x55E80402,
+    0x55E90402, 0x55EA0402, 0x55EB0402, 0x55EC0402, 0x55ED0402, 0x55EE0402, 0x55EF0402, 0x55F00402,
+    0x55F10402, 0x55F20402, 0x55F30402, 0x55F40402, 0x55F50402, 0x55F60402, 0x55F70402, 0x55F80402,
+    0x55F90402, 0x55FA0402, 0x55FB0402, 0x55FC0402, 0x55FD0402, 0x55FE0402, 0x55FF0402, 0x56000402,
+    0x56010402, 0x56020402, 0x56030402, 0x56040402, 0x56050402, 0x56060402, 0x56070402, 0x56080402,
+    0x56090402, 0x560A0402, 0x560B0402, 0x560C0402, 0x560D0402, 0x560E0402, 0x560F0402, 0x56100402,
+    0x56110402, 0x56120402, 0x56130402, 0x56140402, 0x56150402, 0x56160402, 0x56170402, 0x56180402,
+    0x56190402, 0x561A0402, 0x561B0402, 0x561C0402, 0x561D0402, 0x561E0402, 0x561F0402, 0x56200402,
+    0x56210402, 0x56220402, 0x56230402, 0x56240402, 0x56250402, 0x56260402, 0x56270402, 0x56280402,
+    0x56290402, 0x562A0402, 0x562B0402, 0x562C0402, 0x562D0402, 0x562E0402, 0x562F0402, 0x56300402,
+    0x56310402, 0x56320402, 0x56330402, 0x56340402, 0x56350402, 0x56360402, 0x56370402, 0x56380402,
+    0x56390402, 0x563A0402, 0x563B0402, 0x563C0402, 0x563D0402, 0x563E0402, 0x563F0402, 0x56400402,
+    0x56410402, 0x56420402, 0x56430402, 0x56440402, 0x56450402, 0x56460402, 0x56470402, 0x56480402,
+    0x56490402, 0x564A0402, 0x564B0402, 0x564C0402, 0x564D0402, 0x564E0402, 0x564F0402, 0x56500402,
+    0x56510402, 0x56520402, 0x56530402, 0x56540402, 0x56550402, 0x56560402, 0x56570402, 0x56580402,
+    0x56590402, 0x565A0402, 0x565B0402, 0x565C0402, 0x565D0402, 0x565E0402, 0x565F0402, 0x56600402,
+    0x56610402, 0x56620402, 0x56630402, 0x56640402, 0x56650402, 0x56660402, 0x56670402, 0x56680402,
+    0x56690402, 0x566A0402, 0x566B0402, 0x566C0402, 0x566D0402, 0x566E0402, 0x566F0402, 0x56700402,
+    0x56710402, 0x56720402, 0x56730402, 0x56740402, 0x56750402, 0x56760402, 0x56770402, 0x56780402,
+    0x56790402, 0x567A0402, 0x567B0402, 0x567C0402, 0x567D0402, 0x567E0402, 0x567F0402, 0x56800402,
+    0x56810402, 0x56820402, 0x56830402, 0x56840402, 0x56850402, 0x56860402, 0x56870402, 0x56880402,
+    0x56890402, 0x568A0402, 0x568B0402, 0x568C0402, 0x568D0402, 0x568E0402, 0x568F0402, 0x56900402,
+    0x56910402, 0x56920402, 0x56930402, 0x56940402, 0x56950402, 0x56960402, 0x56970402, 0x56980402,
+    0x56990402, 0x569A0402, 0x569B0402, 0x569C0402, 0x569D0402, 0x569E0402, 0x569F0402, 0x56A00402,
+    0x56A10402, 0x56A20402, 0x56A30402, 0x56A40402, 0x56A50402, 0x56A60402, 0x56A70402, 0x56A80402,
+    0x56A90402, 0x56AA0402, 0x56AB0402, 0x56AC0402, 0x56AD0402, 0x56AE0402, 0x56AF0402, 0x56B00402,
+    0x56B10402, 0x56B20402, 0x56B30402, 0x56B40402, 0x56B50402, 0x56B60402, 0x56B70402, 0x56B80402,
+    0x56B90402, 0x56BA0402, 0x56BB0402, 0x56BC0402, 0x56BD0402, 0x56BE0402, 0x56BF0402, 0x56C00402,
+    0x56C10402, 0x56C20402, 0x56C30402, 0x56C40402, 0x56C50402, 0x56C60402, 0x56C70402, 0x56C80402,
+    0x56C90402, 0x56CA0402, 0x56CB0402, 0x56CC0402, 0x56CD0402, 0x56CE0402, 0x56CF0402, 0x56D00402,
+    0x56D10402, 0x56D20402, 0x56D30402, 0x56D40402, 0x56D50402, 0x56D60402, 0x56D70402, 0x56D80402,
+    0x56D90402, 0x56DA0402, 0x56DB0402, 0x56DC0402, 0x56DD0402, 0x56DE0402, 0x56DF0402, 0x56E00402,
+    0x56E10402, 0x56E20402, 0x56E30402, 0x56E40402, 0x56E50402, 0x56E60402, 0x56E70402, 0x56E80402,
+    0x56E90402, 0x56EA0402, 0x56EB0402, 0x56EC0402, 0x56ED0402, 0x56EE0402, 0x56EF0402, 0x56F00402,
+    0x56F10402, 0x56F20402, 0x56F30402, 0x56F40402, 0x56F50402, 0x56F60402, 0x56F70402, 0x56F80402,
+    0x56F90402, 0x56FA0402, 0x56FB0402, 0x56FC0402, 0x56FD0402, 0x56FE0402, 0x56FF0402, 0x57000402,
+    0x57010402, 0x57020402, 0x57030402, 0x57040402, 0x57050402, 0x57060402, 0x57070402, 0x57080402,
+    0x57090402, 0x570A0402, 0x570B0402, 0x570C0402, 0x570D0402, 0x570E0402, 0x570F0402, 0x57100402,
+    0x57110402, 0x57120402, 0x57130402, 0x57140402, 0x57150402, 0x57160402, 0x57170402, 0x57180402,
+    0x57190402, 0x571A0402, 0x571B0402, 0x571C0402, 0x571D0402, 0x571E0402, 0x571F0402, 0x57200402,
+    0x57210402, 0x57220402, 0x57230402, 0x57240402, 0x57250402, 0x57260402, 0x57270402, 0x57280402,
+    0x57290402, 0x572A0402, 0x572B0402, 0x572C0402, 0x572D0402, 0x572E0402, 0x572F0402, 0x57300402,
+    0x57310402, 0x57320402, 0x57330402, 0x57340402, 0x57350402, 0x57360402, 0x57370402, 0x57380402,
+    0x57390402, 0x573A0402, 0x573B0402, 0x573C0402, 0x573D0402, 0x573E0402, 0x573F0402, 0x57400402,
+    0x57410402, 0x57420402, 0x57430402, 0x57440402, 0x57450402, 0x57460402, 0x57470402, 0x57480402,
+    0x57490402, 0x574A0402, 0x574B0402, 0x574C0402, 0x574D0402, 0x574E0402, 0x574F0402, 0x57500402,
+    0x57510402, 0x57520402, 0x57530402, 0x57540402, 0x57550402, 0x57560402, 0x57570402, 0x57580402,
+    0x57590402, 0x575A0402, 0x575B0402, 0x575C0402, 0x575D0402, 0x575E0402, 0x575F0402, 0x57600402,
+    0x57610402, 0x57620402, 0x57630402, 0x57640402, 0x57650402, 0x57660402, 0x57670402, 0x57680402,
+    0x57690402, 0x576A0402, 0x576B0402, 0x576C0402, 0x576D0402, 0x576E0402, 0x576F0402, 0x57700402,
+    0x57710402, 0x57720402, 0x57730402, 0x57740402, 0x57750402, 0x57760402, 0x57770402, 0x57780402,
+    0x57790402, 0x577A0402, 0x577B0402, 0x577C0402, 0x577D0402, 0x577E0402, 0x577F0402, 0x57800402,
+    0x57810402, 0x57820402, 0x57830402, 0x57840402, 0x57850402, 0x57860402, 0x57870402, 0x57880402,
+    0x57890402, 0x578A0402, 0x578B0402, 0x578C0402, 0x578D0402, 0x578E0402, 0x578F0402, 0x57900402,
+    0x57910402, 0x57920402, 0x57930402, 0x57940402, 0x57950402, 0x57960402, 0x57970402, 0x57980402,
+    0x57990402, 0x579A0402, 0x579B0402, 0x579C0402, 0x579D0402, 0x579E0402, 0x579F0402, 0x57A00402,
+    0x57A10402, 0x57A20402, 0x57A30402, 0x57A40402, 0x57A50402, 0x57A60402, 0x57A70402, 0x57A80402,
+    0x57A90402, 0x57AA0402, 0x57AB0402, 0x57AC0402, 0x57AD0402, 0x57AE0402, 0x57AF0402, 0x57B00402,
+    0x57B10402, 0x57B20402, 0x57B30402, 0x57B40402, 0x57B50402, 0x57B60402, 0x57B70402, 0x57B80402,
+    0x57B90402, 0x57BA0402, 0x57BB0402, 0x57BC0402, 0x57BD0402, 0x57BE0402, 0x57BF0402, 0x57C00402,
+    0x57C10402, 0x57C20402, 0x57C30402, 0x57C40402, 0x57C50402, 0x57C60402, 0x57C70402, 0x57C80402,
+    0x57C90402, 0x57CA0402, 0x57CB0402, 0x57CC0402, 0x57CD0402, 0x57CE0402, 0x57CF0402, 0x57D00402,
+    0x57D10402, 0x57D20402, 0x57D30402, 0x57D40402, 0x57D50402, 0x57D60402, 0x57D70402, 0x57D80402,
+    0x57D90402, 0x57DA0402, 0x57DB0402, 0x57DC0402, 0x57DD0402, 0x57DE0402, 0x57DF0402, 0x57E00402,
+    0x57E10402, 0x57E20402, 0x57E30402, 0x57E40402, 0x57E50402, 0x57E60402, 0x57E70402, 0x57E80402,
+    0x57E90402, 0x57EA0402, 0x57EB0402, 0x57EC0402, 0x57ED0402, 0x57EE0402, 0x57EF0402, 0x57F00402,
+    0x57F10402, 0x57F20402, 0x57F30402, 0x57F40402, 0x57F50402, 0x57F60402, 0x57F70402, 0x57F80402,
+    0x57F90402, 0x57FA0402, 0x57FB0402, 0x57FC0402, 0x57FD0402, 0x57FE0402, 0x57FF0402, 0x58000402,
+    0x58010402, 0x58020402, 0x58030402, 0x58040402, 0x58050402, 0x58060402, 0x58070402, 0x58080402,
+    0x58090402, 0x580A0402, 0x580B0402, 0x580C0402, 0x580D0402, 0x580E0402, 0x580F0402, 0x58100402,
+    0x58110402, 0x58120402, 0x58130402, 0x58140402, 0x58150402, 0x58160402, 0x58170402, 0x58180402,
+    0x58190402, 0x581A0402, 0x581B0402, 0x581C0402, 0x581D0402, 0x581E0402, 0x581F0402, 0x58200402,
+    0x58210402, 0x58220402, 0x58230402, 0x58240402, 0x58250402, 0x58260402, 0x58270402, 0x58280402,
+    0x58290402, 0x582A0402, 0x582B0402, 0x582C0402, 0x582D0402, 0x582E0402, 0x582F0402, 0x58300402,
+    0x58310402, 0x58320402, 0x58330402, 0x58340402, 0x58350402, 0x58360402, 0x58370402, 0x58380402,
+    0x58390402, 0x583A0402, 0x583B0402, 0x583C0402, 0x583D0402, 0x583E0402, 0x583F0402, 0x58400402,
+    0x58410402, 0x58420402, 0x58430402, 0x58440402, 0x58450402, 0x58460402, 0x58470402, 0x58480402,
+    0x58490402, 0x584A0402, 0x584B0402, 0x584C0402, 0x584D0402, 0x584E0402, 0x584F0402, 0x58500402,
+    0x58510402, 0x58520402, 0x58530402, 0x58540402, 0x58550402, 0x58560402, 0x58570402, 0x58580402,
+    0x58590402, 0x585A0402, 0x585B0402, 0x585C0402, 0x585D0402, 0x585E0402, 0x585F0402, 0x58600402,
+    0x58610402, 0x58620402, 0x58630402, 0x58640402, 0x58650402, 0x58660402, 0x58670402, 0x58680402,
+    0x58690402, 0x586A0402, 0x586B0402, 0x586C0402, 0x586D0402, 0x586E0402, 0x586F0402, 0x58700402,
+    0x58710402, 0x58720402, 0x58730402, 0x58740402, 0x58750402, 0x58760402, 0x58770402, 0x58780402,
+    0x58790402, 0x587A0402, 0x587B0402, 0x587C0402, 0x587D0402, 0x587E0402, 0x587F0402, 0x58800402,
+    0x58810402, 0x58820402, 0x58830402, 0x58840402, 0x58850402, 0x58860402, 0x58870402, 0x58880402,
+    0x58890402, 0x588A0402, 0x588B0402, 0x588C0402, 0x588D0402, 0x588E0402, 0x588F0402, 0x58900402,
+    0x58910402, 0x58920402, 0x58930402, 0x58940402, 0x58950402, 0x58960402, 0x58970402, 0x58980402,
+    0x58990402, 0x589A0402, 0x589B0402, 0x589C0402, 0x589D0402, 0x589E0402, 0x589F0402, 0x58A00402,
+    0x58A10402, 0x58A20402, 0x58A30402, 0x58A40402, 0x58A50402, 0x58A60402, 0x58A70402, 0x58A80402,
+    0x58A90402, 0x58AA0402, 0x58AB0402, 0x58AC0402, 0x58AD0402, 0x58AE0402, 0x58AF0402, 0x58B00402,
+    0x58B10402, 0x58B20402, 0x58B30402, 0x58B40402, 0x58B50402, 0x58B60402, 0x58B70402, 0x58B80402,
+    0x58B90402, 0x58BA0402, 0x58BB0402, 0x58BC0402, 0x58BD0402, 0x58BE0402, 0x58BF0402, 0x58C00402,
+    0x58C10402, 0x58C20402, 0x58C30402, 0x58C40402, 0x58C50402, 0x58C60402, 0x58C70402, 0x58C80402,
+    0x58C90402, 0x58CA0402, 0x58CB0402, 0x58CC0402, 0x58CD0402, 0x58CE0402, 0x58CF0402, 0x58D00402,
+    0x58D10402, 0x58D20402, 0x58D30402, 0x58D40402, 0x58D50402, 0x58D60402, 0x58D70402, 0x58D80402,
+    0x58D90402, 0x58DA0402, 0x58DB0402, 0x58DC0402, 0x58DD0402, 0x58DE0402, 0x58DF0402, 0x58E00402,
+    0x58E10402, 0x58E20402, 0x58E30402, 0x58E40402, 0x58E50402, 0x58E60402, 0x58E70402, 0x58E80402,
+    0x58E90402, 0x58EA0402, 0x58EB0402, 0x58EC0402, 0x58ED0402, 0x58EE0402, 0x58EF0402, 0x58F00402,
+    0x58F10402, 0x58F20402, 0x58F30402, 0x58F40402, 0x58F50402, 0x58F60402, 0x58F70402, 0x58F80402,
+    0x58F90402, 0x58FA0402, 0x58FB0402, 0x58FC0402, 0x58FD0402, 0x58FE0402, 0x58FF0402, 0x59000402,
+    0x59010402, 0x59020402, 0x59030402, 0x59040402, 0x59050402, 0x59060402, 0x59070402, 0x59080402,
+    0x59090402, 0x590A0402, 0x590B0402, 0x590C0402, 0x590D0402, 0x590E0402, 0x590F0402, 0x59100402,
+    0x59110402, 0x59120402, 0x59130402, 0x59140402, 0x59150402, 0x59160402, 0x59170402, 0x59180402,
+    0x59190402, 0x591A0402, 0x591B0402, 0x591C0402, 0x591D0402, 0x591E0402, 0x591F0402, 0x59200402,
+    0x59210402, 0x59220402, 0x59230402, 0x59240402, 0x59250402, 0x59260402, 0x59270402, 0x59280402,
+    0x59290402, 0x592A0402, 0x592B0402, 0x592C0402, 0x592D0402, 0x592E0402, 0x592F0402, 0x59300402,
+    0x59310402, 0x59320402, 0x59330402, 0x59340402, 0x59350402, 0x59360402, 0x59370402, 0x59380402,
+    0x59390402, 0x593A0402, 0x593B0402, 0x593C0402, 0x593D0402, 0x593E0402, 0x593F0402, 0x59400402,
+    0x59410402, 0x59420402, 0x59430402, 0x59440402, 0x59450402, 0x59460402, 0x59470402, 0x59480402,
+    0x59490402, 0x594A0402, 0x594B0402, 0x594C0402, 0x594D0402, 0x594E0402, 0x594F0402, 0x59500402,
+    0x59510402, 0x59520402, 0x59530402, 0x59540402, 0x59550402, 0x59560402, 0x59570402, 0x59580402,
+    0x59590402, 0x595A0402, 0x595B0402, 0x595C0402, 0x595D0402, 0x595E0402, 0x595F0402, 0x59600402,
+    0x59610402, 0x59620402, 0x59630402, 0x59640402, 0x59650402, 0x59660402, 0x59670402, 0x59680402,
+    0x59690402, 0x596A0402, 0x596B0402, 0x596C0402, 0x596D0402, 0x596E0402, 0x596F0402, 0x59700402,
+    0x59710402, 0x59720402, 0x59730402, 0x59740402, 0x59750402, 0x59760402, 0x59770402, 0x59780402,
+    0x59790402, 0x597A0402, 0x597B0402, 0x597C0402, 0x597D0402, 0x597E0402, 0x597F0402, 0x59800402,
+    0x59810402, 0x59820402, 0x59830402, 0x59840402, 0x59850402, 0x59860402, 0x59870402, 0x59880402,
+    0x59890402, 0x598A0402, 0x598B0402, 0x598C0402, 0x598D0402, 0x598E0402, 0x598F0402, 0x59900402,
+    0x59910402, 0x59920402, 0x59930402, 0x59940402, 0x59950402, 0x59960402, 0x59970402, 0x59980402,
+    0x59990402, 0x599A0402, 0x599B0402, 0x599C0402, 0x599D0402, 0x599E0402, 0x599F0402, 0x59A00402,
+    0x59A10402, 0x59A20402, 0x59A30402, 0x59A40402, 0x59A50402, 0x59A60402, 0x59A70402, 0x59A80402,
+    0x59A90402, 0x59AA0402, 0x59AB0402, 0x59AC0402, 0x59AD0402, 0x59AE0402, 0x59AF0402, 0x59B00402,
+    0x59B10402, 0x59B20402, 0x59B30402, 0x59B40402, 0x59B50402, 0x59B60402, 0x59B70402, 0x59B80402,
+    0x59B90402, 0x59BA0402, 0x59BB0402, 0x59BC0402, 0x59BD0402, 0x59BE0402, 0x59BF0402, 0x59C00402,
+    0x59C10402, 0x59C20402, 0x59C30402, 0x59C40402, 0x59C50402, 0x59C60402, 0x59C70402, 0x59C80402,
+    0x59C90402, 0x59CA0402, 0x59CB0402, 0x59CC0402, 0x59CD0402, 0x59CE0402, 0x59CF0402, 0x59D00402,
+    0x59D10402, 0x59D20402, 0x59D30402, 0x59D40402, 0x59D50402, 0x59F10402, 0x59F20402, 0x59F30402,
+    0x59F40402, 0x59F50402, 0x59F60402, 0x59F70402, 0x59F80402, 0x59F90402, 0x59FA0402, 0x59FB0402,
+    0x59FC0402, 0x59FD0402, 0x59FE0402, 0x59FF0402, 0x5A000402, 0x5A010402, 0x5A020402, 0x5A030402,
+    0x5A040402, 0x5A050402, 0x5A060402, 0x5A070402, 0x5A080402, 0x5A090402, 0x5A0A0402, 0x5A0B0402,
+    0x5A0C0402, 0x5A0D0402, 0x5A0E0402, 0x5A0F0402, 0x5A100402, 0x5A110402, 0x5A120402, 0x5A130402,
+    0x5A140402, 0x5A150402, 0x5A160402, 0x5A170402, 0x5A180402, 0x5A190402, 0x5A1A0402, 0x5A1B0402,
+    0x5A1C0402, 0x5A1D0402, 0x5A1E0402, 0x5A1F0402, 0x5A200402, 0x5A210402, 0x5A220402, 0x5A230402,
+    0x5A240402, 0x5A250402, 0x5A260402, 0x5A270402, 0x5A280402, 0x5A290402, 0x5A2A0402, 0x5A2B0402,
+    0x5A2C0402, 0x5A2D0402, 0x5A2E0402, 0x5A2F0402, 0x5A300402, 0x5A310402, 0x5A320402, 0x5A330402,
+    0x5A340402, 0x5A350402, 0x5A360402, 0x5A370402, 0x5A380402, 0x5A390402, 0x5A3A0402, 0x5A3B0402,
+    0x5A3C0402, 0x5A3D0402, 0x5A3E0402, 0x5A3F0402, 0x5A400402, 0x5A410402, 0x5A420402, 0x5A430402,
+    0x5A440402, 0x5A450402, 0x5A460402, 0x5A470402, 0x5A480402, 0x5A490402, 0x5A4A0402, 0x5A4B0402,
+    0x5A4C0402, 0x5A4D0402, 0x5A4E0402, 0x5A4F0402, 0x5A500402, 0x5A510402, 0x5A520402, 0x5A530402,
+    0x5A540402, 0x5A550402, 0x5A560402, 0x5A570402, 0x5A580402, 0x5A590402, 0x5A5A0402, 0x5A5B0402,
+    0x5A5C0402, 0x5A5D0402, 0x5A5E0402, 0x5A5F0402, 0x5A600402, 0x5A610402, 0x5A620402, 0x5A630402,
+    0x5A640402, 0x5A650402, 0x5A660402, 0x5A670402, 0x5A680402, 0x5A690402, 0x5A6A0402, 0x5A6B0402,
+    0x5A6C0402, 0x5A6D0402, 0x5A6E0402, 0x5A6F0402, 0x5A700402, 0x5A710402, 0x5A720402, 0x5A730402,
+    0x5A740402, 0x5A750402, 0x5A760402, 0x5A770402, 0x5A780402, 0x5A790402, 0x5A7A0402, 0x5A7B0402,
+    0x5A7C0402, 0x5A7D0402, 0x5A7E0402, 0x5A7F0402, 0x5A800402, 0x5A810402, 0x5A820402, 0x5A830402,
+    0x5A840402, 0x5A850402, 0x5A860402, 0x5A870402, 0x5A880402, 0x5A890402, 0x5A8A0402, 0x5A8B0402,
+    0x5A8C0402, 0x5A8D0402, 0x5A8E0402, 0x5A8F0402, 0x5A900402, 0x5A910402, 0x5A920402, 0x5A930402,
+    0x5A940402, 0x5A950402, 0x5A960402, 0x5A970402, 0x5A980402, 0x5A990402, 0x5A9A0402, 0x5A9B0402,
+    0x5A9C0402, 0x5A9D0402, 0x5A9E0402, 0x5A9F0402, 0x5AA00402, 0x5AA10402, 0x5AA20402, 0x5AA30402,
+    0x5AA40402, 0x5AA50402, 0x5AA60402, 0x5AA70402, 0x5AA80402, 0x5AA90402, 0x5AAA0402, 0x5AAB0402,
+    0x5AAC0402, 0x5AAD0402, 0x5AAE0402, 0x5AAF0402, 0x5AB00402, 0x5AB10402, 0x5AB20402, 0x5AB30402,
+    0x5AB40402, 0x5AB50402, 0x5AB60402, 0x5AB70402, 0x5AB80402, 0x5AB90402, 0x5ABA0402, 0x5ABB0402,
+    0x5ABC0402, 0x5ABD0402, 0x5ABE0402, 0x5ABF0402, 0x5AC00402, 0x5AC10402, 0x5AC20402, 0x5AC30402,
+    0x5AC40402, 0x5AC50402, 0x5AC60402, 0x5AC70402, 0x5AC80402, 0x5AC90402, 0x5ACA0402, 0x5ACB0402,
+    0x5ACC0402, 0x5ACD0402, 0x5ACE0402, 0x5ACF0402, 0x5AD00402, 0x5AD10402, 0x5AD20402, 0x5AD30402,
+    0x5AD40402, 0x5AD50402, 0x5AD60402, 0x5AD70402, 0x5AD80402, 0x5AD90402, 0x5ADA0402, 0x5ADB0402,
+    0x5ADC0402, 0x5ADD0402, 0x5ADE0402, 0x5ADF0402, 0x5AE00402, 0x5AE10402, 0x5AE20402, 0x5AE30402,
+    0x5AE40402, 0x5AE50402, 0x5AE60402, 0x5AE70402, 0x5AE80402, 0x5AE90402, 0x5AEA0402, 0x5AEB0402,
+    0x5AEC0402, 0x5AED0402, 0x5AEE0402, 0x5AEF0402, 0x5AF00402, 0x5AF10402, 0x5AF20402, 0x5AF30402,
+    0x5AF40402, 0x5AF50402, 0x5AF60402, 0x5AF70402, 0x5AF80402, 0x5AF90402, 0x5AFA0402, 0x5AFB0402,
+    0x5AFC0402, 0x5AFD0402, 0x5AFE0402, 0x5AFF0402, 0x5B000402, 0x5B010402, 0x5B020402, 0x5B030402,
+    0x5B040402, 0x5B050402, 0x5B060402, 0x5B070402, 0x5B080402, 0x5B090402, 0x5B0A0402, 0x5B0B0402,
+    0x5B0C0402, 0x5B0D0402, 0x5B0E0402, 0x5B0F0402, 0x5B100402, 0x5B110402, 0x5B120402, 0x5B130402,
+    0x5B140402, 0x5B150402, 0x5B160402, 0x5B170402, 0x5B180402, 0x5B190402, 0x5B1A0402, 0x5B1B0402,
+    0x5B1C0402, 0x5B1D0402, 0x5B1E0402, 0x5B1F0402, 0x5B200402, 0x5B210402, 0x5B220402, 0x5B230402,
+    0x5B240402, 0x5B250402, 0x5B260402, 0x5B270402, 0x5B280402, 0x5B290402, 0x5B2A0402, 0x5B2B0402,
+    0x5B2C0402, 0x5B2D0402, 0x5B2E0402, 0x5B2F0402, 0x5B300402, 0x5B310402, 0x5B320402, 0x5B330402,
+    0x5B340402, 0x5B350402, 0x5B360402, 0x5B370402, 0x5B380402, 0x5B390402, 0x5B3A0402, 0x5B3B0402,
+    0x5B3C0402, 0x5B3D0402, 0x5B3E0402, 0x5B3F0402, 0x5B400402, 0x5B410402, 0x5B420402, 0x5B430402,
+    0x5B440402, 0x5B450402, 0x5B460402, 0x5B470402, 0x5B480402, 0x5B490402, 0x5B4A0402, 0x5B4B0402,
+    0x5B4C0402, 0x5B4D0402, 0x5B4E0402, 0x5B4F0402, 0x5B500402, 0x5B510402, 0x5B520402, 0x5B530402,
+    0x5B540402, 0x5B550402, 0x5B560402, 0x5B570402, 0x5B580402, 0x5B590402, 0x5B5A0402, 0x5B5B0402,
+    0x5B5C0402, 0x5B5D0402, 0x5B5E0402, 0x5B5F0402, 0x5B600402, 0x5B610402, 0x5B620402, 0x5B630402,
+    0x5B640402, 0x5B650402, 0x5B660402, 0x5B670402, 0x5B680402, 0x5B690402, 0x5B6A0402, 0x5B6B0402,
+    0x5B6C0402, 0x5B6D0402, 0x5B6E0402, 0x5B6F0402, 0x5B700402, 0x5B710402, 0x5B720402, 0x5B730402,
+    0x5B740402, 0x5B750402, 0x5B760402, 0x5B770402, 0x5B780402, 0x5B790402, 0x5B7A0402, 0x5B7B0402,
+    0x5B7C0402, 0x5B7D0402, 0x5B7E0402, 0x5B7F0402, 0x5B800402, 0x5B810402, 0x5B820402, 0x5B830402,
+    0x5B840402, 0x5B850402, 0x5B860402, 0x5B870402, 0x5B880402, 0x5B890402, 0x5B8A0402, 0x5B8B0402,
+    0x5B8C0402, 0x5B8D0402, 0x5B8E0402, 0x5B8F0402, 0x5B900402, 0x5B910402, 0x5B920402, 0x5B930402,
+    0x5B940402, 0x5B950402, 0x5B960402, 0x5B970402, 0x5B980402, 0x5B990402, 0x5B9A0402, 0x5B9B0402,
+    0x5B9C0402, 0x5B9D0402, 0x5B9E0402, 0x5B9F0402, 0x5BA00402, 0x5BA10402, 0x5BA20402, 0x5BA30402,
+    0x5BA40402, 0x5BA50402, 0x5BA60402, 0x5BA70402, 0x5BA80402, 0x5BA90402, 0x5BAA0402, 0x5BAB0402,
+    0x5BAC0402, 0x5BAD0402, 0x5BAE0402, 0x5BAF0402, 0x5BB00402, 0x5BB10402, 0x5BB20402, 0x5BB30402,
+    0x5BB40402, 0x5BB50402, 0x5BB60402, 0x5BB70402, 0x5BB80402, 0x5BB90402, 0x5BBA0402, 0x5BBB0402,
+    0x5BBC0402, 0x5BBD0402, 0x5BBE0402, 0x5BBF0402, 0x5BC00402, 0x5BC10402, 0x5BC20402, 0x5BC30402,
+    0x5BC40402, 0x5BC50402, 0x5BC60402, 0x5BC70402, 0x5BC80402, 0x5BC90402, 0x5BCA0402, 0x5BCB0402,
+    0x5BCC0402, 0x5BCD0402, 0x5BCE0402, 0x5BCF0402, 0x5BD00402, 0x5BD10402, 0x5BD20402, 0x5BD30402,
+    0x5BD40402, 0x5BD50402, 0x5BD60402, 0x5BD70402, 0x5BD80402, 0x5BD90402, 0x5BDA0402, 0x5BDB0402,
+    0x5BDC0402, 0x5BDD0402, 0x5BDE0402, 0x5BDF0402, 0x5BE00402, 0x5BE10402, 0x5BE20402, 0x5BE30402,
+    0x5BE40402, 0x5BE50402, 0x5BE60402, 0x5BE70402, 0x5BE80402, 0x5BE90402, 0x5BEA0402, 0x5BEB0402,
+    0x5BEC0402, 0x5BED0402, 0x5BEE0402, 0x5BEF0402, 0x5BF00402, 0x5BF10402, 0x5BF20402, 0x5BF30402,
+    0x5BF40402, 0x5BF50402, 0x5BF60402, 0x5BF70402, 0x5BF80402, 0x5BF90402, 0x5BFA0402, 0x5BFB0402,
+    0x5BFC0402, 0x5BFD0402, 0x5BFE0402, 0x5BFF0402, 0x5C000402, 0x5C010402, 0x5C020402, 0x5C030402,
+    0x5C040402, 0x5C050402, 0x5C060402, 0x5C070402, 0x5C080402, 0x5C090402, 0x5C0A0402, 0x5C0B0402,
+    0x5C0C0402, 0x5C0D0402, 0x5C0E0402, 0x5C0F0402, 0x5C100402, 0x5C110402, 0x5C120402, 0x5C130402,
+    0x5C140402, 0x5C150402, 0x5C160402, 0x5C170402, 0x5C180402, 0x5C190402, 0x5C1A0402, 0x5C1B0402,
+    0x5C1C0402, 0x5C1D0402, 0x5C1E0402, 0x5C1F0402, 0x5C200402, 0x5C210402, 0x5C220402, 0x5C230402,
+    0x5C240402, 0x5C250402, 0x5C260402, 0x5C270402, 0x5C280402, 0x5C290402, 0x5C2A0402, 0x5C2B0402,
+    0x5C2C0402, 0x5C2D0402, 0x5C2E0402, 0x5C2F0402, 0x5C300402, 0x5C310402, 0x5C320402, 0x5C330402,
+    0x5C340402, 0x5C350402, 0x5C360402, 0x5C370402, 0x3E160402, 0x3E170402, 0x3E180402, 0x3E190402,
+    0x3E1A0402, 0x3E1B0402, 0x3E1C0402, 0x3E1D0402, 0x3E1E0402, 0x3E1F0402, 0x3E200402, 0x3E210402,
+    0x3E220402, 0x3E230402, 0x3E240402, 0x3E250402, 0x3E260402, 0x3E270402, 0x3E280402, 0x3E290402,
+    0x3E2A0402, 0x3E2B0402, 0x3E2C0402, 0x3E2D0402, 0x3E2E0402, 0x3E2F0402, 0x3E300402, 0x3E310402,
+    0x3E320402, 0x3E330402, 0x3E340402, 0x3E350402, 0x3E360402, 0x3E370402, 0x3E380402, 0x3E390402,
+    0x3E3A0402, 0x3E3B0402, 0x3E3C0402, 0x3E3D0402, 0x3E3E0402, 0x3E3F0402, 0x3E400402, 0x3E410402,
+    0x3E420402, 0x3E430402, 0x3E440402, 0x3E450402, 0x3E460402, 0x3E470402, 0x3E480402, 0x3E490402,
+    0x3E4A0402, 0x3E4B0402, 0x3E4C0402, 0x3E4D0402, 0x3E4E0402, 0x3E4F0402, 0x3E500402, 0x3E510402,
+    0x3E520402, 0x3E530402, 0x3E540402, 0x3E550402, 0x3E560402, 0x3E570402, 0x3E580402, 0x3E590402,
+    0x3E5A0402, 0x3E5B0402, 0x3E5C0402, 0x3E5D0402, 0x3E5E0402, 0x3E5F0402, 0x3E600402, 0x3E610402,
+    0x3E620402, 0x3E630402, 0x3E640402, 0x3E650402, 0x3E660402, 0x3E670402, 0x3E680402, 0x3E690402,
+    0x3E6A0402, 0x3E6B0402, 0x3E6C0402, 0x3E6D0402, 0x3E6E0402, 0x3E6F0402, 0x3E700402, 0x3E710402,
+    0x3E720402, 0x3E730402, 0x3E740402, 0x3E750402, 0x3E760402, 0x3E770402, 0x3E780402, 0x3E790402,
+    0x3E7A0402, 0x3E7B0402, 0x3E7C0402, 0x3E7D0402, 0x3E7E0402, 0x3E7F0402, 0x3E800402, 0x3E810402,
+    0x3E820402, 0x3E830402, 0x3E840402, 0x3E850402, 0x3E860402, 0x3E870402, 0x3E880402, 0x3E890402,
+    0x3E8A0402, 0x3E8B0402, 0x3E8C0402, 0x3E8D0402, 0x3E8E0402, 0x3E8F0402, 0x3E900402, 0x3E910402,
+    0x3E920402, 0x3E930402, 0x3E940402, 0x3E950402, 0x3E960402, 0x3E970402, 0x3E980402, 0x3E990402,
+    0x3E9A0402, 0x3E9B0402, 0x3E9C0402, 0x3E9D0402, 0x3E9E0402, 0x3E9F0402, 0x3EA00402, 0x3EA10402,
+    0x3EA20402, 0x3EA30402, 0x3EA40402, 0x3EA50402, 0x3EA60402, 0x3EA70402, 0x3EA80402, 0x3EA90402,
+    0x3EAA0402, 0x3EAB0402, 0x3EAC0402, 0x3EAD0402, 0x3EAE0402, 0x3EAF0402, 0x3EB00402, 0x3EB10402,
+    0x3EB20402, 0x3EB30402, 0x3EB40402, 0x3EB50402, 0x3EB60402, 0x3EB70402, 0x3EB80402, 0x3EB90402,
+    0x3EBA0402, 0x3EBB0402, 0x3EBC0402, 0x3EBD0402, 0x3EBE0402, 0x3EBF0402, 0x3EC00402, 0x3EC10402,
+    0x3EC20402, 0x3EC30402, 0x3EC40402, 0x3EC50402, 0x3EC60402, 0x3EC70402, 0x3EC80402, 0x3EC90402,
+    0x3ECA0402, 0x3ECB0402, 0x3ECC0402, 0x3ECD0402, 0x3ECE0402, 0x3ECF0402, 0x3ED00402, 0x3ED10402,
+    0x3ED20402, 0x3ED30402, 0x3ED40402, 0x3ED50402, 0x3ED60402, 0x3ED70402, 0x3ED80402, 0x3ED90402,
+    0x3EDA0402, 0x3EDB0402, 0x3EDC0402, 0x3EDD0402, 0x3EDE0402, 0x3EDF0402, 0x3EE00402, 0x3EE10402,
+    0x3EE20402, 0x3EE30402, 0x3EE40402, 0x3EE50402, 0x3EE60402, 0x3EE70402, 0x3EE80402, 0x3EE90402,
+    0x3EEA0402, 0x3EEB0402, 0x3EEC0402, 0x3EED0402, 0x3EEE0402, 0x3EEF0402, 0x3EF00402, 0x3EF10402,
+    0x3EF20402, 0x3EF30402, 0x3EF40402, 0x3EF50402, 0x3EF60402, 0x3EF70402, 0x3EF80402, 0x3EF90402,
+    0x3EFA0402, 0x3EFB0402, 0x3EFC0402, 0x3EFD0402, 0x3EFE0402, 0x3EFF0402, 0x3F000402, 0x3F010402,
+    0x3F020402, 0x3F030402, 0x3F040402, 0x3F050402, 0x3F060402, 0x3F070402, 0x3F080402, 0x3F090402,
+    0x3F0A0402, 0x3F0B0402, 0x3F0C0402, 0x3F0D0402, 0x3F0E0402, 0x3F0F0402, 0x3F100402, 0x3F110402,
+    0x3F120402, 0x3F130402, 0x3F140402, 0x3F150402, 0x3F160402, 0x3F170402, 0x3F180402, 0x3F190402,
+    0x3F1A0402, 0x3F1B0402, 0x3F1C0402, 0x3F1D0402, 0x3F1E0402, 0x3F1F0402, 0x3F200402, 0x3F210402,
+    0x3F220402, 0x3F230402, 0x3F240402, 0x3F250402, 0x3F260402, 0x3F270402, 0x3F280402, 0x3F290402,
+    0x3F2A0402, 0x3F2B0402, 0x3F2C0402, 0x3F2D0402, 0x3F2E0402, 0x3F2F0402, 0x3F300402, 0x3F310402,
+    0x3F320402, 0x3F330402, 0x3F340402, 0x3F350402, 0x3F360402, 0x3F370402, 0x3F380402, 0x3F390402,
+    0x3F3A0402, 0x3F3B0402, 0x3F3C0402, 0x3F3D0402, 0x3F3E0402, 0x3F3F0402, 0x3F400402, 0x3F410402,
+    0x3F420402, 0x3F430402, 0x3F440402, 0x3F450402, 0x3F460402, 0x3F470402, 0x3F480402, 0x3F490402,
+    0x3F4A0402, 0x3F4B0402, 0x3F4C0402, 0x3F4D0402, 0x3F4E0402, 0x3F4F0402, 0x3F500402, 0x3F510402,
+    0x3F520402, 0x3F530402, 0x3F540402, 0x3F550402, 0x3F560402, 0x3F570402, 0x3F580402, 0x3F590402,
+    0x3F5A0402, 0x3F5B0402, 0x3F5C0402, 0x3F5D0402, 0x3F5E0402, 0x3F5F0402, 0x3F600402, 0x3F610402,
+    0x3F620402, 0x3F630402, 0x3F640402, 0x3F650402, 0x3F660402, 0x3F670402, 0x3F680402, 0x3F690402,
+    0x3F6A0402, 0x3F6B0402, 0x3F6C0402, 0x3F6D0402, 0x3F6E0402, 0x3F6F0402, 0x3F700402, 0x3F710402,
+    0x3F720402, 0x3F730402, 0x3F740402, 0x3F750402, 0x3F760402, 0x3F770402, 0x3F780402, 0x3F790402,
+    0x3F7A0402, 0x3F7B0402, 0x3F7C0402, 0x3F7D0402, 0x3F7E0402, 0x3F7F0402, 0x3F800402, 0x3F810402,
+    0x3F820402, 0x3F830402, 0x3F840402, 0x3F850402, 0x3F860402, 0x3F870402, 0x3F880402, 0x3F890402,
+    0x3F8A0402, 0x3F8B0402, 0x3F8C0402, 0x3F8D0402, 0x3F8E0402, 0x3F8F0402, 0x3F900402, 0x3F910402,
+    0x3F920402, 0x3F930402, 0x3F940402, 0x3F950402, 0x3F960402, 0x3F970402, 0x3F980402, 0x3F990402,
+    0x3F9A0402, 0x3F9B0402, 0x3F9C0402, 0x3F9D0402, 0x3F9E0402, 0x3F9F0402, 0x3FA00402, 0x3FA10402,
+    0x3FA20402, 0x3FA30402, 0x3FA40402, 0x3FA50402, 0x3FA60402, 0x3FA70402, 0x3FA80402, 0x3FA90402,
+    0x3FAA0402, 0x3FAB0402, 0x3FAC0402, 0x3FAD0402, 0x3FAE0402, 0x3FAF0402, 0x3FB00402, 0x3FB10402,
+    0x3FB20402, 0x3FB30402, 0x3FB40402, 0x3FB50402, 0x3FB60402, 0x3FB70402, 0x3FB80402, 0x3FB90402,
+    0x3FBA0402, 0x3FBB0402, 0x3FBC0402, 0x3FBD0402, 0x3FBE0402, 0x3FBF0402, 0x3FC00402, 0x3FC10402,
+    0x3FC20402, 0x3FC30402, 0x3FC40402, 0x3FC50402, 0x3FC60402, 0x3FC70402, 0x3FC80402, 0x3FC90402,
+    0x3FCA0402, 0x3FCB0402, 0x3FCC0402, 0x3FCD0402, 0x3FCE0402, 0x3FCF0402, 0x3FD00402, 0x3FD10402,
+    0x3FD20402, 0x3FD30402, 0x3FD40402, 0x3FD50402, 0x3FD60402, 0x3FD70402, 0x3FD80402, 0x3FD90402,
+    0x3FDA0402, 0x3FDB0402, 0x3FDC0402, 0x3FDD0402, 0x3FDE0402, 0x3FDF0402, 0x3FE00402, 0x3FE10402,
+    0x3FE20402, 0x3FE30402, 0x3FE40402, 0x3FE50402, 0x3FE60402, 0x3FE70402, 0x3FE80402, 0x3FE90402,
+    0x3FEA0402, 0x3FEB0402, 0x3FEC0402, 0x3FED0402, 0x3FEE0402, 0x3FEF0402, 0x3FF00402, 0x3FF10402,
+    0x3FF20402, 0x3FF30402, 0x3FF40402, 0x3FF50402, 0x3FF60402, 0x3FF70402, 0x3FF80402, 0x3FF90402,
+    0x3FFA0402, 0x3FFB0402, 0x3FFC0402, 0x3FFD0402, 0x3FFE0402, 0x3FFF0402, 0x40000402, 0x40010402,
+    0x40020402, 0x40030402, 0x40040402, 0x40050402, 0x40060402, 0x40070402, 0x40080402, 0x40090402,
+    0x400A0402, 0x400B0402, 0x400C0402, 0x400D0402, 0x400E0402, 0x400F0402, 0x40100402, 0x40110402,
+    0x40120402, 0x40130402, 0x40140402, 0x40150402, 0x40160402, 0x40170402, 0x40180402, 0x40190402,
+    0x401A0402, 0x401B0402, 0x401C0402, 0x401D0402, 0x401E0402, 0x401F0402, 0x40200402, 0x40210402,
+    0x40220402, 0x40230402, 0x40240402, 0x40250402, 0x40260402, 0x40270402, 0x40280402, 0x40290402,
+    0x402A0402, 0x402B0402, 0x402C0402, 0x402D0402, 0x402E0402, 0x402F0402, 0x40300402, 0x40310402,
+    0x40320402, 0x40330402, 0x40340402, 0x40350402, 0x40360402, 0x40370402, 0x40380402, 0x40390402,
+    0x403A0402, 0x403B0402, 0x403C0402, 0x403D0402, 0x403E0402, 0x403F0402, 0x40400402, 0x40410402,
+    0x40420402, 0x40430402, 0x40440402, 0x40450402, 0x40460402, 0x40470402, 0x40480402, 0x40490402,
+    0x404A0402, 0x404B0402, 0x404C0402, 0x404D0402, 0x404E0402, 0x4CDD0402, 0x4CDE0402, 0x4CDF0402,
+    0x4CE00402, 0x4CE10402, 0x4CE20402, 0x4CE30402, 0x4CE40402, 0x4CE50402, 0x4CE60402, 0x4CE70402,
+    0x4CE80402, 0x4CE90402, 0x4CEA0402, 0x4CEB0402, 0x4CEC0402, 0x4CED0402, 0x4CEE0402, 0x4CEF0402,
+    0x4CF00402, 0x4CF10402, 0x4CF20402, 0x4CF30402, 0x4CF40402, 0x4CF50402, 0x4CF60402, 0x4CF70402,
+    0x4CF80402, 0x4CF90402, 0x4CFA0402, 0x4CFB0402, 0x02C90402, 0x02CA0402, 0x404F0402, 0x40500402,
+    0x40510402, 0x40520402, 0x40530402, 0x40540402, 0x40550402, 0x40560402, 0x40570402, 0x40580402,
+    0x40590402, 0x405A0402, 0x405B0402, 0x405C0402, 0x405D0402, 0x405E0402, 0x405F0402, 0x40600402,
+    0x40610402, 0x40620402, 0x40630402, 0x40640402, 0x40650402, 0x40660402, 0x40670402, 0x40680402,
+    0x40690402, 0x406A0402, 0x406B0402, 0x406C0402, 0x00001702, 0x00001722, 0x00001742, 0x00001762,
+    0x00001782, 0x028F0402, 0x4A080402, 0x4A090402, 0x4A0A0402, 0x4A0B0402, 0x4A0C0402, 0x4A0D0402,
+    0x4A0E0402, 0x4A0F0402, 0x4A100402, 0x4A110402, 0x4A120402, 0x4A130402, 0x4A140402, 0x4A150402,
+    0x4A160402, 0x4A170402, 0x4A180402, 0x4A190402, 0x4A1A0402, 0x4A1B0402, 0x4A1C0402, 0x4A1D0402,
+    0x4A1E0402, 0x4A1F0402, 0x4A200402, 0x4A210402, 0x4A220402, 0x4A230402, 0x4A240402, 0x4A250402,
+    0x4A260402, 0x4A270402, 0x4A280402, 0x4A290402, 0x4A2A0402, 0x4A2B0402, 0x4A2C0402, 0x4A2D0402,
+    0x4A2E0402, 0x4A2F0402, 0x4A300402, 0x4A310402, 0x4A320402, 0x4A330402, 0x4A340402, 0x4A350402,
+    0x4A360402, 0x4A370402, 0x00001EC2, 0x00001EE2, 0x00001F02, 0x00001F22, 0x00001F42, 0x00001F62,
+    0x00001F82, 0x04A70402, 0x04A80402, 0x04A90402, 0x04AA0402, 0x04AB0402, 0x111E0402, 0x111F0402,
+    0x11200402, 0x11210402, 0x4A380402, 0x4A390402, 0x1F530402, 0x1F540402, 0x04AC0402, 0x11220402,
+    0x1E810402, 0x1E820402, 0x1E830402, 0x1E840402, 0x1E850402, 0x1E860402, 0x1E870402, 0x4A3A0402,
+    0x4A3B0402, 0x4A3C0402, 0x4A3D0402, 0x4A3E0402, 0x4A3F0402, 0x4A400402, 0x4A410402, 0x4A420402,
+    0x4A430402, 0x4A440402, 0x4A450402, 0x4A460402, 0x4A470402, 0x4A480402, 0x4A490402, 0x4A4A0402,
+    0x4A4B0402, 0x4A4C0402, 0x4A4D0402, 0x4A4E0402, 0x4A4F0402, 0x4A500402, 0x4A510402, 0x4A520402,
+    0x4A530402, 0x4A540402, 0x4A550402, 0x4A560402, 0x4A570402, 0x4A580402, 0x4A590402, 0x4A5A0402,
+    0x4A5B0402, 0x4A5C0402, 0x4A5D0402, 0x4A5E0402, 0x4A5F0402, 0x4A600402, 0x4A610402, 0x41320408,
+    0x41330408, 0x41340408, 0x41350408, 0x41360408, 0x41370408, 0x41380408, 0x41390408, 0x413A0408,
+    0x413B0408, 0x413C0408, 0x413D0408, 0x413E0408, 0x413F0408, 0x41400408, 0x41410408, 0x41420408,
+    0x41430408, 0x41440408, 0x41450408, 0x41460408, 0x41470408, 0x41480408, 0x41490408, 0x414A0408,
+    0x414B0408, 0x414C0408, 0x414D0408, 0x414E0408, 0x414F0408, 0x41500408, 0x41510408, 0x41320402,
+    0x41330402, 0x41340402, 0x41350402, 0x41360402, 0x41370402, 0x41380402, 0x41390402, 0x413A0402,
+    0x413B0402, 0x413C0402, 0x413D0402, 0x413E0402, 0x413F0402, 0x41400402, 0x41410402, 0x41420402,
+    0x41430402, 0x41440402, 0x41450402, 0x41460402, 0x41470402, 0x41480402, 0x41490402, 0x414A0402,
+    0x414B0402, 0x414C0402, 0x414D0402, 0x414E0402, 0x414F0402, 0x41500402, 0x41510402, 0x1E880402,
+    0x1E890402, 0x1E8A0402, 0x1E8B0402, 0x1E8C0402, 0x1E8D0402, 0x1E8E0402, 0x1E8F0402, 0x1E900402,
+    0x1E910402, 0x1F990404, 0x00002304, 0x1F9A0404, 0x00002304, 0x1F9B0402, 0x00002302, 0x02350402,
+    0x02900402, 0x04AD0402, 0x04AE0402, 0x491D0402, 0x491E0402, 0x491F0402, 0x49200402, 0x49220402,
+    0x49230402, 0x49220404, 0x49240402, 0x49250402, 0x49260402, 0x49270402, 0x49280402, 0x49290402,
+    0x492A0402, 0x492C0402, 0x492D0402, 0x492F0402, 0x49300402, 0x49310402, 0x492F0404, 0x49320402,
+    0x49330402, 0x49340402, 0x49350402, 0x49360402, 0x49370402, 0x49380402, 0x49390402, 0x493A0402,
+    0x493B0402, 0x493C0402, 0x493D0402, 0x493E0402, 0x493F0402, 0x49400402, 0x49410402, 0x49420402,
+    0x49410404, 0x49430402, 0x49440402, 0x49450402, 0x49460402, 0x49470402, 0x49480402, 0x49490402,
+    0x494A0402, 0x494B0402, 0x494C0402, 0x494D0402, 0x494E0402, 0x494F0402, 0x49510402, 0x49530402,
+    0x49540402, 0x49550402, 0x49560402, 0x49570402, 0x49580402, 0x495A0402, 0x495B0402, 0x495C0402,
+    0x495D0402, 0x495E0402, 0x495D0404, 0x495F0402, 0x49600402, 0x49610402, 0x49620402, 0x49630402,
+    0x49210402, 0x49520402, 0x49500402, 0x492B0402, 0x49590402, 0x492E0402, 0x49680402, 0x49640402,
+    0x49650402, 0x49660402, 0x49670402, 0x49690402, 0x496A0402, 0x496B0402, 0x496C0402, 0x496D0402,
+    0x496F0402, 0x49700402, 0x49710402, 0x49720402, 0x49740402, 0x49750402, 0x49760402, 0x49770402,
+    0x49790402, 0x497A0402, 0x497B0402, 0x497C0402, 0x497D0402, 0x497F0402, 0x49800402, 0x49810402,
+    0x49820402, 0x49830402, 0x49840402, 0x49850402, 0x49860402, 0x49890402, 0x498A0402, 0x498B0402,
+    0x498C0402, 0x498D0402, 0x498F0402, 0x49900402, 0x49930402, 0x49940402, 0x49950402, 0x49960402,
+    0x49970402, 0x49980402, 0x49990402, 0x499A0402, 0x499B0402, 0x499C0402, 0x49870402, 0x498E0402,
+    0x496E0402, 0x49920402, 0x49730402, 0x49780402, 0x49910402, 0x497E0402, 0x49880402, 0x499D0402,
+    0x499E0402, 0x499F0402, 0x49A00402, 0x49A10402, 0x49A20402, 0x49A30402, 0x49A40402, 0x49A50402,
+    0x49A60402, 0x49A70402, 0x49A80402, 0x49A90402, 0x49AA0402, 0x49AB0402, 0x49AC0402, 0x49AD0402,
+    0x1F590402, 0x1F5A0402, 0x02390402, 0x1F5B0402, 0x000020E2, 0x00002102, 0x42DD0411, 0x43180402,
+    0x430B0402, 0x430C0402, 0x430D0402, 0x430E0402, 0x430F0402, 0x43100402, 0x43110402, 0x43120402,
+    0x43130402, 0x43140402, 0x43150402, 0x43160402, 0x43170402, 0x43190402, 0x431A0402, 0x431B0402,
+    0x431C0402, 0x431D0402, 0x431E0402, 0x431F0402, 0x43200402, 0x43210402, 0x43220402, 0x43230402,
+    0x43240402, 0x43250402, 0x43260402, 0x43270402, 0x43280402, 0x43290402, 0x432A0402, 0x432B0402,
+    0x432C0402, 0x432D0402, 0x432E0402, 0x432F0402, 0x43300402, 0x43310402, 0x43320402, 0x43330402,
+    0x43340402, 0x43350402, 0x43360402, 0x43370402, 0x43380402, 0x43390402, 0x433A0402, 0x433B0402,
+    0x433C0402, 0x433D0402, 0x433E0402, 0x433F0402, 0x43400402, 0x43410402, 0x43420402, 0x43430402,
+    0x43440402, 0x43450402, 0x43460402, 0x43470402, 0x43480402, 0x43490402, 0x434A0402, 0x434B0402,
+    0x434C0402, 0x434D0402, 0x434E0402, 0x434F0402, 0x43500402, 0x43510402, 0x43520402, 0x43530402,
+    0x43540402, 0x43550402, 0x43560402, 0x43570402, 0x43580402, 0x43590402, 0x435A0402, 0x435B0402,
+    0x435C0402, 0x435D0402, 0x435E0402, 0x435F0402, 0x43600402, 0x43610402, 0x43620402, 0x43630402,
+    0x43640402, 0x43650402, 0x43660402, 0x43670402, 0x43680402, 0x43690402, 0x436A0402, 0x436B0402,
+    0x436C0402, 0x436D0402, 0x436E0402, 0x436F0402, 0x43700402, 0x43710402, 0x43720402, 0x43730402,
+    0x43740402, 0x43750402, 0x43760402, 0x43770402, 0x43780402, 0x43790402, 0x437A0402, 0x437B0402,
+    0x437C0402, 0x437D0402, 0x437E0402, 0x437F0402, 0x43800402, 0x43810402, 0x43820402, 0x43830402,
+    0x43840402, 0x43850402, 0x43860402, 0x43870402, 0x43880402, 0x43890402, 0x438A0402, 0x438B0402,
+    0x438C0402, 0x438D0402, 0x438E0402, 0x438F0402, 0x43900402, 0x43910402, 0x43920402, 0x43930402,
+    0x43940402, 0x43950402, 0x43960402, 0x43970402, 0x43980402, 0x43990402, 0x439A0402, 0x439B0402,
+    0x439C0402, 0x439D0402, 0x439E0402, 0x439F0402, 0x43A00402, 0x43A10402, 0x43A20402, 0x43A30402,
+    0x43A40402, 0x43A50402, 0x43A60402, 0x43A70402, 0x43A80402, 0x43A90402, 0x43AA0402, 0x43AB0402,
+    0x43AC0402, 0x43AD0402, 0x43AE0402, 0x43AF0402, 0x43B00402, 0x43B10402, 0x43B20402, 0x43B30402,
+    0x43B40402, 0x43B50402, 0x43B60402, 0x43B70402, 0x43B80402, 0x43B90402, 0x43BA0402, 0x43BB0402,
+    0x43BC0402, 0x43BD0402, 0x43BE0402, 0x43BF0402, 0x43C00402, 0x43C10402, 0x43C20402, 0x43C30402,
+    0x43C40402, 0x43C50402, 0x43C60402, 0x43C70402, 0x43C80402, 0x43C90402, 0x43CA0402, 0x43CB0402,
+    0x43CC0402, 0x43CD0402, 0x43CE0402, 0x43CF0402, 0x43D00402, 0x43D10402, 0x43D20402, 0x43D30402,
+    0x43D40402, 0x43D50402, 0x43D60402, 0x43D70402, 0x43D80402, 0x43D90402, 0x43DA0402, 0x43DB0402,
+    0x43DC0402, 0x43DD0402, 0x43DE0402, 0x43DF0402, 0x43E00402, 0x43E10402, 0x43E20402, 0x43E30402,
+    0x43E40402, 0x43E50402, 0x43E60402, 0x43E70402, 0x43E80402, 0x43E90402, 0x43EA0402, 0x43EB0402,
+    0x43EC0402, 0x43ED0402, 0x43EE0402, 0x43EF0402, 0x43F00402, 0x43F10402, 0x43F20402, 0x43F30402,
+    0x43F40402, 0x43F50402, 0x43F60402, 0x43F70402, 0x43F80402, 0x43F90402, 0x43FA0402, 0x43FB0402,
+    0x43FC0402, 0x43FD0402, 0x43FE0402, 0x43FF0402, 0x44000402, 0x44010402, 0x44020402, 0x44030402,
+    0x44040402, 0x44050402, 0x44060402, 0x44070402, 0x44080402, 0x44090402, 0x440A0402, 0x440B0402,
+    0x440C0402, 0x440D0402, 0x440E0402, 0x440F0402, 0x44100402, 0x44110402, 0x44120402, 0x44130402,
+    0x44140402, 0x44150402, 0x44160402, 0x44170402, 0x44180402, 0x44190402, 0x441A0402, 0x441B0402,
+    0x441C0402, 0x441D0402, 0x441E0402, 0x441F0402, 0x44200402, 0x44210402, 0x44220402, 0x44230402,
+    0x44240402, 0x44250402, 0x44260402, 0x44270402, 0x44280402, 0x4307040D, 0x4308040D, 0x4309040D,
+    0x4307040F, 0x4308040F, 0x4309040F, 0x430A040F, 0x4BBF0402, 0x4BC00402, 0x4BC10402, 0x4BC20402,
+    0x4BC30402, 0x4BC40402, 0x4BC50402, 0x4BC60402, 0x4BC70402, 0x4BC80402, 0x4BC90402, 0x4BCA0402,
+    0x4BCB0402, 0x4BCC0402, 0x4BCD0402, 0x4BCE0402, 0x4BCF0402, 0x4BD00402, 0x4BD10402, 0x4BD20402,
+    0x4BD30402, 0x4BD40402, 0x4BD50402, 0x4BD60402, 0x4BD70402, 0x4BD80402, 0x4BD90402, 0x4BDA0402,
+    0x4BDB0402, 0x4BDC0402, 0x4BDD0402, 0x4BDE0402, 0x4BDF0402, 0x4BE00402, 0x4BE10402, 0x4BE20402,
+    0x4BE30402, 0x4BE40402, 0x4BE50402, 0x4BE60402, 0x4BE70402, 0x4BE80402, 0x4BE90402, 0x4BEA0402,
+    0x4BEB0402, 0x4BEC0402, 0x4BED0402, 0x4BEE0402, 0x4BEF0402, 0x4BF00402, 0x4BF10402, 0x4BF20402,
+    0x4BF30402, 0x4BF40402, 0x4BF50402, 0x4BF60402, 0x4BF70402, 0x4BF80402, 0x4BF90402, 0x4BFA0402,
+    0x4BFB0402, 0x4BFC0402, 0x4BFD0402, 0x4BFE0402, 0x4BFF0402, 0x4C000402, 0x4C010402, 0x4C020402,
+    0x4C030402, 0x4C040402, 0x4C050402, 0x4C060402, 0x4C070402, 0x4C080402, 0x4C090402, 0x4C0A0402,
+    0x4C0B0402, 0x4C0C0402, 0x4C0D0402, 0x4C0E0402, 0x4C0F0402, 0x4C100402, 0x4C110402, 0x4C120402,
+    0x4C130402, 0x4C140402, 0x4C150402, 0x4C160402, 0x4C170402, 0x4C180402, 0x4C190402, 0x4C1A0402,
+    0x4C1B0402, 0x4C1C0402, 0x4C1D0402, 0x4C1E0402, 0x4C1F0402, 0x4C200402, 0x4C210402, 0x4C220402,
+    0x4C230402, 0x4C240402, 0x4C250402, 0x4C260402, 0x4C270402, 0x4C280402, 0x4C290402, 0x4C2A0402,
+    0x4C2B0402, 0x4C2C0402, 0x4C2D0402, 0x4C2E0402, 0x4C2F0402, 0x4C300402, 0x4C310402, 0x4C320402,
+    0x4C330402, 0x4C340402, 0x4C350402, 0x4C360402, 0x4C370402, 0x4C380402, 0x4C390402, 0x4C3A0402,
+    0x4C3B0402, 0x4C3C0402, 0x4C3D0402, 0x4C3E0402, 0x4C3F0402, 0x4C400402, 0x4C410402, 0x4C420402,
+    0x4C430402, 0x4C440402, 0x4C450402, 0x4C460402, 0x4C470402, 0x4C480402, 0x4C490402, 0x13140402,
+    0x02910402, 0x11240402, 0x11250402, 0x11260402, 0x11270402, 0x11280402, 0x11290402, 0x112A0402,
+    0x112B0402, 0x112C0402, 0x112D0402, 0x112E0402, 0x112F0402, 0x11300402, 0x11310402, 0x11320402,
+    0x11330402, 0x11340402, 0x11350402, 0x11360402, 0x11370402, 0x11380402, 0x11390402, 0x113A0402,
+    0x113B0402, 0x113C0402, 0x113D0402, 0x113E0402, 0x113F0402, 0x11400402, 0x11410402, 0x11420402,
+    0x11430402, 0x11440402, 0x11450402, 0x11460402, 0x11470402, 0x11480402, 0x11490402, 0x114A0402,
+    0x114B0402, 0x114C0402, 0x114D0402, 0x114E0402, 0x114F0402, 0x11500402, 0x11510402, 0x11520402,
+    0x11530402, 0x11540402, 0x11550402, 0x11560402, 0x11570402, 0x11580402, 0x11590402, 0x115A0402,
+    0x115B0402, 0x115C0402, 0x115D0402, 0x115E0402, 0x115F0402, 0x11600402, 0x11610402, 0x11620402,
+    0x11630402, 0x11640402, 0x11650402, 0x11660402, 0x11670402, 0x11680402, 0x11690402, 0x116A0402,
+    0x116B0402, 0x116C0402, 0x116D0402, 0x116E0402, 0x116F0402, 0x11700402, 0x11710402, 0x11720402,
+    0x11730402, 0x11740402, 0x11750402, 0x11760402, 0x11770402, 0x11780402, 0x11790402, 0x117A0402,
+    0x117B0402, 0x117C0402, 0x117D0402, 0x117E0402, 0x117F0402, 0x11800402, 0x11810402, 0x11820402,
+    0x11830402, 0x11840402, 0x11850402, 0x11860402, 0x11870402, 0x11880402, 0x11890402, 0x118A0402,
+    0x118B0402, 0x118C0402, 0x118D0402, 0x118E0402, 0x118F0402, 0x11900402, 0x11910402, 0x11920402,
+    0x11930402, 0x11940402, 0x11950402, 0x11960402, 0x11970402, 0x11980402, 0x11990402, 0x119A0402,
+    0x119B0402, 0x119C0402, 0x119D0402, 0x119E0402, 0x119F0402, 0x11A00402, 0x11A10402, 0x11A20402,
+    0x11A30402, 0x11A40402, 0x11A50402, 0x11A60402, 0x11A70402, 0x11A80402, 0x11A90402, 0x11AA0402,
+    0x11AB0402, 0x11AC0402, 0x11AD0402, 0x11AE0402, 0x11AF0402, 0x11B00402, 0x11B10402, 0x11B20402,
+    0x11B30402, 0x11B40402, 0x11B50402, 0x11B60402, 0x11B70402, 0x11B80402, 0x11B90402, 0x11BA0402,
+    0x11BB0402, 0x11BC0402, 0x11BD0402, 0x11BE0402, 0x11BF0402, 0x11C00402, 0x11C10402, 0x11C20402,
+    0x11C30402, 0x11C40402, 0x11C50402, 0x11C60402, 0x11C70402, 0x11C80402, 0x11C90402, 0x11CA0402,
+    0x11CB0402, 0x11CC0402, 0x11CD0402, 0x11CE0402, 0x11CF0402, 0x11D00402, 0x11D10402, 0x11D20402,
+    0x11D30402, 0x11D40402, 0x11D50402, 0x11D60402, 0x11D70402, 0x11D80402, 0x11D90402, 0x11DA0402,
+    0x11DB0402, 0x11DC0402, 0x11DD0402, 0x11DE0402, 0x11DF0402, 0x11E00402, 0x11E10402, 0x11E20402,
+    0x11E30402, 0x11E40402, 0x11E50402, 0x11E60402, 0x11E70402, 0x11E80402, 0x11E90402, 0x11EA0402,
+    0x11EB0402, 0x11EC0402, 0x11ED0402, 0x11EE0402, 0x11EF0402, 0x11F00402, 0x11F10402, 0x11F20402,
+    0x11F30402, 0x11F40402, 0x11F50402, 0x11F60402, 0x11F70402, 0x11F80402, 0x11F90402, 0x11FA0402,
+    0x11FB0402, 0x11FC0402, 0x11FD0402, 0x11FE0402, 0x11FF0402, 0x12000402, 0x12010402, 0x12020402,
+    0x12030402, 0x12040402, 0x12050402, 0x12060402, 0x12070402, 0x12080402, 0x12090402, 0x120A0402,
+    0x120B0402, 0x120C0402, 0x120D0402, 0x120E0402, 0x120F0402, 0x12100402, 0x12110402, 0x12120402,
+    0x12130402, 0x12140402, 0x12150402, 0x12160402, 0x12170402, 0x12180402, 0x12190402, 0x121A0402,
+    0x121B0402, 0x121C0402, 0x121D0402, 0x121E0402, 0x121F0402, 0x12200402, 0x12210402, 0x12220402,
+    0x12230402, 0x12240402, 0x12250402, 0x12260402, 0x12270402, 0x12280402, 0x12290402, 0x122A0402,
+    0x122B0402, 0x122C0402, 0x122D0402, 0x122E0402, 0x122F0402, 0x12300402, 0x12310402, 0x12320402,
+    0x12330402, 0x12340402, 0x12350402, 0x12360402, 0x12370402, 0x12380402, 0x12390402, 0x123A0402,
+    0x123B0402, 0x123C0402, 0x123D0402, 0x123E0402, 0x123F0402, 0x12400402, 0x12540402, 0x12440402,
+    0x12450402, 0x12460402, 0x12470402, 0x12480402, 0x12490402, 0x124A0402, 0x124B0402, 0x124C0402,
+    0x124D0402, 0x124E0402, 0x124F0402, 0x12500402, 0x12510402, 0x12520402, 0x12530402, 0x12550402,
+    0x12560402, 0x12570402, 0x12580402, 0x12590402, 0x125A0402, 0x125B0402, 0x125C0402, 0x125D0402,
+    0x125E0402, 0x125F0402, 0x12600402, 0x12610402, 0x12620402, 0x12630402, 0x12640402, 0x12650402,
+    0x12660402, 0x12670402, 0x12680402, 0x12690402, 0x126A0402, 0x126B0402, 0x126C0402, 0x126D0402,
+    0x126E0402, 0x126F0402, 0x12700402, 0x12710402, 0x12720402, 0x12730402, 0x12740402, 0x12750402,
+    0x12760402, 0x12770402, 0x12780402, 0x12720402, 0x00000000, 0x12730402, 0x00000000, 0x12730402,
+    0x00000000, 0x00000000, 0x12790402, 0x127A0402, 0x127B0402, 0x127C0402, 0x127D0402, 0x127E0402,
+    0x127F0402, 0x12800402, 0x12810402, 0x12820402, 0x12830402, 0x12840402, 0x12850402, 0x12860402,
+    0x12870402, 0x12880402, 0x12890402, 0x128A0402, 0x128B0402, 0x128C0402, 0x128D0402, 0x128E0402,
+    0x128F0402, 0x12900402, 0x12910402, 0x12920402, 0x12930402, 0x12940402, 0x12950402, 0x12960402,
+    0x12970402, 0x12980402, 0x12990402, 0x129A0402, 0x129B0402, 0x129C0402, 0x129D0402, 0x129E0402,
+    0x129F0402, 0x12A00402, 0x12A10402, 0x12A20402, 0x12A30402, 0x12A40402, 0x12A50402, 0x12A60402,
+    0x12A70402, 0x12A80402, 0x12A70402, 0x00000000, 0x12A80402, 0x00000000, 0x12A70402, 0x00000000,
+    0x00000000, 0x12A80402, 0x00000000, 0x00000000, 0x12A90402, 0x12AA0402, 0x12AB0402, 0x12AC0402,
+    0x12AD0402, 0x12AE0402, 0x12AF0402, 0x12B00402, 0x12B10402, 0x12B20402, 0x12B30402, 0x12B40402,
+    0x12B50402, 0x12B60402, 0x12B70402, 0x12B80402, 0x12B90402, 0x12BA0402, 0x12BB0402, 0x12BC0402,
+    0x12BD0402, 0x12BE0402, 0x12BF0402, 0x12C00402, 0x12C10402, 0x12C20402, 0x12C30402, 0x12C40402,
+    0x12C50402, 0x12C60402, 0x12C70402, 0x12C80402, 0x12C90402, 0x12CA0402, 0x12CB0402, 0x12CC0402,
+    0x12CD0402, 0x12CE0402, 0x12CF0402, 0x12D00402, 0x12D10402, 0x12D20402, 0x12D30402, 0x12D40402,
+    0x12D50402, 0x12D60402, 0x12D70402, 0x12D80402, 0x12D90402, 0x12DA0402, 0x12DB0402, 0x12DC0402,
+    0x12DD0402, 0x12DE0402, 0x12DF0402, 0x12E00402, 0x12E10402, 0x12E20402, 0x12E30402, 0x12E40402,
+    0x12E50402, 0x12E60402, 0x12E70402, 0x12E80402, 0x12E90402, 0x12EA0402, 0x12EB0402, 0x12EC0402,
+    0x12ED0402, 0x12EE0402, 0x12EF0402, 0x12F00402, 0x12F10402, 0x12F20402, 0x12F30402, 0x12F40402,
+    0x12F50402, 0x12F60402, 0x12F70402, 0x12F80402, 0x12F90402, 0x12FA0402, 0x12FB0402, 0x12FC0402,
+    0x12FD0402, 0x12FE0402, 0x12FF0402, 0x13000402, 0x13010402, 0x13020402, 0x13030402, 0x13040402,
+    0x13050402, 0x13060402, 0x13070402, 0x13080402, 0x13090402, 0x130A0402, 0x130B0402, 0x130C0402,
+    0x130D0402, 0x130E0402, 0x130F0402, 0x13100402, 0x13110402, 0x13120402, 0x13130402, 0x1E920402,
+    0x1E930402, 0x1E940402, 0x1E950402, 0x1E960402, 0x1E970402, 0x1E980402, 0x1E990402, 0x1E9A0402,
+    0x1E9B0402, 0x10360402, 0x10370402, 0x10380402, 0x10390402, 0x103A0402, 0x103B0402, 0x103C0402,
+    0x103D0402, 0x103E0402, 0x103F0402, 0x10400402, 0x10410402, 0x10420402, 0x10430402, 0x10440402,
+    0x10450402, 0x10460402, 0x10470402, 0x10480402, 0x10490402, 0x104A0402, 0x104B0402, 0x104C0402,
+    0x104D0402, 0x104E0402, 0x104F0402, 0x10500402, 0x10510402, 0x10520402, 0x10530402, 0x10540402,
+    0x10550402, 0x10560402, 0x10570402, 0x10580402, 0x10590402, 0x105A0402, 0x105B0402, 0x105C0402,
+    0x105D0402, 0x105E0402, 0x105F0402, 0x10600402, 0x10610402, 0x10620402, 0x10630402, 0x10640402,
+    0x10650402, 0x10660402, 0x10670402, 0x10680402, 0x10690402, 0x106A0402, 0x106B0402, 0x106C0402,
+    0x106D0402, 0x106E0402, 0x106F0402, 0x10700402, 0x10710402, 0x10720402, 0x10730402, 0x10740402,
+    0x10750402, 0x10760402, 0x10770402, 0x10780402, 0x10790402, 0x107A0402, 0x107B0402, 0x107C0402,
+    0x107D0402, 0x107E0402, 0x107F0402, 0x10800402, 0x10810402, 0x10820402, 0x10830402, 0x10840402,
+    0x10850402, 0x10860402, 0x10870402, 0x10880402, 0x10890402, 0x108A0402, 0x108B0402, 0x108C0402,
+    0x1F3D0402, 0x1F3E0402, 0x1F3F0402, 0x1F400402, 0x1F410402, 0x1F420402, 0x1F430402, 0x1F440402,
+    0x1F450402, 0x1FA2040B, 0x2051040B, 0x20AB040B, 0x20C4040B, 0x213C040B, 0x21D2040B, 0x21F7040B,
+    0x2217040B, 0x2247040B, 0x2259040B, 0x2264040B, 0x2270040B, 0x1FA20405, 0x1FBC0405, 0x1FD60405,
+    0x20420405, 0x20C40405, 0x21090405, 0x21180405, 0x216B0405, 0x21800405, 0x21930405, 0x21D20405,
+    0x21F70405, 0x22170405, 0x22470405, 0x22590405, 0x22640405, 0x22700405, 0x22860405, 0x20940405,
+    0x20AF0405, 0x231E040B, 0x231F040B, 0x2322040B, 0x2323040B, 0x2327040B, 0x2329040B, 0x232A040B,
+    0x232B040B, 0x232D040B, 0x232E040B, 0x2330040B, 0x2331040B, 0x2332040B, 0x2333040B, 0x2339040B,
+    0x233C040B, 0x2340040B, 0x2341040B, 0x2342040B, 0x2343040B, 0x2344040B, 0x2346040B, 0x065C0405,
+    0x231E0405, 0x231F0405, 0x23220405, 0x23230405, 0x23270405, 0x23290405, 0x232A0405, 0x232B0405,
+    0x232D0405, 0x232E0405, 0x23300405, 0x23310405, 0x23320405, 0x23330405, 0x23390405, 0x233C0405,
+    0x23400405, 0x23410405, 0x23420405, 0x23430405, 0x23440405, 0x23460405, 0x06580405, 0x2324040B,
+    0x23240405, 0x1F980405, 0x1F990405, 0x1F9A0405, 0x1F9B0405, 0x1F9C0405, 0x1F9D0405, 0x1F9E0405,
+    0x1F9F0405, 0x1FA00405, 0x1FA10405, 0x1AFF0402, 0x1B000402, 0x1B010402, 0x1B020402, 0x1B030402,
+    0x1B040402, 0x1B050402, 0x1B060402, 0x1B070402, 0x1B080402, 0x1B090402, 0x1B0A0402, 0x1B0B0402,
+    0x1B0C0402, 0x1B0D0402, 0x1B0E0402, 0x1B0F0402, 0x1B100402, 0x1B110402, 0x1B120402, 0x1B130402,
+    0x1B140402, 0x1B150402, 0x1B160402, 0x1B170402, 0x1B180402, 0x1B190402, 0x1B1A0402, 0x1B1B0402,
+    0x1B1C0402, 0x1B1D0402, 0x1B1E0402, 0x1B1F0402, 0x1B200402, 0x1B210402, 0x1B220402, 0x1B230402,
+    0x1B240402, 0x1B250402, 0x1B260402, 0x1B270402, 0x1B280402, 0x1B290402, 0x1B2A0402, 0x1B2B0402,
+    0x1B2C0402, 0x1B2D0402, 0x1B2E0402, 0x1B2F0402, 0x1B300402, 0x1B310402, 0x1B320402, 0x1B330402,
+    0x1B340402, 0x1B350402, 0x1B360402, 0x1B370402, 0x1B380402, 0x1B390402, 0x1B3A0402, 0x1B3B0402,
+    0x1B3C0402, 0x1B3D0402, 0x1B3E0402, 0x1B3F0402, 0x1B400402, 0x1B410402, 0x1B420402, 0x1B430402,
+    0x1B440402, 0x1B450402, 0x1B460402, 0x1B470402, 0x1B480402, 0x1B490402, 0x1B4A0402, 0x1B4B0402,
+    0x1B4C0402, 0x1B4D0402, 0x1B4E0402, 0x1B4F0402, 0x1B500402, 0x1B510402, 0x1B520402, 0x1B530402,
+    0x1B540402, 0x1B550402, 0x1B560402, 0x1B570402, 0x1B580402, 0x1B590402, 0x1B5A0402, 0x1B5B0402,
+    0x1B5C0402, 0x1B5D0402, 0x1B5E0402, 0x1B5F0402, 0x1B600402, 0x1B610402, 0x1B620402, 0x1B630402,
+    0x1B640402, 0x1B650402, 0x1B660402, 0x1B670402, 0x1B680402, 0x1B690402, 0x1B6A0402, 0x1B6B0402,
+    0x1B6C0402, 0x1B6D0402, 0x1B6E0402, 0x1B6F0402, 0x1B700402, 0x1B710402, 0x1B720402, 0x1B730402,
+    0x1B740402, 0x1B750402, 0x1B760402, 0x1B770402, 0x1B780402, 0x1B790402, 0x1B7A0402, 0x1B7B0402,
+    0x1B7C0402, 0x1B7D0402, 0x1B7E0402, 0x1B7F0402, 0x1B800402, 0x1B810402, 0x1B820402, 0x1B830402,
+    0x1B840402, 0x1B850402, 0x1B860402, 0x1B870402, 0x1B880402, 0x1B890402, 0x1B8A0402, 0x1B8B0402,
+    0x1B8C0402, 0x1B8D0402, 0x1B8E0402, 0x1B8F0402, 0x1B900402, 0x1B910402, 0x1B920402, 0x1B930402,
+    0x1B940402, 0x1B950402, 0x1B960402, 0x1B970402, 0x1B980402, 0x1B990402, 0x1B9A0402, 0x1B9B0402,
+    0x1B9C0402, 0x1B9D0402, 0x1B9E0402, 0x1B9F0402, 0x1BA00402, 0x1BA10402, 0x1BA20402, 0x1BA30402,
+    0x1BA40402, 0x1BA50402, 0x1BA60402, 0x1BA70402, 0x1BA80402, 0x1BA90402, 0x1BAA0402, 0x1BAB0402,
+    0x1BAC0402, 0x1BAD0402, 0x1BAE0402, 0x1BAF0402, 0x1BB00402, 0x1BB10402, 0x1BB20402, 0x1BB30402,
+    0x1BB40402, 0x1BB50402, 0x1BB60402, 0x1BB70402, 0x1BB80402, 0x1BB90402, 0x1BBA0402, 0x1BBB0402,
+    0x1BBC0402, 0x1BBD0402, 0x1BBE0402, 0x1BBF0402, 0x1BC00402, 0x1BC10402, 0x1BC20402, 0x1BC30402,
+    0x1BC40402, 0x1BC50402, 0x1BC60402, 0x1BC70402, 0x1BC80402, 0x1BC90402, 0x1BCA0402, 0x1BCB0402,
+    0x1BCC0402, 0x1BCD0402, 0x1BCE0402, 0x1BCF0402, 0x1BD00402, 0x1BD10402, 0x1BD20402, 0x1BD30402,
+    0x1BD40402, 0x1BD50402, 0x1BD60402, 0x1BD70402, 0x1BD80402, 0x1BD90402, 0x1BDA0402, 0x1BDB0402,
+    0x1BDC0402, 0x1BDD0402, 0x1BDE0402, 0x1BDF0402, 0x1BE00402, 0x1BE10402, 0x1BE20402, 0x1BE30402,
+    0x1BE40402, 0x1BE50402, 0x1BE60402, 0x1BE70402, 0x1BE80402, 0x1BE90402, 0x1BEA0402, 0x1BEB0402,
+    0x1BEC0402, 0x1BED0402, 0x1BEE0402, 0x1BEF0402, 0x1BF00402, 0x1BF10402, 0x1BF20402, 0x1BF30402,
+    0x1BF40402, 0x1BF50402, 0x1BF60402, 0x1BF70402, 0x1BF80402, 0x1BF90402, 0x1BFA0402, 0x1BFB0402,
+    0x1BFC0402, 0x1BFD0402, 0x1BFE0402, 0x1BFF0402, 0x1C000402, 0x1C010402, 0x1C020402, 0x1C030402,
+    0x1C040402, 0x1C050402, 0x1C060402, 0x1C070402, 0x1C080402, 0x1C090402, 0x1C0A0402, 0x1C0B0402,
+    0x1C0C0402, 0x1C0D0402, 0x1C0E0402, 0x1C0F0402, 0x1C100402, 0x1C110402, 0x1C120402, 0x1C130402,
+    0x1C140402, 0x1C150402, 0x1C160402, 0x1C170402, 0x1C180402, 0x1C190402, 0x1C1A0402, 0x1C1B0402,
+    0x1C1C0402, 0x1C1D0402, 0x1C1E0402, 0x1C1F0402, 0x1C200402, 0x1C210402, 0x1C220402, 0x1C230402,
+    0x1C240402, 0x1C250402, 0x1C260402, 0x1C270402, 0x1C280402, 0x1C290402, 0x1C2A0402, 0x1C2B0402,
+    0x1C2C0402, 0x1C2D0402, 0x1C2E0402, 0x1C2F0402, 0x1C300402, 0x1C310402, 0x1C320402, 0x1C330402,
+    0x1C340402, 0x1C350402, 0x1C360402, 0x1C370402, 0x1C380402, 0x1C390402, 0x1C3A0402, 0x1C3B0402,
+    0x1C3C0402, 0x1C3D0402, 0x1C3E0402, 0x1C3F0402, 0x1C400402, 0x1C410402, 0x1C420402, 0x1C430402,
+    0x1C440402, 0x1C450402, 0x1C460402, 0x1C470402, 0x1C480402, 0x1C490402, 0x1C4A0402, 0x1C4B0402,
+    0x1C4C0402, 0x1C4D0402, 0x1C4E0402, 0x1C4F0402, 0x1C500402, 0x1C510402, 0x1C520402, 0x1C530402,
+    0x1C540402, 0x1C550402, 0x1C560402, 0x1C570402, 0x1C580402, 0x1C590402, 0x1C5A0402, 0x1C5B0402,
+    0x1C5C0402, 0x1C5D0402, 0x1C5E0402, 0x1C5F0402, 0x1C600402, 0x1C610402, 0x1C620402, 0x1C630402,
+    0x1C640402, 0x1C650402, 0x1C660402, 0x1C670402, 0x1C680402, 0x1C690402, 0x1C6A0402, 0x1C6B0402,
+    0x1C6C0402, 0x1C6D0402, 0x1C6E0402, 0x1C6F0402, 0x1C700402, 0x1C710402, 0x1C720402, 0x1C730402,
+    0x1C740402, 0x1C750402, 0x1C760402, 0x1C770402, 0x1C780402, 0x1C790402, 0x1C7A0402, 0x1C7B0402,
+    0x1C7C0402, 0x1C7D0402, 0x1C7E0402, 0x1C7F0402, 0x1C800402, 0x1C810402, 0x1C820402, 0x1C830402,
+    0x1C840402, 0x1C850402, 0x1C860402, 0x1C870402, 0x1C880402, 0x1C890402, 0x1C8A0402, 0x1C8B0402,
+    0x1C8C0402, 0x1C8D0402, 0x1C8E0402, 0x1C8F0402, 0x1C900402, 0x1C910402, 0x1C920402, 0x1C930402,
+    0x1C940402, 0x1C950402, 0x1C960402, 0x1C970402, 0x1C980402, 0x1C990402, 0x1C9A0402, 0x1C9B0402,
+    0x1C9C0402, 0x1C9D0402, 0x1C9E0402, 0x1C9F0402, 0x1CA00402, 0x1CA10402, 0x1CA20402, 0x1CA30402,
+    0x1CA40402, 0x1CA50402, 0x1CA60402, 0x1CA70402, 0x1CA80402, 0x1CA90402, 0x1CAA0402, 0x1CAB0402,
+    0x1CAC0402, 0x1CAD0402, 0x1CAE0402, 0x1CAF0402, 0x1CB00402, 0x1CB10402, 0x1CB20402, 0x1CB30402,
+    0x1CB40402, 0x1CB50402, 0x1CB60402, 0x1CB70402, 0x1CB80402, 0x1CB90402, 0x1CBA0402, 0x1CBB0402,
+    0x1CBC0402, 0x1CBD0402, 0x1CBE0402, 0x1CBF0402, 0x1CC00402, 0x1CC10402, 0x1CC20402, 0x1CC30402,
+    0x1CC40402, 0x1CC50402, 0x1CC60402, 0x1CC70402, 0x1CC80402, 0x1CC90402, 0x1CCA0402, 0x1CCB0402,
+    0x1CCC0402, 0x1CCD0402, 0x1CCE0402, 0x1CCF0402, 0x1CD00402, 0x1CD10402, 0x1CD20402, 0x1CD30402,
+    0x1CD40402, 0x1CD50402, 0x1CD60402, 0x1CD70402, 0x1CD80402, 0x1CD90402, 0x1CDA0402, 0x1CDB0402,
+    0x1CDC0402, 0x1CDD0402, 0x1CDE0402, 0x1CDF0402, 0x1CE00402, 0x1CE10402, 0x1CE20402, 0x1CE30402,
+    0x1CE40402, 0x1CE50402, 0x1CE60402, 0x1CE70402, 0x1CE80402, 0x1CE90402, 0x1CEA0402, 0x1CEB0402,
+    0x1CEC0402, 0x1CED0402, 0x1CEE0402, 0x1CEF0402, 0x1CF00402, 0x1CF10402, 0x1CF20402, 0x1CF30402,
+    0x1CF40402, 0x1CF50402, 0x1CF60402, 0x1CF70402, 0x1CF80402, 0x1CF90402, 0x1CFA0402, 0x1CFB0402,
+    0x1CFC0402, 0x1CFD0402, 0x1CFE0402, 0x1CFF0402, 0x1D000402, 0x1D010402, 0x1D020402, 0x1D030402,
+    0x1D040402, 0x1D050402, 0x1D060402, 0x1D070402, 0x1D080402, 0x1D090402, 0x1D0A0402, 0x1D0B0402,
+    0x1D0C0402, 0x1D0D0402, 0x1D0E0402, 0x1D0F0402, 0x1D100402, 0x1D110402, 0x1D120402, 0x1D130402,
+    0x1D140402, 0x1D150402, 0x1D160402, 0x1D170402, 0x1D180402, 0x1D190402, 0x1D1A0402, 0x04AF0402,
+    0x04B00402, 0x04B10402, 0x04B20402, 0x04B30402, 0x254A0404, 0x254B0404, 0x254C0404, 0x254D0404,
+    0x254E0404, 0x254F0404, 0x25500404, 0x25520404, 0x25530404, 0x25540404, 0x25550404, 0x25560404,
+    0x25570404, 0x25580404, 0x25590404, 0x255A0404, 0x255B0404, 0x255C0404, 0x255D0404, 0x255E0404,
+    0x255F0404, 0x25600404, 0x25610404, 0x25620404, 0x25650404, 0x25660404, 0x25670404, 0x25680404,
+    0x25690404, 0x256A0404, 0x256B0404, 0x256D0404, 0x256E0404, 0x25700404, 0x25710404, 0x25720404,
+    0x25730404, 0x25740404, 0x4A620402, 0x4A630402, 0x4A640402, 0x4A650402, 0x4A660402, 0x4A670402,
+    0x4A680402, 0x4A690402, 0x4A6A0402, 0x4A6B0402, 0x4A6C0402, 0x4A6D0402, 0x4A6E0402, 0x4A6F0402,
+    0x4A700402, 0x4A710402, 0x4A720402, 0x4A730402, 0x4A740402, 0x4A750402, 0x4A760402, 0x4A770402,
+    0x4A780402, 0x4A790402, 0x4A7A0402, 0x4A7B0402, 0x4A7C0402, 0x4A7D0402, 0x4A7E0402, 0x4A7F0402,
+    0x4A800402, 0x4A810402, 0x4A820402, 0x4A830402, 0x4A840402, 0x4A850402, 0x4A860402, 0x4A870402,
+    0x4A880402, 0x4A890402, 0x4A8A0402, 0x4A8B0402, 0x4A8C0402, 0x4A8D0402, 0x4A8E0402, 0x4A8F0402,
+    0x4A900402, 0x4A910402, 0x4A920402, 0x4A930402, 0x1F550402, 0x1F560402, 0x4A940402, 0x11230402,
+    0x4A950402, 0x4A960402, 0x4A970402, 0x4A980402, 0x4A990402, 0x4A9A0402, 0x4A9B0402, 0x4A9C0402,
+    0x4A9D0402, 0x4A9E0402, 0x4A9F0402, 0x4AA00402, 0x4AA10402, 0x4AA20402, 0x4AA30402, 0x4AA40402,
+    0x4AA50402, 0x4AA60402, 0x4AA70402, 0x4AA80402, 0x4AA90402, 0x4AAA0402, 0x4AAB0402, 0x4AAC0402,
+    0x4AAD0402, 0x4AAE0402, 0x4AAF0402, 0x4AB00402, 0x4AB10402, 0x4AB20402, 0x4AB30402, 0x4AB40402,
+    0x4AB50402, 0x4AB60402, 0x4AB70402, 0x4AB80402, 0x4AB90402, 0x4ABA0402, 0x4ABB0402, 0x4ABC0402,
+    0x4ABD0402, 0x4ABE0402, 0x4ABF0402, 0x4AC00402, 0x00001FA2, 0x00001FC2, 0x00001FE2, 0x00002002,
+    0x1F770402, 0x406D0402, 0x406E0402, 0x406F0402, 0x40700402, 0x40710402, 0x40720402, 0x40730402,
+    0x40740402, 0x40750402, 0x40760402, 0x40770402, 0x40780402, 0x40790402, 0x407A0402, 0x407B0402,
+    0x407C0402, 0x407D0402, 0x407E0402, 0x407F0402, 0x40800402, 0x40810402, 0x40820402, 0x40830402,
+    0x40840402, 0x40850402, 0x40860402, 0x40870402, 0x40880402, 0x40890402, 0x408A0402, 0x408B0402,
+    0x408C0402, 0x408D0402, 0x408E0402, 0x408F0402, 0x40900402, 0x40910402, 0x40920402, 0x40930402,
+    0x40940402, 0x40950402, 0x40960402, 0x40970402, 0x40980402, 0x40990402, 0x409A0402, 0x409B0402,
+    0x409C0402, 0x409D0402, 0x409E0402, 0x409F0402, 0x40A00402, 0x40A10402, 0x40A20402, 0x40A30402,
+    0x40A40402, 0x40A50402, 0x40A60402, 0x40A70402, 0x40A80402, 0x40A90402, 0x40AA0402, 0x40AB0402,
+    0x40AC0402, 0x40AD0402, 0x40AE0402, 0x40AF0402, 0x40B00402, 0x40B10402, 0x40B20402, 0x40B30402,
+    0x40B40402, 0x40B50402, 0x40B60402, 0x40B70402, 0x40B80402, 0x40B90402, 0x40BA0402, 0x40BB0402,
+    0x40BC0402, 0x40BD0402, 0x40BE0402, 0x40BF0402, 0x40C00402, 0x40C10402, 0x40C20402, 0x40C30402,
+    0x40C40402, 0x40C50402, 0x40C60402, 0x40C70402, 0x40C80402, 0x40C90402, 0x40CA0402, 0x40CB0402,
+    0x40CC0402, 0x40CD0402, 0x40CE0402, 0x40CF0402, 0x40D00402, 0x40D10402, 0x40D20402, 0x40D30402,
+    0x40D40402, 0x40D50402, 0x40D60402, 0x40D70402, 0x40D80402, 0x40D90402, 0x40DA0402, 0x40DB0402,
+    0x40DC0402, 0x40DD0402, 0x40DE0402, 0x40DF0402, 0x40E00402, 0x40E10402, 0x40E20402, 0x40E30402,
+    0x40E40402, 0x40E50402, 0x40E60402, 0x40E70402, 0x40E80402, 0x40E90402, 0x40EA0402, 0x40EB0402,
+    0x40EC0402, 0x40ED0402, 0x40EE0402, 0x40EF0402, 0x40F00402, 0x40F10402, 0x40F20402, 0x40F30402,
+    0x40F40402, 0x40F50402, 0x40F60402, 0x40F70402, 0x40F80402, 0x40F90402, 0x40FA0402, 0x40FB0402,
+    0x40FC0402, 0x40FD0402, 0x40FE0402, 0x40FF0402, 0x41000402, 0x41010402, 0x41020402, 0x41030402,
+    0x41040402, 0x41050402, 0x41060402, 0x41070402, 0x41080402, 0x41090402, 0x410A0402, 0x410B0402,
+    0x410C0402, 0x410D0402, 0x410E0402, 0x410F0402, 0x41100402, 0x41110402, 0x41120402, 0x41130402,
+    0x41140402, 0x41150402, 0x41160402, 0x41170402, 0x41180402, 0x41190402, 0x411A0402, 0x411B0402,
+    0x411C0402, 0x411D0402, 0x411E0402, 0x411F0402, 0x41200402, 0x41210402, 0x41220402, 0x41230402,
+    0x41240402, 0x41250402, 0x41260402, 0x41270402, 0x41280402, 0x41290402, 0x412A0402, 0x412B0402,
+    0x412C0402, 0x412D0402, 0x412E0402, 0x412F0402, 0x41300402, 0x41310402, 0x41520408, 0x41530408,
+    0x41540408, 0x41550408, 0x41560408, 0x41570408, 0x41580408, 0x41590408, 0x415A0408, 0x415B0408,
+    0x415C0408, 0x415D0408, 0x415E0408, 0x415F0408, 0x41600408, 0x41610408, 0x41620408, 0x41630408,
+    0x41640408, 0x41650408, 0x41660408, 0x41670408, 0x41680408, 0x41690408, 0x416A0408, 0x416B0408,
+    0x416C0408, 0x416D0408, 0x416E0408, 0x416F0408, 0x41700408, 0x41710408, 0x41720408, 0x41730408,
+    0x41520402, 0x41530402, 0x41540402, 0x41550402, 0x41560402, 0x41570402, 0x41580402, 0x41590402,
+    0x415A0402, 0x415B0402, 0x415C0402, 0x415D0402, 0x415E0402, 0x415F0402, 0x41600402, 0x41610402,
+    0x41620402, 0x41630402, 0x41640402, 0x41650402, 0x41660402, 0x41670402, 0x41680402, 0x41690402,
+    0x416A0402, 0x416B0402, 0x416C0402, 0x416D0402, 0x416E0402, 0x416F0402, 0x41700402, 0x41710402,
+    0x41720402, 0x41730402, 0x000017A2, 0x000017E2, 0x00001802, 0x00001822, 0x000017C2, 0x41740402,
+    0x026C0402, 0x027B0402, 0x1E9C0402, 0x1E9D0402, 0x1E9E0402, 0x1E9F0402, 0x1EA00402, 0x1EA10402,
+    0x1EA20402, 0x1EA30402, 0x1EA40402, 0x1EA50402, 0x1EA60402, 0x1EA70402, 0x1EA80402, 0x1EA90402,
+    0x1EAA0402, 0x1EAB0402, 0x1EAC0402, 0x1EAD0402, 0x1EAE0402, 0x1EAF0402, 0x1EB00402, 0x1EB10402,
+    0x1EB20402, 0x1EB30402, 0x1EB40402, 0x1EB50402, 0x1EB60402, 0x1EB70402, 0x1EB80402, 0x1EB90402,
+    0x1EBA0402, 0x1EBB0402, 0x1EBC0402, 0x1EBD0402, 0x1EBE0402, 0x1EBF0402, 0x1EC00402, 0x1EC10402,
+    0x1EC20402, 0x1EC30402, 0x1EC40402, 0x13150402, 0x1EC50402, 0x1EC60402, 0x1EC70402, 0x1F910402,
+    0x1EC80402, 0x1EC90402, 0x1ECA0402, 0x1ECB0402, 0x1ECC0402, 0x1ECD0402, 0x1ECE0402, 0x1ECF0402,
+    0x1ED00402, 0x1ED10402, 0x1ED20402, 0x1ED30402, 0x1ED40402, 0x1ED50402, 0x1ED60402, 0x1ED70402,
+    0x1ED80402, 0x1ED90402, 0x1EDA0402, 0x1EDB0402, 0x1EDC0402, 0x1EDD0402, 0x1EDE0402, 0x1EDF0402,
+    0x1EE00402, 0x1EE10402, 0x1EE20402, 0x1EE30402, 0x1EE40402, 0x1EE50402, 0x1EE60402, 0x1EE70402,
+    0x1EE80402, 0x1EE90402, 0x1EEA0402, 0x1EEB0402, 0x1EEC0402, 0x1EED0402, 0x13160402, 0x1F9B0404,
+    0x00002304, 0x1F9C0404, 0x00002304, 0x1F9D0404, 0x00002304, 0x1F9E0404, 0x00002304, 0x1F9F0404,
+    0x00002304, 0x1FA00404, 0x00002304, 0x1FA10404, 0x00002304, 0x1EEE0402, 0x1EEF0402, 0x1EF00402,
+    0x1EF10402, 0x1EF20402, 0x1EF30402, 0x1EF40402, 0x26720405, 0x26740405, 0x268F0405, 0x26A40405,
+    0x27280405, 0x26B40405, 0x26990405, 0x26D70405, 0x27370405, 0x26F60405, 0x270C0405, 0x27140405,
+    0x27180405, 0x26C60405, 0x26DB0405, 0x26E40405, 0x26D10405, 0x26F00405, 0x26B30405, 0x26C70405,
+    0x26850405, 0x26860405, 0x269A0405, 0x26A50405, 0x26D20405, 0x26D80405, 0x26DC0405, 0x26730405,
+    0x27190405, 0x26E50405, 0x26EF0405, 0x27220405, 0x052F0402, 0x05300402, 0x13170402, 0x13180402,
+    0x13190402, 0x131A0402, 0x131B0402, 0x131C0402, 0x131D0402, 0x131E0402, 0x131F0402, 0x13200402,
+    0x13210402, 0x13220402, 0x13230402, 0x13240402, 0x13250402, 0x13260402, 0x13270402, 0x13280402,
+    0x13290402, 0x132A0402, 0x132B0402, 0x132C0402, 0x132D0402, 0x132E0402, 0x132F0402, 0x13300402,
+    0x13310402, 0x13320402, 0x13330402, 0x13340402, 0x13350402, 0x13360402, 0x13370402, 0x13380402,
+    0x13390402, 0x133A0402, 0x133B0402, 0x133C0402, 0x133D0402, 0x133E0402, 0x133F0402, 0x13400402,
+    0x13410402, 0x13420402, 0x13430402, 0x13440402, 0x13450402, 0x13460402, 0x13470402, 0x13480402,
+    0x13490402, 0x134A0402, 0x134B0402, 0x134C0402, 0x134D0402, 0x134E0402, 0x134F0402, 0x13500402,
+    0x13510402, 0x13520402, 0x13530402, 0x13540402, 0x13550402, 0x13560402, 0x13570402, 0x13580402,
+    0x13590402, 0x135A0402, 0x135B0402, 0x135C0402, 0x135D0402, 0x135E0402, 0x135F0402, 0x13600402,
+    0x13610402, 0x13620402, 0x13630402, 0x13640402, 0x13650402, 0x13660402, 0x13670402, 0x13680402,
+    0x13690402, 0x136A0402, 0x136B0402, 0x136C0402, 0x136D0402, 0x136E0402, 0x136F0402, 0x13700402,
+    0x13710402, 0x13720402, 0x13730402, 0x13740402, 0x13750402, 0x13760402, 0x13770402, 0x13780402,
+    0x13790402, 0x137A0402, 0x137B0402, 0x137C0402, 0x137D0402, 0x137E0402, 0x137F0402, 0x13800402,
+    0x13810402, 0x13820402, 0x13830402, 0x13840402, 0x13850402, 0x13860402, 0x13870402, 0x13880402,
+    0x13890402, 0x138A0402, 0x138B0402, 0x138C0402, 0x138D0402, 0x138E0402, 0x138F0402, 0x13900402,
+    0x13910402, 0x13920402, 0x13930402, 0x13940402, 0x13950402, 0x13960402, 0x13970402, 0x13980402,
+    0x13990402, 0x139A0402, 0x139B0402, 0x139C0402, 0x139D0402, 0x139E0402, 0x139F0402, 0x13A00402,
+    0x13A10402, 0x13A20402, 0x13A30402, 0x13A40402, 0x13A50402, 0x13A60402, 0x13A70402, 0x13A80402,
+    0x13A90402, 0x13AA0402, 0x13AB0402, 0x13AC0402, 0x13AD0402, 0x13AE0402, 0x13AF0402, 0x13B00402,
+    0x13B10402, 0x13B20402, 0x13B30402, 0x13B40402, 0x13B50402, 0x13B60402, 0x13B70402, 0x13B80402,
+    0x13B90402, 0x13BA0402, 0x13BB0402, 0x13BC0402, 0x13BD0402, 0x13BE0402, 0x13BF0402, 0x13C00402,
+    0x13C10402, 0x13C20402, 0x13C30402, 0x13C40402, 0x13C50402, 0x13C60402, 0x13C70402, 0x13C80402,
+    0x13C90402, 0x13CA0402, 0x13CB0402, 0x13CC0402, 0x13CD0402, 0x13CE0402, 0x13CF0402, 0x13D00402,
+    0x13D10402, 0x13D20402, 0x13D30402, 0x13D40402, 0x13D50402, 0x13D60402, 0x13D70402, 0x13D80402,
+    0x13D90402, 0x13DA0402, 0x13DB0402, 0x13DC0402, 0x13DD0402, 0x13DE0402, 0x13DF0402, 0x13E00402,
+    0x13E10402, 0x13E20402, 0x13E30402, 0x13E40402, 0x13E50402, 0x13E60402, 0x13E70402, 0x13E80402,
+    0x13E90402, 0x13EA0402, 0x13EB0402, 0x13EC0402, 0x13ED0402, 0x13EE0402, 0x13EF0402, 0x13F00402,
+    0x13F10402, 0x13F20402, 0x13F30402, 0x13F40402, 0x13F50402, 0x13F60402, 0x13F70402, 0x13F80402,
+    0x1F980404, 0x027E0404, 0x1F980404, 0x02230404, 0x1F990404, 0x02230404, 0x1F9A0404, 0x02230404,
+    0x1F9B0404, 0x02230404, 0x1F9C0404, 0x02230404, 0x1F9D0404, 0x02230404, 0x1F9E0404, 0x02230404,
+    0x1F9F0404, 0x02230404, 0x1FA00404, 0x02230404, 0x1FA10404, 0x02230404, 0x145B0402, 0x145C0402,
+    0x145D0402, 0x03280404, 0x1FA2040A, 0x03290404, 0x03280404, 0x1FBC040A, 0x03290404, 0x03280404,
+    0x1FD6040A, 0x03290404, 0x03280404, 0x1FEB040A, 0x03290404, 0x03280404, 0x2007040A, 0x03290404,
+    0x03280404, 0x2042040A, 0x03290404, 0x03280404, 0x2051040A, 0x03290404, 0x03280404, 0x2075040A,
+    0x03290404, 0x03280404, 0x2090040A, 0x03290404, 0x03280404, 0x20AB040A, 0x03290404, 0x03280404,
+    0x20C4040A, 0x03290404, 0x03280404, 0x20D6040A, 0x03290404, 0x03280404, 0x2109040A, 0x03290404,
+    0x03280404, 0x2118040A, 0x03290404, 0x03280404, 0x213C040A, 0x03290404, 0x03280404, 0x216B040A,
+    0x03290404, 0x03280404, 0x2180040A, 0x03290404, 0x03280404, 0x2193040A, 0x03290404, 0x03280404,
+    0x21D2040A, 0x03290404, 0x03280404, 0x21F7040A, 0x03290404, 0x03280404, 0x2217040A, 0x03290404,
+    0x03280404, 0x2247040A, 0x03290404, 0x03280404, 0x2259040A, 0x03290404, 0x03280404, 0x2264040A,
+    0x03290404, 0x03280404, 0x2270040A, 0x03290404, 0x03280404, 0x2286040A, 0x03290404, 0x038A0404,
+    0x21D2040A, 0x038B0404, 0x1FD6040C, 0x1FEB040C, 0x2259040C, 0x2286040C, 0x05D30402, 0x1FD6041D,
+    0x2042041D, 0x2180041D, 0x21D2041D, 0x2264041D, 0x2270041D, 0x2286041D, 0x2075041D, 0x2247041D,
+    0x21D2041D, 0x1FEB041D, 0x21D2041D, 0x21D2041D, 0x216B041D, 0x216B041D, 0x2247041D, 0x2259041D,
+    0x1FD6041D, 0x21090414, 0x1FD60414, 0x21090414, 0x1FEB0414, 0x21090414, 0x21930414, 0x145E0402,
+    0x145F0402, 0x14600402, 0x2090041D, 0x1FD6041D, 0x216B041D, 0x1FA2041D, 0x21D2041D, 0x1FA2041D,
+    0x1FA2041D, 0x1FBC041D, 0x1FEB041D, 0x20AB041D, 0x1FD6041D, 0x20D6041D, 0x1FD6041D, 0x213C041D,
+    0x213C041D, 0x20D6041D, 0x2042041D, 0x2193041D, 0x2007041D, 0x2007041D, 0x2090041D, 0x1FEB041D,
+    0x2118041D, 0x2007041D, 0x2259041D, 0x2118041D, 0x2051041D, 0x213C041D, 0x20C4041D, 0x21D2041D,
+    0x213C041D, 0x21D2041D, 0x2217041D, 0x216B041D, 0x0267041C, 0x2247041D, 0x21D2041D, 0x1F9B041C,
+    0x1FEB041D, 0x1F9A041C, 0x2118041C, 0x1FEB041C, 0x0209041C, 0x21D2041D, 0x1FD6041C, 0x2193041C,
+    0x1F9A041C, 0x20C4041D, 0x1F9C041C, 0x20C4041D, 0x1FA0041C, 0x20C4041D, 0x1F9D041C, 0x027E041C,
+    0x1F99041C, 0x1F9F041C, 0x027E041C, 0x1F99041C, 0x1F9A041C, 0x1F9A041C, 0x027E041C, 0x1F9A041C,
+    0x1F9E041C, 0x1F98041C, 0x216B041D, 0x1F99041C, 0x1F9A041C, 0x1F98041C, 0x216B041D, 0x1FEB041C,
+    0x2075041D, 0x1FD6041C, 0x2075041D, 0x1FEB041C, 0x2193041D, 0x2075041D, 0x2090041C, 0x0209041C,
+    0x2193041D, 0x2007041C, 0x21D2041C, 0x20D6041D, 0x213C041C, 0x21D2041C, 0x21D2041C, 0x20D6041C,
+    0x2007041C, 0x21D2041C, 0x21D2041C, 0x21D2041D, 0x2075041D, 0x2247041D, 0x2217041D, 0x2075041D,
+    0x1FEB041D, 0x2247041D, 0x213C041D, 0x1FEB041D, 0x05D50402, 0x0B220402, 0x0B230402, 0x0B240402,
+    0x0B250402, 0x0B260402, 0x0B270402, 0x0B280402, 0x0B290402, 0x0B2A0402, 0x0B2B0402, 0x0B2C0402,
+    0x0B2D0402, 0x0B2E0402, 0x0B2F0402, 0x0B300402, 0x0B310402, 0x0B320402, 0x0B330402, 0x0B340402,
+    0x0B350402, 0x0B360402, 0x0B370402, 0x0B380402, 0x0B390402, 0x0B3A0402, 0x0B3B0402, 0x42F8041C,
+    0x42E0041C, 0x42E4041C, 0x42E4041C, 0x42E5041C, 0xFB40041C, 0xE24B0000, 0xFB40041C, 0xDB570000,
+    0xFB40041C, 0xD3CC0000, 0x42ED041C, 0x000006FC, 0xFB40041C, 0xCE8C0000, 0xFB40041C, 0xD91A0000,
+    0xFB41041C, 0x89E30000, 0xFB40041C, 0xD9290000, 0xFB40041C, 0xCEA40000, 0xFB40041C, 0xE6200000,
+    0xFB40041C, 0xF1210000, 0xFB40041C, 0xE5990000, 0xFB40041C, 0xD24D0000, 0xFB40041C, 0xDF8C0000,
+    0xFB40041C, 0xD18D0000, 0xFB40041C, 0xE5B00000, 0xFB40041C, 0xD21D0000, 0xFB40041C, 0xFD420000,
+    0xFB40041C, 0xF51F0000, 0xFB41041C, 0x8CA90000, 0xFB40041C, 0xD8F00000, 0xFB40041C, 0xD4390000,
+    0xFB40041C, 0xEF140000, 0xFB40041C, 0xE2950000, 0xFB40041C, 0xE3550000, 0xFB40041C, 0xCE000000,
+    0xFB40041C, 0xCE090000, 0xFB41041C, 0x904A0000, 0xFB40041C, 0xDDE60000, 0xFB40041C, 0xCE2D0000,
+    0xFB40041C, 0xD3F30000, 0xFB40041C, 0xE3070000, 0xFB41041C, 0x8D700000, 0xFB40041C, 0xE2530000,
+    0xFB40041C, 0xF9810000, 0xFB40041C, 0xFA7A0000, 0xFB40041C, 0xD4080000, 0xFB40041C, 0xEE800000,
+    0xFB40041C, 0xE7090000, 0xFB40041C, 0xE7080000, 0xFB40041C, 0xF5330000, 0xFB40041C, 0xD2720000,
+    0xFB40041C, 0xD5B60000, 0xFB41041C, 0x914D0000, 0x038A0404, 0xFB400404, 0xE72C0000, 0x038B0404,
+    0x038A0404, 0xFB400404, 0xCE090000, 0x038B0404, 0x038A0404, 0xFB400404, 0xCE8C0000, 0x038B0404,
+    0x038A0404, 0xFB400404, 0xDB890000, 0x038B0404, 0x038A0404, 0xFB400404, 0xF0B90000, 0x038B0404,
+    0x038A0404, 0xFB400404, 0xE2530000, 0x038B0404, 0x038A0404, 0xFB400404, 0xF6D70000, 0x038B0404,
+    0x038A0404, 0xFB400404, 0xD2DD0000, 0x038B0404, 0x038A0404, 0xFB400404, 0xE5570000, 0x038B0404,
+    0xFB400406, 0xDF970000, 0xFB400406, 0xD3EF0000, 0x14610402, 0x14620402, 0x14630402, 0x14640402,
+    0x14650402, 0x14660402, 0x14670402, 0x14680402, 0x14690402, 0x146A0402, 0x146B0402, 0x146C0402,
+    0x146D0402, 0x146E0402, 0x146F0402, 0x14700402, 0x14710402, 0x14720402, 0x14730402, 0x14740402,
+    0x14750402, 0x14760402, 0x14770402, 0x14780402, 0x14790402, 0x147A0402, 0x147B0402, 0x147C0402,
+    0x147D0402, 0x147E0402, 0x147F0402, 0x14800402, 0x14810402, 0x14820402, 0x14830402, 0x14840402,
+    0x14850402, 0x14860402, 0x14870402, 0x14880402, 0x14890402, 0x148A0402, 0x148B0402, 0x148C0402,
+    0x148D0402, 0x148E0402, 0x148F0402, 0x14900402, 0x14910402, 0x14920402, 0x14930402, 0x14940402,
+    0x14950402, 0x14960402, 0x14970402, 0x14980402, 0x14990402, 0x149A0402, 0x149B0402, 0x149C0402,
+    0x149D0402, 0x149E0402, 0x149F0402, 0x14A00402, 0x14A10402, 0x14A20402, 0x14A30402, 0x14A40402,
+    0x14A50402, 0x14A60402, 0x14A70402, 0x14A80402, 0x14A90402, 0x14AA0402, 0x14AB0402, 0x14AC0402,
+    0x14AD0402, 0x14AE0402, 0x14AF0402, 0x14B00402, 0x14B10402, 0x14B20402, 0x14B30402, 0x14B40402,
+    0x14B50402, 0x14B60402, 0x14B70402, 0x14B80402, 0x14B90402, 0x14BA0402, 0x14BB0402, 0x14BC0402,
+    0x14BD0402, 0x14BE0402, 0x14BF0402, 0x14C00402, 0x14C10402, 0x14C20402, 0x14C30402, 0x14C40402,
+    0x14C50402, 0x14C60402, 0x14C70402, 0x14C80402, 0x14C90402, 0x14CA0402, 0x14CB0402, 0x14CC0402,
+    0x14CD0402, 0x14CE0402, 0x14CF0402, 0x14D00402, 0x14D10402, 0x14D20402, 0x14D30402, 0x14D40402,
+    0x14D50402, 0x14D60402, 0x14D70402, 0x14D80402, 0x14D90402, 0x14DA0402, 0x14DB0402, 0x14DC0402,
+    0x14DD0402, 0x14DE0402, 0x14DF0402, 0x14E00402, 0x14E10402, 0x14E20402, 0x14E30402, 0x14E40402,
+    0x14E50402, 0x14E60402, 0x14E70402, 0x14E80402, 0x14E90402, 0x14EA0402, 0x14EB0402, 0x14EC0402,
+    0x14ED0402, 0x14EE0402, 0x14EF0402, 0x14F00402, 0x14F10402, 0x14F20402, 0x14F30402, 0x14F40402,
+    0x14F50402, 0x14F60402, 0x14F70402, 0x14F80402, 0x14F90402, 0x14FA0402, 0x14FB0402, 0x14FC0402,
+    0x14FD0402, 0x14FE0402, 0x14FF0402, 0x15000402, 0x15010402, 0x15020402, 0x15030402, 0x15040402,
+    0x15050402, 0x15060402, 0x15070402, 0x15080402, 0x15090402, 0x150A0402, 0x150B0402, 0x150C0402,
+    0x150D0402, 0x150E0402, 0x150F0402, 0x15100402, 0x15110402, 0x15120402, 0x15130402, 0x15140402,
+    0x15150402, 0x15160402, 0x15170402, 0x15180402, 0x15190402, 0x151A0402, 0x151B0402, 0x151C0402,
+    0x151D0402, 0x151E0402, 0x151F0402, 0x15200402, 0x15210402, 0x15220402, 0x15230402, 0x15240402,
+    0x15250402, 0x15260402, 0x15270402, 0x15280402, 0x15290402, 0x152A0402, 0x152B0402, 0x152C0402,
+    0x152D0402, 0x152E0402, 0x152F0402, 0x15300402, 0x15310402, 0x15320402, 0x15330402, 0x15340402,
+    0x15350402, 0x15360402, 0x15370402, 0x15380402, 0x15390402, 0x153A0402, 0x153B0402, 0x153C0402,
+    0x153D0402, 0x153E0402, 0x153F0402, 0x15400402, 0x15410402, 0x15420402, 0x15430402, 0x15440402,
+    0x15450402, 0x15460402, 0x15470402, 0x15480402, 0x15490402, 0x154A0402, 0x154B0402, 0x154C0402,
+    0x154D0402, 0x154E0402, 0x154F0402, 0x15500402, 0x15510402, 0x15520402, 0x15530402, 0x15540402,
+    0x15550402, 0x15560402, 0x15570402, 0x15580402, 0x15590402, 0x155A0402, 0x155B0402, 0x155C0402,
+    0x155D0402, 0x155E0402, 0x155F0402, 0x15600402, 0x15610402, 0x15620402, 0x15630402, 0x15640402,
+    0x15650402, 0x15660402, 0x15670402, 0x15680402, 0x15690402, 0x156A0402, 0x156B0402, 0x156C0402,
+    0x156D0402, 0x156E0402, 0x156F0402, 0x15700402, 0x15710402, 0x15720402, 0x15730402, 0x15740402,
+    0x15750402, 0x15760402, 0x15770402, 0x15780402, 0x15790402, 0x157A0402, 0x157B0402, 0x157C0402,
+    0x157D0402, 0x157E0402, 0x157F0402, 0x15800402, 0x15810402, 0x15820402, 0x15830402, 0x15840402,
+    0x15850402, 0x15860402, 0x15870402, 0x15880402, 0x15890402, 0x158A0402, 0x158B0402, 0x158C0402,
+    0x158D0402, 0x158E0402, 0x158F0402, 0x15900402, 0x15910402, 0x15920402, 0x15930402, 0x15940402,
+    0x15950402, 0x15960402, 0x15970402, 0x15980402, 0x15990402, 0x159A0402, 0x159B0402, 0x159C0402,
+    0x159D0402, 0x159E0402, 0x159F0402, 0x15A00402, 0x15A10402, 0x15A20402, 0x15A30402, 0x15A40402,
+    0x15A50402, 0x15A60402, 0x15A70402, 0x15A80402, 0x15A90402, 0x15AA0402, 0x15AB0402, 0x15AC0402,
+    0x15AD0402, 0x15AE0402, 0x15AF0402, 0x15B00402, 0x15B10402, 0x15B20402, 0x15B30402, 0x15B40402,
+    0x15B50402, 0x15B60402, 0x15B70402, 0x15B80402, 0x15B90402, 0x15BA0402, 0x15BB0402, 0x15BC0402,
+    0x15BD0402, 0x15BE0402, 0x15BF0402, 0x15C00402, 0x15C10402, 0x15C20402, 0x15C30402, 0x15C40402,
+    0x15C50402, 0x15C60402, 0x15C70402, 0x15C80402, 0x15C90402, 0x15CA0402, 0x15CB0402, 0x15CC0402,
+    0x15CD0402, 0x15CE0402, 0x15CF0402, 0x15D00402, 0x15D10402, 0x15D20402, 0x15D30402, 0x15D40402,
+    0x15D50402, 0x15D60402, 0x15D70402, 0x15D80402, 0x15D90402, 0x15DA0402, 0x15DB0402, 0x15DC0402,
+    0x15DD0402, 0x15DE0402, 0x15DF0402, 0x15E00402, 0x15E10402, 0x15E20402, 0x15E30402, 0x15E40402,
+    0x15E50402, 0x15E60402, 0x15E70402, 0x15E80402, 0x15E90402, 0x15EA0402, 0x15EB0402, 0x15EC0402,
+    0x15ED0402, 0x15EE0402, 0x15EF0402, 0x15F00402, 0x15F10402, 0x15F20402, 0x15F30402, 0x15F40402,
+    0x15F50402, 0x15F60402, 0x15F70402, 0x15F80402, 0x15F90402, 0x15FA0402, 0x15FB0402, 0x15FC0402,
+    0x15FD0402, 0x15FE0402, 0x15FF0402, 0x16000402, 0x16010402, 0x16020402, 0x16030402, 0x16040402,
+    0x16050402, 0x16060402, 0x16070402, 0x16080402, 0x16090402, 0x160A0402, 0x160B0402, 0x160C0402,
+    0x160D0402, 0x160E0402, 0x160F0402, 0x16100402, 0x16110402, 0x16120402, 0x16130402, 0x16140402,
+    0x16150402, 0x16160402, 0x16170402, 0x16180402, 0x16190402, 0x161A0402, 0x161B0402, 0x161C0402,
+    0x161D0402, 0x161E0402, 0x161F0402, 0x16200402, 0x16210402, 0x16220402, 0x16230402, 0x16240402,
+    0x16250402, 0x16260402, 0x16270402, 0x16280402, 0x16290402, 0x162A0402, 0x162B0402, 0x162C0402,
+    0x162D0402, 0x162E0402, 0x162F0402, 0x16300402, 0x16310402, 0x16320402, 0x16330402, 0x16340402,
+    0x16350402, 0x16360402, 0x16370402, 0x16380402, 0x16390402, 0x163A0402, 0x163B0402, 0x163C0402,
+    0x163D0402, 0x163E0402, 0x163F0402, 0x16400402, 0x16410402, 0x16420402, 0x16430402, 0x16440402,
+    0x16450402, 0x16460402, 0x16470402, 0x16480402, 0x16490402, 0x164A0402, 0x164B0402, 0x164C0402,
+    0x164D0402, 0x164E0402, 0x164F0402, 0x16500402, 0x16510402, 0x16520402, 0x16530402, 0x16540402,
+    0x16550402, 0x16560402, 0x16570402, 0x16580402, 0x16590402, 0x165A0402, 0x165B0402, 0x165C0402,
+    0x165D0402, 0x165E0402, 0x165F0402, 0x16600402, 0x16610402, 0x16620402, 0x16630402, 0x16640402,
+    0x16650402, 0x16660402, 0x16670402, 0x16680402, 0x16690402, 0x166A0402, 0x166B0402, 0x166C0402,
+    0x166D0402, 0x166E0402, 0x166F0402, 0x16700402, 0x16710402, 0x16720402, 0x16730402, 0x16740402,
+    0x16750402, 0x16760402, 0x16770402, 0x16780402, 0x16790402, 0x167A0402, 0x167B0402, 0x167C0402,
+    0x167D0402, 0x167E0402, 0x167F0402, 0x16800402, 0x16810402, 0x16820402, 0x16830402, 0x16840402,
+    0x16850402, 0x16860402, 0x16870402, 0x16880402, 0x16890402, 0x168A0402, 0x168B0402, 0x168C0402,
+    0x168D0402, 0x168E0402, 0x168F0402, 0x16900402, 0x16910402, 0x16920402, 0x16930402, 0x16940402,
+    0x16950402, 0x16960402, 0x16970402, 0x16980402, 0x16990402, 0x169A0402, 0x169B0402, 0x169C0402,
+    0x169D0402, 0x169E0402, 0x169F0402, 0x16A00402, 0x16A10402, 0x16A20402, 0x16A30402, 0x16A40402,
+    0x16A50402, 0x16A60402, 0x16A70402, 0x16A80402, 0x16A90402, 0x16AA0402, 0x16AB0402, 0x16AC0402,
+    0x16AD0402, 0x16AE0402, 0x16AF0402, 0x16B00402, 0x16B10402, 0x16B20402, 0x16B30402, 0x16B40402,
+    0x16B50402, 0x16B60402, 0x16B70402, 0x16B80402, 0x16B90402, 0x16BA0402, 0x16BB0402, 0x16BC0402,
+    0x16BD0402, 0x16BE0402, 0x16BF0402, 0x16C00402, 0x16C10402, 0x16C20402, 0x16C30402, 0x16C40402,
+    0x16C50402, 0x16C60402, 0x16C70402, 0x16C80402, 0x16C90402, 0x16CA0402, 0x16CB0402, 0x16CC0402,
+    0x16CD0402, 0x16CE0402, 0x16CF0402, 0x16D00402, 0x16D10402, 0x16D20402, 0x16D30402, 0x16D40402,
+    0x16D50402, 0x16D60402, 0x16D70402, 0x16D80402, 0x16D90402, 0x16DA0402, 0x16DB0402, 0x16DC0402,
+    0x16DD0402, 0x16DE0402, 0x16DF0402, 0x16E00402, 0x16E10402, 0x16E20402, 0x16E30402, 0x16E40402,
+    0x16E50402, 0x16E60402, 0x16E70402, 0x16E80402, 0x16E90402, 0x16EA0402, 0x16EB0402, 0x16EC0402,
+    0x16ED0402, 0x16EE0402, 0x16EF0402, 0x16F00402, 0x16F10402, 0x16F20402, 0x16F30402, 0x16F40402,
+    0x16F50402, 0x16F60402, 0x16F70402, 0x16F80402, 0x16F90402, 0x16FA0402, 0x16FB0402, 0x16FC0402,
+    0x16FD0402, 0x16FE0402, 0x16FF0402, 0x17000402, 0x17010402, 0x17020402, 0x17030402, 0x17040402,
+    0x17050402, 0x17060402, 0x17070402, 0x17080402, 0x17090402, 0x170A0402, 0x170B0402, 0x170C0402,
+    0x170D0402, 0x170E0402, 0x170F0402, 0x17100402, 0x17110402, 0x17120402, 0x17130402, 0x17140402,
+    0x17150402, 0x17160402, 0x17170402, 0x17180402, 0x17190402, 0x171A0402, 0x171B0402, 0x171C0402,
+    0x171D0402, 0x171E0402, 0x171F0402, 0x17200402, 0x17210402, 0x17220402, 0x17230402, 0x17240402,
+    0x17250402, 0x17260402, 0x17270402, 0x17280402, 0x17290402, 0x172A0402, 0x172B0402, 0x172C0402,
+    0x172D0402, 0x172E0402, 0x172F0402, 0x17300402, 0x17310402, 0x17320402, 0x17330402, 0x17340402,
+    0x17350402, 0x17360402, 0x17370402, 0x17380402, 0x17390402, 0x173A0402, 0x173B0402, 0x173C0402,
+    0x173D0402, 0x173E0402, 0x173F0402, 0x17400402, 0x17410402, 0x17420402, 0x17430402, 0x17440402,
+    0x17450402, 0x17460402, 0x17470402, 0x17480402, 0x17490402, 0x174A0402, 0x174B0402, 0x174C0402,
+    0x174D0402, 0x174E0402, 0x174F0402, 0x17500402, 0x17510402, 0x17520402, 0x17530402, 0x17540402,
+    0x17550402, 0x17560402, 0x17570402, 0x17580402, 0x17590402, 0x175A0402, 0x175B0402, 0x175C0402,
+    0x175D0402, 0x175E0402, 0x175F0402, 0x17600402, 0x17610402, 0x17620402, 0x17630402, 0x17640402,
+    0x17650402, 0x17660402, 0x189E0402, 0x189F0402, 0x18A00402, 0x18A10402, 0x18A20402, 0x18A30402,
+    0x18A40402, 0x18A50402, 0x18A60402, 0x18A70402, 0x18A80402, 0x18A90402, 0x18AA0402, 0x18AB0402,
+    0x18AC0402, 0x18AD0402, 0x18AE0402, 0x18AF0402, 0x18B00402, 0x18B10402, 0x18B20402, 0x18B30402,
+    0x18B40402, 0x18B50402, 0x18B60402, 0x18B70402, 0x18B80402, 0x18B90402, 0x18BA0402, 0x18BB0402,
+    0x18BC0402, 0x18BD0402, 0x18BE0402, 0x18BF0402, 0x18C00402, 0x18C10402, 0x18C20402, 0x18C30402,
+    0x18C40402, 0x18C50402, 0x18C60402, 0x18C70402, 0x18C80402, 0x18C90402, 0x18CA0402, 0x18CB0402,
+    0x18CC0402, 0x18CD0402, 0x18CE0402, 0x18CF0402, 0x18D00402, 0x18D10402, 0x18D20402, 0x18D30402,
+    0x18D40402, 0x18D50402, 0x18D60402, 0x18D70402, 0x18D80402, 0x18D90402, 0x18DA0402, 0x18DB0402,
+    0x18DC0402, 0x18DD0402, 0x18DE0402, 0x18DF0402, 0x18E00402, 0x18E10402, 0x18E20402, 0x18E30402,
+    0x18E40402, 0x18E50402, 0x18E60402, 0x18E70402, 0x18E80402, 0x18E90402, 0x18EA0402, 0x18EB0402,
+    0x18EC0402, 0x18ED0402, 0x18EE0402, 0x18EF0402, 0x18F00402, 0x18F10402, 0x18F20402, 0x18F30402,
+    0x18F40402, 0x18F50402, 0x18F60402, 0x18F70402, 0x18F80402, 0x18F90402, 0x18FA0402, 0x18FB0402,
+    0x18FC0402, 0x18FD0402, 0x18FE0402, 0x18FF0402, 0x19000402, 0x19010402, 0x19020402, 0x19030402,
+    0x19040402, 0x19050402, 0x19060402, 0x19070402, 0x19080402, 0x19090402, 0x190A0402, 0x190B0402,
+    0x190C0402, 0x190D0402, 0x190E0402, 0x190F0402, 0x19100402, 0x19110402, 0x19120402, 0x19130402,
+    0x19140402, 0x19150402, 0x19160402, 0x19170402, 0x19180402, 0x19190402, 0x191A0402, 0x191B0402,
+    0x191C0402, 0x191D0402, 0x191E0402, 0x191F0402, 0x19200402, 0x19210402, 0x19220402, 0x19230402,
+    0x19240402, 0x19250402, 0x19260402, 0x19270402, 0x19280402, 0x19290402, 0x192A0402, 0x192B0402,
+    0x192C0402, 0x192D0402, 0x192E0402, 0x192F0402, 0x19300402, 0x19310402, 0x19320402, 0x19330402,
+    0x19340402, 0x19350402, 0x19360402, 0x19370402, 0x19380402, 0x19390402, 0x193A0402, 0x193B0402,
+    0x193C0402, 0x193D0402, 0x193E0402, 0x193F0402, 0x19400402, 0x19410402, 0x19420402, 0x19430402,
+    0x19440402, 0x19450402, 0x19460402, 0x19470402, 0x19480402, 0x19490402, 0x194A0402, 0x194B0402,
+    0x194C0402, 0x194D0402, 0x194E0402, 0x194F0402, 0x19500402, 0x19510402, 0x19520402, 0x19530402,
+    0x19540402, 0x19550402, 0x19560402, 0x19570402, 0x19580402, 0x19590402, 0x195A0402, 0x195B0402,
+    0x195C0402, 0x195D0402, 0x195E0402, 0x195F0402, 0x19600402, 0x19610402, 0x19620402, 0x19630402,
+    0x19640402, 0x19650402, 0x19660402, 0x19670402, 0x19680402, 0x19690402, 0x196A0402, 0x196B0402,
+    0x196C0402, 0x196D0402, 0x196E0402, 0x196F0402, 0x19700402, 0x19710402, 0x19720402, 0x19730402,
+    0x19740402, 0x19750402, 0x19760402, 0x19770402, 0x19780402, 0x19790402, 0x197A0402, 0x197B0402,
+    0x197C0402, 0x197D0402, 0x197E0402, 0x197F0402, 0x19800402, 0x19810402, 0x19820402, 0x19830402,
+    0x19840402, 0x19850402, 0x19860402, 0x19870402, 0x19880402, 0x19890402, 0x198A0402, 0x198B0402,
+    0x198C0402, 0x198D0402, 0x198E0402, 0x198F0402, 0x19900402, 0x19910402, 0x19920402, 0x19930402,
+    0x19940402, 0x19950402, 0x19960402, 0x19970402, 0x19980402, 0x19990402, 0x199A0402, 0x199B0402,
+    0x199C0402, 0x199D0402, 0x199E0402, 0x199F0402, 0x19A00402, 0x19A10402, 0x19A20402, 0x19A30402,
+    0x19A40402, 0x19A50402, 0x19A60402, 0x19A70402, 0x19A80402, 0x19A90402, 0x19AA0402, 0x19AB0402,
+    0x19AC0402, 0x19AD0402, 0x19AE0402, 0x19AF0402, 0x19B00402, 0x19B10402, 0x19B20402, 0x19B30402,
+    0x19B40402, 0x19B50402, 0x19B60402, 0x19B70402, 0x19B80402, 0x19B90402, 0x19BA0402, 0x19BB0402,
+    0x19BC0402, 0x19BD0402, 0x19BE0402, 0x19BF0402, 0x19C00402, 0x19C10402, 0x19C20402, 0x19C30402,
+    0x19C40402, 0x19C50402, 0x19C60402, 0x19C70402, 0x19C80402, 0x19C90402, 0x19CA0402, 0x19CB0402,
+    0x19CC0402, 0x19CD0402, 0x19CE0402, 0x19CF0402, 0x19D00402, 0x19D10402, 0x19D20402, 0x19D30402,
+    0x19D40402, 0x19D50402, 0x19D60402, 0x19D70402, 0x19D80402, 0x19D90402, 0x19DA0402, 0x19DB0402,
+    0x19DC0402, 0x19DD0402, 0x19DE0402, 0x19DF0402, 0x19E00402, 0x19E10402, 0x19E20402, 0x19E30402,
+    0x19E40402, 0x19E50402, 0x19E60402, 0x19E70402, 0x19E80402, 0x19E90402, 0x19EA0402, 0x19EB0402,
+    0x19EC0402, 0x19ED0402, 0x19EE0402, 0x19EF0402, 0x19F00402, 0x19F10402, 0x19F20402, 0x19F30402,
+    0x19F40402, 0x19F50402, 0x19F60402, 0x19F70402, 0x19F80402, 0x19F90402, 0x19FA0402, 0x19FB0402,
+    0x19FC0402, 0x19FD0402, 0x19FE0402, 0x19FF0402, 0x1A000402, 0x1A010402, 0x1A020402, 0x1A030402,
+    0x1A040402, 0x1A050402, 0x1A060402, 0x1A070402, 0x1A080402, 0x1A090402, 0x1A0A0402, 0x1A0B0402,
+    0x1A0C0402, 0x1A0D0402, 0x1A0E0402, 0x1A0F0402, 0x1A100402, 0x1A110402, 0x1A120402, 0x1A130402,
+    0x1A140402, 0x1A150402, 0x1A160402, 0x1A170402, 0x1A180402, 0x1A190402, 0x1A1A0402, 0x1A1B0402,
+    0x1A1C0402, 0x1A1D0402, 0x1A1E0402, 0x1A1F0402, 0x1A200402, 0x1A210402, 0x1A220402, 0x1A230402,
+    0x1A240402, 0x1A250402, 0x1A260402, 0x1A270402, 0x1A280402, 0x1A290402, 0x1A2A0402, 0x1A2B0402,
+    0x1A2C0402, 0x1A2D0402, 0x1A2E0402, 0x1A2F0402, 0x1A300402, 0x1A310402, 0x1A320402, 0x1A330402,
+    0x1A340402, 0x1A350402, 0x1A360402, 0x1A370402, 0x1A380402, 0x1A390402, 0x1A3A0402, 0x1A3B0402,
+    0x1A3C0402, 0x1A3D0402, 0x1A3E0402, 0x1A3F0402, 0x1A400402, 0x1A410402, 0x1A420402, 0x1A430402,
+    0x1A440402, 0x1A450402, 0x1A460402, 0x1A470402, 0x1A480402, 0x1A490402, 0x1A4A0402, 0x1A4B0402,
+    0x1A4C0402, 0x1A4D0402, 0x1A4E0402, 0x1A4F0402, 0x1A500402, 0x1A510402, 0x1A520402, 0x1A530402,
+    0x1A540402, 0x1A550402, 0x1A560402, 0x1A570402, 0x1A580402, 0x1A590402, 0x1A5A0402, 0x1A5B0402,
+    0x1A5C0402, 0x1A5D0402, 0x1A5E0402, 0x1A5F0402, 0x1A600402, 0x1A610402, 0x1A620402, 0x1A630402,
+    0x1A640402, 0x1A650402, 0x1A660402, 0x1A670402, 0x1A680402, 0x1A690402, 0x1A6A0402, 0x1A6B0402,
+    0x1A6C0402, 0x1A6D0402, 0x1A6E0402, 0x1A6F0402, 0x1A700402, 0x1A710402, 0x1A720402, 0x1A730402,
+    0x1A740402, 0x1A750402, 0x1A760402, 0x1A770402, 0x1A780402, 0x1A790402, 0x1A7A0402, 0x1A7B0402,
+    0x1A7C0402, 0x1A7D0402, 0x1A7E0402, 0x1A7F0402, 0x1A800402, 0x1A810402, 0x1A820402, 0x1A830402,
+    0x1A840402, 0x1A850402, 0x1A860402, 0x1A870402, 0x1A880402, 0x1A890402, 0x1A8A0402, 0x1A8B0402,
+    0x1A8C0402, 0x1A8D0402, 0x1A8E0402, 0x1A8F0402, 0x1A900402, 0x1A910402, 0x1A920402, 0x1A930402,
+    0x1A940402, 0x1A950402, 0x1A960402, 0x1A970402, 0x1A980402, 0x1A990402, 0x1A9A0402, 0x1A9B0402,
+    0x1A9C0402, 0x1A9D0402, 0x1A9E0402, 0x1A9F0402, 0x1AA00402, 0x1AA10402, 0x1AA20402, 0x1AA30402,
+    0x1AA40402, 0x1AA50402, 0x1AA60402, 0x1AA70402, 0x1AA80402, 0x1AA90402, 0x1AAA0402, 0x1AAB0402,
+    0x1AAC0402, 0x1AAD0402, 0x1AAE0402, 0x1AAF0402, 0x1AB00402, 0x1AB10402, 0x1AB20402, 0x1AB30402,
+    0x1AB40402, 0x1AB50402, 0x1AB60402, 0x1AB70402, 0x1AB80402, 0x1AB90402, 0x1ABA0402, 0x1ABB0402,
+    0x1ABC0402, 0x1ABD0402, 0x1ABE0402, 0x1ABF0402, 0x1AC00402, 0x1AC10402, 0x1AC20402, 0x1AC30402,
+    0x1AC40402, 0x1AC50402, 0x1AC60402, 0x1AC70402, 0x1AC80402, 0x1AC90402, 0x1ACA0402, 0x1ACB0402,
+    0x1ACC0402, 0x1ACD0402, 0x1ACE0402, 0x1ACF0402, 0x1AD00402, 0x1AD10402, 0x1AD20402, 0x1AD30402,
+    0x1AD40402, 0x1AD50402, 0x1AD60402, 0x1AD70402, 0x1AD80402, 0x1AD90402, 0x1ADA0402, 0x1ADB0402,
+    0x1ADC0402, 0x1ADD0402, 0x1ADE0402, 0x1ADF0402, 0x1AE00402, 0x1AE10402, 0x1AE20402, 0x1AE30402,
+    0x1AE40402, 0x1AE50402, 0x1AE60402, 0x1AE70402, 0x1AE80402, 0x1AE90402, 0x1AEA0402, 0x1AEB0402,
+    0x1AEC0402, 0x1AED0402, 0x1AEE0402, 0x1AEF0402, 0x1AF00402, 0x1AF10402, 0x1AF20402, 0x1AF30402,
+    0x1AF40402, 0x1AF50402, 0x1AF60402, 0x1AF70402, 0x1AF80402, 0x1AF90402, 0x1AFA0402, 0x1AFB0402,
+    0x1AFC0402, 0x1AFD0402, 0x1AFE0402, 0x17670402, 0x17680402, 0x17690402, 0x176A0402, 0x176B0402,
+    0x176C0402, 0x176D0402, 0x176E0402, 0x176F0402, 0x17700402, 0x17710402, 0x17720402, 0x17730402,
+    0x17740402, 0x17750402, 0x17760402, 0x17770402, 0x17780402, 0x17790402, 0x177A0402, 0x177B0402,
+    0x177C0402, 0x177D0402, 0x177E0402, 0x177F0402, 0x17800402, 0x17810402, 0x17820402, 0x17830402,
+    0x17840402, 0x17850402, 0x17860402, 0x17870402, 0x17880402, 0x17890402, 0x178A0402, 0x178B0402,
+    0x178C0402, 0x178D0402, 0x178E0402, 0x178F0402, 0x17900402, 0x17910402, 0x17920402, 0x17930402,
+    0x17940402, 0x17950402, 0x17960402, 0x17970402, 0x17980402, 0x17990402, 0x179A0402, 0x179B0402,
+    0x179C0402, 0x179D0402, 0x179E0402, 0x179F0402, 0x17A00402, 0x17A10402, 0x17A20402, 0x17A30402,
+    0x17A40402, 0x17A50402, 0x17A60402, 0x17A70402, 0x17A80402, 0x17A90402, 0x17AA0402, 0x17AB0402,
+    0x17AC0402, 0x17AD0402, 0x17AE0402, 0x17AF0402, 0x17B00402, 0x17B10402, 0x17B20402, 0x17B30402,
+    0x17B40402, 0x17B50402, 0x17B60402, 0x17B70402, 0x17B80402, 0x17B90402, 0x17BA0402, 0x17BB0402,
+    0x17BC0402, 0x17BD0402, 0x17BE0402, 0x17BF0402, 0x17C00402, 0x17C10402, 0x17C20402, 0x17C30402,
+    0x17C40402, 0x17C50402, 0x17C60402, 0x17C70402, 0x17C80402, 0x17C90402, 0x17CA0402, 0x17CB0402,
+    0x17CC0402, 0x17CD0402, 0x17CE0402, 0x17CF0402, 0x17D00402, 0x17D10402, 0x17D20402, 0x17D30402,
+    0x17D40402, 0x17D50402, 0x17D60402, 0x17D70402, 0x17D80402, 0x17D90402, 0x17DA0402, 0x17DB0402,
+    0x17DC0402, 0x17DD0402, 0x17DE0402, 0x17DF0402, 0x17E00402, 0x17E10402, 0x17E20402, 0x17E30402,
+    0x17E40402, 0x17E50402, 0x17E60402, 0x17E70402, 0x17E80402, 0x17E90402, 0x17EA0402, 0x17EB0402,
+    0x17EC0402, 0x17ED0402, 0x17EE0402, 0x17EF0402, 0x17F00402, 0x17F10402, 0x17F20402, 0x17F30402,
+    0x17F40402, 0x17F50402, 0x17F60402, 0x17F70402, 0x17F80402, 0x17F90402, 0x17FA0402, 0x17FB0402,
+    0x17FC0402, 0x17FD0402, 0x17FE0402, 0x17FF0402, 0x18000402, 0x18010402, 0x18020402, 0x18030402,
+    0x18040402, 0x18050402, 0x18060402, 0x18070402, 0x18080402, 0x18090402, 0x180A0402, 0x180B0402,
+    0x180C0402, 0x180D0402, 0x180E0402, 0x180F0402, 0x18100402, 0x18110402, 0x18120402, 0x18130402,
+    0x18140402, 0x18150402, 0x18160402, 0x18170402, 0x18180402, 0x18190402, 0x181A0402, 0x181B0402,
+    0x181C0402, 0x181D0402, 0x181E0402, 0x181F0402, 0x18200402, 0x18210402, 0x18220402, 0x18230402,
+    0x18240402, 0x18250402, 0x18260402, 0x18270402, 0x18280402, 0x18290402, 0x182A0402, 0x182B0402,
+    0x182C0402, 0x182D0402, 0x182E0402, 0x182F0402, 0x18300402, 0x18310402, 0x18320402, 0x18330402,
+    0x18340402, 0x18350402, 0x18360402, 0x18370402, 0x18380402, 0x18390402, 0x183A0402, 0x183B0402,
+    0x183C0402, 0x183D0402, 0x183E0402, 0x183F0402, 0x18400402, 0x18410402, 0x18420402, 0x18430402,
+    0x18440402, 0x18450402, 0x18460402, 0x18470402, 0x18480402, 0x18490402, 0x184A0402, 0x184B0402,
+    0x184C0402, 0x184D0402, 0x184E0402, 0x184F0402, 0x18500402, 0x18510402, 0x18520402, 0x18530402,
+    0x18540402, 0x18550402, 0x18560402, 0x18570402, 0x18580402, 0x18590402, 0x185A0402, 0x185B0402,
+    0x185C0402, 0x185D0402, 0x185E0402, 0x185F0402, 0x18600402, 0x18610402, 0x18620402, 0x18630402,
+    0x18640402, 0x13F90402, 0x13FA0402, 0x13FB0402, 0x13FC0402, 0x13FD0402, 0x13FE0402, 0x13FF0402,
+    0x14000402, 0x14010402, 0x14020402, 0x14030402, 0x14040402, 0x14050402, 0x14060402, 0x14070402,
+    0x14080402, 0x14090402, 0x140A0402, 0x140B0402, 0x140C0402, 0x140D0402, 0x140E0402, 0x140F0402,
+    0x14100402, 0x14110402, 0x14120402, 0x14130402, 0x14140402, 0x14150402, 0x14160402, 0x14170402,
+    0x14180402, 0x14190402, 0x141A0402, 0x141B0402, 0x141C0402, 0x141D0402, 0x141E0402, 0x141F0402,
+    0x14200402, 0x14210402, 0x14220402, 0x14230402, 0x14240402, 0x14250402, 0x14260402, 0x14270402,
+    0x14280402, 0x14290402, 0x142A0402, 0x142B0402, 0x142C0402, 0x142D0402, 0x142E0402, 0x142F0402,
+    0x14300402, 0x14310402, 0x14320402, 0x14330402, 0x14340402, 0x14350402, 0x14360402, 0x14370402,
+    0x14380402, 0x14390402, 0x143A0402, 0x143B0402, 0x143C0402, 0x143D0402, 0x143E0402, 0x143F0402,
+    0x14400402, 0x14410402, 0x14420402, 0x14430402, 0x14440402, 0x14450402, 0x14460402, 0x14470402,
+    0x14480402, 0x14490402, 0x144A0402, 0x144B0402, 0x144C0402, 0x144D0402, 0x144E0402, 0x144F0402,
+    0x14500402, 0x14510402, 0x14520402, 0x14530402, 0x14540402, 0x14550402, 0x14560402, 0x14570402,
+    0x14580402, 0x14590402, 0x145A0402, 0x18650402, 0x18660402, 0x18670402, 0x18680402, 0x18690402,
+    0x186A0402, 0x186B0402, 0x186C0402, 0x186D0402, 0x186E0402, 0x186F0402, 0x18700402, 0x18710402,
+    0x18720402, 0x18730402, 0x18740402, 0x18750402, 0x18760402, 0x18770402, 0x18780402, 0x18790402,
+    0x187A0402, 0x187B0402, 0x187C0402, 0x187D0402, 0x187E0402, 0x187F0402, 0x18800402, 0x18810402,
+    0x18820402, 0x18830402, 0x18840402, 0x18850402, 0x18860402, 0x18870402, 0x18880402, 0x18890402,
+    0x188A0402, 0x188B0402, 0x188C0402, 0x188D0402, 0x188E0402, 0x188F0402, 0x18900402, 0x18910402,
+    0x18920402, 0x18930402, 0x18940402, 0x18950402, 0x18960402, 0x18970402, 0x18980402, 0x18990402,
+    0x189A0402, 0x189B0402, 0x189C0402, 0x189D0402, 0x09690402, 0x096A0402, 0x096B0402, 0x096C0402,
+    0x096D0402, 0x096E0402, 0x096F0402, 0x09700402, 0x09710402, 0x09720402, 0x09730402, 0x09740402,
+    0x09750402, 0x09760402, 0x09770402, 0x09780402, 0x09790402, 0x097A0402, 0x097B0402, 0x097C0402,
+    0x097D0402, 0x097E0402, 0x097F0402, 0x09800402, 0x09810402, 0x09820402, 0x09830402, 0x09840402,
+    0x09850402, 0x09860402, 0x09870402, 0x09880402, 0x09890402, 0x098A0402, 0x098B0402, 0x098C0402,
+    0x098D0402, 0x098E0402, 0x098F0402, 0x09900402, 0x09910402, 0x09920402, 0x09930402, 0x09940402,
+    0x09950402, 0x09960402, 0x09970402, 0x09980402, 0x09990402, 0x099A0402, 0x099B0402, 0x099C0402,
+    0x099D0402, 0x099E0402, 0x099F0402, 0x09A00402, 0x09A10402, 0x09A20402, 0x09A30402, 0x09A40402,
+    0x09A50402, 0x09A60402, 0x09A70402, 0x09A80402, 0x09A90402, 0x09AA0402, 0x09AB0402, 0x09AC0402,
+    0x09AD0402, 0x09AE0402, 0x09AF0402, 0x09B00402, 0x09B10402, 0x09B20402, 0x09B30402, 0x09B40402,
+    0x09B50402, 0x09B60402, 0x09B70402, 0x09B80402, 0x09B90402, 0x09BA0402, 0x09BB0402, 0x09BC0402,
+    0x09BD0402, 0x09BE0402, 0x09BF0402, 0x09C00402, 0x09C10402, 0x09C20402, 0x09C30402, 0x09C40402,
+    0x09C50402, 0x09C60402, 0x09C70402, 0x09C80402, 0x09C90402, 0x09CA0402, 0x09CB0402, 0x09CC0402,
+    0x09CD0402, 0x09CE0402, 0x09CF0402, 0x09D00402, 0x09D10402, 0x09D20402, 0x09D30402, 0x09D40402,
+    0x09D50402, 0x09D60402, 0x09D70402, 0x09D80402, 0x09D90402, 0x09DA0402, 0x09DB0402, 0x09DC0402,
+    0x09DD0402, 0x09DE0402, 0x09DF0402, 0x09E00402, 0x09E10402, 0x09E20402, 0x09E30402, 0x09E40402,
+    0x09E50402, 0x09E60402, 0x09E70402, 0x09E80402, 0x09E90402, 0x09EA0402, 0x09EB0402, 0x09EC0402,
+    0x09ED0402, 0x09EE0402, 0x09EF0402, 0x09F00402, 0x09F10402, 0x09F20402, 0x09F30402, 0x09F40402,
+    0x09F50402, 0x09F60402, 0x09F70402, 0x09F80402, 0x09F90402, 0x09FA0402, 0x09FB0402, 0x09FC0402,
+    0x09FD0402, 0x09FE0402, 0x09FF0402, 0x0A000402, 0x0A010402, 0x0A020402, 0x0A030402, 0x0A040402,
+    0x0A050402, 0x0A060402, 0x0A070402, 0x0A080402, 0x0A090402, 0x0A0A0402, 0x0A0B0402, 0x0A0C0402,
+    0x0A0D0402, 0x0A0E0402, 0x0A0F0402, 0x0A100402, 0x0A110402, 0x0A120402, 0x0A130402, 0x0A140402,
+    0x0A150402, 0x0A160402, 0x0A170402, 0x0A180402, 0x0A190402, 0x0A1A0402, 0x0A1B0402, 0x0A1C0402,
+    0x0A1D0402, 0x0A1E0402, 0x0A1F0402, 0x0A200402, 0x0A210402, 0x0A220402, 0x0A230402, 0x0A240402,
+    0x0A250402, 0x0A260402, 0x0A270402, 0x0A280402, 0x0A290402, 0x0A2A0402, 0x0A2B0402, 0x0A2C0402,
+    0x0A2D0402, 0x0A2E0402, 0x0A2F0402, 0x0A300402, 0x0A310402, 0x0A320402, 0xFB400402, 0xCE3D0000,
+    0xFB400402, 0xCE380000, 0xFB400402, 0xCE410000, 0xFB840402, 0x81220000, 0xFB400402, 0xCF600000,
+    0xFB400402, 0xCFBB0000, 0xFB400402, 0xD0020000, 0xFB400402, 0xD07A0000, 0xFB400402, 0xD0990000,
+    0xFB400402, 0xD0CF0000, 0xFB800402, 0xB49E0000, 0xFB840402, 0x863A0000, 0xFB400402, 0xD1540000,
+    0xFB400402, 0xD1640000, 0xFB400402, 0xD1770000, 0xFB840402, 0x851C0000, 0xFB800402, 0xB4B90000,
+    0xFB400402, 0xD1670000, 0xFB400402, 0xD18D0000, 0xFB840402, 0x854B0000, 0xFB400402, 0xD1970000,
+    0xFB400402, 0xD1A40000, 0xFB400402, 0xCECC0000, 0xFB400402, 0xD1AC0000, 0xFB850402, 0x91DF0000,
+    0xFB400402, 0xD1F50000, 0xFB400402, 0xD2030000, 0xFB800402, 0xB4DF0000, 0xFB400402, 0xD23B0000,
+    0xFB400402, 0xD2460000, 0xFB400402, 0xD2720000, 0xFB400402, 0xD2770000, 0xFB800402, 0xB5150000,
+    0xFB400402, 0xD3050000, 0xFB400402, 0xD3060000, 0xFB400402, 0xD3490000, 0xFB400402, 0xD35A0000,
+    0xFB400402, 0xD3730000, 0xFB400402, 0xD37D0000, 0xFB400402, 0xD37F0000, 0xFB840402, 0x8A2C0000,
+    0xFB400402, 0xF0700000, 0xFB400402, 0xD3CA0000, 0xFB400402, 0xD3DF0000, 0xFB840402, 0x8B630000,
+    0xFB400402, 0xD3EB0000, 0xFB400402, 0xD3F10000, 0xFB400402, 0xD4060000, 0xFB400402, 0xD49E0000,
+    0xFB400402, 0xD4380000, 0xFB400402, 0xD4480000, 0xFB400402, 0xD4680000, 0xFB400402, 0xD4A20000,
+    0xFB400402, 0xD4F60000, 0xFB400402, 0xD5100000, 0xFB400402, 0xD5530000, 0xFB400402, 0xD5630000,
+    0xFB400402, 0xD5840000, 0xFB400402, 0xD5AB0000, 0xFB400402, 0xD5B30000, 0xFB400402, 0xD5C20000,
+    0xFB400402, 0xD7160000, 0xFB400402, 0xD7170000, 0xFB400402, 0xD6510000, 0xFB400402, 0xD6740000,
+    0xFB400402, 0xD8EE0000, 0xFB400402, 0xD7CE0000, 0xFB400402, 0xD7F40000, 0xFB400402, 0xD80D0000,
+    0xFB400402, 0xD78B0000, 0xFB400402, 0xD8320000, 0xFB400402, 0xD8310000, 0xFB400402, 0xD8AC0000,
+    0xFB840402, 0x94E40000, 0xFB400402, 0xD8F20000, 0xFB400402, 0xD8F70000, 0xFB400402, 0xD9060000,
+    0xFB400402, 0xD91A0000, 0xFB400402, 0xD9220000, 0xFB400402, 0xD9620000, 0xFB840402, 0x96A80000,
+    0xFB840402, 0x96EA0000, 0xFB400402, 0xD9EC0000, 0xFB400402, 0xDA1B0000, 0xFB400402, 0xDA270000,
+    0xFB400402, 0xD9D80000, 0xFB400402, 0xDA660000, 0xFB800402, 0xB6EE0000, 0xFB800402, 0xB6FC0000,
+    0xFB400402, 0xDB080000, 0xFB400402, 0xDB3E0000, 0xFB840402, 0x99C80000, 0xFB400402, 0xDBC30000,
+    0xFB400402, 0xDBD80000, 0xFB400402, 0xDBF30000, 0xFB840402, 0x9B180000, 0xFB400402, 0xDBFF0000,
+    0xFB400402, 0xDC060000, 0xFB400402, 0xDF530000, 0xFB400402, 0xDC220000, 0xFB800402, 0xB7810000,
+    0xFB400402, 0xDC600000, 0xFB400402, 0xDCC00000, 0xFB400402, 0xDC8D0000, 0xFB840402, 0x9DE40000,
+    0xFB400402, 0xDD430000, 0xFB840402, 0x9DE60000, 0xFB400402, 0xDD6E0000, 0xFB400402, 0xDD6B0000,
+    0xFB400402, 0xDD7C0000, 0xFB400402, 0xDDE10000, 0xFB400402, 0xDDE20000, 0xFB800402, 0xB82F0000,
+    0xFB400402, 0xDDFD0000, 0xFB400402, 0xDE280000, 0xFB400402, 0xDE3D0000, 0xFB400402, 0xDE690000,
+    0xFB800402, 0xB8620000, 0xFB840402, 0xA1830000, 0xFB800402, 0xB87C0000, 0xFB400402, 0xDEB00000,
+    0xFB400402, 0xDEB30000, 0xFB400402, 0xDEB60000, 0xFB850402, 0xA3920000, 0xFB400402, 0xDEFE0000,
+    0xFB840402, 0xA3310000, 0xFB410402, 0x82010000, 0xFB400402, 0xDF220000, 0xFB800402, 0xB8C70000,
+    0xFB840402, 0xB2B80000, 0xFB840402, 0xE1DA0000, 0xFB400402, 0xDF620000, 0xFB400402, 0xDF6B0000,
+    0xFB800402, 0xB8E30000, 0xFB400402, 0xDF9A0000, 0xFB400402, 0xDFCD0000, 0xFB400402, 0xDFD70000,
+    0xFB400402, 0xDFF90000, 0xFB400402, 0xE0810000, 0xFB800402, 0xB93A0000, 0xFB800402, 0xB91C0000,
+    0xFB840402, 0xA6D40000, 0xFB400402, 0xE0C70000, 0xFB400402, 0xE1480000, 0xFB400402, 0xE14C0000,
+    0xFB400402, 0xE17A0000, 0xFB400402, 0xE1B20000, 0xFB400402, 0xE1A40000, 0xFB400402, 0xE1AF0000,
+    0xFB400402, 0xE1DE0000, 0xFB400402, 0xE2100000, 0xFB400402, 0xE21B0000, 0xFB400402, 0xE25D0000,
+    0xFB400402, 0xE2B10000, 0xFB400402, 0xE2D40000, 0xFB400402, 0xE3500000, 0xFB840402, 0xAB0C0000,
+    0xFB400402, 0xE33D0000, 0xFB400402, 0xE2FC0000, 0xFB400402, 0xE3680000, 0xFB400402, 0xE3830000,
+    0xFB400402, 0xE3E40000, 0xFB840402, 0xABF10000, 0xFB400402, 0xE4220000, 0xFB400402, 0xE3C50000,
+    0xFB400402, 0xE3A90000, 0xFB800402, 0xBA2E0000, 0xFB400402, 0xE4690000, 0xFB400402, 0xE47E0000,
+    0xFB400402, 0xE49D0000, 0xFB400402, 0xE4770000, 0xFB800402, 0xBA6C0000, 0xFB400402, 0xE56C0000,
+    0xFB840402, 0xB00A0000, 0xFB400402, 0xE5E30000, 0xFB400402, 0xE6F80000, 0xFB400402, 0xE6490000,
+    0xFB800402, 0xBB190000, 0xFB800402, 0xBB080000, 0xFB800402, 0xBAE40000, 0xFB400402, 0xD1920000,
+    0xFB400402, 0xD1950000, 0xFB400402, 0xE7000000, 0xFB400402, 0xE69C0000, 0xFB410402, 0x80AD0000,
+    0xFB800402, 0xC3D90000, 0xFB400402, 0xE7210000, 0xFB400402, 0xE75E0000, 0xFB400402, 0xE7530000,
+    0xFB840402, 0xB3C30000, 0xFB800402, 0xBB490000, 0xFB400402, 0xE7FA0000, 0xFB400402, 0xE7850000,
+    0xFB400402, 0xE8520000, 0xFB840402, 0xB46D0000, 0xFB400402, 0xE88E0000, 0xFB400402, 0xE81F0000,
+    0xFB400402, 0xE9140000, 0xFB400402, 0xE9420000, 0xFB400402, 0xE9A30000, 0xFB400402, 0xE9EA0000,
+    0xFB400402, 0xEAA80000, 0xFB840402, 0xB6A30000, 0xFB400402, 0xEADB0000, 0xFB800402, 0xBC180000,
+    0xFB400402, 0xEB210000, 0xFB840402, 0xB8A70000, 0xFB400402, 0xEB540000, 0xFB800402, 0xBC4E0000,
+    0xFB400402, 0xEB720000, 0xFB400402, 0xEB9F0000, 0xFB400402, 0xEBBB0000, 0xFB840402, 0xBA8D0000,
+    0xFB840402, 0x9D0B0000, 0xFB840402, 0xBAFA0000, 0xFB400402, 0xEC4E0000, 0xFB840402, 0xBCBC0000,
+    0xFB400402, 0xECBF0000, 0xFB400402, 0xECCD0000, 0xFB400402, 0xEC670000, 0xFB400402, 0xED160000,
+    0xFB400402, 0xED3E0000, 0xFB400402, 0xED690000, 0xFB400402, 0xED780000, 0xFB400402, 0xED850000,
+    0xFB840402, 0xBD1E0000, 0xFB400402, 0xED340000, 0xFB400402, 0xEE2F0000, 0xFB400402, 0xEE6E0000,
+    0xFB800402, 0xBD330000, 0xFB400402, 0xEEC70000, 0xFB840402, 0xBED10000, 0xFB400402, 0xEDF90000,
+    0xFB400402, 0xEF6E0000, 0xFB840402, 0xBF5E0000, 0xFB840402, 0xBF8E0000, 0xFB400402, 0xEFC60000,
+    0xFB400402, 0xF0390000, 0xFB400402, 0xF01B0000, 0xFB800402, 0xBD960000, 0xFB400402, 0xF04A0000,
+    0xFB400402, 0xF07D0000, 0xFB400402, 0xF0770000, 0xFB400402, 0xF0AD0000, 0xFB840402, 0x85250000,
+    0xFB400402, 0xF1450000, 0xFB840402, 0xC2630000, 0xFB400402, 0xF19C0000, 0xFB840402, 0xC3AB0000,
+    0xFB400402, 0xF2280000, 0xFB400402, 0xF2500000, 0xFB840402, 0xC6080000, 0xFB400402, 0xF2800000,
+    0xFB400402, 0xF2950000, 0xFB840402, 0xC7350000, 0xFB840402, 0xC8140000, 0xFB400402, 0xF37A0000,
+    0xFB400402, 0xF38B0000, 0xFB800402, 0xBEAC0000, 0xFB400402, 0xF3A50000, 0xFB800402, 0xBEB80000,
+    0xFB400402, 0xF4470000, 0xFB400402, 0xF45C0000, 0xFB400402, 0xF4850000, 0xFB400402, 0xF4CA0000,
+    0xFB800402, 0xBF1B0000, 0xFB400402, 0xF5240000, 0xFB840402, 0xCC360000, 0xFB400402, 0xF53E0000,
+    0xFB840402, 0xCC920000, 0xFB840402, 0xA19F0000, 0xFB400402, 0xF6100000, 0xFB840402, 0xCFA10000,
+    0xFB840402, 0xCFB80000, 0xFB840402, 0xD0440000, 0xFB800402, 0xBFFC0000, 0xFB800402, 0xC0080000,
+    0xFB840402, 0xD0F30000, 0xFB840402, 0xD0F20000, 0xFB840402, 0xD1190000, 0xFB840402, 0xD1330000,
+    0xFB400402, 0xF71E0000, 0xFB400402, 0xF71F0000, 0xFB400402, 0xF78B0000, 0xFB800402, 0xC0460000,
+    0xFB800402, 0xC0960000, 0xFB840402, 0xD41D0000, 0xFB400402, 0xF84E0000, 0xFB800402, 0xC0E30000,
+    0xFB840402, 0xD6260000, 0xFB840402, 0xD69A0000, 0xFB840402, 0xD6C50000, 0xFB400402, 0xF9EB0000,
+    0xFB800402, 0xC12F0000, 0xFB400402, 0xFA4A0000, 0xFB400402, 0xFA4F0000, 0xFB840402, 0xD97C0000,
+    0xFB840402, 0xDAA70000, 0xFB400402, 0xFAEE0000, 0xFB800402, 0xC2020000, 0xFB840402, 0xDBAB0000,
+    0xFB400402, 0xFBC60000, 0xFB400402, 0xFBC90000, 0xFB800402, 0xC2270000, 0xFB840402, 0xDC800000,
+    0xFB400402, 0xFCD20000, 0xFB800402, 0xC2A00000, 0xFB400402, 0xFCE80000, 0xFB400402, 0xFCE30000,
+    0xFB400402, 0xFD000000, 0xFB840402, 0xDF860000, 0xFB400402, 0xFD630000, 0xFB800402, 0xC3010000,
+    0xFB400402, 0xFDC70000, 0xFB400402, 0xFE020000, 0xFB400402, 0xFE450000, 0xFB800402, 0xC3340000,
+    0xFB840402, 0xE2280000, 0xFB840402, 0xE2470000, 0xFB800402, 0xC3590000, 0xFB840402, 0xE2D90000,
+    0xFB400402, 0xFF7A0000, 0xFB840402, 0xE33E0000, 0xFB400402, 0xFF950000, 0xFB400402, 0xFFFA0000,
+    0xFB840402, 0xE4DA0000, 0xFB840402, 0xE5230000, 0xFB410402, 0x80600000, 0xFB840402, 0xE5A80000,
+    0xFB410402, 0x80700000, 0xFB840402, 0xB35F0000, 0xFB800402, 0xC3D50000, 0xFB410402, 0x80B20000,
+    0xFB410402, 0x81030000, 0xFB800402, 0xC40B0000, 0xFB410402, 0x813E0000, 0xFB400402, 0xDAB50000,
+    0xFB840402, 0xE7A70000, 0xFB840402, 0xE7B50000, 0xFB840402, 0xB3930000, 0xFB840402, 0xB39C0000,
+    0xFB410402, 0x82040000, 0xFB410402, 0x8F9E0000, 0xFB800402, 0xC46B0000, 0xFB410402, 0x82910000,
+    0xFB410402, 0x828B0000, 0xFB410402, 0x829D0000, 0xFB400402, 0xD2B30000, 0xFB410402, 0x82B10000,
+    0xFB410402, 0x82B30000, 0xFB410402, 0x82BD0000, 0xFB410402, 0x82E60000, 0xFB840402, 0xEB3C0000,
+    0xFB410402, 0x831D0000, 0xFB410402, 0x83630000, 0xFB410402, 0x83AD0000, 0xFB410402, 0x83230000,
+    0xFB410402, 0x83BD0000, 0xFB410402, 0x83E70000, 0xFB410402, 0x83530000, 0xFB410402, 0x83CA0000,
+    0xFB410402, 0x83CC0000, 0xFB410402, 0x83DC0000, 0xFB840402, 0xEC360000, 0xFB840402, 0xED6B0000,
+    0xFB840402, 0xECD50000, 0xFB800402, 0xC52B0000, 0xFB410402, 0x84F10000, 0xFB410402, 0x84F30000,
+    0xFB410402, 0x85160000, 0xFB840402, 0xF3CA0000, 0xFB410402, 0x85640000, 0xFB840402, 0xEF2C0000,
+    0xFB800402, 0xC55D0000, 0xFB800402, 0xC5610000, 0xFB840402, 0xEFB10000, 0xFB840402, 0xF0D20000,
+    0xFB800402, 0xC56B0000, 0xFB410402, 0x86500000, 0xFB410402, 0x86670000, 0xFB410402, 0x86690000,
+    0xFB410402, 0x86A90000, 0xFB410402, 0x86880000, 0xFB410402, 0x870E0000, 0xFB410402, 0x86E20000,
+    0xFB410402, 0x87280000, 0xFB410402, 0x876B0000, 0xFB410402, 0x87860000, 0xFB800402, 0xC5D70000,
+    0xFB410402, 0x87E10000, 0xFB410402, 0x88010000, 0xFB800402, 0xC5F90000, 0xFB410402, 0x88600000,
+    0xFB410402, 0x88630000, 0xFB840402, 0xF6670000, 0xFB410402, 0x88D70000, 0xFB410402, 0x88DE0000,
+    0xFB800402, 0xC6350000, 0xFB410402, 0x88FA0000, 0xFB800402, 0xB4BB0000, 0xFB840402, 0xF8AE0000,
+    0xFB840402, 0xF9660000, 0xFB800402, 0xC6BE0000, 0xFB800402, 0xC6C70000, 0xFB410402, 0x8AA00000,
+    0xFB410402, 0x8C550000, 0xFB840402, 0xFCA80000, 0xFB410402, 0x8CAB0000, 0xFB410402, 0x8CC10000,
+    0xFB410402, 0x8D1B0000, 0xFB410402, 0x8D770000, 0xFB840402, 0xFF2F0000, 0xFB840402, 0x88040000,
+    0xFB410402, 0x8DCB0000, 0xFB410402, 0x8DBC0000, 0xFB410402, 0x8DF00000, 0xFB840402, 0x88DE0000,
+    0xFB410402, 0x8ED40000, 0xFB850402, 0x85D20000, 0xFB850402, 0x85ED0000, 0xFB410402, 0x90940000,
+    0xFB410402, 0x90F10000, 0xFB410402, 0x91110000, 0xFB850402, 0x872E0000, 0xFB410402, 0x911B0000,
+    0xFB410402, 0x92380000, 0xFB410402, 0x92D70000, 0xFB410402, 0x92D80000, 0xFB410402, 0x927C0000,
+    0xFB410402, 0x93F90000, 0xFB410402, 0x94150000, 0xFB850402, 0x8BFA0000, 0xFB410402, 0x958B0000,
+    0xFB800402, 0xC9950000, 0xFB410402, 0x95B70000, 0xFB850402, 0x8D770000, 0xFB800402, 0xC9E60000,
+    0xFB410402, 0x96C30000, 0xFB400402, 0xDDB20000, 0xFB410402, 0x97230000, 0xFB850402, 0x91450000,
+    0xFB850402, 0x921A0000, 0xFB800402, 0xCA6E0000, 0xFB800402, 0xCA760000, 0xFB410402, 0x97E00000,
+    0xFB850402, 0x940A0000, 0xFB800402, 0xCAB20000, 0xFB850402, 0x94960000, 0xFB410402, 0x98290000,
+    0xFB850402, 0x95B60000, 0xFB410402, 0x98E20000, 0xFB800402, 0xCB330000, 0xFB410402, 0x99290000,
+    0xFB410402, 0x99A70000, 0xFB410402, 0x99C20000, 0xFB410402, 0x99FE0000, 0xFB800402, 0xCBCE0000,
+    0xFB850402, 0x9B300000, 0xFB410402, 0x9C400000, 0xFB410402, 0x9CFD0000, 0xFB800402, 0xCCCE0000,
+    0xFB800402, 0xCCED0000, 0xFB410402, 0x9D670000, 0xFB850402, 0xA0CE0000, 0xFB800402, 0xCCF80000,
+    0xFB850402, 0xA1050000, 0xFB850402, 0xA20E0000, 0xFB850402, 0xA2910000, 0xFB410402, 0x9EBB0000,
+    0xFB800402, 0xCD560000, 0xFB410402, 0x9EF90000, 0xFB410402, 0x9EFE0000, 0xFB410402, 0x9F050000,
+    0xFB410402, 0x9F0F0000, 0xFB410402, 0x9F160000, 0xFB410402, 0x9F3B0000, 0xFB850402, 0xA6000000,
+    0x32170402, 0x32510402, 0x32180402, 0x32510402, 0x32190402, 0x32510402, 0x321A0402, 0x32510402,
+    0x321B0402, 0x32510402, 0x321C0402, 0x32510402, 0x321D0402, 0x32510402, 0x321E0402, 0x32510402,
+    0x321F0402, 0x32510402, 0x32200402, 0x32510402, 0x32210402, 0x32510402, 0x32220402, 0x32510402,
+    0x32230402, 0x32510402, 0x32240402, 0x32510402, 0x32250402, 0x32510402, 0x32260402, 0x32510402,
+    0x32270402, 0x32510402, 0x32280402, 0x32510402, 0x32290402, 0x32510402, 0x322A0402, 0x32510402,
+    0x322B0402, 0x32510402, 0x322C0402, 0x32510402, 0x322D0402, 0x32510402, 0x322E0402, 0x32510402,
+    0x322F0402, 0x32510402, 0x32300402, 0x32510402, 0x32310402, 0x32510402, 0x32320402, 0x32510402,
+    0x32330402, 0x32510402, 0x32340402, 0x32510402, 0x32350402, 0x32510402, 0x32360402, 0x32510402,
+    0x32370402, 0x32510402, 0x32380402, 0x32510402, 0x32390402, 0x32510402, 0x323A0402, 0x32510402,
+    0x323B0402, 0x32510402, 0x323C0402, 0x32510402, 0x323D0402, 0x32510402, 0x323E0402, 0x32510402,
+    0x323F0402, 0x32510402, 0x32400402, 0x32510402, 0x32410402, 0x32510402, 0x32420402, 0x32510402,
+    0x32430402, 0x32510402, 0x32440402, 0x32510402, 0x32170402, 0x32520402, 0x32180402, 0x32520402,
+    0x32190402, 0x32520402, 0x321A0402, 0x32520402, 0x321B0402, 0x32520402, 0x321C0402, 0x32520402,
+    0x321D0402, 0x32520402, 0x321E0402, 0x32520402, 0x321F0402, 0x32520402, 0x32200402, 0x32520402,
+    0x32210402, 0x32520402, 0x32220402, 0x32520402, 0x32230402, 0x32520402, 0x32240402, 0x32520402,
+    0x32250402, 0x32520402, 0x32260402, 0x32520402, 0x32270402, 0x32520402, 0x32280402, 0x32520402,
+    0x32290402, 0x32520402, 0x322A0402, 0x32520402, 0x322B0402, 0x32520402, 0x322C0402, 0x32520402,
+    0x322D0402, 0x32520402, 0x322E0402, 0x32520402, 0x322F0402, 0x32520402, 0x32300402, 0x32520402,
+    0x32310402, 0x32520402, 0x32320402, 0x32520402, 0x32330402, 0x32520402, 0x32340402, 0x32520402,
+    0x32350402, 0x32520402, 0x32360402, 0x32520402, 0x32370402, 0x32520402, 0x32380402, 0x32520402,
+    0x32390402, 0x32520402, 0x323A0402, 0x32520402, 0x323B0402, 0x32520402, 0x323C0402, 0x32520402,
+    0x323D0402, 0x32520402, 0x323E0402, 0x32520402, 0x323F0402, 0x32520402, 0x32400402, 0x32520402,
+    0x32410402, 0x32520402, 0x32420402, 0x32520402, 0x32430402, 0x32520402, 0x32440402, 0x32520402,
+    0x32170402, 0x32530402, 0x32180402, 0x32530402, 0x32190402, 0x32530402, 0x321A0402, 0x32530402,
+    0x321B0402, 0x32530402, 0x321C0402, 0x32530402, 0x321D0402, 0x32530402, 0x321E0402, 0x32530402,
+    0x321F0402, 0x32530402, 0x32200402, 0x32530402, 0x32210402, 0x32530402, 0x32220402, 0x32530402,
+    0x32230402, 0x32530402, 0x32240402, 0x32530402, 0x32250402, 0x32530402, 0x32260402, 0x32530402,
+    0x32270402, 0x32530402, 0x32280402, 0x32530402, 0x32290402, 0x32530402, 0x322A0402, 0x32530402,
+    0x322B0402, 0x32530402, 0x322C0402, 0x32530402, 0x322D0402, 0x32530402, 0x322E0402, 0x32530402,
+    0x322F0402, 0x32530402, 0x32300402, 0x32530402, 0x32310402, 0x32530402, 0x32320402, 0x32530402,
+    0x32330402, 0x32530402, 0x32340402, 0x32530402, 0x32350402, 0x32530402, 0x32360402, 0x32530402,
+    0x32370402, 0x32530402, 0x32380402, 0x32530402, 0x32390402, 0x32530402, 0x323A0402, 0x32530402,
+    0x323B0402, 0x32530402, 0x323C0402, 0x32530402, 0x323D0402, 0x32530402, 0x323E0402, 0x32530402,
+    0x323F0402, 0x32530402, 0x32400402, 0x32530402, 0x32410402, 0x32530402, 0x32420402, 0x32530402,
+    0x32430402, 0x32530402, 0x32440402, 0x32530402, 0x32170402, 0x32540402, 0x32180402, 0x32540402,
+    0x32190402, 0x32540402, 0x321A0402, 0x32540402, 0x321B0402, 0x32540402, 0x321C0402, 0x32540402,
+    0x321D0402, 0x32540402, 0x321E0402, 0x32540402, 0x321F0402, 0x32540402, 0x32200402, 0x32540402,
+    0x32210402, 0x32540402, 0x32220402, 0x32540402, 0x32230402, 0x32540402, 0x32240402, 0x32540402,
+    0x32250402, 0x32540402, 0x32260402, 0x32540402, 0x32270402, 0x32540402, 0x32280402, 0x32540402,
+    0x32290402, 0x32540402, 0x322A0402, 0x32540402, 0x322B0402, 0x32540402, 0x322C0402, 0x32540402,
+    0x322D0402, 0x32540402, 0x322E0402, 0x32540402, 0x322F0402, 0x32540402, 0x32300402, 0x32540402,
+    0x32310402, 0x32540402, 0x32320402, 0x32540402, 0x32330402, 0x32540402, 0x32340402, 0x32540402,
+    0x32350402, 0x32540402, 0x32360402, 0x32540402, 0x32370402, 0x32540402, 0x32380402, 0x32540402,
+    0x32390402, 0x32540402, 0x323A0402, 0x32540402, 0x323B0402, 0x32540402, 0x323C0402, 0x32540402,
+    0x323D0402, 0x32540402, 0x323E0402, 0x32540402, 0x323F0402, 0x32540402, 0x32400402, 0x32540402,
+    0x32410402, 0x32540402, 0x32420402, 0x32540402, 0x32430402, 0x32540402, 0x32440402, 0x32540402,
+    0x32170402, 0x32550402, 0x32180402, 0x32550402, 0x32190402, 0x32550402, 0x321A0402, 0x32550402,
+    0x321B0402, 0x32550402, 0x321C0402, 0x32550402, 0x321D0402, 0x32550402, 0x321E0402, 0x32550402,
+    0x321F0402, 0x32550402, 0x32200402, 0x32550402, 0x32210402, 0x32550402, 0x32220402, 0x32550402,
+    0x32230402, 0x32550402, 0x32240402, 0x32550402, 0x32250402, 0x32550402, 0x32260402, 0x32550402,
+    0x32270402, 0x32550402, 0x32280402, 0x32550402, 0x32290402, 0x32550402, 0x322A0402, 0x32550402,
+    0x322B0402, 0x32550402, 0x322C0402, 0x32550402, 0x322D0402, 0x32550402, 0x322E0402, 0x32550402,
+    0x322F0402, 0x32550402, 0x32300402, 0x32550402, 0x32310402, 0x32550402, 0x32320402, 0x32550402,
+    0x32330402, 0x32550402, 0x32340402, 0x32550402, 0x32350402, 0x32550402, 0x32360402, 0x32550402,
+    0x32370402, 0x32550402, 0x32380402, 0x32550402, 0x32390402, 0x32550402, 0x323A0402, 0x32550402,
+    0x323B0402, 0x32550402, 0x323C0402, 0x32550402, 0x323D0402, 0x32550402, 0x323E0402, 0x32550402,
+    0x323F0402, 0x32550402, 0x32400402, 0x32550402, 0x32410402, 0x32550402, 0x32420402, 0x32550402,
+    0x32430402, 0x32550402, 0x32440402, 0x32550402, 0x32580402, 0x32910402, 0x32590402, 0x32910402,
+    0x325A0402, 0x32910402, 0x325B0402, 0x32910402, 0x325C0402, 0x32910402, 0x325D0402, 0x32910402,
+    0x325E0402, 0x32910402, 0x32600402, 0x32910402, 0x32610402, 0x32910402, 0x32640402, 0x32910402,
+    0x32620402, 0x32910402, 0x32650402, 0x32910402, 0x32660402, 0x32910402, 0x32670402, 0x32910402,
+    0x32680402, 0x32910402, 0x32690402, 0x32910402, 0x326A0402, 0x32910402, 0x326B0402, 0x32910402,
+    0x326C0402, 0x32910402, 0x326D0402, 0x32910402, 0x326E0402, 0x32910402, 0x326F0402, 0x32910402,
+    0x32700402, 0x32910402, 0x32710402, 0x32910402, 0x32720402, 0x32910402, 0x32730402, 0x32910402,
+    0x32740402, 0x32910402, 0x32750402, 0x32910402, 0x32760402, 0x32910402, 0x32770402, 0x32910402,
+    0x32780402, 0x32910402, 0x32790402, 0x32910402, 0x327A0402, 0x32910402, 0x327B0402, 0x32910402,
+    0x327C0402, 0x32910402, 0x327D0402, 0x32910402, 0x325F0402, 0x32910402, 0x327E0402, 0x32910402,
+    0x327F0402, 0x32910402, 0x32800402, 0x32910402, 0x32810402, 0x32910402, 0x327E0404, 0x326F0404,
+    0x32910402, 0x327E0404, 0x32770404, 0x32910402, 0x32570402, 0x32910402, 0x32630402, 0x32910402,
+    0x32580402, 0x32920402, 0x32590402, 0x32920402, 0x325A0402, 0x32920402, 0x325B0402, 0x32920402,
+    0x325C0402, 0x32920402, 0x325D0402, 0x32920402, 0x325E0402, 0x32920402, 0x32600402, 0x32920402,
+    0x32610402, 0x32920402, 0x32640402, 0x32920402, 0x32620402, 0x32920402, 0x32650402, 0x32920402,
+    0x32660402, 0x32920402, 0x32670402, 0x32920402, 0x32680402, 0x32920402, 0x32690402, 0x32920402,
+    0x326A0402, 0x32920402, 0x326B0402, 0x32920402, 0x326C0402, 0x32920402, 0x326D0402, 0x32920402,
+    0x326E0402, 0x32920402, 0x326F0402, 0x32920402, 0x32700402, 0x32920402, 0x32710402, 0x32920402,
+    0x32720402, 0x32920402, 0x32730402, 0x32920402, 0x32740402, 0x32920402, 0x32750402, 0x32920402,
+    0x32760402, 0x32920402, 0x32770402, 0x32920402, 0x32780402, 0x32920402, 0x32790402, 0x32920402,
+    0x327A0402, 0x32920402, 0x327B0402, 0x32920402, 0x327C0402, 0x32920402, 0x327D0402, 0x32920402,
+    0x325F0402, 0x32920402, 0x327E0402, 0x32920402, 0x327F0402, 0x32920402, 0x32800402, 0x32920402,
+    0x32810402, 0x32920402, 0x327E0404, 0x326F0404, 0x32920402, 0x327E0404, 0x32770404, 0x32920402,
+    0x32570402, 0x32920402, 0x32630402, 0x32920402, 0x32580402, 0x32930402, 0x32590402, 0x32930402,
+    0x325A0402, 0x32930402, 0x325B0402, 0x32930402, 0x325C0402, 0x32930402, 0x325D0402, 0x32930402,
+    0x325E0402, 0x32930402, 0x32600402, 0x32930402, 0x32610402, 0x32930402, 0x32640402, 0x32930402,
+    0x32620402, 0x32930402, 0x32650402, 0x32930402, 0x32660402, 0x32930402, 0x32670402, 0x32930402,
+    0x32680402, 0x32930402, 0x32690402, 0x32930402, 0x326A0402, 0x32930402, 0x326B0402, 0x32930402,
+    0x326C0402, 0x32930402, 0x326D0402, 0x32930402, 0x326E0402, 0x32930402, 0x326F0402, 0x32930402,
+    0x32700402, 0x32930402, 0x32710402, 0x32930402, 0x32720402, 0x32930402, 0x32730402, 0x32930402,
+    0x32740402, 0x32930402, 0x32750402, 0x32930402, 0x32760402, 0x32930402, 0x32770402, 0x32930402,
+    0x32780402, 0x32930402, 0x32790402, 0x32930402, 0x327A0402, 0x32930402, 0x327B0402, 0x32930402,
+    0x327C0402, 0x32930402, 0x327D0402, 0x32930402, 0x325F0402, 0x32930402, 0x327E0402, 0x32930402,
+    0x327F0402, 0x32930402, 0x32800402, 0x32930402, 0x32810402, 0x32930402, 0x327E0404, 0x326F0404,
+    0x32930402, 0x327E0404, 0x32770404, 0x32930402, 0x32570402, 0x32930402, 0x32630402, 0x32930402,
+    0x32580402, 0x32940402, 0x32590402, 0x32940402, 0x325A0402, 0x32940402, 0x325B0402, 0x32940402,
+    0x325C0402, 0x32940402, 0x325D0402, 0x32940402, 0x325E0402, 0x32940402, 0x32600402, 0x32940402,
+    0x32610402, 0x32940402, 0x32640402, 0x32940402, 0x32620402, 0x32940402, 0x32650402, 0x32940402,
+    0x32660402, 0x32940402, 0x32670402, 0x32940402, 0x32680402, 0x32940402, 0x32690402, 0x32940402,
+    0x326A0402, 0x32940402, 0x326B0402, 0x32940402, 0x326C0402, 0x32940402, 0x326D0402, 0x32940402,
+    0x326E0402, 0x32940402, 0x326F0402, 0x32940402, 0x32700402, 0x32940402, 0x32710402, 0x32940402,
+    0x32720402, 0x32940402, 0x32730402, 0x32940402, 0x32740402, 0x32940402, 0x32750402, 0x32940402,
+    0x32760402, 0x32940402, 0x32770402, 0x32940402, 0x32780402, 0x32940402, 0x32790402, 0x32940402,
+    0x327A0402, 0x32940402, 0x327B0402, 0x32940402, 0x327C0402, 0x32940402, 0x327D0402, 0x32940402,
+    0x325F0402, 0x32940402, 0x327E0402, 0x32940402, 0x327F0402, 0x32940402, 0x32800402, 0x32940402,
+    0x32810402, 0x32940402, 0x327E0404, 0x326F0404, 0x32940402, 0x327E0404, 0x32770404, 0x32940402,
+    0x32570402, 0x32940402, 0x32630402, 0x32940402, 0x32580402, 0x32950402, 0x32590402, 0x32950402,
+    0x325A0402, 0x32950402, 0x325B0402, 0x32950402, 0x325C0402, 0x32950402, 0x325D0402, 0x32950402,
+    0x325E0402, 0x32950402, 0x32600402, 0x32950402, 0x32610402, 0x32950402, 0x32640402, 0x32950402,
+    0x32620402, 0x32950402, 0x32650402, 0x32950402, 0x32660402, 0x32950402, 0x32670402, 0x32950402,
+    0x32680402, 0x32950402, 0x32690402, 0x32950402, 0x326A0402, 0x32950402, 0x326B0402, 0x32950402,
+    0x326C0402, 0x32950402, 0x326D0402, 0x32950402, 0x326E0402, 0x32950402, 0x326F0402, 0x32950402,
+    0x32700402, 0x32950402, 0x32710402, 0x32950402, 0x32720402, 0x32950402, 0x32730402, 0x32950402,
+    0x32740402, 0x32950402, 0x32750402, 0x32950402, 0x32760402, 0x32950402, 0x32770402, 0x32950402,
+    0x32780402, 0x32950402, 0x32790402, 0x32950402, 0x327A0402, 0x32950402, 0x327B0402, 0x32950402,
+    0x327C0402, 0x32950402, 0x327D0402, 0x32950402, 0x325F0402, 0x32950402, 0x327E0402, 0x32950402,
+    0x327F0402, 0x32950402, 0x32800402, 0x32950402, 0x32810402, 0x32950402, 0x327E0404, 0x326F0404,
+    0x32950402, 0x327E0404, 0x32770404, 0x32950402, 0x32570402, 0x32950402, 0x32630402, 0x32950402,
+    0x32960402, 0x32CB0402, 0x32970402, 0x32CB0402, 0x32980402, 0x32CB0402, 0x32990402, 0x32CB0402,
+    0x329A0402, 0x32CB0402, 0x329B0402, 0x32CB0402, 0x329C0402, 0x32CB0402, 0x329D0402, 0x32CB0402,
+    0x329E0402, 0x32CB0402, 0x329F0402, 0x32CB0402, 0x32A00402, 0x32CB0402, 0x32A10402, 0x32CB0402,
+    0x32A20402, 0x32CB0402, 0x32A30402, 0x32CB0402, 0x32A40402, 0x32CB0402, 0x32A50402, 0x32CB0402,
+    0x32A60402, 0x32CB0402, 0x32A70402, 0x32CB0402, 0x32A80402, 0x32CB0402, 0x32A90402, 0x32CB0402,
+    0x32AA0402, 0x32CB0402, 0x32AB0402, 0x32CB0402, 0x32AC0402, 0x32CB0402, 0x32AD0402, 0x32CB0402,
+    0x32AE0402, 0x32CB0402, 0x32AF0402, 0x32CB0402, 0x32B00402, 0x32CB0402, 0x32B10402, 0x32CB0402,
+    0x32B20402, 0x32CB0402, 0x32B30402, 0x32CB0402, 0x32B40402, 0x32CB0402, 0x32B50402, 0x32CB0402,
+    0x32B60402, 0x32CB0402, 0x32B70402, 0x32CB0402, 0x32B80402, 0x32CB0402, 0x32B90402, 0x32CB0402,
+    0x32BA0402, 0x32CB0402, 0x32BB0402, 0x32CB0402, 0x32BC0402, 0x32CB0402, 0x32BD0402, 0x32CB0402,
+    0x32BE0402, 0x32CB0402, 0x32BF0402, 0x32CB0402, 0x32C00402, 0x32CB0402, 0x32C10402, 0x32CB0402,
+    0x32C20402, 0x32CB0402, 0x32C30402, 0x32CB0402, 0x32C40402, 0x32CB0402, 0x32C50402, 0x32CB0402,
+    0x32960402, 0x32CC0402, 0x32970402, 0x32CC0402, 0x32980402, 0x32CC0402, 0x32990402, 0x32CC0402,
+    0x329A0402, 0x32CC0402, 0x329B0402, 0x32CC0402, 0x329C0402, 0x32CC0402, 0x329D0402, 0x32CC0402,
+    0x329E0402, 0x32CC0402, 0x329F0402, 0x32CC0402, 0x32A00402, 0x32CC0402, 0x32A10402, 0x32CC0402,
+    0x32A20402, 0x32CC0402, 0x32A30402, 0x32CC0402, 0x32A40402, 0x32CC0402, 0x32A50402, 0x32CC0402,
+    0x32A60402, 0x32CC0402, 0x32A70402, 0x32CC0402, 0x32A80402, 0x32CC0402, 0x32A90402, 0x32CC0402,
+    0x32AA0402, 0x32CC0402, 0x32AB0402, 0x32CC0402, 0x32AC0402, 0x32CC0402, 0x32AD0402, 0x32CC0402,
+    0x32AE0402, 0x32CC0402, 0x32AF0402, 0x32CC0402, 0x32B00402, 0x32CC0402, 0x32B10402, 0x32CC0402,
+    0x32B20402, 0x32CC0402, 0x32B30402, 0x32CC0402, 0x32B40402, 0x32CC0402, 0x32B50402, 0x32CC0402,
+    0x32B60402, 0x32CC0402, 0x32B70402, 0x32CC0402, 0x32B80402, 0x32CC0402, 0x32B90402, 0x32CC0402,
+    0x32BA0402, 0x32CC0402, 0x32BB0402, 0x32CC0402, 0x32BC0402, 0x32CC0402, 0x32BD0402, 0x32CC0402,
+    0x32BE0402, 0x32CC0402, 0x32BF0402, 0x32CC0402, 0x32C00402, 0x32CC0402, 0x32C10402, 0x32CC0402,
+    0x32C20402, 0x32CC0402, 0x32C30402, 0x32CC0402, 0x32C40402, 0x32CC0402, 0x32C50402, 0x32CC0402,
+    0x32960402, 0x32CF0402, 0x32970402, 0x32CF0402, 0x32980402, 0x32CF0402, 0x32990402, 0x32CF0402,
+    0x329A0402, 0x32CF0402, 0x329B0402, 0x32CF0402, 0x329C0402, 0x32CF0402, 0x329D0402, 0x32CF0402,
+    0x329E0402, 0x32CF0402, 0x329F0402, 0x32CF0402, 0x32A00402, 0x32CF0402, 0x32A10402, 0x32CF0402,
+    0x32A20402, 0x32CF0402, 0x32A30402, 0x32CF0402, 0x32A40402, 0x32CF0402, 0x32A50402, 0x32CF0402,
+    0x32A60402, 0x32CF0402, 0x32A70402, 0x32CF0402, 0x32A80402, 0x32CF0402, 0x32A90402, 0x32CF0402,
+    0x32AA0402, 0x32CF0402, 0x32AB0402, 0x32CF0402, 0x32AC0402, 0x32CF0402, 0x32AD0402, 0x32CF0402,
+    0x32AE0402, 0x32CF0402, 0x32AF0402, 0x32CF0402, 0x32B00402, 0x32CF0402, 0x32B10402, 0x32CF0402,
+    0x32B20402, 0x32CF0402, 0x32B30402, 0x32CF0402, 0x32B40402, 0x32CF0402, 0x32B50402, 0x32CF0402,
+    0x32B60402, 0x32CF0402, 0x32B70402, 0x32CF0402, 0x32B80402, 0x32CF0402, 0x32B90402, 0x32CF0402,
+    0x32BA0402, 0x32CF0402, 0x32BB0402, 0x32CF0402, 0x32BC0402, 0x32CF0402, 0x32BD0402, 0x32CF0402,
+    0x32BE0402, 0x32CF0402, 0x32BF0402, 0x32CF0402, 0x32C00402, 0x32CF0402, 0x32C10402, 0x32CF0402,
+    0x32C20402, 0x32CF0402, 0x32C30402, 0x32CF0402, 0x32C40402, 0x32CF0402, 0x32C50402, 0x32CF0402,
+    0x32960402, 0x32D10402, 0x32970402, 0x32D10402, 0x32980402, 0x32D10402, 0x32990402, 0x32D10402,
+    0x329A0402, 0x32D10402, 0x329B0402, 0x32D10402, 0x329C0402, 0x32D10402, 0x329D0402, 0x32D10402,
+    0x329E0402, 0x32D10402, 0x329F0402, 0x32D10402, 0x32A00402, 0x32D10402, 0x32A10402, 0x32D10402,
+    0x32A20402, 0x32D10402, 0x32A30402, 0x32D10402, 0x32A40402, 0x32D10402, 0x32A50402, 0x32D10402,
+    0x32A60402, 0x32D10402, 0x32A70402, 0x32D10402, 0x32A80402, 0x32D10402, 0x32A90402, 0x32D10402,
+    0x32AA0402, 0x32D10402, 0x32AB0402, 0x32D10402, 0x32AC0402, 0x32D10402, 0x32AD0402, 0x32D10402,
+    0x32AE0402, 0x32D10402, 0x32AF0402, 0x32D10402, 0x32B00402, 0x32D10402, 0x32B10402, 0x32D10402,
+    0x32B20402, 0x32D10402, 0x32B30402, 0x32D10402, 0x32B40402, 0x32D10402, 0x32B50402, 0x32D10402,
+    0x32B60402, 0x32D10402, 0x32B70402, 0x32D10402, 0x32B80402, 0x32D10402, 0x32B90402, 0x32D10402,
+    0x32BA0402, 0x32D10402, 0x32BB0402, 0x32D10402, 0x32BC0402, 0x32D10402, 0x32BD0402, 0x32D10402,
+    0x32BE0402, 0x32D10402, 0x32BF0402, 0x32D10402, 0x32C00402, 0x32D10402, 0x32C10402, 0x32D10402,
+    0x32C20402, 0x32D10402, 0x32C30402, 0x32D10402, 0x32C40402, 0x32D10402, 0x32C50402, 0x32D10402,
+    0x32960402, 0x32D20402, 0x32970402, 0x32D20402, 0x32980402, 0x32D20402, 0x32990402, 0x32D20402,
+    0x329A0402, 0x32D20402, 0x329B0402, 0x32D20402, 0x329C0402, 0x32D20402, 0x329D0402, 0x32D20402,
+    0x329E0402, 0x32D20402, 0x329F0402, 0x32D20402, 0x32A00402, 0x32D20402, 0x32A10402, 0x32D20402,
+    0x32A20402, 0x32D20402, 0x32A30402, 0x32D20402, 0x32A40402, 0x32D20402, 0x32A50402, 0x32D20402,
+    0x32A60402, 0x32D20402, 0x32A70402, 0x32D20402, 0x32A80402, 0x32D20402, 0x32A90402, 0x32D20402,
+    0x32AA0402, 0x32D20402, 0x32AB0402, 0x32D20402, 0x32AC0402, 0x32D20402, 0x32AD0402, 0x32D20402,
+    0x32AE0402, 0x32D20402, 0x32AF0402, 0x32D20402, 0x32B00402, 0x32D20402, 0x32B10402, 0x32D20402,
+    0x32B20402, 0x32D20402, 0x32B30402, 0x32D20402, 0x32B40402, 0x32D20402, 0x32B50402, 0x32D20402,
+    0x32B60402, 0x32D20402, 0x32B70402, 0x32D20402, 0x32B80402, 0x32D20402, 0x32B90402, 0x32D20402,
+    0x32BA0402, 0x32D20402, 0x32BB0402, 0x32D20402, 0x32BC0402, 0x32D20402, 0x32BD0402, 0x32D20402,
+    0x32BE0402, 0x32D20402, 0x32BF0402, 0x32D20402, 0x32C00402, 0x32D20402, 0x32C10402, 0x32D20402,
+    0x32C20402, 0x32D20402, 0x32C30402, 0x32D20402, 0x32C40402, 0x32D20402, 0x32C50402, 0x32D20402,
+    0x36DE0402, 0x370F0402, 0x36DF0402, 0x370F0402, 0x36E00402, 0x370F0402, 0x36E10402, 0x370F0402,
+    0x36E20402, 0x370F0402, 0x36E30402, 0x370F0402, 0x36E40402, 0x370F0402, 0x36E50402, 0x370F0402,
+    0x36E60402, 0x370F0402, 0x36E70402, 0x370F0402, 0x36E80402, 0x370F0402, 0x36E90402, 0x370F0402,
+    0x36EA0402, 0x370F0402, 0x36EB0402, 0x370F0402, 0x36EC0402, 0x370F0402, 0x36ED0402, 0x370F0402,
+    0x36EE0402, 0x370F0402, 0x36EF0402, 0x370F0402, 0x36F00402, 0x370F0402, 0x36F10402, 0x370F0402,
+    0x36F20402, 0x370F0402, 0x36F30402, 0x370F0402, 0x36F40402, 0x370F0402, 0x36F50402, 0x370F0402,
+    0x36F60402, 0x370F0402, 0x36F70402, 0x370F0402, 0x36F80402, 0x370F0402, 0x36F90402, 0x370F0402,
+    0x36FA0402, 0x370F0402, 0x36FB0402, 0x370F0402, 0x36FC0402, 0x370F0402, 0x36FD0402, 0x370F0402,
+    0x36FE0402, 0x370F0402, 0x36FF0402, 0x370F0402, 0x37000402, 0x370F0402, 0x37010402, 0x370F0402,
+    0x37020402, 0x370F0402, 0x37030402, 0x370F0402, 0x37040402, 0x370F0402, 0x37050402, 0x370F0402,
+    0x37060402, 0x370F0402, 0x37070402, 0x370F0402, 0x37080402, 0x370F0402, 0x37090402, 0x370F0402,
+    0x36DE0402, 0x37100402, 0x36DF0402, 0x37100402, 0x36E00402, 0x37100402, 0x36E10402, 0x37100402,
+    0x36E20402, 0x37100402, 0x36E30402, 0x37100402, 0x36E40402, 0x37100402, 0x36E50402, 0x37100402,
+    0x36E60402, 0x37100402, 0x36E70402, 0x37100402, 0x36E80402, 0x37100402, 0x36E90402, 0x37100402,
+    0x36EA0402, 0x37100402, 0x36EB0402, 0x37100402, 0x36EC0402, 0x37100402, 0x36ED0402, 0x37100402,
+    0x36EE0402, 0x37100402, 0x36EF0402, 0x37100402, 0x36F00402, 0x37100402, 0x36F10402, 0x37100402,
+    0x36F20402, 0x37100402, 0x36F30402, 0x37100402, 0x36F40402, 0x37100402, 0x36F50402, 0x37100402,
+    0x36F60402, 0x37100402, 0x36F70402, 0x37100402, 0x36F80402, 0x37100402, 0x36F90402, 0x37100402,
+    0x36FA0402, 0x37100402, 0x36FB0402, 0x37100402, 0x36FC0402, 0x37100402, 0x36FD0402, 0x37100402,
+    0x36FE0402, 0x37100402, 0x36FF0402, 0x37100402, 0x37000402, 0x37100402, 0x37010402, 0x37100402,
+    0x37020402, 0x37100402, 0x37030402, 0x37100402, 0x37040402, 0x37100402, 0x37050402, 0x37100402,
+    0x37060402, 0x37100402, 0x37070402, 0x37100402, 0x37080402, 0x37100402, 0x37090402, 0x37100402,
+    0x36DE0402, 0x37110402, 0x36DF0402, 0x37110402, 0x36E00402, 0x37110402, 0x36E10402, 0x37110402,
+    0x36E20402, 0x37110402, 0x36E30402, 0x37110402, 0x36E40402, 0x37110402, 0x36E50402, 0x37110402,
+    0x36E60402, 0x37110402, 0x36E70402, 0x37110402, 0x36E80402, 0x37110402, 0x36E90402, 0x37110402,
+    0x36EA0402, 0x37110402, 0x36EB0402, 0x37110402, 0x36EC0402, 0x37110402, 0x36ED0402, 0x37110402,
+    0x36EE0402, 0x37110402, 0x36EF0402, 0x37110402, 0x36F00402, 0x37110402, 0x36F10402, 0x37110402,
+    0x36F20402, 0x37110402, 0x36F30402, 0x37110402, 0x36F40402, 0x37110402, 0x36F50402, 0x37110402,
+    0x36F60402, 0x37110402, 0x36F70402, 0x37110402, 0x36F80402, 0x37110402, 0x36F90402, 0x37110402,
+    0x36FA0402, 0x37110402, 0x36FB0402, 0x37110402, 0x36FC0402, 0x37110402, 0x36FD0402, 0x37110402,
+    0x36FE0402, 0x37110402, 0x36FF0402, 0x37110402, 0x37000402, 0x37110402, 0x37010402, 0x37110402,
+    0x37020402, 0x37110402, 0x37030402, 0x37110402, 0x37040402, 0x37110402, 0x37050402, 0x37110402,
+    0x37060402, 0x37110402, 0x37070402, 0x37110402, 0x37080402, 0x37110402, 0x37090402, 0x37110402,
+    0x36DE0402, 0x37140402, 0x36DF0402, 0x37140402, 0x36E00402, 0x37140402, 0x36E10402, 0x37140402,
+    0x36E20402, 0x37140402, 0x36E30402, 0x37140402, 0x36E40402, 0x37140402, 0x36E50402, 0x37140402,
+    0x36E60402, 0x37140402, 0x36E70402, 0x37140402, 0x36E80402, 0x37140402, 0x36E90402, 0x37140402,
+    0x36EA0402, 0x37140402, 0x36EB0402, 0x37140402, 0x36EC0402, 0x37140402, 0x36ED0402, 0x37140402,
+    0x36EE0402, 0x37140402, 0x36EF0402, 0x37140402, 0x36F00402, 0x37140402, 0x36F10402, 0x37140402,
+    0x36F20402, 0x37140402, 0x36F30402, 0x37140402, 0x36F40402, 0x37140402, 0x36F50402, 0x37140402,
+    0x36F60402, 0x37140402, 0x36F70402, 0x37140402, 0x36F80402, 0x37140402, 0x36F90402, 0x37140402,
+    0x36FA0402, 0x37140402, 0x36FB0402, 0x37140402, 0x36FC0402, 0x37140402, 0x36FD0402, 0x37140402,
+    0x36FE0402, 0x37140402, 0x36FF0402, 0x37140402, 0x37000402, 0x37140402, 0x37010402, 0x37140402,
+    0x37020402, 0x37140402, 0x37030402, 0x37140402, 0x37040402, 0x37140402, 0x37050402, 0x37140402,
+    0x37060402, 0x37140402, 0x37070402, 0x37140402, 0x37080402, 0x37140402, 0x37090402, 0x37140402,
+};
+
+inline constexpr CollationContraction sCollationContractions[] = {
+    {{0x004C, 0x00B7, 0x0000}, 24964},
+    {{0x004C, 0x0387, 0x0000}, 24964},
+    {{0x006C, 0x00B7, 0x0000}, 25092},
+    {{0x006C, 0x0387, 0x0000}, 25092},
+    {{0x0418, 0x0306, 0x0000}, 83202},
+    {{0x0438, 0x0306, 0x0000}, 85250},
+    {{0x0627, 0x0653, 0x0000}, 114114},
+    {{0x0627, 0x0654, 0x0000}, 114178},
+    {{0x0627, 0x0655, 0x0000}, 114306},
+    {{0x0648, 0x0654, 0x0000}, 114242},
+    {{0x064A, 0x0654, 0x0000}, 114370},
+    {{0x09C7, 0x09BE, 0x0000}, 161538},
+    {{0x09C7, 0x09D7, 0x0000}, 161602},
+    {{0x0B47, 0x0B3E, 0x0000}, 176258},
+    {{0x0B47, 0x0B56, 0x0000}, 176194},
+    {{0x0B47, 0x0B57, 0x0000}, 176322},
+    {{0x0B92, 0x0BD7, 0x0000}, 178434},
+    {{0x0BC6, 0x0BBE, 0x0000}, 180482},
+    {{0x0BC6, 0x0BD7, 0x0000}, 180610},
+    {{0x0BC7, 0x0BBE, 0x0000}, 180546},
+    {{0x0C46, 0x0C56, 0x0000}, 185410},
+    {{0x0CBF, 0x0CD5, 0x0000}, 189890},
+    {{0x0CC6, 0x0CC2, 0x0000}, 190402},
+    {{0x0CC6, 0x0CC2, 0x0CD5}, 190466},
+    {{0x0CC6, 0x0CD5, 0x0000}, 190274},
+    {{0x0CC6, 0x0CD6, 0x0000}, 190338},
+    {{0x0CCA, 0x0CD5, 0x0000}, 190466},
+    {{0x0D46, 0x0D3E, 0x0000}, 195394},
+    {{0x0D46, 0x0D57, 0x0000}, 195522},
+    {{0x0D47, 0x0D3E, 0x0000}, 195458},
+    {{0x0DD9, 0x0DCA, 0x0000}, 202754},
+    {{0x0DD9, 0x0DCF, 0x0000}, 202882},
+    {{0x0DD9, 0x0DCF, 0x0DCA}, 202946},
+    {{0x0DD9, 0x0DDF, 0x0000}, 203010},
+    {{0x0DDC, 0x0DCA, 0x0000}, 202946},
+    {{0x0E40, 0x0E01, 0x0000}, 2152452},
+    {{0x0E40, 0x0E02, 0x0000}, 2152580},
+    {{0x0E40, 0x0E03, 0x0000}, 2152708},
+    {{0x0E40, 0x0E04, 0x0000}, 2152836},
+    {{0x0E40, 0x0E05, 0x0000}, 2152964},
+    {{0x0E40, 0x0E06, 0x0000}, 2153092},
+    {{0x0E40, 0x0E07, 0x0000}, 2153220},
+    {{0x0E40, 0x0E08, 0x0000}, 2153348},
+    {{0x0E40, 0x0E09, 0x0000}, 2153476},
+    {{0x0E40, 0x0E0A, 0x0000}, 2153604},
+    {{0x0E40, 0x0E0B, 0x0000}, 2153732},
+    {{0x0E40, 0x0E0C, 0x0000}, 2153860},
+    {{0x0E40, 0x0E0D, 0x0000}, 2153988},
+    {{0x0E40, 0x0E0E, 0x0000}, 2154116},
+    {{0x0E40, 0x0E0F, 0x0000}, 2154244},
+    {{0x0E40, 0x0E10, 0x0000}, 2154372},
+    {{0x0E40, 0x0E11, 0x0000}, 2154500},
+    {{0x0E40, 0x0E12, 0x0000}, 2154628},
+    {{0x0E40, 0x0E13, 0x0000}, 2154756},
+    {{0x0E40, 0x0E14, 0x0000}, 2154884},
+    {{0x0E40, 0x0E15, 0x0000}, 2155012},
+    {{0x0E40, 0x0E16, 0x0000}, 2155140},
+    {{0x0E40, 0x0E17, 0x0000}, 2155268},
+    {{0x0E40, 0x0E18, 0x0000}, 2155396},
+    {{0x0E40, 0x0E19, 0x0000}, 2155524},
+    {{0x0E40, 0x0E1A, 0x0000}, 2155652},
+    {{0x0E40, 0x0E1B, 0x0000}, 2155780},
+    {{0x0E40, 0x0E1C, 0x0000}, 2155908},
+    {{0x0E40, 0x0E1D, 0x0000}, 2156036},
+    {{0x0E40, 0x0E1E, 0x0000}, 2156164},
+    {{0x0E40, 0x0E1F, 0x0000}, 2156292},
+    {{0x0E40, 0x0E20, 0x0000}, 2156420},
+    {{0x0E40, 0x0E21, 0x0000}, 2156548},
+    {{0x0E40, 0x0E22, 0x0000}, 2156676},
+    {{0x0E40, 0x0E23, 0x0000}, 2156804},
+    {{0x0E40, 0x0E24, 0x0000}, 2156932},
+    {{0x0E40, 0x0E25, 0x0000}, 2157060},
+    {{0x0E40, 0x0E26, 0x0000}, 2157188},
+    {{0x0E40, 0x0E27, 0x0000}, 2157316},
+    {{0x0E40, 0x0E28, 0x0000}, 2157444},
+    {{0x0E40, 0x0E29, 0x0000}, 2157572},
+    {{0x0E40, 0x0E2A, 0x0000}, 2157700},
+    {{0x0E40, 0x0E2B, 0x0000}, 2157828},
+    {{0x0E40, 0x0E2C, 0x0000}, 2157956},
+    {{0x0E40, 0x0E2D, 0x0000}, 2158084},
+    {{0x0E40, 0x0E2E, 0x0000}, 2158212},
+    {{0x0E41, 0x0E01, 0x0000}, 2158340},
+    {{0x0E41, 0x0E02, 0x0000}, 2158468},
+    {{0x0E41, 0x0E03, 0x0000}, 2158596},
+    {{0x0E41, 0x0E04, 0x0000}, 2158724},
+    {{0x0E41, 0x0E05, 0x0000}, 2158852},
+    {{0x0E41, 0x0E06, 0x0000}, 2158980},
+    {{0x0E41, 0x0E07, 0x0000}, 2159108},
+    {{0x0E41, 0x0E08, 0x0000}, 2159236},
+    {{0x0E41, 0x0E09, 0x0000}, 2159364},
+    {{0x0E41, 0x0E0A, 0x0000}, 2159492},
+    {{0x0E41, 0x0E0B, 0x0000}, 2159620},
+    {{0x0E41, 0x0E0C, 0x0000}, 2159748},
+    {{0x0E41, 0x0E0D, 0x0000}, 2159876},
+    {{0x0E41, 0x0E0E, 0x0000}, 2160004},
+    {{0x0E41, 0x0E0F, 0x0000}, 2160132},
+    {{0x0E41, 0x0E10, 0x0000}, 2160260},
+    {{0x0E41, 0x0E11, 0x0000}, 2160388},
+    {{0x0E41, 0x0E12, 0x0000}, 2160516},
+    {{0x0E41, 0x0E13, 0x0000}, 2160644},
+    {{0x0E41, 0x0E14, 0x0000}, 2160772},
+    {{0x0E41, 0x0E15, 0x0000}, 2160900},
+    {{0x0E41, 0x0E16, 0x0000}, 2161028},
+    {{0x0E41, 0x0E17, 0x0000}, 2161156},
+    {{0x0E41, 0x0E18, 0x0000}, 2161284},
+    {{0x0E41, 0x0E19, 0x0000}, 2161412},
+    {{0x0E41, 0x0E1A, 0x0000}, 2161540},
+    {{0x0E41, 0x0E1B, 0x0000}, 2161668},
+    {{0x0E41, 0x0E1C, 0x0000}, 2161796},
+    {{0x0E41, 0x0E1D, 0x0000}, 2161924},
+    {{0x0E41, 0x0E1E, 0x0000}, 2162052},
+    {{0x0E41, 0x0E1F, 0x0000}, 2162180},
+    {{0x0E41, 0x0E20, 0x0000}, 2162308},
+    {{0x0E41, 0x0E21, 0x0000}, 2162436},
+    {{0x0E41, 0x0E22, 0x0000}, 2162564},
+    {{0x0E41, 0x0E23, 0x0000}, 2162692},
+    {{0x0E41, 0x0E24, 0x0000}, 2162820},
+    {{0x0E41, 0x0E25, 0x0000}, 2162948},
+    {{0x0E41, 0x0E26, 0x0000}, 2163076},
+    {{0x0E41, 0x0E27, 0x0000}, 2163204},
+    {{0x0E41, 0x0E28, 0x0000}, 2163332},
+    {{0x0E41, 0x0E29, 0x0000}, 2163460},
+    {{0x0E41, 0x0E2A, 0x0000}, 2163588},
+    {{0x0E41, 0x0E2B, 0x0000}, 2163716},
+    {{0x0E41, 0x0E2C, 0x0000}, 2163844},
+    {{0x0E41, 0x0E2D, 0x0000}, 2163972},
+    {{0x0E41, 0x0E2E, 0x0000}, 2164100},
+    {{0x0E42, 0x0E01, 0x0000}, 2164228},
+    {{0x0E42, 0x0E02, 0x0000}, 2164356},
+    {{0x0E42, 0x0E03, 0x0000}, 2164484},
+    {{0x0E42, 0x0E04, 0x0000}, 2164612},
+    {{0x0E42, 0x0E05, 0x0000}, 2164740},
+    {{0x0E42, 0x0E06, 0x0000}, 2164868},
+    {{0x0E42, 0x0E07, 0x0000}, 2164996},
+    {{0x0E42, 0x0E08, 0x0000}, 2165124},
+    {{0x0E42, 0x0E09, 0x0000}, 2165252},
+    {{0x0E42, 0x0E0A, 0x0000}, 2165380},
+    {{0x0E42, 0x0E0B, 0x0000}, 2165508},
+    {{0x0E42, 0x0E0C, 0x0000}, 2165636},
+    {{0x0E42, 0x0E0D, 0x0000}, 2165764},
+    {{0x0E42, 0x0E0E, 0x0000}, 2165892},
+    {{0x0E42, 0x0E0F, 0x0000}, 2166020},
+    {{0x0E42, 0x0E10, 0x0000}, 2166148},
+    {{0x0E42, 0x0E11, 0x0000}, 2166276},
+    {{0x0E42, 0x0E12, 0x0000}, 2166404},
+    {{0x0E42, 0x0E13, 0x0000}, 2166532},
+    {{0x0E42, 0x0E14, 0x0000}, 2166660},
+    {{0x0E42, 0x0E15, 0x0000}, 2166788},
+    {{0x0E42, 0x0E16, 0x0000}, 2166916},
+    {{0x0E42, 0x0E17, 0x0000}, 2167044},
+    {{0x0E42, 0x0E18, 0x0000}, 2167172},
+    {{0x0E42, 0x0E19, 0x0000}, 2167300},
+    {{0x0E42, 0x0E1A, 0x0000}, 2167428},
+    {{0x0E42, 0x0E1B, 0x0000}, 2167556},
+    {{0x0E42, 0x0E1C, 0x0000}, 2167684},
+    {{0x0E42, 0x0E1D, 0x0000}, 2167812},
+    {{0x0E42, 0x0E1E, 0x0000}, 2167940},
+    {{0x0E42, 0x0E1F, 0x0000}, 2168068},
+    {{0x0E42, 0x0E20, 0x0000}, 2168196},
+    {{0x0E42, 0x0E21, 0x0000}, 2168324},
+    {{0x0E42, 0x0E22, 0x0000}, 2168452},
+    {{0x0E42, 0x0E23, 0x0000}, 2168580},
+    {{0x0E42, 0x0E24, 0x0000}, 2168708},
+    {{0x0E42, 0x0E25, 0x0000}, 2168836},
+    {{0x0E42, 0x0E26, 0x0000}, 2168964},
+    {{0x0E42, 0x0E27, 0x0000}, 2169092},
+    {{0x0E42, 0x0E28, 0x0000}, 2169220},
+    {{0x0E42, 0x0E29, 0x0000}, 2169348},
+    {{0x0E42, 0x0E2A, 0x0000}, 2169476},
+    {{0x0E42, 0x0E2B, 0x0000}, 2169604},
+    {{0x0E42, 0x0E2C, 0x0000}, 2169732},
+    {{0x0E42, 0x0E2D, 0x0000}, 2169860},
+    {{0x0E42, 0x0E2E, 0x0000}, 2169988},
+    {{0x0E43, 0x0E01, 0x0000}, 2170116},
+    {{0x0E43, 0x0E02, 0x0000}, 2170244},
+    {{0x0E43, 0x0E03, 0x0000}, 2170372},
+    {{0x0E43, 0x0E04, 0x0000}, 2170500},
+    {{0x0E43, 0x0E05, 0x0000}, 2170628},
+    {{0x0E43, 0x0E06, 0x0000}, 2170756},
+    {{0x0E43, 0x0E07, 0x0000}, 2170884},
+    {{0x0E43, 0x0E08, 0x0000}, 2171012},
+    {{0x0E43, 0x0E09, 0x0000}, 2171140},
+    {{0x0E43, 0x0E0A, 0x0000}, 2171268},
+    {{0x0E43, 0x0E0B, 0x0000}, 2171396},
+    {{0x0E43, 0x0E0C, 0x0000}, 2171524},
+    {{0x0E43, 0x0E0D, 0x0000}, 2171652},
+    {{0x0E43, 0x0E0E, 0x0000}, 2171780},
+    {{0x0E43, 0x0E0F, 0x0000}, 2171908},
+    {{0x0E43, 0x0E10, 0x0000}, 2172036},
+    {{0x0E43, 0x0E11, 0x0000}, 2172164},
+    {{0x0E43, 0x0E12, 0x0000}, 2172292},
+    {{0x0E43, 0x0E13, 0x0000}, 2172420},
+    {{0x0E43, 0x0E14, 0x0000}, 2172548},
+    {{0x0E43, 0x0E15, 0x0000}, 2172676},
+    {{0x0E43, 0x0E16, 0x0000}, 2172804},
+    {{0x0E43, 0x0E17, 0x0000}, 2172932},
+    {{0x0E43, 0x0E18, 0x0000}, 2173060},
+    {{0x0E43, 0x0E19, 0x0000}, 2173188},
+    {{0x0E43, 0x0E1A, 0x0000}, 2173316},
+    {{0x0E43, 0x0E1B, 0x0000}, 2173444},
+    {{0x0E43, 0x0E1C, 0x0000}, 2173572},
+    {{0x0E43, 0x0E1D, 0x0000}, 2173700},
+    {{0x0E43, 0x0E1E, 0x0000}, 2173828},
+    {{0x0E43, 0x0E1F, 0x0000}, 2173956},
+    {{0x0E43, 0x0E20, 0x0000}, 2174084},
+    {{0x0E43, 0x0E21, 0x0000}, 2174212},
+    {{0x0E43, 0x0E22, 0x0000}, 2174340},
+    {{0x0E43, 0x0E23, 0x0000}, 2174468},
+    {{0x0E43, 0x0E24, 0x0000}, 2174596},
+    {{0x0E43, 0x0E25, 0x0000}, 2174724},
+    {{0x0E43, 0x0E26, 0x0000}, 2174852},
+    {{0x0E43, 0x0E27, 0x0000}, 2174980},
+    {{0x0E43, 0x0E28, 0x0000}, 2175108},
+    {{0x0E43, 0x0E29, 0x0000}, 2175236},
+    {{0x0E43, 0x0E2A, 0x0000}, 2175364},
+    {{0x0E43, 0x0E2B, 0x0000}, 2175492},
+    {{0x0E43, 0x0E2C, 0x0000}, 2175620},
+    {{0x0E43, 0x0E2D, 0x0000}, 2175748},
+    {{0x0E43, 0x0E2E, 0x0000}, 2175876},
+    {{0x0E44, 0x0E01, 0x0000}, 2176004},
+    {{0x0E44, 0x0E02, 0x0000}, 2176132},
+    {{0x0E44, 0x0E03, 0x0000}, 2176260},
+    {{0x0E44, 0x0E04, 0x0000}, 2176388},
+    {{0x0E44, 0x0E05, 0x0000}, 2176516},
+    {{0x0E44, 0x0E06, 0x0000}, 2176644},
+    {{0x0E44, 0x0E07, 0x0000}, 2176772},
+    {{0x0E44, 0x0E08, 0x0000}, 2176900},
+    {{0x0E44, 0x0E09, 0x0000}, 2177028},
+    {{0x0E44, 0x0E0A, 0x0000}, 2177156},
+    {{0x0E44, 0x0E0B, 0x0000}, 2177284},
+    {{0x0E44, 0x0E0C, 0x0000}, 2177412},
+    {{0x0E44, 0x0E0D, 0x0000}, 2177540},
+    {{0x0E44, 0x0E0E, 0x0000}, 2177668},
+    {{0x0E44, 0x0E0F, 0x0000}, 2177796},
+    {{0x0E44, 0x0E10, 0x0000}, 2177924},
+    {{0x0E44, 0x0E11, 0x0000}, 2178052},
+    {{0x0E44, 0x0E12, 0x0000}, 2178180},
+    {{0x0E44, 0x0E13, 0x0000}, 2178308},
+    {{0x0E44, 0x0E14, 0x0000}, 2178436},
+    {{0x0E44, 0x0E15, 0x0000}, 2178564},
+    {{0x0E44, 0x0E16, 0x0000}, 2178692},
+    {{0x0E44, 0x0E17, 0x0000}, 2178820},
+    {{0x0E44, 0x0E18, 0x0000}, 2178948},
+    {{0x0E44, 0x0E19, 0x0000}, 2179076},
+    {{0x0E44, 0x0E1A, 0x0000}, 2179204},
+    {{0x0E44, 0x0E1B, 0x0000}, 2179332},
+    {{0x0E44, 0x0E1C, 0x0000}, 2179460},
+    {{0x0E44, 0x0E1D, 0x0000}, 2179588},
+    {{0x0E44, 0x0E1E, 0x0000}, 2179716},
+    {{0x0E44, 0x0E1F, 0x0000}, 2179844},
+    {{0x0E44, 0x0E20, 0x0000}, 2179972},
+    {{0x0E44, 0x0E21, 0x0000}, 2180100},
+    {{0x0E44, 0x0E22, 0x0000}, 2180228},
+    {{0x0E44, 0x0E23, 0x0000}, 2180356},
+    {{0x0E44, 0x0E24, 0x0000}, 2180484},
+    {{0x0E44, 0x0E25, 0x0000}, 2180612},
+    {{0x0E44, 0x0E26, 0x0000}, 2180740},
+    {{0x0E44, 0x0E27, 0x0000}, 2180868},
+    {{0x0E44, 0x0E28, 0x0000}, 2180996},
+    {{0x0E44, 0x0E29, 0x0000}, 2181124},
+    {{0x0E44, 0x0E2A, 0x0000}, 2181252},
+    {{0x0E44, 0x0E2B, 0x0000}, 2181380},
+    {{0x0E44, 0x0E2C, 0x0000}, 2181508},
+    {{0x0E44, 0x0E2D, 0x0000}, 2181636},
+    {{0x0E44, 0x0E2E, 0x0000}, 2181764},
+    {{0x0E4D, 0x0E32, 0x0000}, 206530},
+    {{0x0EC0, 0x0E81, 0x0000}, 2181892},
+    {{0x0EC0, 0x0E82, 0x0000}, 2182020},
+    {{0x0EC0, 0x0E84, 0x0000}, 2182148},
+    {{0x0EC0, 0x0E86, 0x0000}, 2182276},
+    {{0x0EC0, 0x0E87, 0x0000}, 2182404},
+    {{0x0EC0, 0x0E88, 0x0000}, 2182532},
+    {{0x0EC0, 0x0E89, 0x0000}, 2182660},
+    {{0x0EC0, 0x0E8A, 0x0000}, 2182788},
+    {{0x0EC0, 0x0E8C, 0x0000}, 2182916},
+    {{0x0EC0, 0x0E8D, 0x0000}, 2183044},
+    {{0x0EC0, 0x0E8E, 0x0000}, 2183172},
+    {{0x0EC0, 0x0E8F, 0x0000}, 2183300},
+    {{0x0EC0, 0x0E90, 0x0000}, 2183428},
+    {{0x0EC0, 0x0E91, 0x0000}, 2183556},
+    {{0x0EC0, 0x0E92, 0x0000}, 2183684},
+    {{0x0EC0, 0x0E93, 0x0000}, 2183812},
+    {{0x0EC0, 0x0E94, 0x0000}, 2183940},
+    {{0x0EC0, 0x0E95, 0x0000}, 2184068},
+    {{0x0EC0, 0x0E96, 0x0000}, 2184196},
+    {{0x0EC0, 0x0E97, 0x0000}, 2184324},
+    {{0x0EC0, 0x0E98, 0x0000}, 2184452},
+    {{0x0EC0, 0x0E99, 0x0000}, 2184580},
+    {{0x0EC0, 0x0E9A, 0x0000}, 2184708},
+    {{0x0EC0, 0x0E9B, 0x0000}, 2184836},
+    {{0x0EC0, 0x0E9C, 0x0000}, 2184964},
+    {{0x0EC0, 0x0E9D, 0x0000}, 2185092},
+    {{0x0EC0, 0x0E9E, 0x0000}, 2185220},
+    {{0x0EC0, 0x0E9F, 0x0000}, 2185348},
+    {{0x0EC0, 0x0EA0, 0x0000}, 2185476},
+    {{0x0EC0, 0x0EA1, 0x0000}, 2185604},
+    {{0x0EC0, 0x0EA2, 0x0000}, 2185732},
+    {{0x0EC0, 0x0EA3, 0x0000}, 2185860},
+    {{0x0EC0, 0x0EA5, 0x0000}, 2185988},
+    {{0x0EC0, 0x0EA7, 0x0000}, 2186116},
+    {{0x0EC0, 0x0EA8, 0x0000}, 2186244},
+    {{0x0EC0, 0x0EA9, 0x0000}, 2186372},
+    {{0x0EC0, 0x0EAA, 0x0000}, 2186500},
+    {{0x0EC0, 0x0EAB, 0x0000}, 2186628},
+    {{0x0EC0, 0x0EAC, 0x0000}, 2186756},
+    {{0x0EC0, 0x0EAD, 0x0000}, 2186884},
+    {{0x0EC0, 0x0EAE, 0x0000}, 2187012},
+    {{0x0EC0, 0x0EDC, 0x0000}, 2187142},
+    {{0x0EC0, 0x0EDD, 0x0000}, 2187334},
+    {{0x0EC0, 0x0EDE, 0x0000}, 2187524},
+    {{0x0EC0, 0x0EDF, 0x0000}, 2187652},
+    {{0x0EC1, 0x0E81, 0x0000}, 2187780},
+    {{0x0EC1, 0x0E82, 0x0000}, 2187908},
+    {{0x0EC1, 0x0E84, 0x0000}, 2188036},
+    {{0x0EC1, 0x0E86, 0x0000}, 2188164},
+    {{0x0EC1, 0x0E87, 0x0000}, 2188292},
+    {{0x0EC1, 0x0E88, 0x0000}, 2188420},
+    {{0x0EC1, 0x0E89, 0x0000}, 2188548},
+    {{0x0EC1, 0x0E8A, 0x0000}, 2188676},
+    {{0x0EC1, 0x0E8C, 0x0000}, 2188804},
+    {{0x0EC1, 0x0E8D, 0x0000}, 2188932},
+    {{0x0EC1, 0x0E8E, 0x0000}, 2189060},
+    {{0x0EC1, 0x0E8F, 0x0000}, 2189188},
+    {{0x0EC1, 0x0E90, 0x0000}, 2189316},
+    {{0x0EC1, 0x0E91, 0x0000}, 2189444},
+    {{0x0EC1, 0x0E92, 0x0000}, 2189572},
+    {{0x0EC1, 0x0E93, 0x0000}, 2189700},
+    {{0x0EC1, 0x0E94, 0x0000}, 2189828},
+    {{0x0EC1, 0x0E95, 0x0000}, 2189956},
+    {{0x0EC1, 0x0E96, 0x0000}, 2190084},
+    {{0x0EC1, 0x0E97, 0x0000}, 2190212},
+    {{0x0EC1, 0x0E98, 0x0000}, 2190340},
+    {{0x0EC1, 0x0E99, 0x0000}, 2190468},
+    {{0x0EC1, 0x0E9A, 0x0000}, 2190596},
+    {{0x0EC1, 0x0E9B, 0x0000}, 2190724},
+    {{0x0EC1, 0x0E9C, 0x0000}, 2190852},
+    {{0x0EC1, 0x0E9D, 0x0000}, 2190980},
+    {{0x0EC1, 0x0E9E, 0x0000}, 2191108},
+    {{0x0EC1, 0x0E9F, 0x0000}, 2191236},
+    {{0x0EC1, 0x0EA0, 0x0000}, 2191364},
+    {{0x0EC1, 0x0EA1, 0x0000}, 2191492},
+    {{0x0EC1, 0x0EA2, 0x0000}, 2191620},
+    {{0x0EC1, 0x0EA3, 0x0000}, 2191748},
+    {{0x0EC1, 0x0EA5, 0x0000}, 2191876},
+    {{0x0EC1, 0x0EA7, 0x0000}, 2192004},
+    {{0x0EC1, 0x0EA8, 0x0000}, 2192132},
+    {{0x0EC1, 0x0EA9, 0x0000}, 2192260},
+    {{0x0EC1, 0x0EAA, 0x0000}, 2192388},
+    {{0x0EC1, 0x0EAB, 0x0000}, 2192516},
+    {{0x0EC1, 0x0EAC, 0x0000}, 2192644},
+    {{0x0EC1, 0x0EAD, 0x0000}, 2192772},
+    {{0x0EC1, 0x0EAE, 0x0000}, 2192900},
+    {{0x0EC1, 0x0EDC, 0x0000}, 2193030},
+    {{0x0EC1, 0x0EDD, 0x0000}, 2193222},
+    {{0x0EC1, 0x0EDE, 0x0000}, 2193412},
+    {{0x0EC1, 0x0EDF, 0x0000}, 2193540},
+    {{0x0EC2, 0x0E81, 0x0000}, 2193668},
+    {{0x0EC2, 0x0E82, 0x0000}, 2193796},
+    {{0x0EC2, 0x0E84, 0x0000}, 2193924},
+    {{0x0EC2, 0x0E86, 0x0000}, 2194052},
+    {{0x0EC2, 0x0E87, 0x0000}, 2194180},
+    {{0x0EC2, 0x0E88, 0x0000}, 2194308},
+    {{0x0EC2, 0x0E89, 0x0000}, 2194436},
+    {{0x0EC2, 0x0E8A, 0x0000}, 2194564},
+    {{0x0EC2, 0x0E8C, 0x0000}, 2194692},
+    {{0x0EC2, 0x0E8D, 0x0000}, 2194820},
+    {{0x0EC2, 0x0E8E, 0x0000}, 2194948},
+    {{0x0EC2, 0x0E8F, 0x0000}, 2195076},
+    {{0x0EC2, 0x0E90, 0x0000}, 2195204},
+    {{0x0EC2, 0x0E91, 0x0000}, 2195332},
+    {{0x0EC2, 0x0E92, 0x0000}, 2195460},
+    {{0x0EC2, 0x0E93, 0x0000}, 2195588},
+    {{0x0EC2, 0x0E94, 0x0000}, 2195716},
+    {{0x0EC2, 0x0E95, 0x0000}, 2195844},
+    {{0x0EC2, 0x0E96, 0x0000}, 2195972},
+    {{0x0EC2, 0x0E97, 0x0000}, 2196100},
+    {{0x0EC2, 0x0E98, 0x0000}, 2196228},
+    {{0x0EC2, 0x0E99, 0x0000}, 2196356},
+    {{0x0EC2, 0x0E9A, 0x0000}, 2196484},
+    {{0x0EC2, 0x0E9B, 0x0000}, 2196612},
+    {{0x0EC2, 0x0E9C, 0x0000}, 2196740},
+    {{0x0EC2, 0x0E9D, 0x0000}, 2196868},
+    {{0x0EC2, 0x0E9E, 0x0000}, 2196996},
+    {{0x0EC2, 0x0E9F, 0x0000}, 2197124},
+    {{0x0EC2, 0x0EA0, 0x0000}, 2197252},
+    {{0x0EC2, 0x0EA1, 0x0000}, 2197380},
+    {{0x0EC2, 0x0EA2, 0x0000}, 2197508},
+    {{0x0EC2, 0x0EA3, 0x0000}, 2197636},
+    {{0x0EC2, 0x0EA5, 0x0000}, 2197764},
+    {{0x0EC2, 0x0EA7, 0x0000}, 2197892},
+    {{0x0EC2, 0x0EA8, 0x0000}, 2198020},
+    {{0x0EC2, 0x0EA9, 0x0000}, 2198148},
+    {{0x0EC2, 0x0EAA, 0x0000}, 2198276},
+    {{0x0EC2, 0x0EAB, 0x0000}, 2198404},
+    {{0x0EC2, 0x0EAC, 0x0000}, 2198532},
+    {{0x0EC2, 0x0EAD, 0x0000}, 2198660},
+    {{0x0EC2, 0x0EAE, 0x0000}, 2198788},
+    {{0x0EC2, 0x0EDC, 0x0000}, 2198918},
+    {{0x0EC2, 0x0EDD, 0x0000}, 2199110},
+    {{0x0EC2, 0x0EDE, 0x0000}, 2199300},
+    {{0x0EC2, 0x0EDF, 0x0000}, 2199428},
+    {{0x0EC3, 0x0E81, 0x0000}, 2199556},
+    {{0x0EC3, 0x0E82, 0x0000}, 2199684},
+    {{0x0EC3, 0x0E84, 0x0000}, 2199812},
+    {{0x0EC3, 0x0E86, 0x0000}, 2199940},
+    {{0x0EC3, 0x0E87, 0x0000}, 2200068},
+    {{0x0EC3, 0x0E88, 0x0000}, 2200196},
+    {{0x0EC3, 0x0E89, 0x0000}, 2200324},
+    {{0x0EC3, 0x0E8A, 0x0000}, 2200452},
+    {{0x0EC3, 0x0E8C, 0x0000}, 2200580},
+    {{0x0EC3, 0x0E8D, 0x0000}, 2200708},
+    {{0x0EC3, 0x0E8E, 0x0000}, 2200836},
+    {{0x0EC3, 0x0E8F, 0x0000}, 2200964},
+    {{0x0EC3, 0x0E90, 0x0000}, 2201092},
+    {{0x0EC3, 0x0E91, 0x0000}, 2201220},
+    {{0x0EC3, 0x0E92, 0x0000}, 2201348},
+    {{0x0EC3, 0x0E93, 0x0000}, 2201476},
+    {{0x0EC3, 0x0E94, 0x0000}, 2201604},
+    {{0x0EC3, 0x0E95, 0x0000}, 2201732},
+    {{0x0EC3, 0x0E96, 0x0000}, 2201860},
+    {{0x0EC3, 0x0E97, 0x0000}, 2201988},
+    {{0x0EC3, 0x0E98, 0x0000}, 2202116},
+    {{0x0EC3, 0x0E99, 0x0000}, 2202244},
+    {{0x0EC3, 0x0E9A, 0x0000}, 2202372},
+    {{0x0EC3, 0x0E9B, 0x0000}, 2202500},
+    {{0x0EC3, 0x0E9C, 0x0000}, 2202628},
+    {{0x0EC3, 0x0E9D, 0x0000}, 2202756},
+    {{0x0EC3, 0x0E9E, 0x0000}, 2202884},
+    {{0x0EC3, 0x0E9F, 0x0000}, 2203012},
+    {{0x0EC3, 0x0EA0, 0x0000}, 2203140},
+    {{0x0EC3, 0x0EA1, 0x0000}, 2203268},
+    {{0x0EC3, 0x0EA2, 0x0000}, 2203396},
+    {{0x0EC3, 0x0EA3, 0x0000}, 2203524},
+    {{0x0EC3, 0x0EA5, 0x0000}, 2203652},
+    {{0x0EC3, 0x0EA7, 0x0000}, 2203780},
+    {{0x0EC3, 0x0EA8, 0x0000}, 2203908},
+    {{0x0EC3, 0x0EA9, 0x0000}, 2204036},
+    {{0x0EC3, 0x0EAA, 0x0000}, 2204164},
+    {{0x0EC3, 0x0EAB, 0x0000}, 2204292},
+    {{0x0EC3, 0x0EAC, 0x0000}, 2204420},
+    {{0x0EC3, 0x0EAD, 0x0000}, 2204548},
+    {{0x0EC3, 0x0EAE, 0x0000}, 2204676},
+    {{0x0EC3, 0x0EDC, 0x0000}, 2204806},
+    {{0x0EC3, 0x0EDD, 0x0000}, 2204998},
+    {{0x0EC3, 0x0EDE, 0x0000}, 2205188},
+    {{0x0EC3, 0x0EDF, 0x0000}, 2205316},
+    {{0x0EC4, 0x0E81, 0x0000}, 2205444},
+    {{0x0EC4, 0x0E82, 0x0000}, 2205572},
+    {{0x0EC4, 0x0E84, 0x0000}, 2205700},
+    {{0x0EC4, 0x0E86, 0x0000}, 2205828},
+    {{0x0EC4, 0x0E87, 0x0000}, 2205956},
+    {{0x0EC4, 0x0E88, 0x0000}, 2206084},
+    {{0x0EC4, 0x0E89, 0x0000}, 2206212},
+    {{0x0EC4, 0x0E8A, 0x0000}, 2206340},
+    {{0x0EC4, 0x0E8C, 0x0000}, 2206468},
+    {{0x0EC4, 0x0E8D, 0x0000}, 2206596},
+    {{0x0EC4, 0x0E8E, 0x0000}, 2206724},
+    {{0x0EC4, 0x0E8F, 0x0000}, 2206852},
+    {{0x0EC4, 0x0E90, 0x0000}, 2206980},
+    {{0x0EC4, 0x0E91, 0x0000}, 2207108},
+    {{0x0EC4, 0x0E92, 0x0000}, 2207236},
+    {{0x0EC4, 0x0E93, 0x0000}, 2207364},
+    {{0x0EC4, 0x0E94, 0x0000}, 2207492},
+    {{0x0EC4, 0x0E95, 0x0000}, 2207620},
+    {{0x0EC4, 0x0E96, 0x0000}, 2207748},
+    {{0x0EC4, 0x0E97, 0x0000}, 2207876},
+    {{0x0EC4, 0x0E98, 0x0000}, 2208004},
+    {{0x0EC4, 0x0E99, 0x0000}, 2208132},
+    {{0x0EC4, 0x0E9A, 0x0000}, 2208260},
+    {{0x0EC4, 0x0E9B, 0x0000}, 2208388},
+    {{0x0EC4, 0x0E9C, 0x0000}, 2208516},
+    {{0x0EC4, 0x0E9D, 0x0000}, 2208644},
+    {{0x0EC4, 0x0E9E, 0x0000}, 2208772},
+    {{0x0EC4, 0x0E9F, 0x0000}, 2208900},
+    {{0x0EC4, 0x0EA0, 0x0000}, 2209028},
+    {{0x0EC4, 0x0EA1, 0x0000}, 2209156},
+    {{0x0EC4, 0x0EA2, 0x0000}, 2209284},
+    {{0x0EC4, 0x0EA3, 0x0000}, 2209412},
+    {{0x0EC4, 0x0EA5, 0x0000}, 2209540},
+    {{0x0EC4, 0x0EA7, 0x0000}, 2209668},
+    {{0x0EC4, 0x0EA8, 0x0000}, 2209796},
+    {{0x0EC4, 0x0EA9, 0x0000}, 2209924},
+    {{0x0EC4, 0x0EAA, 0x0000}, 2210052},
+    {{0x0EC4, 0x0EAB, 0x0000}, 2210180},
+    {{0x0EC4, 0x0EAC, 0x0000}, 2210308},
+    {{0x0EC4, 0x0EAD, 0x0000}, 2210436},
+    {{0x0EC4, 0x0EAE, 0x0000}, 2210564},
+    {{0x0EC4, 0x0EDC, 0x0000}, 2210694},
+    {{0x0EC4, 0x0EDD, 0x0000}, 2210886},
+    {{0x0EC4, 0x0EDE, 0x0000}, 2211076},
+    {{0x0EC4, 0x0EDF, 0x0000}, 2211204},
+    {{0x0ECD, 0x0EB2, 0x0000}, 211138},
+    {{0x0F71, 0x0F72, 0x0000}, 219586},
+    {{0x0F71, 0x0F74, 0x0000}, 219714},
+    {{0x0F71, 0x0F80, 0x0000}, 220354},
+    {{0x0FB2, 0x0F71, 0x0F80}, 219842},
+    {{0x0FB2, 0x0F80, 0x0000}, 219778},
+    {{0x0FB2, 0x0F81, 0x0000}, 219842},
+    {{0x0FB3, 0x0F71, 0x0F80}, 219970},
+    {{0x0FB3, 0x0F80, 0x0000}, 219906},
+    {{0x0FB3, 0x0F81, 0x0000}, 219970},
+    {{0x1025, 0x102E, 0x0000}, 228610},
+    {{0x19B5, 0x1980, 0x0000}, 2242052},
+    {{0x19B5, 0x1981, 0x0000}, 2242180},
+    {{0x19B5, 0x1982, 0x0000}, 2242308},
+    {{0x19B5, 0x1983, 0x0000}, 2242436},
+    {{0x19B5, 0x1984, 0x0000}, 2242564},
+    {{0x19B5, 0x1985, 0x0000}, 2242692},
+    {{0x19B5, 0x1986, 0x0000}, 2242820},
+    {{0x19B5, 0x1987, 0x0000}, 2242948},
+    {{0x19B5, 0x1988, 0x0000}, 2243076},
+    {{0x19B5, 0x1989, 0x0000}, 2243204},
+    {{0x19B5, 0x198A, 0x0000}, 2243332},
+    {{0x19B5, 0x198B, 0x0000}, 2243460},
+    {{0x19B5, 0x198C, 0x0000}, 2243588},
+    {{0x19B5, 0x198D, 0x0000}, 2243716},
+    {{0x19B5, 0x198E, 0x0000}, 2243844},
+    {{0x19B5, 0x198F, 0x0000}, 2243972},
+    {{0x19B5, 0x1990, 0x0000}, 2244100},
+    {{0x19B5, 0x1991, 0x0000}, 2244228},
+    {{0x19B5, 0x1992, 0x0000}, 2244356},
+    {{0x19B5, 0x1993, 0x0000}, 2244484},
+    {{0x19B5, 0x1994, 0x0000}, 2244612},
+    {{0x19B5, 0x1995, 0x0000}, 2244740},
+    {{0x19B5, 0x1996, 0x0000}, 2244868},
+    {{0x19B5, 0x1997, 0x0000}, 2244996},
+    {{0x19B5, 0x1998, 0x0000}, 2245124},
+    {{0x19B5, 0x1999, 0x0000}, 2245252},
+    {{0x19B5, 0x199A, 0x0000}, 2245380},
+    {{0x19B5, 0x199B, 0x0000}, 2245508},
+    {{0x19B5, 0x199C, 0x0000}, 2245636},
+    {{0x19B5, 0x199D, 0x0000}, 2245764},
+    {{0x19B5, 0x199E, 0x0000}, 2245892},
+    {{0x19B5, 0x199F, 0x0000}, 2246020},
+    {{0x19B5, 0x19A0, 0x0000}, 2246148},
+    {{0x19B5, 0x19A1, 0x0000}, 2246276},
+    {{0x19B5, 0x19A2, 0x0000}, 2246404},
+    {{0x19B5, 0x19A3, 0x0000}, 2246532},
+    {{0x19B5, 0x19A4, 0x0000}, 2246660},
+    {{0x19B5, 0x19A5, 0x0000}, 2246788},
+    {{0x19B5, 0x19A6, 0x0000}, 2246916},
+    {{0x19B5, 0x19A7, 0x0000}, 2247044},
+    {{0x19B5, 0x19A8, 0x0000}, 2247172},
+    {{0x19B5, 0x19A9, 0x0000}, 2247300},
+    {{0x19B5, 0x19AA, 0x0000}, 2247428},
+    {{0x19B5, 0x19AB, 0x0000}, 2247556},
+    {{0x19B6, 0x1980, 0x0000}, 2247684},
+    {{0x19B6, 0x1981, 0x0000}, 2247812},
+    {{0x19B6, 0x1982, 0x0000}, 2247940},
+    {{0x19B6, 0x1983, 0x0000}, 2248068},
+    {{0x19B6, 0x1984, 0x0000}, 2248196},
+    {{0x19B6, 0x1985, 0x0000}, 2248324},
+    {{0x19B6, 0x1986, 0x0000}, 2248452},
+    {{0x19B6, 0x1987, 0x0000}, 2248580},
+    {{0x19B6, 0x1988, 0x0000}, 2248708},
+    {{0x19B6, 0x1989, 0x0000}, 2248836},
+    {{0x19B6, 0x198A, 0x0000}, 2248964},
+    {{0x19B6, 0x198B, 0x0000}, 2249092},
+    {{0x19B6, 0x198C, 0x0000}, 2249220},
+    {{0x19B6, 0x198D, 0x0000}, 2249348},
+    {{0x19B6, 0x198E, 0x0000}, 2249476},
+    {{0x19B6, 0x198F, 0x0000}, 2249604},
+    {{0x19B6, 0x1990, 0x0000}, 2249732},
+    {{0x19B6, 0x1991, 0x0000}, 2249860},
+    {{0x19B6, 0x1992, 0x0000}, 2249988},
+    {{0x19B6, 0x1993, 0x0000}, 2250116},
+    {{0x19B6, 0x1994, 0x0000}, 2250244},
+    {{0x19B6, 0x1995, 0x0000}, 2250372},
+    {{0x19B6, 0x1996, 0x0000}, 2250500},
+    {{0x19B6, 0x1997, 0x0000}, 2250628},
+    {{0x19B6, 0x1998, 0x0000}, 2250756},
+    {{0x19B6, 0x1999, 0x0000}, 2250884},
+    {{0x19B6, 0x199A, 0x0000}, 2251012},
+    {{0x19B6, 0x199B, 0x0000}, 2251140},
+    {{0x19B6, 0x199C, 0x0000}, 2251268},
+    {{0x19B6, 0x199D, 0x0000}, 2251396},
+    {{0x19B6, 0x199E, 0x0000}, 2251524},
+    {{0x19B6, 0x199F, 0x0000}, 2251652},
+    {{0x19B6, 0x19A0, 0x0000}, 2251780},
+    {{0x19B6, 0x19A1, 0x0000}, 2251908},
+    {{0x19B6, 0x19A2, 0x0000}, 2252036},
+    {{0x19B6, 0x19A3, 0x0000}, 2252164},
+    {{0x19B6, 0x19A4, 0x0000}, 2252292},
+    {{0x19B6, 0x19A5, 0x0000}, 2252420},
+    {{0x19B6, 0x19A6, 0x0000}, 2252548},
+    {{0x19B6, 0x19A7, 0x0000}, 2252676},
+    {{0x19B6, 0x19A8, 0x0000}, 2252804},
+    {{0x19B6, 0x19A9, 0x0000}, 2252932},
+    {{0x19B6, 0x19AA, 0x0000}, 2253060},
+    {{0x19B6, 0x19AB, 0x0000}, 2253188},
+    {{0x19B7, 0x1980, 0x0000}, 2253316},
+    {{0x19B7, 0x1981, 0x0000}, 2253444},
+    {{0x19B7, 0x1982, 0x0000}, 2253572},
+    {{0x19B7, 0x1983, 0x0000}, 2253700},
+    {{0x19B7, 0x1984, 0x0000}, 2253828},
+    {{0x19B7, 0x1985, 0x0000}, 2253956},
+    {{0x19B7, 0x1986, 0x0000}, 2254084},
+    {{0x19B7, 0x1987, 0x0000}, 2254212},
+    {{0x19B7, 0x1988, 0x0000}, 2254340},
+    {{0x19B7, 0x1989, 0x0000}, 2254468},
+    {{0x19B7, 0x198A, 0x0000}, 2254596},
+    {{0x19B7, 0x198B, 0x0000}, 2254724},
+    {{0x19B7, 0x198C, 0x0000}, 2254852},
+    {{0x19B7, 0x198D, 0x0000}, 2254980},
+    {{0x19B7, 0x198E, 0x0000}, 2255108},
+    {{0x19B7, 0x198F, 0x0000}, 2255236},
+    {{0x19B7, 0x1990, 0x0000}, 2255364},
+    {{0x19B7, 0x1991, 0x0000}, 2255492},
+    {{0x19B7, 0x1992, 0x0000}, 2255620},
+    {{0x19B7, 0x1993, 0x0000}, 2255748},
+    {{0x19B7, 0x1994, 0x0000}, 2255876},
+    {{0x19B7, 0x1995, 0x0000}, 2256004},
+    {{0x19B7, 0x1996, 0x0000}, 2256132},
+    {{0x19B7, 0x1997, 0x0000}, 2256260},
+    {{0x19B7, 0x1998, 0x0000}, 2256388},
+    {{0x19B7, 0x1999, 0x0000}, 2256516},
+    {{0x19B7, 0x199A, 0x0000}, 2256644},
+    {{0x19B7, 0x199B, 0x0000}, 2256772},
+    {{0x19B7, 0x199C, 0x0000}, 2256900},
+    {{0x19B7, 0x199D, 0x0000}, 2257028},
+    {{0x19B7, 0x199E, 0x0000}, 2257156},
+    {{0x19B7, 0x199F, 0x0000}, 2257284},
+    {{0x19B7, 0x19A0, 0x0000}, 2257412},
+    {{0x19B7, 0x19A1, 0x0000}, 2257540},
+    {{0x19B7, 0x19A2, 0x0000}, 2257668},
+    {{0x19B7, 0x19A3, 0x0000}, 2257796},
+    {{0x19B7, 0x19A4, 0x0000}, 2257924},
+    {{0x19B7, 0x19A5, 0x0000}, 2258052},
+    {{0x19B7, 0x19A6, 0x0000}, 2258180},
+    {{0x19B7, 0x19A7, 0x0000}, 2258308},
+    {{0x19B7, 0x19A8, 0x0000}, 2258436},
+    {{0x19B7, 0x19A9, 0x0000}, 2258564},
+    {{0x19B7, 0x19AA, 0x0000}, 2258692},
+    {{0x19B7, 0x19AB, 0x0000}, 2258820},
+    {{0x19BA, 0x1980, 0x0000}, 2258948},
+    {{0x19BA, 0x1981, 0x0000}, 2259076},
+    {{0x19BA, 0x1982, 0x0000}, 2259204},
+    {{0x19BA, 0x1983, 0x0000}, 2259332},
+    {{0x19BA, 0x1984, 0x0000}, 2259460},
+    {{0x19BA, 0x1985, 0x0000}, 2259588},
+    {{0x19BA, 0x1986, 0x0000}, 2259716},
+    {{0x19BA, 0x1987, 0x0000}, 2259844},
+    {{0x19BA, 0x1988, 0x0000}, 2259972},
+    {{0x19BA, 0x1989, 0x0000}, 2260100},
+    {{0x19BA, 0x198A, 0x0000}, 2260228},
+    {{0x19BA, 0x198B, 0x0000}, 2260356},
+    {{0x19BA, 0x198C, 0x0000}, 2260484},
+    {{0x19BA, 0x198D, 0x0000}, 2260612},
+    {{0x19BA, 0x198E, 0x0000}, 2260740},
+    {{0x19BA, 0x198F, 0x0000}, 2260868},
+    {{0x19BA, 0x1990, 0x0000}, 2260996},
+    {{0x19BA, 0x1991, 0x0000}, 2261124},
+    {{0x19BA, 0x1992, 0x0000}, 2261252},
+    {{0x19BA, 0x1993, 0x0000}, 2261380},
+    {{0x19BA, 0x1994, 0x0000}, 2261508},
+    {{0x19BA, 0x1995, 0x0000}, 2261636},
+    {{0x19BA, 0x1996, 0x0000}, 2261764},
+    {{0x19BA, 0x1997, 0x0000}, 2261892},
+    {{0x19BA, 0x1998, 0x0000}, 2262020},
+    {{0x19BA, 0x1999, 0x0000}, 2262148},
+    {{0x19BA, 0x199A, 0x0000}, 2262276},
+    {{0x19BA, 0x199B, 0x0000}, 2262404},
+    {{0x19BA, 0x199C, 0x0000}, 2262532},
+    {{0x19BA, 0x199D, 0x0000}, 2262660},
+    {{0x19BA, 0x199E, 0x0000}, 2262788},
+    {{0x19BA, 0x199F, 0x0000}, 2262916},
+    {{0x19BA, 0x19A0, 0x0000}, 2263044},
+    {{0x19BA, 0x19A1, 0x0000}, 2263172},
+    {{0x19BA, 0x19A2, 0x0000}, 2263300},
+    {{0x19BA, 0x19A3, 0x0000}, 2263428},
+    {{0x19BA, 0x19A4, 0x0000}, 2263556},
+    {{0x19BA, 0x19A5, 0x0000}, 2263684},
+    {{0x19BA, 0x19A6, 0x0000}, 2263812},
+    {{0x19BA, 0x19A7, 0x0000}, 2263940},
+    {{0x19BA, 0x19A8, 0x0000}, 2264068},
+    {{0x19BA, 0x19A9, 0x0000}, 2264196},
+    {{0x19BA, 0x19AA, 0x0000}, 2264324},
+    {{0x19BA, 0x19AB, 0x0000}, 2264452},
+    {{0x1B05, 0x1B35, 0x0000}, 384066},
+    {{0x1B07, 0x1B35, 0x0000}, 384194},
+    {{0x1B09, 0x1B35, 0x0000}, 384322},
+    {{0x1B0B, 0x1B35, 0x0000}, 384450},
+    {{0x1B0D, 0x1B35, 0x0000}, 384578},
+    {{0x1B11, 0x1B35, 0x0000}, 384834},
+    {{0x1B3A, 0x1B35, 0x0000}, 387394},
+    {{0x1B3C, 0x1B35, 0x0000}, 387522},
+    {{0x1B3E, 0x1B35, 0x0000}, 387714},
+    {{0x1B3F, 0x1B35, 0x0000}, 387778},
+    {{0x1B42, 0x1B35, 0x0000}, 387906},
+    {{0xAAB5, 0xAA80, 0x0000}, 2211332},
+    {{0xAAB5, 0xAA81, 0x0000}, 2211460},
+    {{0xAAB5, 0xAA82, 0x0000}, 2211588},
+    {{0xAAB5, 0xAA83, 0x0000}, 2211716},
+    {{0xAAB5, 0xAA84, 0x0000}, 2211844},
+    {{0xAAB5, 0xAA85, 0x0000}, 2211972},
+    {{0xAAB5, 0xAA86, 0x0000}, 2212100},
+    {{0xAAB5, 0xAA87, 0x0000}, 2212228},
+    {{0xAAB5, 0xAA88, 0x0000}, 2212356},
+    {{0xAAB5, 0xAA89, 0x0000}, 2212484},
+    {{0xAAB5, 0xAA8A, 0x0000}, 2212612},
+    {{0xAAB5, 0xAA8B, 0x0000}, 2212740},
+    {{0xAAB5, 0xAA8C, 0x0000}, 2212868},
+    {{0xAAB5, 0xAA8D, 0x0000}, 2212996},
+    {{0xAAB5, 0xAA8E, 0x0000}, 2213124},
+    {{0xAAB5, 0xAA8F, 0x0000}, 2213252},
+    {{0xAAB5, 0xAA90, 0x0000}, 2213380},
+    {{0xAAB5, 0xAA91, 0x0000}, 2213508},
+    {{0xAAB5, 0xAA92, 0x0000}, 2213636},
+    {{0xAAB5, 0xAA93, 0x0000}, 2213764},
+    {{0xAAB5, 0xAA94, 0x0000}, 2213892},
+    {{0xAAB5, 0xAA95, 0x0000}, 2214020},
+    {{0xAAB5, 0xAA96, 0x0000}, 2214148},
+    {{0xAAB5, 0xAA97, 0x0000}, 2214276},
+    {{0xAAB5, 0xAA98, 0x0000}, 2214404},
+    {{0xAAB5, 0xAA99, 0x0000}, 2214532},
+    {{0xAAB5, 0xAA9A, 0x0000}, 2214660},
+    {{0xAAB5, 0xAA9B, 0x0000}, 2214788},
+    {{0xAAB5, 0xAA9C, 0x0000}, 2214916},
+    {{0xAAB5, 0xAA9D, 0x0000}, 2215044},
+    {{0xAAB5, 0xAA9E, 0x0000}, 2215172},
+    {{0xAAB5, 0xAA9F, 0x0000}, 2215300},
+    {{0xAAB5, 0xAAA0, 0x0000}, 2215428},
+    {{0xAAB5, 0xAAA1, 0x0000}, 2215556},
+    {{0xAAB5, 0xAAA2, 0x0000}, 2215684},
+    {{0xAAB5, 0xAAA3, 0x0000}, 2215812},
+    {{0xAAB5, 0xAAA4, 0x0000}, 2215940},
+    {{0xAAB5, 0xAAA5, 0x0000}, 2216068},
+    {{0xAAB5, 0xAAA6, 0x0000}, 2216196},
+    {{0xAAB5, 0xAAA7, 0x0000}, 2216324},
+    {{0xAAB5, 0xAAA8, 0x0000}, 2216452},
+    {{0xAAB5, 0xAAA9, 0x0000}, 2216580},
+    {{0xAAB5, 0xAAAA, 0x0000}, 2216708},
+    {{0xAAB5, 0xAAAB, 0x0000}, 2216836},
+    {{0xAAB5, 0xAAAC, 0x0000}, 2216964},
+    {{0xAAB5, 0xAAAD, 0x0000}, 2217092},
+    {{0xAAB5, 0xAAAE, 0x0000}, 2217220},
+    {{0xAAB5, 0xAAAF, 0x0000}, 2217348},
+    {{0xAAB6, 0xAA80, 0x0000}, 2217476},
+    {{0xAAB6, 0xAA81, 0x0000}, 2217604},
+    {{0xAAB6, 0xAA82, 0x0000}, 2217732},
+    {{0xAAB6, 0xAA83, 0x0000}, 2217860},
+    {{0xAAB6, 0xAA84, 0x0000}, 2217988},
+    {{0xAAB6, 0xAA85, 0x0000}, 2218116},
+    {{0xAAB6, 0xAA86, 0x0000}, 2218244},
+    {{0xAAB6, 0xAA87, 0x0000}, 2218372},
+    {{0xAAB6, 0xAA88, 0x0000}, 2218500},
+    {{0xAAB6, 0xAA89, 0x0000}, 2218628},
+    {{0xAAB6, 0xAA8A, 0x0000}, 2218756},
+    {{0xAAB6, 0xAA8B, 0x0000}, 2218884},
+    {{0xAAB6, 0xAA8C, 0x0000}, 2219012},
+    {{0xAAB6, 0xAA8D, 0x0000}, 2219140},
+    {{0xAAB6, 0xAA8E, 0x0000}, 2219268},
+    {{0xAAB6, 0xAA8F, 0x0000}, 2219396},
+    {{0xAAB6, 0xAA90, 0x0000}, 2219524},
+    {{0xAAB6, 0xAA91, 0x0000}, 2219652},
+    {{0xAAB6, 0xAA92, 0x0000}, 2219780},
+    {{0xAAB6, 0xAA93, 0x0000}, 2219908},
+    {{0xAAB6, 0xAA94, 0x0000}, 2220036},
+    {{0xAAB6, 0xAA95, 0x0000}, 2220164},
+    {{0xAAB6, 0xAA96, 0x0000}, 2220292},
+    {{0xAAB6, 0xAA97, 0x0000}, 2220420},
+    {{0xAAB6, 0xAA98, 0x0000}, 2220548},
+    {{0xAAB6, 0xAA99, 0x0000}, 2220676},
+    {{0xAAB6, 0xAA9A, 0x0000}, 2220804},
+    {{0xAAB6, 0xAA9B, 0x0000}, 2220932},
+    {{0xAAB6, 0xAA9C, 0x0000}, 2221060},
+    {{0xAAB6, 0xAA9D, 0x0000}, 2221188},
+    {{0xAAB6, 0xAA9E, 0x0000}, 2221316},
+    {{0xAAB6, 0xAA9F, 0x0000}, 2221444},
+    {{0xAAB6, 0xAAA0, 0x0000}, 2221572},
+    {{0xAAB6, 0xAAA1, 0x0000}, 2221700},
+    {{0xAAB6, 0xAAA2, 0x0000}, 2221828},
+    {{0xAAB6, 0xAAA3, 0x0000}, 2221956},
+    {{0xAAB6, 0xAAA4, 0x0000}, 2222084},
+    {{0xAAB6, 0xAAA5, 0x0000}, 2222212},
+    {{0xAAB6, 0xAAA6, 0x0000}, 2222340},
+    {{0xAAB6, 0xAAA7, 0x0000}, 2222468},
+    {{0xAAB6, 0xAAA8, 0x0000}, 2222596},
+    {{0xAAB6, 0xAAA9, 0x0000}, 2222724},
+    {{0xAAB6, 0xAAAA, 0x0000}, 2222852},
+    {{0xAAB6, 0xAAAB, 0x0000}, 2222980},
+    {{0xAAB6, 0xAAAC, 0x0000}, 2223108},
+    {{0xAAB6, 0xAAAD, 0x0000}, 2223236},
+    {{0xAAB6, 0xAAAE, 0x0000}, 2223364},
+    {{0xAAB6, 0xAAAF, 0x0000}, 2223492},
+    {{0xAAB9, 0xAA80, 0x0000}, 2223620},
+    {{0xAAB9, 0xAA81, 0x0000}, 2223748},
+    {{0xAAB9, 0xAA82, 0x0000}, 2223876},
+    {{0xAAB9, 0xAA83, 0x0000}, 2224004},
+    {{0xAAB9, 0xAA84, 0x0000}, 2224132},
+    {{0xAAB9, 0xAA85, 0x0000}, 2224260},
+    {{0xAAB9, 0xAA86, 0x0000}, 2224388},
+    {{0xAAB9, 0xAA87, 0x0000}, 2224516},
+    {{0xAAB9, 0xAA88, 0x0000}, 2224644},
+    {{0xAAB9, 0xAA89, 0x0000}, 2224772},
+    {{0xAAB9, 0xAA8A, 0x0000}, 2224900},
+    {{0xAAB9, 0xAA8B, 0x0000}, 2225028},
+    {{0xAAB9, 0xAA8C, 0x0000}, 2225156},
+    {{0xAAB9, 0xAA8D, 0x0000}, 2225284},
+    {{0xAAB9, 0xAA8E, 0x0000}, 2225412},
+    {{0xAAB9, 0xAA8F, 0x0000}, 2225540},
+    {{0xAAB9, 0xAA90, 0x0000}, 2225668},
+    {{0xAAB9, 0xAA91, 0x0000}, 2225796},
+    {{0xAAB9, 0xAA92, 0x0000}, 2225924},
+    {{0xAAB9, 0xAA93, 0x0000}, 2226052},
+    {{0xAAB9, 0xAA94, 0x0000}, 2226180},
+    {{0xAAB9, 0xAA95, 0x0000}, 2226308},
+    {{0xAAB9, 0xAA96, 0x0000}, 2226436},
+    {{0xAAB9, 0xAA97, 0x0000}, 2226564},
+    {{0xAAB9, 0xAA98, 0x0000}, 2226692},
+    {{0xAAB9, 0xAA99, 0x0000}, 2226820},
+    {{0xAAB9, 0xAA9A, 0x0000}, 2226948},
+    {{0xAAB9, 0xAA9B, 0x0000}, 2227076},
+    {{0xAAB9, 0xAA9C, 0x0000}, 2227204},
+    {{0xAAB9, 0xAA9D, 0x0000}, 2227332},
+    {{0xAAB9, 0xAA9E, 0x0000}, 2227460},
+    {{0xAAB9, 0xAA9F, 0x0000}, 2227588},
+    {{0xAAB9, 0xAAA0, 0x0000}, 2227716},
+    {{0xAAB9, 0xAAA1, 0x0000}, 2227844},
+    {{0xAAB9, 0xAAA2, 0x0000}, 2227972},
+    {{0xAAB9, 0xAAA3, 0x0000}, 2228100},
+    {{0xAAB9, 0xAAA4, 0x0000}, 2228228},
+    {{0xAAB9, 0xAAA5, 0x0000}, 2228356},
+    {{0xAAB9, 0xAAA6, 0x0000}, 2228484},
+    {{0xAAB9, 0xAAA7, 0x0000}, 2228612},
+    {{0xAAB9, 0xAAA8, 0x0000}, 2228740},
+    {{0xAAB9, 0xAAA9, 0x0000}, 2228868},
+    {{0xAAB9, 0xAAAA, 0x0000}, 2228996},
+    {{0xAAB9, 0xAAAB, 0x0000}, 2229124},
+    {{0xAAB9, 0xAAAC, 0x0000}, 2229252},
+    {{0xAAB9, 0xAAAD, 0x0000}, 2229380},
+    {{0xAAB9, 0xAAAE, 0x0000}, 2229508},
+    {{0xAAB9, 0xAAAF, 0x0000}, 2229636},
+    {{0xAABB, 0xAA80, 0x0000}, 2229764},
+    {{0xAABB, 0xAA81, 0x0000}, 2229892},
+    {{0xAABB, 0xAA82, 0x0000}, 2230020},
+    {{0xAABB, 0xAA83, 0x0000}, 2230148},
+    {{0xAABB, 0xAA84, 0x0000}, 2230276},
+    {{0xAABB, 0xAA85, 0x0000}, 2230404},
+    {{0xAABB, 0xAA86, 0x0000}, 2230532},
+    {{0xAABB, 0xAA87, 0x0000}, 2230660},
+    {{0xAABB, 0xAA88, 0x0000}, 2230788},
+    {{0xAABB, 0xAA89, 0x0000}, 2230916},
+    {{0xAABB, 0xAA8A, 0x0000}, 2231044},
+    {{0xAABB, 0xAA8B, 0x0000}, 2231172},
+    {{0xAABB, 0xAA8C, 0x0000}, 2231300},
+    {{0xAABB, 0xAA8D, 0x0000}, 2231428},
+    {{0xAABB, 0xAA8E, 0x0000}, 2231556},
+    {{0xAABB, 0xAA8F, 0x0000}, 2231684},
+    {{0xAABB, 0xAA90, 0x0000}, 2231812},
+    {{0xAABB, 0xAA91, 0x0000}, 2231940},
+    {{0xAABB, 0xAA92, 0x0000}, 2232068},
+    {{0xAABB, 0xAA93, 0x0000}, 2232196},
+    {{0xAABB, 0xAA94, 0x0000}, 2232324},
+    {{0xAABB, 0xAA95, 0x0000}, 2232452},
+    {{0xAABB, 0xAA96, 0x0000}, 2232580},
+    {{0xAABB, 0xAA97, 0x0000}, 2232708},
+    {{0xAABB, 0xAA98, 0x0000}, 2232836},
+    {{0xAABB, 0xAA99, 0x0000}, 2232964},
+    {{0xAABB, 0xAA9A, 0x0000}, 2233092},
+    {{0xAABB, 0xAA9B, 0x0000}, 2233220},
+    {{0xAABB, 0xAA9C, 0x0000}, 2233348},
+    {{0xAABB, 0xAA9D, 0x0000}, 2233476},
+    {{0xAABB, 0xAA9E, 0x0000}, 2233604},
+    {{0xAABB, 0xAA9F, 0x0000}, 2233732},
+    {{0xAABB, 0xAAA0, 0x0000}, 2233860},
+    {{0xAABB, 0xAAA1, 0x0000}, 2233988},
+    {{0xAABB, 0xAAA2, 0x0000}, 2234116},
+    {{0xAABB, 0xAAA3, 0x0000}, 2234244},
+    {{0xAABB, 0xAAA4, 0x0000}, 2234372},
+    {{0xAABB, 0xAAA5, 0x0000}, 2234500},
+    {{0xAABB, 0xAAA6, 0x0000}, 2234628},
+    {{0xAABB, 0xAAA7, 0x0000}, 2234756},
+    {{0xAABB, 0xAAA8, 0x0000}, 2234884},
+    {{0xAABB, 0xAAA9, 0x0000}, 2235012},
+    {{0xAABB, 0xAAAA, 0x0000}, 2235140},
+    {{0xAABB, 0xAAAB, 0x0000}, 2235268},
+    {{0xAABB, 0xAAAC, 0x0000}, 2235396},
+    {{0xAABB, 0xAAAD, 0x0000}, 2235524},
+    {{0xAABB, 0xAAAE, 0x0000}, 2235652},
+    {{0xAABB, 0xAAAF, 0x0000}, 2235780},
+    {{0xAABC, 0xAA80, 0x0000}, 2235908},
+    {{0xAABC, 0xAA81, 0x0000}, 2236036},
+    {{0xAABC, 0xAA82, 0x0000}, 2236164},
+    {{0xAABC, 0xAA83, 0x0000}, 2236292},
+    {{0xAABC, 0xAA84, 0x0000}, 2236420},
+    {{0xAABC, 0xAA85, 0x0000}, 2236548},
+    {{0xAABC, 0xAA86, 0x0000}, 2236676},
+    {{0xAABC, 0xAA87, 0x0000}, 2236804},
+    {{0xAABC, 0xAA88, 0x0000}, 2236932},
+    {{0xAABC, 0xAA89, 0x0000}, 2237060},
+    {{0xAABC, 0xAA8A, 0x0000}, 2237188},
+    {{0xAABC, 0xAA8B, 0x0000}, 2237316},
+    {{0xAABC, 0xAA8C, 0x0000}, 2237444},
+    {{0xAABC, 0xAA8D, 0x0000}, 2237572},
+    {{0xAABC, 0xAA8E, 0x0000}, 2237700},
+    {{0xAABC, 0xAA8F, 0x0000}, 2237828},
+    {{0xAABC, 0xAA90, 0x0000}, 2237956},
+    {{0xAABC, 0xAA91, 0x0000}, 2238084},
+    {{0xAABC, 0xAA92, 0x0000}, 2238212},
+    {{0xAABC, 0xAA93, 0x0000}, 2238340},
+    {{0xAABC, 0xAA94, 0x0000}, 2238468},
+    {{0xAABC, 0xAA95, 0x0000}, 2238596},
+    {{0xAABC, 0xAA96, 0x0000}, 2238724},
+    {{0xAABC, 0xAA97, 0x0000}, 2238852},
+    {{0xAABC, 0xAA98, 0x0000}, 2238980},
+    {{0xAABC, 0xAA99, 0x0000}, 2239108},
+    {{0xAABC, 0xAA9A, 0x0000}, 2239236},
+    {{0xAABC, 0xAA9B, 0x0000}, 2239364},
+    {{0xAABC, 0xAA9C, 0x0000}, 2239492},
+    {{0xAABC, 0xAA9D, 0x0000}, 2239620},
+    {{0xAABC, 0xAA9E, 0x0000}, 2239748},
+    {{0xAABC, 0xAA9F, 0x0000}, 2239876},
+    {{0xAABC, 0xAAA0, 0x0000}, 2240004},
+    {{0xAABC, 0xAAA1, 0x0000}, 2240132},
+    {{0xAABC, 0xAAA2, 0x0000}, 2240260},
+    {{0xAABC, 0xAAA3, 0x0000}, 2240388},
+    {{0xAABC, 0xAAA4, 0x0000}, 2240516},
+    {{0xAABC, 0xAAA5, 0x0000}, 2240644},
+    {{0xAABC, 0xAAA6, 0x0000}, 2240772},
+    {{0xAABC, 0xAAA7, 0x0000}, 2240900},
+    {{0xAABC, 0xAAA8, 0x0000}, 2241028},
+    {{0xAABC, 0xAAA9, 0x0000}, 2241156},
+    {{0xAABC, 0xAAAA, 0x0000}, 2241284},
+    {{0xAABC, 0xAAAB, 0x0000}, 2241412},
+    {{0xAABC, 0xAAAC, 0x0000}, 2241540},
+    {{0xAABC, 0xAAAD, 0x0000}, 2241668},
+    {{0xAABC, 0xAAAE, 0x0000}, 2241796},
+    {{0xAABC, 0xAAAF, 0x0000}, 2241924},
+    {{0x11131, 0x11127, 0x0000}, 1437058},
+    {{0x11132, 0x11127, 0x0000}, 1437122},
+    {{0x11347, 0x1133E, 0x0000}, 1459650},
+    {{0x11347, 0x11357, 0x0000}, 1459714},
+    {{0x114B9, 0x114B0, 0x0000}, 1469506},
+    {{0x114B9, 0x114BA, 0x0000}, 1469442},
+    {{0x114B9, 0x114BD, 0x0000}, 1469634},
+    {{0x115B8, 0x115AF, 0x0000}, 1473602},
+    {{0x115B9, 0x115AF, 0x0000}, 1473666},
+    {{0x11935, 0x11930, 0x0000}, 1499330},
+};
+
+inline constexpr CollationImplicitRange sCollationImplicitRanges[] = {
+    {0x3400, 0x4DBF, 0x0000, 0xFB80},
+    {0x4E00, 0x9FFF, 0x0000, 0xFB40},
+    {0xFA0E, 0xFA0F, 0x0000, 0xFB40},
+    {0xFA11, 0xFA11, 0x0000, 0xFB40},
+    {0xFA13, 0xFA14, 0x0000, 0xFB40},
+    {0xFA1F, 0xFA1F, 0x0000, 0xFB40},
+    {0xFA21, 0xFA21, 0x0000, 0xFB40},
+    {0xFA23, 0xFA24, 0x0000, 0xFB40},
+    {0xFA27, 0xFA29, 0x0000, 0xFB40},
+    {0x17000, 0x18AFF, 0x17000, 0xFB00},
+    {0x18B00, 0x18CFF, 0x18B00, 0xFB02},
+    {0x18D00, 0x18D8F, 0x17000, 0xFB00},
+    {0x1B170, 0x1B2FF, 0x1B170, 0xFB01},
+    {0x20000, 0x2A6DF, 0x0000, 0xFB80},
+    {0x2A700, 0x2B738, 0x0000, 0xFB80},
+    {0x2B740, 0x2B81D, 0x0000, 0xFB80},
+    {0x2B820, 0x2CEA1, 0x0000, 0xFB80},
+    {0x2CEB0, 0x2EBE0, 0x0000, 0xFB80},
+    {0x30000, 0x3134A, 0x0000, 0xFB80},
+};
+
+}  // namespace edoren::unicode::internal
@@ -0,0 +1,7896 @@
+// Generated by tools/GenerateUnicodeTables.pl from the Unicode 14.0.0 database, do not edit.
+
+namespace edoren::unicode::internal {
+
+inline constexpr char32_t sNormalizationMaxCodePoint = 0x2FA1D;
+inline constexpr uint32_t sNormalizationBlockShift = 7;
+
+inline constexpr uint8_t sNormalizationStage1[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    31, 32, 33, 34, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 36, 37,
+    0, 38, 39, 0, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 0, 59, 60, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 61, 62, 0, 0, 63, 64, 65, 66, 0, 67, 68, 69,
+    70, 71, 72, 73, 74, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 76, 77, 78,
+    79, 80, 81, 82, 0, 83, 84, 85, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 86,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 87, 87, 88, 89, 90, 91, 68, 68, 92, 93, 94, 95, 96, 97,
+    0, 0, 0, 98, 0, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 101,
+    0, 0, 0, 0, 102, 103, 0, 0, 0, 0, 104, 0, 0, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 0, 115, 116, 0, 117, 118, 119, 120, 0,
+    121, 0, 122, 123, 124, 125, 0, 0, 118, 0, 126, 127, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 128, 129, 0, 0, 0, 0, 0, 0, 0, 0, 130,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 131, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 132, 133, 134, 0, 0, 0, 135, 136, 137, 68, 68, 138, 68, 139,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    140, 0, 129, 0, 0, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 142, 143, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 145, 0, 0,
+    0, 0, 146, 147, 148, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 149, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    87, 87, 87, 87, 150,
+};
+
+inline constexpr uint8_t sNormalizationStage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1,
+    0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 1, 1, 1, 0,
+    2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 0, 1, 1, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 1,
+    1, 0, 0, 2, 2, 2, 2, 2, 2, 1, 0, 0, 2, 2, 2, 2,
+    2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+    2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 1, 1, 1, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2,
+    0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 4, 4, 3,
+    4, 3, 4, 3, 3, 5, 6, 6, 6, 6, 5, 7, 6, 6, 6, 6,
+    6, 8, 8, 9, 9, 9, 9, 10, 10, 6, 6, 6, 6, 9, 9, 6,
+    9, 9, 6, 6, 11, 11, 11, 11, 12, 6, 6, 6, 6, 4, 4, 4,
+    13, 13, 3, 13, 13, 14, 4, 6, 6, 6, 4, 4, 4, 6, 6, 0,
+    4, 4, 4, 6, 6, 6, 6, 4, 5, 6, 6, 4, 15, 16, 16, 15,
+    16, 16, 15, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 1, 0, 0, 0, 17, 0,
+    0, 0, 0, 0, 1, 18, 2, 17, 2, 2, 2, 0, 2, 0, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0,
+    1, 1, 1, 18, 18, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 2, 2, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2,
+    0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 4, 4, 4, 4, 6, 4, 4, 4, 19, 6, 4, 4, 4, 4,
+    4, 4, 6, 6, 6, 6, 6, 6, 4, 4, 6, 4, 4, 19, 20, 4,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 30, 31, 32, 33, 0, 34,
+    0, 35, 36, 0, 4, 6, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 37, 38, 39, 0, 0, 0, 0, 0,
+    0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 41, 42, 37, 38,
+    39, 43, 44, 3, 3, 9, 6, 4, 4, 4, 4, 4, 6, 4, 4, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    45, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4,
+    4, 4, 4, 6, 4, 0, 0, 4, 4, 0, 6, 4, 4, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 6, 4, 4, 6, 4, 4, 6, 6, 6, 4, 6, 6, 4, 6, 4,
+    4, 4, 6, 4, 6, 4, 6, 4, 6, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+    4, 4, 6, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 6, 6, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 6,
+    6, 6, 6, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 0, 6, 4, 4, 6, 4, 4, 6, 4, 4, 4, 6, 6, 6,
+    40, 41, 42, 4, 4, 4, 6, 4, 4, 6, 6, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+    0, 4, 6, 4, 4, 0, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 50, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 48, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 17, 17, 0, 17,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 17, 0, 0, 17, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 0, 0, 17, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 50, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 2, 48, 0, 0,
+    0, 0, 0, 0, 0, 0, 50, 50, 0, 0, 0, 0, 17, 17, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 48, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 48, 0, 0,
+    0, 0, 0, 0, 0, 51, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0,
+    2, 0, 50, 0, 0, 0, 0, 2, 2, 0, 2, 2, 0, 48, 0, 0,
+    0, 0, 0, 0, 0, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 0, 50, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 48, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 50,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 2, 50,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 54, 54, 48, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 55, 55, 55, 55, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 56, 56, 48, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 6, 0, 6, 0, 58, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0,
+    0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+    0, 59, 60, 17, 61, 17, 17, 1, 17, 1, 60, 60, 60, 60, 0, 0,
+    60, 17, 4, 4, 48, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0,
+    0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0, 0, 17, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 50, 0,
+    0, 0, 0, 0, 0, 0, 0, 49, 0, 48, 48, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 4, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 6,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 4, 4, 6, 0, 6,
+    6, 4, 4, 6, 6, 4, 4, 4, 4, 4, 6, 4, 4, 4, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+    0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 49, 50, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0,
+    2, 2, 0, 2, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 4, 4, 4,
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 0, 11, 6, 6, 6, 6, 6, 4, 4, 6, 6, 6, 6,
+    4, 0, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 6, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    4, 4, 6, 4, 4, 4, 4, 4, 4, 4, 6, 4, 4, 16, 62, 6,
+    8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 5, 20, 20, 6, 63, 4, 15, 6, 4, 6,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 18, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 17, 2, 17, 2, 17, 2, 17, 2, 17, 2, 17, 2, 17, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 17, 2, 1, 17, 1,
+    1, 18, 2, 2, 2, 0, 2, 2, 2, 17, 2, 17, 2, 18, 18, 18,
+    2, 2, 2, 17, 0, 0, 2, 2, 2, 2, 2, 17, 0, 18, 18, 18,
+    2, 2, 2, 17, 2, 2, 2, 2, 2, 2, 2, 17, 2, 18, 17, 17,
+    0, 0, 2, 2, 2, 0, 2, 2, 2, 17, 2, 17, 2, 17, 1, 0,
+    17, 17, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 11, 11, 4, 4, 4, 4, 11, 11, 11, 4, 4, 0, 0, 0,
+    0, 4, 0, 0, 0, 11, 11, 4, 6, 4, 11, 11, 6, 6, 6, 6,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 0, 1, 0, 17, 0, 1, 0, 17, 17, 1, 1, 0, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 1, 1, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 2, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+    2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 0, 2, 2, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 63, 20, 5, 19, 64, 64,
+    0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0, 0, 65, 65, 1, 1, 0, 2, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0,
+    2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 2, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 2, 2, 2, 2, 0, 0, 0, 2, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 4, 4, 6, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0,
+    17, 0, 17, 0, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0,
+    17, 0, 17, 0, 0, 17, 17, 0, 0, 0, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 17, 66, 17,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 0, 17, 0,
+    17, 17, 0, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 6, 6, 4, 4,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 11, 6, 0, 0, 0, 0, 48,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 6, 6, 4, 4, 4, 6, 4, 6, 6, 6,
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 6, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 47, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 2, 2,
+    0, 0, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 48, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 0, 50, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 48, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 48, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 2, 2, 50, 2, 0,
+    0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 48,
+    49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    50, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 48, 48, 0,
+    0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 49, 0, 48, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    67, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17,
+    17, 17, 17, 17, 17, 58, 58, 11, 11, 11, 0, 0, 0, 68, 58, 58,
+    58, 58, 58, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+    6, 6, 6, 0, 0, 4, 4, 4, 4, 4, 6, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17, 17, 17,
+    17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+    0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1,
+    1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4,
+    4, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 49, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 1, 1,
+    0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+    0, 1, 1, 0, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+    1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+inline constexpr NormalizationRecord sNormalizationRecords[] = {
+    {0, 0},
+    {0, 18},
+    {0, 3},
+    {230, 40},
+    {230, 0},
+    {232, 0},
+    {220, 0},
+    {216, 40},
+    {202, 0},
+    {220, 40},
+    {202, 40},
+    {1, 0},
+    {1, 40},
+    {230, 23},
+    {240, 40},
+    {233, 0},
+    {234, 0},
+    {0, 23},
+    {0, 19},
+    {222, 0},
+    {228, 0},
+    {10, 0},
+    {11, 0},
+    {12, 0},
+    {13, 0},
+    {14, 0},
+    {15, 0},
+    {16, 0},
+    {17, 0},
+    {18, 0},
+    {19, 0},
+    {20, 0},
+    {21, 0},
+    {22, 0},
+    {23, 0},
+    {24, 0},
+    {25, 0},
+    {30, 0},
+    {31, 0},
+    {32, 0},
+    {27, 0},
+    {28, 0},
+    {29, 0},
+    {33, 0},
+    {34, 0},
+    {35, 0},
+    {36, 0},
+    {7, 40},
+    {9, 0},
+    {7, 0},
+    {0, 40},
+    {84, 0},
+    {91, 40},
+    {9, 40},
+    {103, 0},
+    {107, 0},
+    {118, 0},
+    {122, 0},
+    {216, 0},
+    {129, 0},
+    {130, 0},
+    {132, 0},
+    {214, 0},
+    {218, 0},
+    {224, 0},
+    {8, 40},
+    {26, 0},
+    {6, 0},
+    {226, 0},
+};
+
+inline constexpr uint8_t sDecompositionStage1[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 10, 11, 12, 0, 0,
+    0, 0, 13, 14, 15, 0, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+    26, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 28, 0, 0, 0, 29, 30, 31, 32, 33, 34,
+    35, 36, 37, 38, 39, 40, 41, 0, 42, 43, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 44, 45, 0, 0, 46, 0, 47, 0, 0, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 58, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 60, 61,
+    0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 78, 79, 0, 0, 0, 80, 0, 0, 81, 0, 82, 0, 0, 0, 0,
+    0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 84, 85, 0, 0, 0, 0, 86, 87, 88, 89, 90, 91, 92, 93,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 95, 0, 0,
+    0, 0, 96, 97, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    100, 101, 102, 103, 104,
+};
+
+inline constexpr uint16_t sDecompositionStage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 0, 0, 0, 4,
+    0, 0, 5, 6, 7, 8, 0, 0, 9, 10, 11, 0, 12, 13, 14, 0,
+    15, 16, 17, 18, 19, 20, 0, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    0, 30, 31, 32, 33, 34, 35, 0, 0, 36, 37, 38, 39, 40, 0, 0,
+    41, 42, 43, 44, 45, 46, 0, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    0, 56, 57, 58, 59, 60, 61, 0, 0, 62, 63, 64, 65, 66, 0, 67,
+    68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    0, 0, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+    98, 99, 100, 101, 102, 103, 0, 0, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 0, 113, 114, 115, 116, 117, 118, 0, 119, 120, 121, 122, 123, 124, 125,
+    126, 0, 0, 127, 128, 129, 130, 131, 132, 133, 0, 0, 134, 135, 136, 137,
+    138, 139, 0, 0, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+    152, 153, 154, 155, 156, 157, 0, 0, 158, 159, 160, 161, 162, 163, 164, 165,
+    166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    182, 183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184,
+    185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197,
+    198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 0, 211, 212,
+    213, 214, 215, 216, 0, 0, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226,
+    227, 228, 229, 230, 231, 232, 0, 0, 233, 234, 235, 236, 237, 238, 239, 240,
+    241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256,
+    257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 0, 0, 269, 270,
+    0, 0, 0, 0, 0, 0, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280,
+    281, 282, 283, 284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    285, 286, 287, 288, 289, 290, 291, 292, 293, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 294, 295, 296, 297, 298, 299, 0, 0,
+    300, 301, 181, 302, 303, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    304, 305, 0, 306, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 308, 0, 0, 0, 0, 0, 309, 0, 0, 0, 310, 0,
+    0, 0, 0, 0, 7, 311, 312, 313, 314, 315, 316, 0, 317, 0, 318, 319,
+    320, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 321, 322, 323, 324, 325, 326,
+    327, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 329, 330, 331, 332, 0,
+    333, 334, 335, 336, 337, 338, 339, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    340, 341, 342, 0, 343, 344, 0, 0, 0, 345, 0, 0, 0, 0, 0, 0,
+    346, 347, 0, 348, 0, 0, 0, 349, 0, 0, 0, 0, 350, 351, 352, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    355, 356, 0, 357, 0, 0, 0, 358, 0, 0, 0, 0, 359, 360, 361, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 362, 363, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 364, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    366, 367, 368, 369, 0, 0, 370, 371, 0, 0, 372, 373, 374, 375, 376, 377,
+    0, 0, 378, 379, 380, 381, 382, 383, 0, 0, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 0, 0, 396, 397, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 398, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 399, 400, 401, 402, 403, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 404, 405, 406, 407, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    408, 0, 409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 411, 0, 0, 0, 0, 0, 0,
+    0, 412, 0, 0, 413, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 414, 415, 416, 417, 418, 419, 420, 421,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 422, 423, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 424, 425, 0, 426,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 427, 0, 0, 428, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 429, 430, 431, 0, 0, 432, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 433, 0, 0, 434, 435, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 436, 437, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 438, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 439, 440, 441, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 442, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    443, 0, 0, 0, 0, 0, 0, 444, 445, 0, 446, 447, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 448, 449, 450, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0, 452, 453, 454, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 455, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 457, 458, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 459, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 460, 0, 0, 0, 0, 0, 0, 0, 0, 0, 461, 0, 0,
+    0, 0, 462, 0, 0, 0, 0, 463, 0, 0, 0, 0, 464, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 466, 0, 467, 468, 469, 470, 471, 0, 0, 0, 0, 0, 0,
+    0, 472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 473, 0, 0, 0, 0, 0, 0, 0, 0, 0, 474, 0, 0,
+    0, 0, 475, 0, 0, 0, 0, 476, 0, 0, 0, 0, 477, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 478, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 479, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 480, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 481, 0, 482, 0, 483, 0, 484, 0, 485, 0,
+    0, 0, 486, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 487, 0, 488, 0, 0,
+    489, 490, 0, 491, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 492, 493, 494, 0,
+    495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 0, 506, 507, 508, 509,
+    510, 511, 512, 3, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 0, 523,
+    524, 525, 11, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 333, 536, 537,
+    338, 538, 539, 288, 531, 534, 333, 536, 341, 338, 538, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 540, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 541, 542, 543, 544, 521,
+    545, 546, 547, 548, 549, 550, 551, 552, 553, 554, 555, 556, 557, 558, 559, 560,
+    561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 334,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591,
+    592, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607,
+    608, 609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639,
+    640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655,
+    656, 657, 658, 659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670, 671,
+    672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687,
+    688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703,
+    704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
+    720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 0, 0, 0, 0,
+    732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747,
+    748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763,
+    764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
+    780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795,
+    796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811,
+    812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 0, 0, 0, 0, 0, 0,
+    822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837,
+    838, 839, 840, 841, 842, 843, 0, 0, 844, 845, 846, 847, 848, 849, 0, 0,
+    850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865,
+    866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881,
+    882, 883, 884, 885, 886, 887, 0, 0, 888, 889, 890, 891, 892, 893, 0, 0,
+    894, 895, 896, 897, 898, 899, 900, 901, 0, 902, 0, 903, 0, 904, 0, 905,
+    906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921,
+    922, 323, 923, 324, 924, 325, 925, 326, 926, 330, 927, 331, 928, 332, 0, 0,
+    929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944,
+    945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960,
+    961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976,
+    977, 978, 979, 980, 981, 0, 982, 983, 984, 985, 986, 312, 987, 988, 989, 988,
+    990, 991, 992, 993, 994, 0, 995, 996, 997, 314, 998, 315, 999, 1000, 1001, 1002,
+    1003, 1004, 1005, 320, 0, 0, 1006, 1007, 1008, 1009, 1010, 316, 0, 1011, 1012, 1013,
+    1014, 1015, 1016, 327, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 318, 1024, 1025, 311, 1026,
+    0, 0, 1027, 1028, 1029, 0, 1030, 1031, 1032, 317, 1033, 319, 1034, 1035, 1036, 0,
+    1037, 1038, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 1039, 0, 0, 0, 0, 0, 1040, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1041, 1042, 1043, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 1044, 1045, 0, 1046, 1047, 0, 0, 0, 0, 1048, 0, 1049, 0,
+    0, 0, 0, 0, 0, 0, 0, 1050, 1051, 1052, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1053, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1054, 539, 0, 0, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066,
+    1054, 10, 5, 6, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 0,
+    3, 518, 11, 302, 519, 285, 523, 301, 524, 1066, 529, 181, 530, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1067, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1068, 1069, 1070, 1071, 0, 1072, 1073, 1074, 0, 1075, 522, 499, 499, 499, 285, 1076,
+    500, 500, 503, 301, 0, 505, 1077, 0, 0, 508, 1078, 509, 509, 509, 0, 0,
+    1079, 1080, 1081, 0, 1082, 0, 1083, 0, 1082, 0, 1084, 20, 494, 1070, 0, 518,
+    496, 1085, 0, 504, 11, 1086, 1087, 1088, 1089, 539, 0, 1090, 339, 536, 1091, 1092,
+    1093, 0, 0, 0, 0, 495, 517, 518, 539, 287, 0, 0, 0, 0, 0, 0,
+    1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109,
+    500, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120, 503, 1070, 495, 504,
+    539, 1121, 1122, 1123, 534, 1124, 1125, 1126, 1127, 302, 1128, 1129, 301, 542, 517, 524,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1130, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1131, 1132, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1133, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1134, 1135, 1136,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1137, 0, 0, 0, 0, 1138, 0, 0, 1139, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1140, 0, 1141, 0, 0, 0, 0, 0, 1142, 1143, 0, 1144,
+    1145, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1146, 0, 0, 1147, 0, 0, 1148, 0, 1149, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1150, 0, 1151, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1152, 1153, 1154,
+    1155, 1156, 0, 0, 1157, 1158, 0, 0, 1159, 1160, 0, 0, 0, 0, 0, 0,
+    1161, 1162, 0, 0, 1163, 1164, 0, 0, 1165, 1166, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1167, 1168, 1169, 1170,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1171, 1172, 1173, 1174, 0, 0, 0, 0, 0, 0, 1175, 1176, 1177, 1178, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1179, 1180, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 5, 6, 1055, 1056, 1057, 1058, 1059, 1060, 1181, 1182, 1183, 1184, 1185, 1186, 1187,
+    1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203,
+    1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219,
+    1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235,
+    1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251,
+    1252, 1253, 1254, 1255, 1256, 1257, 492, 494, 1070, 495, 496, 1085, 498, 499, 500, 501,
+    502, 503, 504, 505, 506, 508, 1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259, 1082,
+    3, 516, 542, 517, 518, 545, 522, 285, 539, 287, 523, 301, 524, 1066, 11, 529,
+    1260, 288, 181, 530, 531, 534, 292, 302, 293, 572, 1054, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1261, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1262, 1263, 1264, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1265, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 287, 1113, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1266,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1267,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284,
+    1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300,
+    1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316,
+    1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332,
+    1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348,
+    1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364,
+    1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380,
+    1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396,
+    1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412,
+    1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428,
+    1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444,
+    1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460,
+    1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476,
+    1477, 1478, 1479, 1480, 1481, 1482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1483, 0, 1292, 1484, 1485, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1486, 0, 1487, 0,
+    1488, 0, 1489, 0, 1490, 0, 1491, 0, 1492, 0, 1493, 0, 1494, 0, 1495, 0,
+    1496, 0, 1497, 0, 0, 1498, 0, 1499, 0, 1500, 0, 0, 0, 0, 0, 0,
+    1501, 1502, 0, 1503, 1504, 0, 1505, 1506, 0, 1507, 1508, 0, 1509, 1510, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1511, 0, 0, 0, 0, 0, 0, 1512, 1513, 0, 1514, 1515,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1516, 0, 1517, 0,
+    1518, 0, 1519, 0, 1520, 0, 1521, 0, 1522, 0, 1523, 0, 1524, 0, 1525, 0,
+    1526, 0, 1527, 0, 0, 1528, 0, 1529, 0, 1530, 0, 0, 0, 0, 0, 0,
+    1531, 1532, 0, 1533, 1534, 0, 1535, 1536, 0, 1537, 1538, 0, 1539, 1540, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1541, 0, 0, 1542, 1543, 1544, 1545, 0, 0, 0, 1546, 1547,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562,
+    1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578,
+    1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594,
+    1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610,
+    1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626,
+    1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 0,
+    0, 0, 1269, 1275, 1642, 1643, 1644, 1645, 1646, 1647, 1273, 1648, 1649, 1650, 1651, 1277,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667,
+    1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 0,
+    1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698,
+    1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714,
+    1715, 1716, 1717, 1718, 1719, 1720, 1335, 1721, 0, 0, 0, 0, 0, 0, 0, 0,
+    1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737,
+    1548, 1551, 1554, 1556, 1564, 1565, 1568, 1570, 1571, 1573, 1574, 1575, 1576, 1577, 1738, 1739,
+    1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 0,
+    1269, 1275, 1642, 1643, 1755, 1756, 1757, 1280, 1758, 1292, 1342, 1354, 1353, 1343, 1435, 1300,
+    1340, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1306, 1769, 1770, 1771, 1772,
+    1773, 1774, 1775, 1776, 1644, 1645, 1646, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785,
+    1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801,
+    1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817,
+    1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833,
+    1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849,
+    1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865,
+    1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881,
+    1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897,
+    1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913,
+    1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929,
+    1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945,
+    1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961,
+    1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977,
+    1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993,
+    1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009,
+    2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025,
+    2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041,
+    2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057,
+    2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073,
+    2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089,
+    2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105,
+    2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2122, 2123, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1070, 1085, 1078, 0, 0, 0, 2125, 2126, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2127, 2128, 2129, 2130,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2131, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146,
+    2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162,
+    2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178,
+    2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194,
+    2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210,
+    2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2151, 2223, 2224, 2225,
+    2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241,
+    2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257,
+    2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273,
+    2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289,
+    2290, 2241, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2225, 2299, 2300, 2301, 2302, 2303,
+    2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2151,
+    2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334,
+    2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2227, 2346, 2347, 2348, 2349,
+    2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365,
+    2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381,
+    2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 0, 0,
+    2396, 0, 2397, 0, 0, 2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 0,
+    2408, 0, 2409, 0, 0, 2410, 2411, 0, 0, 0, 2412, 2413, 2414, 2415, 2416, 2417,
+    2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433,
+    2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449,
+    2450, 2451, 2452, 2453, 2454, 2455, 2456, 2280, 2457, 2458, 2459, 2460, 2461, 2462, 2462, 2463,
+    2464, 2465, 2466, 2467, 2468, 2469, 2470, 2410, 2471, 2472, 2473, 2474, 2475, 2476, 0, 0,
+    2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2424, 2485, 2486, 2487, 2396, 2488, 2489, 2490,
+    2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2433, 2500, 2434, 2501, 2502, 2503, 2504,
+    2505, 2397, 2172, 2506, 2507, 2508, 2242, 2329, 2509, 2510, 2441, 2511, 2442, 2512, 2513, 2514,
+    2399, 2515, 2516, 2517, 2518, 2519, 2400, 2520, 2521, 2522, 2523, 2524, 2525, 2456, 2526, 2527,
+    2280, 2528, 2460, 2529, 2530, 2531, 2532, 2533, 2465, 2534, 2409, 2535, 2466, 2223, 2536, 2467,
+    2537, 2469, 2538, 2539, 2540, 2541, 2542, 2471, 2405, 2543, 2472, 2544, 2473, 2545, 2139, 2546,
+    2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2557, 2558, 2559, 2560, 2561, 2562, 2562, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2563, 2564, 2565, 2566, 2567, 0, 0, 0, 0, 0, 2568, 0, 2569,
+    2570, 1086, 1089, 2571, 2572, 2573, 2574, 2575, 2576, 1061, 2577, 2578, 2579, 2580, 2581, 2582,
+    2583, 2584, 2585, 2586, 2587, 2588, 2589, 0, 2590, 2591, 2592, 2593, 2594, 0, 2595, 0,
+    2596, 2597, 0, 2598, 2599, 0, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2608, 2609,
+    2610, 2610, 2611, 2611, 2611, 2611, 2612, 2612, 2612, 2612, 2613, 2613, 2613, 2613, 2614, 2614,
+    2614, 2614, 2615, 2615, 2615, 2615, 2616, 2616, 2616, 2616, 2617, 2617, 2617, 2617, 2618, 2618,
+    2618, 2618, 2619, 2619, 2619, 2619, 2620, 2620, 2620, 2620, 2621, 2621, 2621, 2621, 2622, 2622,
+    2622, 2622, 2623, 2623, 2624, 2624, 2625, 2625, 2626, 2626, 2627, 2627, 2628, 2628, 2629, 2629,
+    2629, 2629, 2630, 2630, 2630, 2630, 2631, 2631, 2631, 2631, 2632, 2632, 2632, 2632, 2633, 2633,
+    2634, 2634, 2634, 2634, 2635, 2635, 2636, 2636, 2636, 2636, 2637, 2637, 2637, 2637, 2638, 2638,
+    2639, 2639, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2640, 2640, 2640, 2640, 2641, 2641, 2642, 2642, 2643, 2643, 406, 2644, 2644,
+    2645, 2645, 2646, 2646, 2647, 2647, 2647, 2647, 2648, 2648, 2649, 2649, 2650, 2650, 2651, 2651,
+    2652, 2652, 2653, 2653, 2654, 2654, 2655, 2655, 2655, 2656, 2656, 2656, 2657, 2657, 2657, 2657,
+    2658, 2659, 2660, 2656, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672,
+    2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688,
+    2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704,
+    2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720,
+    2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735, 2736,
+    2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752,
+    2753, 2754, 2755, 2756, 2757, 2758, 2660, 2759, 2656, 2661, 2760, 2761, 2665, 2762, 2666, 2667,
+    2763, 2764, 2671, 2765, 2672, 2673, 2766, 2767, 2675, 2768, 2676, 2677, 2706, 2707, 2710, 2711,
+    2712, 2716, 2717, 2718, 2719, 2723, 2724, 2725, 2769, 2729, 2770, 2771, 2735, 2772, 2736, 2737,
+    2750, 2773, 2774, 2745, 2775, 2746, 2747, 2658, 2659, 2776, 2660, 2777, 2662, 2663, 2664, 2665,
+    2778, 2668, 2669, 2670, 2671, 2779, 2675, 2678, 2679, 2680, 2681, 2682, 2684, 2685, 2686, 2687,
+    2688, 2689, 2780, 2690, 2691, 2692, 2693, 2694, 2695, 2697, 2698, 2699, 2700, 2701, 2702, 2703,
+    2704, 2705, 2708, 2709, 2713, 2714, 2715, 2716, 2717, 2720, 2721, 2722, 2723, 2781, 2726, 2727,
+    2728, 2729, 2732, 2733, 2734, 2735, 2782, 2738, 2739, 2783, 2742, 2743, 2744, 2745, 2784, 2660,
+    2777, 2665, 2778, 2671, 2779, 2675, 2785, 2688, 2786, 2787, 2788, 2716, 2717, 2723, 2735, 2782,
+    2745, 2784, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802,
+    2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2787, 2815, 2816, 2817,
+    2818, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806,
+    2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2787, 2815, 2816, 2817, 2818, 2812, 2813, 2814,
+    2787, 2786, 2788, 2696, 2685, 2686, 2687, 2812, 2813, 2814, 2696, 2697, 2819, 2819, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2820, 2821, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2827, 2828, 2829, 2830, 2831, 2832, 2833,
+    2833, 2834, 2835, 2835, 2836, 2836, 2837, 2838, 2838, 2839, 2840, 2840, 2841, 2841, 2842, 2843,
+    2843, 2844, 2844, 2845, 2846, 2847, 2848, 2848, 2849, 2850, 2851, 2852, 2853, 2853, 2854, 2855,
+    2856, 2857, 2858, 2859, 2859, 2860, 2860, 2861, 2861, 2862, 2863, 2864, 2865, 2866, 2867, 2868,
+    0, 0, 2869, 2870, 2871, 2872, 2873, 2874, 2874, 2875, 2876, 2877, 2878, 2878, 2879, 2880,
+    2881, 2882, 2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896,
+    2897, 2898, 2899, 2900, 2854, 2856, 2901, 2902, 2903, 2904, 2905, 2906, 2905, 2903, 2907, 2908,
+    2909, 2910, 2911, 2906, 2847, 2837, 2912, 2913, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2925, 2926, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 1043, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1042, 2936, 2937, 2938, 2938, 1064, 1065, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947,
+    2948, 2949, 2950, 2951, 2952, 0, 0, 2953, 2954, 1049, 1049, 1049, 1049, 2938, 2938, 2938,
+    2927, 2928, 1041, 0, 2931, 2930, 2933, 2932, 2936, 1064, 1065, 2939, 2940, 2941, 2942, 2955,
+    2956, 2957, 1061, 2958, 2959, 2960, 1063, 0, 2961, 2962, 2963, 2964, 0, 0, 0, 0,
+    2965, 2966, 2967, 0, 2968, 0, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976, 2977, 2978,
+    2979, 2980, 2980, 2981, 2981, 2982, 2982, 2983, 2983, 2984, 2984, 2984, 2984, 2985, 2985, 2986,
+    2986, 2986, 2986, 2987, 2987, 2988, 2988, 2988, 2988, 2989, 2989, 2989, 2989, 2990, 2990, 2990,
+    2990, 2991, 2991, 2991, 2991, 2992, 2992, 2992, 2992, 2993, 2993, 2994, 2994, 2995, 2995, 2996,
+    2996, 2997, 2997, 2997, 2997, 2998, 2998, 2998, 2998, 2999, 2999, 2999, 2999, 3000, 3000, 3000,
+    3000, 3001, 3001, 3001, 3001, 3002, 3002, 3002, 3002, 3003, 3003, 3003, 3003, 3004, 3004, 3004,
+    3004, 3005, 3005, 3005, 3005, 3006, 3006, 3006, 3006, 3007, 3007, 3007, 3007, 3008, 3008, 3008,
+    3008, 3009, 3009, 3009, 3009, 3010, 3010, 3010, 3010, 3011, 3011, 3011, 3011, 3012, 3012, 2648,
+    2648, 3013, 3013, 3013, 3013, 3014, 3014, 3015, 3015, 3016, 3016, 3017, 3017, 0, 0, 0,
+    0, 2932, 3018, 2955, 2962, 2963, 2956, 3019, 1064, 1065, 2957, 1061, 2927, 2958, 1041, 3020,
+    1054, 10, 5, 6, 1055, 1056, 1057, 1058, 1059, 1060, 2930, 2931, 2959, 1063, 2960, 2933,
+    2964, 492, 494, 1070, 495, 496, 1085, 498, 499, 500, 501, 502, 503, 504, 505, 506,
+    508, 1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259, 1082, 2953, 2961, 2954, 3021, 2938,
+    3022, 3, 516, 542, 517, 518, 545, 522, 285, 539, 287, 523, 301, 524, 1066, 11,
+    529, 1260, 288, 181, 530, 531, 534, 292, 302, 293, 572, 2939, 3023, 2940, 3024, 3025,
+    3026, 2929, 2949, 2950, 2928, 3027, 1864, 3028, 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036,
+    3037, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832,
+    1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848,
+    1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 3038, 3039, 3040,
+    1599, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562,
+    1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 0,
+    0, 0, 1578, 1579, 1580, 1581, 1582, 1583, 0, 0, 1584, 1585, 1586, 1587, 1588, 1589,
+    0, 0, 1590, 1591, 1592, 1593, 1594, 1595, 0, 0, 1596, 1597, 1598, 0, 0, 0,
+    3041, 3042, 3043, 4, 3044, 3045, 3046, 0, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 3054, 3055, 3056, 3057, 3058, 0, 3059, 3060, 3061, 3062, 3063, 3064, 3065, 3066, 3067,
+    3068, 3069, 3070, 3071, 3072, 1076, 3073, 3074, 3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082,
+    3083, 3084, 3085, 3086, 3087, 1260, 3088, 3089, 3090, 3091, 3092, 3093, 3094, 3095, 3096, 3097,
+    3098, 0, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3108, 0, 3109, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3110, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3111, 3112,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3113, 3114, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3115, 3116, 0, 3117, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3118, 3119, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 3120, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3121, 3122,
+    3123, 3124, 3125, 3126, 3127, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3128, 3129, 3130, 3131, 3132,
+    3133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    492, 494, 1070, 495, 496, 1085, 498, 499, 500, 501, 502, 503, 504, 505, 506, 508,
+    1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259, 1082, 3, 516, 542, 517, 518, 545,
+    522, 285, 539, 287, 523, 301, 524, 1066, 11, 529, 1260, 288, 181, 530, 531, 534,
+    292, 302, 293, 572, 492, 494, 1070, 495, 496, 1085, 498, 499, 500, 501, 502, 503,
+    504, 505, 506, 508, 1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259, 1082, 3, 516,
+    542, 517, 518, 545, 522, 0, 539, 287, 523, 301, 524, 1066, 11, 529, 1260, 288,
+    181, 530, 531, 534, 292, 302, 293, 572, 492, 494, 1070, 495, 496, 1085, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 508, 1078, 509, 1258, 510, 511, 1113, 512, 1118,
+    1259, 1082, 3, 516, 542, 517, 518, 545, 522, 285, 539, 287, 523, 301, 524, 1066,
+    11, 529, 1260, 288, 181, 530, 531, 534, 292, 302, 293, 572, 492, 0, 1070, 495,
+    0, 0, 498, 0, 0, 501, 502, 0, 0, 505, 506, 508, 1078, 0, 1258, 510,
+    511, 1113, 512, 1118, 1259, 1082, 3, 516, 542, 517, 0, 545, 0, 285, 539, 287,
+    523, 301, 524, 1066, 0, 529, 1260, 288, 181, 530, 531, 534, 292, 302, 293, 572,
+    492, 494, 1070, 495, 496, 1085, 498, 499, 500, 501, 502, 503, 504, 505, 506, 508,
+    1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259, 1082, 3, 516, 542, 517, 518, 545,
+    522, 285, 539, 287, 523, 301, 524, 1066, 11, 529, 1260, 288, 181, 530, 531, 534,
+    292, 302, 293, 572, 492, 494, 0, 495, 496, 1085, 498, 0, 0, 501, 502, 503,
+    504, 505, 506, 508, 1078, 0, 1258, 510, 511, 1113, 512, 1118, 1259, 0, 3, 516,
+    542, 517, 518, 545, 522, 285, 539, 287, 523, 301, 524, 1066, 11, 529, 1260, 288,
+    181, 530, 531, 534, 292, 302, 293, 572, 492, 494, 0, 495, 496, 1085, 498, 0,
+    500, 501, 502, 503, 504, 0, 506, 0, 0, 0, 1258, 510, 511, 1113, 512, 1118,
+    1259, 0, 3, 516, 542, 517, 518, 545, 522, 285, 539, 287, 523, 301, 524, 1066,
+    11, 529, 1260, 288, 181, 530, 531, 534, 292, 302, 293, 572, 492, 494, 1070, 495,
+    496, 1085, 498, 499, 500, 501, 502, 503, 504, 505, 506, 508, 1078, 509, 1258, 510,
+    511, 1113, 512, 1118, 1259, 1082, 3, 516, 542, 517, 518, 545, 522, 285, 539, 287,
+    523, 301, 524, 1066, 11, 529, 1260, 288, 181, 530, 531, 534, 292, 302, 293, 572,
+    492, 494, 1070, 495, 496, 1085, 498, 499, 500, 501, 502, 503, 504, 505, 506, 508,
+    1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259, 1082, 3, 516, 542, 517, 518, 545,
+    522, 285, 539, 287, 523, 301, 524, 1066, 11, 529, 1260, 288, 181, 530, 531, 534,
+    292, 302, 293, 572, 492, 494, 1070, 495, 496, 1085, 498, 499, 500, 501, 502, 503,
+    504, 505, 506, 508, 1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259, 1082, 3, 516,
+    542, 517, 518, 545, 522, 285, 539, 287, 523, 301, 524, 1066, 11, 529, 1260, 288,
+    181, 530, 531, 534, 292, 302, 293, 572, 492, 494, 1070, 495, 496, 1085, 498, 499,
+    500, 501, 502, 503, 504, 505, 506, 508, 1078, 509, 1258, 510, 511, 1113, 512, 1118,
+    1259, 1082, 3, 516, 542, 517, 518, 545, 522, 285, 539, 287, 523, 301, 524, 1066,
+    11, 529, 1260, 288, 181, 530, 531, 534, 292, 302, 293, 572, 492, 494, 1070, 495,
+    496, 1085, 498, 499, 500, 501, 502, 503, 504, 505, 506, 508, 1078, 509, 1258, 510,
+    511, 1113, 512, 1118, 1259, 1082, 3, 516, 542, 517, 518, 545, 522, 285, 539, 287,
+    523, 301, 524, 1066, 11, 529, 1260, 288, 181, 530, 531, 534, 292, 302, 293, 572,
+    492, 494, 1070, 495, 496, 1085, 498, 499, 500, 501, 502, 503, 504, 505, 506, 508,
+    1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259, 1082, 3, 516, 542, 517, 518, 545,
+    522, 285, 539, 287, 523, 301, 524, 1066, 11, 529, 1260, 288, 181, 530, 531, 534,
+    292, 302, 293, 572, 3134, 3135, 0, 0, 3136, 3137, 1091, 3138, 3139, 3140, 3141, 343,
+    3142, 3143, 3144, 3145, 3146, 3147, 3148, 1092, 3149, 343, 345, 3150, 335, 3151, 3152, 3153,
+    3154, 3155, 3156, 333, 536, 537, 344, 3157, 3158, 334, 3159, 340, 3160, 8, 3161, 3162,
+    3163, 339, 341, 342, 3164, 3165, 3166, 338, 538, 3167, 3168, 3169, 344, 334, 340, 338,
+    341, 339, 3136, 3137, 1091, 3138, 3139, 3140, 3141, 343, 3142, 3143, 3144, 3145, 3146, 3147,
+    3148, 1092, 3149, 343, 345, 3150, 335, 3151, 3152, 3153, 3154, 3155, 3156, 333, 536, 537,
+    344, 3157, 3158, 334, 3159, 340, 3160, 8, 3161, 3162, 3163, 339, 341, 342, 3164, 3165,
+    3166, 338, 538, 3167, 3168, 3169, 344, 334, 340, 338, 341, 339, 3136, 3137, 1091, 3138,
+    3139, 3140, 3141, 343, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 1092, 3149, 343, 345, 3150,
+    335, 3151, 3152, 3153, 3154, 3155, 3156, 333, 536, 537, 344, 3157, 3158, 334, 3159, 340,
+    3160, 8, 3161, 3162, 3163, 339, 341, 342, 3164, 3165, 3166, 338, 538, 3167, 3168, 3169,
+    344, 334, 340, 338, 341, 339, 3136, 3137, 1091, 3138, 3139, 3140, 3141, 343, 3142, 3143,
+    3144, 3145, 3146, 3147, 3148, 1092, 3149, 343, 345, 3150, 335, 3151, 3152, 3153, 3154, 3155,
+    3156, 333, 536, 537, 344, 3157, 3158, 334, 3159, 340, 3160, 8, 3161, 3162, 3163, 339,
+    341, 342, 3164, 3165, 3166, 338, 538, 3167, 3168, 3169, 344, 334, 340, 338, 341, 339,
+    3136, 3137, 1091, 3138, 3139, 3140, 3141, 343, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 1092,
+    3149, 343, 345, 3150, 335, 3151, 3152, 3153, 3154, 3155, 3156, 333, 536, 537, 344, 3157,
+    3158, 334, 3159, 340, 3160, 8, 3161, 3162, 3163, 339, 341, 342, 3164, 3165, 3166, 338,
+    538, 3167, 3168, 3169, 344, 334, 340, 338, 341, 339, 3170, 3171, 0, 0, 1054, 10,
+    5, 6, 1055, 1056, 1057, 1058, 1059, 1060, 1054, 10, 5, 6, 1055, 1056, 1057, 1058,
+    1059, 1060, 1054, 10, 5, 6, 1055, 1056, 1057, 1058, 1059, 1060, 1054, 10, 5, 6,
+    1055, 1056, 1057, 1058, 1059, 1060, 1054, 10, 5, 6, 1055, 1056, 1057, 1058, 1059, 1060,
+    2985, 2986, 2990, 2993, 0, 3012, 2996, 2991, 3001, 3013, 3007, 3008, 3009, 3010, 2997, 3003,
+    3005, 2999, 3006, 2995, 2998, 2988, 2989, 2992, 2994, 3000, 3002, 3004, 3172, 2633, 3173, 3174,
+    0, 2986, 2990, 0, 3011, 0, 0, 2991, 0, 3013, 3007, 3008, 3009, 3010, 2997, 3003,
+    3005, 2999, 3006, 0, 2998, 2988, 2989, 2992, 0, 3000, 0, 3004, 0, 0, 0, 0,
+    0, 0, 2990, 0, 0, 0, 0, 2991, 0, 3013, 0, 3008, 0, 3010, 2997, 3003,
+    0, 2999, 3006, 0, 2998, 0, 0, 2992, 0, 3000, 0, 3004, 0, 2633, 0, 3174,
+    0, 2986, 2990, 0, 3011, 0, 0, 2991, 3001, 3013, 3007, 0, 3009, 3010, 2997, 3003,
+    3005, 2999, 3006, 0, 2998, 2988, 2989, 2992, 0, 3000, 3002, 3004, 3172, 0, 3173, 0,
+    2985, 2986, 2990, 2993, 3011, 3012, 2996, 2991, 3001, 3013, 0, 3008, 3009, 3010, 2997, 3003,
+    3005, 2999, 3006, 2995, 2998, 2988, 2989, 2992, 2994, 3000, 3002, 3004, 0, 0, 0, 0,
+    0, 2986, 2990, 2993, 0, 3012, 2996, 2991, 3001, 3013, 0, 3008, 3009, 3010, 2997, 3003,
+    3005, 2999, 3006, 2995, 2998, 2988, 2989, 2992, 2994, 3000, 3002, 3004, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 0, 0, 0, 0, 0,
+    3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201,
+    3202, 3203, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 1070, 509, 3213, 3214, 0,
+    492, 494, 1070, 495, 496, 1085, 498, 499, 500, 501, 502, 503, 504, 505, 506, 508,
+    1078, 509, 1258, 510, 511, 1113, 512, 1118, 1259, 1082, 3215, 2051, 3216, 3217, 3218, 3219,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3220, 3221, 3222, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3224, 3225, 1828, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1332, 3226, 3227, 3228, 1275, 3229, 3230, 1650, 3231, 3232, 3233, 3234, 3235, 3236, 3237, 3238,
+    3239, 3240, 1368, 3241, 3242, 3243, 3244, 3245, 3246, 1269, 1642, 3247, 1777, 1645, 1778, 3248,
+    1424, 3249, 3250, 3251, 3252, 3253, 1760, 1342, 3254, 3255, 3256, 3257, 0, 0, 0, 0,
+    3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 0, 0, 0, 0, 0, 0, 0,
+    3267, 3268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1054, 10, 5, 6, 1055, 1056, 1057, 1058, 1059, 1060, 0, 0, 0, 0, 0, 0,
+    3269, 3270, 3271, 3272, 3273, 2418, 3274, 3275, 3276, 3277, 2419, 3278, 3279, 3280, 2420, 3281,
+    3282, 3283, 3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 2478, 3293, 3294, 3295, 3296,
+    3297, 3298, 3299, 3300, 3301, 2483, 2421, 2422, 2484, 3302, 3303, 2229, 3304, 2423, 3305, 3306,
+    3307, 3308, 3308, 3308, 3309, 3310, 3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320,
+    3321, 3322, 3323, 3324, 3325, 3326, 3326, 2486, 3327, 3328, 3329, 3330, 2425, 3331, 3332, 3333,
+    2382, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347, 3348,
+    3349, 3350, 3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359, 3359, 3360, 3361, 3362, 2225,
+    3363, 3364, 3365, 3366, 3367, 3368, 3369, 3370, 2430, 3371, 3372, 3373, 3374, 3375, 3376, 3377,
+    3378, 3379, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 2171, 3392,
+    3393, 3394, 3394, 3395, 3396, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 3405, 3406,
+    3407, 3408, 3409, 2431, 3410, 3411, 3412, 3413, 2498, 3413, 3414, 2433, 3415, 3416, 3417, 3418,
+    2434, 2144, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432,
+    3433, 3434, 3435, 3436, 3437, 3438, 3439, 3440, 2435, 3441, 3442, 3443, 3444, 3445, 3446, 2437,
+    3447, 3448, 3449, 3450, 3451, 3452, 3453, 3454, 2172, 2506, 3455, 3456, 3457, 3458, 3459, 3460,
+    3461, 3462, 2438, 3463, 3464, 3465, 3466, 2549, 3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474,
+    3475, 3476, 3477, 3478, 3479, 2242, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487, 3488, 3489,
+    3490, 2439, 2329, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 2510, 3499, 3500, 3501, 3502,
+    3503, 3504, 3505, 3506, 2511, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514, 3515, 3516, 3517,
+    3518, 2513, 3519, 3520, 3521, 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3529, 3530, 3531,
+    2515, 3532, 3533, 3534, 3535, 3536, 3537, 3538, 2228, 3539, 3540, 3541, 3542, 3543, 3544, 3545,
+    2521, 3546, 3547, 3548, 3549, 3550, 3551, 3551, 2522, 2551, 3552, 3553, 3554, 3555, 3556, 2190,
+    2524, 3557, 3558, 2450, 3559, 3560, 2404, 3561, 3562, 2454, 3563, 3564, 3565, 3566, 3566, 3567,
+    3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 3581, 3582, 3583,
+    3584, 3585, 3586, 3587, 3588, 3589, 3590, 3591, 3592, 3593, 2460, 3594, 3595, 3596, 3597, 3598,
+    3599, 3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3395, 3610, 3611, 3612, 3613,
+    3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621, 2246, 3622, 3623, 3624, 3625, 3626, 3627, 2463,
+    3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639, 3640, 3641, 3642, 3643,
+    3644, 3645, 3646, 3647, 2185, 3648, 3649, 3650, 3651, 3652, 3653, 2531, 3654, 3655, 3656, 3657,
+    3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673,
+    2536, 2537, 3674, 3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3684, 3685, 3686, 2538,
+    3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698, 3699, 3700, 3701, 3702,
+    3703, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 3712, 3713, 3714, 3715, 3716, 2544, 2544,
+    3717, 3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 2545, 3727, 3728, 3729, 3730, 3731,
+    3732, 3733, 3734, 3735, 3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743, 3744, 3745, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+inline constexpr DecompositionRecord sDecompositionRecords[] = {
+    {0, 0},
+    {0, 1},
+    {0, 3},
+    {0, 6},
+    {0, 8},
+    {0, 11},
+    {0, 13},
+    {0, 15},
+    {0, 18},
+    {0, 20},
+    {0, 23},
+    {0, 25},
+    {0, 27},
+    {0, 31},
+    {0, 35},
+    {39, 39},
+    {42, 42},
+    {45, 45},
+    {48, 48},
+    {51, 51},
+    {54, 54},
+    {57, 57},
+    {60, 60},
+    {63, 63},
+    {66, 66},
+    {69, 69},
+    {72, 72},
+    {75, 75},
+    {78, 78},
+    {81, 81},
+    {84, 84},
+    {87, 87},
+    {90, 90},
+    {93, 93},
+    {96, 96},
+    {99, 99},
+    {102, 102},
+    {105, 105},
+    {108, 108},
+    {111, 111},
+    {114, 114},
+    {117, 117},
+    {120, 120},
+    {123, 123},
+    {126, 126},
+    {129, 129},
+    {132, 132},
+    {135, 135},
+    {138, 138},
+    {141, 141},
+    {144, 144},
+    {147, 147},
+    {150, 150},
+    {153, 153},
+    {156, 156},
+    {159, 159},
+    {162, 162},
+    {165, 165},
+    {168, 168},
+    {171, 171},
+    {174, 174},
+    {177, 177},
+    {180, 180},
+    {183, 183},
+    {186, 186},
+    {189, 189},
+    {192, 192},
+    {195, 195},
+    {198, 198},
+    {201, 201},
+    {204, 204},
+    {207, 207},
+    {210, 210},
+    {213, 213},
+    {216, 216},
+    {219, 219},
+    {222, 222},
+    {225, 225},
+    {228, 228},
+    {231, 231},
+    {234, 234},
+    {237, 237},
+    {240, 240},
+    {243, 243},
+    {246, 246},
+    {249, 249},
+    {252, 252},
+    {255, 255},
+    {258, 258},
+    {261, 261},
+    {264, 264},
+    {267, 267},
+    {270, 270},
+    {273, 273},
+    {276, 276},
+    {279, 279},
+    {282, 282},
+    {285, 285},
+    {288, 288},
+    {291, 291},
+    {294, 294},
+    {297, 297},
+    {300, 300},
+    {303, 303},
+    {306, 306},
+    {309, 309},
+    {312, 312},
+    {315, 315},
+    {318, 318},
+    {321, 321},
+    {324, 324},
+    {327, 327},
+    {330, 330},
+    {0, 333},
+    {0, 336},
+    {339, 339},
+    {342, 342},
+    {345, 345},
+    {348, 348},
+    {351, 351},
+    {354, 354},
+    {357, 357},
+    {360, 360},
+    {363, 363},
+    {366, 366},
+    {0, 369},
+    {0, 372},
+    {375, 375},
+    {378, 378},
+    {381, 381},
+    {384, 384},
+    {387, 387},
+    {390, 390},
+    {0, 393},
+    {396, 396},
+    {399, 399},
+    {402, 402},
+    {405, 405},
+    {408, 408},
+    {411, 411},
+    {414, 414},
+    {417, 417},
+    {420, 420},
+    {423, 423},
+    {426, 426},
+    {429, 429},
+    {432, 432},
+    {435, 435},
+    {438, 438},
+    {441, 441},
+    {444, 444},
+    {447, 447},
+    {450, 450},
+    {453, 453},
+    {456, 456},
+    {459, 459},
+    {462, 462},
+    {465, 465},
+    {468, 468},
+    {471, 471},
+    {474, 474},
+    {477, 477},
+    {480, 480},
+    {483, 483},
+    {486, 486},
+    {489, 489},
+    {492, 492},
+    {495, 495},
+    {498, 498},
+    {501, 501},
+    {504, 504},
+    {507, 507},
+    {510, 510},
+    {513, 513},
+    {516, 516},
+    {519, 519},
+    {522, 522},
+    {525, 525},
+    {528, 528},
+    {531, 531},
+    {534, 534},
+    {0, 537},
+    {539, 539},
+    {542, 542},
+    {545, 545},
+    {548, 548},
+    {0, 551},
+    {0, 555},
+    {0, 559},
+    {0, 563},
+    {0, 566},
+    {0, 569},
+    {0, 572},
+    {0, 575},
+    {0, 578},
+    {581, 581},
+    {584, 584},
+    {587, 587},
+    {590, 590},
+    {593, 593},
+    {596, 596},
+    {599, 599},
+    {602, 602},
+    {605, 605},
+    {609, 609},
+    {613, 613},
+    {617, 617},
+    {621, 621},
+    {625, 625},
+    {629, 629},
+    {633, 633},
+    {637, 637},
+    {641, 641},
+    {645, 645},
+    {649, 649},
+    {653, 653},
+    {656, 656},
+    {659, 659},
+    {662, 662},
+    {665, 665},
+    {668, 668},
+    {671, 671},
+    {674, 674},
+    {677, 677},
+    {681, 681},
+    {685, 685},
+    {688, 688},
+    {691, 691},
+    {0, 694},
+    {0, 697},
+    {0, 700},
+    {703, 703},
+    {706, 706},
+    {709, 709},
+    {712, 712},
+    {715, 715},
+    {719, 719},
+    {723, 723},
+    {726, 726},
+    {729, 729},
+    {732, 732},
+    {735, 735},
+    {738, 738},
+    {741, 741},
+    {744, 744},
+    {747, 747},
+    {750, 750},
+    {753, 753},
+    {756, 756},
+    {759, 759},
+    {762, 762},
+    {765, 765},
+    {768, 768},
+    {771, 771},
+    {774, 774},
+    {777, 777},
+    {780, 780},
+    {783, 783},
+    {786, 786},
+    {789, 789},
+    {792, 792},
+    {795, 795},
+    {798, 798},
+    {801, 801},
+    {804, 804},
+    {807, 807},
+    {810, 810},
+    {813, 813},
+    {816, 816},
+    {819, 819},
+    {822, 822},
+    {825, 825},
+    {828, 828},
+    {831, 831},
+    {834, 834},
+    {837, 837},
+    {841, 841},
+    {845, 845},
+    {849, 849},
+    {853, 853},
+    {856, 856},
+    {859, 859},
+    {863, 863},
+    {867, 867},
+    {870, 870},
+    {0, 873},
+    {0, 875},
+    {0, 877},
+    {0, 879},
+    {0, 881},
+    {0, 883},
+    {0, 885},
+    {0, 887},
+    {0, 889},
+    {0, 891},
+    {0, 894},
+    {0, 897},
+    {0, 900},
+    {0, 903},
+    {0, 906},
+    {0, 909},
+    {0, 911},
+    {0, 913},
+    {0, 915},
+    {917, 917},
+    {919, 919},
+    {921, 921},
+    {923, 923},
+    {926, 926},
+    {0, 928},
+    {931, 931},
+    {933, 936},
+    {940, 940},
+    {943, 943},
+    {945, 945},
+    {948, 948},
+    {951, 951},
+    {954, 954},
+    {957, 957},
+    {960, 960},
+    {963, 963},
+    {967, 967},
+    {970, 970},
+    {973, 973},
+    {976, 976},
+    {979, 979},
+    {982, 982},
+    {985, 985},
+    {989, 989},
+    {992, 992},
+    {995, 995},
+    {998, 998},
+    {1001, 1001},
+    {0, 1004},
+    {0, 1006},
+    {0, 1008},
+    {1010, 957},
+    {1013, 970},
+    {0, 1016},
+    {0, 1018},
+    {0, 1020},
+    {0, 1022},
+    {0, 1024},
+    {0, 1026},
+    {0, 1028},
+    {0, 1030},
+    {1032, 1032},
+    {1035, 1035},
+    {1038, 1038},
+    {1041, 1041},
+    {1044, 1044},
+    {1047, 1047},
+    {1050, 1050},
+    {1053, 1053},
+    {1056, 1056},
+    {1059, 1059},
+    {1062, 1062},
+    {1065, 1065},
+    {1068, 1068},
+    {1071, 1071},
+    {1074, 1074},
+    {1077, 1077},
+    {1080, 1080},
+    {1083, 1083},
+    {1086, 1086},
+    {1089, 1089},
+    {1092, 1092},
+    {1095, 1095},
+    {1098, 1098},
+    {1101, 1101},
+    {1104, 1104},
+    {1107, 1107},
+    {1110, 1110},
+    {1113, 1113},
+    {1116, 1116},
+    {1119, 1119},
+    {1122, 1122},
+    {1125, 1125},
+    {1128, 1128},
+    {1131, 1131},
+    {1134, 1134},
+    {1137, 1137},
+    {1140, 1140},
+    {1143, 1143},
+    {1146, 1146},
+    {1149, 1149},
+    {1152, 1152},
+    {1155, 1155},
+    {1158, 1158},
+    {1161, 1161},
+    {1164, 1164},
+    {1167, 1167},
+    {1170, 1170},
+    {1173, 1173},
+    {1176, 1176},
+    {1179, 1179},
+    {1182, 1182},
+    {1185, 1185},
+    {0, 1188},
+    {1191, 1191},
+    {1194, 1194},
+    {1197, 1197},
+    {1200, 1200},
+    {1203, 1203},
+    {0, 1206},
+    {0, 1209},
+    {0, 1212},
+    {0, 1215},
+    {1218, 1218},
+    {1221, 1221},
+    {1224, 1224},
+    {1227, 1227},
+    {1230, 1230},
+    {1233, 1233},
+    {1236, 1236},
+    {1239, 1239},
+    {1242, 1242},
+    {1245, 1245},
+    {1248, 1248},
+    {1251, 1251},
+    {1254, 1254},
+    {1257, 1257},
+    {1260, 1260},
+    {1263, 1263},
+    {1266, 1266},
+    {1269, 1269},
+    {1272, 1272},
+    {1275, 1275},
+    {1278, 1278},
+    {1281, 1281},
+    {1284, 1284},
+    {1287, 1287},
+    {1290, 1290},
+    {1293, 1293},
+    {1296, 1296},
+    {1299, 1299},
+    {1302, 1302},
+    {1305, 1305},
+    {1308, 1308},
+    {1311, 1311},
+    {1314, 1314},
+    {1317, 1317},
+    {1320, 1320},
+    {1323, 1323},
+    {1326, 1326},
+    {1329, 1329},
+    {1332, 1332},
+    {1335, 1335},
+    {1339, 1339},
+    {1342, 1342},
+    {1345, 1345},
+    {1348, 1348},
+    {1351, 1351},
+    {1354, 1354},
+    {1358, 1358},
+    {0, 1361},
+    {0, 1364},
+    {0, 1367},
+    {0, 1370},
+    {0, 1373},
+    {1375, 1375},
+    {1378, 1378},
+    {1381, 1381},
+    {1384, 1384},
+    {1387, 1387},
+    {1390, 1390},
+    {1393, 1393},
+    {1396, 1396},
+    {1399, 1399},
+    {0, 1402},
+    {1406, 1406},
+    {0, 1409},
+    {1413, 1413},
+    {1416, 1416},
+    {1419, 1419},
+    {1422, 1422},
+    {1425, 1425},
+    {1428, 1428},
+    {1431, 1431},
+    {1434, 1434},
+    {0, 1437},
+    {1439, 1439},
+    {1442, 1442},
+    {1445, 1445},
+    {1448, 1448},
+    {1451, 1451},
+    {1454, 1454},
+    {1457, 1457},
+    {1460, 1460},
+    {1463, 1463},
+    {1466, 1466},
+    {1469, 1469},
+    {0, 1472},
+    {0, 1474},
+    {0, 1476},
+    {0, 1478},
+    {0, 1480},
+    {0, 1482},
+    {0, 1484},
+    {0, 1486},
+    {0, 1488},
+    {0, 1490},
+    {0, 1492},
+    {0, 1494},
+    {0, 1496},
+    {0, 1498},
+    {0, 1500},
+    {0, 1502},
+    {0, 1504},
+    {0, 1506},
+    {0, 1508},
+    {0, 1510},
+    {0, 1512},
+    {0, 1514},
+    {0, 1516},
+    {0, 1518},
+    {0, 1520},
+    {0, 1522},
+    {0, 1524},
+    {0, 1526},
+    {0, 1528},
+    {0, 1530},
+    {0, 1532},
+    {0, 1534},
+    {0, 1536},
+    {0, 1538},
+    {0, 1540},
+    {0, 1542},
+    {0, 1544},
+    {0, 1546},
+    {0, 1548},
+    {0, 1550},
+    {0, 1552},
+    {0, 1554},
+    {0, 1556},
+    {0, 1558},
+    {0, 1560},
+    {0, 1562},
+    {0, 1564},
+    {0, 1566},
+    {0, 1568},
+    {0, 1570},
+    {0, 1572},
+    {0, 1574},
+    {0, 1576},
+    {0, 1578},
+    {0, 1580},
+    {0, 1582},
+    {0, 1584},
+    {0, 1586},
+    {0, 1588},
+    {0, 1590},
+    {0, 1592},
+    {0, 1594},
+    {0, 1596},
+    {0, 1598},
+    {0, 1600},
+    {0, 1602},
+    {0, 1604},
+    {0, 1606},
+    {0, 1608},
+    {0, 1610},
+    {0, 1612},
+    {0, 1614},
+    {0, 1616},
+    {0, 1618},
+    {0, 1620},
+    {0, 1622},
+    {0, 1624},
+    {0, 1626},
+    {0, 1628},
+    {0, 1630},
+    {0, 1632},
+    {0, 1634},
+    {0, 1636},
+    {0, 1638},
+    {1640, 1640},
+    {1643, 1643},
+    {1646, 1646},
+    {1649, 1649},
+    {1652, 1652},
+    {1655, 1655},
+    {1658, 1658},
+    {1661, 1661},
+    {1664, 1664},
+    {1668, 1668},
+    {1672, 1672},
+    {1675, 1675},
+    {1678, 1678},
+    {1681, 1681},
+    {1684, 1684},
+    {1687, 1687},
+    {1690, 1690},
+    {1693, 1693},
+    {1696, 1696},
+    {1699, 1699},
+    {1702, 1702},
+    {1706, 1706},
+    {1710, 1710},
+    {1714, 1714},
+    {1718, 1718},
+    {1721, 1721},
+    {1724, 1724},
+    {1727, 1727},
+    {1730, 1730},
+    {1734, 1734},
+    {1738, 1738},
+    {1741, 1741},
+    {1744, 1744},
+    {1747, 1747},
+    {1750, 1750},
+    {1753, 1753},
+    {1756, 1756},
+    {1759, 1759},
+    {1762, 1762},
+    {1765, 1765},
+    {1768, 1768},
+    {1771, 1771},
+    {1774, 1774},
+    {1777, 1777},
+    {1780, 1780},
+    {1783, 1783},
+    {1786, 1786},
+    {1790, 1790},
+    {1794, 1794},
+    {1797, 1797},
+    {1800, 1800},
+    {1803, 1803},
+    {1806, 1806},
+    {1809, 1809},
+    {1812, 1812},
+    {1815, 1815},
+    {1818, 1818},
+    {1822, 1822},
+    {1826, 1826},
+    {1829, 1829},
+    {1832, 1832},
+    {1835, 1835},
+    {1838, 1838},
+    {1841, 1841},
+    {1844, 1844},
+    {1847, 1847},
+    {1850, 1850},
+    {1853, 1853},
+    {1856, 1856},
+    {1859, 1859},
+    {1862, 1862},
+    {1865, 1865},
+    {1868, 1868},
+    {1871, 1871},
+    {1874, 1874},
+    {1877, 1877},
+    {1880, 1880},
+    {1884, 1884},
+    {1888, 1888},
+    {1892, 1892},
+    {1896, 1896},
+    {1900, 1900},
+    {1904, 1904},
+    {1908, 1908},
+    {1912, 1912},
+    {1915, 1915},
+    {1918, 1918},
+    {1921, 1921},
+    {1924, 1924},
+    {1927, 1927},
+    {1930, 1930},
+    {1933, 1933},
+    {1936, 1936},
+    {1940, 1940},
+    {1944, 1944},
+    {1947, 1947},
+    {1950, 1950},
+    {1953, 1953},
+    {1956, 1956},
+    {1959, 1959},
+    {1962, 1962},
+    {1966, 1966},
+    {1970, 1970},
+    {1974, 1974},
+    {1978, 1978},
+    {1982, 1982},
+    {1986, 1986},
+    {1989, 1989},
+    {1992, 1992},
+    {1995, 1995},
+    {1998, 1998},
+    {2001, 2001},
+    {2004, 2004},
+    {2007, 2007},
+    {2010, 2010},
+    {2013, 2013},
+    {2016, 2016},
+    {2019, 2019},
+    {2022, 2022},
+    {2025, 2025},
+    {2028, 2028},
+    {2032, 2032},
+    {2036, 2036},
+    {2040, 2040},
+    {2044, 2044},
+    {2047, 2047},
+    {2050, 2050},
+    {2053, 2053},
+    {2056, 2056},
+    {2059, 2059},
+    {2062, 2062},
+    {2065, 2065},
+    {2068, 2068},
+    {2071, 2071},
+    {2074, 2074},
+    {2077, 2077},
+    {2080, 2080},
+    {2083, 2083},
+    {2086, 2086},
+    {2089, 2089},
+    {2092, 2092},
+    {2095, 2095},
+    {2098, 2098},
+    {2101, 2101},
+    {2104, 2104},
+    {2107, 2107},
+    {2110, 2110},
+    {2113, 2113},
+    {2116, 2116},
+    {2119, 2119},
+    {2122, 2122},
+    {2125, 2125},
+    {2128, 2128},
+    {2131, 2131},
+    {0, 2134},
+    {2137, 1953},
+    {2140, 2140},
+    {2143, 2143},
+    {2146, 2146},
+    {2149, 2149},
+    {2152, 2152},
+    {2156, 2156},
+    {2160, 2160},
+    {2164, 2164},
+    {2168, 2168},
+    {2172, 2172},
+    {2176, 2176},
+    {2180, 2180},
+    {2184, 2184},
+    {2188, 2188},
+    {2192, 2192},
+    {2196, 2196},
+    {2200, 2200},
+    {2204, 2204},
+    {2208, 2208},
+    {2212, 2212},
+    {2216, 2216},
+    {2220, 2220},
+    {2224, 2224},
+    {2228, 2228},
+    {2232, 2232},
+    {2235, 2235},
+    {2238, 2238},
+    {2241, 2241},
+    {2244, 2244},
+    {2247, 2247},
+    {2250, 2250},
+    {2254, 2254},
+    {2258, 2258},
+    {2262, 2262},
+    {2266, 2266},
+    {2270, 2270},
+    {2274, 2274},
+    {2278, 2278},
+    {2282, 2282},
+    {2286, 2286},
+    {2290, 2290},
+    {2293, 2293},
+    {2296, 2296},
+    {2299, 2299},
+    {2302, 2302},
+    {2305, 2305},
+    {2308, 2308},
+    {2311, 2311},
+    {2314, 2314},
+    {2318, 2318},
+    {2322, 2322},
+    {2326, 2326},
+    {2330, 2330},
+    {2334, 2334},
+    {2338, 2338},
+    {2342, 2342},
+    {2346, 2346},
+    {2350, 2350},
+    {2354, 2354},
+    {2358, 2358},
+    {2362, 2362},
+    {2366, 2366},
+    {2370, 2370},
+    {2374, 2374},
+    {2378, 2378},
+    {2382, 2382},
+    {2386, 2386},
+    {2390, 2390},
+    {2394, 2394},
+    {2397, 2397},
+    {2400, 2400},
+    {2403, 2403},
+    {2406, 2406},
+    {2410, 2410},
+    {2414, 2414},
+    {2418, 2418},
+    {2422, 2422},
+    {2426, 2426},
+    {2430, 2430},
+    {2434, 2434},
+    {2438, 2438},
+    {2442, 2442},
+    {2446, 2446},
+    {2449, 2449},
+    {2452, 2452},
+    {2455, 2455},
+    {2458, 2458},
+    {2461, 2461},
+    {2464, 2464},
+    {2467, 2467},
+    {2470, 2470},
+    {2473, 2473},
+    {2476, 2476},
+    {2480, 2480},
+    {2484, 2484},
+    {2488, 2488},
+    {2492, 2492},
+    {2496, 2496},
+    {2500, 2500},
+    {2503, 2503},
+    {2506, 2506},
+    {2510, 2510},
+    {2514, 2514},
+    {2518, 2518},
+    {2522, 2522},
+    {2526, 2526},
+    {2530, 2530},
+    {2533, 2533},
+    {2536, 2536},
+    {2540, 2540},
+    {2544, 2544},
+    {2548, 2548},
+    {2552, 2552},
+    {2555, 2555},
+    {2558, 2558},
+    {2562, 2562},
+    {2566, 2566},
+    {2570, 2570},
+    {2574, 2574},
+    {2577, 2577},
+    {2580, 2580},
+    {2584, 2584},
+    {2588, 2588},
+    {2592, 2592},
+    {2596, 2596},
+    {2600, 2600},
+    {2604, 2604},
+    {2607, 2607},
+    {2610, 2610},
+    {2614, 2614},
+    {2618, 2618},
+    {2622, 2622},
+    {2626, 2626},
+    {2630, 2630},
+    {2634, 2634},
+    {2637, 2637},
+    {2640, 2640},
+    {2644, 2644},
+    {2648, 2648},
+    {2652, 2652},
+    {2656, 2656},
+    {2660, 2660},
+    {2664, 2664},
+    {2667, 2667},
+    {2670, 2670},
+    {2674, 2674},
+    {2678, 2678},
+    {2682, 2682},
+    {2686, 2686},
+    {2690, 2690},
+    {2694, 2694},
+    {2697, 2697},
+    {2700, 2700},
+    {2704, 2704},
+    {2708, 2708},
+    {2712, 2712},
+    {2716, 2716},
+    {2719, 2719},
+    {2722, 2722},
+    {2726, 2726},
+    {2730, 2730},
+    {2734, 2734},
+    {2738, 2738},
+    {2741, 2741},
+    {2744, 2744},
+    {2748, 2748},
+    {2752, 2752},
+    {2756, 2756},
+    {2760, 2760},
+    {2764, 2764},
+    {2768, 2768},
+    {2771, 2771},
+    {2775, 2775},
+    {2779, 2779},
+    {2783, 2783},
+    {2786, 2786},
+    {2789, 2789},
+    {2793, 2793},
+    {2797, 2797},
+    {2801, 2801},
+    {2805, 2805},
+    {2809, 2809},
+    {2813, 2813},
+    {2816, 2816},
+    {2819, 2819},
+    {2823, 2823},
+    {2827, 2827},
+    {2831, 2831},
+    {2835, 2835},
+    {2839, 2839},
+    {2843, 2843},
+    {2846, 2846},
+    {2849, 2849},
+    {2852, 2852},
+    {2855, 2855},
+    {2858, 2858},
+    {2861, 2861},
+    {2864, 2864},
+    {2868, 2868},
+    {2872, 2872},
+    {2877, 2877},
+    {2882, 2882},
+    {2887, 2887},
+    {2892, 2892},
+    {2897, 2897},
+    {2902, 2902},
+    {2906, 2906},
+    {2910, 2910},
+    {2915, 2915},
+    {2920, 2920},
+    {2925, 2925},
+    {2930, 2930},
+    {2935, 2935},
+    {2940, 2940},
+    {2944, 2944},
+    {2948, 2948},
+    {2953, 2953},
+    {2958, 2958},
+    {2963, 2963},
+    {2968, 2968},
+    {2973, 2973},
+    {2978, 2978},
+    {2982, 2982},
+    {2986, 2986},
+    {2991, 2991},
+    {2996, 2996},
+    {3001, 3001},
+    {3006, 3006},
+    {3011, 3011},
+    {3016, 3016},
+    {3020, 3020},
+    {3024, 3024},
+    {3029, 3029},
+    {3034, 3034},
+    {3039, 3039},
+    {3044, 3044},
+    {3049, 3049},
+    {3054, 3054},
+    {3058, 3058},
+    {3062, 3062},
+    {3067, 3067},
+    {3072, 3072},
+    {3077, 3077},
+    {3082, 3082},
+    {3087, 3087},
+    {3092, 3092},
+    {3095, 3095},
+    {3098, 3098},
+    {3102, 3102},
+    {3105, 3105},
+    {3109, 3109},
+    {3112, 3112},
+    {3116, 3116},
+    {3119, 3119},
+    {3122, 3122},
+    {3125, 3125},
+    {0, 3128},
+    {3131, 3131},
+    {0, 3133},
+    {3136, 3139},
+    {3143, 3143},
+    {3147, 3147},
+    {3150, 3150},
+    {3154, 3154},
+    {3157, 3157},
+    {3161, 3161},
+    {3164, 3164},
+    {3167, 3167},
+    {3170, 3173},
+    {3177, 3180},
+    {3184, 3187},
+    {3191, 3191},
+    {3194, 3194},
+    {3197, 3197},
+    {3201, 3201},
+    {3204, 3204},
+    {3208, 3208},
+    {3211, 3211},
+    {3214, 3214},
+    {3217, 3220},
+    {3224, 3227},
+    {3231, 3234},
+    {3238, 3238},
+    {3241, 3241},
+    {3244, 3244},
+    {3248, 3248},
+    {3251, 3251},
+    {3254, 3254},
+    {3257, 3257},
+    {3261, 3261},
+    {3264, 3264},
+    {3267, 3267},
+    {3270, 3270},
+    {3273, 3276},
+    {3280, 3280},
+    {3282, 3282},
+    {3286, 3286},
+    {3289, 3289},
+    {3293, 3293},
+    {3296, 3296},
+    {3300, 3300},
+    {3303, 3303},
+    {3306, 3306},
+    {3309, 15},
+    {0, 3311},
+    {3314, 1},
+    {3316, 1},
+    {0, 3318},
+    {0, 3320},
+    {0, 3323},
+    {0, 3325},
+    {0, 3328},
+    {0, 3332},
+    {0, 3335},
+    {0, 3339},
+    {0, 3342},
+    {0, 3346},
+    {0, 3349},
+    {0, 3352},
+    {0, 3355},
+    {0, 3358},
+    {0, 3361},
+    {0, 3366},
+    {0, 3368},
+    {0, 3370},
+    {0, 3372},
+    {0, 3374},
+    {0, 3376},
+    {0, 3378},
+    {0, 3380},
+    {0, 3382},
+    {0, 3384},
+    {0, 3386},
+    {0, 3388},
+    {0, 3390},
+    {0, 3392},
+    {0, 3395},
+    {0, 3399},
+    {0, 3403},
+    {0, 3405},
+    {0, 3408},
+    {0, 3412},
+    {0, 3416},
+    {0, 3418},
+    {0, 3421},
+    {0, 3423},
+    {0, 3426},
+    {0, 3428},
+    {0, 3431},
+    {0, 3435},
+    {0, 3438},
+    {3440, 3440},
+    {1492, 1492},
+    {0, 3442},
+    {0, 3444},
+    {0, 3446},
+    {0, 3448},
+    {0, 3450},
+    {0, 3452},
+    {0, 3456},
+    {0, 3458},
+    {0, 3460},
+    {0, 3462},
+    {0, 3466},
+    {0, 3470},
+    {0, 3475},
+    {0, 3479},
+    {0, 3483},
+    {0, 3487},
+    {0, 3491},
+    {0, 3495},
+    {0, 3499},
+    {0, 3503},
+    {0, 3507},
+    {0, 3511},
+    {0, 3515},
+    {0, 3519},
+    {0, 3523},
+    {0, 3526},
+    {0, 3529},
+    {0, 3533},
+    {0, 3536},
+    {0, 3538},
+    {0, 3541},
+    {0, 3545},
+    {0, 3550},
+    {0, 3553},
+    {0, 3555},
+    {0, 3558},
+    {0, 3562},
+    {0, 3565},
+    {0, 3569},
+    {0, 3572},
+    {0, 3575},
+    {0, 3579},
+    {0, 3584},
+    {0, 3587},
+    {0, 3590},
+    {0, 3594},
+    {3598, 3598},
+    {3601, 3601},
+    {3604, 3604},
+    {3607, 3607},
+    {3610, 3610},
+    {3613, 3613},
+    {3616, 3616},
+    {3619, 3619},
+    {3622, 3622},
+    {3625, 3625},
+    {3628, 3628},
+    {0, 3631},
+    {0, 3634},
+    {0, 3638},
+    {0, 3641},
+    {3645, 3645},
+    {3648, 3648},
+    {3651, 3651},
+    {3654, 3654},
+    {3657, 3657},
+    {3660, 3660},
+    {3663, 3663},
+    {3666, 3666},
+    {3669, 3669},
+    {3672, 3672},
+    {3675, 3675},
+    {3678, 3678},
+    {3681, 3681},
+    {3684, 3684},
+    {3687, 3687},
+    {3690, 3690},
+    {3693, 3693},
+    {3696, 3696},
+    {3699, 3699},
+    {3702, 3702},
+    {3705, 3705},
+    {3708, 3708},
+    {3711, 3711},
+    {3714, 3714},
+    {3717, 3717},
+    {3720, 3720},
+    {3723, 3723},
+    {3726, 3726},
+    {3729, 3729},
+    {3732, 3732},
+    {3735, 3735},
+    {3738, 3738},
+    {3741, 3741},
+    {3744, 3744},
+    {3746, 3746},
+    {0, 3748},
+    {0, 3751},
+    {0, 3754},
+    {0, 3757},
+    {0, 3760},
+    {0, 3763},
+    {0, 3766},
+    {0, 3769},
+    {0, 3772},
+    {0, 3775},
+    {0, 3778},
+    {0, 3781},
+    {0, 3785},
+    {0, 3789},
+    {0, 3793},
+    {0, 3797},
+    {0, 3801},
+    {0, 3805},
+    {0, 3809},
+    {0, 3813},
+    {0, 3817},
+    {0, 3822},
+    {0, 3827},
+    {0, 3832},
+    {0, 3837},
+    {0, 3842},
+    {0, 3847},
+    {0, 3852},
+    {0, 3857},
+    {0, 3862},
+    {0, 3867},
+    {0, 3872},
+    {0, 3875},
+    {0, 3878},
+    {0, 3881},
+    {0, 3884},
+    {0, 3887},
+    {0, 3890},
+    {0, 3893},
+    {0, 3896},
+    {0, 3899},
+    {0, 3903},
+    {0, 3907},
+    {0, 3911},
+    {0, 3915},
+    {0, 3919},
+    {0, 3923},
+    {0, 3927},
+    {0, 3931},
+    {0, 3935},
+    {0, 3939},
+    {0, 3943},
+    {0, 3947},
+    {0, 3951},
+    {0, 3955},
+    {0, 3959},
+    {0, 3963},
+    {0, 3967},
+    {0, 3971},
+    {0, 3975},
+    {0, 3979},
+    {0, 3983},
+    {0, 3987},
+    {0, 3991},
+    {0, 3995},
+    {0, 3999},
+    {0, 4003},
+    {0, 4007},
+    {0, 4011},
+    {0, 4015},
+    {0, 4019},
+    {0, 4023},
+    {0, 4027},
+    {0, 4031},
+    {0, 4035},
+    {0, 4039},
+    {0, 4043},
+    {0, 4047},
+    {0, 4049},
+    {0, 4051},
+    {0, 4053},
+    {0, 4058},
+    {0, 4062},
+    {0, 4065},
+    {4069, 4069},
+    {0, 4072},
+    {0, 4074},
+    {0, 4076},
+    {0, 4078},
+    {0, 4080},
+    {0, 4082},
+    {0, 4084},
+    {0, 4086},
+    {0, 4088},
+    {0, 4090},
+    {0, 4092},
+    {0, 4094},
+    {0, 4096},
+    {0, 4098},
+    {0, 4100},
+    {0, 4102},
+    {0, 4104},
+    {0, 4106},
+    {0, 4108},
+    {0, 4110},
+    {0, 4112},
+    {0, 4114},
+    {0, 4116},
+    {0, 4118},
+    {0, 4120},
+    {0, 4122},
+    {0, 4124},
+    {0, 4126},
+    {0, 4128},
+    {0, 4130},
+    {0, 4132},
+    {0, 4134},
+    {0, 4136},
+    {0, 4138},
+    {0, 4140},
+    {0, 4142},
+    {0, 4144},
+    {0, 4146},
+    {0, 4148},
+    {0, 4150},
+    {0, 4152},
+    {0, 4154},
+    {0, 4156},
+    {0, 4158},
+    {0, 4160},
+    {0, 4162},
+    {0, 4164},
+    {0, 4166},
+    {0, 4168},
+    {0, 4170},
+    {0, 4172},
+    {0, 4174},
+    {0, 4176},
+    {0, 4178},
+    {0, 4180},
+    {0, 4182},
+    {0, 4184},
+    {0, 4186},
+    {0, 4188},
+    {0, 4190},
+    {0, 4192},
+    {0, 4194},
+    {0, 4196},
+    {0, 4198},
+    {0, 4200},
+    {0, 4202},
+    {0, 4204},
+    {0, 4206},
+    {0, 4208},
+    {0, 4210},
+    {0, 4212},
+    {0, 4214},
+    {0, 4216},
+    {0, 4218},
+    {0, 4220},
+    {0, 4222},
+    {0, 4224},
+    {0, 4226},
+    {0, 4228},
+    {0, 4230},
+    {0, 4232},
+    {0, 4234},
+    {0, 4236},
+    {0, 4238},
+    {0, 4240},
+    {0, 4242},
+    {0, 4244},
+    {0, 4246},
+    {0, 4248},
+    {0, 4250},
+    {0, 4252},
+    {0, 4254},
+    {0, 4256},
+    {0, 4258},
+    {0, 4260},
+    {0, 4262},
+    {0, 4264},
+    {0, 4266},
+    {0, 4268},
+    {0, 4270},
+    {0, 4272},
+    {0, 4274},
+    {0, 4276},
+    {0, 4278},
+    {0, 4280},
+    {0, 4282},
+    {0, 4284},
+    {0, 4286},
+    {0, 4288},
+    {0, 4290},
+    {0, 4292},
+    {0, 4294},
+    {0, 4296},
+    {0, 4298},
+    {0, 4300},
+    {0, 4302},
+    {0, 4304},
+    {0, 4306},
+    {0, 4308},
+    {0, 4310},
+    {0, 4312},
+    {0, 4314},
+    {0, 4316},
+    {0, 4318},
+    {0, 4320},
+    {0, 4322},
+    {0, 4324},
+    {0, 4326},
+    {0, 4328},
+    {0, 4330},
+    {0, 4332},
+    {0, 4334},
+    {0, 4336},
+    {0, 4338},
+    {0, 4340},
+    {0, 4342},
+    {0, 4344},
+    {0, 4346},
+    {0, 4348},
+    {0, 4350},
+    {0, 4352},
+    {0, 4354},
+    {0, 4356},
+    {0, 4358},
+    {0, 4360},
+    {0, 4362},
+    {0, 4364},
+    {0, 4366},
+    {0, 4368},
+    {0, 4370},
+    {0, 4372},
+    {0, 4374},
+    {0, 4376},
+    {0, 4378},
+    {0, 4380},
+    {0, 4382},
+    {0, 4384},
+    {0, 4386},
+    {0, 4388},
+    {0, 4390},
+    {0, 4392},
+    {0, 4394},
+    {0, 4396},
+    {0, 4398},
+    {0, 4400},
+    {0, 4402},
+    {0, 4404},
+    {0, 4406},
+    {0, 4408},
+    {0, 4410},
+    {0, 4412},
+    {0, 4414},
+    {0, 4416},
+    {0, 4418},
+    {0, 4420},
+    {0, 4422},
+    {0, 4424},
+    {0, 4426},
+    {0, 4428},
+    {0, 4430},
+    {0, 4432},
+    {0, 4434},
+    {0, 4436},
+    {0, 4438},
+    {0, 4440},
+    {0, 4442},
+    {0, 4444},
+    {0, 4446},
+    {0, 4448},
+    {0, 4450},
+    {0, 4452},
+    {0, 4454},
+    {0, 4456},
+    {0, 4458},
+    {0, 4460},
+    {0, 4462},
+    {0, 4464},
+    {0, 4466},
+    {0, 4468},
+    {0, 4470},
+    {0, 4472},
+    {0, 4474},
+    {0, 4476},
+    {0, 4478},
+    {0, 4480},
+    {0, 4482},
+    {0, 4484},
+    {0, 4486},
+    {0, 4488},
+    {0, 4490},
+    {0, 4492},
+    {0, 4494},
+    {0, 4496},
+    {0, 4498},
+    {0, 4500},
+    {0, 4502},
+    {0, 4504},
+    {0, 4506},
+    {0, 4508},
+    {0, 4510},
+    {4512, 4512},
+    {4515, 4515},
+    {4518, 4518},
+    {4521, 4521},
+    {4524, 4524},
+    {4527, 4527},
+    {4530, 4530},
+    {4533, 4533},
+    {4536, 4536},
+    {4539, 4539},
+    {4542, 4542},
+    {4545, 4545},
+    {4548, 4548},
+    {4551, 4551},
+    {4554, 4554},
+    {4557, 4557},
+    {4560, 4560},
+    {4563, 4563},
+    {4566, 4566},
+    {4569, 4569},
+    {4572, 4572},
+    {4575, 4575},
+    {4578, 4578},
+    {4581, 4581},
+    {4584, 4584},
+    {4587, 4587},
+    {0, 4590},
+    {0, 4593},
+    {4596, 4596},
+    {0, 4599},
+    {4602, 4602},
+    {4605, 4605},
+    {4608, 4608},
+    {4611, 4611},
+    {4614, 4614},
+    {4617, 4617},
+    {4620, 4620},
+    {4623, 4623},
+    {4626, 4626},
+    {4629, 4629},
+    {4632, 4632},
+    {4635, 4635},
+    {4638, 4638},
+    {4641, 4641},
+    {4644, 4644},
+    {4647, 4647},
+    {4650, 4650},
+    {4653, 4653},
+    {4656, 4656},
+    {4659, 4659},
+    {4662, 4662},
+    {4665, 4665},
+    {4668, 4668},
+    {4671, 4671},
+    {4674, 4674},
+    {4677, 4677},
+    {4680, 4680},
+    {4683, 4683},
+    {4686, 4686},
+    {4689, 4689},
+    {4692, 4692},
+    {0, 4695},
+    {0, 4698},
+    {0, 4700},
+    {0, 4702},
+    {0, 4704},
+    {0, 4706},
+    {0, 4708},
+    {0, 4710},
+    {0, 4712},
+    {0, 4714},
+    {0, 4716},
+    {0, 4718},
+    {0, 4720},
+    {0, 4722},
+    {0, 4724},
+    {0, 4726},
+    {0, 4728},
+    {0, 4730},
+    {0, 4732},
+    {0, 4734},
+    {0, 4736},
+    {0, 4738},
+    {0, 4740},
+    {0, 4742},
+    {0, 4744},
+    {0, 4746},
+    {0, 4748},
+    {0, 4750},
+    {0, 4752},
+    {0, 4754},
+    {0, 4756},
+    {0, 4758},
+    {0, 4760},
+    {0, 4762},
+    {0, 4764},
+    {0, 4766},
+    {0, 4768},
+    {0, 4770},
+    {0, 4772},
+    {0, 4774},
+    {0, 4776},
+    {0, 4778},
+    {0, 4780},
+    {0, 4782},
+    {0, 4784},
+    {0, 4786},
+    {0, 4788},
+    {0, 4790},
+    {0, 4792},
+    {0, 4794},
+    {0, 4796},
+    {0, 4798},
+    {0, 4800},
+    {0, 4802},
+    {0, 4804},
+    {0, 4806},
+    {0, 4808},
+    {0, 4810},
+    {0, 4812},
+    {0, 4814},
+    {0, 4816},
+    {0, 4818},
+    {0, 4820},
+    {0, 4822},
+    {0, 4824},
+    {0, 4826},
+    {0, 4828},
+    {0, 4830},
+    {0, 4832},
+    {0, 4834},
+    {0, 4836},
+    {0, 4838},
+    {0, 4840},
+    {0, 4842},
+    {0, 4844},
+    {0, 4846},
+    {0, 4848},
+    {0, 4850},
+    {0, 4852},
+    {0, 4854},
+    {0, 4856},
+    {0, 4858},
+    {0, 4860},
+    {0, 4862},
+    {0, 4864},
+    {0, 4866},
+    {0, 4868},
+    {0, 4870},
+    {0, 4872},
+    {0, 4874},
+    {0, 4876},
+    {0, 4878},
+    {0, 4880},
+    {0, 4882},
+    {0, 4884},
+    {0, 4886},
+    {0, 4888},
+    {0, 4890},
+    {0, 4892},
+    {0, 4894},
+    {0, 4896},
+    {0, 4898},
+    {0, 4900},
+    {0, 4902},
+    {0, 4904},
+    {0, 4906},
+    {0, 4910},
+    {0, 4914},
+    {0, 4918},
+    {0, 4922},
+    {0, 4926},
+    {0, 4930},
+    {0, 4934},
+    {0, 4938},
+    {0, 4942},
+    {0, 4946},
+    {0, 4950},
+    {0, 4954},
+    {0, 4958},
+    {0, 4962},
+    {0, 4967},
+    {0, 4972},
+    {0, 4977},
+    {0, 4982},
+    {0, 4987},
+    {0, 4992},
+    {0, 4997},
+    {0, 5002},
+    {0, 5007},
+    {0, 5012},
+    {0, 5017},
+    {0, 5022},
+    {0, 5027},
+    {0, 5032},
+    {0, 5037},
+    {0, 5045},
+    {0, 5052},
+    {0, 5056},
+    {0, 5060},
+    {0, 5064},
+    {0, 5068},
+    {0, 5072},
+    {0, 5076},
+    {0, 5080},
+    {0, 5084},
+    {0, 5088},
+    {0, 5092},
+    {0, 5096},
+    {0, 5100},
+    {0, 5104},
+    {0, 5108},
+    {0, 5112},
+    {0, 5116},
+    {0, 5120},
+    {0, 5124},
+    {0, 5128},
+    {0, 5132},
+    {0, 5136},
+    {0, 5140},
+    {0, 5144},
+    {0, 5148},
+    {0, 5152},
+    {0, 5156},
+    {0, 5160},
+    {0, 5164},
+    {0, 5168},
+    {0, 5172},
+    {0, 5176},
+    {0, 5180},
+    {0, 5184},
+    {0, 5188},
+    {0, 5192},
+    {0, 5196},
+    {0, 5198},
+    {0, 5200},
+    {0, 5202},
+    {0, 5206},
+    {0, 5209},
+    {0, 5212},
+    {0, 5215},
+    {0, 5218},
+    {0, 5221},
+    {0, 5224},
+    {0, 5227},
+    {0, 5230},
+    {0, 5233},
+    {0, 5236},
+    {0, 5239},
+    {0, 5242},
+    {0, 5245},
+    {0, 5248},
+    {0, 5251},
+    {0, 5254},
+    {0, 5257},
+    {0, 5260},
+    {0, 5263},
+    {0, 5266},
+    {0, 5269},
+    {0, 5272},
+    {0, 5275},
+    {0, 5278},
+    {0, 5281},
+    {0, 5284},
+    {0, 5287},
+    {0, 5290},
+    {0, 5293},
+    {0, 5299},
+    {0, 5304},
+    {0, 5307},
+    {0, 5309},
+    {0, 5311},
+    {0, 5313},
+    {0, 5315},
+    {0, 5317},
+    {0, 5319},
+    {0, 5321},
+    {0, 5323},
+    {0, 5325},
+    {0, 5327},
+    {0, 5329},
+    {0, 5331},
+    {0, 5333},
+    {0, 5335},
+    {0, 5337},
+    {0, 5339},
+    {0, 5341},
+    {0, 5343},
+    {0, 5345},
+    {0, 5347},
+    {0, 5349},
+    {0, 5351},
+    {0, 5353},
+    {0, 5355},
+    {0, 5357},
+    {0, 5359},
+    {0, 5361},
+    {0, 5363},
+    {0, 5365},
+    {0, 5367},
+    {0, 5369},
+    {0, 5371},
+    {0, 5374},
+    {0, 5377},
+    {0, 5380},
+    {0, 5383},
+    {0, 5386},
+    {0, 5389},
+    {0, 5392},
+    {0, 5395},
+    {0, 5398},
+    {0, 5401},
+    {0, 5404},
+    {0, 5407},
+    {0, 5410},
+    {0, 5413},
+    {0, 5416},
+    {0, 5419},
+    {0, 5422},
+    {0, 5425},
+    {0, 5428},
+    {0, 5431},
+    {0, 5434},
+    {0, 5437},
+    {0, 5440},
+    {0, 5443},
+    {0, 5447},
+    {0, 5451},
+    {0, 5455},
+    {0, 5458},
+    {0, 5462},
+    {0, 5465},
+    {0, 5469},
+    {0, 5471},
+    {0, 5473},
+    {0, 5475},
+    {0, 5477},
+    {0, 5479},
+    {0, 5481},
+    {0, 5483},
+    {0, 5485},
+    {0, 5487},
+    {0, 5489},
+    {0, 5491},
+    {0, 5493},
+    {0, 5495},
+    {0, 5497},
+    {0, 5499},
+    {0, 5501},
+    {0, 5503},
+    {0, 5505},
+    {0, 5507},
+    {0, 5509},
+    {0, 5511},
+    {0, 5513},
+    {0, 5515},
+    {0, 5517},
+    {0, 5519},
+    {0, 5521},
+    {0, 5523},
+    {0, 5525},
+    {0, 5527},
+    {0, 5529},
+    {0, 5531},
+    {0, 5533},
+    {0, 5535},
+    {0, 5537},
+    {0, 5539},
+    {0, 5541},
+    {0, 5543},
+    {0, 5545},
+    {0, 5547},
+    {0, 5549},
+    {0, 5551},
+    {0, 5553},
+    {0, 5555},
+    {0, 5557},
+    {0, 5559},
+    {0, 5561},
+    {0, 5563},
+    {0, 5566},
+    {0, 5572},
+    {0, 5577},
+    {0, 5583},
+    {0, 5587},
+    {0, 5593},
+    {0, 5597},
+    {0, 5601},
+    {0, 5608},
+    {0, 5613},
+    {0, 5617},
+    {0, 5621},
+    {0, 5625},
+    {0, 5630},
+    {0, 5635},
+    {0, 5640},
+    {0, 5645},
+    {0, 5650},
+    {0, 5655},
+    {0, 5660},
+    {0, 5667},
+    {0, 5670},
+    {0, 5677},
+    {0, 5684},
+    {0, 5690},
+    {0, 5695},
+    {0, 5702},
+    {0, 5709},
+    {0, 5714},
+    {0, 5718},
+    {0, 5722},
+    {0, 5727},
+    {0, 5732},
+    {0, 5738},
+    {0, 5744},
+    {0, 5748},
+    {0, 5752},
+    {0, 5757},
+    {0, 5761},
+    {0, 5765},
+    {0, 5768},
+    {0, 5771},
+    {0, 5775},
+    {0, 5779},
+    {0, 5786},
+    {0, 5791},
+    {0, 5797},
+    {0, 5804},
+    {0, 5809},
+    {0, 5813},
+    {0, 5817},
+    {0, 5824},
+    {0, 5829},
+    {0, 5836},
+    {0, 5840},
+    {0, 5846},
+    {0, 5850},
+    {0, 5855},
+    {0, 5859},
+    {0, 5864},
+    {0, 5870},
+    {0, 5875},
+    {0, 5881},
+    {0, 5886},
+    {0, 5889},
+    {0, 5895},
+    {0, 5899},
+    {0, 5903},
+    {0, 5908},
+    {0, 5912},
+    {0, 5916},
+    {0, 5920},
+    {0, 5926},
+    {0, 5931},
+    {0, 5934},
+    {0, 5941},
+    {0, 5945},
+    {0, 5951},
+    {0, 5956},
+    {0, 5961},
+    {0, 5965},
+    {0, 5969},
+    {0, 5974},
+    {0, 5977},
+    {0, 5982},
+    {0, 5988},
+    {0, 5991},
+    {0, 5998},
+    {0, 6002},
+    {0, 6005},
+    {0, 6008},
+    {0, 6011},
+    {0, 6014},
+    {0, 6017},
+    {0, 6020},
+    {0, 6023},
+    {0, 6026},
+    {0, 6029},
+    {0, 6032},
+    {0, 6036},
+    {0, 6040},
+    {0, 6044},
+    {0, 6048},
+    {0, 6052},
+    {0, 6056},
+    {0, 6060},
+    {0, 6064},
+    {0, 6068},
+    {0, 6072},
+    {0, 6076},
+    {0, 6080},
+    {0, 6084},
+    {0, 6088},
+    {0, 6092},
+    {0, 6096},
+    {0, 6099},
+    {0, 6102},
+    {0, 6106},
+    {0, 6109},
+    {0, 6112},
+    {0, 6115},
+    {0, 6119},
+    {0, 6123},
+    {0, 6126},
+    {0, 6129},
+    {0, 6132},
+    {0, 6135},
+    {0, 6138},
+    {0, 6143},
+    {0, 6146},
+    {0, 6149},
+    {0, 6152},
+    {0, 6155},
+    {0, 6158},
+    {0, 6161},
+    {0, 6164},
+    {0, 6167},
+    {0, 6171},
+    {0, 6176},
+    {0, 6179},
+    {0, 6182},
+    {0, 6185},
+    {0, 6188},
+    {0, 6191},
+    {0, 6194},
+    {0, 6197},
+    {0, 6201},
+    {0, 6205},
+    {0, 6209},
+    {0, 6213},
+    {0, 6216},
+    {0, 6219},
+    {0, 6222},
+    {0, 6225},
+    {0, 6228},
+    {0, 6231},
+    {0, 6234},
+    {0, 6237},
+    {0, 6240},
+    {0, 6243},
+    {0, 6247},
+    {0, 6251},
+    {0, 6254},
+    {0, 6258},
+    {0, 6262},
+    {0, 6266},
+    {0, 6269},
+    {0, 6273},
+    {0, 6277},
+    {0, 6282},
+    {0, 6285},
+    {0, 6289},
+    {0, 6293},
+    {0, 6297},
+    {0, 6301},
+    {0, 6307},
+    {0, 6314},
+    {0, 6317},
+    {0, 6320},
+    {0, 6323},
+    {0, 6326},
+    {0, 6329},
+    {0, 6332},
+    {0, 6335},
+    {0, 6338},
+    {0, 6341},
+    {0, 6344},
+    {0, 6347},
+    {0, 6350},
+    {0, 6353},
+    {0, 6356},
+    {0, 6359},
+    {0, 6362},
+    {0, 6365},
+    {0, 6368},
+    {0, 6373},
+    {0, 6376},
+    {0, 6379},
+    {0, 6382},
+    {0, 6387},
+    {0, 6391},
+    {0, 6394},
+    {0, 6397},
+    {0, 6400},
+    {0, 6403},
+    {0, 6406},
+    {0, 6409},
+    {0, 6412},
+    {0, 6415},
+    {0, 6418},
+    {0, 6421},
+    {0, 6425},
+    {0, 6428},
+    {0, 6431},
+    {0, 6435},
+    {0, 6439},
+    {0, 6442},
+    {0, 6447},
+    {0, 6451},
+    {0, 6454},
+    {0, 6457},
+    {0, 6460},
+    {0, 6463},
+    {0, 6467},
+    {0, 6471},
+    {0, 6474},
+    {0, 6477},
+    {0, 6480},
+    {0, 6483},
+    {0, 6486},
+    {0, 6489},
+    {0, 6492},
+    {0, 6495},
+    {0, 6498},
+    {0, 6502},
+    {0, 6506},
+    {0, 6510},
+    {0, 6514},
+    {0, 6518},
+    {0, 6522},
+    {0, 6526},
+    {0, 6530},
+    {0, 6534},
+    {0, 6538},
+    {0, 6542},
+    {0, 6546},
+    {0, 6550},
+    {0, 6554},
+    {0, 6558},
+    {0, 6562},
+    {0, 6566},
+    {0, 6570},
+    {0, 6574},
+    {0, 6578},
+    {0, 6582},
+    {0, 6586},
+    {0, 6590},
+    {0, 6592},
+    {0, 6594},
+    {0, 6596},
+    {0, 6598},
+    {0, 6600},
+    {0, 6602},
+    {0, 6604},
+    {0, 6606},
+    {0, 6608},
+    {6610, 6610},
+    {6612, 6612},
+    {4394, 4394},
+    {6614, 6614},
+    {6616, 6616},
+    {6618, 6618},
+    {6620, 6620},
+    {4502, 4502},
+    {6622, 6622},
+    {4410, 4410},
+    {6624, 6624},
+    {6626, 6626},
+    {6628, 6628},
+    {6630, 6630},
+    {6632, 6632},
+    {6634, 6634},
+    {6636, 6636},
+    {6638, 6638},
+    {6640, 6640},
+    {6642, 6642},
+    {6644, 6644},
+    {6646, 6646},
+    {6648, 6648},
+    {6650, 6650},
+    {6652, 6652},
+    {6654, 6654},
+    {6656, 6656},
+    {6658, 6658},
+    {6660, 6660},
+    {6662, 6662},
+    {6664, 6664},
+    {6666, 6666},
+    {6668, 6668},
+    {6670, 6670},
+    {6672, 6672},
+    {6674, 6674},
+    {6676, 6676},
+    {6678, 6678},
+    {6680, 6680},
+    {6682, 6682},
+    {6684, 6684},
+    {6686, 6686},
+    {6688, 6688},
+    {6690, 6690},
+    {6692, 6692},
+    {6694, 6694},
+    {6696, 6696},
+    {6698, 6698},
+    {6700, 6700},
+    {6702, 6702},
+    {6704, 6704},
+    {4326, 4326},
+    {6706, 6706},
+    {6708, 6708},
+    {6710, 6710},
+    {6712, 6712},
+    {6714, 6714},
+    {6716, 6716},
+    {6718, 6718},
+    {6720, 6720},
+    {6722, 6722},
+    {6724, 6724},
+    {6726, 6726},
+    {4472, 4472},
+    {6728, 6728},
+    {6730, 6730},
+    {6732, 6732},
+    {6734, 6734},
+    {6736, 6736},
+    {6738, 6738},
+    {6740, 6740},
+    {6742, 6742},
+    {6744, 6744},
+    {6746, 6746},
+    {6748, 6748},
+    {6750, 6750},
+    {6752, 6752},
+    {6754, 6754},
+    {6756, 6756},
+    {6758, 6758},
+    {6760, 6760},
+    {6762, 6762},
+    {6764, 6764},
+    {6766, 6766},
+    {6768, 6768},
+    {6770, 6770},
+    {6772, 6772},
+    {6774, 6774},
+    {6776, 6776},
+    {6778, 6778},
+    {6780, 6780},
+    {6782, 6782},
+    {6784, 6784},
+    {6786, 6786},
+    {6788, 6788},
+    {6790, 6790},
+    {6792, 6792},
+    {6794, 6794},
+    {6796, 6796},
+    {6798, 6798},
+    {6800, 6800},
+    {6802, 6802},
+    {6804, 6804},
+    {6806, 6806},
+    {6808, 6808},
+    {6810, 6810},
+    {6812, 6812},
+    {6814, 6814},
+    {6816, 6816},
+    {6818, 6818},
+    {6820, 6820},
+    {4398, 4398},
+    {6822, 6822},
+    {6824, 6824},
+    {6826, 6826},
+    {6828, 6828},
+    {6830, 6830},
+    {6832, 6832},
+    {6834, 6834},
+    {6836, 6836},
+    {6838, 6838},
+    {6840, 6840},
+    {6842, 6842},
+    {6844, 6844},
+    {6846, 6846},
+    {6848, 6848},
+    {6850, 6850},
+    {4152, 4152},
+    {6852, 6852},
+    {6854, 6854},
+    {6856, 6856},
+    {6858, 6858},
+    {6860, 6860},
+    {6862, 6862},
+    {6864, 6864},
+    {6866, 6866},
+    {4114, 4114},
+    {6868, 6868},
+    {6870, 6870},
+    {6872, 6872},
+    {6874, 6874},
+    {6876, 6876},
+    {6878, 6878},
+    {6880, 6880},
+    {6882, 6882},
+    {6884, 6884},
+    {6886, 6886},
+    {6888, 6888},
+    {6890, 6890},
+    {6892, 6892},
+    {6894, 6894},
+    {6896, 6896},
+    {6898, 6898},
+    {6900, 6900},
+    {6902, 6902},
+    {6904, 6904},
+    {6906, 6906},
+    {6908, 6908},
+    {6910, 6910},
+    {6912, 6912},
+    {6914, 6914},
+    {6916, 6916},
+    {6918, 6918},
+    {6920, 6920},
+    {6922, 6922},
+    {6924, 6924},
+    {6926, 6926},
+    {6928, 6928},
+    {6930, 6930},
+    {6932, 6932},
+    {6934, 6934},
+    {6936, 6936},
+    {6938, 6938},
+    {6940, 6940},
+    {6942, 6942},
+    {6944, 6944},
+    {6946, 6946},
+    {6948, 6948},
+    {6950, 6950},
+    {6952, 6952},
+    {6954, 6954},
+    {6956, 6956},
+    {6958, 6958},
+    {6960, 6960},
+    {6962, 6962},
+    {6964, 6964},
+    {6966, 6966},
+    {6968, 6968},
+    {6970, 6970},
+    {6972, 6972},
+    {6974, 6974},
+    {4500, 4500},
+    {6976, 6976},
+    {6978, 6978},
+    {6980, 6980},
+    {6982, 6982},
+    {6984, 6984},
+    {6986, 6986},
+    {6988, 6988},
+    {6990, 6990},
+    {6992, 6992},
+    {6994, 6994},
+    {6996, 6996},
+    {6998, 6998},
+    {5309, 5309},
+    {7000, 7000},
+    {7002, 7002},
+    {7004, 7004},
+    {7006, 7006},
+    {7008, 7008},
+    {7010, 7010},
+    {7012, 7012},
+    {7014, 7014},
+    {7016, 7016},
+    {7018, 7018},
+    {7020, 7020},
+    {7022, 7022},
+    {7024, 7024},
+    {7026, 7026},
+    {7028, 7028},
+    {7030, 7030},
+    {7032, 7032},
+    {7034, 7034},
+    {7036, 7036},
+    {7038, 7038},
+    {7040, 7040},
+    {7042, 7042},
+    {4408, 4408},
+    {7044, 7044},
+    {7046, 7046},
+    {7048, 7048},
+    {7050, 7050},
+    {7052, 7052},
+    {7054, 7054},
+    {7056, 7056},
+    {7058, 7058},
+    {7060, 7060},
+    {7062, 7062},
+    {7064, 7064},
+    {7066, 7066},
+    {7068, 7068},
+    {4310, 4310},
+    {7070, 7070},
+    {7072, 7072},
+    {7074, 7074},
+    {7076, 7076},
+    {7078, 7078},
+    {7080, 7080},
+    {7082, 7082},
+    {7084, 7084},
+    {7086, 7086},
+    {7088, 7088},
+    {7090, 7090},
+    {7092, 7092},
+    {7094, 7094},
+    {7096, 7096},
+    {7098, 7098},
+    {7100, 7100},
+    {4364, 4364},
+    {7102, 7102},
+    {4370, 4370},
+    {7104, 7104},
+    {7106, 7106},
+    {7108, 7108},
+    {7110, 7110},
+    {7112, 7112},
+    {7114, 7114},
+    {7116, 7116},
+    {7118, 7118},
+    {7120, 7120},
+    {7122, 7122},
+    {7124, 7124},
+    {7126, 7126},
+    {7128, 7128},
+    {7130, 7130},
+    {4324, 4324},
+    {7132, 7132},
+    {7134, 7134},
+    {7136, 7136},
+    {7138, 7138},
+    {7140, 7140},
+    {7142, 7142},
+    {7144, 7144},
+    {7146, 7146},
+    {7148, 7148},
+    {7150, 7150},
+    {7152, 7152},
+    {7154, 7154},
+    {7156, 7156},
+    {7158, 7158},
+    {7160, 7160},
+    {7162, 7162},
+    {7164, 7164},
+    {7166, 7166},
+    {7168, 7168},
+    {7170, 7170},
+    {7172, 7172},
+    {7174, 7174},
+    {4166, 4166},
+    {7176, 7176},
+    {7178, 7178},
+    {7180, 7180},
+    {7182, 7182},
+    {7184, 7184},
+    {7186, 7186},
+    {7188, 7188},
+    {7190, 7190},
+    {7192, 7192},
+    {7194, 7194},
+    {7196, 7196},
+    {7198, 7198},
+    {7200, 7200},
+    {7202, 7202},
+    {7204, 7204},
+    {5319, 5319},
+    {7206, 7206},
+    {7208, 7208},
+    {7210, 7210},
+    {7212, 7212},
+    {5327, 5327},
+    {7214, 7214},
+    {7216, 7216},
+    {7218, 7218},
+    {7220, 7220},
+    {7222, 7222},
+    {7224, 7224},
+    {7226, 7226},
+    {7228, 7228},
+    {7230, 7230},
+    {7232, 7232},
+    {7234, 7234},
+    {7236, 7236},
+    {7238, 7238},
+    {7240, 7240},
+    {7242, 7242},
+    {7244, 7244},
+    {7246, 7246},
+    {7248, 7248},
+    {7250, 7250},
+    {7252, 7252},
+    {7254, 7254},
+    {7256, 7256},
+    {7258, 7258},
+    {7260, 7260},
+    {7262, 7262},
+    {7264, 7264},
+    {7266, 7266},
+    {7268, 7268},
+    {7270, 7270},
+    {7272, 7272},
+    {7274, 7274},
+    {7276, 7276},
+    {7278, 7278},
+    {7280, 7280},
+    {7282, 7282},
+    {7284, 7284},
+    {7286, 7286},
+    {7288, 7288},
+    {7290, 7290},
+    {7292, 7292},
+    {7294, 7294},
+    {7296, 7296},
+    {7298, 7298},
+    {7300, 7300},
+    {7302, 7302},
+    {7304, 7304},
+    {7306, 7306},
+    {7308, 7308},
+    {7310, 7310},
+    {7312, 7312},
+    {7314, 7314},
+    {7316, 7316},
+    {7318, 7318},
+    {7320, 7320},
+    {7322, 7322},
+    {7324, 7324},
+    {4232, 4232},
+    {7326, 7326},
+    {7328, 7328},
+    {7330, 7330},
+    {7332, 7332},
+    {7334, 7334},
+    {7336, 7336},
+    {7338, 7338},
+    {7340, 7340},
+    {7342, 7342},
+    {7344, 7344},
+    {7346, 7346},
+    {7348, 7348},
+    {7350, 7350},
+    {7352, 7352},
+    {7354, 7354},
+    {7356, 7356},
+    {7358, 7358},
+    {7360, 7360},
+    {7362, 7362},
+    {7364, 7364},
+    {7366, 7366},
+    {7368, 7368},
+    {7370, 7370},
+    {7372, 7372},
+    {7374, 7374},
+    {7376, 7376},
+    {7378, 7378},
+    {7380, 7380},
+    {7382, 7382},
+    {7384, 7384},
+    {7386, 7386},
+    {7388, 7388},
+    {7390, 7390},
+    {7392, 7392},
+    {7394, 7394},
+    {7396, 7396},
+    {7398, 7398},
+    {7400, 7400},
+    {7402, 7402},
+    {7404, 7404},
+    {7406, 7406},
+    {7408, 7408},
+    {7410, 7410},
+    {7412, 7412},
+    {7414, 7414},
+    {7416, 7416},
+    {7418, 7418},
+    {7420, 7420},
+    {0, 7422},
+    {0, 7425},
+    {0, 7428},
+    {0, 7431},
+    {0, 7435},
+    {0, 7439},
+    {0, 7442},
+    {0, 7445},
+    {0, 7448},
+    {0, 7451},
+    {0, 7454},
+    {7457, 7457},
+    {7460, 7460},
+    {0, 7463},
+    {0, 7465},
+    {0, 7467},
+    {0, 7469},
+    {0, 7471},
+    {0, 7473},
+    {0, 7475},
+    {7477, 7477},
+    {7480, 7480},
+    {7483, 7483},
+    {7487, 7487},
+    {7491, 7491},
+    {7494, 7494},
+    {7497, 7497},
+    {7500, 7500},
+    {7503, 7503},
+    {7506, 7506},
+    {7509, 7509},
+    {7512, 7512},
+    {7515, 7515},
+    {7518, 7518},
+    {7521, 7521},
+    {7524, 7524},
+    {7527, 7527},
+    {7530, 7530},
+    {7533, 7533},
+    {7536, 7536},
+    {7539, 7539},
+    {7542, 7542},
+    {7545, 7545},
+    {7548, 7548},
+    {7551, 7551},
+    {7554, 7554},
+    {7557, 7557},
+    {7560, 7560},
+    {7563, 7563},
+    {7566, 7566},
+    {7569, 7569},
+    {7572, 7572},
+    {0, 7575},
+    {0, 7578},
+    {0, 7580},
+    {0, 7582},
+    {0, 7584},
+    {0, 7586},
+    {0, 7588},
+    {0, 7590},
+    {0, 7592},
+    {0, 7594},
+    {0, 7596},
+    {0, 7598},
+    {0, 7600},
+    {0, 7602},
+    {0, 7604},
+    {0, 7606},
+    {0, 7608},
+    {0, 7610},
+    {0, 7612},
+    {0, 7614},
+    {0, 7616},
+    {0, 7618},
+    {0, 7620},
+    {0, 7622},
+    {0, 7624},
+    {0, 7626},
+    {0, 1218},
+    {0, 7628},
+    {0, 7630},
+    {0, 7632},
+    {0, 1224},
+    {0, 7634},
+    {0, 7636},
+    {0, 7638},
+    {0, 7640},
+    {0, 7642},
+    {0, 7644},
+    {0, 7646},
+    {0, 7648},
+    {0, 7650},
+    {0, 7652},
+    {0, 7656},
+    {0, 7660},
+    {0, 7664},
+    {0, 7668},
+    {0, 7672},
+    {0, 7676},
+    {0, 7680},
+    {0, 7684},
+    {0, 7686},
+    {0, 7690},
+    {0, 7694},
+    {0, 7698},
+    {0, 7702},
+    {0, 7705},
+    {0, 7708},
+    {0, 7711},
+    {0, 7714},
+    {0, 7717},
+    {0, 7720},
+    {0, 7723},
+    {0, 7726},
+    {0, 7729},
+    {0, 7732},
+    {0, 7735},
+    {0, 7738},
+    {0, 7741},
+    {0, 7744},
+    {0, 7747},
+    {0, 7750},
+    {0, 7753},
+    {0, 7756},
+    {0, 7759},
+    {0, 7762},
+    {0, 7765},
+    {0, 7768},
+    {0, 7771},
+    {0, 7774},
+    {0, 7777},
+    {0, 7780},
+    {0, 7783},
+    {0, 7786},
+    {0, 7789},
+    {0, 7792},
+    {0, 7795},
+    {0, 7798},
+    {0, 7801},
+    {0, 7804},
+    {0, 7807},
+    {0, 7810},
+    {0, 7813},
+    {0, 7816},
+    {0, 7819},
+    {0, 7822},
+    {0, 7825},
+    {0, 7828},
+    {0, 7831},
+    {0, 7834},
+    {0, 7837},
+    {0, 7840},
+    {0, 7843},
+    {0, 7846},
+    {0, 7849},
+    {0, 7852},
+    {0, 7855},
+    {0, 7858},
+    {0, 7861},
+    {0, 7864},
+    {0, 7867},
+    {0, 7870},
+    {0, 7873},
+    {0, 7876},
+    {0, 7879},
+    {0, 7882},
+    {0, 7885},
+    {0, 7888},
+    {0, 7891},
+    {0, 7894},
+    {0, 7897},
+    {0, 7900},
+    {0, 7903},
+    {0, 7906},
+    {0, 7909},
+    {0, 7912},
+    {0, 7915},
+    {0, 7918},
+    {0, 7921},
+    {0, 7924},
+    {0, 7927},
+    {0, 7930},
+    {0, 7933},
+    {0, 7936},
+    {0, 7939},
+    {0, 7942},
+    {0, 7945},
+    {0, 7948},
+    {0, 7951},
+    {0, 7954},
+    {0, 7957},
+    {0, 7960},
+    {0, 7963},
+    {0, 7966},
+    {0, 7969},
+    {0, 7973},
+    {0, 7977},
+    {0, 7981},
+    {0, 7985},
+    {0, 7989},
+    {0, 7993},
+    {0, 7997},
+    {0, 8001},
+    {0, 8005},
+    {0, 8008},
+    {0, 8011},
+    {0, 8014},
+    {0, 8017},
+    {0, 8020},
+    {0, 8023},
+    {0, 8026},
+    {0, 8029},
+    {0, 8032},
+    {0, 8035},
+    {0, 8038},
+    {0, 8041},
+    {0, 8044},
+    {0, 8047},
+    {0, 8050},
+    {0, 8053},
+    {0, 8057},
+    {0, 8061},
+    {0, 8064},
+    {0, 8067},
+    {0, 8070},
+    {0, 8073},
+    {0, 8076},
+    {0, 8079},
+    {0, 8082},
+    {0, 8085},
+    {0, 8088},
+    {0, 8091},
+    {0, 8094},
+    {0, 8098},
+    {0, 8102},
+    {0, 8106},
+    {0, 8109},
+    {0, 8112},
+    {0, 8115},
+    {0, 8118},
+    {0, 8121},
+    {0, 8124},
+    {0, 8127},
+    {0, 8130},
+    {0, 8133},
+    {0, 8136},
+    {0, 8139},
+    {0, 8142},
+    {0, 8145},
+    {0, 8148},
+    {0, 8151},
+    {0, 8154},
+    {0, 8157},
+    {0, 8160},
+    {0, 8163},
+    {0, 8166},
+    {0, 8169},
+    {0, 8172},
+    {0, 8175},
+    {0, 8178},
+    {0, 8181},
+    {0, 8184},
+    {0, 8187},
+    {0, 8190},
+    {0, 8194},
+    {0, 8198},
+    {0, 8202},
+    {0, 8206},
+    {0, 8210},
+    {0, 8214},
+    {0, 8218},
+    {0, 8222},
+    {0, 8226},
+    {0, 8230},
+    {0, 8234},
+    {0, 8238},
+    {0, 8242},
+    {0, 8246},
+    {0, 8250},
+    {0, 8254},
+    {0, 8258},
+    {0, 8262},
+    {0, 8266},
+    {0, 8270},
+    {0, 8274},
+    {0, 8278},
+    {0, 8282},
+    {0, 8286},
+    {0, 8290},
+    {0, 8294},
+    {0, 8298},
+    {0, 8302},
+    {0, 8306},
+    {0, 8310},
+    {0, 8314},
+    {0, 8318},
+    {0, 8322},
+    {0, 8326},
+    {0, 8330},
+    {0, 8334},
+    {0, 8338},
+    {0, 8342},
+    {0, 8346},
+    {0, 8350},
+    {0, 8354},
+    {0, 8358},
+    {0, 8362},
+    {0, 8366},
+    {0, 8370},
+    {0, 8374},
+    {0, 8378},
+    {0, 8382},
+    {0, 8386},
+    {0, 8390},
+    {0, 8394},
+    {0, 8398},
+    {0, 8402},
+    {0, 8406},
+    {0, 8410},
+    {0, 8414},
+    {0, 8418},
+    {0, 8422},
+    {0, 8426},
+    {0, 8430},
+    {0, 8434},
+    {0, 8438},
+    {0, 8442},
+    {0, 8446},
+    {0, 8450},
+    {0, 8454},
+    {0, 8458},
+    {0, 8462},
+    {0, 8466},
+    {0, 8470},
+    {0, 8474},
+    {0, 8478},
+    {0, 8482},
+    {0, 8486},
+    {0, 8490},
+    {0, 8494},
+    {0, 8498},
+    {0, 8502},
+    {0, 8506},
+    {0, 8510},
+    {0, 8514},
+    {0, 8518},
+    {0, 8522},
+    {0, 8526},
+    {0, 8530},
+    {0, 8534},
+    {0, 8538},
+    {0, 8542},
+    {0, 8546},
+    {0, 8550},
+    {0, 8554},
+    {0, 8558},
+    {0, 8562},
+    {0, 8566},
+    {0, 8570},
+    {0, 8574},
+    {0, 8579},
+    {0, 8584},
+    {0, 8589},
+    {0, 8594},
+    {0, 8599},
+    {0, 8604},
+    {0, 8609},
+    {0, 8613},
+    {0, 8632},
+    {0, 8641},
+    {0, 8646},
+    {0, 8648},
+    {0, 8650},
+    {0, 8652},
+    {0, 931},
+    {0, 8654},
+    {0, 8656},
+    {0, 8658},
+    {0, 8660},
+    {0, 8662},
+    {0, 8664},
+    {0, 8666},
+    {0, 8668},
+    {0, 8670},
+    {0, 8672},
+    {0, 8674},
+    {0, 8676},
+    {0, 8678},
+    {0, 8680},
+    {0, 8682},
+    {0, 3744},
+    {0, 3746},
+    {0, 8684},
+    {0, 8686},
+    {0, 8688},
+    {0, 8690},
+    {0, 8692},
+    {0, 8694},
+    {0, 8696},
+    {0, 8698},
+    {0, 8700},
+    {0, 8702},
+    {0, 8704},
+    {0, 8706},
+    {0, 8708},
+    {0, 8710},
+    {0, 8712},
+    {0, 8714},
+    {0, 8716},
+    {0, 8719},
+    {0, 8722},
+    {0, 8725},
+    {0, 8728},
+    {0, 8731},
+    {0, 8734},
+    {0, 8737},
+    {0, 8740},
+    {0, 8743},
+    {0, 8746},
+    {0, 8749},
+    {0, 8752},
+    {0, 8755},
+    {0, 8758},
+    {0, 1191},
+    {0, 1194},
+    {0, 1197},
+    {0, 1200},
+    {0, 1203},
+    {0, 8760},
+    {0, 8762},
+    {0, 8764},
+    {0, 8766},
+    {0, 8768},
+    {0, 8770},
+    {0, 8772},
+    {0, 8774},
+    {0, 8776},
+    {0, 8778},
+    {0, 8780},
+    {0, 8782},
+    {0, 8784},
+    {0, 8786},
+    {0, 8788},
+    {0, 8790},
+    {0, 8792},
+    {0, 8794},
+    {0, 8796},
+    {0, 8798},
+    {0, 8800},
+    {0, 8802},
+    {0, 8804},
+    {0, 8806},
+    {0, 8808},
+    {0, 8810},
+    {0, 8812},
+    {0, 8814},
+    {0, 8816},
+    {0, 8818},
+    {0, 8822},
+    {0, 8826},
+    {0, 8830},
+    {0, 8833},
+    {0, 8835},
+    {0, 8837},
+    {0, 8839},
+    {0, 3280},
+    {0, 8841},
+    {0, 8843},
+    {0, 8845},
+    {0, 8847},
+    {0, 8849},
+    {0, 8851},
+    {0, 8853},
+    {0, 8855},
+    {0, 8857},
+    {0, 8859},
+    {0, 8861},
+    {0, 8863},
+    {0, 8865},
+    {0, 8867},
+    {0, 8869},
+    {0, 8871},
+    {0, 8873},
+    {0, 8875},
+    {0, 8877},
+    {0, 8879},
+    {0, 8881},
+    {0, 8883},
+    {0, 8885},
+    {0, 8887},
+    {0, 8889},
+    {0, 8891},
+    {0, 8893},
+    {0, 8895},
+    {0, 8897},
+    {0, 8899},
+    {0, 8901},
+    {0, 8903},
+    {0, 8905},
+    {0, 8907},
+    {0, 8909},
+    {0, 8911},
+    {0, 8913},
+    {0, 8915},
+    {0, 8917},
+    {0, 8919},
+    {0, 8921},
+    {0, 8923},
+    {0, 8925},
+    {0, 8927},
+    {0, 8929},
+    {0, 8931},
+    {0, 8933},
+    {0, 8935},
+    {0, 8937},
+    {0, 8939},
+    {0, 8941},
+    {0, 8943},
+    {0, 8945},
+    {0, 8947},
+    {0, 8949},
+    {0, 8951},
+    {0, 8953},
+    {0, 8955},
+    {0, 8957},
+    {0, 8959},
+    {0, 8961},
+    {0, 8963},
+    {0, 8965},
+    {0, 8967},
+    {0, 8969},
+    {0, 8971},
+    {0, 8973},
+    {0, 8975},
+    {0, 8977},
+    {0, 8979},
+    {0, 8981},
+    {0, 8983},
+    {0, 8985},
+    {0, 8987},
+    {0, 8989},
+    {0, 8991},
+    {0, 8993},
+    {0, 8995},
+    {0, 8997},
+    {0, 8999},
+    {0, 9001},
+    {0, 9003},
+    {0, 9005},
+    {0, 9007},
+    {0, 9009},
+    {9011, 9011},
+    {9014, 9014},
+    {9017, 9017},
+    {9020, 9020},
+    {9023, 9023},
+    {9026, 9026},
+    {9029, 9029},
+    {9032, 9032},
+    {9035, 9035},
+    {9038, 9038},
+    {9041, 9041},
+    {9044, 9044},
+    {9047, 9047},
+    {9050, 9050},
+    {9053, 9053},
+    {9056, 9056},
+    {9060, 9060},
+    {9064, 9064},
+    {9068, 9068},
+    {9072, 9072},
+    {9076, 9076},
+    {9079, 9079},
+    {9082, 9082},
+    {9086, 9086},
+    {9090, 9090},
+    {9094, 9094},
+    {0, 9098},
+    {0, 9100},
+    {0, 9102},
+    {0, 9104},
+    {0, 9106},
+    {0, 9108},
+    {0, 9110},
+    {0, 9112},
+    {0, 9114},
+    {0, 9116},
+    {0, 9118},
+    {0, 9120},
+    {0, 9122},
+    {0, 9124},
+    {0, 9126},
+    {0, 9128},
+    {0, 9130},
+    {0, 9132},
+    {0, 9134},
+    {0, 9136},
+    {0, 3440},
+    {0, 9138},
+    {0, 9140},
+    {0, 9142},
+    {0, 9144},
+    {0, 3131},
+    {0, 9146},
+    {0, 9148},
+    {0, 9150},
+    {0, 9152},
+    {0, 9154},
+    {0, 9156},
+    {0, 9158},
+    {0, 9160},
+    {0, 9162},
+    {0, 9164},
+    {0, 9166},
+    {0, 9168},
+    {0, 9170},
+    {0, 9172},
+    {0, 9174},
+    {0, 9176},
+    {0, 9179},
+    {0, 9182},
+    {0, 9185},
+    {0, 9188},
+    {0, 9191},
+    {0, 9194},
+    {0, 9197},
+    {0, 9200},
+    {0, 9203},
+    {0, 9206},
+    {0, 9209},
+    {0, 9213},
+    {0, 9217},
+    {0, 9221},
+    {0, 9225},
+    {0, 9229},
+    {0, 9233},
+    {0, 9237},
+    {0, 9241},
+    {0, 9245},
+    {0, 9249},
+    {0, 9253},
+    {0, 9257},
+    {0, 9261},
+    {0, 9265},
+    {0, 9269},
+    {0, 9273},
+    {0, 9277},
+    {0, 9281},
+    {0, 9285},
+    {0, 9289},
+    {0, 9293},
+    {0, 9297},
+    {0, 9301},
+    {0, 9305},
+    {0, 9309},
+    {0, 9313},
+    {0, 9317},
+    {0, 9320},
+    {0, 9323},
+    {0, 9326},
+    {0, 9329},
+    {0, 9332},
+    {0, 9336},
+    {0, 9339},
+    {0, 9342},
+    {0, 9345},
+    {0, 9348},
+    {0, 9351},
+    {0, 9354},
+    {0, 9357},
+    {0, 9359},
+    {0, 4641},
+    {0, 9361},
+    {0, 9363},
+    {0, 9365},
+    {0, 9367},
+    {0, 9369},
+    {0, 6966},
+    {0, 9371},
+    {0, 9373},
+    {0, 9375},
+    {0, 9377},
+    {0, 9379},
+    {0, 9381},
+    {0, 9383},
+    {0, 9385},
+    {0, 9387},
+    {0, 9389},
+    {0, 9391},
+    {0, 9393},
+    {0, 9395},
+    {0, 9397},
+    {0, 9399},
+    {0, 9401},
+    {0, 9403},
+    {0, 9405},
+    {0, 9407},
+    {0, 9409},
+    {0, 9411},
+    {0, 9413},
+    {0, 9415},
+    {0, 9417},
+    {0, 9421},
+    {0, 9425},
+    {0, 9429},
+    {0, 9433},
+    {0, 9437},
+    {0, 9441},
+    {0, 9445},
+    {0, 9449},
+    {0, 9453},
+    {0, 9455},
+    {9457, 9457},
+    {9459, 9459},
+    {9461, 9461},
+    {9463, 9463},
+    {9465, 9465},
+    {9467, 9467},
+    {9469, 9469},
+    {9471, 9471},
+    {9473, 9473},
+    {9475, 9475},
+    {9477, 9477},
+    {9479, 9479},
+    {9481, 9481},
+    {9483, 9483},
+    {9485, 9485},
+    {9487, 9487},
+    {9489, 9489},
+    {9491, 9491},
+    {9375, 9375},
+    {9493, 9493},
+    {9495, 9495},
+    {9497, 9497},
+    {9499, 9499},
+    {9501, 9501},
+    {9503, 9503},
+    {4110, 4110},
+    {9505, 9505},
+    {9507, 9507},
+    {9509, 9509},
+    {9511, 9511},
+    {9411, 9411},
+    {9513, 9513},
+    {9515, 9515},
+    {9517, 9517},
+    {9519, 9519},
+    {9521, 9521},
+    {9523, 9523},
+    {9525, 9525},
+    {9527, 9527},
+    {9529, 9529},
+    {9531, 9531},
+    {9533, 9533},
+    {9535, 9535},
+    {9537, 9537},
+    {9539, 9539},
+    {9541, 9541},
+    {9543, 9543},
+    {9545, 9545},
+    {9547, 9547},
+    {9549, 9549},
+    {9551, 9551},
+    {9553, 9553},
+    {9555, 9555},
+    {9557, 9557},
+    {9559, 9559},
+    {9561, 9561},
+    {9563, 9563},
+    {9565, 9565},
+    {9567, 9567},
+    {9569, 9569},
+    {9571, 9571},
+    {9573, 9573},
+    {9575, 9575},
+    {9577, 9577},
+    {9579, 9579},
+    {9581, 9581},
+    {9583, 9583},
+    {9585, 9585},
+    {9587, 9587},
+    {9589, 9589},
+    {9591, 9591},
+    {9593, 9593},
+    {9595, 9595},
+    {9597, 9597},
+    {9599, 9599},
+    {9601, 9601},
+    {9603, 9603},
+    {9361, 9361},
+    {9605, 9605},
+    {9607, 9607},
+    {9609, 9609},
+    {9611, 9611},
+    {9613, 9613},
+    {9615, 9615},
+    {9617, 9617},
+    {9619, 9619},
+    {9621, 9621},
+    {9623, 9623},
+    {9625, 9625},
+    {9627, 9627},
+    {9629, 9629},
+    {9631, 9631},
+    {9633, 9633},
+    {9635, 9635},
+    {9637, 9637},
+    {9639, 9639},
+    {9641, 9641},
+    {9643, 9643},
+    {9645, 9645},
+    {4162, 4162},
+    {9647, 9647},
+    {9649, 9649},
+    {9651, 9651},
+    {9653, 9653},
+    {9655, 9655},
+    {9657, 9657},
+    {9659, 9659},
+    {9661, 9661},
+    {9663, 9663},
+    {9665, 9665},
+    {9667, 9667},
+    {9669, 9669},
+    {9671, 9671},
+    {9673, 9673},
+    {9675, 9675},
+    {9677, 9677},
+    {9679, 9679},
+    {9681, 9681},
+    {9683, 9683},
+    {9685, 9685},
+    {9687, 9687},
+    {9689, 9689},
+    {9691, 9691},
+    {9693, 9693},
+    {4186, 4186},
+    {9695, 9695},
+    {9697, 9697},
+    {9699, 9699},
+    {9701, 9701},
+    {9703, 9703},
+    {9705, 9705},
+    {9707, 9707},
+    {9709, 9709},
+    {9711, 9711},
+    {9713, 9713},
+    {9715, 9715},
+    {9717, 9717},
+    {9719, 9719},
+    {9721, 9721},
+    {9723, 9723},
+    {9725, 9725},
+    {9727, 9727},
+    {9729, 9729},
+    {9731, 9731},
+    {9733, 9733},
+    {9735, 9735},
+    {9737, 9737},
+    {9739, 9739},
+    {9741, 9741},
+    {9743, 9743},
+    {9745, 9745},
+    {9747, 9747},
+    {9749, 9749},
+    {9751, 9751},
+    {9753, 9753},
+    {9755, 9755},
+    {9757, 9757},
+    {9759, 9759},
+    {9761, 9761},
+    {9763, 9763},
+    {9765, 9765},
+    {9767, 9767},
+    {9769, 9769},
+    {9771, 9771},
+    {9773, 9773},
+    {9775, 9775},
+    {9777, 9777},
+    {9779, 9779},
+    {9781, 9781},
+    {9783, 9783},
+    {9785, 9785},
+    {9787, 9787},
+    {9789, 9789},
+    {9791, 9791},
+    {9793, 9793},
+    {9795, 9795},
+    {9797, 9797},
+    {9799, 9799},
+    {9801, 9801},
+    {9803, 9803},
+    {9805, 9805},
+    {9807, 9807},
+    {9809, 9809},
+    {9811, 9811},
+    {9813, 9813},
+    {9815, 9815},
+    {9817, 9817},
+    {9819, 9819},
+    {9821, 9821},
+    {9823, 9823},
+    {9825, 9825},
+    {9827, 9827},
+    {9829, 9829},
+    {9831, 9831},
+    {9833, 9833},
+    {9835, 9835},
+    {9837, 9837},
+    {9839, 9839},
+    {9841, 9841},
+    {9843, 9843},
+    {9845, 9845},
+    {9847, 9847},
+    {9849, 9849},
+    {9851, 9851},
+    {9853, 9853},
+    {9855, 9855},
+    {9857, 9857},
+    {9859, 9859},
+    {9861, 9861},
+    {9863, 9863},
+    {9865, 9865},
+    {9867, 9867},
+    {9869, 9869},
+    {9871, 9871},
+    {9873, 9873},
+    {9875, 9875},
+    {9877, 9877},
+    {9879, 9879},
+    {9881, 9881},
+    {9883, 9883},
+    {9885, 9885},
+    {9887, 9887},
+    {9889, 9889},
+    {9891, 9891},
+    {9893, 9893},
+    {9895, 9895},
+    {9897, 9897},
+    {9899, 9899},
+    {9901, 9901},
+    {9903, 9903},
+    {9905, 9905},
+    {9907, 9907},
+    {9909, 9909},
+    {9911, 9911},
+    {9913, 9913},
+    {9915, 9915},
+    {9917, 9917},
+    {9919, 9919},
+    {9921, 9921},
+    {9923, 9923},
+    {9925, 9925},
+    {9927, 9927},
+    {9929, 9929},
+    {9931, 9931},
+    {9933, 9933},
+    {9935, 9935},
+    {9937, 9937},
+    {9939, 9939},
+    {9941, 9941},
+    {9943, 9943},
+    {9945, 9945},
+    {9947, 9947},
+    {9949, 9949},
+    {9951, 9951},
+    {9953, 9953},
+    {9955, 9955},
+    {9957, 9957},
+    {9959, 9959},
+    {9961, 9961},
+    {9963, 9963},
+    {9965, 9965},
+    {9967, 9967},
+    {9969, 9969},
+    {9971, 9971},
+    {9973, 9973},
+    {9975, 9975},
+    {9977, 9977},
+    {9979, 9979},
+    {9981, 9981},
+    {9983, 9983},
+    {9985, 9985},
+    {9987, 9987},
+    {9989, 9989},
+    {9991, 9991},
+    {9993, 9993},
+    {9995, 9995},
+    {9997, 9997},
+    {9999, 9999},
+    {10001, 10001},
+    {10003, 10003},
+    {10005, 10005},
+    {10007, 10007},
+    {10009, 10009},
+    {10011, 10011},
+    {10013, 10013},
+    {10015, 10015},
+    {10017, 10017},
+    {10019, 10019},
+    {10021, 10021},
+    {10023, 10023},
+    {10025, 10025},
+    {10027, 10027},
+    {10029, 10029},
+    {10031, 10031},
+    {10033, 10033},
+    {10035, 10035},
+    {10037, 10037},
+    {10039, 10039},
+    {10041, 10041},
+    {10043, 10043},
+    {10045, 10045},
+    {10047, 10047},
+    {10049, 10049},
+    {10051, 10051},
+    {10053, 10053},
+    {10055, 10055},
+    {10057, 10057},
+    {10059, 10059},
+    {10061, 10061},
+    {10063, 10063},
+    {10065, 10065},
+    {10067, 10067},
+    {10069, 10069},
+    {10071, 10071},
+    {10073, 10073},
+    {10075, 10075},
+    {10077, 10077},
+    {10079, 10079},
+    {10081, 10081},
+    {10083, 10083},
+    {10085, 10085},
+    {10087, 10087},
+    {10089, 10089},
+    {10091, 10091},
+    {10093, 10093},
+    {10095, 10095},
+    {10097, 10097},
+    {10099, 10099},
+    {10101, 10101},
+    {10103, 10103},
+    {10105, 10105},
+    {10107, 10107},
+    {10109, 10109},
+    {10111, 10111},
+    {10113, 10113},
+    {10115, 10115},
+    {10117, 10117},
+    {10119, 10119},
+    {10121, 10121},
+    {10123, 10123},
+    {10125, 10125},
+    {10127, 10127},
+    {10129, 10129},
+    {10131, 10131},
+    {10133, 10133},
+    {10135, 10135},
+    {10137, 10137},
+    {10139, 10139},
+    {10141, 10141},
+    {10143, 10143},
+    {10145, 10145},
+    {10147, 10147},
+    {10149, 10149},
+    {10151, 10151},
+    {10153, 10153},
+    {10155, 10155},
+    {10157, 10157},
+    {10159, 10159},
+    {10161, 10161},
+    {10163, 10163},
+    {10165, 10165},
+    {10167, 10167},
+    {10169, 10169},
+    {10171, 10171},
+    {10173, 10173},
+    {10175, 10175},
+    {10177, 10177},
+    {10179, 10179},
+    {10181, 10181},
+    {10183, 10183},
+    {10185, 10185},
+    {10187, 10187},
+    {10189, 10189},
+    {10191, 10191},
+    {10193, 10193},
+    {10195, 10195},
+    {10197, 10197},
+    {10199, 10199},
+    {10201, 10201},
+    {10203, 10203},
+    {10205, 10205},
+    {10207, 10207},
+    {10209, 10209},
+    {10211, 10211},
+    {10213, 10213},
+    {10215, 10215},
+    {10217, 10217},
+    {10219, 10219},
+    {10221, 10221},
+    {10223, 10223},
+    {10225, 10225},
+    {10227, 10227},
+    {10229, 10229},
+    {4366, 4366},
+    {10231, 10231},
+    {10233, 10233},
+    {10235, 10235},
+    {10237, 10237},
+    {10239, 10239},
+    {10241, 10241},
+    {10243, 10243},
+    {10245, 10245},
+    {10247, 10247},
+    {10249, 10249},
+    {10251, 10251},
+    {4380, 4380},
+    {10253, 10253},
+    {10255, 10255},
+    {10257, 10257},
+    {10259, 10259},
+    {10261, 10261},
+    {10263, 10263},
+    {10265, 10265},
+    {10267, 10267},
+    {10269, 10269},
+    {10271, 10271},
+    {10273, 10273},
+    {10275, 10275},
+    {10277, 10277},
+    {10279, 10279},
+    {10281, 10281},
+    {10283, 10283},
+    {10285, 10285},
+    {10287, 10287},
+    {10289, 10289},
+    {10291, 10291},
+    {10293, 10293},
+    {10295, 10295},
+    {10297, 10297},
+    {10299, 10299},
+    {10301, 10301},
+    {10303, 10303},
+    {10305, 10305},
+    {10307, 10307},
+    {10309, 10309},
+    {10311, 10311},
+    {10313, 10313},
+    {10315, 10315},
+    {10317, 10317},
+    {10319, 10319},
+    {10321, 10321},
+    {10323, 10323},
+    {10325, 10325},
+    {10327, 10327},
+    {10329, 10329},
+    {10331, 10331},
+    {10333, 10333},
+    {10335, 10335},
+    {10337, 10337},
+    {10339, 10339},
+    {10341, 10341},
+    {10343, 10343},
+    {10345, 10345},
+    {10347, 10347},
+    {10349, 10349},
+    {10351, 10351},
+    {10353, 10353},
+    {10355, 10355},
+    {10357, 10357},
+    {10359, 10359},
+    {10361, 10361},
+    {10363, 10363},
+    {10365, 10365},
+    {10367, 10367},
+    {10369, 10369},
+    {10371, 10371},
+    {10373, 10373},
+    {10375, 10375},
+    {4476, 4476},
+    {10377, 10377},
+    {4484, 4484},
+    {10379, 10379},
+    {10381, 10381},
+    {10383, 10383},
+    {10385, 10385},
+    {4494, 4494},
+    {10387, 10387},
+};
+
+// Each sequence is stored as its size followed by the code points
+inline constexpr char32_t sDecompositionData[] = {
+    0x0000, 0x0001, 0x0020, 0x0002, 0x0020, 0x0308, 0x0001, 0x0061, 0x0002, 0x0020, 0x0304, 0x0001,
+    0x0032, 0x0001, 0x0033, 0x0002, 0x0020, 0x0301, 0x0001, 0x03BC, 0x0002, 0x0020, 0x0327, 0x0001,
+    0x0031, 0x0001, 0x006F, 0x0003, 0x0031, 0x2044, 0x0034, 0x0003, 0x0031, 0x2044, 0x0032, 0x0003,
+    0x0033, 0x2044, 0x0034, 0x0002, 0x0041, 0x0300, 0x0002, 0x0041, 0x0301, 0x0002, 0x0041, 0x0302,
+    0x0002, 0x0041, 0x0303, 0x0002, 0x0041, 0x0308, 0x0002, 0x0041, 0x030A, 0x0002, 0x0043, 0x0327,
+    0x0002, 0x0045, 0x0300, 0x0002, 0x0045, 0x0301, 0x0002, 0x0045, 0x0302, 0x0002, 0x0045, 0x0308,
+    0x0002, 0x0049, 0x0300, 0x0002, 0x0049, 0x0301, 0x0002, 0x0049, 0x0302, 0x0002, 0x0049, 0x0308,
+    0x0002, 0x004E, 0x0303, 0x0002, 0x004F, 0x0300, 0x0002, 0x004F, 0x0301, 0x0002, 0x004F, 0x0302,
+    0x0002, 0x004F, 0x0303, 0x0002, 0x004F, 0x0308, 0x0002, 0x0055, 0x0300, 0x0002, 0x0055, 0x0301,
+    0x0002, 0x0055, 0x0302, 0x0002, 0x0055, 0x0308, 0x0002, 0x0059, 0x0301, 0x0002, 0x0061, 0x0300,
+    0x0002, 0x0061, 0x0301, 0x0002, 0x0061, 0x0302, 0x0002, 0x0061, 0x0303, 0x0002, 0x0061, 0x0308,
+    0x0002, 0x0061, 0x030A, 0x0002, 0x0063, 0x0327, 0x0002, 0x0065, 0x0300, 0x0002, 0x0065, 0x0301,
+    0x0002, 0x0065, 0x0302, 0x0002, 0x0065, 0x0308, 0x0002, 0x0069, 0x0300, 0x0002, 0x0069, 0x0301,
+    0x0002, 0x0069, 0x0302, 0x0002, 0x0069, 0x0308, 0x0002, 0x006E, 0x0303, 0x0002, 0x006F, 0x0300,
+    0x0002, 0x006F, 0x0301, 0x0002, 0x006F, 0x0302, 0x0002, 0x006F, 0x0303, 0x0002, 0x006F, 0x0308,
+    0x0002, 0x0075, 0x0300, 0x0002, 0x0075, 0x0301, 0x0002, 0x0075, 0x0302, 0x0002, 0x0075, 0x0308,
+    0x0002, 0x0079, 0x0301, 0x0002, 0x0079, 0x0308, 0x0002, 0x0041, 0x0304, 0x0002, 0x0061, 0x0304,
+    0x0002, 0x0041, 0x0306, 0x0002, 0x0061, 0x0306, 0x0002, 0x0041, 0x0328, 0x0002, 0x0061, 0x0328,
+    0x0002, 0x0043, 0x0301, 0x0002, 0x0063, 0x0301, 0x0002, 0x0043, 0x0302, 0x0002, 0x0063, 0x0302,
+    0x0002, 0x0043, 0x0307, 0x0002, 0x0063, 0x0307, 0x0002, 0x0043, 0x030C, 0x0002, 0x0063, 0x030C,
+    0x0002, 0x0044, 0x030C, 0x0002, 0x0064, 0x030C, 0x0002, 0x0045, 0x0304, 0x0002, 0x0065, 0x0304,
+    0x0002, 0x0045, 0x0306, 0x0002, 0x0065, 0x0306, 0x0002, 0x0045, 0x0307, 0x0002, 0x0065, 0x0307,
+    0x0002, 0x0045, 0x0328, 0x0002, 0x0065, 0x0328, 0x0002, 0x0045, 0x030C, 0x0002, 0x0065, 0x030C,
+    0x0002, 0x0047, 0x0302, 0x0002, 0x0067, 0x0302, 0x0002, 0x0047, 0x0306, 0x0002, 0x0067, 0x0306,
+    0x0002, 0x0047, 0x0307, 0x0002, 0x0067, 0x0307, 0x0002, 0x0047, 0x0327, 0x0002, 0x0067, 0x0327,
+    0x0002, 0x0048, 0x0302, 0x0002, 0x0068, 0x0302, 0x0002, 0x0049, 0x0303, 0x0002, 0x0069, 0x0303,
+    0x0002, 0x0049, 0x0304, 0x0002, 0x0069, 0x0304, 0x0002, 0x0049, 0x0306, 0x0002, 0x0069, 0x0306,
+    0x0002, 0x0049, 0x0328, 0x0002, 0x0069, 0x0328, 0x0002, 0x0049, 0x0307, 0x0002, 0x0049, 0x004A,
+    0x0002, 0x0069, 0x006A, 0x0002, 0x004A, 0x0302, 0x0002, 0x006A, 0x0302, 0x0002, 0x004B, 0x0327,
+    0x0002, 0x006B, 0x0327, 0x0002, 0x004C, 0x0301, 0x0002, 0x006C, 0x0301, 0x0002, 0x004C, 0x0327,
+    0x0002, 0x006C, 0x0327, 0x0002, 0x004C, 0x030C, 0x0002, 0x006C, 0x030C, 0x0002, 0x004C, 0x00B7,
+    0x0002, 0x006C, 0x00B7, 0x0002, 0x004E, 0x0301, 0x0002, 0x006E, 0x0301, 0x0002, 0x004E, 0x0327,
+    0x0002, 0x006E, 0x0327, 0x0002, 0x004E, 0x030C, 0x0002, 0x006E, 0x030C, 0x0002, 0x02BC, 0x006E,
+    0x0002, 0x004F, 0x0304, 0x0002, 0x006F, 0x0304, 0x0002, 0x004F, 0x0306, 0x0002, 0x006F, 0x0306,
+    0x0002, 0x004F, 0x030B, 0x0002, 0x006F, 0x030B, 0x0002, 0x0052, 0x0301, 0x0002, 0x0072, 0x0301,
+    0x0002, 0x0052, 0x0327, 0x0002, 0x0072, 0x0327, 0x0002, 0x0052, 0x030C, 0x0002, 0x0072, 0x030C,
+    0x0002, 0x0053, 0x0301, 0x0002, 0x0073, 0x0301, 0x0002, 0x0053, 0x0302, 0x0002, 0x0073, 0x0302,
+    0x0002, 0x0053, 0x0327, 0x0002, 0x0073, 0x0327, 0x0002, 0x0053, 0x030C, 0x0002, 0x0073, 0x030C,
+    0x0002, 0x0054, 0x0327, 0x0002, 0x0074, 0x0327, 0x0002, 0x0054, 0x030C, 0x0002, 0x0074, 0x030C,
+    0x0002, 0x0055, 0x0303, 0x0002, 0x0075, 0x0303, 0x0002, 0x0055, 0x0304, 0x0002, 0x0075, 0x0304,
+    0x0002, 0x0055, 0x0306, 0x0002, 0x0075, 0x0306, 0x0002, 0x0055, 0x030A, 0x0002, 0x0075, 0x030A,
+    0x0002, 0x0055, 0x030B, 0x0002, 0x0075, 0x030B, 0x0002, 0x0055, 0x0328, 0x0002, 0x0075, 0x0328,
+    0x0002, 0x0057, 0x0302, 0x0002, 0x0077, 0x0302, 0x0002, 0x0059, 0x0302, 0x0002, 0x0079, 0x0302,
+    0x0002, 0x0059, 0x0308, 0x0002, 0x005A, 0x0301, 0x0002, 0x007A, 0x0301, 0x0002, 0x005A, 0x0307,
+    0x0002, 0x007A, 0x0307, 0x0002, 0x005A, 0x030C, 0x0002, 0x007A, 0x030C, 0x0001, 0x0073, 0x0002,
+    0x004F, 0x031B, 0x0002, 0x006F, 0x031B, 0x0002, 0x0055, 0x031B, 0x0002, 0x0075, 0x031B, 0x0003,
+    0x0044, 0x005A, 0x030C, 0x0003, 0x0044, 0x007A, 0x030C, 0x0003, 0x0064, 0x007A, 0x030C, 0x0002,
+    0x004C, 0x004A, 0x0002, 0x004C, 0x006A, 0x0002, 0x006C, 0x006A, 0x0002, 0x004E, 0x004A, 0x0002,
+    0x004E, 0x006A, 0x0002, 0x006E, 0x006A, 0x0002, 0x0041, 0x030C, 0x0002, 0x0061, 0x030C, 0x0002,
+    0x0049, 0x030C, 0x0002, 0x0069, 0x030C, 0x0002, 0x004F, 0x030C, 0x0002, 0x006F, 0x030C, 0x0002,
+    0x0055, 0x030C, 0x0002, 0x0075, 0x030C, 0x0003, 0x0055, 0x0308, 0x0304, 0x0003, 0x0075, 0x0308,
+    0x0304, 0x0003, 0x0055, 0x0308, 0x0301, 0x0003, 0x0075, 0x0308, 0x0301, 0x0003, 0x0055, 0x0308,
+    0x030C, 0x0003, 0x0075, 0x0308, 0x030C, 0x0003, 0x0055, 0x0308, 0x0300, 0x0003, 0x0075, 0x0308,
+    0x0300, 0x0003, 0x0041, 0x0308, 0x0304, 0x0003, 0x0061, 0x0308, 0x0304, 0x0003, 0x0041, 0x0307,
+    0x0304, 0x0003, 0x0061, 0x0307, 0x0304, 0x0002, 0x00C6, 0x0304, 0x0002, 0x00E6, 0x0304, 0x0002,
+    0x0047, 0x030C, 0x0002, 0x0067, 0x030C, 0x0002, 0x004B, 0x030C, 0x0002, 0x006B, 0x030C, 0x0002,
+    0x004F, 0x0328, 0x0002, 0x006F, 0x0328, 0x0003, 0x004F, 0x0328, 0x0304, 0x0003, 0x006F, 0x0328,
+    0x0304, 0x0002, 0x01B7, 0x030C, 0x0002, 0x0292, 0x030C, 0x0002, 0x006A, 0x030C, 0x0002, 0x0044,
+    0x005A, 0x0002, 0x0044, 0x007A, 0x0002, 0x0064, 0x007A, 0x0002, 0x0047, 0x0301, 0x0002, 0x0067,
+    0x0301, 0x0002, 0x004E, 0x0300, 0x0002, 0x006E, 0x0300, 0x0003, 0x0041, 0x030A, 0x0301, 0x0003,
+    0x0061, 0x030A, 0x0301, 0x0002, 0x00C6, 0x0301, 0x0002, 0x00E6, 0x0301, 0x0002, 0x00D8, 0x0301,
+    0x0002, 0x00F8, 0x0301, 0x0002, 0x0041, 0x030F, 0x0002, 0x0061, 0x030F, 0x0002, 0x0041, 0x0311,
+    0x0002, 0x0061, 0x0311, 0x0002, 0x0045, 0x030F, 0x0002, 0x0065, 0x030F, 0x0002, 0x0045, 0x0311,
+    0x0002, 0x0065, 0x0311, 0x0002, 0x0049, 0x030F, 0x0002, 0x0069, 0x030F, 0x0002, 0x0049, 0x0311,
+    0x0002, 0x0069, 0x0311, 0x0002, 0x004F, 0x030F, 0x0002, 0x006F, 0x030F, 0x0002, 0x004F, 0x0311,
+    0x0002, 0x006F, 0x0311, 0x0002, 0x0052, 0x030F, 0x0002, 0x0072, 0x030F, 0x0002, 0x0052, 0x0311,
+    0x0002, 0x0072, 0x0311, 0x0002, 0x0055, 0x030F, 0x0002, 0x0075, 0x030F, 0x0002, 0x0055, 0x0311,
+    0x0002, 0x0075, 0x0311, 0x0002, 0x0053, 0x0326, 0x0002, 0x0073, 0x0326, 0x0002, 0x0054, 0x0326,
+    0x0002, 0x0074, 0x0326, 0x0002, 0x0048, 0x030C, 0x0002, 0x0068, 0x030C, 0x0002, 0x0041, 0x0307,
+    0x0002, 0x0061, 0x0307, 0x0002, 0x0045, 0x0327, 0x0002, 0x0065, 0x0327, 0x0003, 0x004F, 0x0308,
+    0x0304, 0x0003, 0x006F, 0x0308, 0x0304, 0x0003, 0x004F, 0x0303, 0x0304, 0x0003, 0x006F, 0x0303,
+    0x0304, 0x0002, 0x004F, 0x0307, 0x0002, 0x006F, 0x0307, 0x0003, 0x004F, 0x0307, 0x0304, 0x0003,
+    0x006F, 0x0307, 0x0304, 0x0002, 0x0059, 0x0304, 0x0002, 0x0079, 0x0304, 0x0001, 0x0068, 0x0001,
+    0x0266, 0x0001, 0x006A, 0x0001, 0x0072, 0x0001, 0x0279, 0x0001, 0x027B, 0x0001, 0x0281, 0x0001,
+    0x0077, 0x0001, 0x0079, 0x0002, 0x0020, 0x0306, 0x0002, 0x0020, 0x0307, 0x0002, 0x0020, 0x030A,
+    0x0002, 0x0020, 0x0328, 0x0002, 0x0020, 0x0303, 0x0002, 0x0020, 0x030B, 0x0001, 0x0263, 0x0001,
+    0x006C, 0x0001, 0x0078, 0x0001, 0x0295, 0x0001, 0x0300, 0x0001, 0x0301, 0x0001, 0x0313, 0x0002,
+    0x0308, 0x0301, 0x0001, 0x02B9, 0x0002, 0x0020, 0x0345, 0x0001, 0x003B, 0x0002, 0x00A8, 0x0301,
+    0x0003, 0x0020, 0x0308, 0x0301, 0x0002, 0x0391, 0x0301, 0x0001, 0x00B7, 0x0002, 0x0395, 0x0301,
+    0x0002, 0x0397, 0x0301, 0x0002, 0x0399, 0x0301, 0x0002, 0x039F, 0x0301, 0x0002, 0x03A5, 0x0301,
+    0x0002, 0x03A9, 0x0301, 0x0003, 0x03B9, 0x0308, 0x0301, 0x0002, 0x0399, 0x0308, 0x0002, 0x03A5,
+    0x0308, 0x0002, 0x03B1, 0x0301, 0x0002, 0x03B5, 0x0301, 0x0002, 0x03B7, 0x0301, 0x0002, 0x03B9,
+    0x0301, 0x0003, 0x03C5, 0x0308, 0x0301, 0x0002, 0x03B9, 0x0308, 0x0002, 0x03C5, 0x0308, 0x0002,
+    0x03BF, 0x0301, 0x0002, 0x03C5, 0x0301, 0x0002, 0x03C9, 0x0301, 0x0001, 0x03B2, 0x0001, 0x03B8,
+    0x0001, 0x03A5, 0x0002, 0x03D2, 0x0301, 0x0002, 0x03D2, 0x0308, 0x0001, 0x03C6, 0x0001, 0x03C0,
+    0x0001, 0x03BA, 0x0001, 0x03C1, 0x0001, 0x03C2, 0x0001, 0x0398, 0x0001, 0x03B5, 0x0001, 0x03A3,
+    0x0002, 0x0415, 0x0300, 0x0002, 0x0415, 0x0308, 0x0002, 0x0413, 0x0301, 0x0002, 0x0406, 0x0308,
+    0x0002, 0x041A, 0x0301, 0x0002, 0x0418, 0x0300, 0x0002, 0x0423, 0x0306, 0x0002, 0x0418, 0x0306,
+    0x0002, 0x0438, 0x0306, 0x0002, 0x0435, 0x0300, 0x0002, 0x0435, 0x0308, 0x0002, 0x0433, 0x0301,
+    0x0002, 0x0456, 0x0308, 0x0002, 0x043A, 0x0301, 0x0002, 0x0438, 0x0300, 0x0002, 0x0443, 0x0306,
+    0x0002, 0x0474, 0x030F, 0x0002, 0x0475, 0x030F, 0x0002, 0x0416, 0x0306, 0x0002, 0x0436, 0x0306,
+    0x0002, 0x0410, 0x0306, 0x0002, 0x0430, 0x0306, 0x0002, 0x0410, 0x0308, 0x0002, 0x0430, 0x0308,
+    0x0002, 0x0415, 0x0306, 0x0002, 0x0435, 0x0306, 0x0002, 0x04D8, 0x0308, 0x0002, 0x04D9, 0x0308,
+    0x0002, 0x0416, 0x0308, 0x0002, 0x0436, 0x0308, 0x0002, 0x0417, 0x0308, 0x0002, 0x0437, 0x0308,
+    0x0002, 0x0418, 0x0304, 0x0002, 0x0438, 0x0304, 0x0002, 0x0418, 0x0308, 0x0002, 0x0438, 0x0308,
+    0x0002, 0x041E, 0x0308, 0x0002, 0x043E, 0x0308, 0x0002, 0x04E8, 0x0308, 0x0002, 0x04E9, 0x0308,
+    0x0002, 0x042D, 0x0308, 0x0002, 0x044D, 0x0308, 0x0002, 0x0423, 0x0304, 0x0002, 0x0443, 0x0304,
+    0x0002, 0x0423, 0x0308, 0x0002, 0x0443, 0x0308, 0x0002, 0x0423, 0x030B, 0x0002, 0x0443, 0x030B,
+    0x0002, 0x0427, 0x0308, 0x0002, 0x0447, 0x0308, 0x0002, 0x042B, 0x0308, 0x0002, 0x044B, 0x0308,
+    0x0002, 0x0565, 0x0582, 0x0002, 0x0627, 0x0653, 0x0002, 0x0627, 0x0654, 0x0002, 0x0648, 0x0654,
+    0x0002, 0x0627, 0x0655, 0x0002, 0x064A, 0x0654, 0x0002, 0x0627, 0x0674, 0x0002, 0x0648, 0x0674,
+    0x0002, 0x06C7, 0x0674, 0x0002, 0x064A, 0x0674, 0x0002, 0x06D5, 0x0654, 0x0002, 0x06C1, 0x0654,
+    0x0002, 0x06D2, 0x0654, 0x0002, 0x0928, 0x093C, 0x0002, 0x0930, 0x093C, 0x0002, 0x0933, 0x093C,
+    0x0002, 0x0915, 0x093C, 0x0002, 0x0916, 0x093C, 0x0002, 0x0917, 0x093C, 0x0002, 0x091C, 0x093C,
+    0x0002, 0x0921, 0x093C, 0x0002, 0x0922, 0x093C, 0x0002, 0x092B, 0x093C, 0x0002, 0x092F, 0x093C,
+    0x0002, 0x09C7, 0x09BE, 0x0002, 0x09C7, 0x09D7, 0x0002, 0x09A1, 0x09BC, 0x0002, 0x09A2, 0x09BC,
+    0x0002, 0x09AF, 0x09BC, 0x0002, 0x0A32, 0x0A3C, 0x0002, 0x0A38, 0x0A3C, 0x0002, 0x0A16, 0x0A3C,
+    0x0002, 0x0A17, 0x0A3C, 0x0002, 0x0A1C, 0x0A3C, 0x0002, 0x0A2B, 0x0A3C, 0x0002, 0x0B47, 0x0B56,
+    0x0002, 0x0B47, 0x0B3E, 0x0002, 0x0B47, 0x0B57, 0x0002, 0x0B21, 0x0B3C, 0x0002, 0x0B22, 0x0B3C,
+    0x0002, 0x0B92, 0x0BD7, 0x0002, 0x0BC6, 0x0BBE, 0x0002, 0x0BC7, 0x0BBE, 0x0002, 0x0BC6, 0x0BD7,
+    0x0002, 0x0C46, 0x0C56, 0x0002, 0x0CBF, 0x0CD5, 0x0002, 0x0CC6, 0x0CD5, 0x0002, 0x0CC6, 0x0CD6,
+    0x0002, 0x0CC6, 0x0CC2, 0x0003, 0x0CC6, 0x0CC2, 0x0CD5, 0x0002, 0x0D46, 0x0D3E, 0x0002, 0x0D47,
+    0x0D3E, 0x0002, 0x0D46, 0x0D57, 0x0002, 0x0DD9, 0x0DCA, 0x0002, 0x0DD9, 0x0DCF, 0x0003, 0x0DD9,
+    0x0DCF, 0x0DCA, 0x0002, 0x0DD9, 0x0DDF, 0x0002, 0x0E4D, 0x0E32, 0x0002, 0x0ECD, 0x0EB2, 0x0002,
+    0x0EAB, 0x0E99, 0x0002, 0x0EAB, 0x0EA1, 0x0001, 0x0F0B, 0x0002, 0x0F42, 0x0FB7, 0x0002, 0x0F4C,
+    0x0FB7, 0x0002, 0x0F51, 0x0FB7, 0x0002, 0x0F56, 0x0FB7, 0x0002, 0x0F5B, 0x0FB7, 0x0002, 0x0F40,
+    0x0FB5, 0x0002, 0x0F71, 0x0F72, 0x0002, 0x0F71, 0x0F74, 0x0002, 0x0FB2, 0x0F80, 0x0003, 0x0FB2,
+    0x0F71, 0x0F80, 0x0002, 0x0FB3, 0x0F80, 0x0003, 0x0FB3, 0x0F71, 0x0F80, 0x0002, 0x0F71, 0x0F80,
+    0x0002, 0x0F92, 0x0FB7, 0x0002, 0x0F9C, 0x0FB7, 0x0002, 0x0FA1, 0x0FB7, 0x0002, 0x0FA6, 0x0FB7,
+    0x0002, 0x0FAB, 0x0FB7, 0x0002, 0x0F90, 0x0FB5, 0x0002, 0x1025, 0x102E, 0x0001, 0x10DC, 0x0002,
+    0x1B05, 0x1B35, 0x0002, 0x1B07, 0x1B35, 0x0002, 0x1B09, 0x1B35, 0x0002, 0x1B0B, 0x1B35, 0x0002,
+    0x1B0D, 0x1B35, 0x0002, 0x1B11, 0x1B35, 0x0002, 0x1B3A, 0x1B35, 0x0002, 0x1B3C, 0x1B35, 0x0002,
+    0x1B3E, 0x1B35, 0x0002, 0x1B3F, 0x1B35, 0x0002, 0x1B42, 0x1B35, 0x0001, 0x0041, 0x0001, 0x00C6,
+    0x0001, 0x0042, 0x0001, 0x0044, 0x0001, 0x0045, 0x0001, 0x018E, 0x0001, 0x0047, 0x0001, 0x0048,
+    0x0001, 0x0049, 0x0001, 0x004A, 0x0001, 0x004B, 0x0001, 0x004C, 0x0001, 0x004D, 0x0001, 0x004E,
+    0x0001, 0x004F, 0x0001, 0x0222, 0x0001, 0x0050, 0x0001, 0x0052, 0x0001, 0x0054, 0x0001, 0x0055,
+    0x0001, 0x0057, 0x0001, 0x0250, 0x0001, 0x0251, 0x0001, 0x1D02, 0x0001, 0x0062, 0x0001, 0x0064,
+    0x0001, 0x0065, 0x0001, 0x0259, 0x0001, 0x025B, 0x0001, 0x025C, 0x0001, 0x0067, 0x0001, 0x006B,
+    0x0001, 0x006D, 0x0001, 0x014B, 0x0001, 0x0254, 0x0001, 0x1D16, 0x0001, 0x1D17, 0x0001, 0x0070,
+    0x0001, 0x0074, 0x0001, 0x0075, 0x0001, 0x1D1D, 0x0001, 0x026F, 0x0001, 0x0076, 0x0001, 0x1D25,
+    0x0001, 0x03B3, 0x0001, 0x03B4, 0x0001, 0x03C7, 0x0001, 0x0069, 0x0001, 0x043D, 0x0001, 0x0252,
+    0x0001, 0x0063, 0x0001, 0x0255, 0x0001, 0x00F0, 0x0001, 0x0066, 0x0001, 0x025F, 0x0001, 0x0261,
+    0x0001, 0x0265, 0x0001, 0x0268, 0x0001, 0x0269, 0x0001, 0x026A, 0x0001, 0x1D7B, 0x0001, 0x029D,
+    0x0001, 0x026D, 0x0001, 0x1D85, 0x0001, 0x029F, 0x0001, 0x0271, 0x0001, 0x0270, 0x0001, 0x0272,
+    0x0001, 0x0273, 0x0001, 0x0274, 0x0001, 0x0275, 0x0001, 0x0278, 0x0001, 0x0282, 0x0001, 0x0283,
+    0x0001, 0x01AB, 0x0001, 0x0289, 0x0001, 0x028A, 0x0001, 0x1D1C, 0x0001, 0x028B, 0x0001, 0x028C,
+    0x0001, 0x007A, 0x0001, 0x0290, 0x0001, 0x0291, 0x0001, 0x0292, 0x0002, 0x0041, 0x0325, 0x0002,
+    0x0061, 0x0325, 0x0002, 0x0042, 0x0307, 0x0002, 0x0062, 0x0307, 0x0002, 0x0042, 0x0323, 0x0002,
+    0x0062, 0x0323, 0x0002, 0x0042, 0x0331, 0x0002, 0x0062, 0x0331, 0x0003, 0x0043, 0x0327, 0x0301,
+    0x0003, 0x0063, 0x0327, 0x0301, 0x0002, 0x0044, 0x0307, 0x0002, 0x0064, 0x0307, 0x0002, 0x0044,
+    0x0323, 0x0002, 0x0064, 0x0323, 0x0002, 0x0044, 0x0331, 0x0002, 0x0064, 0x0331, 0x0002, 0x0044,
+    0x0327, 0x0002, 0x0064, 0x0327, 0x0002, 0x0044, 0x032D, 0x0002, 0x0064, 0x032D, 0x0003, 0x0045,
+    0x0304, 0x0300, 0x0003, 0x0065, 0x0304, 0x0300, 0x0003, 0x0045, 0x0304, 0x0301, 0x0003, 0x0065,
+    0x0304, 0x0301, 0x0002, 0x0045, 0x032D, 0x0002, 0x0065, 0x032D, 0x0002, 0x0045, 0x0330, 0x0002,
+    0x0065, 0x0330, 0x0003, 0x0045, 0x0327, 0x0306, 0x0003, 0x0065, 0x0327, 0x0306, 0x0002, 0x0046,
+    0x0307, 0x0002, 0x0066, 0x0307, 0x0002, 0x0047, 0x0304, 0x0002, 0x0067, 0x0304, 0x0002, 0x0048,
+    0x0307, 0x0002, 0x0068, 0x0307, 0x0002, 0x0048, 0x0323, 0x0002, 0x0068, 0x0323, 0x0002, 0x0048,
+    0x0308, 0x0002, 0x0068, 0x0308, 0x0002, 0x0048, 0x0327, 0x0002, 0x0068, 0x0327, 0x0002, 0x0048,
+    0x032E, 0x0002, 0x0068, 0x032E, 0x0002, 0x0049, 0x0330, 0x0002, 0x0069, 0x0330, 0x0003, 0x0049,
+    0x0308, 0x0301, 0x0003, 0x0069, 0x0308, 0x0301, 0x0002, 0x004B, 0x0301, 0x0002, 0x006B, 0x0301,
+    0x0002, 0x004B, 0x0323, 0x0002, 0x006B, 0x0323, 0x0002, 0x004B, 0x0331, 0x0002, 0x006B, 0x0331,
+    0x0002, 0x004C, 0x0323, 0x0002, 0x006C, 0x0323, 0x0003, 0x004C, 0x0323, 0x0304, 0x0003, 0x006C,
+    0x0323, 0x0304, 0x0002, 0x004C, 0x0331, 0x0002, 0x006C, 0x0331, 0x0002, 0x004C, 0x032D, 0x0002,
+    0x006C, 0x032D, 0x0002, 0x004D, 0x0301, 0x0002, 0x006D, 0x0301, 0x0002, 0x004D, 0x0307, 0x0002,
+    0x006D, 0x0307, 0x0002, 0x004D, 0x0323, 0x0002, 0x006D, 0x0323, 0x0002, 0x004E, 0x0307, 0x0002,
+    0x006E, 0x0307, 0x0002, 0x004E, 0x0323, 0x0002, 0x006E, 0x0323, 0x0002, 0x004E, 0x0331, 0x0002,
+    0x006E, 0x0331, 0x0002, 0x004E, 0x032D, 0x0002, 0x006E, 0x032D, 0x0003, 0x004F, 0x0303, 0x0301,
+    0x0003, 0x006F, 0x0303, 0x0301, 0x0003, 0x004F, 0x0303, 0x0308, 0x0003, 0x006F, 0x0303, 0x0308,
+    0x0003, 0x004F, 0x0304, 0x0300, 0x0003, 0x006F, 0x0304, 0x0300, 0x0003, 0x004F, 0x0304, 0x0301,
+    0x0003, 0x006F, 0x0304, 0x0301, 0x0002, 0x0050, 0x0301, 0x0002, 0x0070, 0x0301, 0x0002, 0x0050,
+    0x0307, 0x0002, 0x0070, 0x0307, 0x0002, 0x0052, 0x0307, 0x0002, 0x0072, 0x0307, 0x0002, 0x0052,
+    0x0323, 0x0002, 0x0072, 0x0323, 0x0003, 0x0052, 0x0323, 0x0304, 0x0003, 0x0072, 0x0323, 0x0304,
+    0x0002, 0x0052, 0x0331, 0x0002, 0x0072, 0x0331, 0x0002, 0x0053, 0x0307, 0x0002, 0x0073, 0x0307,
+    0x0002, 0x0053, 0x0323, 0x0002, 0x0073, 0x0323, 0x0003, 0x0053, 0x0301, 0x0307, 0x0003, 0x0073,
+    0x0301, 0x0307, 0x0003, 0x0053, 0x030C, 0x0307, 0x0003, 0x0073, 0x030C, 0x0307, 0x0003, 0x0053,
+    0x0323, 0x0307, 0x0003, 0x0073, 0x0323, 0x0307, 0x0002, 0x0054, 0x0307, 0x0002, 0x0074, 0x0307,
+    0x0002, 0x0054, 0x0323, 0x0002, 0x0074, 0x0323, 0x0002, 0x0054, 0x0331, 0x0002, 0x0074, 0x0331,
+    0x0002, 0x0054, 0x032D, 0x0002, 0x0074, 0x032D, 0x0002, 0x0055, 0x0324, 0x0002, 0x0075, 0x0324,
+    0x0002, 0x0055, 0x0330, 0x0002, 0x0075, 0x0330, 0x0002, 0x0055, 0x032D, 0x0002, 0x0075, 0x032D,
+    0x0003, 0x0055, 0x0303, 0x0301, 0x0003, 0x0075, 0x0303, 0x0301, 0x0003, 0x0055, 0x0304, 0x0308,
+    0x0003, 0x0075, 0x0304, 0x0308, 0x0002, 0x0056, 0x0303, 0x0002, 0x0076, 0x0303, 0x0002, 0x0056,
+    0x0323, 0x0002, 0x0076, 0x0323, 0x0002, 0x0057, 0x0300, 0x0002, 0x0077, 0x0300, 0x0002, 0x0057,
+    0x0301, 0x0002, 0x0077, 0x0301, 0x0002, 0x0057, 0x0308, 0x0002, 0x0077, 0x0308, 0x0002, 0x0057,
+    0x0307, 0x0002, 0x0077, 0x0307, 0x0002, 0x0057, 0x0323, 0x0002, 0x0077, 0x0323, 0x0002, 0x0058,
+    0x0307, 0x0002, 0x0078, 0x0307, 0x0002, 0x0058, 0x0308, 0x0002, 0x0078, 0x0308, 0x0002, 0x0059,
+    0x0307, 0x0002, 0x0079, 0x0307, 0x0002, 0x005A, 0x0302, 0x0002, 0x007A, 0x0302, 0x0002, 0x005A,
+    0x0323, 0x0002, 0x007A, 0x0323, 0x0002, 0x005A, 0x0331, 0x0002, 0x007A, 0x0331, 0x0002, 0x0068,
+    0x0331, 0x0002, 0x0074, 0x0308, 0x0002, 0x0077, 0x030A, 0x0002, 0x0079, 0x030A, 0x0002, 0x0061,
+    0x02BE, 0x0002, 0x017F, 0x0307, 0x0002, 0x0041, 0x0323, 0x0002, 0x0061, 0x0323, 0x0002, 0x0041,
+    0x0309, 0x0002, 0x0061, 0x0309, 0x0003, 0x0041, 0x0302, 0x0301, 0x0003, 0x0061, 0x0302, 0x0301,
+    0x0003, 0x0041, 0x0302, 0x0300, 0x0003, 0x0061, 0x0302, 0x0300, 0x0003, 0x0041, 0x0302, 0x0309,
+    0x0003, 0x0061, 0x0302, 0x0309, 0x0003, 0x0041, 0x0302, 0x0303, 0x0003, 0x0061, 0x0302, 0x0303,
+    0x0003, 0x0041, 0x0323, 0x0302, 0x0003, 0x0061, 0x0323, 0x0302, 0x0003, 0x0041, 0x0306, 0x0301,
+    0x0003, 0x0061, 0x0306, 0x0301, 0x0003, 0x0041, 0x0306, 0x0300, 0x0003, 0x0061, 0x0306, 0x0300,
+    0x0003, 0x0041, 0x0306, 0x0309, 0x0003, 0x0061, 0x0306, 0x0309, 0x0003, 0x0041, 0x0306, 0x0303,
+    0x0003, 0x0061, 0x0306, 0x0303, 0x0003, 0x0041, 0x0323, 0x0306, 0x0003, 0x0061, 0x0323, 0x0306,
+    0x0002, 0x0045, 0x0323, 0x0002, 0x0065, 0x0323, 0x0002, 0x0045, 0x0309, 0x0002, 0x0065, 0x0309,
+    0x0002, 0x0045, 0x0303, 0x0002, 0x0065, 0x0303, 0x0003, 0x0045, 0x0302, 0x0301, 0x0003, 0x0065,
+    0x0302, 0x0301, 0x0003, 0x0045, 0x0302, 0x0300, 0x0003, 0x0065, 0x0302, 0x0300, 0x0003, 0x0045,
+    0x0302, 0x0309, 0x0003, 0x0065, 0x0302, 0x0309, 0x0003, 0x0045, 0x0302, 0x0303, 0x0003, 0x0065,
+    0x0302, 0x0303, 0x0003, 0x0045, 0x0323, 0x0302, 0x0003, 0x0065, 0x0323, 0x0302, 0x0002, 0x0049,
+    0x0309, 0x0002, 0x0069, 0x0309, 0x0002, 0x0049, 0x0323, 0x0002, 0x0069, 0x0323, 0x0002, 0x004F,
+    0x0323, 0x0002, 0x006F, 0x0323, 0x0002, 0x004F, 0x0309, 0x0002, 0x006F, 0x0309, 0x0003, 0x004F,
+    0x0302, 0x0301, 0x0003, 0x006F, 0x0302, 0x0301, 0x0003, 0x004F, 0x0302, 0x0300, 0x0003, 0x006F,
+    0x0302, 0x0300, 0x0003, 0x004F, 0x0302, 0x0309, 0x0003, 0x006F, 0x0302, 0x0309, 0x0003, 0x004F,
+    0x0302, 0x0303, 0x0003, 0x006F, 0x0302, 0x0303, 0x0003, 0x004F, 0x0323, 0x0302, 0x0003, 0x006F,
+    0x0323, 0x0302, 0x0003, 0x004F, 0x031B, 0x0301, 0x0003, 0x006F, 0x031B, 0x0301, 0x0003, 0x004F,
+    0x031B, 0x0300, 0x0003, 0x006F, 0x031B, 0x0300, 0x0003, 0x004F, 0x031B, 0x0309, 0x0003, 0x006F,
+    0x031B, 0x0309, 0x0003, 0x004F, 0x031B, 0x0303, 0x0003, 0x006F, 0x031B, 0x0303, 0x0003, 0x004F,
+    0x031B, 0x0323, 0x0003, 0x006F, 0x031B, 0x0323, 0x0002, 0x0055, 0x0323, 0x0002, 0x0075, 0x0323,
+    0x0002, 0x0055, 0x0309, 0x0002, 0x0075, 0x0309, 0x0003, 0x0055, 0x031B, 0x0301, 0x0003, 0x0075,
+    0x031B, 0x0301, 0x0003, 0x0055, 0x031B, 0x0300, 0x0003, 0x0075, 0x031B, 0x0300, 0x0003, 0x0055,
+    0x031B, 0x0309, 0x0003, 0x0075, 0x031B, 0x0309, 0x0003, 0x0055, 0x031B, 0x0303, 0x0003, 0x0075,
+    0x031B, 0x0303, 0x0003, 0x0055, 0x031B, 0x0323, 0x0003, 0x0075, 0x031B, 0x0323, 0x0002, 0x0059,
+    0x0300, 0x0002, 0x0079, 0x0300, 0x0002, 0x0059, 0x0323, 0x0002, 0x0079, 0x0323, 0x0002, 0x0059,
+    0x0309, 0x0002, 0x0079, 0x0309, 0x0002, 0x0059, 0x0303, 0x0002, 0x0079, 0x0303, 0x0002, 0x03B1,
+    0x0313, 0x0002, 0x03B1, 0x0314, 0x0003, 0x03B1, 0x0313, 0x0300, 0x0003, 0x03B1, 0x0314, 0x0300,
+    0x0003, 0x03B1, 0x0313, 0x0301, 0x0003, 0x03B1, 0x0314, 0x0301, 0x0003, 0x03B1, 0x0313, 0x0342,
+    0x0003, 0x03B1, 0x0314, 0x0342, 0x0002, 0x0391, 0x0313, 0x0002, 0x0391, 0x0314, 0x0003, 0x0391,
+    0x0313, 0x0300, 0x0003, 0x0391, 0x0314, 0x0300, 0x0003, 0x0391, 0x0313, 0x0301, 0x0003, 0x0391,
+    0x0314, 0x0301, 0x0003, 0x0391, 0x0313, 0x0342, 0x0003, 0x0391, 0x0314, 0x0342, 0x0002, 0x03B5,
+    0x0313, 0x0002, 0x03B5, 0x0314, 0x0003, 0x03B5, 0x0313, 0x0300, 0x0003, 0x03B5, 0x0314, 0x0300,
+    0x0003, 0x03B5, 0x0313, 0x0301, 0x0003, 0x03B5, 0x0314, 0x0301, 0x0002, 0x0395, 0x0313, 0x0002,
+    0x0395, 0x0314, 0x0003, 0x0395, 0x0313, 0x0300, 0x0003, 0x0395, 0x0314, 0x0300, 0x0003, 0x0395,
+    0x0313, 0x0301, 0x0003, 0x0395, 0x0314, 0x0301, 0x0002, 0x03B7, 0x0313, 0x0002, 0x03B7, 0x0314,
+    0x0003, 0x03B7, 0x0313, 0x0300, 0x0003, 0x03B7, 0x0314, 0x0300, 0x0003, 0x03B7, 0x0313, 0x0301,
+    0x0003, 0x03B7, 0x0314, 0x0301, 0x0003, 0x03B7, 0x0313, 0x0342, 0x0003, 0x03B7, 0x0314, 0x0342,
+    0x0002, 0x0397, 0x0313, 0x0002, 0x0397, 0x0314, 0x0003, 0x0397, 0x0313, 0x0300, 0x0003, 0x0397,
+    0x0314, 0x0300, 0x0003, 0x0397, 0x0313, 0x0301, 0x0003, 0x0397, 0x0314, 0x0301, 0x0003, 0x0397,
+    0x0313, 0x0342, 0x0003, 0x0397, 0x0314, 0x0342, 0x0002, 0x03B9, 0x0313, 0x0002, 0x03B9, 0x0314,
+    0x0003, 0x03B9, 0x0313, 0x0300, 0x0003, 0x03B9, 0x0314, 0x0300, 0x0003, 0x03B9, 0x0313, 0x0301,
+    0x0003, 0x03B9, 0x0314, 0x0301, 0x0003, 0x03B9, 0x0313, 0x0342, 0x0003, 0x03B9, 0x0314, 0x0342,
+    0x0002, 0x0399, 0x0313, 0x0002, 0x0399, 0x0314, 0x0003, 0x0399, 0x0313, 0x0300, 0x0003, 0x0399,
+    0x0314, 0x0300, 0x0003, 0x0399, 0x0313, 0x0301, 0x0003, 0x0399, 0x0314, 0x0301, 0x0003, 0x0399,
+    0x0313, 0x0342, 0x0003, 0x0399, 0x0314, 0x0342, 0x0002, 0x03BF, 0x0313, 0x0002, 0x03BF, 0x0314,
+    0x0003, 0x03BF, 0x0313, 0x0300, 0x0003, 0x03BF, 0x0314, 0x0300, 0x0003, 0x03BF, 0x0313, 0x0301,
+    0x0003, 0x03BF, 0x0314, 0x0301, 0x0002, 0x039F, 0x0313, 0x0002, 0x039F, 0x0314, 0x0003, 0x039F,
+    0x0313, 0x0300, 0x0003, 0x039F, 0x0314, 0x0300, 0x0003, 0x039F, 0x0313, 0x0301, 0x0003, 0x039F,
+    0x0314, 0x0301, 0x0002, 0x03C5, 0x0313, 0x0002, 0x03C5, 0x0314, 0x0003, 0x03C5, 0x0313, 0x0300,
+    0x0003, 0x03C5, 0x0314, 0x0300, 0x0003, 0x03C5, 0x0313, 0x0301, 0x0003, 0x03C5, 0x0314, 0x0301,
+    0x0003, 0x03C5, 0x0313, 0x0342, 0x0003, 0x03C5, 0x0314, 0x0342, 0x0002, 0x03A5, 0x0314, 0x0003,
+    0x03A5, 0x0314, 0x0300, 0x0003, 0x03A5, 0x0314, 0x0301, 0x0003, 0x03A5, 0x0314, 0x0342, 0x0002,
+    0x03C9, 0x0313, 0x0002, 0x03C9, 0x0314, 0x0003, 0x03C9, 0x0313, 0x0300, 0x0003, 0x03C9, 0x0314,
+    0x0300, 0x0003, 0x03C9, 0x0313, 0x0301, 0x0003, 0x03C9, 0x0314, 0x0301, 0x0003, 0x03C9, 0x0313,
+    0x0342, 0x0003, 0x03C9, 0x0314, 0x0342, 0x0002, 0x03A9, 0x0313, 0x0002, 0x03A9, 0x0314, 0x0003,
+    0x03A9, 0x0313, 0x0300, 0x0003, 0x03A9, 0x0314, 0x0300, 0x0003, 0x03A9, 0x0313, 0x0301, 0x0003,
+    0x03A9, 0x0314, 0x0301, 0x0003, 0x03A9, 0x0313, 0x0342, 0x0003, 0x03A9, 0x0314, 0x0342, 0x0002,
+    0x03B1, 0x0300, 0x0002, 0x03B5, 0x0300, 0x0002, 0x03B7, 0x0300, 0x0002, 0x03B9, 0x0300, 0x0002,
+    0x03BF, 0x0300, 0x0002, 0x03C5, 0x0300, 0x0002, 0x03C9, 0x0300, 0x0003, 0x03B1, 0x0313, 0x0345,
+    0x0003, 0x03B1, 0x0314, 0x0345, 0x0004, 0x03B1, 0x0313, 0x0300, 0x0345, 0x0004, 0x03B1, 0x0314,
+    0x0300, 0x0345, 0x0004, 0x03B1, 0x0313, 0x0301, 0x0345, 0x0004, 0x03B1, 0x0314, 0x0301, 0x0345,
+    0x0004, 0x03B1, 0x0313, 0x0342, 0x0345, 0x0004, 0x03B1, 0x0314, 0x0342, 0x0345, 0x0003, 0x0391,
+    0x0313, 0x0345, 0x0003, 0x0391, 0x0314, 0x0345, 0x0004, 0x0391, 0x0313, 0x0300, 0x0345, 0x0004,
+    0x0391, 0x0314, 0x0300, 0x0345, 0x0004, 0x0391, 0x0313, 0x0301, 0x0345, 0x0004, 0x0391, 0x0314,
+    0x0301, 0x0345, 0x0004, 0x0391, 0x0313, 0x0342, 0x0345, 0x0004, 0x0391, 0x0314, 0x0342, 0x0345,
+    0x0003, 0x03B7, 0x0313, 0x0345, 0x0003, 0x03B7, 0x0314, 0x0345, 0x0004, 0x03B7, 0x0313, 0x0300,
+    0x0345, 0x0004, 0x03B7, 0x0314, 0x0300, 0x0345, 0x0004, 0x03B7, 0x0313, 0x0301, 0x0345, 0x0004,
+    0x03B7, 0x0314, 0x0301, 0x0345, 0x0004, 0x03B7, 0x0313, 0x0342, 0x0345, 0x0004, 0x03B7, 0x0314,
+    0x0342, 0x0345, 0x0003, 0x0397, 0x0313, 0x0345, 0x0003, 0x0397, 0x0314, 0x0345, 0x0004, 0x0397,
+    0x0313, 0x0300, 0x0345, 0x0004, 0x0397, 0x0314, 0x0300, 0x0345, 0x0004, 0x0397, 0x0313, 0x0301,
+    0x0345, 0x0004, 0x0397, 0x0314, 0x0301, 0x0345, 0x0004, 0x0397, 0x0313, 0x0342, 0x0345, 0x0004,
+    0x0397, 0x0314, 0x0342, 0x0345, 0x0003, 0x03C9, 0x0313, 0x0345, 0x0003, 0x03C9, 0x0314, 0x0345,
+    0x0004, 0x03C9, 0x0313, 0x0300, 0x0345, 0x0004, 0x03C9, 0x0314, 0x0300, 0x0345, 0x0004, 0x03C9,
+    0x0313, 0x0301, 0x0345, 0x0004, 0x03C9, 0x0314, 0x0301, 0x0345, 0x0004, 0x03C9, 0x0313, 0x0342,
+    0x0345, 0x0004, 0x03C9, 0x0314, 0x0342, 0x0345, 0x0003, 0x03A9, 0x0313, 0x0345, 0x0003, 0x03A9,
+    0x0314, 0x0345, 0x0004, 0x03A9, 0x0313, 0x0300, 0x0345, 0x0004, 0x03A9, 0x0314, 0x0300, 0x0345,
+    0x0004, 0x03A9, 0x0313, 0x0301, 0x0345, 0x0004, 0x03A9, 0x0314, 0x0301, 0x0345, 0x0004, 0x03A9,
+    0x0313, 0x0342, 0x0345, 0x0004, 0x03A9, 0x0314, 0x0342, 0x0345, 0x0002, 0x03B1, 0x0306, 0x0002,
+    0x03B1, 0x0304, 0x0003, 0x03B1, 0x0300, 0x0345, 0x0002, 0x03B1, 0x0345, 0x0003, 0x03B1, 0x0301,
+    0x0345, 0x0002, 0x03B1, 0x0342, 0x0003, 0x03B1, 0x0342, 0x0345, 0x0002, 0x0391, 0x0306, 0x0002,
+    0x0391, 0x0304, 0x0002, 0x0391, 0x0300, 0x0002, 0x0391, 0x0345, 0x0002, 0x0020, 0x0313, 0x0001,
+    0x03B9, 0x0002, 0x0020, 0x0342, 0x0002, 0x00A8, 0x0342, 0x0003, 0x0020, 0x0308, 0x0342, 0x0003,
+    0x03B7, 0x0300, 0x0345, 0x0002, 0x03B7, 0x0345, 0x0003, 0x03B7, 0x0301, 0x0345, 0x0002, 0x03B7,
+    0x0342, 0x0003, 0x03B7, 0x0342, 0x0345, 0x0002, 0x0395, 0x0300, 0x0002, 0x0397, 0x0300, 0x0002,
+    0x0397, 0x0345, 0x0002, 0x1FBF, 0x0300, 0x0003, 0x0020, 0x0313, 0x0300, 0x0002, 0x1FBF, 0x0301,
+    0x0003, 0x0020, 0x0313, 0x0301, 0x0002, 0x1FBF, 0x0342, 0x0003, 0x0020, 0x0313, 0x0342, 0x0002,
+    0x03B9, 0x0306, 0x0002, 0x03B9, 0x0304, 0x0003, 0x03B9, 0x0308, 0x0300, 0x0002, 0x03B9, 0x0342,
+    0x0003, 0x03B9, 0x0308, 0x0342, 0x0002, 0x0399, 0x0306, 0x0002, 0x0399, 0x0304, 0x0002, 0x0399,
+    0x0300, 0x0002, 0x1FFE, 0x0300, 0x0003, 0x0020, 0x0314, 0x0300, 0x0002, 0x1FFE, 0x0301, 0x0003,
+    0x0020, 0x0314, 0x0301, 0x0002, 0x1FFE, 0x0342, 0x0003, 0x0020, 0x0314, 0x0342, 0x0002, 0x03C5,
+    0x0306, 0x0002, 0x03C5, 0x0304, 0x0003, 0x03C5, 0x0308, 0x0300, 0x0002, 0x03C1, 0x0313, 0x0002,
+    0x03C1, 0x0314, 0x0002, 0x03C5, 0x0342, 0x0003, 0x03C5, 0x0308, 0x0342, 0x0002, 0x03A5, 0x0306,
+    0x0002, 0x03A5, 0x0304, 0x0002, 0x03A5, 0x0300, 0x0002, 0x03A1, 0x0314, 0x0002, 0x00A8, 0x0300,
+    0x0003, 0x0020, 0x0308, 0x0300, 0x0001, 0x0060, 0x0003, 0x03C9, 0x0300, 0x0345, 0x0002, 0x03C9,
+    0x0345, 0x0003, 0x03C9, 0x0301, 0x0345, 0x0002, 0x03C9, 0x0342, 0x0003, 0x03C9, 0x0342, 0x0345,
+    0x0002, 0x039F, 0x0300, 0x0002, 0x03A9, 0x0300, 0x0002, 0x03A9, 0x0345, 0x0001, 0x00B4, 0x0002,
+    0x0020, 0x0314, 0x0001, 0x2002, 0x0001, 0x2003, 0x0001, 0x2010, 0x0002, 0x0020, 0x0333, 0x0001,
+    0x002E, 0x0002, 0x002E, 0x002E, 0x0003, 0x002E, 0x002E, 0x002E, 0x0002, 0x2032, 0x2032, 0x0003,
+    0x2032, 0x2032, 0x2032, 0x0002, 0x2035, 0x2035, 0x0003, 0x2035, 0x2035, 0x2035, 0x0002, 0x0021,
+    0x0021, 0x0002, 0x0020, 0x0305, 0x0002, 0x003F, 0x003F, 0x0002, 0x003F, 0x0021, 0x0002, 0x0021,
+    0x003F, 0x0004, 0x2032, 0x2032, 0x2032, 0x2032, 0x0001, 0x0030, 0x0001, 0x0034, 0x0001, 0x0035,
+    0x0001, 0x0036, 0x0001, 0x0037, 0x0001, 0x0038, 0x0001, 0x0039, 0x0001, 0x002B, 0x0001, 0x2212,
+    0x0001, 0x003D, 0x0001, 0x0028, 0x0001, 0x0029, 0x0001, 0x006E, 0x0002, 0x0052, 0x0073, 0x0003,
+    0x0061, 0x002F, 0x0063, 0x0003, 0x0061, 0x002F, 0x0073, 0x0001, 0x0043, 0x0002, 0x00B0, 0x0043,
+    0x0003, 0x0063, 0x002F, 0x006F, 0x0003, 0x0063, 0x002F, 0x0075, 0x0001, 0x0190, 0x0002, 0x00B0,
+    0x0046, 0x0001, 0x0127, 0x0002, 0x004E, 0x006F, 0x0001, 0x0051, 0x0002, 0x0053, 0x004D, 0x0003,
+    0x0054, 0x0045, 0x004C, 0x0002, 0x0054, 0x004D, 0x0001, 0x005A, 0x0001, 0x03A9, 0x0001, 0x0046,
+    0x0001, 0x05D0, 0x0001, 0x05D1, 0x0001, 0x05D2, 0x0001, 0x05D3, 0x0003, 0x0046, 0x0041, 0x0058,
+    0x0001, 0x0393, 0x0001, 0x03A0, 0x0001, 0x2211, 0x0003, 0x0031, 0x2044, 0x0037, 0x0003, 0x0031,
+    0x2044, 0x0039, 0x0004, 0x0031, 0x2044, 0x0031, 0x0030, 0x0003, 0x0031, 0x2044, 0x0033, 0x0003,
+    0x0032, 0x2044, 0x0033, 0x0003, 0x0031, 0x2044, 0x0035, 0x0003, 0x0032, 0x2044, 0x0035, 0x0003,
+    0x0033, 0x2044, 0x0035, 0x0003, 0x0034, 0x2044, 0x0035, 0x0003, 0x0031, 0x2044, 0x0036, 0x0003,
+    0x0035, 0x2044, 0x0036, 0x0003, 0x0031, 0x2044, 0x0038, 0x0003, 0x0033, 0x2044, 0x0038, 0x0003,
+    0x0035, 0x2044, 0x0038, 0x0003, 0x0037, 0x2044, 0x0038, 0x0002, 0x0031, 0x2044, 0x0002, 0x0049,
+    0x0049, 0x0003, 0x0049, 0x0049, 0x0049, 0x0002, 0x0049, 0x0056, 0x0001, 0x0056, 0x0002, 0x0056,
+    0x0049, 0x0003, 0x0056, 0x0049, 0x0049, 0x0004, 0x0056, 0x0049, 0x0049, 0x0049, 0x0002, 0x0049,
+    0x0058, 0x0001, 0x0058, 0x0002, 0x0058, 0x0049, 0x0003, 0x0058, 0x0049, 0x0049, 0x0002, 0x0069,
+    0x0069, 0x0003, 0x0069, 0x0069, 0x0069, 0x0002, 0x0069, 0x0076, 0x0002, 0x0076, 0x0069, 0x0003,
+    0x0076, 0x0069, 0x0069, 0x0004, 0x0076, 0x0069, 0x0069, 0x0069, 0x0002, 0x0069, 0x0078, 0x0002,
+    0x0078, 0x0069, 0x0003, 0x0078, 0x0069, 0x0069, 0x0003, 0x0030, 0x2044, 0x0033, 0x0002, 0x2190,
+    0x0338, 0x0002, 0x2192, 0x0338, 0x0002, 0x2194, 0x0338, 0x0002, 0x21D0, 0x0338, 0x0002, 0x21D4,
+    0x0338, 0x0002, 0x21D2, 0x0338, 0x0002, 0x2203, 0x0338, 0x0002, 0x2208, 0x0338, 0x0002, 0x220B,
+    0x0338, 0x0002, 0x2223, 0x0338, 0x0002, 0x2225, 0x0338, 0x0002, 0x222B, 0x222B, 0x0003, 0x222B,
+    0x222B, 0x222B, 0x0002, 0x222E, 0x222E, 0x0003, 0x222E, 0x222E, 0x222E, 0x0002, 0x223C, 0x0338,
+    0x0002, 0x2243, 0x0338, 0x0002, 0x2245, 0x0338, 0x0002, 0x2248, 0x0338, 0x0002, 0x003D, 0x0338,
+    0x0002, 0x2261, 0x0338, 0x0002, 0x224D, 0x0338, 0x0002, 0x003C, 0x0338, 0x0002, 0x003E, 0x0338,
+    0x0002, 0x2264, 0x0338, 0x0002, 0x2265, 0x0338, 0x0002, 0x2272, 0x0338, 0x0002, 0x2273, 0x0338,
+    0x0002, 0x2276, 0x0338, 0x0002, 0x2277, 0x0338, 0x0002, 0x227A, 0x0338, 0x0002, 0x227B, 0x0338,
+    0x0002, 0x2282, 0x0338, 0x0002, 0x2283, 0x0338, 0x0002, 0x2286, 0x0338, 0x0002, 0x2287, 0x0338,
+    0x0002, 0x22A2, 0x0338, 0x0002, 0x22A8, 0x0338, 0x0002, 0x22A9, 0x0338, 0x0002, 0x22AB, 0x0338,
+    0x0002, 0x227C, 0x0338, 0x0002, 0x227D, 0x0338, 0x0002, 0x2291, 0x0338, 0x0002, 0x2292, 0x0338,
+    0x0002, 0x22B2, 0x0338, 0x0002, 0x22B3, 0x0338, 0x0002, 0x22B4, 0x0338, 0x0002, 0x22B5, 0x0338,
+    0x0001, 0x3008, 0x0001, 0x3009, 0x0002, 0x0031, 0x0030, 0x0002, 0x0031, 0x0031, 0x0002, 0x0031,
+    0x0032, 0x0002, 0x0031, 0x0033, 0x0002, 0x0031, 0x0034, 0x0002, 0x0031, 0x0035, 0x0002, 0x0031,
+    0x0036, 0x0002, 0x0031, 0x0037, 0x0002, 0x0031, 0x0038, 0x0002, 0x0031, 0x0039, 0x0002, 0x0032,
+    0x0030, 0x0003, 0x0028, 0x0031, 0x0029, 0x0003, 0x0028, 0x0032, 0x0029, 0x0003, 0x0028, 0x0033,
+    0x0029, 0x0003, 0x0028, 0x0034, 0x0029, 0x0003, 0x0028, 0x0035, 0x0029, 0x0003, 0x0028, 0x0036,
+    0x0029, 0x0003, 0x0028, 0x0037, 0x0029, 0x0003, 0x0028, 0x0038, 0x0029, 0x0003, 0x0028, 0x0039,
+    0x0029, 0x0004, 0x0028, 0x0031, 0x0030, 0x0029, 0x0004, 0x0028, 0x0031, 0x0031, 0x0029, 0x0004,
+    0x0028, 0x0031, 0x0032, 0x0029, 0x0004, 0x0028, 0x0031, 0x0033, 0x0029, 0x0004, 0x0028, 0x0031,
+    0x0034, 0x0029, 0x0004, 0x0028, 0x0031, 0x0035, 0x0029, 0x0004, 0x0028, 0x0031, 0x0036, 0x0029,
+    0x0004, 0x0028, 0x0031, 0x0037, 0x0029, 0x0004, 0x0028, 0x0031, 0x0038, 0x0029, 0x0004, 0x0028,
+    0x0031, 0x0039, 0x0029, 0x0004, 0x0028, 0x0032, 0x0030, 0x0029, 0x0002, 0x0031, 0x002E, 0x0002,
+    0x0032, 0x002E, 0x0002, 0x0033, 0x002E, 0x0002, 0x0034, 0x002E, 0x0002, 0x0035, 0x002E, 0x0002,
+    0x0036, 0x002E, 0x0002, 0x0037, 0x002E, 0x0002, 0x0038, 0x002E, 0x0002, 0x0039, 0x002E, 0x0003,
+    0x0031, 0x0030, 0x002E, 0x0003, 0x0031, 0x0031, 0x002E, 0x0003, 0x0031, 0x0032, 0x002E, 0x0003,
+    0x0031, 0x0033, 0x002E, 0x0003, 0x0031, 0x0034, 0x002E, 0x0003, 0x0031, 0x0035, 0x002E, 0x0003,
+    0x0031, 0x0036, 0x002E, 0x0003, 0x0031, 0x0037, 0x002E, 0x0003, 0x0031, 0x0038, 0x002E, 0x0003,
+    0x0031, 0x0039, 0x002E, 0x0003, 0x0032, 0x0030, 0x002E, 0x0003, 0x0028, 0x0061, 0x0029, 0x0003,
+    0x0028, 0x0062, 0x0029, 0x0003, 0x0028, 0x0063, 0x0029, 0x0003, 0x0028, 0x0064, 0x0029, 0x0003,
+    0x0028, 0x0065, 0x0029, 0x0003, 0x0028, 0x0066, 0x0029, 0x0003, 0x0028, 0x0067, 0x0029, 0x0003,
+    0x0028, 0x0068, 0x0029, 0x0003, 0x0028, 0x0069, 0x0029, 0x0003, 0x0028, 0x006A, 0x0029, 0x0003,
+    0x0028, 0x006B, 0x0029, 0x0003, 0x0028, 0x006C, 0x0029, 0x0003, 0x0028, 0x006D, 0x0029, 0x0003,
+    0x0028, 0x006E, 0x0029, 0x0003, 0x0028, 0x006F, 0x0029, 0x0003, 0x0028, 0x0070, 0x0029, 0x0003,
+    0x0028, 0x0071, 0x0029, 0x0003, 0x0028, 0x0072, 0x0029, 0x0003, 0x0028, 0x0073, 0x0029, 0x0003,
+    0x0028, 0x0074, 0x0029, 0x0003, 0x0028, 0x0075, 0x0029, 0x0003, 0x0028, 0x0076, 0x0029, 0x0003,
+    0x0028, 0x0077, 0x0029, 0x0003, 0x0028, 0x0078, 0x0029, 0x0003, 0x0028, 0x0079, 0x0029, 0x0003,
+    0x0028, 0x007A, 0x0029, 0x0001, 0x0053, 0x0001, 0x0059, 0x0001, 0x0071, 0x0004, 0x222B, 0x222B,
+    0x222B, 0x222B, 0x0003, 0x003A, 0x003A, 0x003D, 0x0002, 0x003D, 0x003D, 0x0003, 0x003D, 0x003D,
+    0x003D, 0x0002, 0x2ADD, 0x0338, 0x0001, 0x2D61, 0x0001, 0x6BCD, 0x0001, 0x9F9F, 0x0001, 0x4E00,
+    0x0001, 0x4E28, 0x0001, 0x4E36, 0x0001, 0x4E3F, 0x0001, 0x4E59, 0x0001, 0x4E85, 0x0001, 0x4E8C,
+    0x0001, 0x4EA0, 0x0001, 0x4EBA, 0x0001, 0x513F, 0x0001, 0x5165, 0x0001, 0x516B, 0x0001, 0x5182,
+    0x0001, 0x5196, 0x0001, 0x51AB, 0x0001, 0x51E0, 0x0001, 0x51F5, 0x0001, 0x5200, 0x0001, 0x529B,
+    0x0001, 0x52F9, 0x0001, 0x5315, 0x0001, 0x531A, 0x0001, 0x5338, 0x0001, 0x5341, 0x0001, 0x535C,
+    0x0001, 0x5369, 0x0001, 0x5382, 0x0001, 0x53B6, 0x0001, 0x53C8, 0x0001, 0x53E3, 0x0001, 0x56D7,
+    0x0001, 0x571F, 0x0001, 0x58EB, 0x0001, 0x5902, 0x0001, 0x590A, 0x0001, 0x5915, 0x0001, 0x5927,
+    0x0001, 0x5973, 0x0001, 0x5B50, 0x0001, 0x5B80, 0x0001, 0x5BF8, 0x0001, 0x5C0F, 0x0001, 0x5C22,
+    0x0001, 0x5C38, 0x0001, 0x5C6E, 0x0001, 0x5C71, 0x0001, 0x5DDB, 0x0001, 0x5DE5, 0x0001, 0x5DF1,
+    0x0001, 0x5DFE, 0x0001, 0x5E72, 0x0001, 0x5E7A, 0x0001, 0x5E7F, 0x0001, 0x5EF4, 0x0001, 0x5EFE,
+    0x0001, 0x5F0B, 0x0001, 0x5F13, 0x0001, 0x5F50, 0x0001, 0x5F61, 0x0001, 0x5F73, 0x0001, 0x5FC3,
+    0x0001, 0x6208, 0x0001, 0x6236, 0x0001, 0x624B, 0x0001, 0x652F, 0x0001, 0x6534, 0x0001, 0x6587,
+    0x0001, 0x6597, 0x0001, 0x65A4, 0x0001, 0x65B9, 0x0001, 0x65E0, 0x0001, 0x65E5, 0x0001, 0x66F0,
+    0x0001, 0x6708, 0x0001, 0x6728, 0x0001, 0x6B20, 0x0001, 0x6B62, 0x0001, 0x6B79, 0x0001, 0x6BB3,
+    0x0001, 0x6BCB, 0x0001, 0x6BD4, 0x0001, 0x6BDB, 0x0001, 0x6C0F, 0x0001, 0x6C14, 0x0001, 0x6C34,
+    0x0001, 0x706B, 0x0001, 0x722A, 0x0001, 0x7236, 0x0001, 0x723B, 0x0001, 0x723F, 0x0001, 0x7247,
+    0x0001, 0x7259, 0x0001, 0x725B, 0x0001, 0x72AC, 0x0001, 0x7384, 0x0001, 0x7389, 0x0001, 0x74DC,
+    0x0001, 0x74E6, 0x0001, 0x7518, 0x0001, 0x751F, 0x0001, 0x7528, 0x0001, 0x7530, 0x0001, 0x758B,
+    0x0001, 0x7592, 0x0001, 0x7676, 0x0001, 0x767D, 0x0001, 0x76AE, 0x0001, 0x76BF, 0x0001, 0x76EE,
+    0x0001, 0x77DB, 0x0001, 0x77E2, 0x0001, 0x77F3, 0x0001, 0x793A, 0x0001, 0x79B8, 0x0001, 0x79BE,
+    0x0001, 0x7A74, 0x0001, 0x7ACB, 0x0001, 0x7AF9, 0x0001, 0x7C73, 0x0001, 0x7CF8, 0x0001, 0x7F36,
+    0x0001, 0x7F51, 0x0001, 0x7F8A, 0x0001, 0x7FBD, 0x0001, 0x8001, 0x0001, 0x800C, 0x0001, 0x8012,
+    0x0001, 0x8033, 0x0001, 0x807F, 0x0001, 0x8089, 0x0001, 0x81E3, 0x0001, 0x81EA, 0x0001, 0x81F3,
+    0x0001, 0x81FC, 0x0001, 0x820C, 0x0001, 0x821B, 0x0001, 0x821F, 0x0001, 0x826E, 0x0001, 0x8272,
+    0x0001, 0x8278, 0x0001, 0x864D, 0x0001, 0x866B, 0x0001, 0x8840, 0x0001, 0x884C, 0x0001, 0x8863,
+    0x0001, 0x897E, 0x0001, 0x898B, 0x0001, 0x89D2, 0x0001, 0x8A00, 0x0001, 0x8C37, 0x0001, 0x8C46,
+    0x0001, 0x8C55, 0x0001, 0x8C78, 0x0001, 0x8C9D, 0x0001, 0x8D64, 0x0001, 0x8D70, 0x0001, 0x8DB3,
+    0x0001, 0x8EAB, 0x0001, 0x8ECA, 0x0001, 0x8F9B, 0x0001, 0x8FB0, 0x0001, 0x8FB5, 0x0001, 0x9091,
+    0x0001, 0x9149, 0x0001, 0x91C6, 0x0001, 0x91CC, 0x0001, 0x91D1, 0x0001, 0x9577, 0x0001, 0x9580,
+    0x0001, 0x961C, 0x0001, 0x96B6, 0x0001, 0x96B9, 0x0001, 0x96E8, 0x0001, 0x9751, 0x0001, 0x975E,
+    0x0001, 0x9762, 0x0001, 0x9769, 0x0001, 0x97CB, 0x0001, 0x97ED, 0x0001, 0x97F3, 0x0001, 0x9801,
+    0x0001, 0x98A8, 0x0001, 0x98DB, 0x0001, 0x98DF, 0x0001, 0x9996, 0x0001, 0x9999, 0x0001, 0x99AC,
+    0x0001, 0x9AA8, 0x0001, 0x9AD8, 0x0001, 0x9ADF, 0x0001, 0x9B25, 0x0001, 0x9B2F, 0x0001, 0x9B32,
+    0x0001, 0x9B3C, 0x0001, 0x9B5A, 0x0001, 0x9CE5, 0x0001, 0x9E75, 0x0001, 0x9E7F, 0x0001, 0x9EA5,
+    0x0001, 0x9EBB, 0x0001, 0x9EC3, 0x0001, 0x9ECD, 0x0001, 0x9ED1, 0x0001, 0x9EF9, 0x0001, 0x9EFD,
+    0x0001, 0x9F0E, 0x0001, 0x9F13, 0x0001, 0x9F20, 0x0001, 0x9F3B, 0x0001, 0x9F4A, 0x0001, 0x9F52,
+    0x0001, 0x9F8D, 0x0001, 0x9F9C, 0x0001, 0x9FA0, 0x0001, 0x3012, 0x0001, 0x5344, 0x0001, 0x5345,
+    0x0002, 0x304B, 0x3099, 0x0002, 0x304D, 0x3099, 0x0002, 0x304F, 0x3099, 0x0002, 0x3051, 0x3099,
+    0x0002, 0x3053, 0x3099, 0x0002, 0x3055, 0x3099, 0x0002, 0x3057, 0x3099, 0x0002, 0x3059, 0x3099,
+    0x0002, 0x305B, 0x3099, 0x0002, 0x305D, 0x3099, 0x0002, 0x305F, 0x3099, 0x0002, 0x3061, 0x3099,
+    0x0002, 0x3064, 0x3099, 0x0002, 0x3066, 0x3099, 0x0002, 0x3068, 0x3099, 0x0002, 0x306F, 0x3099,
+    0x0002, 0x306F, 0x309A, 0x0002, 0x3072, 0x3099, 0x0002, 0x3072, 0x309A, 0x0002, 0x3075, 0x3099,
+    0x0002, 0x3075, 0x309A, 0x0002, 0x3078, 0x3099, 0x0002, 0x3078, 0x309A, 0x0002, 0x307B, 0x3099,
+    0x0002, 0x307B, 0x309A, 0x0002, 0x3046, 0x3099, 0x0002, 0x0020, 0x3099, 0x0002, 0x0020, 0x309A,
+    0x0002, 0x309D, 0x3099, 0x0002, 0x3088, 0x308A, 0x0002, 0x30AB, 0x3099, 0x0002, 0x30AD, 0x3099,
+    0x0002, 0x30AF, 0x3099, 0x0002, 0x30B1, 0x3099, 0x0002, 0x30B3, 0x3099, 0x0002, 0x30B5, 0x3099,
+    0x0002, 0x30B7, 0x3099, 0x0002, 0x30B9, 0x3099, 0x0002, 0x30BB, 0x3099, 0x0002, 0x30BD, 0x3099,
+    0x0002, 0x30BF, 0x3099, 0x0002, 0x30C1, 0x3099, 0x0002, 0x30C4, 0x3099, 0x0002, 0x30C6, 0x3099,
+    0x0002, 0x30C8, 0x3099, 0x0002, 0x30CF, 0x3099, 0x0002, 0x30CF, 0x309A, 0x0002, 0x30D2, 0x3099,
+    0x0002, 0x30D2, 0x309A, 0x0002, 0x30D5, 0x3099, 0x0002, 0x30D5, 0x309A, 0x0002, 0x30D8, 0x3099,
+    0x0002, 0x30D8, 0x309A, 0x0002, 0x30DB, 0x3099, 0x0002, 0x30DB, 0x309A, 0x0002, 0x30A6, 0x3099,
+    0x0002, 0x30EF, 0x3099, 0x0002, 0x30F0, 0x3099, 0x0002, 0x30F1, 0x3099, 0x0002, 0x30F2, 0x3099,
+    0x0002, 0x30FD, 0x3099, 0x0002, 0x30B3, 0x30C8, 0x0001, 0x1100, 0x0001, 0x1101, 0x0001, 0x11AA,
+    0x0001, 0x1102, 0x0001, 0x11AC, 0x0001, 0x11AD, 0x0001, 0x1103, 0x0001, 0x1104, 0x0001, 0x1105,
+    0x0001, 0x11B0, 0x0001, 0x11B1, 0x0001, 0x11B2, 0x0001, 0x11B3, 0x0001, 0x11B4, 0x0001, 0x11B5,
+    0x0001, 0x111A, 0x0001, 0x1106, 0x0001, 0x1107, 0x0001, 0x1108, 0x0001, 0x1121, 0x0001, 0x1109,
+    0x0001, 0x110A, 0x0001, 0x110B, 0x0001, 0x110C, 0x0001, 0x110D, 0x0001, 0x110E, 0x0001, 0x110F,
+    0x0001, 0x1110, 0x0001, 0x1111, 0x0001, 0x1112, 0x0001, 0x1161, 0x0001, 0x1162, 0x0001, 0x1163,
+    0x0001, 0x1164, 0x0001, 0x1165, 0x0001, 0x1166, 0x0001, 0x1167, 0x0001, 0x1168, 0x0001, 0x1169,
+    0x0001, 0x116A, 0x0001, 0x116B, 0x0001, 0x116C, 0x0001, 0x116D, 0x0001, 0x116E, 0x0001, 0x116F,
+    0x0001, 0x1170, 0x0001, 0x1171, 0x0001, 0x1172, 0x0001, 0x1173, 0x0001, 0x1174, 0x0001, 0x1175,
+    0x0001, 0x1160, 0x0001, 0x1114, 0x0001, 0x1115, 0x0001, 0x11C7, 0x0001, 0x11C8, 0x0001, 0x11CC,
+    0x0001, 0x11CE, 0x0001, 0x11D3, 0x0001, 0x11D7, 0x0001, 0x11D9, 0x0001, 0x111C, 0x0001, 0x11DD,
+    0x0001, 0x11DF, 0x0001, 0x111D, 0x0001, 0x111E, 0x0001, 0x1120, 0x0001, 0x1122, 0x0001, 0x1123,
+    0x0001, 0x1127, 0x0001, 0x1129, 0x0001, 0x112B, 0x0001, 0x112C, 0x0001, 0x112D, 0x0001, 0x112E,
+    0x0001, 0x112F, 0x0001, 0x1132, 0x0001, 0x1136, 0x0001, 0x1140, 0x0001, 0x1147, 0x0001, 0x114C,
+    0x0001, 0x11F1, 0x0001, 0x11F2, 0x0001, 0x1157, 0x0001, 0x1158, 0x0001, 0x1159, 0x0001, 0x1184,
+    0x0001, 0x1185, 0x0001, 0x1188, 0x0001, 0x1191, 0x0001, 0x1192, 0x0001, 0x1194, 0x0001, 0x119E,
+    0x0001, 0x11A1, 0x0001, 0x4E09, 0x0001, 0x56DB, 0x0001, 0x4E0A, 0x0001, 0x4E2D, 0x0001, 0x4E0B,
+    0x0001, 0x7532, 0x0001, 0x4E19, 0x0001, 0x4E01, 0x0001, 0x5929, 0x0001, 0x5730, 0x0003, 0x0028,
+    0x1100, 0x0029, 0x0003, 0x0028, 0x1102, 0x0029, 0x0003, 0x0028, 0x1103, 0x0029, 0x0003, 0x0028,
+    0x1105, 0x0029, 0x0003, 0x0028, 0x1106, 0x0029, 0x0003, 0x0028, 0x1107, 0x0029, 0x0003, 0x0028,
+    0x1109, 0x0029, 0x0003, 0x0028, 0x110B, 0x0029, 0x0003, 0x0028, 0x110C, 0x0029, 0x0003, 0x0028,
+    0x110E, 0x0029, 0x0003, 0x0028, 0x110F, 0x0029, 0x0003, 0x0028, 0x1110, 0x0029, 0x0003, 0x0028,
+    0x1111, 0x0029, 0x0003, 0x0028, 0x1112, 0x0029, 0x0004, 0x0028, 0x1100, 0x1161, 0x0029, 0x0004,
+    0x0028, 0x1102, 0x1161, 0x0029, 0x0004, 0x0028, 0x1103, 0x1161, 0x0029, 0x0004, 0x0028, 0x1105,
+    0x1161, 0x0029, 0x0004, 0x0028, 0x1106, 0x1161, 0x0029, 0x0004, 0x0028, 0x1107, 0x1161, 0x0029,
+    0x0004, 0x0028, 0x1109, 0x1161, 0x0029, 0x0004, 0x0028, 0x110B, 0x1161, 0x0029, 0x0004, 0x0028,
+    0x110C, 0x1161, 0x0029, 0x0004, 0x0028, 0x110E, 0x1161, 0x0029, 0x0004, 0x0028, 0x110F, 0x1161,
+    0x0029, 0x0004, 0x0028, 0x1110, 0x1161, 0x0029, 0x0004, 0x0028, 0x1111, 0x1161, 0x0029, 0x0004,
+    0x0028, 0x1112, 0x1161, 0x0029, 0x0004, 0x0028, 0x110C, 0x116E, 0x0029, 0x0007, 0x0028, 0x110B,
+    0x1169, 0x110C, 0x1165, 0x11AB, 0x0029, 0x0006, 0x0028, 0x110B, 0x1169, 0x1112, 0x116E, 0x0029,
+    0x0003, 0x0028, 0x4E00, 0x0029, 0x0003, 0x0028, 0x4E8C, 0x0029, 0x0003, 0x0028, 0x4E09, 0x0029,
+    0x0003, 0x0028, 0x56DB, 0x0029, 0x0003, 0x0028, 0x4E94, 0x0029, 0x0003, 0x0028, 0x516D, 0x0029,
+    0x0003, 0x0028, 0x4E03, 0x0029, 0x0003, 0x0028, 0x516B, 0x0029, 0x0003, 0x0028, 0x4E5D, 0x0029,
+    0x0003, 0x0028, 0x5341, 0x0029, 0x0003, 0x0028, 0x6708, 0x0029, 0x0003, 0x0028, 0x706B, 0x0029,
+    0x0003, 0x0028, 0x6C34, 0x0029, 0x0003, 0x0028, 0x6728, 0x0029, 0x0003, 0x0028, 0x91D1, 0x0029,
+    0x0003, 0x0028, 0x571F, 0x0029, 0x0003, 0x0028, 0x65E5, 0x0029, 0x0003, 0x0028, 0x682A, 0x0029,
+    0x0003, 0x0028, 0x6709, 0x0029, 0x0003, 0x0028, 0x793E, 0x0029, 0x0003, 0x0028, 0x540D, 0x0029,
+    0x0003, 0x0028, 0x7279, 0x0029, 0x0003, 0x0028, 0x8CA1, 0x0029, 0x0003, 0x0028, 0x795D, 0x0029,
+    0x0003, 0x0028, 0x52B4, 0x0029, 0x0003, 0x0028, 0x4EE3, 0x0029, 0x0003, 0x0028, 0x547C, 0x0029,
+    0x0003, 0x0028, 0x5B66, 0x0029, 0x0003, 0x0028, 0x76E3, 0x0029, 0x0003, 0x0028, 0x4F01, 0x0029,
+    0x0003, 0x0028, 0x8CC7, 0x0029, 0x0003, 0x0028, 0x5354, 0x0029, 0x0003, 0x0028, 0x796D, 0x0029,
+    0x0003, 0x0028, 0x4F11, 0x0029, 0x0003, 0x0028, 0x81EA, 0x0029, 0x0003, 0x0028, 0x81F3, 0x0029,
+    0x0001, 0x554F, 0x0001, 0x5E7C, 0x0001, 0x7B8F, 0x0003, 0x0050, 0x0054, 0x0045, 0x0002, 0x0032,
+    0x0031, 0x0002, 0x0032, 0x0032, 0x0002, 0x0032, 0x0033, 0x0002, 0x0032, 0x0034, 0x0002, 0x0032,
+    0x0035, 0x0002, 0x0032, 0x0036, 0x0002, 0x0032, 0x0037, 0x0002, 0x0032, 0x0038, 0x0002, 0x0032,
+    0x0039, 0x0002, 0x0033, 0x0030, 0x0002, 0x0033, 0x0031, 0x0002, 0x0033, 0x0032, 0x0002, 0x0033,
+    0x0033, 0x0002, 0x0033, 0x0034, 0x0002, 0x0033, 0x0035, 0x0002, 0x1100, 0x1161, 0x0002, 0x1102,
+    0x1161, 0x0002, 0x1103, 0x1161, 0x0002, 0x1105, 0x1161, 0x0002, 0x1106, 0x1161, 0x0002, 0x1107,
+    0x1161, 0x0002, 0x1109, 0x1161, 0x0002, 0x110B, 0x1161, 0x0002, 0x110C, 0x1161, 0x0002, 0x110E,
+    0x1161, 0x0002, 0x110F, 0x1161, 0x0002, 0x1110, 0x1161, 0x0002, 0x1111, 0x1161, 0x0002, 0x1112,
+    0x1161, 0x0005, 0x110E, 0x1161, 0x11B7, 0x1100, 0x1169, 0x0004, 0x110C, 0x116E, 0x110B, 0x1174,
+    0x0002, 0x110B, 0x116E, 0x0001, 0x4E94, 0x0001, 0x516D, 0x0001, 0x4E03, 0x0001, 0x4E5D, 0x0001,
+    0x682A, 0x0001, 0x6709, 0x0001, 0x793E, 0x0001, 0x540D, 0x0001, 0x7279, 0x0001, 0x8CA1, 0x0001,
+    0x795D, 0x0001, 0x52B4, 0x0001, 0x79D8, 0x0001, 0x7537, 0x0001, 0x9069, 0x0001, 0x512A, 0x0001,
+    0x5370, 0x0001, 0x6CE8, 0x0001, 0x9805, 0x0001, 0x4F11, 0x0001, 0x5199, 0x0001, 0x6B63, 0x0001,
+    0x5DE6, 0x0001, 0x53F3, 0x0001, 0x533B, 0x0001, 0x5B97, 0x0001, 0x5B66, 0x0001, 0x76E3, 0x0001,
+    0x4F01, 0x0001, 0x8CC7, 0x0001, 0x5354, 0x0001, 0x591C, 0x0002, 0x0033, 0x0036, 0x0002, 0x0033,
+    0x0037, 0x0002, 0x0033, 0x0038, 0x0002, 0x0033, 0x0039, 0x0002, 0x0034, 0x0030, 0x0002, 0x0034,
+    0x0031, 0x0002, 0x0034, 0x0032, 0x0002, 0x0034, 0x0033, 0x0002, 0x0034, 0x0034, 0x0002, 0x0034,
+    0x0035, 0x0002, 0x0034, 0x0036, 0x0002, 0x0034, 0x0037, 0x0002, 0x0034, 0x0038, 0x0002, 0x0034,
+    0x0039, 0x0002, 0x0035, 0x0030, 0x0002, 0x0031, 0x6708, 0x0002, 0x0032, 0x6708, 0x0002, 0x0033,
+    0x6708, 0x0002, 0x0034, 0x6708, 0x0002, 0x0035, 0x6708, 0x0002, 0x0036, 0x6708, 0x0002, 0x0037,
+    0x6708, 0x0002, 0x0038, 0x6708, 0x0002, 0x0039, 0x6708, 0x0003, 0x0031, 0x0030, 0x6708, 0x0003,
+    0x0031, 0x0031, 0x6708, 0x0003, 0x0031, 0x0032, 0x6708, 0x0002, 0x0048, 0x0067, 0x0003, 0x0065,
+    0x0072, 0x0067, 0x0002, 0x0065, 0x0056, 0x0003, 0x004C, 0x0054, 0x0044, 0x0001, 0x30A2, 0x0001,
+    0x30A4, 0x0001, 0x30A6, 0x0001, 0x30A8, 0x0001, 0x30AA, 0x0001, 0x30AB, 0x0001, 0x30AD, 0x0001,
+    0x30AF, 0x0001, 0x30B1, 0x0001, 0x30B3, 0x0001, 0x30B5, 0x0001, 0x30B7, 0x0001, 0x30B9, 0x0001,
+    0x30BB, 0x0001, 0x30BD, 0x0001, 0x30BF, 0x0001, 0x30C1, 0x0001, 0x30C4, 0x0001, 0x30C6, 0x0001,
+    0x30C8, 0x0001, 0x30CA, 0x0001, 0x30CB, 0x0001, 0x30CC, 0x0001, 0x30CD, 0x0001, 0x30CE, 0x0001,
+    0x30CF, 0x0001, 0x30D2, 0x0001, 0x30D5, 0x0001, 0x30D8, 0x0001, 0x30DB, 0x0001, 0x30DE, 0x0001,
+    0x30DF, 0x0001, 0x30E0, 0x0001, 0x30E1, 0x0001, 0x30E2, 0x0001, 0x30E4, 0x0001, 0x30E6, 0x0001,
+    0x30E8, 0x0001, 0x30E9, 0x0001, 0x30EA, 0x0001, 0x30EB, 0x0001, 0x30EC, 0x0001, 0x30ED, 0x0001,
+    0x30EF, 0x0001, 0x30F0, 0x0001, 0x30F1, 0x0001, 0x30F2, 0x0002, 0x4EE4, 0x548C, 0x0005, 0x30A2,
+    0x30CF, 0x309A, 0x30FC, 0x30C8, 0x0004, 0x30A2, 0x30EB, 0x30D5, 0x30A1, 0x0005, 0x30A2, 0x30F3,
+    0x30D8, 0x309A, 0x30A2, 0x0003, 0x30A2, 0x30FC, 0x30EB, 0x0005, 0x30A4, 0x30CB, 0x30F3, 0x30AF,
+    0x3099, 0x0003, 0x30A4, 0x30F3, 0x30C1, 0x0003, 0x30A6, 0x30A9, 0x30F3, 0x0006, 0x30A8, 0x30B9,
+    0x30AF, 0x30FC, 0x30C8, 0x3099, 0x0004, 0x30A8, 0x30FC, 0x30AB, 0x30FC, 0x0003, 0x30AA, 0x30F3,
+    0x30B9, 0x0003, 0x30AA, 0x30FC, 0x30E0, 0x0003, 0x30AB, 0x30A4, 0x30EA, 0x0004, 0x30AB, 0x30E9,
+    0x30C3, 0x30C8, 0x0004, 0x30AB, 0x30ED, 0x30EA, 0x30FC, 0x0004, 0x30AB, 0x3099, 0x30ED, 0x30F3,
+    0x0004, 0x30AB, 0x3099, 0x30F3, 0x30DE, 0x0004, 0x30AD, 0x3099, 0x30AB, 0x3099, 0x0004, 0x30AD,
+    0x3099, 0x30CB, 0x30FC, 0x0004, 0x30AD, 0x30E5, 0x30EA, 0x30FC, 0x0006, 0x30AD, 0x3099, 0x30EB,
+    0x30BF, 0x3099, 0x30FC, 0x0002, 0x30AD, 0x30ED, 0x0006, 0x30AD, 0x30ED, 0x30AF, 0x3099, 0x30E9,
+    0x30E0, 0x0006, 0x30AD, 0x30ED, 0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x0005, 0x30AD, 0x30ED, 0x30EF,
+    0x30C3, 0x30C8, 0x0004, 0x30AF, 0x3099, 0x30E9, 0x30E0, 0x0006, 0x30AF, 0x3099, 0x30E9, 0x30E0,
+    0x30C8, 0x30F3, 0x0006, 0x30AF, 0x30EB, 0x30BB, 0x3099, 0x30A4, 0x30ED, 0x0004, 0x30AF, 0x30ED,
+    0x30FC, 0x30CD, 0x0003, 0x30B1, 0x30FC, 0x30B9, 0x0003, 0x30B3, 0x30EB, 0x30CA, 0x0004, 0x30B3,
+    0x30FC, 0x30DB, 0x309A, 0x0004, 0x30B5, 0x30A4, 0x30AF, 0x30EB, 0x0005, 0x30B5, 0x30F3, 0x30C1,
+    0x30FC, 0x30E0, 0x0005, 0x30B7, 0x30EA, 0x30F3, 0x30AF, 0x3099, 0x0003, 0x30BB, 0x30F3, 0x30C1,
+    0x0003, 0x30BB, 0x30F3, 0x30C8, 0x0004, 0x30BF, 0x3099, 0x30FC, 0x30B9, 0x0003, 0x30C6, 0x3099,
+    0x30B7, 0x0003, 0x30C8, 0x3099, 0x30EB, 0x0002, 0x30C8, 0x30F3, 0x0002, 0x30CA, 0x30CE, 0x0003,
+    0x30CE, 0x30C3, 0x30C8, 0x0003, 0x30CF, 0x30A4, 0x30C4, 0x0006, 0x30CF, 0x309A, 0x30FC, 0x30BB,
+    0x30F3, 0x30C8, 0x0004, 0x30CF, 0x309A, 0x30FC, 0x30C4, 0x0005, 0x30CF, 0x3099, 0x30FC, 0x30EC,
+    0x30EB, 0x0006, 0x30D2, 0x309A, 0x30A2, 0x30B9, 0x30C8, 0x30EB, 0x0004, 0x30D2, 0x309A, 0x30AF,
+    0x30EB, 0x0003, 0x30D2, 0x309A, 0x30B3, 0x0003, 0x30D2, 0x3099, 0x30EB, 0x0006, 0x30D5, 0x30A1,
+    0x30E9, 0x30C3, 0x30C8, 0x3099, 0x0004, 0x30D5, 0x30A3, 0x30FC, 0x30C8, 0x0006, 0x30D5, 0x3099,
+    0x30C3, 0x30B7, 0x30A7, 0x30EB, 0x0003, 0x30D5, 0x30E9, 0x30F3, 0x0005, 0x30D8, 0x30AF, 0x30BF,
+    0x30FC, 0x30EB, 0x0003, 0x30D8, 0x309A, 0x30BD, 0x0004, 0x30D8, 0x309A, 0x30CB, 0x30D2, 0x0003,
+    0x30D8, 0x30EB, 0x30C4, 0x0004, 0x30D8, 0x309A, 0x30F3, 0x30B9, 0x0005, 0x30D8, 0x309A, 0x30FC,
+    0x30B7, 0x3099, 0x0004, 0x30D8, 0x3099, 0x30FC, 0x30BF, 0x0005, 0x30DB, 0x309A, 0x30A4, 0x30F3,
+    0x30C8, 0x0004, 0x30DB, 0x3099, 0x30EB, 0x30C8, 0x0002, 0x30DB, 0x30F3, 0x0005, 0x30DB, 0x309A,
+    0x30F3, 0x30C8, 0x3099, 0x0003, 0x30DB, 0x30FC, 0x30EB, 0x0003, 0x30DB, 0x30FC, 0x30F3, 0x0004,
+    0x30DE, 0x30A4, 0x30AF, 0x30ED, 0x0003, 0x30DE, 0x30A4, 0x30EB, 0x0003, 0x30DE, 0x30C3, 0x30CF,
+    0x0003, 0x30DE, 0x30EB, 0x30AF, 0x0005, 0x30DE, 0x30F3, 0x30B7, 0x30E7, 0x30F3, 0x0004, 0x30DF,
+    0x30AF, 0x30ED, 0x30F3, 0x0002, 0x30DF, 0x30EA, 0x0006, 0x30DF, 0x30EA, 0x30CF, 0x3099, 0x30FC,
+    0x30EB, 0x0003, 0x30E1, 0x30AB, 0x3099, 0x0005, 0x30E1, 0x30AB, 0x3099, 0x30C8, 0x30F3, 0x0004,
+    0x30E1, 0x30FC, 0x30C8, 0x30EB, 0x0004, 0x30E4, 0x30FC, 0x30C8, 0x3099, 0x0003, 0x30E4, 0x30FC,
+    0x30EB, 0x0003, 0x30E6, 0x30A2, 0x30F3, 0x0004, 0x30EA, 0x30C3, 0x30C8, 0x30EB, 0x0002, 0x30EA,
+    0x30E9, 0x0004, 0x30EB, 0x30D2, 0x309A, 0x30FC, 0x0005, 0x30EB, 0x30FC, 0x30D5, 0x3099, 0x30EB,
+    0x0002, 0x30EC, 0x30E0, 0x0006, 0x30EC, 0x30F3, 0x30C8, 0x30B1, 0x3099, 0x30F3, 0x0003, 0x30EF,
+    0x30C3, 0x30C8, 0x0002, 0x0030, 0x70B9, 0x0002, 0x0031, 0x70B9, 0x0002, 0x0032, 0x70B9, 0x0002,
+    0x0033, 0x70B9, 0x0002, 0x0034, 0x70B9, 0x0002, 0x0035, 0x70B9, 0x0002, 0x0036, 0x70B9, 0x0002,
+    0x0037, 0x70B9, 0x0002, 0x0038, 0x70B9, 0x0002, 0x0039, 0x70B9, 0x0003, 0x0031, 0x0030, 0x70B9,
+    0x0003, 0x0031, 0x0031, 0x70B9, 0x0003, 0x0031, 0x0032, 0x70B9, 0x0003, 0x0031, 0x0033, 0x70B9,
+    0x0003, 0x0031, 0x0034, 0x70B9, 0x0003, 0x0031, 0x0035, 0x70B9, 0x0003, 0x0031, 0x0036, 0x70B9,
+    0x0003, 0x0031, 0x0037, 0x70B9, 0x0003, 0x0031, 0x0038, 0x70B9, 0x0003, 0x0031, 0x0039, 0x70B9,
+    0x0003, 0x0032, 0x0030, 0x70B9, 0x0003, 0x0032, 0x0031, 0x70B9, 0x0003, 0x0032, 0x0032, 0x70B9,
+    0x0003, 0x0032, 0x0033, 0x70B9, 0x0003, 0x0032, 0x0034, 0x70B9, 0x0003, 0x0068, 0x0050, 0x0061,
+    0x0002, 0x0064, 0x0061, 0x0002, 0x0041, 0x0055, 0x0003, 0x0062, 0x0061, 0x0072, 0x0002, 0x006F,
+    0x0056, 0x0002, 0x0070, 0x0063, 0x0002, 0x0064, 0x006D, 0x0003, 0x0064, 0x006D, 0x0032, 0x0003,
+    0x0064, 0x006D, 0x0033, 0x0002, 0x0049, 0x0055, 0x0002, 0x5E73, 0x6210, 0x0002, 0x662D, 0x548C,
+    0x0002, 0x5927, 0x6B63, 0x0002, 0x660E, 0x6CBB, 0x0004, 0x682A, 0x5F0F, 0x4F1A, 0x793E, 0x0002,
+    0x0070, 0x0041, 0x0002, 0x006E, 0x0041, 0x0002, 0x03BC, 0x0041, 0x0002, 0x006D, 0x0041, 0x0002,
+    0x006B, 0x0041, 0x0002, 0x004B, 0x0042, 0x0002, 0x004D, 0x0042, 0x0002, 0x0047, 0x0042, 0x0003,
+    0x0063, 0x0061, 0x006C, 0x0004, 0x006B, 0x0063, 0x0061, 0x006C, 0x0002, 0x0070, 0x0046, 0x0002,
+    0x006E, 0x0046, 0x0002, 0x03BC, 0x0046, 0x0002, 0x03BC, 0x0067, 0x0002, 0x006D, 0x0067, 0x0002,
+    0x006B, 0x0067, 0x0002, 0x0048, 0x007A, 0x0003, 0x006B, 0x0048, 0x007A, 0x0003, 0x004D, 0x0048,
+    0x007A, 0x0003, 0x0047, 0x0048, 0x007A, 0x0003, 0x0054, 0x0048, 0x007A, 0x0002, 0x03BC, 0x006C,
+    0x0002, 0x006D, 0x006C, 0x0002, 0x0064, 0x006C, 0x0002, 0x006B, 0x006C, 0x0002, 0x0066, 0x006D,
+    0x0002, 0x006E, 0x006D, 0x0002, 0x03BC, 0x006D, 0x0002, 0x006D, 0x006D, 0x0002, 0x0063, 0x006D,
+    0x0002, 0x006B, 0x006D, 0x0003, 0x006D, 0x006D, 0x0032, 0x0003, 0x0063, 0x006D, 0x0032, 0x0002,
+    0x006D, 0x0032, 0x0003, 0x006B, 0x006D, 0x0032, 0x0003, 0x006D, 0x006D, 0x0033, 0x0003, 0x0063,
+    0x006D, 0x0033, 0x0002, 0x006D, 0x0033, 0x0003, 0x006B, 0x006D, 0x0033, 0x0003, 0x006D, 0x2215,
+    0x0073, 0x0004, 0x006D, 0x2215, 0x0073, 0x0032, 0x0002, 0x0050, 0x0061, 0x0003, 0x006B, 0x0050,
+    0x0061, 0x0003, 0x004D, 0x0050, 0x0061, 0x0003, 0x0047, 0x0050, 0x0061, 0x0003, 0x0072, 0x0061,
+    0x0064, 0x0005, 0x0072, 0x0061, 0x0064, 0x2215, 0x0073, 0x0006, 0x0072, 0x0061, 0x0064, 0x2215,
+    0x0073, 0x0032, 0x0002, 0x0070, 0x0073, 0x0002, 0x006E, 0x0073, 0x0002, 0x03BC, 0x0073, 0x0002,
+    0x006D, 0x0073, 0x0002, 0x0070, 0x0056, 0x0002, 0x006E, 0x0056, 0x0002, 0x03BC, 0x0056, 0x0002,
+    0x006D, 0x0056, 0x0002, 0x006B, 0x0056, 0x0002, 0x004D, 0x0056, 0x0002, 0x0070, 0x0057, 0x0002,
+    0x006E, 0x0057, 0x0002, 0x03BC, 0x0057, 0x0002, 0x006D, 0x0057, 0x0002, 0x006B, 0x0057, 0x0002,
+    0x004D, 0x0057, 0x0002, 0x006B, 0x03A9, 0x0002, 0x004D, 0x03A9, 0x0004, 0x0061, 0x002E, 0x006D,
+    0x002E, 0x0002, 0x0042, 0x0071, 0x0002, 0x0063, 0x0063, 0x0002, 0x0063, 0x0064, 0x0004, 0x0043,
+    0x2215, 0x006B, 0x0067, 0x0003, 0x0043, 0x006F, 0x002E, 0x0002, 0x0064, 0x0042, 0x0002, 0x0047,
+    0x0079, 0x0002, 0x0068, 0x0061, 0x0002, 0x0048, 0x0050, 0x0002, 0x0069, 0x006E, 0x0002, 0x004B,
+    0x004B, 0x0002, 0x004B, 0x004D, 0x0002, 0x006B, 0x0074, 0x0002, 0x006C, 0x006D, 0x0002, 0x006C,
+    0x006E, 0x0003, 0x006C, 0x006F, 0x0067, 0x0002, 0x006C, 0x0078, 0x0002, 0x006D, 0x0062, 0x0003,
+    0x006D, 0x0069, 0x006C, 0x0003, 0x006D, 0x006F, 0x006C, 0x0002, 0x0050, 0x0048, 0x0004, 0x0070,
+    0x002E, 0x006D, 0x002E, 0x0003, 0x0050, 0x0050, 0x004D, 0x0002, 0x0050, 0x0052, 0x0002, 0x0073,
+    0x0072, 0x0002, 0x0053, 0x0076, 0x0002, 0x0057, 0x0062, 0x0003, 0x0056, 0x2215, 0x006D, 0x0003,
+    0x0041, 0x2215, 0x006D, 0x0002, 0x0031, 0x65E5, 0x0002, 0x0032, 0x65E5, 0x0002, 0x0033, 0x65E5,
+    0x0002, 0x0034, 0x65E5, 0x0002, 0x0035, 0x65E5, 0x0002, 0x0036, 0x65E5, 0x0002, 0x0037, 0x65E5,
+    0x0002, 0x0038, 0x65E5, 0x0002, 0x0039, 0x65E5, 0x0003, 0x0031, 0x0030, 0x65E5, 0x0003, 0x0031,
+    0x0031, 0x65E5, 0x0003, 0x0031, 0x0032, 0x65E5, 0x0003, 0x0031, 0x0033, 0x65E5, 0x0003, 0x0031,
+    0x0034, 0x65E5, 0x0003, 0x0031, 0x0035, 0x65E5, 0x0003, 0x0031, 0x0036, 0x65E5, 0x0003, 0x0031,
+    0x0037, 0x65E5, 0x0003, 0x0031, 0x0038, 0x65E5, 0x0003, 0x0031, 0x0039, 0x65E5, 0x0003, 0x0032,
+    0x0030, 0x65E5, 0x0003, 0x0032, 0x0031, 0x65E5, 0x0003, 0x0032, 0x0032, 0x65E5, 0x0003, 0x0032,
+    0x0033, 0x65E5, 0x0003, 0x0032, 0x0034, 0x65E5, 0x0003, 0x0032, 0x0035, 0x65E5, 0x0003, 0x0032,
+    0x0036, 0x65E5, 0x0003, 0x0032, 0x0037, 0x65E5, 0x0003, 0x0032, 0x0038, 0x65E5, 0x0003, 0x0032,
+    0x0039, 0x65E5, 0x0003, 0x0033, 0x0030, 0x65E5, 0x0003, 0x0033, 0x0031, 0x65E5, 0x0003, 0x0067,
+    0x0061, 0x006C, 0x0001, 0x044A, 0x0001, 0x044C, 0x0001, 0xA76F, 0x0001, 0x0126, 0x0001, 0x0153,
+    0x0001, 0xA727, 0x0001, 0xAB37, 0x0001, 0x026B, 0x0001, 0xAB52, 0x0001, 0x028D, 0x0001, 0x8C48,
+    0x0001, 0x66F4, 0x0001, 0x8CC8, 0x0001, 0x6ED1, 0x0001, 0x4E32, 0x0001, 0x53E5, 0x0001, 0x5951,
+    0x0001, 0x5587, 0x0001, 0x5948, 0x0001, 0x61F6, 0x0001, 0x7669, 0x0001, 0x7F85, 0x0001, 0x863F,
+    0x0001, 0x87BA, 0x0001, 0x88F8, 0x0001, 0x908F, 0x0001, 0x6A02, 0x0001, 0x6D1B, 0x0001, 0x70D9,
+    0x0001, 0x73DE, 0x0001, 0x843D, 0x0001, 0x916A, 0x0001, 0x99F1, 0x0001, 0x4E82, 0x0001, 0x5375,
+    0x0001, 0x6B04, 0x0001, 0x721B, 0x0001, 0x862D, 0x0001, 0x9E1E, 0x0001, 0x5D50, 0x0001, 0x6FEB,
+    0x0001, 0x85CD, 0x0001, 0x8964, 0x0001, 0x62C9, 0x0001, 0x81D8, 0x0001, 0x881F, 0x0001, 0x5ECA,
+    0x0001, 0x6717, 0x0001, 0x6D6A, 0x0001, 0x72FC, 0x0001, 0x90CE, 0x0001, 0x4F86, 0x0001, 0x51B7,
+    0x0001, 0x52DE, 0x0001, 0x64C4, 0x0001, 0x6AD3, 0x0001, 0x7210, 0x0001, 0x76E7, 0x0001, 0x8606,
+    0x0001, 0x865C, 0x0001, 0x8DEF, 0x0001, 0x9732, 0x0001, 0x9B6F, 0x0001, 0x9DFA, 0x0001, 0x788C,
+    0x0001, 0x797F, 0x0001, 0x7DA0, 0x0001, 0x83C9, 0x0001, 0x9304, 0x0001, 0x8AD6, 0x0001, 0x58DF,
+    0x0001, 0x5F04, 0x0001, 0x7C60, 0x0001, 0x807E, 0x0001, 0x7262, 0x0001, 0x78CA, 0x0001, 0x8CC2,
+    0x0001, 0x96F7, 0x0001, 0x58D8, 0x0001, 0x5C62, 0x0001, 0x6A13, 0x0001, 0x6DDA, 0x0001, 0x6F0F,
+    0x0001, 0x7D2F, 0x0001, 0x7E37, 0x0001, 0x964B, 0x0001, 0x52D2, 0x0001, 0x808B, 0x0001, 0x51DC,
+    0x0001, 0x51CC, 0x0001, 0x7A1C, 0x0001, 0x7DBE, 0x0001, 0x83F1, 0x0001, 0x9675, 0x0001, 0x8B80,
+    0x0001, 0x62CF, 0x0001, 0x8AFE, 0x0001, 0x4E39, 0x0001, 0x5BE7, 0x0001, 0x6012, 0x0001, 0x7387,
+    0x0001, 0x7570, 0x0001, 0x5317, 0x0001, 0x78FB, 0x0001, 0x4FBF, 0x0001, 0x5FA9, 0x0001, 0x4E0D,
+    0x0001, 0x6CCC, 0x0001, 0x6578, 0x0001, 0x7D22, 0x0001, 0x53C3, 0x0001, 0x585E, 0x0001, 0x7701,
+    0x0001, 0x8449, 0x0001, 0x8AAA, 0x0001, 0x6BBA, 0x0001, 0x6C88, 0x0001, 0x62FE, 0x0001, 0x82E5,
+    0x0001, 0x63A0, 0x0001, 0x7565, 0x0001, 0x4EAE, 0x0001, 0x5169, 0x0001, 0x51C9, 0x0001, 0x6881,
+    0x0001, 0x7CE7, 0x0001, 0x826F, 0x0001, 0x8AD2, 0x0001, 0x91CF, 0x0001, 0x52F5, 0x0001, 0x5442,
+    0x0001, 0x5EEC, 0x0001, 0x65C5, 0x0001, 0x6FFE, 0x0001, 0x792A, 0x0001, 0x95AD, 0x0001, 0x9A6A,
+    0x0001, 0x9E97, 0x0001, 0x9ECE, 0x0001, 0x66C6, 0x0001, 0x6B77, 0x0001, 0x8F62, 0x0001, 0x5E74,
+    0x0001, 0x6190, 0x0001, 0x6200, 0x0001, 0x649A, 0x0001, 0x6F23, 0x0001, 0x7149, 0x0001, 0x7489,
+    0x0001, 0x79CA, 0x0001, 0x7DF4, 0x0001, 0x806F, 0x0001, 0x8F26, 0x0001, 0x84EE, 0x0001, 0x9023,
+    0x0001, 0x934A, 0x0001, 0x5217, 0x0001, 0x52A3, 0x0001, 0x54BD, 0x0001, 0x70C8, 0x0001, 0x88C2,
+    0x0001, 0x5EC9, 0x0001, 0x5FF5, 0x0001, 0x637B, 0x0001, 0x6BAE, 0x0001, 0x7C3E, 0x0001, 0x7375,
+    0x0001, 0x4EE4, 0x0001, 0x56F9, 0x0001, 0x5DBA, 0x0001, 0x601C, 0x0001, 0x73B2, 0x0001, 0x7469,
+    0x0001, 0x7F9A, 0x0001, 0x8046, 0x0001, 0x9234, 0x0001, 0x96F6, 0x0001, 0x9748, 0x0001, 0x9818,
+    0x0001, 0x4F8B, 0x0001, 0x79AE, 0x0001, 0x91B4, 0x0001, 0x96B8, 0x0001, 0x60E1, 0x0001, 0x4E86,
+    0x0001, 0x50DA, 0x0001, 0x5BEE, 0x0001, 0x5C3F, 0x0001, 0x6599, 0x0001, 0x71CE, 0x0001, 0x7642,
+    0x0001, 0x84FC, 0x0001, 0x907C, 0x0001, 0x6688, 0x0001, 0x962E, 0x0001, 0x5289, 0x0001, 0x677B,
+    0x0001, 0x67F3, 0x0001, 0x6D41, 0x0001, 0x6E9C, 0x0001, 0x7409, 0x0001, 0x7559, 0x0001, 0x786B,
+    0x0001, 0x7D10, 0x0001, 0x985E, 0x0001, 0x622E, 0x0001, 0x9678, 0x0001, 0x502B, 0x0001, 0x5D19,
+    0x0001, 0x6DEA, 0x0001, 0x8F2A, 0x0001, 0x5F8B, 0x0001, 0x6144, 0x0001, 0x6817, 0x0001, 0x9686,
+    0x0001, 0x5229, 0x0001, 0x540F, 0x0001, 0x5C65, 0x0001, 0x6613, 0x0001, 0x674E, 0x0001, 0x68A8,
+    0x0001, 0x6CE5, 0x0001, 0x7406, 0x0001, 0x75E2, 0x0001, 0x7F79, 0x0001, 0x88CF, 0x0001, 0x88E1,
+    0x0001, 0x96E2, 0x0001, 0x533F, 0x0001, 0x6EBA, 0x0001, 0x541D, 0x0001, 0x71D0, 0x0001, 0x7498,
+    0x0001, 0x85FA, 0x0001, 0x96A3, 0x0001, 0x9C57, 0x0001, 0x9E9F, 0x0001, 0x6797, 0x0001, 0x6DCB,
+    0x0001, 0x81E8, 0x0001, 0x7B20, 0x0001, 0x7C92, 0x0001, 0x72C0, 0x0001, 0x7099, 0x0001, 0x8B58,
+    0x0001, 0x4EC0, 0x0001, 0x8336, 0x0001, 0x523A, 0x0001, 0x5207, 0x0001, 0x5EA6, 0x0001, 0x62D3,
+    0x0001, 0x7CD6, 0x0001, 0x5B85, 0x0001, 0x6D1E, 0x0001, 0x66B4, 0x0001, 0x8F3B, 0x0001, 0x964D,
+    0x0001, 0x5ED3, 0x0001, 0x5140, 0x0001, 0x55C0, 0x0001, 0x585A, 0x0001, 0x6674, 0x0001, 0x51DE,
+    0x0001, 0x732A, 0x0001, 0x76CA, 0x0001, 0x793C, 0x0001, 0x795E, 0x0001, 0x7965, 0x0001, 0x798F,
+    0x0001, 0x9756, 0x0001, 0x7CBE, 0x0001, 0x8612, 0x0001, 0x8AF8, 0x0001, 0x9038, 0x0001, 0x90FD,
+    0x0001, 0x98EF, 0x0001, 0x98FC, 0x0001, 0x9928, 0x0001, 0x9DB4, 0x0001, 0x90DE, 0x0001, 0x96B7,
+    0x0001, 0x4FAE, 0x0001, 0x50E7, 0x0001, 0x514D, 0x0001, 0x52C9, 0x0001, 0x52E4, 0x0001, 0x5351,
+    0x0001, 0x559D, 0x0001, 0x5606, 0x0001, 0x5668, 0x0001, 0x5840, 0x0001, 0x58A8, 0x0001, 0x5C64,
+    0x0001, 0x6094, 0x0001, 0x6168, 0x0001, 0x618E, 0x0001, 0x61F2, 0x0001, 0x654F, 0x0001, 0x65E2,
+    0x0001, 0x6691, 0x0001, 0x6885, 0x0001, 0x6D77, 0x0001, 0x6E1A, 0x0001, 0x6F22, 0x0001, 0x716E,
+    0x0001, 0x722B, 0x0001, 0x7422, 0x0001, 0x7891, 0x0001, 0x7949, 0x0001, 0x7948, 0x0001, 0x7950,
+    0x0001, 0x7956, 0x0001, 0x798D, 0x0001, 0x798E, 0x0001, 0x7A40, 0x0001, 0x7A81, 0x0001, 0x7BC0,
+    0x0001, 0x7E09, 0x0001, 0x7E41, 0x0001, 0x7F72, 0x0001, 0x8005, 0x0001, 0x81ED, 0x0001, 0x8279,
+    0x0001, 0x8457, 0x0001, 0x8910, 0x0001, 0x8996, 0x0001, 0x8B01, 0x0001, 0x8B39, 0x0001, 0x8CD3,
+    0x0001, 0x8D08, 0x0001, 0x8FB6, 0x0001, 0x96E3, 0x0001, 0x97FF, 0x0001, 0x983B, 0x0001, 0x6075,
+    0x0001, 0x242EE, 0x0001, 0x8218, 0x0001, 0x4E26, 0x0001, 0x51B5, 0x0001, 0x5168, 0x0001, 0x4F80,
+    0x0001, 0x5145, 0x0001, 0x5180, 0x0001, 0x52C7, 0x0001, 0x52FA, 0x0001, 0x5555, 0x0001, 0x5599,
+    0x0001, 0x55E2, 0x0001, 0x58B3, 0x0001, 0x5944, 0x0001, 0x5954, 0x0001, 0x5A62, 0x0001, 0x5B28,
+    0x0001, 0x5ED2, 0x0001, 0x5ED9, 0x0001, 0x5F69, 0x0001, 0x5FAD, 0x0001, 0x60D8, 0x0001, 0x614E,
+    0x0001, 0x6108, 0x0001, 0x6160, 0x0001, 0x6234, 0x0001, 0x63C4, 0x0001, 0x641C, 0x0001, 0x6452,
+    0x0001, 0x6556, 0x0001, 0x671B, 0x0001, 0x6756, 0x0001, 0x6EDB, 0x0001, 0x6ECB, 0x0001, 0x701E,
+    0x0001, 0x77A7, 0x0001, 0x7235, 0x0001, 0x72AF, 0x0001, 0x7471, 0x0001, 0x7506, 0x0001, 0x753B,
+    0x0001, 0x761D, 0x0001, 0x761F, 0x0001, 0x76DB, 0x0001, 0x76F4, 0x0001, 0x774A, 0x0001, 0x7740,
+    0x0001, 0x78CC, 0x0001, 0x7AB1, 0x0001, 0x7C7B, 0x0001, 0x7D5B, 0x0001, 0x7F3E, 0x0001, 0x8352,
+    0x0001, 0x83EF, 0x0001, 0x8779, 0x0001, 0x8941, 0x0001, 0x8986, 0x0001, 0x8ABF, 0x0001, 0x8ACB,
+    0x0001, 0x8AED, 0x0001, 0x8B8A, 0x0001, 0x8F38, 0x0001, 0x9072, 0x0001, 0x9199, 0x0001, 0x9276,
+    0x0001, 0x967C, 0x0001, 0x97DB, 0x0001, 0x980B, 0x0001, 0x9B12, 0x0001, 0x2284A, 0x0001, 0x22844,
+    0x0001, 0x233D5, 0x0001, 0x3B9D, 0x0001, 0x4018, 0x0001, 0x4039, 0x0001, 0x25249, 0x0001, 0x25CD0,
+    0x0001, 0x27ED3, 0x0001, 0x9F43, 0x0001, 0x9F8E, 0x0002, 0x0066, 0x0066, 0x0002, 0x0066, 0x0069,
+    0x0002, 0x0066, 0x006C, 0x0003, 0x0066, 0x0066, 0x0069, 0x0003, 0x0066, 0x0066, 0x006C, 0x0002,
+    0x0073, 0x0074, 0x0002, 0x0574, 0x0576, 0x0002, 0x0574, 0x0565, 0x0002, 0x0574, 0x056B, 0x0002,
+    0x057E, 0x0576, 0x0002, 0x0574, 0x056D, 0x0002, 0x05D9, 0x05B4, 0x0002, 0x05F2, 0x05B7, 0x0001,
+    0x05E2, 0x0001, 0x05D4, 0x0001, 0x05DB, 0x0001, 0x05DC, 0x0001, 0x05DD, 0x0001, 0x05E8, 0x0001,
+    0x05EA, 0x0002, 0x05E9, 0x05C1, 0x0002, 0x05E9, 0x05C2, 0x0003, 0x05E9, 0x05BC, 0x05C1, 0x0003,
+    0x05E9, 0x05BC, 0x05C2, 0x0002, 0x05D0, 0x05B7, 0x0002, 0x05D0, 0x05B8, 0x0002, 0x05D0, 0x05BC,
+    0x0002, 0x05D1, 0x05BC, 0x0002, 0x05D2, 0x05BC, 0x0002, 0x05D3, 0x05BC, 0x0002, 0x05D4, 0x05BC,
+    0x0002, 0x05D5, 0x05BC, 0x0002, 0x05D6, 0x05BC, 0x0002, 0x05D8, 0x05BC, 0x0002, 0x05D9, 0x05BC,
+    0x0002, 0x05DA, 0x05BC, 0x0002, 0x05DB, 0x05BC, 0x0002, 0x05DC, 0x05BC, 0x0002, 0x05DE, 0x05BC,
+    0x0002, 0x05E0, 0x05BC, 0x0002, 0x05E1, 0x05BC, 0x0002, 0x05E3, 0x05BC, 0x0002, 0x05E4, 0x05BC,
+    0x0002, 0x05E6, 0x05BC, 0x0002, 0x05E7, 0x05BC, 0x0002, 0x05E8, 0x05BC, 0x0002, 0x05E9, 0x05BC,
+    0x0002, 0x05EA, 0x05BC, 0x0002, 0x05D5, 0x05B9, 0x0002, 0x05D1, 0x05BF, 0x0002, 0x05DB, 0x05BF,
+    0x0002, 0x05E4, 0x05BF, 0x0002, 0x05D0, 0x05DC, 0x0001, 0x0671, 0x0001, 0x067B, 0x0001, 0x067E,
+    0x0001, 0x0680, 0x0001, 0x067A, 0x0001, 0x067F, 0x0001, 0x0679, 0x0001, 0x06A4, 0x0001, 0x06A6,
+    0x0001, 0x0684, 0x0001, 0x0683, 0x0001, 0x0686, 0x0001, 0x0687, 0x0001, 0x068D, 0x0001, 0x068C,
+    0x0001, 0x068E, 0x0001, 0x0688, 0x0001, 0x0698, 0x0001, 0x0691, 0x0001, 0x06A9, 0x0001, 0x06AF,
+    0x0001, 0x06B3, 0x0001, 0x06B1, 0x0001, 0x06BA, 0x0001, 0x06BB, 0x0001, 0x06C1, 0x0001, 0x06BE,
+    0x0001, 0x06D2, 0x0001, 0x06AD, 0x0001, 0x06C7, 0x0001, 0x06C6, 0x0001, 0x06C8, 0x0001, 0x06CB,
+    0x0001, 0x06C5, 0x0001, 0x06C9, 0x0001, 0x06D0, 0x0001, 0x0649, 0x0003, 0x064A, 0x0654, 0x0627,
+    0x0003, 0x064A, 0x0654, 0x06D5, 0x0003, 0x064A, 0x0654, 0x0648, 0x0003, 0x064A, 0x0654, 0x06C7,
+    0x0003, 0x064A, 0x0654, 0x06C6, 0x0003, 0x064A, 0x0654, 0x06C8, 0x0003, 0x064A, 0x0654, 0x06D0,
+    0x0003, 0x064A, 0x0654, 0x0649, 0x0001, 0x06CC, 0x0003, 0x064A, 0x0654, 0x062C, 0x0003, 0x064A,
+    0x0654, 0x062D, 0x0003, 0x064A, 0x0654, 0x0645, 0x0003, 0x064A, 0x0654, 0x064A, 0x0002, 0x0628,
+    0x062C, 0x0002, 0x0628, 0x062D, 0x0002, 0x0628, 0x062E, 0x0002, 0x0628, 0x0645, 0x0002, 0x0628,
+    0x0649, 0x0002, 0x0628, 0x064A, 0x0002, 0x062A, 0x062C, 0x0002, 0x062A, 0x062D, 0x0002, 0x062A,
+    0x062E, 0x0002, 0x062A, 0x0645, 0x0002, 0x062A, 0x0649, 0x0002, 0x062A, 0x064A, 0x0002, 0x062B,
+    0x062C, 0x0002, 0x062B, 0x0645, 0x0002, 0x062B, 0x0649, 0x0002, 0x062B, 0x064A, 0x0002, 0x062C,
+    0x062D, 0x0002, 0x062C, 0x0645, 0x0002, 0x062D, 0x062C, 0x0002, 0x062D, 0x0645, 0x0002, 0x062E,
+    0x062C, 0x0002, 0x062E, 0x062D, 0x0002, 0x062E, 0x0645, 0x0002, 0x0633, 0x062C, 0x0002, 0x0633,
+    0x062D, 0x0002, 0x0633, 0x062E, 0x0002, 0x0633, 0x0645, 0x0002, 0x0635, 0x062D, 0x0002, 0x0635,
+    0x0645, 0x0002, 0x0636, 0x062C, 0x0002, 0x0636, 0x062D, 0x0002, 0x0636, 0x062E, 0x0002, 0x0636,
+    0x0645, 0x0002, 0x0637, 0x062D, 0x0002, 0x0637, 0x0645, 0x0002, 0x0638, 0x0645, 0x0002, 0x0639,
+    0x062C, 0x0002, 0x0639, 0x0645, 0x0002, 0x063A, 0x062C, 0x0002, 0x063A, 0x0645, 0x0002, 0x0641,
+    0x062C, 0x0002, 0x0641, 0x062D, 0x0002, 0x0641, 0x062E, 0x0002, 0x0641, 0x0645, 0x0002, 0x0641,
+    0x0649, 0x0002, 0x0641, 0x064A, 0x0002, 0x0642, 0x062D, 0x0002, 0x0642, 0x0645, 0x0002, 0x0642,
+    0x0649, 0x0002, 0x0642, 0x064A, 0x0002, 0x0643, 0x0627, 0x0002, 0x0643, 0x062C, 0x0002, 0x0643,
+    0x062D, 0x0002, 0x0643, 0x062E, 0x0002, 0x0643, 0x0644, 0x0002, 0x0643, 0x0645, 0x0002, 0x0643,
+    0x0649, 0x0002, 0x0643, 0x064A, 0x0002, 0x0644, 0x062C, 0x0002, 0x0644, 0x062D, 0x0002, 0x0644,
+    0x062E, 0x0002, 0x0644, 0x0645, 0x0002, 0x0644, 0x0649, 0x0002, 0x0644, 0x064A, 0x0002, 0x0645,
+    0x062C, 0x0002, 0x0645, 0x062D, 0x0002, 0x0645, 0x062E, 0x0002, 0x0645, 0x0645, 0x0002, 0x0645,
+    0x0649, 0x0002, 0x0645, 0x064A, 0x0002, 0x0646, 0x062C, 0x0002, 0x0646, 0x062D, 0x0002, 0x0646,
+    0x062E, 0x0002, 0x0646, 0x0645, 0x0002, 0x0646, 0x0649, 0x0002, 0x0646, 0x064A, 0x0002, 0x0647,
+    0x062C, 0x0002, 0x0647, 0x0645, 0x0002, 0x0647, 0x0649, 0x0002, 0x0647, 0x064A, 0x0002, 0x064A,
+    0x062C, 0x0002, 0x064A, 0x062D, 0x0002, 0x064A, 0x062E, 0x0002, 0x064A, 0x0645, 0x0002, 0x064A,
+    0x0649, 0x0002, 0x064A, 0x064A, 0x0002, 0x0630, 0x0670, 0x0002, 0x0631, 0x0670, 0x0002, 0x0649,
+    0x0670, 0x0003, 0x0020, 0x064C, 0x0651, 0x0003, 0x0020, 0x064D, 0x0651, 0x0003, 0x0020, 0x064E,
+    0x0651, 0x0003, 0x0020, 0x064F, 0x0651, 0x0003, 0x0020, 0x0650, 0x0651, 0x0003, 0x0020, 0x0651,
+    0x0670, 0x0003, 0x064A, 0x0654, 0x0631, 0x0003, 0x064A, 0x0654, 0x0632, 0x0003, 0x064A, 0x0654,
+    0x0646, 0x0002, 0x0628, 0x0631, 0x0002, 0x0628, 0x0632, 0x0002, 0x0628, 0x0646, 0x0002, 0x062A,
+    0x0631, 0x0002, 0x062A, 0x0632, 0x0002, 0x062A, 0x0646, 0x0002, 0x062B, 0x0631, 0x0002, 0x062B,
+    0x0632, 0x0002, 0x062B, 0x0646, 0x0002, 0x0645, 0x0627, 0x0002, 0x0646, 0x0631, 0x0002, 0x0646,
+    0x0632, 0x0002, 0x0646, 0x0646, 0x0002, 0x064A, 0x0631, 0x0002, 0x064A, 0x0632, 0x0002, 0x064A,
+    0x0646, 0x0003, 0x064A, 0x0654, 0x062E, 0x0003, 0x064A, 0x0654, 0x0647, 0x0002, 0x0628, 0x0647,
+    0x0002, 0x062A, 0x0647, 0x0002, 0x0635, 0x062E, 0x0002, 0x0644, 0x0647, 0x0002, 0x0646, 0x0647,
+    0x0002, 0x0647, 0x0670, 0x0002, 0x064A, 0x0647, 0x0002, 0x062B, 0x0647, 0x0002, 0x0633, 0x0647,
+    0x0002, 0x0634, 0x0645, 0x0002, 0x0634, 0x0647, 0x0003, 0x0640, 0x064E, 0x0651, 0x0003, 0x0640,
+    0x064F, 0x0651, 0x0003, 0x0640, 0x0650, 0x0651, 0x0002, 0x0637, 0x0649, 0x0002, 0x0637, 0x064A,
+    0x0002, 0x0639, 0x0649, 0x0002, 0x0639, 0x064A, 0x0002, 0x063A, 0x0649, 0x0002, 0x063A, 0x064A,
+    0x0002, 0x0633, 0x0649, 0x0002, 0x0633, 0x064A, 0x0002, 0x0634, 0x0649, 0x0002, 0x0634, 0x064A,
+    0x0002, 0x062D, 0x0649, 0x0002, 0x062D, 0x064A, 0x0002, 0x062C, 0x0649, 0x0002, 0x062C, 0x064A,
+    0x0002, 0x062E, 0x0649, 0x0002, 0x062E, 0x064A, 0x0002, 0x0635, 0x0649, 0x0002, 0x0635, 0x064A,
+    0x0002, 0x0636, 0x0649, 0x0002, 0x0636, 0x064A, 0x0002, 0x0634, 0x062C, 0x0002, 0x0634, 0x062D,
+    0x0002, 0x0634, 0x062E, 0x0002, 0x0634, 0x0631, 0x0002, 0x0633, 0x0631, 0x0002, 0x0635, 0x0631,
+    0x0002, 0x0636, 0x0631, 0x0002, 0x0627, 0x064B, 0x0003, 0x062A, 0x062C, 0x0645, 0x0003, 0x062A,
+    0x062D, 0x062C, 0x0003, 0x062A, 0x062D, 0x0645, 0x0003, 0x062A, 0x062E, 0x0645, 0x0003, 0x062A,
+    0x0645, 0x062C, 0x0003, 0x062A, 0x0645, 0x062D, 0x0003, 0x062A, 0x0645, 0x062E, 0x0003, 0x062C,
+    0x0645, 0x062D, 0x0003, 0x062D, 0x0645, 0x064A, 0x0003, 0x062D, 0x0645, 0x0649, 0x0003, 0x0633,
+    0x062D, 0x062C, 0x0003, 0x0633, 0x062C, 0x062D, 0x0003, 0x0633, 0x062C, 0x0649, 0x0003, 0x0633,
+    0x0645, 0x062D, 0x0003, 0x0633, 0x0645, 0x062C, 0x0003, 0x0633, 0x0645, 0x0645, 0x0003, 0x0635,
+    0x062D, 0x062D, 0x0003, 0x0635, 0x0645, 0x0645, 0x0003, 0x0634, 0x062D, 0x0645, 0x0003, 0x0634,
+    0x062C, 0x064A, 0x0003, 0x0634, 0x0645, 0x062E, 0x0003, 0x0634, 0x0645, 0x0645, 0x0003, 0x0636,
+    0x062D, 0x0649, 0x0003, 0x0636, 0x062E, 0x0645, 0x0003, 0x0637, 0x0645, 0x062D, 0x0003, 0x0637,
+    0x0645, 0x0645, 0x0003, 0x0637, 0x0645, 0x064A, 0x0003, 0x0639, 0x062C, 0x0645, 0x0003, 0x0639,
+    0x0645, 0x0645, 0x0003, 0x0639, 0x0645, 0x0649, 0x0003, 0x063A, 0x0645, 0x0645, 0x0003, 0x063A,
+    0x0645, 0x064A, 0x0003, 0x063A, 0x0645, 0x0649, 0x0003, 0x0641, 0x062E, 0x0645, 0x0003, 0x0642,
+    0x0645, 0x062D, 0x0003, 0x0642, 0x0645, 0x0645, 0x0003, 0x0644, 0x062D, 0x0645, 0x0003, 0x0644,
+    0x062D, 0x064A, 0x0003, 0x0644, 0x062D, 0x0649, 0x0003, 0x0644, 0x062C, 0x062C, 0x0003, 0x0644,
+    0x062E, 0x0645, 0x0003, 0x0644, 0x0645, 0x062D, 0x0003, 0x0645, 0x062D, 0x062C, 0x0003, 0x0645,
+    0x062D, 0x0645, 0x0003, 0x0645, 0x062D, 0x064A, 0x0003, 0x0645, 0x062C, 0x062D, 0x0003, 0x0645,
+    0x062C, 0x0645, 0x0003, 0x0645, 0x062E, 0x062C, 0x0003, 0x0645, 0x062E, 0x0645, 0x0003, 0x0645,
+    0x062C, 0x062E, 0x0003, 0x0647, 0x0645, 0x062C, 0x0003, 0x0647, 0x0645, 0x0645, 0x0003, 0x0646,
+    0x062D, 0x0645, 0x0003, 0x0646, 0x062D, 0x0649, 0x0003, 0x0646, 0x062C, 0x0645, 0x0003, 0x0646,
+    0x062C, 0x0649, 0x0003, 0x0646, 0x0645, 0x064A, 0x0003, 0x0646, 0x0645, 0x0649, 0x0003, 0x064A,
+    0x0645, 0x0645, 0x0003, 0x0628, 0x062E, 0x064A, 0x0003, 0x062A, 0x062C, 0x064A, 0x0003, 0x062A,
+    0x062C, 0x0649, 0x0003, 0x062A, 0x062E, 0x064A, 0x0003, 0x062A, 0x062E, 0x0649, 0x0003, 0x062A,
+    0x0645, 0x064A, 0x0003, 0x062A, 0x0645, 0x0649, 0x0003, 0x062C, 0x0645, 0x064A, 0x0003, 0x062C,
+    0x062D, 0x0649, 0x0003, 0x062C, 0x0645, 0x0649, 0x0003, 0x0633, 0x062E, 0x0649, 0x0003, 0x0635,
+    0x062D, 0x064A, 0x0003, 0x0634, 0x062D, 0x064A, 0x0003, 0x0636, 0x062D, 0x064A, 0x0003, 0x0644,
+    0x062C, 0x064A, 0x0003, 0x0644, 0x0645, 0x064A, 0x0003, 0x064A, 0x062D, 0x064A, 0x0003, 0x064A,
+    0x062C, 0x064A, 0x0003, 0x064A, 0x0645, 0x064A, 0x0003, 0x0645, 0x0645, 0x064A, 0x0003, 0x0642,
+    0x0645, 0x064A, 0x0003, 0x0646, 0x062D, 0x064A, 0x0003, 0x0639, 0x0645, 0x064A, 0x0003, 0x0643,
+    0x0645, 0x064A, 0x0003, 0x0646, 0x062C, 0x062D, 0x0003, 0x0645, 0x062E, 0x064A, 0x0003, 0x0644,
+    0x062C, 0x0645, 0x0003, 0x0643, 0x0645, 0x0645, 0x0003, 0x062C, 0x062D, 0x064A, 0x0003, 0x062D,
+    0x062C, 0x064A, 0x0003, 0x0645, 0x062C, 0x064A, 0x0003, 0x0641, 0x0645, 0x064A, 0x0003, 0x0628,
+    0x062D, 0x064A, 0x0003, 0x0633, 0x062E, 0x064A, 0x0003, 0x0646, 0x062C, 0x064A, 0x0003, 0x0635,
+    0x0644, 0x06D2, 0x0003, 0x0642, 0x0644, 0x06D2, 0x0004, 0x0627, 0x0644, 0x0644, 0x0647, 0x0004,
+    0x0627, 0x0643, 0x0628, 0x0631, 0x0004, 0x0645, 0x062D, 0x0645, 0x062F, 0x0004, 0x0635, 0x0644,
+    0x0639, 0x0645, 0x0004, 0x0631, 0x0633, 0x0648, 0x0644, 0x0004, 0x0639, 0x0644, 0x064A, 0x0647,
+    0x0004, 0x0648, 0x0633, 0x0644, 0x0645, 0x0003, 0x0635, 0x0644, 0x0649, 0x0012, 0x0635, 0x0644,
+    0x0649, 0x0020, 0x0627, 0x0644, 0x0644, 0x0647, 0x0020, 0x0639, 0x0644, 0x064A, 0x0647, 0x0020,
+    0x0648, 0x0633, 0x0644, 0x0645, 0x0008, 0x062C, 0x0644, 0x0020, 0x062C, 0x0644, 0x0627, 0x0644,
+    0x0647, 0x0004, 0x0631, 0x06CC, 0x0627, 0x0644, 0x0001, 0x002C, 0x0001, 0x3001, 0x0001, 0x3002,
+    0x0001, 0x003A, 0x0001, 0x0021, 0x0001, 0x003F, 0x0001, 0x3016, 0x0001, 0x3017, 0x0001, 0x2014,
+    0x0001, 0x2013, 0x0001, 0x005F, 0x0001, 0x007B, 0x0001, 0x007D, 0x0001, 0x3014, 0x0001, 0x3015,
+    0x0001, 0x3010, 0x0001, 0x3011, 0x0001, 0x300A, 0x0001, 0x300B, 0x0001, 0x300C, 0x0001, 0x300D,
+    0x0001, 0x300E, 0x0001, 0x300F, 0x0001, 0x005B, 0x0001, 0x005D, 0x0001, 0x0023, 0x0001, 0x0026,
+    0x0001, 0x002A, 0x0001, 0x002D, 0x0001, 0x003C, 0x0001, 0x003E, 0x0001, 0x005C, 0x0001, 0x0024,
+    0x0001, 0x0025, 0x0001, 0x0040, 0x0002, 0x0020, 0x064B, 0x0002, 0x0640, 0x064B, 0x0002, 0x0020,
+    0x064C, 0x0002, 0x0020, 0x064D, 0x0002, 0x0020, 0x064E, 0x0002, 0x0640, 0x064E, 0x0002, 0x0020,
+    0x064F, 0x0002, 0x0640, 0x064F, 0x0002, 0x0020, 0x0650, 0x0002, 0x0640, 0x0650, 0x0002, 0x0020,
+    0x0651, 0x0002, 0x0640, 0x0651, 0x0002, 0x0020, 0x0652, 0x0002, 0x0640, 0x0652, 0x0001, 0x0621,
+    0x0001, 0x0627, 0x0001, 0x0628, 0x0001, 0x0629, 0x0001, 0x062A, 0x0001, 0x062B, 0x0001, 0x062C,
+    0x0001, 0x062D, 0x0001, 0x062E, 0x0001, 0x062F, 0x0001, 0x0630, 0x0001, 0x0631, 0x0001, 0x0632,
+    0x0001, 0x0633, 0x0001, 0x0634, 0x0001, 0x0635, 0x0001, 0x0636, 0x0001, 0x0637, 0x0001, 0x0638,
+    0x0001, 0x0639, 0x0001, 0x063A, 0x0001, 0x0641, 0x0001, 0x0642, 0x0001, 0x0643, 0x0001, 0x0644,
+    0x0001, 0x0645, 0x0001, 0x0646, 0x0001, 0x0647, 0x0001, 0x0648, 0x0001, 0x064A, 0x0003, 0x0644,
+    0x0627, 0x0653, 0x0003, 0x0644, 0x0627, 0x0654, 0x0003, 0x0644, 0x0627, 0x0655, 0x0002, 0x0644,
+    0x0627, 0x0001, 0x0022, 0x0001, 0x0027, 0x0001, 0x002F, 0x0001, 0x005E, 0x0001, 0x007C, 0x0001,
+    0x007E, 0x0001, 0x2985, 0x0001, 0x2986, 0x0001, 0x30FB, 0x0001, 0x30A1, 0x0001, 0x30A3, 0x0001,
+    0x30A5, 0x0001, 0x30A7, 0x0001, 0x30A9, 0x0001, 0x30E3, 0x0001, 0x30E5, 0x0001, 0x30E7, 0x0001,
+    0x30C3, 0x0001, 0x30FC, 0x0001, 0x30F3, 0x0001, 0x3099, 0x0001, 0x309A, 0x0001, 0x00A2, 0x0001,
+    0x00A3, 0x0001, 0x00AC, 0x0001, 0x00A6, 0x0001, 0x00A5, 0x0001, 0x20A9, 0x0001, 0x2502, 0x0001,
+    0x2190, 0x0001, 0x2191, 0x0001, 0x2192, 0x0001, 0x2193, 0x0001, 0x25A0, 0x0001, 0x25CB, 0x0001,
+    0x02D0, 0x0001, 0x02D1, 0x0001, 0x00E6, 0x0001, 0x0299, 0x0001, 0x0253, 0x0001, 0x02A3, 0x0001,
+    0xAB66, 0x0001, 0x02A5, 0x0001, 0x02A4, 0x0001, 0x0256, 0x0001, 0x0257, 0x0001, 0x1D91, 0x0001,
+    0x0258, 0x0001, 0x025E, 0x0001, 0x02A9, 0x0001, 0x0264, 0x0001, 0x0262, 0x0001, 0x0260, 0x0001,
+    0x029B, 0x0001, 0x029C, 0x0001, 0x0267, 0x0001, 0x0284, 0x0001, 0x02AA, 0x0001, 0x02AB, 0x0001,
+    0x026C, 0x0001, 0x1DF04, 0x0001, 0xA78E, 0x0001, 0x026E, 0x0001, 0x1DF05, 0x0001, 0x028E, 0x0001,
+    0x1DF06, 0x0001, 0x00F8, 0x0001, 0x0276, 0x0001, 0x0277, 0x0001, 0x027A, 0x0001, 0x1DF08, 0x0001,
+    0x027D, 0x0001, 0x027E, 0x0001, 0x0280, 0x0001, 0x02A8, 0x0001, 0x02A6, 0x0001, 0xAB67, 0x0001,
+    0x02A7, 0x0001, 0x0288, 0x0001, 0x2C71, 0x0001, 0x028F, 0x0001, 0x02A1, 0x0001, 0x02A2, 0x0001,
+    0x0298, 0x0001, 0x01C0, 0x0001, 0x01C1, 0x0001, 0x01C2, 0x0001, 0x1DF0A, 0x0001, 0x1DF1E, 0x0002,
+    0x11099, 0x110BA, 0x0002, 0x1109B, 0x110BA, 0x0002, 0x110A5, 0x110BA, 0x0002, 0x11131, 0x11127, 0x0002,
+    0x11132, 0x11127, 0x0002, 0x11347, 0x1133E, 0x0002, 0x11347, 0x11357, 0x0002, 0x114B9, 0x114BA, 0x0002,
+    0x114B9, 0x114B0, 0x0002, 0x114B9, 0x114BD, 0x0002, 0x115B8, 0x115AF, 0x0002, 0x115B9, 0x115AF, 0x0002,
+    0x11935, 0x11930, 0x0002, 0x1D157, 0x1D165, 0x0002, 0x1D158, 0x1D165, 0x0003, 0x1D158, 0x1D165, 0x1D16E,
+    0x0003, 0x1D158, 0x1D165, 0x1D16F, 0x0003, 0x1D158, 0x1D165, 0x1D170, 0x0003, 0x1D158, 0x1D165, 0x1D171,
+    0x0003, 0x1D158, 0x1D165, 0x1D172, 0x0002, 0x1D1B9, 0x1D165, 0x0002, 0x1D1BA, 0x1D165, 0x0003, 0x1D1B9,
+    0x1D165, 0x1D16E, 0x0003, 0x1D1BA, 0x1D165, 0x1D16E, 0x0003, 0x1D1B9, 0x1D165, 0x1D16F, 0x0003, 0x1D1BA,
+    0x1D165, 0x1D16F, 0x0001, 0x0131, 0x0001, 0x0237, 0x0001, 0x0391, 0x0001, 0x0392, 0x0001, 0x0394,
+    0x0001, 0x0395, 0x0001, 0x0396, 0x0001, 0x0397, 0x0001, 0x0399, 0x0001, 0x039A, 0x0001, 0x039B,
+    0x0001, 0x039C, 0x0001, 0x039D, 0x0001, 0x039E, 0x0001, 0x039F, 0x0001, 0x03A1, 0x0001, 0x03A4,
+    0x0001, 0x03A6, 0x0001, 0x03A7, 0x0001, 0x03A8, 0x0001, 0x2207, 0x0001, 0x03B1, 0x0001, 0x03B6,
+    0x0001, 0x03B7, 0x0001, 0x03BB, 0x0001, 0x03BD, 0x0001, 0x03BE, 0x0001, 0x03BF, 0x0001, 0x03C3,
+    0x0001, 0x03C4, 0x0001, 0x03C5, 0x0001, 0x03C8, 0x0001, 0x03C9, 0x0001, 0x2202, 0x0001, 0x03DC,
+    0x0001, 0x03DD, 0x0001, 0x066E, 0x0001, 0x06A1, 0x0001, 0x066F, 0x0002, 0x0030, 0x002E, 0x0002,
+    0x0030, 0x002C, 0x0002, 0x0031, 0x002C, 0x0002, 0x0032, 0x002C, 0x0002, 0x0033, 0x002C, 0x0002,
+    0x0034, 0x002C, 0x0002, 0x0035, 0x002C, 0x0002, 0x0036, 0x002C, 0x0002, 0x0037, 0x002C, 0x0002,
+    0x0038, 0x002C, 0x0002, 0x0039, 0x002C, 0x0003, 0x0028, 0x0041, 0x0029, 0x0003, 0x0028, 0x0042,
+    0x0029, 0x0003, 0x0028, 0x0043, 0x0029, 0x0003, 0x0028, 0x0044, 0x0029, 0x0003, 0x0028, 0x0045,
+    0x0029, 0x0003, 0x0028, 0x0046, 0x0029, 0x0003, 0x0028, 0x0047, 0x0029, 0x0003, 0x0028, 0x0048,
+    0x0029, 0x0003, 0x0028, 0x0049, 0x0029, 0x0003, 0x0028, 0x004A, 0x0029, 0x0003, 0x0028, 0x004B,
+    0x0029, 0x0003, 0x0028, 0x004C, 0x0029, 0x0003, 0x0028, 0x004D, 0x0029, 0x0003, 0x0028, 0x004E,
+    0x0029, 0x0003, 0x0028, 0x004F, 0x0029, 0x0003, 0x0028, 0x0050, 0x0029, 0x0003, 0x0028, 0x0051,
+    0x0029, 0x0003, 0x0028, 0x0052, 0x0029, 0x0003, 0x0028, 0x0053, 0x0029, 0x0003, 0x0028, 0x0054,
+    0x0029, 0x0003, 0x0028, 0x0055, 0x0029, 0x0003, 0x0028, 0x0056, 0x0029, 0x0003, 0x0028, 0x0057,
+    0x0029, 0x0003, 0x0028, 0x0058, 0x0029, 0x0003, 0x0028, 0x0059, 0x0029, 0x0003, 0x0028, 0x005A,
+    0x0029, 0x0003, 0x3014, 0x0053, 0x3015, 0x0002, 0x0043, 0x0044, 0x0002, 0x0057, 0x005A, 0x0002,
+    0x0048, 0x0056, 0x0002, 0x0053, 0x0044, 0x0002, 0x0053, 0x0053, 0x0003, 0x0050, 0x0050, 0x0056,
+    0x0002, 0x0057, 0x0043, 0x0002, 0x004D, 0x0043, 0x0002, 0x004D, 0x0044, 0x0002, 0x004D, 0x0052,
+    0x0002, 0x0044, 0x004A, 0x0002, 0x307B, 0x304B, 0x0002, 0x30B3, 0x30B3, 0x0001, 0x5B57, 0x0001,
+    0x53CC, 0x0001, 0x591A, 0x0001, 0x89E3, 0x0001, 0x4EA4, 0x0001, 0x6620, 0x0001, 0x7121, 0x0001,
+    0x524D, 0x0001, 0x5F8C, 0x0001, 0x518D, 0x0001, 0x65B0, 0x0001, 0x521D, 0x0001, 0x7D42, 0x0001,
+    0x8CA9, 0x0001, 0x58F0, 0x0001, 0x5439, 0x0001, 0x6F14, 0x0001, 0x6295, 0x0001, 0x6355, 0x0001,
+    0x904A, 0x0001, 0x6307, 0x0001, 0x6253, 0x0001, 0x7981, 0x0001, 0x7A7A, 0x0001, 0x5408, 0x0001,
+    0x6E80, 0x0001, 0x7533, 0x0001, 0x5272, 0x0001, 0x55B6, 0x0001, 0x914D, 0x0003, 0x3014, 0x672C,
+    0x3015, 0x0003, 0x3014, 0x4E09, 0x3015, 0x0003, 0x3014, 0x4E8C, 0x3015, 0x0003, 0x3014, 0x5B89,
+    0x3015, 0x0003, 0x3014, 0x70B9, 0x3015, 0x0003, 0x3014, 0x6253, 0x3015, 0x0003, 0x3014, 0x76D7,
+    0x3015, 0x0003, 0x3014, 0x52DD, 0x3015, 0x0003, 0x3014, 0x6557, 0x3015, 0x0001, 0x5F97, 0x0001,
+    0x53EF, 0x0001, 0x4E3D, 0x0001, 0x4E38, 0x0001, 0x4E41, 0x0001, 0x20122, 0x0001, 0x4F60, 0x0001,
+    0x4FBB, 0x0001, 0x5002, 0x0001, 0x507A, 0x0001, 0x5099, 0x0001, 0x50CF, 0x0001, 0x349E, 0x0001,
+    0x2063A, 0x0001, 0x5154, 0x0001, 0x5164, 0x0001, 0x5177, 0x0001, 0x2051C, 0x0001, 0x34B9, 0x0001,
+    0x5167, 0x0001, 0x2054B, 0x0001, 0x5197, 0x0001, 0x51A4, 0x0001, 0x4ECC, 0x0001, 0x51AC, 0x0001,
+    0x291DF, 0x0001, 0x5203, 0x0001, 0x34DF, 0x0001, 0x523B, 0x0001, 0x5246, 0x0001, 0x5277, 0x0001,
+    0x3515, 0x0001, 0x5305, 0x0001, 0x5306, 0x0001, 0x5349, 0x0001, 0x535A, 0x0001, 0x5373, 0x0001,
+    0x537D, 0x0001, 0x537F, 0x0001, 0x20A2C, 0x0001, 0x7070, 0x0001, 0x53CA, 0x0001, 0x53DF, 0x0001,
+    0x20B63, 0x0001, 0x53EB, 0x0001, 0x53F1, 0x0001, 0x5406, 0x0001, 0x549E, 0x0001, 0x5438, 0x0001,
+    0x5448, 0x0001, 0x5468, 0x0001, 0x54A2, 0x0001, 0x54F6, 0x0001, 0x5510, 0x0001, 0x5553, 0x0001,
+    0x5563, 0x0001, 0x5584, 0x0001, 0x55AB, 0x0001, 0x55B3, 0x0001, 0x55C2, 0x0001, 0x5716, 0x0001,
+    0x5717, 0x0001, 0x5651, 0x0001, 0x5674, 0x0001, 0x58EE, 0x0001, 0x57CE, 0x0001, 0x57F4, 0x0001,
+    0x580D, 0x0001, 0x578B, 0x0001, 0x5832, 0x0001, 0x5831, 0x0001, 0x58AC, 0x0001, 0x214E4, 0x0001,
+    0x58F2, 0x0001, 0x58F7, 0x0001, 0x5906, 0x0001, 0x5922, 0x0001, 0x5962, 0x0001, 0x216A8, 0x0001,
+    0x216EA, 0x0001, 0x59EC, 0x0001, 0x5A1B, 0x0001, 0x5A27, 0x0001, 0x59D8, 0x0001, 0x5A66, 0x0001,
+    0x36EE, 0x0001, 0x36FC, 0x0001, 0x5B08, 0x0001, 0x5B3E, 0x0001, 0x219C8, 0x0001, 0x5BC3, 0x0001,
+    0x5BD8, 0x0001, 0x5BF3, 0x0001, 0x21B18, 0x0001, 0x5BFF, 0x0001, 0x5C06, 0x0001, 0x5F53, 0x0001,
+    0x3781, 0x0001, 0x5C60, 0x0001, 0x5CC0, 0x0001, 0x5C8D, 0x0001, 0x21DE4, 0x0001, 0x5D43, 0x0001,
+    0x21DE6, 0x0001, 0x5D6E, 0x0001, 0x5D6B, 0x0001, 0x5D7C, 0x0001, 0x5DE1, 0x0001, 0x5DE2, 0x0001,
+    0x382F, 0x0001, 0x5DFD, 0x0001, 0x5E28, 0x0001, 0x5E3D, 0x0001, 0x5E69, 0x0001, 0x3862, 0x0001,
+    0x22183, 0x0001, 0x387C, 0x0001, 0x5EB0, 0x0001, 0x5EB3, 0x0001, 0x5EB6, 0x0001, 0x2A392, 0x0001,
+    0x22331, 0x0001, 0x8201, 0x0001, 0x5F22, 0x0001, 0x38C7, 0x0001, 0x232B8, 0x0001, 0x261DA, 0x0001,
+    0x5F62, 0x0001, 0x5F6B, 0x0001, 0x38E3, 0x0001, 0x5F9A, 0x0001, 0x5FCD, 0x0001, 0x5FD7, 0x0001,
+    0x5FF9, 0x0001, 0x6081, 0x0001, 0x393A, 0x0001, 0x391C, 0x0001, 0x226D4, 0x0001, 0x60C7, 0x0001,
+    0x6148, 0x0001, 0x614C, 0x0001, 0x617A, 0x0001, 0x61B2, 0x0001, 0x61A4, 0x0001, 0x61AF, 0x0001,
+    0x61DE, 0x0001, 0x6210, 0x0001, 0x621B, 0x0001, 0x625D, 0x0001, 0x62B1, 0x0001, 0x62D4, 0x0001,
+    0x6350, 0x0001, 0x22B0C, 0x0001, 0x633D, 0x0001, 0x62FC, 0x0001, 0x6368, 0x0001, 0x6383, 0x0001,
+    0x63E4, 0x0001, 0x22BF1, 0x0001, 0x6422, 0x0001, 0x63C5, 0x0001, 0x63A9, 0x0001, 0x3A2E, 0x0001,
+    0x6469, 0x0001, 0x647E, 0x0001, 0x649D, 0x0001, 0x6477, 0x0001, 0x3A6C, 0x0001, 0x656C, 0x0001,
+    0x2300A, 0x0001, 0x65E3, 0x0001, 0x66F8, 0x0001, 0x6649, 0x0001, 0x3B19, 0x0001, 0x3B08, 0x0001,
+    0x3AE4, 0x0001, 0x5192, 0x0001, 0x5195, 0x0001, 0x6700, 0x0001, 0x669C, 0x0001, 0x80AD, 0x0001,
+    0x43D9, 0x0001, 0x6721, 0x0001, 0x675E, 0x0001, 0x6753, 0x0001, 0x233C3, 0x0001, 0x3B49, 0x0001,
+    0x67FA, 0x0001, 0x6785, 0x0001, 0x6852, 0x0001, 0x2346D, 0x0001, 0x688E, 0x0001, 0x681F, 0x0001,
+    0x6914, 0x0001, 0x6942, 0x0001, 0x69A3, 0x0001, 0x69EA, 0x0001, 0x6AA8, 0x0001, 0x236A3, 0x0001,
+    0x6ADB, 0x0001, 0x3C18, 0x0001, 0x6B21, 0x0001, 0x238A7, 0x0001, 0x6B54, 0x0001, 0x3C4E, 0x0001,
+    0x6B72, 0x0001, 0x6B9F, 0x0001, 0x6BBB, 0x0001, 0x23A8D, 0x0001, 0x21D0B, 0x0001, 0x23AFA, 0x0001,
+    0x6C4E, 0x0001, 0x23CBC, 0x0001, 0x6CBF, 0x0001, 0x6CCD, 0x0001, 0x6C67, 0x0001, 0x6D16, 0x0001,
+    0x6D3E, 0x0001, 0x6D69, 0x0001, 0x6D78, 0x0001, 0x6D85, 0x0001, 0x23D1E, 0x0001, 0x6D34, 0x0001,
+    0x6E2F, 0x0001, 0x6E6E, 0x0001, 0x3D33, 0x0001, 0x6EC7, 0x0001, 0x23ED1, 0x0001, 0x6DF9, 0x0001,
+    0x6F6E, 0x0001, 0x23F5E, 0x0001, 0x23F8E, 0x0001, 0x6FC6, 0x0001, 0x7039, 0x0001, 0x701B, 0x0001,
+    0x3D96, 0x0001, 0x704A, 0x0001, 0x707D, 0x0001, 0x7077, 0x0001, 0x70AD, 0x0001, 0x20525, 0x0001,
+    0x7145, 0x0001, 0x24263, 0x0001, 0x719C, 0x0001, 0x243AB, 0x0001, 0x7228, 0x0001, 0x7250, 0x0001,
+    0x24608, 0x0001, 0x7280, 0x0001, 0x7295, 0x0001, 0x24735, 0x0001, 0x24814, 0x0001, 0x737A, 0x0001,
+    0x738B, 0x0001, 0x3EAC, 0x0001, 0x73A5, 0x0001, 0x3EB8, 0x0001, 0x7447, 0x0001, 0x745C, 0x0001,
+    0x7485, 0x0001, 0x74CA, 0x0001, 0x3F1B, 0x0001, 0x7524, 0x0001, 0x24C36, 0x0001, 0x753E, 0x0001,
+    0x24C92, 0x0001, 0x2219F, 0x0001, 0x7610, 0x0001, 0x24FA1, 0x0001, 0x24FB8, 0x0001, 0x25044, 0x0001,
+    0x3FFC, 0x0001, 0x4008, 0x0001, 0x250F3, 0x0001, 0x250F2, 0x0001, 0x25119, 0x0001, 0x25133, 0x0001,
+    0x771E, 0x0001, 0x771F, 0x0001, 0x778B, 0x0001, 0x4046, 0x0001, 0x4096, 0x0001, 0x2541D, 0x0001,
+    0x784E, 0x0001, 0x40E3, 0x0001, 0x25626, 0x0001, 0x2569A, 0x0001, 0x256C5, 0x0001, 0x79EB, 0x0001,
+    0x412F, 0x0001, 0x7A4A, 0x0001, 0x7A4F, 0x0001, 0x2597C, 0x0001, 0x25AA7, 0x0001, 0x7AEE, 0x0001,
+    0x4202, 0x0001, 0x25BAB, 0x0001, 0x7BC6, 0x0001, 0x7BC9, 0x0001, 0x4227, 0x0001, 0x25C80, 0x0001,
+    0x7CD2, 0x0001, 0x42A0, 0x0001, 0x7CE8, 0x0001, 0x7CE3, 0x0001, 0x7D00, 0x0001, 0x25F86, 0x0001,
+    0x7D63, 0x0001, 0x4301, 0x0001, 0x7DC7, 0x0001, 0x7E02, 0x0001, 0x7E45, 0x0001, 0x4334, 0x0001,
+    0x26228, 0x0001, 0x26247, 0x0001, 0x4359, 0x0001, 0x262D9, 0x0001, 0x7F7A, 0x0001, 0x2633E, 0x0001,
+    0x7F95, 0x0001, 0x7FFA, 0x0001, 0x264DA, 0x0001, 0x26523, 0x0001, 0x8060, 0x0001, 0x265A8, 0x0001,
+    0x8070, 0x0001, 0x2335F, 0x0001, 0x43D5, 0x0001, 0x80B2, 0x0001, 0x8103, 0x0001, 0x440B, 0x0001,
+    0x813E, 0x0001, 0x5AB5, 0x0001, 0x267A7, 0x0001, 0x267B5, 0x0001, 0x23393, 0x0001, 0x2339C, 0x0001,
+    0x8204, 0x0001, 0x8F9E, 0x0001, 0x446B, 0x0001, 0x8291, 0x0001, 0x828B, 0x0001, 0x829D, 0x0001,
+    0x52B3, 0x0001, 0x82B1, 0x0001, 0x82B3, 0x0001, 0x82BD, 0x0001, 0x82E6, 0x0001, 0x26B3C, 0x0001,
+    0x831D, 0x0001, 0x8363, 0x0001, 0x83AD, 0x0001, 0x8323, 0x0001, 0x83BD, 0x0001, 0x83E7, 0x0001,
+    0x8353, 0x0001, 0x83CA, 0x0001, 0x83CC, 0x0001, 0x83DC, 0x0001, 0x26C36, 0x0001, 0x26D6B, 0x0001,
+    0x26CD5, 0x0001, 0x452B, 0x0001, 0x84F1, 0x0001, 0x84F3, 0x0001, 0x8516, 0x0001, 0x273CA, 0x0001,
+    0x8564, 0x0001, 0x26F2C, 0x0001, 0x455D, 0x0001, 0x4561, 0x0001, 0x26FB1, 0x0001, 0x270D2, 0x0001,
+    0x456B, 0x0001, 0x8650, 0x0001, 0x8667, 0x0001, 0x8669, 0x0001, 0x86A9, 0x0001, 0x8688, 0x0001,
+    0x870E, 0x0001, 0x86E2, 0x0001, 0x8728, 0x0001, 0x876B, 0x0001, 0x8786, 0x0001, 0x45D7, 0x0001,
+    0x87E1, 0x0001, 0x8801, 0x0001, 0x45F9, 0x0001, 0x8860, 0x0001, 0x27667, 0x0001, 0x88D7, 0x0001,
+    0x88DE, 0x0001, 0x4635, 0x0001, 0x88FA, 0x0001, 0x34BB, 0x0001, 0x278AE, 0x0001, 0x27966, 0x0001,
+    0x46BE, 0x0001, 0x46C7, 0x0001, 0x8AA0, 0x0001, 0x27CA8, 0x0001, 0x8CAB, 0x0001, 0x8CC1, 0x0001,
+    0x8D1B, 0x0001, 0x8D77, 0x0001, 0x27F2F, 0x0001, 0x20804, 0x0001, 0x8DCB, 0x0001, 0x8DBC, 0x0001,
+    0x8DF0, 0x0001, 0x208DE, 0x0001, 0x8ED4, 0x0001, 0x285D2, 0x0001, 0x285ED, 0x0001, 0x9094, 0x0001,
+    0x90F1, 0x0001, 0x9111, 0x0001, 0x2872E, 0x0001, 0x911B, 0x0001, 0x9238, 0x0001, 0x92D7, 0x0001,
+    0x92D8, 0x0001, 0x927C, 0x0001, 0x93F9, 0x0001, 0x9415, 0x0001, 0x28BFA, 0x0001, 0x958B, 0x0001,
+    0x4995, 0x0001, 0x95B7, 0x0001, 0x28D77, 0x0001, 0x49E6, 0x0001, 0x96C3, 0x0001, 0x5DB2, 0x0001,
+    0x9723, 0x0001, 0x29145, 0x0001, 0x2921A, 0x0001, 0x4A6E, 0x0001, 0x4A76, 0x0001, 0x97E0, 0x0001,
+    0x2940A, 0x0001, 0x4AB2, 0x0001, 0x29496, 0x0001, 0x9829, 0x0001, 0x295B6, 0x0001, 0x98E2, 0x0001,
+    0x4B33, 0x0001, 0x9929, 0x0001, 0x99A7, 0x0001, 0x99C2, 0x0001, 0x99FE, 0x0001, 0x4BCE, 0x0001,
+    0x29B30, 0x0001, 0x9C40, 0x0001, 0x9CFD, 0x0001, 0x4CCE, 0x0001, 0x4CED, 0x0001, 0x9D67, 0x0001,
+    0x2A0CE, 0x0001, 0x4CF8, 0x0001, 0x2A105, 0x0001, 0x2A20E, 0x0001, 0x2A291, 0x0001, 0x4D56, 0x0001,
+    0x9EFE, 0x0001, 0x9F05, 0x0001, 0x9F0F, 0x0001, 0x9F16, 0x0001, 0x2A600,
+};
+
+// Sorted by the first and second code points
+inline constexpr CompositionRecord sCompositionRecords[] = {
+    {0x003C, 0x0338, 0x226E},
+    {0x003D, 0x0338, 0x2260},
+    {0x003E, 0x0338, 0x226F},
+    {0x0041, 0x0300, 0x00C0},
+    {0x0041, 0x0301, 0x00C1},
+    {0x0041, 0x0302, 0x00C2},
+    {0x0041, 0x0303, 0x00C3},
+    {0x0041, 0x0304, 0x0100},
+    {0x0041, 0x0306, 0x0102},
+    {0x0041, 0x0307, 0x0226},
+    {0x0041, 0x0308, 0x00C4},
+    {0x0041, 0x0309, 0x1EA2},
+    {0x0041, 0x030A, 0x00C5},
+    {0x0041, 0x030C, 0x01CD},
+    {0x0041, 0x030F, 0x0200},
+    {0x0041, 0x0311, 0x0202},
+    {0x0041, 0x0323, 0x1EA0},
+    {0x0041, 0x0325, 0x1E00},
+    {0x0041, 0x0328, 0x0104},
+    {0x0042, 0x0307, 0x1E02},
+    {0x0042, 0x0323, 0x1E04},
+    {0x0042, 0x0331, 0x1E06},
+    {0x0043, 0x0301, 0x0106},
+    {0x0043, 0x0302, 0x0108},
+    {0x0043, 0x0307, 0x010A},
+    {0x0043, 0x030C, 0x010C},
+    {0x0043, 0x0327, 0x00C7},
+    {0x0044, 0x0307, 0x1E0A},
+    {0x0044, 0x030C, 0x010E},
+    {0x0044, 0x0323, 0x1E0C},
+    {0x0044, 0x0327, 0x1E10},
+    {0x0044, 0x032D, 0x1E12},
+    {0x0044, 0x0331, 0x1E0E},
+    {0x0045, 0x0300, 0x00C8},
+    {0x0045, 0x0301, 0x00C9},
+    {0x0045, 0x0302, 0x00CA},
+    {0x0045, 0x0303, 0x1EBC},
+    {0x0045, 0x0304, 0x0112},
+    {0x0045, 0x0306, 0x0114},
+    {0x0045, 0x0307, 0x0116},
+    {0x0045, 0x0308, 0x00CB},
+    {0x0045, 0x0309, 0x1EBA},
+    {0x0045, 0x030C, 0x011A},
+    {0x0045, 0x030F, 0x0204},
+    {0x0045, 0x0311, 0x0206},
+    {0x0045, 0x0323, 0x1EB8},
+    {0x0045, 0x0327, 0x0228},
+    {0x0045, 0x0328, 0x0118},
+    {0x0045, 0x032D, 0x1E18},
+    {0x0045, 0x0330, 0x1E1A},
+    {0x0046, 0x0307, 0x1E1E},
+    {0x0047, 0x0301, 0x01F4},
+    {0x0047, 0x0302, 0x011C},
+    {0x0047, 0x0304, 0x1E20},
+    {0x0047, 0x0306, 0x011E},
+    {0x0047, 0x0307, 0x0120},
+    {0x0047, 0x030C, 0x01E6},
+    {0x0047, 0x0327, 0x0122},
+    {0x0048, 0x0302, 0x0124},
+    {0x0048, 0x0307, 0x1E22},
+    {0x0048, 0x0308, 0x1E26},
+    {0x0048, 0x030C, 0x021E},
+    {0x0048, 0x0323, 0x1E24},
+    {0x0048, 0x0327, 0x1E28},
+    {0x0048, 0x032E, 0x1E2A},
+    {0x0049, 0x0300, 0x00CC},
+    {0x0049, 0x0301, 0x00CD},
+    {0x0049, 0x0302, 0x00CE},
+    {0x0049, 0x0303, 0x0128},
+    {0x0049, 0x0304, 0x012A},
+    {0x0049, 0x0306, 0x012C},
+    {0x0049, 0x0307, 0x0130},
+    {0x0049, 0x0308, 0x00CF},
+    {0x0049, 0x0309, 0x1EC8},
+    {0x0049, 0x030C, 0x01CF},
+    {0x0049, 0x030F, 0x0208},
+    {0x0049, 0x0311, 0x020A},
+    {0x0049, 0x0323, 0x1ECA},
+    {0x0049, 0x0328, 0x012E},
+    {0x0049, 0x0330, 0x1E2C},
+    {0x004A, 0x0302, 0x0134},
+    {0x004B, 0x0301, 0x1E30},
+    {0x004B, 0x030C, 0x01E8},
+    {0x004B, 0x0323, 0x1E32},
+    {0x004B, 0x0327, 0x0136},
+    {0x004B, 0x0331, 0x1E34},
+    {0x004C, 0x0301, 0x0139},
+    {0x004C, 0x030C, 0x013D},
+    {0x004C, 0x0323, 0x1E36},
+    {0x004C, 0x0327, 0x013B},
+    {0x004C, 0x032D, 0x1E3C},
+    {0x004C, 0x0331, 0x1E3A},
+    {0x004D, 0x0301, 0x1E3E},
+    {0x004D, 0x0307, 0x1E40},
+    {0x004D, 0x0323, 0x1E42},
+    {0x004E, 0x0300, 0x01F8},
+    {0x004E, 0x0301, 0x0143},
+    {0x004E, 0x0303, 0x00D1},
+    {0x004E, 0x0307, 0x1E44},
+    {0x004E, 0x030C, 0x0147},
+    {0x004E, 0x0323, 0x1E46},
+    {0x004E, 0x0327, 0x0145},
+    {0x004E, 0x032D, 0x1E4A},
+    {0x004E, 0x0331, 0x1E48},
+    {0x004F, 0x0300, 0x00D2},
+    {0x004F, 0x0301, 0x00D3},
+    {0x004F, 0x0302, 0x00D4},
+    {0x004F, 0x0303, 0x00D5},
+    {0x004F, 0x0304, 0x014C},
+    {0x004F, 0x0306, 0x014E},
+    {0x004F, 0x0307, 0x022E},
+    {0x004F, 0x0308, 0x00D6},
+    {0x004F, 0x0309, 0x1ECE},
+    {0x004F, 0x030B, 0x0150},
+    {0x004F, 0x030C, 0x01D1},
+    {0x004F, 0x030F, 0x020C},
+    {0x004F, 0x0311, 0x020E},
+    {0x004F, 0x031B, 0x01A0},
+    {0x004F, 0x0323, 0x1ECC},
+    {0x004F, 0x0328, 0x01EA},
+    {0x0050, 0x0301, 0x1E54},
+    {0x0050, 0x0307, 0x1E56},
+    {0x0052, 0x0301, 0x0154},
+    {0x0052, 0x0307, 0x1E58},
+    {0x0052, 0x030C, 0x0158},
+    {0x0052, 0x030F, 0x0210},
+    {0x0052, 0x0311, 0x0212},
+    {0x0052, 0x0323, 0x1E5A},
+    {0x0052, 0x0327, 0x0156},
+    {0x0052, 0x0331, 0x1E5E},
+    {0x0053, 0x0301, 0x015A},
+    {0x0053, 0x0302, 0x015C},
+    {0x0053, 0x0307, 0x1E60},
+    {0x0053, 0x030C, 0x0160},
+    {0x0053, 0x0323, 0x1E62},
+    {0x0053, 0x0326, 0x0218},
+    {0x0053, 0x0327, 0x015E},
+    {0x0054, 0x0307, 0x1E6A},
+    {0x0054, 0x030C, 0x0164},
+    {0x0054, 0x0323, 0x1E6C},
+    {0x0054, 0x0326, 0x021A},
+    {0x0054, 0x0327, 0x0162},
+    {0x0054, 0x032D, 0x1E70},
+    {0x0054, 0x0331, 0x1E6E},
+    {0x0055, 0x0300, 0x00D9},
+    {0x0055, 0x0301, 0x00DA},
+    {0x0055, 0x0302, 0x00DB},
+    {0x0055, 0x0303, 0x0168},
+    {0x0055, 0x0304, 0x016A},
+    {0x0055, 0x0306, 0x016C},
+    {0x0055, 0x0308, 0x00DC},
+    {0x0055, 0x0309, 0x1EE6},
+    {0x0055, 0x030A, 0x016E},
+    {0x0055, 0x030B, 0x0170},
+    {0x0055, 0x030C, 0x01D3},
+    {0x0055, 0x030F, 0x0214},
+    {0x0055, 0x0311, 0x0216},
+    {0x0055, 0x031B, 0x01AF},
+    {0x0055, 0x0323, 0x1EE4},
+    {0x0055, 0x0324, 0x1E72},
+    {0x0055, 0x0328, 0x0172},
+    {0x0055, 0x032D, 0x1E76},
+    {0x0055, 0x0330, 0x1E74},
+    {0x0056, 0x0303, 0x1E7C},
+    {0x0056, 0x0323, 0x1E7E},
+    {0x0057, 0x0300, 0x1E80},
+    {0x0057, 0x0301, 0x1E82},
+    {0x0057, 0x0302, 0x0174},
+    {0x0057, 0x0307, 0x1E86},
+    {0x0057, 0x0308, 0x1E84},
+    {0x0057, 0x0323, 0x1E88},
+    {0x0058, 0x0307, 0x1E8A},
+    {0x0058, 0x0308, 0x1E8C},
+    {0x0059, 0x0300, 0x1EF2},
+    {0x0059, 0x0301, 0x00DD},
+    {0x0059, 0x0302, 0x0176},
+    {0x0059, 0x0303, 0x1EF8},
+    {0x0059, 0x0304, 0x0232},
+    {0x0059, 0x0307, 0x1E8E},
+    {0x0059, 0x0308, 0x0178},
+    {0x0059, 0x0309, 0x1EF6},
+    {0x0059, 0x0323, 0x1EF4},
+    {0x005A, 0x0301, 0x0179},
+    {0x005A, 0x0302, 0x1E90},
+    {0x005A, 0x0307, 0x017B},
+    {0x005A, 0x030C, 0x017D},
+    {0x005A, 0x0323, 0x1E92},
+    {0x005A, 0x0331, 0x1E94},
+    {0x0061, 0x0300, 0x00E0},
+    {0x0061, 0x0301, 0x00E1},
+    {0x0061, 0x0302, 0x00E2},
+    {0x0061, 0x0303, 0x00E3},
+    {0x0061, 0x0304, 0x0101},
+    {0x0061, 0x0306, 0x0103},
+    {0x0061, 0x0307, 0x0227},
+    {0x0061, 0x0308, 0x00E4},
+    {0x0061, 0x0309, 0x1EA3},
+    {0x0061, 0x030A, 0x00E5},
+    {0x0061, 0x030C, 0x01CE},
+    {0x0061, 0x030F, 0x0201},
+    {0x0061, 0x0311, 0x0203},
+    {0x0061, 0x0323, 0x1EA1},
+    {0x0061, 0x0325, 0x1E01},
+    {0x0061, 0x0328, 0x0105},
+    {0x0062, 0x0307, 0x1E03},
+    {0x0062, 0x0323, 0x1E05},
+    {0x0062, 0x0331, 0x1E07},
+    {0x0063, 0x0301, 0x0107},
+    {0x0063, 0x0302, 0x0109},
+    {0x0063, 0x0307, 0x010B},
+    {0x0063, 0x030C, 0x010D},
+    {0x0063, 0x0327, 0x00E7},
+    {0x0064, 0x0307, 0x1E0B},
+    {0x0064, 0x030C, 0x010F},
+    {0x0064, 0x0323, 0x1E0D},
+    {0x0064, 0x0327, 0x1E11},
+    {0x0064, 0x032D, 0x1E13},
+    {0x0064, 0x0331, 0x1E0F},
+    {0x0065, 0x0300, 0x00E8},
+    {0x0065, 0x0301, 0x00E9},
+    {0x0065, 0x0302, 0x00EA},
+    {0x0065, 0x0303, 0x1EBD},
+    {0x0065, 0x0304, 0x0113},
+    {0x0065, 0x0306, 0x0115},
+    {0x0065, 0x0307, 0x0117},
+    {0x0065, 0x0308, 0x00EB},
+    {0x0065, 0x0309, 0x1EBB},
+    {0x0065, 0x030C, 0x011B},
+    {0x0065, 0x030F, 0x0205},
+    {0x0065, 0x0311, 0x0207},
+    {0x0065, 0x0323, 0x1EB9},
+    {0x0065, 0x0327, 0x0229},
+    {0x0065, 0x0328, 0x0119},
+    {0x0065, 0x032D, 0x1E19},
+    {0x0065, 0x0330, 0x1E1B},
+    {0x0066, 0x0307, 0x1E1F},
+    {0x0067, 0x0301, 0x01F5},
+    {0x0067, 0x0302, 0x011D},
+    {0x0067, 0x0304, 0x1E21},
+    {0x0067, 0x0306, 0x011F},
+    {0x0067, 0x0307, 0x0121},
+    {0x0067, 0x030C, 0x01E7},
+    {0x0067, 0x0327, 0x0123},
+    {0x0068, 0x0302, 0x0125},
+    {0x0068, 0x0307, 0x1E23},
+    {0x0068, 0x0308, 0x1E27},
+    {0x0068, 0x030C, 0x021F},
+    {0x0068, 0x0323, 0x1E25},
+    {0x0068, 0x0327, 0x1E29},
+    {0x0068, 0x032E, 0x1E2B},
+    {0x0068, 0x0331, 0x1E96},
+    {0x0069, 0x0300, 0x00EC},
+    {0x0069, 0x0301, 0x00ED},
+    {0x0069, 0x0302, 0x00EE},
+    {0x0069, 0x0303, 0x0129},
+    {0x0069, 0x0304, 0x012B},
+    {0x0069, 0x0306, 0x012D},
+    {0x0069, 0x0308, 0x00EF},
+    {0x0069, 0x0309, 0x1EC9},
+    {0x0069, 0x030C, 0x01D0},
+    {0x0069, 0x030F, 0x0209},
+    {0x0069, 0x0311, 0x020B},
+    {0x0069, 0x0323, 0x1ECB},
+    {0x0069, 0x0328, 0x012F},
+    {0x0069, 0x0330, 0x1E2D},
+    {0x006A, 0x0302, 0x0135},
+    {0x006A, 0x030C, 0x01F0},
+    {0x006B, 0x0301, 0x1E31},
+    {0x006B, 0x030C, 0x01E9},
+    {0x006B, 0x0323, 0x1E33},
+    {0x006B, 0x0327, 0x0137},
+    {0x006B, 0x0331, 0x1E35},
+    {0x006C, 0x0301, 0x013A},
+    {0x006C, 0x030C, 0x013E},
+    {0x006C, 0x0323, 0x1E37},
+    {0x006C, 0x0327, 0x013C},
+    {0x006C, 0x032D, 0x1E3D},
+    {0x006C, 0x0331, 0x1E3B},
+    {0x006D, 0x0301, 0x1E3F},
+    {0x006D, 0x0307, 0x1E41},
+    {0x006D, 0x0323, 0x1E43},
+    {0x006E, 0x0300, 0x01F9},
+    {0x006E, 0x0301, 0x0144},
+    {0x006E, 0x0303, 0x00F1},
+    {0x006E, 0x0307, 0x1E45},
+    {0x006E, 0x030C, 0x0148},
+    {0x006E, 0x0323, 0x1E47},
+    {0x006E, 0x0327, 0x0146},
+    {0x006E, 0x032D, 0x1E4B},
+    {0x006E, 0x0331, 0x1E49},
+    {0x006F, 0x0300, 0x00F2},
+    {0x006F, 0x0301, 0x00F3},
+    {0x006F, 0x0302, 0x00F4},
+    {0x006F, 0x0303, 0x00F5},
+    {0x006F, 0x0304, 0x014D},
+    {0x006F, 0x0306, 0x014F},
+    {0x006F, 0x0307, 0x022F},
+    {0x006F, 0x0308, 0x00F6},
+    {0x006F, 0x0309, 0x1ECF},
+    {0x006F, 0x030B, 0x0151},
+    {0x006F, 0x030C, 0x01D2},
+    {0x006F, 0x030F, 0x020D},
+    {0x006F, 0x0311, 0x020F},
+    {0x006F, 0x031B, 0x01A1},
+    {0x006F, 0x0323, 0x1ECD},
+    {0x006F, 0x0328, 0x01EB},
+    {0x0070, 0x0301, 0x1E55},
+    {0x0070, 0x0307, 0x1E57},
+    {0x0072, 0x0301, 0x0155},
+    {0x0072, 0x0307, 0x1E59},
+    {0x0072, 0x030C, 0x0159},
+    {0x0072, 0x030F, 0x0211},
+    {0x0072, 0x0311, 0x0213},
+    {0x0072, 0x0323, 0x1E5B},
+    {0x0072, 0x0327, 0x0157},
+    {0x0072, 0x0331, 0x1E5F},
+    {0x0073, 0x0301, 0x015B},
+    {0x0073, 0x0302, 0x015D},
+    {0x0073, 0x0307, 0x1E61},
+    {0x0073, 0x030C, 0x0161},
+    {0x0073, 0x0323, 0x1E63},
+    {0x0073, 0x0326, 0x0219},
+    {0x0073, 0x0327, 0x015F},
+    {0x0074, 0x0307, 0x1E6B},
+    {0x0074, 0x0308, 0x1E97},
+    {0x0074, 0x030C, 0x0165},
+    {0x0074, 0x0323, 0x1E6D},
+    {0x0074, 0x0326, 0x021B},
+    {0x0074, 0x0327, 0x0163},
+    {0x0074, 0x032D, 0x1E71},
+    {0x0074, 0x0331, 0x1E6F},
+    {0x0075, 0x0300, 0x00F9},
+    {0x0075, 0x0301, 0x00FA},
+    {0x0075, 0x0302, 0x00FB},
+    {0x0075, 0x0303, 0x0169},
+    {0x0075, 0x0304, 0x016B},
+    {0x0075, 0x0306, 0x016D},
+    {0x0075, 0x0308, 0x00FC},
+    {0x0075, 0x0309, 0x1EE7},
+    {0x0075, 0x030A, 0x016F},
+    {0x0075, 0x030B, 0x0171},
+    {0x0075, 0x030C, 0x01D4},
+    {0x0075, 0x030F, 0x0215},
+    {0x0075, 0x0311, 0x0217},
+    {0x0075, 0x031B, 0x01B0},
+    {0x0075, 0x0323, 0x1EE5},
+    {0x0075, 0x0324, 0x1E73},
+    {0x0075, 0x0328, 0x0173},
+    {0x0075, 0x032D, 0x1E77},
+    {0x0075, 0x0330, 0x1E75},
+    {0x0076, 0x0303, 0x1E7D},
+    {0x0076, 0x0323, 0x1E7F},
+    {0x0077, 0x0300, 0x1E81},
+    {0x0077, 0x0301, 0x1E83},
+    {0x0077, 0x0302, 0x0175},
+    {0x0077, 0x0307, 0x1E87},
+    {0x0077, 0x0308, 0x1E85},
+    {0x0077, 0x030A, 0x1E98},
+    {0x0077, 0x0323, 0x1E89},
+    {0x0078, 0x0307, 0x1E8B},
+    {0x0078, 0x0308, 0x1E8D},
+    {0x0079, 0x0300, 0x1EF3},
+    {0x0079, 0x0301, 0x00FD},
+    {0x0079, 0x0302, 0x0177},
+    {0x0079, 0x0303, 0x1EF9},
+    {0x0079, 0x0304, 0x0233},
+    {0x0079, 0x0307, 0x1E8F},
+    {0x0079, 0x0308, 0x00FF},
+    {0x0079, 0x0309, 0x1EF7},
+    {0x0079, 0x030A, 0x1E99},
+    {0x0079, 0x0323, 0x1EF5},
+    {0x007A, 0x0301, 0x017A},
+    {0x007A, 0x0302, 0x1E91},
+    {0x007A, 0x0307, 0x017C},
+    {0x007A, 0x030C, 0x017E},
+    {0x007A, 0x0323, 0x1E93},
+    {0x007A, 0x0331, 0x1E95},
+    {0x00A8, 0x0300, 0x1FED},
+    {0x00A8, 0x0301, 0x0385},
+    {0x00A8, 0x0342, 0x1FC1},
+    {0x00C2, 0x0300, 0x1EA6},
+    {0x00C2, 0x0301, 0x1EA4},
+    {0x00C2, 0x0303, 0x1EAA},
+    {0x00C2, 0x0309, 0x1EA8},
+    {0x00C4, 0x0304, 0x01DE},
+    {0x00C5, 0x0301, 0x01FA},
+    {0x00C6, 0x0301, 0x01FC},
+    {0x00C6, 0x0304, 0x01E2},
+    {0x00C7, 0x0301, 0x1E08},
+    {0x00CA, 0x0300, 0x1EC0},
+    {0x00CA, 0x0301, 0x1EBE},
+    {0x00CA, 0x0303, 0x1EC4},
+    {0x00CA, 0x0309, 0x1EC2},
+    {0x00CF, 0x0301, 0x1E2E},
+    {0x00D4, 0x0300, 0x1ED2},
+    {0x00D4, 0x0301, 0x1ED0},
+    {0x00D4, 0x0303, 0x1ED6},
+    {0x00D4, 0x0309, 0x1ED4},
+    {0x00D5, 0x0301, 0x1E4C},
+    {0x00D5, 0x0304, 0x022C},
+    {0x00D5, 0x0308, 0x1E4E},
+    {0x00D6, 0x0304, 0x022A},
+    {0x00D8, 0x0301, 0x01FE},
+    {0x00DC, 0x0300, 0x01DB},
+    {0x00DC, 0x0301, 0x01D7},
+    {0x00DC, 0x0304, 0x01D5},
+    {0x00DC, 0x030C, 0x01D9},
+    {0x00E2, 0x0300, 0x1EA7},
+    {0x00E2, 0x0301, 0x1EA5},
+    {0x00E2, 0x0303, 0x1EAB},
+    {0x00E2, 0x0309, 0x1EA9},
+    {0x00E4, 0x0304, 0x01DF},
+    {0x00E5, 0x0301, 0x01FB},
+    {0x00E6, 0x0301, 0x01FD},
+    {0x00E6, 0x0304, 0x01E3},
+    {0x00E7, 0x0301, 0x1E09},
+    {0x00EA, 0x0300, 0x1EC1},
+    {0x00EA, 0x0301, 0x1EBF},
+    {0x00EA, 0x0303, 0x1EC5},
+    {0x00EA, 0x0309, 0x1EC3},
+    {0x00EF, 0x0301, 0x1E2F},
+    {0x00F4, 0x0300, 0x1ED3},
+    {0x00F4, 0x0301, 0x1ED1},
+    {0x00F4, 0x0303, 0x1ED7},
+    {0x00F4, 0x0309, 0x1ED5},
+    {0x00F5, 0x0301, 0x1E4D},
+    {0x00F5, 0x0304, 0x022D},
+    {0x00F5, 0x0308, 0x1E4F},
+    {0x00F6, 0x0304, 0x022B},
+    {0x00F8, 0x0301, 0x01FF},
+    {0x00FC, 0x0300, 0x01DC},
+    {0x00FC, 0x0301, 0x01D8},
+    {0x00FC, 0x0304, 0x01D6},
+    {0x00FC, 0x030C, 0x01DA},
+    {0x0102, 0x0300, 0x1EB0},
+    {0x0102, 0x0301, 0x1EAE},
+    {0x0102, 0x0303, 0x1EB4},
+    {0x0102, 0x0309, 0x1EB2},
+    {0x0103, 0x0300, 0x1EB1},
+    {0x0103, 0x0301, 0x1EAF},
+    {0x0103, 0x0303, 0x1EB5},
+    {0x0103, 0x0309, 0x1EB3},
+    {0x0112, 0x0300, 0x1E14},
+    {0x0112, 0x0301, 0x1E16},
+    {0x0113, 0x0300, 0x1E15},
+    {0x0113, 0x0301, 0x1E17},
+    {0x014C, 0x0300, 0x1E50},
+    {0x014C, 0x0301, 0x1E52},
+    {0x014D, 0x0300, 0x1E51},
+    {0x014D, 0x0301, 0x1E53},
+    {0x015A, 0x0307, 0x1E64},
+    {0x015B, 0x0307, 0x1E65},
+    {0x0160, 0x0307, 0x1E66},
+    {0x0161, 0x0307, 0x1E67},
+    {0x0168, 0x0301, 0x1E78},
+    {0x0169, 0x0301, 0x1E79},
+    {0x016A, 0x0308, 0x1E7A},
+    {0x016B, 0x0308, 0x1E7B},
+    {0x017F, 0x0307, 0x1E9B},
+    {0x01A0, 0x0300, 0x1EDC},
+    {0x01A0, 0x0301, 0x1EDA},
+    {0x01A0, 0x0303, 0x1EE0},
+    {0x01A0, 0x0309, 0x1EDE},
+    {0x01A0, 0x0323, 0x1EE2},
+    {0x01A1, 0x0300, 0x1EDD},
+    {0x01A1, 0x0301, 0x1EDB},
+    {0x01A1, 0x0303, 0x1EE1},
+    {0x01A1, 0x0309, 0x1EDF},
+    {0x01A1, 0x0323, 0x1EE3},
+    {0x01AF, 0x0300, 0x1EEA},
+    {0x01AF, 0x0301, 0x1EE8},
+    {0x01AF, 0x0303, 0x1EEE},
+    {0x01AF, 0x0309, 0x1EEC},
+    {0x01AF, 0x0323, 0x1EF0},
+    {0x01B0, 0x0300, 0x1EEB},
+    {0x01B0, 0x0301, 0x1EE9},
+    {0x01B0, 0x0303, 0x1EEF},
+    {0x01B0, 0x0309, 0x1EED},
+    {0x01B0, 0x0323, 0x1EF1},
+    {0x01B7, 0x030C, 0x01EE},
+    {0x01EA, 0x0304, 0x01EC},
+    {0x01EB, 0x0304, 0x01ED},
+    {0x0226, 0x0304, 0x01E0},
+    {0x0227, 0x0304, 0x01E1},
+    {0x0228, 0x0306, 0x1E1C},
+    {0x0229, 0x0306, 0x1E1D},
+    {0x022E, 0x0304, 0x0230},
+    {0x022F, 0x0304, 0x0231},
+    {0x0292, 0x030C, 0x01EF},
+    {0x0391, 0x0300, 0x1FBA},
+    {0x0391, 0x0301, 0x0386},
+    {0x0391, 0x0304, 0x1FB9},
+    {0x0391, 0x0306, 0x1FB8},
+    {0x0391, 0x0313, 0x1F08},
+    {0x0391, 0x0314, 0x1F09},
+    {0x0391, 0x0345, 0x1FBC},
+    {0x0395, 0x0300, 0x1FC8},
+    {0x0395, 0x0301, 0x0388},
+    {0x0395, 0x0313, 0x1F18},
+    {0x0395, 0x0314, 0x1F19},
+    {0x0397, 0x0300, 0x1FCA},
+    {0x0397, 0x0301, 0x0389},
+    {0x0397, 0x0313, 0x1F28},
+    {0x0397, 0x0314, 0x1F29},
+    {0x0397, 0x0345, 0x1FCC},
+    {0x0399, 0x0300, 0x1FDA},
+    {0x0399, 0x0301, 0x038A},
+    {0x0399, 0x0304, 0x1FD9},
+    {0x0399, 0x0306, 0x1FD8},
+    {0x0399, 0x0308, 0x03AA},
+    {0x0399, 0x0313, 0x1F38},
+    {0x0399, 0x0314, 0x1F39},
+    {0x039F, 0x0300, 0x1FF8},
+    {0x039F, 0x0301, 0x038C},
+    {0x039F, 0x0313, 0x1F48},
+    {0x039F, 0x0314, 0x1F49},
+    {0x03A1, 0x0314, 0x1FEC},
+    {0x03A5, 0x0300, 0x1FEA},
+    {0x03A5, 0x0301, 0x038E},
+    {0x03A5, 0x0304, 0x1FE9},
+    {0x03A5, 0x0306, 0x1FE8},
+    {0x03A5, 0x0308, 0x03AB},
+    {0x03A5, 0x0314, 0x1F59},
+    {0x03A9, 0x0300, 0x1FFA},
+    {0x03A9, 0x0301, 0x038F},
+    {0x03A9, 0x0313, 0x1F68},
+    {0x03A9, 0x0314, 0x1F69},
+    {0x03A9, 0x0345, 0x1FFC},
+    {0x03AC, 0x0345, 0x1FB4},
+    {0x03AE, 0x0345, 0x1FC4},
+    {0x03B1, 0x0300, 0x1F70},
+    {0x03B1, 0x0301, 0x03AC},
+    {0x03B1, 0x0304, 0x1FB1},
+    {0x03B1, 0x0306, 0x1FB0},
+    {0x03B1, 0x0313, 0x1F00},
+    {0x03B1, 0x0314, 0x1F01},
+    {0x03B1, 0x0342, 0x1FB6},
+    {0x03B1, 0x0345, 0x1FB3},
+    {0x03B5, 0x0300, 0x1F72},
+    {0x03B5, 0x0301, 0x03AD},
+    {0x03B5, 0x0313, 0x1F10},
+    {0x03B5, 0x0314, 0x1F11},
+    {0x03B7, 0x0300, 0x1F74},
+    {0x03B7, 0x0301, 0x03AE},
+    {0x03B7, 0x0313, 0x1F20},
+    {0x03B7, 0x0314, 0x1F21},
+    {0x03B7, 0x0342, 0x1FC6},
+    {0x03B7, 0x0345, 0x1FC3},
+    {0x03B9, 0x0300, 0x1F76},
+    {0x03B9, 0x0301, 0x03AF},
+    {0x03B9, 0x0304, 0x1FD1},
+    {0x03B9, 0x0306, 0x1FD0},
+    {0x03B9, 0x0308, 0x03CA},
+    {0x03B9, 0x0313, 0x1F30},
+    {0x03B9, 0x0314, 0x1F31},
+    {0x03B9, 0x0342, 0x1FD6},
+    {0x03BF, 0x0300, 0x1F78},
+    {0x03BF, 0x0301, 0x03CC},
+    {0x03BF, 0x0313, 0x1F40},
+    {0x03BF, 0x0314, 0x1F41},
+    {0x03C1, 0x0313, 0x1FE4},
+    {0x03C1, 0x0314, 0x1FE5},
+    {0x03C5, 0x0300, 0x1F7A},
+    {0x03C5, 0x0301, 0x03CD},
+    {0x03C5, 0x0304, 0x1FE1},
+    {0x03C5, 0x0306, 0x1FE0},
+    {0x03C5, 0x0308, 0x03CB},
+    {0x03C5, 0x0313, 0x1F50},
+    {0x03C5, 0x0314, 0x1F51},
+    {0x03C5, 0x0342, 0x1FE6},
+    {0x03C9, 0x0300, 0x1F7C},
+    {0x03C9, 0x0301, 0x03CE},
+    {0x03C9, 0x0313, 0x1F60},
+    {0x03C9, 0x0314, 0x1F61},
+    {0x03C9, 0x0342, 0x1FF6},
+    {0x03C9, 0x0345, 0x1FF3},
+    {0x03CA, 0x0300, 0x1FD2},
+    {0x03CA, 0x0301, 0x0390},
+    {0x03CA, 0x0342, 0x1FD7},
+    {0x03CB, 0x0300, 0x1FE2},
+    {0x03CB, 0x0301, 0x03B0},
+    {0x03CB, 0x0342, 0x1FE7},
+    {0x03CE, 0x0345, 0x1FF4},
+    {0x03D2, 0x0301, 0x03D3},
+    {0x03D2, 0x0308, 0x03D4},
+    {0x0406, 0x0308, 0x0407},
+    {0x0410, 0x0306, 0x04D0},
+    {0x0410, 0x0308, 0x04D2},
+    {0x0413, 0x0301, 0x0403},
+    {0x0415, 0x0300, 0x0400},
+    {0x0415, 0x0306, 0x04D6},
+    {0x0415, 0x0308, 0x0401},
+    {0x0416, 0x0306, 0x04C1},
+    {0x0416, 0x0308, 0x04DC},
+    {0x0417, 0x0308, 0x04DE},
+    {0x0418, 0x0300, 0x040D},
+    {0x0418, 0x0304, 0x04E2},
+    {0x0418, 0x0306, 0x0419},
+    {0x0418, 0x0308, 0x04E4},
+    {0x041A, 0x0301, 0x040C},
+    {0x041E, 0x0308, 0x04E6},
+    {0x0423, 0x0304, 0x04EE},
+    {0x0423, 0x0306, 0x040E},
+    {0x0423, 0x0308, 0x04F0},
+    {0x0423, 0x030B, 0x04F2},
+    {0x0427, 0x0308, 0x04F4},
+    {0x042B, 0x0308, 0x04F8},
+    {0x042D, 0x0308, 0x04EC},
+    {0x0430, 0x0306, 0x04D1},
+    {0x0430, 0x0308, 0x04D3},
+    {0x0433, 0x0301, 0x0453},
+    {0x0435, 0x0300, 0x0450},
+    {0x0435, 0x0306, 0x04D7},
+    {0x0435, 0x0308, 0x0451},
+    {0x0436, 0x0306, 0x04C2},
+    {0x0436, 0x0308, 0x04DD},
+    {0x0437, 0x0308, 0x04DF},
+    {0x0438, 0x0300, 0x045D},
+    {0x0438, 0x0304, 0x04E3},
+    {0x0438, 0x0306, 0x0439},
+    {0x0438, 0x0308, 0x04E5},
+    {0x043A, 0x0301, 0x045C},
+    {0x043E, 0x0308, 0x04E7},
+    {0x0443, 0x0304, 0x04EF},
+    {0x0443, 0x0306, 0x045E},
+    {0x0443, 0x0308, 0x04F1},
+    {0x0443, 0x030B, 0x04F3},
+    {0x0447, 0x0308, 0x04F5},
+    {0x044B, 0x0308, 0x04F9},
+    {0x044D, 0x0308, 0x04ED},
+    {0x0456, 0x0308, 0x0457},
+    {0x0474, 0x030F, 0x0476},
+    {0x0475, 0x030F, 0x0477},
+    {0x04D8, 0x0308, 0x04DA},
+    {0x04D9, 0x0308, 0x04DB},
+    {0x04E8, 0x0308, 0x04EA},
+    {0x04E9, 0x0308, 0x04EB},
+    {0x0627, 0x0653, 0x0622},
+    {0x0627, 0x0654, 0x0623},
+    {0x0627, 0x0655, 0x0625},
+    {0x0648, 0x0654, 0x0624},
+    {0x064A, 0x0654, 0x0626},
+    {0x06C1, 0x0654, 0x06C2},
+    {0x06D2, 0x0654, 0x06D3},
+    {0x06D5, 0x0654, 0x06C0},
+    {0x0928, 0x093C, 0x0929},
+    {0x0930, 0x093C, 0x0931},
+    {0x0933, 0x093C, 0x0934},
+    {0x09C7, 0x09BE, 0x09CB},
+    {0x09C7, 0x09D7, 0x09CC},
+    {0x0B47, 0x0B3E, 0x0B4B},
+    {0x0B47, 0x0B56, 0x0B48},
+    {0x0B47, 0x0B57, 0x0B4C},
+    {0x0B92, 0x0BD7, 0x0B94},
+    {0x0BC6, 0x0BBE, 0x0BCA},
+    {0x0BC6, 0x0BD7, 0x0BCC},
+    {0x0BC7, 0x0BBE, 0x0BCB},
+    {0x0C46, 0x0C56, 0x0C48},
+    {0x0CBF, 0x0CD5, 0x0CC0},
+    {0x0CC6, 0x0CC2, 0x0CCA},
+    {0x0CC6, 0x0CD5, 0x0CC7},
+    {0x0CC6, 0x0CD6, 0x0CC8},
+    {0x0CCA, 0x0CD5, 0x0CCB},
+    {0x0D46, 0x0D3E, 0x0D4A},
+    {0x0D46, 0x0D57, 0x0D4C},
+    {0x0D47, 0x0D3E, 0x0D4B},
+    {0x0DD9, 0x0DCA, 0x0DDA},
+    {0x0DD9, 0x0DCF, 0x0DDC},
+    {0x0DD9, 0x0DDF, 0x0DDE},
+    {0x0DDC, 0x0DCA, 0x0DDD},
+    {0x1025, 0x102E, 0x1026},
+    {0x1B05, 0x1B35, 0x1B06},
+    {0x1B07, 0x1B35, 0x1B08},
+    {0x1B09, 0x1B35, 0x1B0A},
+    {0x1B0B, 0x1B35, 0x1B0C},
+    {0x1B0D, 0x1B35, 0x1B0E},
+    {0x1B11, 0x1B35, 0x1B12},
+    {0x1B3A, 0x1B35, 0x1B3B},
+    {0x1B3C, 0x1B35, 0x1B3D},
+    {0x1B3E, 0x1B35, 0x1B40},
+    {0x1B3F, 0x1B35, 0x1B41},
+    {0x1B42, 0x1B35, 0x1B43},
+    {0x1E36, 0x0304, 0x1E38},
+    {0x1E37, 0x0304, 0x1E39},
+    {0x1E5A, 0x0304, 0x1E5C},
+    {0x1E5B, 0x0304, 0x1E5D},
+    {0x1E62, 0x0307, 0x1E68},
+    {0x1E63, 0x0307, 0x1E69},
+    {0x1EA0, 0x0302, 0x1EAC},
+    {0x1EA0, 0x0306, 0x1EB6},
+    {0x1EA1, 0x0302, 0x1EAD},
+    {0x1EA1, 0x0306, 0x1EB7},
+    {0x1EB8, 0x0302, 0x1EC6},
+    {0x1EB9, 0x0302, 0x1EC7},
+    {0x1ECC, 0x0302, 0x1ED8},
+    {0x1ECD, 0x0302, 0x1ED9},
+    {0x1F00, 0x0300, 0x1F02},
+    {0x1F00, 0x0301, 0x1F04},
+    {0x1F00, 0x0342, 0x1F06},
+    {0x1F00, 0x0345, 0x1F80},
+    {0x1F01, 0x0300, 0x1F03},
+    {0x1F01, 0x0301, 0x1F05},
+    {0x1F01, 0x0342, 0x1F07},
+    {0x1F01, 0x0345, 0x1F81},
+    {0x1F02, 0x0345, 0x1F82},
+    {0x1F03, 0x0345, 0x1F83},
+    {0x1F04, 0x0345, 0x1F84},
+    {0x1F05, 0x0345, 0x1F85},
+    {0x1F06, 0x0345, 0x1F86},
+    {0x1F07, 0x0345, 0x1F87},
+    {0x1F08, 0x0300, 0x1F0A},
+    {0x1F08, 0x0301, 0x1F0C},
+    {0x1F08, 0x0342, 0x1F0E},
+    {0x1F08, 0x0345, 0x1F88},
+    {0x1F09, 0x0300, 0x1F0B},
+    {0x1F09, 0x0301, 0x1F0D},
+    {0x1F09, 0x0342, 0x1F0F},
+    {0x1F09, 0x0345, 0x1F89},
+    {0x1F0A, 0x0345, 0x1F8A},
+    {0x1F0B, 0x0345, 0x1F8B},
+    {0x1F0C, 0x0345, 0x1F8C},
+    {0x1F0D, 0x0345, 0x1F8D},
+    {0x1F0E, 0x0345, 0x1F8E},
+    {0x1F0F, 0x0345, 0x1F8F},
+    {0x1F10, 0x0300, 0x1F12},
+    {0x1F10, 0x0301, 0x1F14},
+    {0x1F11, 0x0300, 0x1F13},
+    {0x1F11, 0x0301, 0x1F15},
+    {0x1F18, 0x0300, 0x1F1A},
+    {0x1F18, 0x0301, 0x1F1C},
+    {0x1F19, 0x0300, 0x1F1B},
+    {0x1F19, 0x0301, 0x1F1D},
+    {0x1F20, 0x0300, 0x1F22},
+    {0x1F20, 0x0301, 0x1F24},
+    {0x1F20, 0x0342, 0x1F26},
+    {0x1F20, 0x0345, 0x1F90},
+    {0x1F21, 0x0300, 0x1F23},
+    {0x1F21, 0x0301, 0x1F25},
+    {0x1F21, 0x0342, 0x1F27},
+    {0x1F21, 0x0345, 0x1F91},
+    {0x1F22, 0x0345, 0x1F92},
+    {0x1F23, 0x0345, 0x1F93},
+    {0x1F24, 0x0345, 0x1F94},
+    {0x1F25, 0x0345, 0x1F95},
+    {0x1F26, 0x0345, 0x1F96},
+    {0x1F27, 0x0345, 0x1F97},
+    {0x1F28, 0x0300, 0x1F2A},
+    {0x1F28, 0x0301, 0x1F2C},
+    {0x1F28, 0x0342, 0x1F2E},
+    {0x1F28, 0x0345, 0x1F98},
+    {0x1F29, 0x0300, 0x1F2B},
+    {0x1F29, 0x0301, 0x1F2D},
+    {0x1F29, 0x0342, 0x1F2F},
+    {0x1F29, 0x0345, 0x1F99},
+    {0x1F2A, 0x0345, 0x1F9A},
+    {0x1F2B, 0x0345, 0x1F9B},
+    {0x1F2C, 0x0345, 0x1F9C},
+    {0x1F2D, 0x0345, 0x1F9D},
+    {0x1F2E, 0x0345, 0x1F9E},
+    {0x1F2F, 0x0345, 0x1F9F},
+    {0x1F30, 0x0300, 0x1F32},
+    {0x1F30, 0x0301, 0x1F34},
+    {0x1F30, 0x0342, 0x1F36},
+    {0x1F31, 0x0300, 0x1F33},
+    {0x1F31, 0x0301, 0x1F35},
+    {0x1F31, 0x0342, 0x1F37},
+    {0x1F38, 0x0300, 0x1F3A},
+    {0x1F38, 0x0301, 0x1F3C},
+    {0x1F38, 0x0342, 0x1F3E},
+    {0x1F39, 0x0300, 0x1F3B},
+    {0x1F39, 0x0301, 0x1F3D},
+    {0x1F39, 0x0342, 0x1F3F},
+    {0x1F40, 0x0300, 0x1F42},
+    {0x1F40, 0x0301, 0x1F44},
+    {0x1F41, 0x0300, 0x1F43},
+    {0x1F41, 0x0301, 0x1F45},
+    {0x1F48, 0x0300, 0x1F4A},
+    {0x1F48, 0x0301, 0x1F4C},
+    {0x1F49, 0x0300, 0x1F4B},
+    {0x1F49, 0x0301, 0x1F4D},
+    {0x1F50, 0x0300, 0x1F52},
+    {0x1F50, 0x0301, 0x1F54},
+    {0x1F50, 0x0342, 0x1F56},
+    {0x1F51, 0x0300, 0x1F53},
+    {0x1F51, 0x0301, 0x1F55},
+    {0x1F51, 0x0342, 0x1F57},
+    {0x1F59, 0x0300, 0x1F5B},
+    {0x1F59, 0x0301, 0x1F5D},
+    {0x1F59, 0x0342, 0x1F5F},
+    {0x1F60, 0x0300, 0x1F62},
+    {0x1F60, 0x0301, 0x1F64},
+    {0x1F60, 0x0342, 0x1F66},
+    {0x1F60, 0x0345, 0x1FA0},
+    {0x1F61, 0x0300, 0x1F63},
+    {0x1F61, 0x0301, 0x1F65},
+    {0x1F61, 0x0342, 0x1F67},
+    {0x1F61, 0x0345, 0x1FA1},
+    {0x1F62, 0x0345, 0x1FA2},
+    {0x1F63, 0x0345, 0x1FA3},
+    {0x1F64, 0x0345, 0x1FA4},
+    {0x1F65, 0x0345, 0x1FA5},
+    {0x1F66, 0x0345, 0x1FA6},
+    {0x1F67, 0x0345, 0x1FA7},
+    {0x1F68, 0x0300, 0x1F6A},
+    {0x1F68, 0x0301, 0x1F6C},
+    {0x1F68, 0x0342, 0x1F6E},
+    {0x1F68, 0x0345, 0x1FA8},
+    {0x1F69, 0x0300, 0x1F6B},
+    {0x1F69, 0x0301, 0x1F6D},
+    {0x1F69, 0x0342, 0x1F6F},
+    {0x1F69, 0x0345, 0x1FA9},
+    {0x1F6A, 0x0345, 0x1FAA},
+    {0x1F6B, 0x0345, 0x1FAB},
+    {0x1F6C, 0x0345, 0x1FAC},
+    {0x1F6D, 0x0345, 0x1FAD},
+    {0x1F6E, 0x0345, 0x1FAE},
+    {0x1F6F, 0x0345, 0x1FAF},
+    {0x1F70, 0x0345, 0x1FB2},
+    {0x1F74, 0x0345, 0x1FC2},
+    {0x1F7C, 0x0345, 0x1FF2},
+    {0x1FB6, 0x0345, 0x1FB7},
+    {0x1FBF, 0x0300, 0x1FCD},
+    {0x1FBF, 0x0301, 0x1FCE},
+    {0x1FBF, 0x0342, 0x1FCF},
+    {0x1FC6, 0x0345, 0x1FC7},
+    {0x1FF6, 0x0345, 0x1FF7},
+    {0x1FFE, 0x0300, 0x1FDD},
+    {0x1FFE, 0x0301, 0x1FDE},
+    {0x1FFE, 0x0342, 0x1FDF},
+    {0x2190, 0x0338, 0x219A},
+    {0x2192, 0x0338, 0x219B},
+    {0x2194, 0x0338, 0x21AE},
+    {0x21D0, 0x0338, 0x21CD},
+    {0x21D2, 0x0338, 0x21CF},
+    {0x21D4, 0x0338, 0x21CE},
+    {0x2203, 0x0338, 0x2204},
+    {0x2208, 0x0338, 0x2209},
+    {0x220B, 0x0338, 0x220C},
+    {0x2223, 0x0338, 0x2224},
+    {0x2225, 0x0338, 0x2226},
+    {0x223C, 0x0338, 0x2241},
+    {0x2243, 0x0338, 0x2244},
+    {0x2245, 0x0338, 0x2247},
+    {0x2248, 0x0338, 0x2249},
+    {0x224D, 0x0338, 0x226D},
+    {0x2261, 0x0338, 0x2262},
+    {0x2264, 0x0338, 0x2270},
+    {0x2265, 0x0338, 0x2271},
+    {0x2272, 0x0338, 0x2274},
+    {0x2273, 0x0338, 0x2275},
+    {0x2276, 0x0338, 0x2278},
+    {0x2277, 0x0338, 0x2279},
+    {0x227A, 0x0338, 0x2280},
+    {0x227B, 0x0338, 0x2281},
+    {0x227C, 0x0338, 0x22E0},
+    {0x227D, 0x0338, 0x22E1},
+    {0x2282, 0x0338, 0x2284},
+    {0x2283, 0x0338, 0x2285},
+    {0x2286, 0x0338, 0x2288},
+    {0x2287, 0x0338, 0x2289},
+    {0x2291, 0x0338, 0x22E2},
+    {0x2292, 0x0338, 0x22E3},
+    {0x22A2, 0x0338, 0x22AC},
+    {0x22A8, 0x0338, 0x22AD},
+    {0x22A9, 0x0338, 0x22AE},
+    {0x22AB, 0x0338, 0x22AF},
+    {0x22B2, 0x0338, 0x22EA},
+    {0x22B3, 0x0338, 0x22EB},
+    {0x22B4, 0x0338, 0x22EC},
+    {0x22B5, 0x0338, 0x22ED},
+    {0x3046, 0x3099, 0x3094},
+    {0x304B, 0x3099, 0x304C},
+    {0x304D, 0x3099, 0x304E},
+    {0x304F, 0x3099, 0x3050},
+    {0x3051, 0x3099, 0x3052},
+    {0x3053, 0x3099, 0x3054},
+    {0x3055, 0x3099, 0x3056},
+    {0x3057, 0x3099, 0x3058},
+    {0x3059, 0x3099, 0x305A},
+    {0x305B, 0x3099, 0x305C},
+    {0x305D, 0x3099, 0x305E},
+    {0x305F, 0x3099, 0x3060},
+    {0x3061, 0x3099, 0x3062},
+    {0x3064, 0x3099, 0x3065},
+    {0x3066, 0x3099, 0x3067},
+    {0x3068, 0x3099, 0x3069},
+    {0x306F, 0x3099, 0x3070},
+    {0x306F, 0x309A, 0x3071},
+    {0x3072, 0x3099, 0x3073},
+    {0x3072, 0x309A, 0x3074},
+    {0x3075, 0x3099, 0x3076},
+    {0x3075, 0x309A, 0x3077},
+    {0x3078, 0x3099, 0x3079},
+    {0x3078, 0x309A, 0x307A},
+    {0x307B, 0x3099, 0x307C},
+    {0x307B, 0x309A, 0x307D},
+    {0x309D, 0x3099, 0x309E},
+    {0x30A6, 0x3099, 0x30F4},
+    {0x30AB, 0x3099, 0x30AC},
+    {0x30AD, 0x3099, 0x30AE},
+    {0x30AF, 0x3099, 0x30B0},
+    {0x30B1, 0x3099, 0x30B2},
+    {0x30B3, 0x3099, 0x30B4},
+    {0x30B5, 0x3099, 0x30B6},
+    {0x30B7, 0x3099, 0x30B8},
+    {0x30B9, 0x3099, 0x30BA},
+    {0x30BB, 0x3099, 0x30BC},
+    {0x30BD, 0x3099, 0x30BE},
+    {0x30BF, 0x3099, 0x30C0},
+    {0x30C1, 0x3099, 0x30C2},
+    {0x30C4, 0x3099, 0x30C5},
+    {0x30C6, 0x3099, 0x30C7},
+    {0x30C8, 0x3099, 0x30C9},
+    {0x30CF, 0x3099, 0x30D0},
+    {0x30CF, 0x309A, 0x30D1},
+    {0x30D2, 0x3099, 0x30D3},
+    {0x30D2, 0x309A, 0x30D4},
+    {0x30D5, 0x3099, 0x30D6},
+    {0x30D5, 0x309A, 0x30D7},
+    {0x30D8, 0x3099, 0x30D9},
+    {0x30D8, 0x309A, 0x30DA},
+    {0x30DB, 0x3099, 0x30DC},
+    {0x30DB, 0x309A, 0x30DD},
+    {0x30EF, 0x3099, 0x30F7},
+    {0x30F0, 0x3099, 0x30F8},
+    {0x30F1, 0x3099, 0x30F9},
+    {0x30F2, 0x3099, 0x30FA},
+    {0x30FD, 0x3099, 0x30FE},
+    {0x11099, 0x110BA, 0x1109A},
+    {0x1109B, 0x110BA, 0x1109C},
+    {0x110A5, 0x110BA, 0x110AB},
+    {0x11131, 0x11127, 0x1112E},
+    {0x11132, 0x11127, 0x1112F},
+    {0x11347, 0x1133E, 0x1134B},
+    {0x11347, 0x11357, 0x1134C},
+    {0x114B9, 0x114B0, 0x114BC},
+    {0x114B9, 0x114BA, 0x114BB},
+    {0x114B9, 0x114BD, 0x114BE},
+    {0x115B8, 0x115AF, 0x115BA},
+    {0x115B9, 0x115AF, 0x115BB},
+    {0x11935, 0x11930, 0x11938},
+};
+
+}  // namespace edoren::unicode::internal
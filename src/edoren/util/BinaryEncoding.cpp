@@ -0,0 +1,214 @@
+#include <edoren/util/BinaryEncoding.hpp>
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <utility>
+
+namespace edoren {
+
+namespace {
+
+constexpr const char* sBase64StandardAlphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr const char* sBase64UrlSafeAlphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// Value of the characters that are not part of an alphabet, all of them have the high bit set
+constexpr uint8_t sInvalidDigit = 0xFF;
+
+// Characters for every 12 bit value, so each 3 byte group is encoded with only two lookups
+using Base64PairTable = std::array<std::array<char, 2>, 4096>;
+
+constexpr Base64PairTable MakeBase64PairTable(const char* alphabet) {
+    Base64PairTable table = {};
+    for (size_t i = 0; i < table.size(); i++) {
+        table[i] = {alphabet[i >> 6], alphabet[i & 0x3F]};
+    }
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> MakeBase64DecodeTable(const char* alphabet) {
+    std::array<uint8_t, 256> table = {};
+    table.fill(sInvalidDigit);
+    for (uint8_t i = 0; i < 64; i++) {
+        table[static_cast<uint8_t>(alphabet[i])] = i;
+    }
+    return table;
+}
+
+// Characters for every byte value
+using HexPairTable = std::array<std::array<char, 2>, 256>;
+
+constexpr HexPairTable MakeHexPairTable(const char* digits) {
+    HexPairTable table = {};
+    for (size_t i = 0; i < table.size(); i++) {
+        table[i] = {digits[i >> 4], digits[i & 0x0F]};
+    }
+    return table;
+}
+
+constexpr std::array<uint8_t, 256> MakeHexDecodeTable() {
+    std::array<uint8_t, 256> table = {};
+    table.fill(sInvalidDigit);
+    for (uint8_t i = 0; i < 10; i++) {
+        table['0' + i] = i;
+    }
+    for (uint8_t i = 0; i < 6; i++) {
+        table['a' + i] = 10 + i;
+        table['A' + i] = 10 + i;
+    }
+    return table;
+}
+
+constexpr Base64PairTable sBase64StandardPairs = MakeBase64PairTable(sBase64StandardAlphabet);
+constexpr Base64PairTable sBase64UrlSafePairs = MakeBase64PairTable(sBase64UrlSafeAlphabet);
+constexpr std::array<uint8_t, 256> sBase64StandardValues = MakeBase64DecodeTable(sBase64StandardAlphabet);
+constexpr std::array<uint8_t, 256> sBase64UrlSafeValues = MakeBase64DecodeTable(sBase64UrlSafeAlphabet);
+constexpr HexPairTable sHexLowerPairs = MakeHexPairTable("0123456789abcdef");
+constexpr HexPairTable sHexUpperPairs = MakeHexPairTable("0123456789ABCDEF");
+constexpr std::array<uint8_t, 256> sHexValues = MakeHexDecodeTable();
+
+}  // namespace
+
+String EncodeBase64(const uint8_t* data, size_t size, Base64Alphabet alphabet) {
+    const bool padding = alphabet == Base64Alphabet::STANDARD;
+    const Base64PairTable& pairs = padding ? sBase64StandardPairs : sBase64UrlSafePairs;
+    const size_t fullGroups = size / 3;
+    const size_t remaining = size % 3;
+
+    std::basic_string<char> out;
+    out.resize(fullGroups * 4 + (remaining == 0 ? 0 : (padding ? 4 : remaining + 1)));
+    char* it = out.data();
+
+    for (size_t i = 0; i < fullGroups * 3; i += 3) {
+        uint32_t group = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8) | data[i + 2];
+        std::memcpy(it, pairs[group >> 12].data(), 2);
+        std::memcpy(it + 2, pairs[group & 0xFFF].data(), 2);
+        it += 4;
+    }
+
+    if (remaining != 0) {
+        const uint8_t* tail = data + fullGroups * 3;
+        uint32_t group = (uint32_t(tail[0]) << 16) | (remaining == 2 ? uint32_t(tail[1]) << 8 : 0);
+        std::memcpy(it, pairs[group >> 12].data(), 2);
+        if (remaining == 2) {
+            it[2] = pairs[group & 0xFFF][0];
+        }
+        if (padding) {
+            it[3] = '=';
+            if (remaining == 1) {
+                it[2] = '=';
+            }
+        }
+    }
+
+    return String::FromUtf8Unchecked(std::move(out));
+}
+
+String EncodeBase64(const Vector<uint8_t>& data, Base64Alphabet alphabet) {
+    return EncodeBase64(data.data(), data.getSize(), alphabet);
+}
+
+bool DecodeBase64(StringView text, Vector<uint8_t>& dest, Base64Alphabet alphabet) {
+    const std::array<uint8_t, 256>& values =
+        alphabet == Base64Alphabet::STANDARD ? sBase64StandardValues : sBase64UrlSafeValues;
+    const auto* input = reinterpret_cast<const uint8_t*>(text.getData());
+    size_t size = text.getDataSize();
+
+    // Remove the optional padding, it can only complete the last group of 4 characters
+    if (size % 4 == 0 && size > 0 && input[size - 1] == '=') {
+        size -= input[size - 2] == '=' ? 2 : 1;
+    }
+
+    const size_t fullGroups = size / 4;
+    const size_t remaining = size % 4;
+    dest.clear();
+    if (remaining == 1) {
+        return false;
+    }
+    dest.resize(fullGroups * 3 + (remaining == 0 ? 0 : remaining - 1));
+    uint8_t* out = dest.getData();
+
+    for (size_t i = 0; i < fullGroups * 4; i += 4) {
+        uint32_t a = values[input[i]];
+        uint32_t b = values[input[i + 1]];
+        uint32_t c = values[input[i + 2]];
+        uint32_t d = values[input[i + 3]];
+        // Check all the digits at once, only the invalid ones have the high bit set
+        if (((a | b | c | d) & 0x80) != 0) {
+            dest.clear();
+            return false;
+        }
+        uint32_t group = (a << 18) | (b << 12) | (c << 6) | d;
+        out[0] = static_cast<uint8_t>(group >> 16);
+        out[1] = static_cast<uint8_t>(group >> 8);
+        out[2] = static_cast<uint8_t>(group);
+        out += 3;
+    }
+
+    if (remaining != 0) {
+        const uint8_t* tail = input + fullGroups * 4;
+        uint32_t a = values[tail[0]];
+        uint32_t b = values[tail[1]];
+        uint32_t c = remaining == 3 ? values[tail[2]] : 0;
+        if (((a | b | c) & 0x80) != 0) {
+            dest.clear();
+            return false;
+        }
+        uint32_t group = (a << 18) | (b << 12) | (c << 6);
+        // The bits after the last byte must be zero, otherwise several texts would decode to the same data
+        const uint32_t unusedBits = remaining == 3 ? 0xFF : 0xFFFF;
+        if ((group & unusedBits) != 0) {
+            dest.clear();
+            return false;
+        }
+        out[0] = static_cast<uint8_t>(group >> 16);
+        if (remaining == 3) {
+            out[1] = static_cast<uint8_t>(group >> 8);
+        }
+    }
+
+    return true;
+}
+
+String EncodeHex(const uint8_t* data, size_t size, bool upperCase) {
+    const HexPairTable& pairs = upperCase ? sHexUpperPairs : sHexLowerPairs;
+
+    std::basic_string<char> out;
+    out.resize(size * 2);
+    char* it = out.data();
+    for (size_t i = 0; i < size; i++) {
+        std::memcpy(it + i * 2, pairs[data[i]].data(), 2);
+    }
+
+    return String::FromUtf8Unchecked(std::move(out));
+}
+
+String EncodeHex(const Vector<uint8_t>& data, bool upperCase) {
+    return EncodeHex(data.data(), data.getSize(), upperCase);
+}
+
+bool DecodeHex(StringView text, Vector<uint8_t>& dest) {
+    const auto* input = reinterpret_cast<const uint8_t*>(text.getData());
+    const size_t size = text.getDataSize();
+
+    dest.clear();
+    if (size % 2 != 0) {
+        return false;
+    }
+    dest.resize(size / 2);
+    uint8_t* out = dest.getData();
+
+    for (size_t i = 0; i < size; i += 2) {
+        uint8_t high = sHexValues[input[i]];
+        uint8_t low = sHexValues[input[i + 1]];
+        if (((high | low) & 0x80) != 0) {
+            dest.clear();
+            return false;
+        }
+        out[i / 2] = static_cast<uint8_t>((high << 4) | low);
+    }
+
+    return true;
+}
+
+}  // namespace edoren
@@ -0,0 +1,14 @@
+#include <edoren/util/MemoryResource.hpp>
+
+namespace edoren {
+
+namespace internal {
+
+std::pmr::memory_resource* GetPooledResource() {
+    static auto* sResource = new std::pmr::synchronized_pool_resource();
+    return sResource;
+}
+
+}  // namespace internal
+
+}  // namespace edoren
@@ -0,0 +1,117 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <edoren/Function.hpp>
+#include <edoren/FunctionRef.hpp>
+#include <edoren/UniqueFunction.hpp>
+#include <edoren/threading/ThreadPool.hpp>
+
+using namespace edoren;
+
+// Hidden benchmarks, run them with: EdoToolsTest "[.benchmark]"
+
+namespace {
+
+constexpr int sCallCount = 1000;
+
+// The wrapper is read through a volatile pointer, so the compiler can't see the callable and inline it
+template <typename Wrapper>
+int CallMany(Wrapper& wrapper) {
+    Wrapper* volatile opaque = &wrapper;
+    int result = 0;
+    for (int i = 0; i < sCallCount; i++) {
+        result += (*opaque)(int(i));
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("Function wrappers call overhead", "[.benchmark][Function]") {
+    // 24 bytes of captures, like a lambda capturing three pointers
+    std::array<long, 3> capture = {1, 2, 3};
+    auto callable = [capture](int value) { return value + static_cast<int>(capture[0] + capture[1] + capture[2]); };
+
+    BENCHMARK("FunctionRef, 1000 calls") {
+        FunctionRef<int(int)> wrapper = callable;
+        return CallMany(wrapper);
+    };
+    BENCHMARK("Function, 1000 calls") {
+        Function<int(int)> wrapper = callable;
+        return CallMany(wrapper);
+    };
+    BENCHMARK("std::function, 1000 calls") {
+        std::function<int(int)> wrapper = callable;
+        return CallMany(wrapper);
+    };
+
+    BENCHMARK("FunctionRef, build and call") {
+        FunctionRef<int(int)> wrapper = callable;
+        FunctionRef<int(int)>* volatile opaque = &wrapper;
+        return (*opaque)(1);
+    };
+    BENCHMARK("Function, build and call") {
+        Function<int(int)> wrapper = callable;
+        Function<int(int)>* volatile opaque = &wrapper;
+        return (*opaque)(1);
+    };
+    BENCHMARK("std::function, build and call") {
+        std::function<int(int)> wrapper = callable;
+        std::function<int(int)>* volatile opaque = &wrapper;
+        return (*opaque)(1);
+    };
+}
+
+TEST_CASE("Function wrappers move cost", "[.benchmark][Function]") {
+    // The captured vector is deep copied if the wrapper copies instead of moving
+    std::vector<int> data(256, 1);
+    auto callable = [data]() { return data.size(); };
+
+    // The callable is copied once outside, each iteration moves it around and back to the first wrapper
+    Function<size_t()> function = callable;
+    Function<size_t()> otherFunction;
+    BENCHMARK("Function, move construct and two move assigns") {
+        Function<size_t()> moved(std::move(function));
+        otherFunction = std::move(moved);
+        function = std::move(otherFunction);
+        return function();
+    };
+    UniqueFunction<size_t()> uniqueFunction = callable;
+    UniqueFunction<size_t()> otherUniqueFunction;
+    BENCHMARK("UniqueFunction, move construct and two move assigns") {
+        UniqueFunction<size_t()> moved(std::move(uniqueFunction));
+        otherUniqueFunction = std::move(moved);
+        uniqueFunction = std::move(otherUniqueFunction);
+        return uniqueFunction();
+    };
+}
+
+TEST_CASE("ThreadPool task throughput", "[.benchmark][ThreadPool]") {
+    constexpr int taskCount = 10000;
+    std::vector<int> data(256, 1);
+
+    // Includes starting and joining the workers, compare the results between revisions
+    BENCHMARK("ThreadPool<Function<void()>>, 10000 tasks capturing a vector") {
+        std::atomic<size_t> total = 0;
+        ThreadPool<Function<void()>> pool(4);
+        for (int i = 0; i < taskCount; i++) {
+            pool.execute([data, &total]() { total += data.size(); });
+        }
+        pool.joinAndStop();
+        return total.load();
+    };
+    BENCHMARK("ThreadPool<>, 10000 tasks capturing a vector") {
+        std::atomic<size_t> total = 0;
+        ThreadPool<> pool(4);
+        for (int i = 0; i < taskCount; i++) {
+            pool.execute([data, &total]() { total += data.size(); });
+        }
+        pool.joinAndStop();
+        return total.load();
+    };
+}
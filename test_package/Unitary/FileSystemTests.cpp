@@ -3,6 +3,17 @@
 #include <edoren/String.hpp>
 #include <edoren/system/FileSystem.hpp>
 
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#if PLATFORM_IS(PLATFORM_LINUX)
+    #include <sys/stat.h>
+#endif
+
 using namespace edoren;
 
 namespace {
@@ -15,6 +26,56 @@ String ABS_START = "/";
 String SEP = "/";
 #endif
 
+// File in the temporary directory that is removed when it goes out of scope. The names have a
+// random suffix for each run, so parallel test runs do not use the same files
+class TemporaryFile {
+public:
+    explicit TemporaryFile(const char* name)
+          : m_path(std::filesystem::temp_directory_path() / (std::string(name) + "." + GetRunId())) {}
+
+    TemporaryFile(const char* name, const std::string& bytes) : TemporaryFile(name) {
+        std::ofstream file(m_path, std::ios::binary);
+        file.write(bytes.data(), bytes.size());
+    }
+
+    TemporaryFile(const TemporaryFile&) = delete;
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+    ~TemporaryFile() {
+        std::error_code error;
+        std::filesystem::remove(m_path, error);
+    }
+
+    const std::filesystem::path& getNativePath() const {
+        return m_path;
+    }
+
+    String getPath() const {
+        return String(m_path.string().c_str());
+    }
+
+private:
+    static const std::string& GetRunId() {
+        static const std::string sRunId = std::to_string(std::random_device()());
+        return sRunId;
+    }
+
+    std::filesystem::path m_path;
+};
+
+// Encode an UTF-16 or UTF-32 string with the requested byte order
+template <typename CharT>
+std::string EncodeUnits(const std::basic_string<CharT>& str, bool bigEndian) {
+    std::string bytes;
+    for (CharT unit : str) {
+        for (size_t i = 0; i < sizeof(CharT); i++) {
+            size_t shift = bigEndian ? (sizeof(CharT) - 1 - i) * 8 : i * 8;
+            bytes.push_back(static_cast<char>((unit >> shift) & 0xFF));
+        }
+    }
+    return bytes;
+}
+
 }  // namespace
 
 TEST_CASE("FileSystem::IsAbsolutePath", "[FileSystem]") {
@@ -110,3 +171,165 @@ TEST_CASE("FileSystem::Join", "[FileSystem]") {
         REQUIRE(joined1 == joined2);
     }
 }
+
+TEST_CASE("FileSystem::DetectTextEncoding", "[FileSystem]") {
+    auto detect = [](const std::string& bytes, size_t* bomSize = nullptr) {
+        return filesystem::DetectTextEncoding(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size(), bomSize);
+    };
+
+    SECTION("must detect the encoding from the BOM") {
+        size_t bomSize = 0;
+        REQUIRE(detect("\xEF\xBB\xBFhello", &bomSize) == filesystem::TextEncoding::UTF_8);
+        REQUIRE(bomSize == 3);
+        REQUIRE(detect(std::string("\xFF\xFE\0\0", 4), &bomSize) == filesystem::TextEncoding::UTF_32LE);
+        REQUIRE(bomSize == 4);
+        REQUIRE(detect(std::string("\0\0\xFE\xFF", 4), &bomSize) == filesystem::TextEncoding::UTF_32BE);
+        REQUIRE(bomSize == 4);
+        REQUIRE(detect("\xFF\xFEh\0", &bomSize) == filesystem::TextEncoding::UTF_16LE);
+        REQUIRE(bomSize == 2);
+        REQUIRE(detect("\xFE\xFF\0h", &bomSize) == filesystem::TextEncoding::UTF_16BE);
+        REQUIRE(bomSize == 2);
+    }
+
+    SECTION("must detect the encoding of data without BOM") {
+        size_t bomSize = 1;
+        REQUIRE(detect("hello \xC3\xB1", &bomSize) == filesystem::TextEncoding::UTF_8);
+        REQUIRE(bomSize == 0);
+        REQUIRE(detect(EncodeUnits(std::u16string(u"hello \u00F1"), false)) == filesystem::TextEncoding::UTF_16LE);
+        REQUIRE(detect(EncodeUnits(std::u16string(u"hello \u00F1"), true)) == filesystem::TextEncoding::UTF_16BE);
+        REQUIRE(detect(EncodeUnits(std::u32string(U"hello \u00F1"), false)) == filesystem::TextEncoding::UTF_32LE);
+        REQUIRE(detect(EncodeUnits(std::u32string(U"hello \u00F1"), true)) == filesystem::TextEncoding::UTF_32BE);
+        REQUIRE(detect("hello \xF1") == filesystem::TextEncoding::WINDOWS_1252);
+    }
+
+    SECTION("must not detect UTF-16 or UTF-32 from a few zero bytes") {
+        REQUIRE(detect(std::string("hello\0", 6)) == filesystem::TextEncoding::UTF_8);
+        REQUIRE(detect(std::string("abc\0def\0", 8)) == filesystem::TextEncoding::UTF_8);
+    }
+
+    SECTION("must prefer UTF-16 over UTF-32 when both are valid") {
+        REQUIRE(detect(EncodeUnits(std::u16string(u"A\nB\n"), false)) == filesystem::TextEncoding::UTF_16LE);
+        REQUIRE(detect(EncodeUnits(std::u16string(u"A\nB\n"), true)) == filesystem::TextEncoding::UTF_16BE);
+    }
+}
+
+TEST_CASE("FileSystem::LoadTextFileData", "[FileSystem]") {
+    std::u32string text = U"Hello W\u00F6rld \u6C34\U0001F600 ";
+    std::string textUtf8 = "Hello W\xC3\xB6rld \xE6\xB0\xB4\xF0\x9F\x98\x80 ";
+    std::u16string text16 = u"Hello W\u00F6rld \u6C34\U0001F600 ";
+
+    // Repeat the text to need more than one block to load the files
+    std::string expected;
+    std::u16string repeated16;
+    std::u32string repeated32;
+    for (int i = 0; i < 2000; i++) {
+        expected += textUtf8;
+        repeated16 += text16;
+        repeated32 += text;
+    }
+
+    SECTION("must transcode the files to UTF-8") {
+        struct Case {
+            const char* name;
+            std::string bytes;
+            filesystem::TextEncoding encoding;
+        };
+        Case cases[] = {
+            {"edotools_text_utf8.txt", expected, filesystem::TextEncoding::UTF_8},
+            {"edotools_text_utf8_bom.txt", "\xEF\xBB\xBF" + expected, filesystem::TextEncoding::UTF_8},
+            {"edotools_text_utf16le.txt", EncodeUnits(repeated16, false), filesystem::TextEncoding::UTF_16LE},
+            {"edotools_text_utf16be.txt", "\xFE\xFF" + EncodeUnits(repeated16, true), filesystem::TextEncoding::UTF_16BE},
+            {"edotools_text_utf32le.txt", EncodeUnits(U"\uFEFF" + repeated32, false), filesystem::TextEncoding::UTF_32LE},
+            {"edotools_text_utf32be.txt", EncodeUnits(repeated32, true), filesystem::TextEncoding::UTF_32BE},
+        };
+        for (const Case& c : cases) {
+            TemporaryFile file(c.name, c.bytes);
+            String loaded;
+            filesystem::TextEncoding encoding = filesystem::TextEncoding::WINDOWS_1252;
+            REQUIRE(filesystem::LoadTextFileData(file.getPath(), loaded, &encoding) == true);
+            REQUIRE(encoding == c.encoding);
+            REQUIRE(loaded.toUtf8() == expected);
+        }
+    }
+
+    SECTION("must load as Windows-1252 when the data is not UTF-8") {
+        TemporaryFile file("edotools_text_cp1252.txt", "caf\xE9 \x80");
+        String loaded;
+        filesystem::TextEncoding encoding = filesystem::TextEncoding::UTF_8;
+        REQUIRE(filesystem::LoadTextFileData(file.getPath(), loaded, &encoding) == true);
+        REQUIRE(encoding == filesystem::TextEncoding::WINDOWS_1252);
+        REQUIRE(loaded == u8"caf\u00E9 \u20AC");
+    }
+
+    SECTION("must throw if the UTF-8 data is invalid after the inspected block") {
+        TemporaryFile file("edotools_text_invalid8.txt", expected + "caf\xE9");
+        String loaded;
+        REQUIRE_THROWS_AS(filesystem::LoadTextFileData(file.getPath(), loaded), std::runtime_error);
+    }
+
+    SECTION("must load the UTF-8 files with stray zero bytes as UTF-8") {
+        TemporaryFile file("edotools_text_utf8_nul.txt", std::string("abc\0def\0", 8));
+        String loaded;
+        filesystem::TextEncoding encoding = filesystem::TextEncoding::WINDOWS_1252;
+        REQUIRE(filesystem::LoadTextFileData(file.getPath(), loaded, &encoding) == true);
+        REQUIRE(encoding == filesystem::TextEncoding::UTF_8);
+        REQUIRE(loaded.toUtf8() == std::string("abc\0def\0", 8));
+    }
+
+    SECTION("must load the short UTF-16LE lines") {
+        TemporaryFile file("edotools_text_utf16le_lines.txt", EncodeUnits(std::u16string(u"A\nB\n"), false));
+        String loaded;
+        filesystem::TextEncoding encoding = filesystem::TextEncoding::UTF_8;
+        REQUIRE(filesystem::LoadTextFileData(file.getPath(), loaded, &encoding) == true);
+        REQUIRE(encoding == filesystem::TextEncoding::UTF_16LE);
+        REQUIRE(loaded == "A\nB\n");
+    }
+
+    SECTION("must throw if the UTF-16 data has a lone surrogate") {
+        TemporaryFile file("edotools_text_invalid16.txt", std::string("\xFF\xFEh\0\x00\xDC", 6));
+        String loaded;
+        REQUIRE_THROWS_AS(filesystem::LoadTextFileData(file.getPath(), loaded), std::runtime_error);
+    }
+
+    SECTION("must throw if the UTF-16 data has an odd length") {
+        TemporaryFile file("edotools_text_odd16.txt", std::string("\xFF\xFEh\0i", 5));
+        String loaded;
+        REQUIRE_THROWS_AS(filesystem::LoadTextFileData(file.getPath(), loaded), std::runtime_error);
+    }
+
+    SECTION("must return false if the file does not exist") {
+        String loaded;
+        REQUIRE(filesystem::LoadTextFileData(ABS_START + "edotools_missing_file.txt", loaded) == false);
+    }
+
+    SECTION("must return false if the path is a directory") {
+        String loaded;
+        String path(std::filesystem::temp_directory_path().string().c_str());
+        REQUIRE(filesystem::LoadTextFileData(path, loaded) == false);
+    }
+
+#if PLATFORM_IS(PLATFORM_LINUX)
+    SECTION("must read the files that do not report their size until the end") {
+        String loaded;
+        REQUIRE(filesystem::LoadTextFileData("/proc/self/status", loaded) == true);
+        REQUIRE(loaded.startsWith("Name:"));
+    }
+
+    SECTION("must read the pipes until the end") {
+        TemporaryFile fifo("edotools_text_fifo.txt");
+        REQUIRE(mkfifo(fifo.getNativePath().c_str(), 0600) == 0);
+        std::thread writer([&fifo, &repeated16]() {
+            std::ofstream file(fifo.getNativePath(), std::ios::binary);
+            std::string bytes = "\xFF\xFE" + EncodeUnits(repeated16, false);
+            file.write(bytes.data(), bytes.size());
+        });
+        String loaded;
+        filesystem::TextEncoding encoding = filesystem::TextEncoding::UTF_8;
+        bool result = filesystem::LoadTextFileData(fifo.getPath(), loaded, &encoding);
+        writer.join();
+        REQUIRE(result == true);
+        REQUIRE(encoding == filesystem::TextEncoding::UTF_16LE);
+        REQUIRE(loaded.toUtf8() == expected);
+    }
+#endif
+}
@@ -0,0 +1,129 @@
+#include <catch2/catch.hpp>
+
+#include <edoren/FixedString.hpp>
+#include <edoren/String.hpp>
+
+using namespace edoren;
+
+TEST_CASE("FixedString::FixedString", "[FixedString]") {
+    SECTION("can be constructed at compile time") {
+        constexpr FixedString<16> hello = "Hello";
+        static_assert(hello.getDataSize() == 5);
+        REQUIRE(hello == "Hello");
+        constexpr FixedString<16> appended = []() {
+            FixedString<16> result = "Hello";
+            result += " world";
+            return result;
+        }();
+        static_assert(appended.getDataSize() == 11);
+        constexpr FixedString<16> edited = []() {
+            FixedString<16> result = "Hello world";
+            result.insert(5, ",");
+            result.erase(0, 1);
+            return result;
+        }();
+        static_assert(edited == "ello, world");
+    }
+    SECTION("construct from UTF-8 strings") {
+        FixedString<16> elements = u8"\U00006C34\U0000706B\U00005730";  // "水火地"
+        REQUIRE(elements.getSize() == 3);
+        REQUIRE(elements.getDataSize() == 9);
+        REQUIRE(elements == u8"\U00006C34\U0000706B\U00005730");
+    }
+    SECTION("construct from numeric values") {
+        REQUIRE(FixedString<16>::FromValue(1234) == "1234");
+        REQUIRE(FixedString<16>::FromValue(-5) == "-5");
+        REQUIRE(FixedString<16>::FromValue(0.5) == "0.5");
+    }
+    SECTION("converts implicitly to StringView") {
+        FixedString<16> hello = "Hello";
+        StringView view = hello;
+        REQUIRE(view.getData() == hello.getData());
+        REQUIRE(String(view) == "Hello");
+        REQUIRE(hello.getView().getData() == hello.getData());
+        REQUIRE(hello.getView().getDataSize() == 5);
+    }
+}
+
+TEST_CASE("FixedString::operator+=", "[FixedString]") {
+    SECTION("appends any kind of characters") {
+        FixedString<16> str = "A";
+        str += 'B';
+        str += U'\U00006C34';  // "水"
+        str += "CD";
+        str += StringView("EF");
+        REQUIRE(str == u8"AB\U00006C34CDEF");
+        REQUIRE(str.getSize() == 7);
+    }
+    SECTION("throws when a single byte is not ASCII") {
+        FixedString<16> str = "A";
+        REQUIRE_THROWS_AS(str += static_cast<char>(0xE9), std::runtime_error);
+        REQUIRE(str == "A");
+    }
+    SECTION("truncates on a code point boundary when the capacity is exceeded") {
+        FixedString<8> str = "ABCDEF";
+        str += u8"\U00006C34";  // "水"
+        REQUIRE(str == "ABCDEF");
+        str += "GHI";
+        REQUIRE(str == "ABCDEFGH");
+        REQUIRE(str.getDataSize() == FixedString<8>::GetCapacity());
+    }
+    SECTION("throws when the capacity is exceeded with the THROW policy") {
+        FixedString<4, FixedStringOverflow::THROW> str = "ABC";
+        REQUIRE_THROWS_AS(str += "DE", std::length_error);
+        REQUIRE(str == "ABC");
+    }
+}
+
+TEST_CASE("FixedString::find", "[FixedString]") {
+    // "水、火、地、風、空"
+    FixedString<32> elements =
+        u8"\U00006C34\U00003001\U0000706B\U00003001\U00005730\U00003001\U000098A8\U00003001\U00007A7A";
+
+    SECTION("must be able to find any UTF-8 string") {
+        REQUIRE(elements.find(u8"\U00003001\U000098A8\U00003001") == 5);  // "、風、"
+        REQUIRE(elements.findFirstOf(u8"\U00005730") == 4);               // "地"
+        REQUIRE(elements.startsWith(u8"\U00006C34"));                     // "水"
+        REQUIRE(elements.endsWith(u8"\U00007A7A"));                       // "空"
+    }
+}
+
+TEST_CASE("FixedString modifiers", "[FixedString]") {
+    FixedString<16> str = u8"A\U00006C34BC";  // "A水BC"
+
+    SECTION("erase removes code points") {
+        str.erase(1, 2);
+        REQUIRE(str == "AC");
+    }
+    SECTION("insert adds code points at a given position") {
+        str.insert(1, "xy");
+        REQUIRE(str == u8"Axy\U00006C34BC");
+    }
+    SECTION("replace changes a range of code points") {
+        str.replace(1, 1, "long");
+        REQUIRE(str == "AlongBC");
+        str.replace(1, 4, "");
+        REQUIRE(str == "ABC");
+    }
+    SECTION("subString returns a part of the string") {
+        REQUIRE(str.subString(1, 2) == u8"\U00006C34B");
+    }
+    SECTION("insert accepts data from the same string") {
+        StringView view = str;
+        str.insert(0, view);
+        REQUIRE(str == u8"A\U00006C34BCA\U00006C34BC");
+    }
+}
+
+TEST_CASE("FixedString::operator==", "[FixedString]") {
+    FixedString<16> str = "Hello";
+
+    SECTION("compares with any kind of string") {
+        REQUIRE(str == "Hello");
+        REQUIRE(str != "Hell");
+        REQUIRE(str == StringView("Hello"));
+        REQUIRE(str == String("Hello"));
+        REQUIRE(str == FixedString<8>("Hello"));
+        REQUIRE((str <=> StringView("World")) == std::strong_ordering::less);
+    }
+}
@@ -26,6 +26,13 @@ TEST_CASE("String formatting", "[Formatting]") {
         String formatted = "{}-{}"_format(hello.subString(0, 5), 10);
         REQUIRE(formatted == "Hello-10");
     }
+    SECTION("formatTo appends to an existing String") {
+        String formatted = "> ";
+        formatTo(formatted, "{}-{}", hello.subString(0, 5), 10);
+        REQUIRE(formatted == "> Hello-10");
+        formatTo(formatted, "{}", String(u8"\U00006C34"));
+        REQUIRE(formatted == u8"> Hello-10\U00006C34");
+    }
 }
 
 TEST_CASE("Vector formatting", "[Formatting]") {
@@ -0,0 +1,64 @@
+#include <catch2/catch.hpp>
+
+#include <memory>
+
+#include <edoren/FunctionRef.hpp>
+
+using namespace edoren;
+
+namespace {
+
+int TestRawFunction(int value) {
+    return value * 2;
+}
+
+int CallTwice(FunctionRef<int(int)> fn, int value) {
+    return fn(fn(value));
+}
+
+}  // namespace
+
+TEST_CASE("FunctionRef::FunctionRef", "[FunctionRef]") {
+    SECTION("Constructor can receive lambda functions") {
+        int offset = 1;
+        REQUIRE(CallTwice([&offset](int value) { return value + offset; }, 1) == 3);
+    }
+    SECTION("Constructor can receive raw functions and function pointers") {
+        int (*pointer)(int) = &TestRawFunction;
+        REQUIRE(CallTwice(TestRawFunction, 1) == 4);
+        REQUIRE(CallTwice(pointer, 2) == 8);
+    }
+    SECTION("Should reference the callable instead of copying it") {
+        int calls = 0;
+        auto counter = [calls](int value) mutable {
+            calls++;
+            return calls + value;
+        };
+        FunctionRef<int(int)> fn(counter);
+        fn(0);
+        REQUIRE(fn(0) == 2);
+        REQUIRE(counter(0) == 3);
+    }
+    SECTION("Should be copyable and fit in two pointers") {
+        auto lambda = [](int value) { return value; };
+        FunctionRef<int(int)> fn(lambda);
+        FunctionRef<int(int)> fn_copy(fn);
+        REQUIRE(fn_copy(5) == 5);
+        REQUIRE(sizeof(FunctionRef<int(int)>) == 2 * sizeof(void*));
+    }
+}
+
+TEST_CASE("FunctionRef::operator()", "[FunctionRef]") {
+    SECTION("Should forward move-only arguments") {
+        auto lambda = [](std::unique_ptr<int> value) { return *value; };
+        FunctionRef<int(std::unique_ptr<int>)> fn(lambda);
+        REQUIRE(fn(std::make_unique<int>(3)) == 3);
+    }
+    SECTION("Should discard the result if the return type is void") {
+        int result = 0;
+        auto lambda = [&result]() { return ++result; };
+        FunctionRef<void()> fn(lambda);
+        fn();
+        REQUIRE(result == 1);
+    }
+}
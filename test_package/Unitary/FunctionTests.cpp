@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include <array>
+#include <memory>
 
 #include <edoren/Function.hpp>
 
@@ -12,6 +13,19 @@ int TestRawFunction() {
     return 2;
 }
 
+// Counts the copies done of the callable, the moves are not counted
+struct CopyCounter {
+    CopyCounter(int& copies) : copies(&copies) {}
+
+    CopyCounter(const CopyCounter& other) : copies(other.copies) {
+        (*copies)++;
+    }
+
+    CopyCounter(CopyCounter&& other) noexcept = default;
+
+    int* copies;
+};
+
 }  // namespace
 
 TEST_CASE("Function::Function", "[Function]") {
@@ -90,6 +104,32 @@ TEST_CASE("Function::operator=", "[Function]") {
         REQUIRE(fn_new() == 1);
         REQUIRE(fn_raw_new() == 2);
     }
+    SECTION("Move operations should not copy the underlying function") {
+        int copies = 0;
+        CopyCounter counter(copies);
+        Function<int()> fn([counter]() { return *counter.copies; });
+        copies = 0;
+        Function<int()> fn_new(std::move(fn));
+        Function<int()> fn_other;
+        fn_other = std::move(fn_new);
+        REQUIRE(copies == 0);
+        REQUIRE(fn_other() == 0);
+    }
+    SECTION("Move operations should accept empty functions") {
+        Function<int()> fn;
+        Function<int()> fn_new(std::move(fn));
+        Function<int()> fn_other([]() { return 1; });
+        fn_other = std::move(fn_new);
+        REQUIRE(!fn_new);
+        REQUIRE(!fn_other);
+    }
+    SECTION("Move assignment operator should release the previous function") {
+        auto value = std::make_shared<int>(1);
+        Function<int()> fn([value]() { return *value; });
+        fn = Function<int()>([]() { return 2; });
+        REQUIRE(value.use_count() == 1);
+        REQUIRE(fn() == 2);
+    }
     SECTION("nullptr assignment operator should delete the underlying function") {
         Function<int()> fn([]() { return 1; });
         fn = nullptr;
@@ -97,6 +137,70 @@ TEST_CASE("Function::operator=", "[Function]") {
     }
 }
 
+TEST_CASE("Function with trivial callables", "[Function]") {
+    SECTION("Copy and move should keep the captured values") {
+        int a = 1;
+        int b = 2;
+        Function<int()> fn([a, b]() { return a + b; });
+        Function<int()> fn_copy(fn);
+        Function<int()> fn_moved(std::move(fn));
+        Function<int()> fn_assigned;
+        fn_assigned = fn_copy;
+        REQUIRE(!fn);
+        REQUIRE(fn_copy() == 3);
+        REQUIRE(fn_moved() == 3);
+        REQUIRE(fn_assigned() == 3);
+    }
+    SECTION("nullptr assignment operator should empty the function") {
+        Function<int()> fn(&TestRawFunction);
+        REQUIRE(fn);
+        fn = nullptr;
+        REQUIRE(!fn);
+    }
+    SECTION("Swap should exchange trivial and non trivial callables") {
+        auto value = std::make_shared<int>(1);
+        Function<int()> fn([value]() { return *value; });
+        Function<int()> fn_raw(&TestRawFunction);
+        fn.swap(fn_raw);
+        REQUIRE(fn() == 2);
+        REQUIRE(fn_raw() == 1);
+    }
+}
+
+TEST_CASE("CompactFunction", "[Function]") {
+    SECTION("Should use the requested total size") {
+        REQUIRE(sizeof(CompactFunction<void()>) == 64);
+        REQUIRE(sizeof(CompactFunction<void(), 32>) == 32);
+        REQUIRE(CompactFunction<void(), 32>::sInlineCapacity == 32 - 2 * sizeof(void*));
+    }
+    SECTION("Should call the underlying function") {
+        int a = 4;
+        CompactFunction<int(int), 32> fn([a](int b) { return a * b; });
+        REQUIRE(fn(2) == 8);
+    }
+}
+
+TEST_CASE("Function::swap", "[Function]") {
+    SECTION("Should swap functions holding non trivial callables") {
+        auto value = std::make_shared<int>(1);
+        Function<int()> fn([value]() { return *value; });
+        Function<int()> fn_other([]() { return 2; });
+        fn.swap(fn_other);
+        REQUIRE(fn() == 2);
+        REQUIRE(fn_other() == 1);
+        REQUIRE(value.use_count() == 2);
+        fn_other = nullptr;
+        REQUIRE(value.use_count() == 1);
+    }
+    SECTION("Should swap with empty functions") {
+        Function<int()> fn([]() { return 1; });
+        Function<int()> fn_other;
+        fn.swap(fn_other);
+        REQUIRE(!fn);
+        REQUIRE(fn_other() == 1);
+    }
+}
+
 TEST_CASE("Function::operator()", "[Function]") {
     SECTION("Function-call operator should call the underlying function") {
         Function<int()> fn([]() { return 1; });
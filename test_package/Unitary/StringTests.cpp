@@ -44,6 +44,53 @@ TEST_CASE("String from other encodings", "[String]") {
     }
 }
 
+TEST_CASE("String::FromUtf8Unchecked", "[String]") {
+    std::string elements = reinterpret_cast<const char*>(u8"\U00006C34\U0000706B\U00005730");  // "水火地"
+
+    SECTION("from a pointer range") {
+        String a = String::FromUtf8Unchecked(elements.data(), elements.data() + elements.size());
+        REQUIRE(a == u8"\U00006C34\U0000706B\U00005730");
+        REQUIRE(a.getSize() == 3);
+    }
+    SECTION("from a moved std::string") {
+        String a = String::FromUtf8Unchecked(std::move(elements));
+        REQUIRE(a == u8"\U00006C34\U0000706B\U00005730");
+        REQUIRE(a.getSize() == 3);
+    }
+}
+
+TEST_CASE("String::FromLatin1", "[String]") {
+    std::string latin1 = "Ma\xF1" "ana en S\xE3o Paulo, 25\xB0 \x80";  // "Mañana en São Paulo, 25° \u0080"
+
+    SECTION("from a Latin-1 string") {
+        String a = String::FromLatin1(latin1.data(), latin1.data() + latin1.size());
+        REQUIRE(a == u8"Ma\u00F1ana en S\u00E3o Paulo, 25\u00B0 \u0080");
+        REQUIRE(a.toLatin1() == latin1);
+    }
+    SECTION("from a Windows-1252 string") {
+        String a = String::FromWindows1252(latin1.data(), latin1.data() + latin1.size());
+        REQUIRE(a == u8"Ma\u00F1ana en S\u00E3o Paulo, 25\u00B0 \u20AC");
+        REQUIRE(a.toWindows1252() == latin1);
+        REQUIRE(String::FromWindows1252(std::string("\x81\x9F")) == u8"\u0081\u0178");
+    }
+    SECTION("ASCII strings are moved") {
+        std::string ascii = "only ASCII characters in this string";
+        const char* buffer = ascii.data();
+        String a = String::FromLatin1(std::move(ascii));
+        REQUIRE(a == "only ASCII characters in this string");
+        REQUIRE(a.getData() == buffer);
+    }
+    SECTION("unrepresentable code points") {
+        String text = u8"\u00BFC\u00F3mo? \u20AC \U0001F600";
+        REQUIRE(text.toLatin1() == "\xBF" "C\xF3mo? ? ?");
+        REQUIRE(text.toWindows1252() == "\xBF" "C\xF3mo? \x80 ?");
+        REQUIRE_THROWS_AS(text.toLatin1(EncodingErrorPolicy::THROW), std::range_error);
+        REQUIRE_THROWS_AS(text.toWindows1252(EncodingErrorPolicy::THROW), std::range_error);
+        REQUIRE(String(u8"\u00BFC\u00F3mo? \u20AC").toWindows1252(EncodingErrorPolicy::THROW) ==
+                "\xBF" "C\xF3mo? \x80");
+    }
+}
+
 TEST_CASE("String to other encodings", "[String]") {
     String faces = u8"\U0001F600\U0001F603\U0001F604\U0001F601\U0001F606";     // "😀😃😄😁😆"
     String elements = u8"\U00006C34\U0000706B\U00005730\U000098A8\U00007A7A";  // "水火地風空"
@@ -70,6 +117,23 @@ TEST_CASE("String to other encodings", "[String]") {
         REQUIRE(facesUtf32 == U"\U0001F600\U0001F603\U0001F604\U0001F601\U0001F606");
         REQUIRE(elementsUtf32 == U"\U00006C34\U0000706B\U00005730\U000098A8\U00007A7A");
     }
+    SECTION("into an existing buffer") {
+        std::u16string utf16 = u"previous content";
+        elements.toUtf16Into(utf16);
+        REQUIRE(utf16 == u"\U00006C34\U0000706B\U00005730\U000098A8\U00007A7A");
+
+        std::u32string utf32;
+        utf32.reserve(64);
+        const char32_t* buffer = utf32.data();
+        faces.toUtf32Into(utf32);
+        elements.toUtf32Into(utf32);
+        REQUIRE(utf32 == U"\U00006C34\U0000706B\U00005730\U000098A8\U00007A7A");
+        REQUIRE(utf32.data() == buffer);
+
+        std::wstring wide = L"previous content";
+        faces.toWideInto(wide);
+        REQUIRE(wide == L"\U0001F600\U0001F603\U0001F604\U0001F601\U0001F606");
+    }
 }
 
 TEST_CASE("String::find", "[String]") {
@@ -339,7 +403,7 @@ TEST_CASE("String::subString", "[String]") {
         REQUIRE(elements.subString(4) == u8"\U00005730\U00003001\U000098A8\U00003001\U00007A7A");  // "😃😄😁"
     }
     SECTION("String::sInvalidPos") {
-        REQUIRE(faces.subString(5, String::sInvalidPos) == u8"\U0001F606");  // "😆"
+        REQUIRE(faces.subString(4, String::sInvalidPos) == u8"\U0001F606");  // "😆"
     }
 }
 
@@ -391,3 +455,91 @@ TEST_CASE("String::operator<=>", "[String]") {
         REQUIRE(ret == std::strong_ordering::equal);
     }
 }
+
+TEST_CASE("String::operator\"\"_s", "[String]") {
+    SECTION("creates a String from a validated literal") {
+        String str = "水、"_s;
+        REQUIRE(str.getSize() == 2);
+        REQUIRE(str == u8"水、");
+    }
+}
+
+TEST_CASE("String::eraseBytes", "[String]") {
+    // "水、火"
+    String elements = u8"\U00006C34\U00003001\U0000706B";
+
+    SECTION("erases the range of bytes") {
+        elements.eraseBytes(elements.findBytes(u8"\U00003001"), 3);
+        REQUIRE(elements == u8"\U00006C34\U0000706B");
+        elements.eraseBytes(3);
+        REQUIRE(elements == u8"\U00006C34");
+    }
+    SECTION("throws if the range is not at a code point boundary") {
+        REQUIRE_THROWS_AS(elements.eraseBytes(0, 1), std::invalid_argument);
+        REQUIRE(elements.getDataSize() == 9);
+    }
+}
+
+TEST_CASE("String::insertBytes", "[String]") {
+    String str = "Hello World";
+
+    SECTION("inserts at the given byte offset") {
+        str.insertBytes(5, ",");
+        REQUIRE(str == "Hello, World");
+        str.insertBytes(str.getDataSize(), u8"\U00006C34");
+        REQUIRE(str == u8"Hello, World\U00006C34");
+    }
+    SECTION("throws if the offset is not valid") {
+        REQUIRE_THROWS_AS(str.insertBytes(12, "!"), std::out_of_range);
+    }
+}
+
+TEST_CASE("String::replaceBytes", "[String]") {
+    String str = "Hello World";
+
+    SECTION("replaces the range of bytes") {
+        str.replaceBytes(str.findBytes("World"), 5, u8"\U00006C34");
+        REQUIRE(str == u8"Hello \U00006C34");
+        REQUIRE(str.subStringBytes(6) == u8"\U00006C34");
+        REQUIRE(str.subStringBytes(6).getDataSize() == 3);
+    }
+}
+
+TEST_CASE("String::toLower", "[String]") {
+    SECTION("converts ASCII strings") {
+        String str = "Hello World! 123 @[`{";
+        REQUIRE(str.toLower() == "hello world! 123 @[`{");
+        REQUIRE(str == "Hello World! 123 @[`{");
+    }
+    SECTION("converts non ASCII strings") {
+        String str = u8"ÀÉÎÕÜ ΑΒΓ АБВ Hello";
+        REQUIRE(str.toLower() == u8"àéîõü αβγ абв hello");
+    }
+    SECTION("applies mappings that change the size") {
+        String str = u8"\U00000130STANBUL";  // "İSTANBUL"
+        REQUIRE(str.toLower() == u8"i\U00000307stanbul");
+    }
+}
+
+TEST_CASE("String::toUpper", "[String]") {
+    SECTION("converts ASCII strings") {
+        String str = "Hello World! 123 @[`{";
+        REQUIRE(std::move(str).toUpper() == "HELLO WORLD! 123 @[`{");
+    }
+    SECTION("converts non ASCII strings") {
+        String str = u8"àéîõü αβγ абв hello";
+        REQUIRE(str.toUpper() == u8"ÀÉÎÕÜ ΑΒΓ АБВ HELLO");
+    }
+    SECTION("applies mappings that change the size") {
+        String str = u8"Straße ﬁnal";
+        REQUIRE(str.toUpper() == u8"STRASSE FINAL");
+    }
+}
+
+TEST_CASE("String::caseFold", "[String]") {
+    SECTION("strings that only differ in case are equal once folded") {
+        REQUIRE(String(u8"Straße").caseFold() == String("STRASSE").caseFold());
+        REQUIRE(String(u8"ΣΊΣΥΦΟΣ").caseFold() == String(u8"σίσυφος").caseFold());
+        REQUIRE(String(u8"µ").caseFold() == u8"μ");
+    }
+}
@@ -1,9 +1,27 @@
 #include <catch2/catch.hpp>
 
+#include <edoren/String.hpp>
 #include <edoren/StringView.hpp>
 
+#include <unordered_map>
+
 using namespace edoren;
 
+TEST_CASE("StringView::StringView", "[StringView]") {
+    const char invalid[] = {'A', static_cast<char>(0xC0), static_cast<char>(0x80), 'B'};
+
+    SECTION("construct from a pointer and size validates the data") {
+        StringView view("Hello World", 5);
+        REQUIRE(view == "Hello");
+        REQUIRE_THROWS(StringView(invalid, sizeof(invalid)));
+    }
+    SECTION("construct with utf::AssumeValid skips the validation") {
+        StringView view(invalid, sizeof(invalid), utf::AssumeValid);
+        REQUIRE(view.getData() == invalid);
+        REQUIRE(view.getDataSize() == sizeof(invalid));
+    }
+}
+
 TEST_CASE("StringView::find", "[StringView]") {
     // "水、火、地、風、空"
     StringView elements =
@@ -233,6 +251,138 @@ TEST_CASE("StringView::subString", "[StringView]") {
         REQUIRE(elements.subString(4) == u8"\U00005730\U00003001\U000098A8\U00003001\U00007A7A");  // "😃😄😁"
     }
     SECTION("StringView::sInvalidPos") {
-        REQUIRE(faces.subString(5, StringView::sInvalidPos) == u8"\U0001F606");  // "😆"
+        REQUIRE(faces.subString(4, StringView::sInvalidPos) == u8"\U0001F606");  // "😆"
+    }
+}
+
+TEST_CASE("StringView::getHash", "[StringView]") {
+    SECTION("equal strings have the same hash") {
+        StringView view("Hello World", 5);
+        REQUIRE(view.getHash() == StringView("Hello").getHash());
+        REQUIRE(view.getHash() != StringView("Hellp").getHash());
+        REQUIRE(std::hash<StringView>{}(view) == view.getHash());
+    }
+    SECTION("a string and its prefix are not equal") {
+        REQUIRE_FALSE(StringView("ab") == StringView("abc"));
+        REQUIRE_FALSE(StringView("abc") == StringView("ab"));
+        std::unordered_map<StringView, int> map = {{"ab", 1}, {"abc", 2}};
+        REQUIRE(map.size() == 2);
+        REQUIRE(map.at("ab") == 1);
+        REQUIRE(map.at("abc") == 2);
+    }
+    SECTION("the hash can be used to dispatch over string keys") {
+        auto dispatch = [](StringView key) {
+            switch (key.getHash()) {
+                case "width"_sv.getHash():
+                    return 1;
+                case "height"_sv.getHash():
+                    return 2;
+                default:
+                    return 0;
+            }
+        };
+        REQUIRE(dispatch("width") == 1);
+        REQUIRE(dispatch("height") == 2);
+        REQUIRE(dispatch("depth") == 0);
+    }
+}
+
+TEST_CASE("StringView::operator\"\"_sv", "[StringView]") {
+    SECTION("creates a view at compile time") {
+        constexpr StringView view = "水、"_sv;
+        static_assert(view.getDataSize() == 6);
+        static_assert(view.getSize() == 2);
+        REQUIRE(view == u8"水、");
+    }
+    SECTION("keeps embedded null characters") {
+        constexpr StringView view = "a\0b"_sv;
+        static_assert(view.getDataSize() == 3);
+    }
+}
+
+TEST_CASE("StringView::findBytes", "[StringView]") {
+    // "水、火、地"
+    StringView elements = u8"\U00006C34\U00003001\U0000706B\U00003001\U00005730";
+
+    SECTION("returns the byte offset of the string") {
+        REQUIRE(elements.findBytes(u8"\U0000706B") == 6);
+        REQUIRE(elements.findBytes(u8"\U00003001", 4) == 9);
+        REQUIRE(elements.findBytes(u8"A") == StringView::sInvalidPos);
+    }
+    SECTION("the offsets can be converted to code point indices") {
+        size_t offset = elements.findBytes(u8"\U00005730");
+        REQUIRE(elements.toCodePointIndex(offset) == 4);
+        REQUIRE(elements.toByteOffset(4) == offset);
+        REQUIRE(elements.toByteOffset(5) == elements.getDataSize());
+        REQUIRE(elements.toByteOffset(6) == StringView::sInvalidPos);
+        REQUIRE(elements.toCodePointIndex(elements.getDataSize() + 1) == StringView::sInvalidPos);
+    }
+}
+
+TEST_CASE("StringView::subStringBytes", "[StringView]") {
+    // "水、火"
+    StringView elements = u8"\U00006C34\U00003001\U0000706B";
+
+    SECTION("returns the range of bytes") {
+        REQUIRE(elements.subStringBytes(3, 3) == u8"\U00003001");
+        REQUIRE(elements.subStringBytes(3) == u8"\U00003001\U0000706B");
+        REQUIRE(elements.subStringBytes(3).getDataSize() == 6);
+        REQUIRE(elements.subStringBytes(9).isEmpty());
+    }
+    SECTION("throws if the range is invalid") {
+        REQUIRE_THROWS_AS(elements.subStringBytes(10), std::out_of_range);
+        REQUIRE_THROWS_AS(elements.subStringBytes(1), std::invalid_argument);
+        REQUIRE_THROWS_AS(elements.subStringBytes(0, 2), std::invalid_argument);
+    }
+}
+
+TEST_CASE("StringView::equalsIgnoreCase", "[StringView]") {
+    SECTION("compares ASCII strings ignoring the case") {
+        REQUIRE(StringView("Content-Type: Text/HTML").equalsIgnoreCase("content-type: text/html"));
+        REQUIRE_FALSE(StringView("Content-Type").equalsIgnoreCase("Content-Typo"));
+        REQUIRE_FALSE(StringView("Content-Type").equalsIgnoreCase("Content-Type2"));
+    }
+    SECTION("compares Unicode strings using case folding") {
+        REQUIRE(StringView(u8"STRASSE").equalsIgnoreCase(u8"straße"));
+        REQUIRE(StringView(u8"ΣΊΣΥΦΟΣ").equalsIgnoreCase(u8"σίσυφος"));
+        REQUIRE_FALSE(StringView(u8"ÀB").equalsIgnoreCase(u8"ab"));
+    }
+}
+
+TEST_CASE("StringView::compareIgnoreCase", "[StringView]") {
+    SECTION("orders the strings ignoring the case") {
+        REQUIRE(StringView("apple").compareIgnoreCase("BANANA") == std::strong_ordering::less);
+        REQUIRE(StringView("Banana").compareIgnoreCase("apple") == std::strong_ordering::greater);
+        REQUIRE(StringView("APPLE").compareIgnoreCase("apple") == std::strong_ordering::equal);
+        REQUIRE(StringView("apple").compareIgnoreCase("APPLES") == std::strong_ordering::less);
+    }
+}
+
+TEST_CASE("StringView::findIgnoreCase", "[StringView]") {
+    StringView text = u8"The quick brown FOX jumps over the Straße";
+
+    SECTION("returns the position of the string ignoring the case") {
+        REQUIRE(text.findIgnoreCase("fox") == 16);
+        REQUIRE(text.findIgnoreCase("THE", 1) == 31);
+        REQUIRE(text.findIgnoreCase("STRASSE") == 35);
+        REQUIRE(text.findIgnoreCase("cat") == StringView::sInvalidPos);
+    }
+    SECTION("a match can not end in the middle of a folded code point") {
+        REQUIRE(text.findIgnoreCase("strAs") == StringView::sInvalidPos);
+    }
+}
+
+TEST_CASE("IgnoreCaseHash", "[StringView]") {
+    SECTION("strings equal ignoring the case have the same hash") {
+        IgnoreCaseHash hash;
+        REQUIRE(hash("Content-Type: Text/HTML") == hash("content-type: text/html"));
+        REQUIRE(hash(u8"STRASSE") == hash(u8"straße"));
+        REQUIRE(hash("Content-Type") != hash("Content-Typo"));
+    }
+    SECTION("can be used in unordered containers") {
+        std::unordered_map<String, int, IgnoreCaseHash, IgnoreCaseEqual> headers;
+        headers["Content-Length"] = 10;
+        REQUIRE(headers.count("content-length") == 1);
+        REQUIRE(headers.find(StringView("CONTENT-LENGTH"))->second == 10);
     }
 }
@@ -9,6 +9,30 @@ TEST_CASE("Calling utf::GetEncodingSize", "[UTF]") {
         REQUIRE(utf::GetEncodingSize(utf::UTF_8) == 1);
         REQUIRE(utf::GetEncodingSize(utf::UTF_16) == 2);
         REQUIRE(utf::GetEncodingSize(utf::UTF_32) == 4);
+        REQUIRE(utf::GetEncodingSize(utf::LATIN_1) == 1);
+        REQUIRE(utf::GetEncodingSize(utf::WINDOWS_1252) == 1);
+    }
+}
+
+TEST_CASE("Calling utf::UtfToUtf with single byte encodings", "[UTF]") {
+    std::string latin1 = "\x41\xF1\x80";
+    std::u32string utf32;
+
+    SECTION("Should decode each byte as a code point") {
+        utf::UtfToUtf<utf::LATIN_1, utf::UTF_32>(latin1.begin(), latin1.end(), &utf32);
+        REQUIRE(utf32 == U"\u0041\u00F1\u0080");
+        utf32.clear();
+        utf::UtfToUtf<utf::WINDOWS_1252, utf::UTF_32>(latin1.begin(), latin1.end(), &utf32);
+        REQUIRE(utf32 == U"\u0041\u00F1\u20AC");
+    }
+    SECTION("Should replace the code points that can not be represented") {
+        std::u32string source = U"\u00F1\u20AC\U0001F600";
+        std::string output;
+        utf::UtfToUtf<utf::UTF_32, utf::LATIN_1>(source.begin(), source.end(), &output);
+        REQUIRE(output == "\xF1??");
+        output.clear();
+        utf::UtfToUtf<utf::UTF_32, utf::WINDOWS_1252>(source.begin(), source.end(), &output);
+        REQUIRE(output == "\xF1\x80?");
     }
 }
 
@@ -414,3 +438,63 @@ TEST_CASE("Calling utf::IsValid", "[UTF]") {
         REQUIRE(utf::IsValid<utf::UTF_16>(smiley16.begin(), smiley16.end()) == false);
     }
 }
+
+TEST_CASE("Calling utf::IsValidUtf16", "[UTF]") {
+    // Long enough to exercise the multi-unit scanning and the remaining tail
+    std::basic_string<char16_t> text = u"Lorem ipsum dolor sit amet \U0001F600 水火 consectetur \U0001F603!";
+
+    auto swapped = text;
+    for (auto& unit : swapped) {
+        unit = static_cast<char16_t>((unit >> 8) | (unit << 8));
+    }
+    const std::endian otherOrder = std::endian::native == std::endian::little ? std::endian::big : std::endian::little;
+
+    SECTION("Should validate the string in both byte orders") {
+        REQUIRE(utf::IsValidUtf16(text.begin(), text.end(), std::endian::native) == true);
+        REQUIRE(utf::IsValidUtf16(swapped.begin(), swapped.end(), otherOrder) == true);
+        REQUIRE(utf::IsValidUtf16(swapped.data(), swapped.data() + swapped.size(), otherOrder) == true);
+    }
+
+    SECTION("Should return false on lone or misplaced surrogates") {
+        for (size_t i = 0; i < text.size(); i++) {
+            if ((text[i] & 0xFC00) == 0xD800) {
+                auto loneLeading = text;
+                loneLeading[i + 1] = u'A';
+                auto loneTrailing = text;
+                loneTrailing[i] = u'A';
+                auto truncated = text.substr(0, i + 1);
+                REQUIRE(utf::IsValid<utf::UTF_16>(loneLeading.begin(), loneLeading.end()) == false);
+                REQUIRE(utf::IsValid<utf::UTF_16>(loneTrailing.begin(), loneTrailing.end()) == false);
+                REQUIRE(utf::IsValid<utf::UTF_16>(truncated.begin(), truncated.end()) == false);
+            }
+        }
+        std::basic_string<char16_t> reversed = u"abcd\xDC00\xD800";
+        REQUIRE(utf::IsValid<utf::UTF_16>(reversed.begin(), reversed.end()) == false);
+        REQUIRE(utf::GetSize<utf::UTF_16>(reversed.begin(), reversed.end()) == size_t(-1));
+    }
+
+    SECTION("Should not validate a string with the wrong byte order") {
+        // Swapped, the ASCII letters are valid code points but U+00D8 becomes a lone 0xD800
+        std::basic_string<char16_t> units = u"abcdef\u00D8h";
+        REQUIRE(utf::IsValidUtf16(units.begin(), units.end(), std::endian::native) == true);
+        REQUIRE(utf::IsValidUtf16(units.begin(), units.end(), otherOrder) == false);
+    }
+
+    SECTION("Should count the surrogate pairs") {
+        REQUIRE(utf::CountSurrogatePairs(text.begin(), text.end()) == 2);
+        REQUIRE(utf::CountSurrogatePairs(swapped.begin(), swapped.end(), otherOrder) == 2);
+        REQUIRE(utf::GetSize<utf::UTF_16>(text.begin(), text.end()) == text.size() - 2);
+    }
+
+    SECTION("Should work on constant evaluation") {
+        constexpr char16_t units[] = u"a\U0001F600b";
+        static_assert(utf::IsValid<utf::UTF_16>(units, units + 4));
+        static_assert(utf::CountSurrogatePairs(units, units + 4) == 1);
+        static_assert(utf::GetSize<utf::UTF_16>(units, units + 4) == 3);
+    }
+}
+
+TEST_CASE("Calling utf::Prior with a lone trailing surrogate", "[UTF]") {
+    std::basic_string<char16_t> units = u"\xDE00";
+    REQUIRE(utf::Prior<utf::UTF_16>(units.end(), units.begin()) == units.end());
+}
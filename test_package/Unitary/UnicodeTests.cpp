@@ -0,0 +1,215 @@
+#include <catch2/catch.hpp>
+
+#include <edoren/String.hpp>
+#include <edoren/Unicode.hpp>
+#include <edoren/container/Vector.hpp>
+
+using namespace edoren;
+
+TEST_CASE("unicode::ToLower", "[Unicode]") {
+    SECTION("maps single code points") {
+        REQUIRE(unicode::ToLower(U'A') == U'a');
+        REQUIRE(unicode::ToLower(U'\U00000410') == U'\U00000430');  // "А" -> "а"
+        REQUIRE(unicode::ToLower(U'1') == U'1');
+        REQUIRE(unicode::ToUpper(U'\U000000FF') == U'\U00000178');  // "ÿ" -> "Ÿ"
+        REQUIRE(unicode::FoldCase(U'\U000003C2') == U'\U000003C3');  // "ς" -> "σ"
+    }
+    SECTION("full mappings can expand to several code points") {
+        char32_t output[unicode::sMaxCaseMappingSize];
+        REQUIRE(unicode::MapCase(U'\U000000DF', unicode::CaseMapping::UPPER, output) == 2);  // "ß" -> "SS"
+        REQUIRE(output[0] == U'S');
+        REQUIRE(output[1] == U'S');
+    }
+}
+
+TEST_CASE("unicode::QuickCheck", "[Unicode]") {
+    using unicode::NormalizationForm;
+    using unicode::QuickCheckResult;
+
+    SECTION("ASCII strings are always normalized") {
+        REQUIRE(unicode::QuickCheck("Hello World", NormalizationForm::NFC) == QuickCheckResult::YES);
+        REQUIRE(unicode::QuickCheck("Hello World", NormalizationForm::NFKD) == QuickCheckResult::YES);
+    }
+    SECTION("detects strings that are not normalized") {
+        REQUIRE(unicode::QuickCheck(u8"\U000000E9", NormalizationForm::NFC) == QuickCheckResult::YES);
+        REQUIRE(unicode::QuickCheck(u8"\U000000E9", NormalizationForm::NFD) == QuickCheckResult::NO);
+        REQUIRE(unicode::QuickCheck(u8"e\U00000301", NormalizationForm::NFC) == QuickCheckResult::MAYBE);
+        REQUIRE(unicode::QuickCheck(u8"a\U00000301\U00000316", NormalizationForm::NFD) == QuickCheckResult::NO);
+    }
+}
+
+TEST_CASE("String::normalize", "[Unicode]") {
+    using unicode::NormalizationForm;
+
+    String composed = u8"Caf\U000000E9 \U0000D55C";              // "Café 한"
+    String decomposed = u8"Cafe\U00000301 \U00001112\U00001161\U000011AB";
+
+    SECTION("strings with a different composition are equal once normalized") {
+        REQUIRE(composed != decomposed);
+        REQUIRE(composed.normalize(NormalizationForm::NFC) == decomposed.normalize(NormalizationForm::NFC));
+        REQUIRE(composed.normalize(NormalizationForm::NFD) == decomposed);
+        REQUIRE(decomposed.normalize(NormalizationForm::NFC) == composed);
+    }
+    SECTION("combining marks are reordered by their combining class") {
+        String str = u8"a\U00000301\U00000316";  // acute (230) before grave below (220)
+        REQUIRE(str.normalize(NormalizationForm::NFD) == u8"a\U00000316\U00000301");
+        REQUIRE(str.normalize(NormalizationForm::NFC) == u8"\U000000E1\U00000316");
+    }
+    SECTION("compatibility forms replace compatibility characters") {
+        String str = u8"\U0000FB01 \U000000B2";  // "ﬁ ²"
+        REQUIRE(str.normalize(NormalizationForm::NFC) == str);
+        REQUIRE(str.normalize(NormalizationForm::NFKC) == "fi 2");
+        REQUIRE(String(u8"\U00001E9B\U00000323").normalize(NormalizationForm::NFKC) == u8"\U00001E69");
+    }
+    SECTION("normalized strings are returned unchanged") {
+        String str = composed + composed + composed;  // Avoid the small string optimization
+        const char* data = str.getData();
+        String normalized = std::move(str).normalize();
+        REQUIRE(normalized.getData() == data);
+    }
+    SECTION("isNormalized") {
+        REQUIRE(composed.isNormalized());
+        REQUIRE_FALSE(decomposed.isNormalized());
+        REQUIRE(decomposed.isNormalized(NormalizationForm::NFD));
+        REQUIRE_FALSE(String(u8"\U0000FB01").isNormalized(NormalizationForm::NFKC));
+        // The quick check can not decide these, they are normalized to compare them
+        REQUIRE(String(u8"x\U00000301").isNormalized());
+        REQUIRE_FALSE(String(u8"e\U00000301").isNormalized());
+    }
+}
+
+TEST_CASE("unicode::GraphemeIterator", "[Unicode]") {
+    SECTION("iterates over the grapheme clusters") {
+        // "é" (decomposed), flag of Spain, family emoji with ZWJ, "한" (jamo), CR LF
+        StringView text = u8"e\U00000301\U0001F1EA\U0001F1F8\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467"
+                          u8"\U00001112\U00001161\U000011AB\r\nab";
+        Vector<StringView> clusters;
+        for (StringView cluster : unicode::Graphemes(text)) {
+            clusters.push_back(cluster);
+        }
+        REQUIRE(clusters.size() == 7);
+        REQUIRE(clusters[0] == u8"e\U00000301");
+        REQUIRE(clusters[1] == u8"\U0001F1EA\U0001F1F8");
+        REQUIRE(clusters[2] == u8"\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467");
+        REQUIRE(clusters[3] == u8"\U00001112\U00001161\U000011AB");
+        REQUIRE(clusters[4] == "\r\n");
+        REQUIRE(clusters[5] == "a");
+        REQUIRE(clusters[6] == "b");
+    }
+    SECTION("regional indicators are paired") {
+        StringView flags = u8"\U0001F1EA\U0001F1F8\U0001F1EB";
+        REQUIRE(flags.countGraphemes() == 2);
+    }
+    SECTION("empty strings have no clusters") {
+        REQUIRE(StringView().countGraphemes() == 0);
+        REQUIRE(unicode::Graphemes(StringView()).empty());
+    }
+}
+
+TEST_CASE("String::truncateGraphemes", "[Unicode]") {
+    String text = u8"Cafe\U00000301 \U0001F1EA\U0001F1F8!";
+
+    SECTION("never cuts a grapheme cluster") {
+        REQUIRE(text.countGraphemes() == 7);
+        REQUIRE(text.truncateGraphemes(4) == u8"Cafe\U00000301");
+        REQUIRE(text.truncateGraphemes(6) == u8"Cafe\U00000301 \U0001F1EA\U0001F1F8");
+        REQUIRE(text.truncateGraphemes(4).getDataSize() == 6);
+        REQUIRE(text.truncateGraphemes(6).getDataSize() == 15);
+        REQUIRE(text.truncateGraphemes(100) == text);
+        REQUIRE(text.truncateGraphemes(0).isEmpty());
+    }
+}
+
+TEST_CASE("unicode::GetGeneralCategory", "[Unicode]") {
+    SECTION("classifies single code points") {
+        STATIC_REQUIRE(unicode::GetGeneralCategory(U'A') == unicode::GeneralCategory::UPPERCASE_LETTER);
+        STATIC_REQUIRE(unicode::IsSpace(U'\U00003000'));  // Ideographic space
+        REQUIRE(unicode::GetGeneralCategory(U'\U000003C9') == unicode::GeneralCategory::LOWERCASE_LETTER);  // "ω"
+        REQUIRE(unicode::GetGeneralCategory(U'\U00000301') == unicode::GeneralCategory::NONSPACING_MARK);
+        REQUIRE(unicode::GetGeneralCategory(U'\U0001F600') == unicode::GeneralCategory::OTHER_SYMBOL);
+        REQUIRE(unicode::GetGeneralCategory(U'\U000E0080') == unicode::GeneralCategory::UNASSIGNED);
+        REQUIRE(unicode::GetGeneralCategory(char32_t(0x110000)) == unicode::GeneralCategory::UNASSIGNED);
+        REQUIRE(unicode::GetEastAsianWidth(U'\U00004E2D') == unicode::EastAsianWidth::WIDE);  // "中"
+        REQUIRE(unicode::GetEastAsianWidth(U'\U0000FF21') == unicode::EastAsianWidth::FULLWIDTH);
+        REQUIRE(unicode::GetEastAsianWidth(U'a') == unicode::EastAsianWidth::NARROW);
+    }
+
+    SECTION("predicates follow the Unicode properties") {
+        REQUIRE(unicode::IsSpace(U'\U000000A0'));
+        REQUIRE_FALSE(unicode::IsSpace(U'\U0000200B'));  // Zero width space is not White_Space
+        REQUIRE(unicode::IsAlpha(U'\U00000416'));
+        REQUIRE_FALSE(unicode::IsAlpha(U'_'));
+        REQUIRE(unicode::IsDigit(U'\U00000663'));  // Arabic-indic three
+        REQUIRE_FALSE(unicode::IsDigit(U'\U000000B2'));
+        REQUIRE(unicode::IsAlphanumeric(U'7'));
+        REQUIRE(unicode::IsPunctuation(U'\U000000BF'));
+        REQUIRE_FALSE(unicode::IsPunctuation(U'+'));
+    }
+}
+
+TEST_CASE("unicode::FindFirstOfClass", "[Unicode]") {
+    StringView text = u8"identifier_with_ascii\U00003000\U00000394\U000003B5\U000003BB\U000003C4\U000003B1 42";
+
+    SECTION("returns byte offsets") {
+        REQUIRE(unicode::FindFirstOfClass(text, unicode::CharacterClass::SPACE) == 21);
+        REQUIRE(unicode::FindFirstOfClass(text, unicode::CharacterClass::DIGIT) == 35);
+        REQUIRE(unicode::FindFirstNotOfClass(text, unicode::CharacterClass::ALPHA) == 10);
+        REQUIRE(unicode::FindFirstNotOfClass(text, unicode::CharacterClass::SPACE, 21) == 24);
+        REQUIRE(unicode::FindFirstOfClass(text, unicode::CharacterClass::PUNCTUATION, 11) == 15);
+        REQUIRE(unicode::FindFirstOfClass(text, unicode::CharacterClass::PUNCTUATION, 16) == StringView::sInvalidPos);
+    }
+
+    SECTION("IsAllOfClass") {
+        REQUIRE(unicode::IsAllOfClass(u8"\U00000394\U000003B5\U000003BB\U000003C4\U000003B1xyz",
+                                      unicode::CharacterClass::ALPHA));
+        REQUIRE(unicode::IsAllOfClass("0123456789", unicode::CharacterClass::DIGIT));
+        REQUIRE_FALSE(unicode::IsAllOfClass("01234567a9", unicode::CharacterClass::DIGIT));
+        REQUIRE(unicode::IsAllOfClass("", unicode::CharacterClass::PUNCTUATION));
+    }
+}
+
+TEST_CASE("String::trim", "[Unicode]") {
+    String text = u8"\U00003000 \t hello world\U000000A0\n";
+
+    SECTION("removes all the Unicode white space") {
+        REQUIRE(text.trim() == "hello world");
+        REQUIRE(text.trimStart() == u8"hello world\U000000A0\n");
+        REQUIRE(text.trimEnd() == u8"\U00003000 \t hello world");
+        REQUIRE(text.trim().getDataSize() == 11);
+        REQUIRE(text.trimStart().getDataSize() == 14);
+        REQUIRE(text.trimEnd().getDataSize() == 17);
+        REQUIRE(StringView(" \t\n").trim().isEmpty());
+        REQUIRE(StringView().trim().isEmpty());
+    }
+}
+
+TEST_CASE("unicode::GetSortKey", "[Unicode]") {
+    auto collate = [](const StringView& left, const StringView& right,
+                      unicode::CollationStrength strength = unicode::CollationStrength::TERTIARY) {
+        return unicode::Collate(left, right, strength);
+    };
+
+    SECTION("orders by base letters first, then accents, then case") {
+        REQUIRE(collate("apple", "Banana") == std::strong_ordering::less);
+        REQUIRE(collate("role", u8"r\u00F4le") == std::strong_ordering::less);
+        REQUIRE(collate(u8"r\u00F4le", "rule") == std::strong_ordering::less);
+        REQUIRE(collate("a", "A") == std::strong_ordering::less);
+        REQUIRE(collate("a", "A", unicode::CollationStrength::SECONDARY) == std::strong_ordering::equal);
+        REQUIRE(collate("a", u8"\u00E1", unicode::CollationStrength::PRIMARY) == std::strong_ordering::equal);
+    }
+
+    SECTION("canonically equivalent strings have the same key") {
+        std::string composed;
+        std::string decomposed;
+        unicode::GetSortKey(u8"\u00C5ngstr\u00F6m", composed);
+        unicode::GetSortKey(u8"A\u030Angstro\u0308m", decomposed);
+        REQUIRE(composed == decomposed);
+    }
+
+    SECTION("contractions and implicit weights") {
+        // The Cyrillic short i is a contraction of "\u0438\u0306" that sorts after "\u0438"
+        REQUIRE(collate(u8"\u0439", u8"\u0438\u044F") == std::strong_ordering::greater);
+        REQUIRE(collate(u8"\u4E00", u8"\u4E8C") == std::strong_ordering::less);
+        REQUIRE(collate("z", u8"\u4E00") == std::strong_ordering::less);
+    }
+}
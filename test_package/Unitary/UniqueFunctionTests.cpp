@@ -0,0 +1,118 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <future>
+#include <memory>
+
+#include <edoren/UniqueFunction.hpp>
+
+using namespace edoren;
+
+namespace {
+
+int TestRawFunction() {
+    return 2;
+}
+
+}  // namespace
+
+TEST_CASE("UniqueFunction::UniqueFunction", "[UniqueFunction]") {
+    SECTION("Default constructor should create an empty function") {
+        UniqueFunction<int()> fn;
+        REQUIRE(!fn);
+    }
+    SECTION("nullptr constructor should create an empty function") {
+        UniqueFunction<int()> fn(nullptr);
+        REQUIRE(!fn);
+    }
+    SECTION("Constructor can receive lambda functions and raw function pointers") {
+        UniqueFunction<int()> fn([]() { return 1; });
+        UniqueFunction<int()> fn_raw(&TestRawFunction);
+        REQUIRE(fn() == 1);
+        REQUIRE(fn_raw() == 2);
+    }
+    SECTION("Constructor can receive move-only lambda functions") {
+        auto value = std::make_unique<int>(3);
+        UniqueFunction<int()> fn([value = std::move(value)]() { return *value; });
+        REQUIRE(fn() == 3);
+    }
+    SECTION("Constructor can receive lambda functions bigger than the internal buffer") {
+        std::array<int64_t, 100> values{};
+        values[0] = 10;
+        values[values.size() - 1] = 30;
+        UniqueFunction<int64_t(size_t)> fn([values](size_t i) { return values[i]; });
+        REQUIRE(fn(0) == 10);
+        REQUIRE(fn(values.size() - 1) == 30);
+    }
+    SECTION("Move constructor should move the underlying function") {
+        auto value = std::make_unique<int>(3);
+        std::array<int64_t, 100> values{};
+        values[50] = 20;
+        UniqueFunction<int()> fn([value = std::move(value)]() { return *value; });
+        UniqueFunction<int()> fn_big([values]() { return static_cast<int>(values[50]); });
+        UniqueFunction<int()> fn_empty;
+        UniqueFunction<int()> fn_new(std::move(fn));
+        UniqueFunction<int()> fn_big_new(std::move(fn_big));
+        UniqueFunction<int()> fn_empty_new(std::move(fn_empty));
+        REQUIRE(!fn);
+        REQUIRE(!fn_big);
+        REQUIRE(!fn_empty_new);
+        REQUIRE(fn_new() == 3);
+        REQUIRE(fn_big_new() == 20);
+    }
+    SECTION("Destructor should destroy the captured values") {
+        auto value = std::make_shared<int>(1);
+        std::array<int64_t, 100> values{};
+        {
+            UniqueFunction<void()> fn([value]() {});
+            UniqueFunction<void()> fn_big([value, values]() {});
+            REQUIRE(value.use_count() == 3);
+        }
+        REQUIRE(value.use_count() == 1);
+    }
+}
+
+TEST_CASE("UniqueFunction::operator=", "[UniqueFunction]") {
+    SECTION("Move assignment operator should release the previous function") {
+        auto value = std::make_shared<int>(1);
+        UniqueFunction<int()> fn([value]() { return *value; });
+        UniqueFunction<int()> fn_new([]() { return 2; });
+        fn = std::move(fn_new);
+        REQUIRE(value.use_count() == 1);
+        REQUIRE(!fn_new);
+        REQUIRE(fn() == 2);
+    }
+    SECTION("Assignment operator can receive lambda functions and nullptr") {
+        UniqueFunction<int()> fn;
+        fn = []() { return 1; };
+        REQUIRE(fn() == 1);
+        fn = nullptr;
+        REQUIRE(!fn);
+    }
+}
+
+TEST_CASE("UniqueFunction::swap", "[UniqueFunction]") {
+    std::array<int64_t, 100> values{};
+    values[0] = 10;
+    UniqueFunction<int()> fn([]() { return 1; });
+    UniqueFunction<int()> fn_big([values]() { return static_cast<int>(values[0]); });
+    fn.swap(fn_big);
+    REQUIRE(fn() == 10);
+    REQUIRE(fn_big() == 1);
+}
+
+TEST_CASE("UniqueFunction::operator()", "[UniqueFunction]") {
+    SECTION("Should be able to call mutable lambda functions") {
+        std::promise<int> promise;
+        std::future<int> future = promise.get_future();
+        UniqueFunction<void(int)> fn([promise = std::move(promise)](int value) mutable { promise.set_value(value); });
+        fn(5);
+        REQUIRE(future.get() == 5);
+    }
+    SECTION("Should forward the arguments") {
+        UniqueFunction<int(std::unique_ptr<int>, const int&)> fn(
+            [](std::unique_ptr<int> value, const int& other) { return *value + other; });
+        int other = 2;
+        REQUIRE(fn(std::make_unique<int>(1), other) == 3);
+    }
+}
@@ -2,6 +2,11 @@
 
 #include <edoren/String.hpp>
 #include <edoren/container/Vector.hpp>
+#include <edoren/threading/ThreadPool.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
 
 using namespace edoren;
 
@@ -46,6 +51,83 @@ TEST_CASE("Vector::filter", "[Vector]") {
     }
 }
 
+TEST_CASE("Vector::sortByKey", "[Vector]") {
+    Vector<String> names = {"zoe", u8"\u00C9mile", "Adam", "adam", "Zoe", "emile"};
+
+    SECTION("Sort using the collation order") {
+        names.sortByKey([](const String& name) { return name.getSortKey(); });
+        REQUIRE(names == Vector<String>{"adam", "Adam", "emile", u8"\u00C9mile", "zoe", "Zoe"});
+    }
+
+    SECTION("Elements with the same key keep their order") {
+        names.sortByKey([](const String& name) { return name.getSortKey(unicode::CollationStrength::PRIMARY); });
+        REQUIRE(names == Vector<String>{"Adam", "adam", u8"\u00C9mile", "emile", "zoe", "Zoe"});
+    }
+
+    SECTION("Sort using the code point order") {
+        names.sort();
+        REQUIRE(names == Vector<String>{"Adam", "Zoe", "adam", "emile", "zoe", u8"\u00C9mile"});
+    }
+}
+
+TEST_CASE("Vector parallel algorithms", "[Vector]") {
+    ThreadPool<> pool(4, SchedulingMode::WORK_STEALING);
+    Vector<size_t> numbers(100000);
+    std::iota(numbers.begin(), numbers.end(), 0);
+
+    SECTION("parallelMap should give the same result as map") {
+        auto square = [](const size_t& num) { return num * num; };
+        REQUIRE(numbers.parallelMap(pool, square) == numbers.map(square));
+        auto isOdd = [](const size_t& num) { return (num & 1) == 1; };
+        REQUIRE(numbers.parallelMap(pool, isOdd) == numbers.map(isOdd));
+    }
+    SECTION("parallelFilter should give the same result as filter") {
+        auto predicate = [](const size_t& num) { return num % 7 == 3; };
+        REQUIRE(numbers.parallelFilter(pool, predicate) == numbers.filter(predicate));
+        REQUIRE(numbers.parallelFilter(pool, [](const size_t&) { return false; }).empty());
+        REQUIRE(Vector<size_t>().parallelFilter(pool, predicate).empty());
+        // Vector<bool> packs the elements in words, so the output can't be written by chunks
+        Vector<bool> flags = numbers.map([](const size_t& num) { return num % 3 == 0; });
+        auto keep = [](bool flag) { return flag; };
+        REQUIRE(flags.parallelFilter(pool, keep) == flags.filter(keep));
+    }
+    SECTION("parallelForEach should visit every element once") {
+        numbers.parallelForEach(pool, [](size_t& num) { num *= 2; });
+        std::atomic<size_t> sum = 0;
+        numbers.parallelForEach(pool, [&sum](const size_t& num) { sum += num; });
+        REQUIRE(sum == 99999ull * 100000ull);
+    }
+    SECTION("parallelReduce should combine the elements in order") {
+        REQUIRE(numbers.parallelReduce(pool, size_t(5), [](size_t a, const size_t& b) { return a + b; }) ==
+                99999ull * 100000ull / 2 + 5);
+        Vector<String> words(20000, "a");
+        words.back() = "b";
+        String joined = words.parallelReduce(pool, String(), [](String a, const String& b) { return a + b; });
+        REQUIRE(joined.getDataSize() == 20000);
+        REQUIRE(joined.endsWith("ab"));
+    }
+    SECTION("parallelFind should return the first matching element") {
+        size_t* found = numbers.parallelFind(pool, [](const size_t& num) { return num > 50000 && num % 1000 == 0; });
+        REQUIRE(found == &numbers[51000]);
+        const Vector<size_t>& constNumbers = numbers;
+        REQUIRE(constNumbers.parallelFind(pool, [](const size_t& num) { return num == 100000; }) == nullptr);
+    }
+    SECTION("ParallelFor should rethrow the exceptions in the calling thread") {
+        auto body = [](size_t begin, size_t) {
+            if (begin > 0) {
+                throw std::runtime_error("error");
+            }
+        };
+        REQUIRE_THROWS_AS(ParallelFor(pool, 100000, 1000, body), std::runtime_error);
+    }
+    SECTION("The algorithms should work from a task running in the same pool") {
+        Future<size_t> result = pool.submit([&pool, &numbers]() {
+            return numbers.parallelReduce(pool, size_t(0), [](size_t a, const size_t& b) { return a + b; });
+        });
+        REQUIRE(result.get() == 99999ull * 100000ull / 2);
+    }
+}
+
 // TEST_CASE("Vector::filterIndexed", "[Vector]") {}
 // TEST_CASE("Vector::find", "[Vector]") {}
 // TEST_CASE("Vector::forEach", "[Vector]") {}
@@ -0,0 +1,85 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include <edoren/threading/CpuTopology.hpp>
+#include <edoren/threading/ThreadPool.hpp>
+#include <edoren/util/Platform.hpp>
+
+using namespace edoren;
+
+TEST_CASE("ParseCpuList", "[CpuTopology]") {
+    SECTION("Should parse single CPUs and ranges") {
+        REQUIRE(ParseCpuList("0-3,8,10-11\n") == Vector<uint32_t>{0, 1, 2, 3, 8, 10, 11});
+        REQUIRE(ParseCpuList("5") == Vector<uint32_t>{5});
+        REQUIRE(ParseCpuList("") == Vector<uint32_t>{});
+    }
+    SECTION("Should reject invalid lists") {
+        REQUIRE(ParseCpuList("1-").empty());
+        REQUIRE(ParseCpuList("3-1").empty());
+        REQUIRE(ParseCpuList("a,b").empty());
+        REQUIRE(ParseCpuList("1;2").empty());
+    }
+    SECTION("Should reject the CPUs out of the supported range") {
+        REQUIRE(ParseCpuList("1023") == Vector<uint32_t>{MAX_CPU_COUNT - 1});
+        REQUIRE(ParseCpuList("1024").empty());
+        REQUIRE(ParseCpuList("0-1024").empty());
+        REQUIRE(ParseCpuList("0-4294967295").empty());
+        REQUIRE(ParseCpuList("99999999999999999999").empty());
+    }
+}
+
+TEST_CASE("GetNumaNodes", "[CpuTopology]") {
+    Vector<NumaNode> nodes = GetNumaNodes();
+    REQUIRE_FALSE(nodes.empty());
+    for (const NumaNode& node : nodes) {
+        REQUIRE_FALSE(node.cpus.empty());
+    }
+}
+
+#if PLATFORM_IS(PLATFORM_LINUX)
+TEST_CASE("SetCurrentThreadAffinity", "[CpuTopology]") {
+    const uint32_t cpu = GetNumaNodes().back().cpus.back();
+    bool pinned = false;
+    int32_t current = -1;
+    std::thread thread([&]() {
+        pinned = SetCurrentThreadAffinity(cpu);
+        current = GetCurrentCpu();
+    });
+    thread.join();
+    REQUIRE(pinned);
+    REQUIRE(current == static_cast<int32_t>(cpu));
+}
+#endif
+
+TEST_CASE("ThreadPool with pinned workers", "[CpuTopology]") {
+    SECTION("Should run all the tasks and subtasks") {
+        std::atomic<int> counter = 0;
+        ThreadPool<> pool(4, SchedulingMode::WORK_STEALING, QueueBackend::MUTEX, 1024, WorkerAffinity::PIN_TO_CORES);
+        for (int i = 0; i < 100; i++) {
+            pool.execute([&pool, &counter]() {
+                pool.execute([&counter]() { counter++; });
+                counter++;
+            });
+        }
+        pool.joinAndStop();
+        REQUIRE(counter == 200);
+    }
+    SECTION("Should run the tasks in the pinned CPUs") {
+        Vector<uint32_t> allowed;
+        for (const NumaNode& node : GetNumaNodes()) {
+            allowed.insert(allowed.end(), node.cpus.begin(), node.cpus.end());
+        }
+        ThreadPool<> pool(2, SchedulingMode::SHARED_QUEUE, QueueBackend::LOCK_FREE, 64, WorkerAffinity::PIN_TO_CORES);
+        Future<int32_t> cpu = pool.submit([]() { return GetCurrentCpu(); });
+        const int32_t result = cpu.get();
+        pool.joinAndStop();
+#if PLATFORM_IS(PLATFORM_LINUX)
+        REQUIRE(std::find(allowed.begin(), allowed.end(), static_cast<uint32_t>(result)) != allowed.end());
+#else
+        REQUIRE(result == -1);
+#endif
+    }
+}
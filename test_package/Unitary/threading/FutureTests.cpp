@@ -0,0 +1,178 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <edoren/threading/Future.hpp>
+#include <edoren/threading/ThreadPool.hpp>
+
+using namespace edoren;
+
+TEST_CASE("Promise and Future", "[Future]") {
+    SECTION("Should receive the value set in the promise") {
+        Promise<int> promise;
+        Future<int> future = promise.getFuture();
+        REQUIRE(future.isValid());
+        REQUIRE_FALSE(future.isReady());
+        promise.setValue(5);
+        REQUIRE(future.isReady());
+        REQUIRE(future.get() == 5);
+        REQUIRE_FALSE(future.isValid());
+    }
+    SECTION("Should support move-only and void results") {
+        Promise<std::unique_ptr<int>> promise;
+        Future<std::unique_ptr<int>> future = promise.getFuture();
+        promise.setValue(std::make_unique<int>(3));
+        REQUIRE(*future.get() == 3);
+
+        Promise<void> voidPromise;
+        Future<void> voidFuture = voidPromise.getFuture();
+        voidPromise.setValue();
+        REQUIRE(voidFuture.isReady());
+        voidFuture.get();
+    }
+    SECTION("Should rethrow the exception set in the promise") {
+        Promise<int> promise;
+        Future<int> future = promise.getFuture();
+        promise.setException(std::make_exception_ptr(std::runtime_error("error")));
+        REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+    }
+    SECTION("Should report a broken promise") {
+        Future<int> future;
+        {
+            Promise<int> promise;
+            future = promise.getFuture();
+        }
+        REQUIRE(future.isReady());
+        REQUIRE_THROWS_AS(future.get(), std::future_error);
+    }
+    SECTION("Should wait for a value set from another thread") {
+        Promise<int> promise;
+        Future<int> future = promise.getFuture();
+        std::thread thread([&promise]() { promise.setValue(11); });
+        future.wait();
+        REQUIRE(future.get() == 11);
+        thread.join();
+    }
+}
+
+TEST_CASE("Future::then", "[Future]") {
+    SECTION("Should run the continuation when the value is set") {
+        Promise<int> promise;
+        bool called = false;
+        Future<int> future = promise.getFuture().then([&called](int value) {
+            called = true;
+            return value * 2;
+        });
+        REQUIRE_FALSE(called);
+        promise.setValue(21);
+        REQUIRE(called);
+        REQUIRE(future.get() == 42);
+    }
+    SECTION("Should run the continuation immediately if the value is already set") {
+        Promise<int> promise;
+        promise.setValue(1);
+        Future<void> future = promise.getFuture().then([](int) {});
+        REQUIRE(future.isReady());
+        Future<int> chained = std::move(future).then([]() { return 2; }).then([](int value) { return value + 1; });
+        REQUIRE(chained.get() == 3);
+    }
+    SECTION("Should skip the continuation and forward the exception") {
+        Promise<int> promise;
+        bool called = false;
+        Future<int> future = promise.getFuture().then([&called](int value) {
+            called = true;
+            return value;
+        });
+        promise.setException(std::make_exception_ptr(std::runtime_error("error")));
+        REQUIRE_FALSE(called);
+        REQUIRE_THROWS_AS(future.get(), std::runtime_error);
+    }
+    SECTION("Should capture the exception thrown by the continuation") {
+        Promise<void> promise;
+        Future<int> future = promise.getFuture().then([]() -> int { throw std::logic_error("error"); });
+        promise.setValue();
+        REQUIRE_THROWS_AS(future.get(), std::logic_error);
+    }
+}
+
+TEST_CASE("WhenAll and WhenAny", "[Future]") {
+    SECTION("WhenAll should combine the results in order") {
+        Vector<Promise<int>> promises(3);
+        Vector<Future<int>> futures;
+        for (auto& promise : promises) {
+            futures.push_back(promise.getFuture());
+        }
+        Future<Vector<int>> all = WhenAll(std::move(futures));
+        promises[2].setValue(3);
+        promises[0].setValue(1);
+        REQUIRE_FALSE(all.isReady());
+        promises[1].setValue(2);
+        REQUIRE(all.isReady());
+        REQUIRE(all.get() == Vector<int>{1, 2, 3});
+    }
+    SECTION("WhenAll should forward the exception") {
+        Vector<Promise<void>> promises(2);
+        Vector<Future<void>> futures;
+        for (auto& promise : promises) {
+            futures.push_back(promise.getFuture());
+        }
+        Future<void> all = WhenAll(std::move(futures));
+        promises[0].setException(std::make_exception_ptr(std::runtime_error("error")));
+        promises[1].setValue();
+        REQUIRE_THROWS_AS(all.get(), std::runtime_error);
+    }
+    SECTION("WhenAll should be ready for an empty input") {
+        REQUIRE(WhenAll(Vector<Future<int>>()).get().empty());
+    }
+    SECTION("WhenAny should receive the first result") {
+        Vector<Promise<int>> promises(3);
+        Vector<Future<int>> futures;
+        for (auto& promise : promises) {
+            futures.push_back(promise.getFuture());
+        }
+        Future<WhenAnyResult<int>> any = WhenAny(std::move(futures));
+        REQUIRE_FALSE(any.isReady());
+        promises[1].setValue(20);
+        promises[0].setValue(10);
+        WhenAnyResult<int> result = any.get();
+        REQUIRE(result.index == 1);
+        REQUIRE(result.value == 20);
+    }
+}
+
+TEST_CASE("ThreadPool::submit", "[Future]") {
+    SECTION("Should return the result of the callable") {
+        ThreadPool<> pool(2);
+        Future<int> future = pool.submit([]() { return 6 * 7; });
+        REQUIRE(future.get() == 42);
+        pool.joinAndStop();
+    }
+    SECTION("Should fan-out and fan-in without blocking the workers") {
+        ThreadPool<> pool(4, SchedulingMode::WORK_STEALING);
+        Vector<Future<int>> futures;
+        for (int i = 1; i <= 100; i++) {
+            futures.push_back(pool.submit([i]() { return i; }));
+        }
+        Future<int> sum = WhenAll(std::move(futures)).then([](Vector<int> values) {
+            int total = 0;
+            for (int value : values) {
+                total += value;
+            }
+            return total;
+        });
+        REQUIRE(sum.get() == 5050);
+        pool.joinAndStop();
+    }
+    SECTION("Should forward the exceptions and report the discarded tasks") {
+        ThreadPool<> pool(2);
+        Future<void> failed = pool.submit([]() { throw std::runtime_error("error"); });
+        REQUIRE_THROWS_AS(failed.get(), std::runtime_error);
+        pool.joinAndStop();
+        Future<int> discarded = pool.submit([]() { return 1; });
+        REQUIRE_THROWS_AS(discarded.get(), std::future_error);
+    }
+}
@@ -0,0 +1,452 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <edoren/threading/BoundedMPMCQueue.hpp>
+#include <edoren/threading/ThreadPool.hpp>
+#include <edoren/threading/WorkStealingDeque.hpp>
+
+using namespace edoren;
+
+TEST_CASE("ThreadPool::execute", "[ThreadPool]") {
+    SECTION("Should run all the tasks before joining") {
+        std::atomic<int> counter = 0;
+        ThreadPool<> pool(4);
+        for (int i = 0; i < 100; i++) {
+            pool.execute([&counter]() { counter++; });
+        }
+        pool.joinAndStop();
+        REQUIRE(counter == 100);
+    }
+    SECTION("Should run tasks that wait for each other in different workers") {
+        using namespace std::chrono_literals;
+        for (int round = 0; round < 20; round++) {
+            std::atomic<int> started = 0;
+            std::atomic<int> met = 0;
+            ThreadPool<> pool(2);
+            for (int i = 0; i < 2; i++) {
+                pool.execute([&started, &met]() {
+                    started++;
+                    const auto deadline = std::chrono::steady_clock::now() + 1s;
+                    while (started < 2 && std::chrono::steady_clock::now() < deadline) {
+                        std::this_thread::sleep_for(1ms);
+                    }
+                    met += started == 2 ? 1 : 0;
+                });
+            }
+            pool.joinAndStop();
+            REQUIRE(met == 2);
+        }
+    }
+    SECTION("Should accept move-only tasks") {
+        ThreadPool<> pool(2);
+        std::promise<int> promise;
+        std::future<int> future = promise.get_future();
+        auto value = std::make_unique<int>(7);
+        pool.execute([promise = std::move(promise), value = std::move(value)]() mutable { promise.set_value(*value); });
+        REQUIRE(future.get() == 7);
+        pool.joinAndStop();
+    }
+}
+
+TEST_CASE("ThreadPool work stealing", "[ThreadPool]") {
+    SECTION("Should run all the tasks before joining") {
+        std::atomic<int> counter = 0;
+        ThreadPool<> pool(4, SchedulingMode::WORK_STEALING);
+        for (int i = 0; i < 1000; i++) {
+            pool.execute([&counter]() { counter++; });
+        }
+        pool.joinAndStop();
+        REQUIRE(counter == 1000);
+    }
+    SECTION("Should run the subtasks created from the workers") {
+        std::atomic<int> counter = 0;
+        ThreadPool<> pool(4, SchedulingMode::WORK_STEALING);
+        for (int i = 0; i < 10; i++) {
+            pool.execute([&pool, &counter]() {
+                for (int j = 0; j < 100; j++) {
+                    pool.execute([&pool, &counter]() {
+                        pool.execute([&counter]() { counter++; });
+                        counter++;
+                    });
+                }
+            });
+        }
+        pool.joinAndStop();
+        REQUIRE(counter == 2000);
+    }
+    SECTION("Should release the subtasks whether they run or are discarded") {
+        auto resource = std::make_shared<int>(0);
+        std::promise<void> pushed;
+        {
+            ThreadPool<> pool(2, SchedulingMode::WORK_STEALING);
+            pool.execute([&pool, &pushed, resource]() {
+                for (int i = 0; i < 500; i++) {
+                    pool.execute([resource]() {});
+                }
+                pushed.set_value();
+            });
+            pushed.get_future().wait();
+        }
+        REQUIRE(resource.use_count() == 1);
+    }
+    SECTION("Should not run anything after being stopped") {
+        std::atomic<int> counter = 0;
+        ThreadPool<> pool(2, SchedulingMode::WORK_STEALING);
+        pool.joinAndStop();
+        pool.execute([&counter]() { counter++; });
+        REQUIRE(counter == 0);
+    }
+}
+
+TEST_CASE("ThreadPool::executeBatch", "[ThreadPool]") {
+    SECTION("Should run all the tasks of the batch") {
+        std::atomic<int> counter = 0;
+        ThreadPool<> pool(4);
+        std::vector<ThreadPool<>::Task> tasks;
+        for (int i = 0; i < 100; i++) {
+            tasks.emplace_back([&counter]() { counter++; });
+        }
+        pool.executeBatch(tasks);
+        pool.joinAndStop();
+        REQUIRE(counter == 100);
+    }
+    SECTION("Should overflow the lock-free queue without losing tasks") {
+        std::atomic<int> counter = 0;
+        ThreadPool<> pool(4, SchedulingMode::SHARED_QUEUE, QueueBackend::LOCK_FREE, 8);
+        for (int i = 0; i < 10; i++) {
+            std::vector<ThreadPool<>::Task> tasks;
+            for (int j = 0; j < 50; j++) {
+                tasks.emplace_back([&counter]() { counter++; });
+            }
+            pool.executeBatch(tasks);
+            pool.execute([&counter]() { counter++; });
+        }
+        pool.joinAndStop();
+        REQUIRE(counter == 510);
+    }
+    SECTION("Should run the overflowed tasks while the lock-free queue is kept full") {
+        // Each task queues itself again until the last overflowed task runs, so the ring never empties
+        struct Requeue {
+            ThreadPool<>* pool;
+            std::atomic<bool>* done;
+            std::atomic<int>* budget;
+
+            void operator()() const {
+                if (!*done && budget->fetch_sub(1) > 0) {
+                    pool->execute(Requeue(*this));
+                }
+            }
+        };
+
+        std::atomic<bool> done = false;
+        std::atomic<int> budget = 100000;
+        std::promise<void> started;
+        std::promise<void> opened;
+        std::shared_future<void> openedFuture = opened.get_future().share();
+        ThreadPool<> pool(1, SchedulingMode::SHARED_QUEUE, QueueBackend::LOCK_FREE, 32);
+        pool.execute([&started, openedFuture]() {
+            started.set_value();
+            openedFuture.wait();
+        });
+        started.get_future().wait();
+        for (int i = 0; i < 40; i++) {
+            pool.execute(Requeue{&pool, &done, &budget});
+        }
+        pool.execute([&done]() { done = true; });
+        opened.set_value();
+        pool.joinAndStop();
+        REQUIRE(done);
+        REQUIRE(budget > 0);
+    }
+    SECTION("Should work with the lock-free queue and work stealing") {
+        std::atomic<int> counter = 0;
+        ThreadPool<> pool(4, SchedulingMode::WORK_STEALING, QueueBackend::LOCK_FREE);
+        for (int i = 0; i < 10; i++) {
+            pool.execute([&pool, &counter]() {
+                std::vector<ThreadPool<>::Task> tasks;
+                for (int j = 0; j < 100; j++) {
+                    tasks.emplace_back([&counter]() { counter++; });
+                }
+                pool.executeBatch(tasks);
+            });
+        }
+        pool.joinAndStop();
+        REQUIRE(counter == 1000);
+    }
+}
+
+TEST_CASE("ThreadPool priorities", "[ThreadPool]") {
+    using namespace std::chrono_literals;
+
+    // Keeps the only worker busy until the tasks to order are queued
+    struct Gate {
+        std::atomic<bool> started = false;
+        std::atomic<bool> opened = false;
+
+        void block(ThreadPool<>& pool) {
+            pool.execute([this]() {
+                started = true;
+                started.notify_all();
+                opened.wait(false);
+            });
+            started.wait(false);
+        }
+
+        void open() {
+            opened = true;
+            opened.notify_all();
+        }
+    };
+
+    std::mutex mutex;
+    std::vector<int> order;
+    auto record = [&mutex, &order](int id) {
+        return [&mutex, &order, id]() {
+            std::lock_guard<std::mutex> lk(mutex);
+            order.push_back(id);
+        };
+    };
+
+    SECTION("Should run the tasks by priority class and deadline") {
+        ThreadPool<> pool(1);
+        Gate gate;
+        gate.block(pool);
+        const auto now = std::chrono::steady_clock::now();
+        pool.execute(record(6), TaskPriority::LOW);
+        pool.execute(record(5));
+        pool.execute(record(3), TaskPriority::NORMAL, now + 10s);
+        pool.execute(record(2), TaskPriority::HIGH);
+        pool.execute(record(1), TaskPriority::HIGH, now + 20s);
+        pool.execute(record(0), TaskPriority::HIGH, now + 10s);
+        pool.execute(record(4), TaskPriority::NORMAL, now + 20s);
+        gate.open();
+        pool.joinAndStop();
+        REQUIRE(order == std::vector<int>{0, 1, 2, 3, 4, 5, 6});
+    }
+    SECTION("Should run the high priority tasks before the batch taken by the worker") {
+        ThreadPool<> pool(1);
+        Gate gate;
+        gate.block(pool);
+        pool.execute([&pool, &record]() {
+            record(0)();
+            pool.execute(record(10), TaskPriority::HIGH);
+        });
+        for (int i = 1; i < 4; i++) {
+            pool.execute(record(i));
+        }
+        gate.open();
+        pool.joinAndStop();
+        REQUIRE(order == std::vector<int>{0, 10, 1, 2, 3});
+    }
+    SECTION("Should promote the tasks that wait too long") {
+        ThreadPool<> pool(1);
+        pool.setAgingInterval(10ms);
+        Gate gate;
+        gate.block(pool);
+        pool.execute(record(0), TaskPriority::LOW);
+        std::this_thread::sleep_for(50ms);
+        // The promoted task is older than the tasks of its new class, so it goes first. The task without
+        // priority can also be promoted while the others run, so only the order of the first two is fixed
+        pool.execute(record(1), TaskPriority::HIGH);
+        pool.execute(record(2));
+        gate.open();
+        pool.joinAndStop();
+        REQUIRE(order.size() == 3);
+        REQUIRE(std::find(order.begin(), order.end(), 0) < std::find(order.begin(), order.end(), 1));
+        REQUIRE(std::find(order.begin(), order.end(), 2) != order.end());
+    }
+    SECTION("Should run the low and normal tasks during a flood of high priority tasks") {
+        // Each high priority task queues another one until the other tasks run
+        struct Flood {
+            ThreadPool<>* pool;
+            std::atomic<int>* pending;
+            std::atomic<int>* budget;
+
+            void operator()() const {
+                if (*pending > 0 && budget->fetch_sub(1) > 0) {
+                    pool->execute(Flood(*this), TaskPriority::HIGH);
+                }
+            }
+        };
+
+        std::atomic<int> pending = 2;
+        std::atomic<int> budget = 100000;
+        ThreadPool<> pool(1);
+        pool.setAgingInterval(1ms);
+        Gate gate;
+        gate.block(pool);
+        pool.execute(Flood{&pool, &pending, &budget}, TaskPriority::HIGH);
+        pool.execute([&pending]() { pending--; }, TaskPriority::LOW);
+        pool.execute([&pending]() { pending--; });
+        gate.open();
+        pool.joinAndStop();
+        REQUIRE(pending == 0);
+        REQUIRE(budget > 0);
+    }
+    SECTION("Should promote an old task without deadline behind newer tasks with deadlines") {
+        // Each task queues another one with a deadline until the task without deadline runs
+        struct Requeue {
+            ThreadPool<>* pool;
+            std::atomic<bool>* done;
+            std::atomic<int>* budget;
+
+            void operator()() const {
+                if (!*done && budget->fetch_sub(1) > 0) {
+                    pool->execute(Requeue(*this), TaskPriority::LOW, std::chrono::steady_clock::now() + 1s);
+                }
+            }
+        };
+
+        std::atomic<bool> done = false;
+        std::atomic<int> budget = 100000;
+        ThreadPool<> pool(1);
+        pool.setAgingInterval(1ms);
+        Gate gate;
+        gate.block(pool);
+        pool.execute([&done]() { done = true; }, TaskPriority::LOW);
+        pool.execute(Requeue{&pool, &done, &budget}, TaskPriority::LOW, std::chrono::steady_clock::now() + 1s);
+        gate.open();
+        pool.joinAndStop();
+        REQUIRE(done);
+        REQUIRE(budget > 0);
+    }
+    SECTION("Should keep the FIFO order without aging") {
+        ThreadPool<> pool(1);
+        pool.setAgingInterval(0s);
+        Gate gate;
+        gate.block(pool);
+        pool.execute(record(2), TaskPriority::LOW);
+        pool.execute(record(3), TaskPriority::LOW);
+        std::this_thread::sleep_for(5ms);
+        pool.execute(record(0), TaskPriority::HIGH);
+        pool.execute(record(1));
+        gate.open();
+        pool.joinAndStop();
+        REQUIRE(order == std::vector<int>{0, 1, 2, 3});
+    }
+}
+
+TEST_CASE("BoundedMPMCQueue", "[ThreadPool]") {
+    SECTION("Should keep the FIFO order and respect the capacity") {
+        BoundedMPMCQueue<std::unique_ptr<int>> queue(3);
+        REQUIRE(queue.getCapacity() == 4);
+        for (int i = 0; i < 4; i++) {
+            REQUIRE(queue.tryPush(std::make_unique<int>(i)));
+        }
+        auto extra = std::make_unique<int>(4);
+        REQUIRE_FALSE(queue.tryPush(std::move(extra)));
+        REQUIRE(extra != nullptr);
+        REQUIRE(queue.getSize() == 4);
+        std::unique_ptr<int> item;
+        for (int i = 0; i < 4; i++) {
+            REQUIRE(queue.tryPop(item));
+            REQUIRE(*item == i);
+        }
+        REQUIRE_FALSE(queue.tryPop(item));
+        REQUIRE(queue.getSize() == 0);
+    }
+    SECTION("Every element should be taken exactly once with concurrent producers and consumers") {
+        constexpr int threadCount = 4;
+        constexpr int perThread = 20000;
+        BoundedMPMCQueue<int> queue(64);
+        std::vector<std::atomic<int>> taken(threadCount * perThread);
+        std::atomic<int> remaining = threadCount * perThread;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; t++) {
+            // Every thread produces and consumes, taking an element when the queue is full
+            threads.emplace_back([&, t]() {
+                int item;
+                for (int i = 0; i < perThread; i++) {
+                    while (!queue.tryPush(t * perThread + i)) {
+                        if (queue.tryPop(item)) {
+                            taken[item]++;
+                            remaining--;
+                        }
+                    }
+                }
+                while (remaining > 0) {
+                    if (queue.tryPop(item)) {
+                        taken[item]++;
+                        remaining--;
+                    } else {
+                        std::this_thread::sleep_for(std::chrono::microseconds(10));
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        bool allOnce = true;
+        for (auto& value : taken) {
+            allOnce = allOnce && value == 1;
+        }
+        REQUIRE(allOnce);
+    }
+}
+
+TEST_CASE("WorkStealingDeque", "[ThreadPool]") {
+    SECTION("The owner should pop in LIFO order and the thieves steal in FIFO order") {
+        WorkStealingDeque<int> deque(2);
+        REQUIRE(deque.isEmpty());
+        for (int i = 0; i < 10; i++) {
+            deque.push(i);
+        }
+        REQUIRE_FALSE(deque.isEmpty());
+        REQUIRE(deque.steal() == 0);
+        REQUIRE(deque.steal() == 1);
+        REQUIRE(deque.pop() == 9);
+        REQUIRE(deque.pop() == 8);
+        for (int i = 2; i < 8; i++) {
+            REQUIRE(deque.steal() == i);
+        }
+        REQUIRE_FALSE(deque.pop().has_value());
+        REQUIRE_FALSE(deque.steal().has_value());
+        REQUIRE(deque.isEmpty());
+    }
+    SECTION("Every element should be taken exactly once with concurrent thieves") {
+        constexpr int count = 100000;
+        WorkStealingDeque<int> deque;
+        std::vector<std::atomic<int>> taken(count);
+        std::atomic<bool> done = false;
+        std::vector<std::thread> thieves;
+        for (int t = 0; t < 3; t++) {
+            thieves.emplace_back([&]() {
+                while (!done || !deque.isEmpty()) {
+                    if (std::optional<int> item = deque.steal()) {
+                        taken[*item]++;
+                    }
+                }
+            });
+        }
+        for (int i = 0; i < count; i++) {
+            deque.push(i);
+            if (i % 3 == 0) {
+                if (std::optional<int> item = deque.pop()) {
+                    taken[*item]++;
+                }
+            }
+        }
+        while (std::optional<int> item = deque.pop()) {
+            taken[*item]++;
+        }
+        done = true;
+        for (auto& thief : thieves) {
+            thief.join();
+        }
+        bool allOnce = true;
+        for (auto& value : taken) {
+            allOnce = allOnce && value == 1;
+        }
+        REQUIRE(allOnce);
+    }
+}
@@ -0,0 +1,104 @@
+#include <catch2/catch.hpp>
+
+#include <edoren/util/BinaryEncoding.hpp>
+
+using namespace edoren;
+
+namespace {
+
+Vector<uint8_t> ToBytes(const char* text) {
+    Vector<uint8_t> bytes;
+    for (; *text != '\0'; text++) {
+        bytes.pushBack(static_cast<uint8_t>(*text));
+    }
+    return bytes;
+}
+
+}  // namespace
+
+TEST_CASE("Calling EncodeBase64", "[BinaryEncoding]") {
+    SECTION("Should encode the RFC 4648 test vectors") {
+        REQUIRE(EncodeBase64(ToBytes("")) == "");
+        REQUIRE(EncodeBase64(ToBytes("f")) == "Zg==");
+        REQUIRE(EncodeBase64(ToBytes("fo")) == "Zm8=");
+        REQUIRE(EncodeBase64(ToBytes("foo")) == "Zm9v");
+        REQUIRE(EncodeBase64(ToBytes("foob")) == "Zm9vYg==");
+        REQUIRE(EncodeBase64(ToBytes("fooba")) == "Zm9vYmE=");
+        REQUIRE(EncodeBase64(ToBytes("foobar")) == "Zm9vYmFy");
+    }
+
+    SECTION("Should use the URL safe alphabet without padding") {
+        Vector<uint8_t> bytes = {0xFB, 0xFF, 0xBF, 0xFE};
+        REQUIRE(EncodeBase64(bytes) == "+/+//g==");
+        REQUIRE(EncodeBase64(bytes, Base64Alphabet::URL_SAFE) == "-_-__g");
+    }
+}
+
+TEST_CASE("Calling DecodeBase64", "[BinaryEncoding]") {
+    Vector<uint8_t> bytes;
+
+    SECTION("Should decode with or without padding") {
+        REQUIRE(DecodeBase64("Zm9vYmE=", bytes) == true);
+        REQUIRE(bytes == ToBytes("fooba"));
+        REQUIRE(DecodeBase64("Zm9vYg", bytes) == true);
+        REQUIRE(bytes == ToBytes("foob"));
+        REQUIRE(DecodeBase64("", bytes) == true);
+        REQUIRE(bytes.isEmpty());
+        REQUIRE(DecodeBase64("-_-__g", bytes, Base64Alphabet::URL_SAFE) == true);
+        REQUIRE(bytes == Vector<uint8_t>{0xFB, 0xFF, 0xBF, 0xFE});
+    }
+
+    SECTION("Should fail on invalid text") {
+        REQUIRE(DecodeBase64("Zm9v YmFy", bytes) == false);
+        REQUIRE(bytes.isEmpty());
+        REQUIRE(DecodeBase64("Zm9vY", bytes) == false);
+        REQUIRE(DecodeBase64("Zg=a", bytes) == false);
+        REQUIRE(DecodeBase64("-_-__g", bytes) == false);
+        REQUIRE(DecodeBase64("+/+//g==", bytes, Base64Alphabet::URL_SAFE) == false);
+    }
+
+    SECTION("Should fail when the unused bits of the last group are not zero") {
+        REQUIRE(DecodeBase64("QQ==", bytes) == true);
+        REQUIRE(bytes == ToBytes("A"));
+        REQUIRE(DecodeBase64("QR==", bytes) == false);
+        REQUIRE(bytes.isEmpty());
+        REQUIRE(DecodeBase64("QUI", bytes) == true);
+        REQUIRE(bytes == ToBytes("AB"));
+        REQUIRE(DecodeBase64("QUJ", bytes) == false);
+    }
+
+    SECTION("Should round trip all the byte values") {
+        Vector<uint8_t> all;
+        for (int i = 0; i < 256; i++) {
+            all.pushBack(static_cast<uint8_t>(i));
+        }
+        for (size_t size = 250; size <= all.getSize(); size++) {
+            Vector<uint8_t> data(all.begin(), all.begin() + size);
+            REQUIRE(DecodeBase64(EncodeBase64(data), bytes) == true);
+            REQUIRE(bytes == data);
+            REQUIRE(DecodeBase64(EncodeBase64(data, Base64Alphabet::URL_SAFE), bytes, Base64Alphabet::URL_SAFE) == true);
+            REQUIRE(bytes == data);
+        }
+    }
+}
+
+TEST_CASE("Calling EncodeHex and DecodeHex", "[BinaryEncoding]") {
+    Vector<uint8_t> data = {0x00, 0x1F, 0xA0, 0xFF};
+    Vector<uint8_t> bytes;
+
+    SECTION("Should encode with the requested case") {
+        REQUIRE(EncodeHex(data) == "001fa0ff");
+        REQUIRE(EncodeHex(data, true) == "001FA0FF");
+    }
+
+    SECTION("Should decode both cases") {
+        REQUIRE(DecodeHex("001fA0Ff", bytes) == true);
+        REQUIRE(bytes == data);
+    }
+
+    SECTION("Should fail on invalid text") {
+        REQUIRE(DecodeHex("001", bytes) == false);
+        REQUIRE(DecodeHex("0g", bytes) == false);
+        REQUIRE(bytes.isEmpty());
+    }
+}
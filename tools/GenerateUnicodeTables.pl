@@ -0,0 +1,537 @@
+#!/usr/bin/env perl
+#
+# Generates the Unicode lookup tables used by EdoTools from the Unicode
+# Character Database bundled with Perl (Unicode::UCD).
+#
+# Usage: perl tools/GenerateUnicodeTables.pl <repository root>
+#
+# The tables are stored as multi-stage lookup tables: the code point is split
+# in a block index and an offset inside the block, the first stage maps each
+# block to a deduplicated block of the second stage which stores an index to
+# a record with the actual data. Tables used only by the library go to
+# src/edoren/unicode, the ones needed by constexpr code in the public headers
+# go to include/edoren/unicode.
+
+use strict;
+use warnings;
+
+use File::Spec;
+use Unicode::UCD qw(prop_invlist prop_invmap);
+
+my $rootDir = shift @ARGV or die "usage: $0 <repository root>\n";
+my $sourceDir = File::Spec->catdir($rootDir, 'src', 'edoren', 'unicode');
+my $includeDir = File::Spec->catdir($rootDir, 'include', 'edoren', 'unicode');
+my $unicodeVersion = Unicode::UCD::UnicodeVersion();
+
+my $maxCodePoint = 0x10FFFF;
+
+# Expand an inversion map to an array with the value of each code point
+sub expand_property {
+    my ($property) = @_;
+    my ($list, $map, $format, $default) = prop_invmap($property);
+    die "unable to load property $property\n" unless defined $list;
+    my @values;
+    for my $i (0 .. $#$list) {
+        my $start = $list->[$i];
+        my $end = ($i < $#$list) ? $list->[$i + 1] - 1 : $maxCodePoint;
+        for my $cp ($start .. $end) {
+            my $value = $map->[$i];
+            if ($format =~ /^a/ && !ref($value) && $value ne $default && $value =~ /^\d+$/) {
+                # Adjusted format, the value increases along the range
+                $value += $cp - $start;
+            }
+            $values[$cp] = $value;
+        }
+    }
+    return (\@values, $default);
+}
+
+# Expand an inversion list to the list of code points it contains
+sub expand_inversion_list {
+    my ($property) = @_;
+    my @list = prop_invlist($property);
+    my @codePoints;
+    for (my $i = 0; $i < @list; $i += 2) {
+        my $end = ($i + 1 < @list) ? $list[$i + 1] - 1 : $maxCodePoint;
+        push @codePoints, ($list[$i] .. $end);
+    }
+    return @codePoints;
+}
+
+# Split an array of small integers in a two-stage table
+sub build_stages {
+    my ($values, $shift, $limit) = @_;
+    my $blockSize = 1 << $shift;
+    my (@stage1, @stage2, %blocks);
+    for (my $start = 0; $start <= $limit; $start += $blockSize) {
+        my @block = map { $values->[$_] // 0 } ($start .. $start + $blockSize - 1);
+        my $key = join(',', @block);
+        if (!exists $blocks{$key}) {
+            $blocks{$key} = scalar(@stage2) / $blockSize;
+            push @stage2, @block;
+        }
+        push @stage1, $blocks{$key};
+    }
+    return (\@stage1, \@stage2);
+}
+
+# Split an array of small integers in a three-stage table, the second stage
+# blocks span 1 << $shift1 code points and the third stage ones 1 << $shift2
+sub build_three_stages {
+    my ($values, $shift1, $shift2, $limit) = @_;
+    my ($blocks, $stage3) = build_stages($values, $shift2, $limit);
+    my ($stage1, $stage2) = build_stages($blocks, $shift1 - $shift2, $#$blocks);
+    return ($stage1, $stage2, $stage3);
+}
+
+sub smallest_type {
+    my ($values) = @_;
+    my ($min, $max) = (0, 0);
+    for (@$values) {
+        $min = $_ if $_ < $min;
+        $max = $_ if $_ > $max;
+    }
+    return $min < 0 ? ($max < 0x80 && $min >= -0x80 ? 'int8_t' : $max < 0x8000 && $min >= -0x8000 ? 'int16_t' : 'int32_t')
+                    : ($max < 0x100 ? 'uint8_t' : $max < 0x10000 ? 'uint16_t' : 'uint32_t');
+}
+
+sub format_array {
+    my ($type, $name, $values, $perLine) = @_;
+    $perLine //= 16;
+    my $out = "inline constexpr $type ${name}[] = {\n";
+    for (my $i = 0; $i < @$values; $i += $perLine) {
+        my $last = $i + $perLine - 1;
+        $last = $#$values if $last > $#$values;
+        $out .= "    " . join(", ", @$values[$i .. $last]) . ",\n";
+    }
+    $out .= "};\n";
+    return $out;
+}
+
+sub write_file {
+    my ($directory, $fileName, $content) = @_;
+    my $path = File::Spec->catfile($directory, $fileName);
+    open(my $fh, '>', $path) or die "unable to open $path: $!\n";
+    print $fh "// Generated by tools/GenerateUnicodeTables.pl from the Unicode $unicodeVersion database, do not edit.\n\n";
+    print $fh $content;
+    close($fh);
+}
+
+sub to_hex {
+    return sprintf("0x%04X", $_[0]);
+}
+
+########################################
+# Case mapping
+########################################
+
+sub generate_case_tables {
+    my @simpleProperties = ('Simple_Lowercase_Mapping', 'Simple_Uppercase_Mapping', 'Simple_Case_Folding');
+    my @fullProperties = ('Lowercase_Mapping', 'Uppercase_Mapping', 'Case_Folding');
+
+    my @simple = map { [expand_property($_)] } @simpleProperties;
+    my @full = map { [expand_property($_)] } @fullProperties;
+
+    my (%records, @records, @recordIndex, %sequences, @sequences);
+    @records = ([0, 0, 0, 0, 0, 0]);
+    $records{join(',', @{$records[0]})} = 0;
+    @sequences = ([]);
+    my $lastCodePoint = 0;
+
+    for my $cp (0 .. $maxCodePoint) {
+        my @record;
+        for my $i (0 .. 2) {
+            my ($values, $default) = @{$simple[$i]};
+            my $value = $values->[$cp];
+            push @record, ($value eq $default) ? 0 : $value - $cp;
+        }
+        for my $i (0 .. 2) {
+            my ($values, $default) = @{$full[$i]};
+            my $value = $values->[$cp];
+            my $sequenceIndex = 0;
+            if (ref($value)) {
+                my $key = join(',', @$value);
+                if (!exists $sequences{$key}) {
+                    $sequences{$key} = scalar(@sequences);
+                    push @sequences, $value;
+                }
+                $sequenceIndex = $sequences{$key};
+            }
+            push @record, $sequenceIndex;
+        }
+        my $key = join(',', @record);
+        if (!exists $records{$key}) {
+            $records{$key} = scalar(@records);
+            push @records, \@record;
+        }
+        $recordIndex[$cp] = $records{$key};
+        $lastCodePoint = $cp if $records{$key} != 0;
+    }
+
+    my $shift = 7;
+    my ($stage1, $stage2) = build_stages(\@recordIndex, $shift, $lastCodePoint);
+
+    my $content = "namespace edoren::unicode::internal {\n\n";
+    $content .= "inline constexpr char32_t sCaseMaxCodePoint = " . to_hex($lastCodePoint) . ";\n";
+    $content .= "inline constexpr uint32_t sCaseBlockShift = $shift;\n\n";
+    $content .= format_array(smallest_type($stage1), 'sCaseStage1', $stage1);
+    $content .= "\n";
+    $content .= format_array(smallest_type($stage2), 'sCaseStage2', $stage2);
+    $content .= "\n";
+    $content .= "inline constexpr CaseRecord sCaseRecords[] = {\n";
+    for my $record (@records) {
+        $content .= "    {" . join(", ", @$record) . "},\n";
+    }
+    $content .= "};\n\n";
+    $content .= "inline constexpr CaseSequence sCaseSequences[] = {\n";
+    for my $sequence (@sequences) {
+        my @padded = (@$sequence, (0) x (3 - @$sequence));
+        $content .= "    {" . scalar(@$sequence) . ", {" . join(", ", map { to_hex($_) } @padded) . "}},\n";
+    }
+    $content .= "};\n\n";
+    $content .= "}  // namespace edoren::unicode::internal\n";
+
+    write_file($sourceDir, 'CaseTables.inl', $content);
+}
+
+########################################
+# Normalization
+########################################
+
+sub generate_normalization_tables {
+    my ($ccc) = expand_property('Canonical_Combining_Class');
+    my ($decomposition, $decompositionDefault) = expand_property('Decomposition_Mapping');
+    my ($decompositionType) = expand_property('Decomposition_Type');
+    my %quickCheck = map { $_ => (expand_property("${_}_Quick_Check"))[0] } ('NFD', 'NFC', 'NFKD', 'NFKC');
+    my %excluded = map { $_ => 1 } expand_inversion_list('Full_Composition_Exclusion');
+
+    my ($hangulFirst, $hangulLast) = (0xAC00, 0xD7A3);
+
+    my $directDecomposition = sub {
+        my ($cp, $compat) = @_;
+        return undef if $cp >= $hangulFirst && $cp <= $hangulLast;
+        my $value = $decomposition->[$cp];
+        return undef if !ref($value) && $value eq $decompositionDefault;
+        return undef if !$compat && $decompositionType->[$cp] ne 'Canonical';
+        return ref($value) ? [@$value] : [$value];
+    };
+
+    my $fullDecomposition;
+    $fullDecomposition = sub {
+        my ($cp, $compat) = @_;
+        my $direct = $directDecomposition->($cp, $compat);
+        return [$cp] unless defined $direct;
+        return [map { @{$fullDecomposition->($_, $compat)} } @$direct];
+    };
+
+    my $qcValue = sub {
+        my ($value) = @_;
+        return $value eq 'Yes' ? 0 : $value eq 'N' ? 1 : 2;
+    };
+
+    # Combining class and quick check properties
+    my (%records, @records, @recordIndex);
+    @records = ([0, 0]);
+    $records{'0,0'} = 0;
+    # Decompositions
+    my (%decompositionRecords, @decompositionRecords, @decompositionIndex, %sequences);
+    my @sequenceData = (0);
+    @decompositionRecords = ([0, 0]);
+    $decompositionRecords{'0,0'} = 0;
+    my $lastCodePoint = 0;
+
+    my $addSequence = sub {
+        my ($sequence) = @_;
+        my $key = join(',', @$sequence);
+        if (!exists $sequences{$key}) {
+            $sequences{$key} = scalar(@sequenceData);
+            push @sequenceData, scalar(@$sequence), @$sequence;
+        }
+        return $sequences{$key};
+    };
+
+    my @compositions;
+
+    for my $cp (0 .. $maxCodePoint) {
+        my $flags = $qcValue->($quickCheck{NFD}[$cp]) | ($qcValue->($quickCheck{NFKD}[$cp]) << 1) |
+                    ($qcValue->($quickCheck{NFC}[$cp]) << 2) | ($qcValue->($quickCheck{NFKC}[$cp]) << 4);
+        my @record = ($ccc->[$cp], $flags);
+        my $key = join(',', @record);
+        if (!exists $records{$key}) {
+            $records{$key} = scalar(@records);
+            push @records, \@record;
+        }
+        $recordIndex[$cp] = $records{$key};
+
+        my ($canonical, $compat) = (0, 0);
+        if (defined $directDecomposition->($cp, 0)) {
+            $canonical = $addSequence->($fullDecomposition->($cp, 0));
+            my $direct = $directDecomposition->($cp, 0);
+            if (@$direct == 2 && !$excluded{$cp}) {
+                push @compositions, [@$direct, $cp];
+            }
+        }
+        if (defined $directDecomposition->($cp, 1)) {
+            $compat = $addSequence->($fullDecomposition->($cp, 1));
+        }
+        my $decompositionKey = "$canonical,$compat";
+        if (!exists $decompositionRecords{$decompositionKey}) {
+            $decompositionRecords{$decompositionKey} = scalar(@decompositionRecords);
+            push @decompositionRecords, [$canonical, $compat];
+        }
+        $decompositionIndex[$cp] = $decompositionRecords{$decompositionKey};
+        $lastCodePoint = $cp if $recordIndex[$cp] != 0 || $decompositionIndex[$cp] != 0;
+    }
+
+    die "decomposition data too large\n" if @sequenceData > 0xFFFF;
+    @compositions = sort { $a->[0] <=> $b->[0] || $a->[1] <=> $b->[1] } @compositions;
+
+    my $shift = 7;
+    my ($stage1, $stage2) = build_stages(\@recordIndex, $shift, $lastCodePoint);
+    my ($decompositionStage1, $decompositionStage2) = build_stages(\@decompositionIndex, $shift, $lastCodePoint);
+
+    my $content = "namespace edoren::unicode::internal {\n\n";
+    $content .= "inline constexpr char32_t sNormalizationMaxCodePoint = " . to_hex($lastCodePoint) . ";\n";
+    $content .= "inline constexpr uint32_t sNormalizationBlockShift = $shift;\n\n";
+    $content .= format_array(smallest_type($stage1), 'sNormalizationStage1', $stage1);
+    $content .= "\n";
+    $content .= format_array(smallest_type($stage2), 'sNormalizationStage2', $stage2);
+    $content .= "\n";
+    $content .= "inline constexpr NormalizationRecord sNormalizationRecords[] = {\n";
+    $content .= "    {" . join(", ", @$_) . "},\n" for @records;
+    $content .= "};\n\n";
+    $content .= format_array(smallest_type($decompositionStage1), 'sDecompositionStage1', $decompositionStage1);
+    $content .= "\n";
+    $content .= format_array(smallest_type($decompositionStage2), 'sDecompositionStage2', $decompositionStage2);
+    $content .= "\n";
+    $content .= "inline constexpr DecompositionRecord sDecompositionRecords[] = {\n";
+    $content .= "    {" . join(", ", @$_) . "},\n" for @decompositionRecords;
+    $content .= "};\n\n";
+    $content .= "// Each sequence is stored as its size followed by the code points\n";
+    $content .= format_array('char32_t', 'sDecompositionData', [map { to_hex($_) } @sequenceData], 12);
+    $content .= "\n";
+    $content .= "// Sorted by the first and second code points\n";
+    $content .= "inline constexpr CompositionRecord sCompositionRecords[] = {\n";
+    $content .= "    {" . join(", ", map { to_hex($_) } @$_) . "},\n" for @compositions;
+    $content .= "};\n\n";
+    $content .= "}  // namespace edoren::unicode::internal\n";
+
+    write_file($sourceDir, 'NormalizationTables.inl', $content);
+}
+
+########################################
+# Grapheme cluster break
+########################################
+
+sub generate_grapheme_tables {
+    # Must match the order of the GraphemeBreak enum in Unicode.cpp
+    my @breaks = ('Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator', 'Prepend', 'SpacingMark',
+                  'L', 'V', 'T', 'LV', 'LVT');
+    my %breakIndex = map { $breaks[$_] => $_ } (0 .. $#breaks);
+    $breakIndex{'ExtPict_XX'} = $breakIndex{'Other'};  # Perl extension for pictographic code points
+
+    my ($break) = expand_property('Grapheme_Cluster_Break');
+    my %pictographic = map { $_ => 1 } expand_inversion_list('Extended_Pictographic');
+
+    my @values;
+    my $lastCodePoint = 0;
+    for my $cp (0 .. $maxCodePoint) {
+        die "unknown grapheme cluster break $break->[$cp]\n" unless exists $breakIndex{$break->[$cp]};
+        $values[$cp] = $breakIndex{$break->[$cp]} | ($pictographic{$cp} ? 0x10 : 0);
+        $lastCodePoint = $cp if $values[$cp] != 0;
+    }
+
+    my $shift = 7;
+    my ($stage1, $stage2) = build_stages(\@values, $shift, $lastCodePoint);
+
+    my $content = "namespace edoren::unicode::internal {\n\n";
+    $content .= "// The lower 4 bits store the grapheme cluster break property, the bit 4 the Extended_Pictographic property\n";
+    $content .= "inline constexpr char32_t sGraphemeMaxCodePoint = " . to_hex($lastCodePoint) . ";\n";
+    $content .= "inline constexpr uint32_t sGraphemeBlockShift = $shift;\n\n";
+    $content .= format_array(smallest_type($stage1), 'sGraphemeStage1', $stage1);
+    $content .= "\n";
+    $content .= format_array(smallest_type($stage2), 'sGraphemeStage2', $stage2);
+    $content .= "\n";
+    $content .= "}  // namespace edoren::unicode::internal\n";
+
+    write_file($sourceDir, 'GraphemeTables.inl', $content);
+}
+
+########################################
+# Character properties
+########################################
+
+sub generate_property_tables {
+    # Must match the order of the GeneralCategory and EastAsianWidth enums in Unicode.hpp
+    my @categories = (
+        ['Lu', 'UPPERCASE_LETTER'], ['Ll', 'LOWERCASE_LETTER'], ['Lt', 'TITLECASE_LETTER'],
+        ['Lm', 'MODIFIER_LETTER'], ['Lo', 'OTHER_LETTER'], ['Mn', 'NONSPACING_MARK'], ['Mc', 'SPACING_MARK'],
+        ['Me', 'ENCLOSING_MARK'], ['Nd', 'DECIMAL_NUMBER'], ['Nl', 'LETTER_NUMBER'], ['No', 'OTHER_NUMBER'],
+        ['Pc', 'CONNECTOR_PUNCTUATION'], ['Pd', 'DASH_PUNCTUATION'], ['Ps', 'OPEN_PUNCTUATION'],
+        ['Pe', 'CLOSE_PUNCTUATION'], ['Pi', 'INITIAL_PUNCTUATION'], ['Pf', 'FINAL_PUNCTUATION'],
+        ['Po', 'OTHER_PUNCTUATION'], ['Sm', 'MATH_SYMBOL'], ['Sc', 'CURRENCY_SYMBOL'], ['Sk', 'MODIFIER_SYMBOL'],
+        ['So', 'OTHER_SYMBOL'], ['Zs', 'SPACE_SEPARATOR'], ['Zl', 'LINE_SEPARATOR'], ['Zp', 'PARAGRAPH_SEPARATOR'],
+        ['Cc', 'CONTROL'], ['Cf', 'FORMAT'], ['Cs', 'SURROGATE'], ['Co', 'PRIVATE_USE'], ['Cn', 'UNASSIGNED']);
+    my @widths = (['Neutral', 'NEUTRAL'], ['A', 'AMBIGUOUS'], ['H', 'HALFWIDTH'], ['W', 'WIDE'], ['F', 'FULLWIDTH'],
+                  ['Na', 'NARROW']);
+    my %categoryName = map { $_->[0] => $_->[1] } @categories;
+    my %widthName = map { $_->[0] => $_->[1] } @widths;
+
+    my ($category) = expand_property('General_Category');
+    my ($width) = expand_property('East_Asian_Width');
+    my %whiteSpace = map { $_ => 1 } expand_inversion_list('White_Space');
+    my %alphabetic = map { $_ => 1 } expand_inversion_list('Alphabetic');
+
+    my (%records, @records, @recordIndex);
+    for my $cp (0 .. $maxCodePoint) {
+        die "unknown general category $category->[$cp]\n" unless exists $categoryName{$category->[$cp]};
+        die "unknown east asian width $width->[$cp]\n" unless exists $widthName{$width->[$cp]};
+        my $flags = ($whiteSpace{$cp} ? 0x01 : 0) | ($alphabetic{$cp} ? 0x02 : 0);
+        my $key = join(',', $categoryName{$category->[$cp]}, $widthName{$width->[$cp]}, $flags);
+        if (!exists $records{$key}) {
+            $records{$key} = scalar(@records);
+            push @records, [$categoryName{$category->[$cp]}, $widthName{$width->[$cp]}, $flags];
+        }
+        $recordIndex[$cp] = $records{$key};
+    }
+
+    # Three stages keep the tables small enough to stay in the L1 cache
+    my ($shift1, $shift2) = (9, 4);
+    my ($stage1, $stage2, $stage3) = build_three_stages(\@recordIndex, $shift1, $shift2, $maxCodePoint);
+
+    my $content = "namespace edoren::unicode::internal {\n\n";
+    $content .= "inline constexpr uint32_t sPropertyStage1Shift = $shift1;\n";
+    $content .= "inline constexpr uint32_t sPropertyStage2Shift = $shift2;\n\n";
+    $content .= format_array(smallest_type($stage1), 'sPropertyStage1', $stage1);
+    $content .= "\n";
+    $content .= format_array(smallest_type($stage2), 'sPropertyStage2', $stage2);
+    $content .= "\n";
+    $content .= format_array(smallest_type($stage3), 'sPropertyStage3', $stage3);
+    $content .= "\n";
+    $content .= "inline constexpr PropertyRecord sPropertyRecords[] = {\n";
+    for my $record (@records) {
+        $content .= sprintf("    {GeneralCategory::%s, EastAsianWidth::%s, 0x%02X},\n", @$record);
+    }
+    $content .= "};\n\n";
+    $content .= "}  // namespace edoren::unicode::internal\n";
+
+    write_file($includeDir, 'PropertyTables.inl', $content);
+}
+
+########################################
+# Collation
+########################################
+
+# Find the Default Unicode Collation Element Table bundled with Unicode::Collate
+sub find_collation_table {
+    for my $dir (@INC) {
+        my $path = File::Spec->catfile($dir, 'Unicode', 'Collate', 'allkeys.txt');
+        return $path if -f $path;
+    }
+    die "unable to find the Unicode::Collate allkeys.txt file\n";
+}
+
+sub generate_collation_tables {
+    my $path = find_collation_table();
+    open(my $fh, '<', $path) or die "unable to open $path: $!\n";
+
+    my ($ducetVersion, @implicitRanges, %entries, @contractions);
+    while (my $line = <$fh>) {
+        if ($line =~ /^\@version\s+(\S+)/) {
+            $ducetVersion = $1;
+        } elsif ($line =~ /^\@implicitweights\s+([0-9A-F]+)\.\.([0-9A-F]+);\s*([0-9A-F]+)/) {
+            push @implicitRanges, [hex($1), hex($2), hex($3)];
+        } elsif ($line =~ /^([0-9A-F ]+?)\s*;\s*((?:\[[.*][0-9A-F.]+\])+)/) {
+            my @codePoints = map { hex } split(/ /, $1);
+            # The variable weighting is non-ignorable, so the variable elements are not special
+            my @elements = map {
+                my ($primary, $secondary, $tertiary) = map { hex } split(/\./, $_);
+                ($primary << 16) | ($secondary << 5) | $tertiary
+            } ($2 =~ /\[[.*]([0-9A-F.]+)\]/g);
+            die "contraction too long\n" if @codePoints > 3;
+            if (@codePoints == 1) {
+                $entries{$codePoints[0]} = \@elements;
+            } else {
+                push @contractions, [\@codePoints, \@elements];
+            }
+        }
+    }
+    close($fh);
+
+    # Deduplicated list of collation elements, each entry is stored as (offset << 6) | (size << 1)
+    my (@elements, %elementOffsets);
+    my $addElements = sub {
+        my ($list) = @_;
+        my $key = join(',', @$list);
+        if (!exists $elementOffsets{$key}) {
+            $elementOffsets{$key} = scalar(@elements);
+            push @elements, @$list;
+        }
+        die "too many collation elements\n" if @$list >= 32;
+        return ($elementOffsets{$key} << 6) | (scalar(@$list) << 1);
+    };
+
+    my %startsContraction = map { $_->[0][0] => 1 } @contractions;
+    my @values;
+    my $lastCodePoint = 0;
+    for my $cp (sort { $a <=> $b } keys %entries) {
+        $values[$cp] = $addElements->($entries{$cp}) | ($startsContraction{$cp} ? 1 : 0);
+        $lastCodePoint = $cp;
+    }
+
+    my @contractionRecords;
+    for my $contraction (sort { join(',', @{$a->[0]}) cmp join(',', @{$b->[0]}) } @contractions) {
+        my @sequence = (@{$contraction->[0]}, (0) x (3 - @{$contraction->[0]}));
+        push @contractionRecords, [@sequence, $addElements->($contraction->[1])];
+    }
+    @contractionRecords = sort { $a->[0] <=> $b->[0] || $a->[1] <=> $b->[1] || $a->[2] <=> $b->[2] } @contractionRecords;
+
+    # Implicit weights, the other Unified_Ideograph code points and the unassigned ones are computed at runtime
+    my %origins;
+    for my $range (@implicitRanges) {
+        my ($first, $last, $base) = @$range;
+        $origins{$base} = $first if !exists $origins{$base} || $first < $origins{$base};
+    }
+    my @ideographs = prop_invlist('Unified_Ideograph');
+    for (my $i = 0; $i < @ideographs; $i += 2) {
+        my ($first, $last) = ($ideographs[$i], $ideographs[$i + 1] - 1);
+        my $core = ($first >= 0x4E00 && $last <= 0x9FFF) || ($first >= 0xF900 && $last <= 0xFAFF);
+        push @implicitRanges, [$first, $last, $core ? 0xFB40 : 0xFB80];
+        $origins{$core ? 0xFB40 : 0xFB80} = 0;
+    }
+    @implicitRanges = sort { $a->[0] <=> $b->[0] } @implicitRanges;
+
+    my $shift = 7;
+    my ($stage1, $stage2) = build_stages(\@values, $shift, $lastCodePoint);
+
+    my $content = "namespace edoren::unicode::internal {\n\n";
+    $content .= "// Derived from the Default Unicode Collation Element Table $ducetVersion\n";
+    $content .= "inline constexpr char32_t sCollationMaxCodePoint = " . to_hex($lastCodePoint) . ";\n";
+    $content .= "inline constexpr uint32_t sCollationBlockShift = $shift;\n\n";
+    $content .= format_array(smallest_type($stage1), 'sCollationStage1', $stage1);
+    $content .= "\n";
+    $content .= format_array(smallest_type($stage2), 'sCollationStage2', $stage2, 8);
+    $content .= "\n";
+    $content .= format_array('uint32_t', 'sCollationElements', [map { sprintf("0x%08X", $_) } @elements], 8);
+    $content .= "\n";
+    $content .= "inline constexpr CollationContraction sCollationContractions[] = {\n";
+    for my $record (@contractionRecords) {
+        $content .= "    {{" . join(", ", map { to_hex($_) } @$record[0 .. 2]) . "}, $record->[3]},\n";
+    }
+    $content .= "};\n\n";
+    $content .= "inline constexpr CollationImplicitRange sCollationImplicitRanges[] = {\n";
+    for my $range (@implicitRanges) {
+        my ($first, $last, $base) = @$range;
+        $content .= "    {" . join(", ", to_hex($first), to_hex($last), to_hex($origins{$base}), to_hex($base)) . "},\n";
+    }
+    $content .= "};\n\n";
+    $content .= "}  // namespace edoren::unicode::internal\n";
+
+    write_file($sourceDir, 'CollationTables.inl', $content);
+}
+
+generate_case_tables();
+generate_normalization_tables();
+generate_grapheme_tables();
+generate_property_tables();
+generate_collation_tables();